@@ -26,6 +26,8 @@
 unsigned int Storage_Block[STORAGE_BUFFER_SIZE / 4];
 #define STORAGE_DATA_BUF   ((uint32_t)&Storage_Block[0])
 
+#define SD_MAX_BLOCKS		128		/* Maximum number of blocks per SD_ReadDisk()/SD_WriteDisk() call (1..255) */
+
 //extern unsigned char SD_WriteDisk(unsigned char *buf,unsigned int  sector,unsigned char cnt);
 //extern unsigned char SD_ReadDisk(unsigned char *buf,unsigned int sector,unsigned char cnt);
 
@@ -149,6 +151,7 @@ DRESULT disk_read (
 	
 	#if 1
 	DRESULT res;
+	UINT cnt;
 
 	  	if (pdrv) {
 			res = (DRESULT)STA_NOINIT;	
@@ -156,14 +159,14 @@ DRESULT disk_read (
 		}
 
 
-     if(count==0||count>=2)
-	   	{	 
-		res =   (DRESULT)STA_NOINIT;
-		return res;
+	if (count == 0) return RES_PARERR;
+
+	while (count) {		/* The SD driver transfers up to SD_MAX_BLOCKS sectors at a time */
+		cnt = (count > SD_MAX_BLOCKS) ? SD_MAX_BLOCKS : count;
+		if (SD_ReadDisk(buff, sector, (unsigned char)cnt)) return RES_ERROR;
+		buff += cnt * 512; sector += cnt; count -= cnt;
 	}
-		
-	    SD_ReadDisk(buff,sector,count);
-		res =RES_OK;	/* Clear STA_NOINIT */;
+	res = RES_OK;
 
 	return res;	
 	#else
@@ -236,6 +239,7 @@ DRESULT disk_write (
 	#if 1
 
 	DRESULT  res;	
+	UINT cnt;
 
 
  	if (pdrv) {
@@ -245,14 +249,14 @@ DRESULT disk_write (
 
 
 	     
-    if(count==0||count>=2)
-	{	 
-		res = (DRESULT)  STA_NOINIT;
-		return res;
-	}
+	if (count == 0) return RES_PARERR;
 
-	SD_WriteDisk((unsigned char *)buff,sector,count);
-	    res = RES_OK;
+	while (count) {		/* The SD driver transfers up to SD_MAX_BLOCKS sectors at a time */
+		cnt = (count > SD_MAX_BLOCKS) ? SD_MAX_BLOCKS : count;
+		if (SD_WriteDisk((unsigned char *)buff, sector, (unsigned char)cnt)) return RES_ERROR;
+		buff += cnt * 512; sector += cnt; count -= cnt;
+	}
+	res = RES_OK;
 
 	return res;	
 	#else
@@ -308,7 +312,8 @@ DRESULT disk_ioctl (
 	#if 1
 	DRESULT res;
 
-//	BYTE n;
+	DWORD n;
+	LBA_t *lba;
 
 	if (pdrv) return RES_PARERR;
 
@@ -318,7 +323,7 @@ DRESULT disk_ioctl (
 		break;
 
 	case GET_SECTOR_COUNT :	/* Get number of sectors on the disk (DWORD) */
-		*(DWORD*)buff = SD_GetSectorCount()>>11;
+		*(DWORD*)buff = SD_GetSectorCount();
 		res = RES_OK;
 		break;
 
@@ -328,19 +333,32 @@ DRESULT disk_ioctl (
 		break;
 
 	case GET_BLOCK_SIZE :	/* Get erase block size in unit of sector (DWORD) */
-		*(DWORD*)buff = 1;
+		n = SD_GetBlockSize();				/* AU size of the card */
+		n &= 0 - n;							/* Power of 2 that the AU boundaries are aligned to */
+		*(DWORD*)buff = (n > 0x8000) ? 0x8000 : n;
 		res = RES_OK;
 		break;
 
+	case CTRL_BUSY :		/* Get busy status of the card without waiting (BYTE) */
+		*(BYTE*)buff = SD_IsBusy();
+		res = RES_OK;
+		break;
+
+	case CTRL_ZERO :		/* Fill the block of sectors with zeros (LBA_t[2]) */
+		lba = (LBA_t*)buff;
+		res = (lba[1] >= lba[0] && SD_ZeroDisk((unsigned int)lba[0], (unsigned int)(lba[1] - lba[0] + 1)) == 0) ? RES_OK : RES_ERROR;
+		break;
+
+	case MMC_GET_CID :		/* Get CID register of the card (BYTE[16]) */
+		res = SD_GetCID((unsigned char*)buff) == 0 ? RES_OK : RES_ERROR;
+		break;
+
 
 	default:
 		res = RES_PARERR;
 	}
 
 
-	res = RES_OK;
-
-
 	return res;	
 	#else
 	DRESULT res;
@@ -49,6 +49,8 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 #define GET_SECTOR_SIZE		2	/* Get sector size (needed at FF_MAX_SS != FF_MIN_SS) */
 #define GET_BLOCK_SIZE		3	/* Get erase block size (needed at FF_USE_MKFS == 1) */
 #define CTRL_TRIM			4	/* Inform device that the data on the block of sectors is no longer used (needed at FF_USE_TRIM == 1) */
+#define CTRL_BUSY			9	/* Get busy status of the device without waiting (BYTE, 1:busy) (used at FF_USE_ASYNC == 1) */
+#define CTRL_ZERO			15	/* Fill the block of sectors with zeros (LBA_t[2]: start, end) (used at FF_USE_ZEROFILL == 1) */
 
 /* Generic command (Not used by FatFs) */
 #define CTRL_POWER			5	/* Get/Set power status */
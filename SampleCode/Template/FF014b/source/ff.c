@@ -195,6 +195,12 @@
 #define FSI_Free_Count		488		/* FAT32 FSI: Number of free clusters (DWORD) */
 #define FSI_Nxt_Free		492		/* FAT32 FSI: Last allocated cluster (DWORD) */
 
+#define JH_Sig				0		/* Journal header: Signature (DWORD) */
+#define JH_VolSN			4		/* Journal header: Volume serial number (DWORD) */
+#define JH_Count			8		/* Journal header: Number of sector images (WORD) */
+#define JH_Sum				12		/* Journal header: Checksum of the transaction (DWORD) */
+#define JH_Sect				16		/* Journal header: Home locations of the sector images (QWORD[]) */
+
 #define MBR_Table			446		/* MBR: Offset of partition table in the MBR */
 #define SZ_PTE				16		/* MBR: Size of a partition table entry */
 #define PTE_Boot			0		/* MBR PTE: Boot indicator */
@@ -266,6 +272,73 @@
 #endif
 
 
+/* Batch directory read */
+#if FF_USE_DIRBATCH && (FF_DIRENT_NAME < 13 || (FF_USE_LFN && FF_DIRENT_NAME > FF_LFN_BUF + 1) || (!FF_USE_LFN && FF_DIRENT_NAME > 13))
+#error Wrong FF_DIRENT_NAME setting
+#endif
+
+
+/* File buffer pool */
+#if FF_FBUF_POOL != 0
+#if FF_FS_TINY
+#error FF_FBUF_POOL must be 0 at tiny configuration
+#endif
+#if FF_FBUF_POOL < 0 || FF_FBUF_SECT < 2 || FF_FBUF_SECT > 128
+#error Wrong FF_FBUF_POOL or FF_FBUF_SECT setting
+#endif
+#if FF_FS_REENTRANT && FF_VOLUMES > 1
+#error FF_FBUF_POOL cannot be used in re-entrant configuration with multiple volumes
+#endif
+#endif
+
+
+/* Asynchronous file read/write */
+#if FF_USE_ASYNC
+#if FF_ASYNC_SLICE < 1 || FF_ASYNC_SLICE > 128
+#error Wrong FF_ASYNC_SLICE setting
+#endif
+#if !FF_FS_READONLY && FF_FS_MINIMIZE >= 3
+#error f_awrite() needs f_lseek() (FF_FS_MINIMIZE <= 2)
+#endif
+#endif
+
+
+/* FAT mirroring */
+#if FF_FAT_MIRROR < 0 || FF_FAT_MIRROR > 2
+#error Wrong FF_FAT_MIRROR setting
+#endif
+#if FF_FAT_MIRROR == 1
+#if FF_MIRROR_BUF < 1 || FF_MIRROR_BUF > 32
+#error Wrong FF_MIRROR_BUF setting
+#endif
+#define MIR_NRNG	(sizeof ((FATFS*)0)->mir_top / sizeof (DWORD))	/* Number of dirty FAT ranges to be recorded */
+#endif
+
+
+/* FAT in RAM */
+#if FF_FAT_RAM < 0 || FF_FAT_RAM > 128
+#error Wrong FF_FAT_RAM setting
+#endif
+#if FF_FAT_RAM && FF_USE_LFN != 3
+#error FF_FAT_RAM needs ff_memalloc() (FF_USE_LFN == 3)
+#endif
+#if FF_FS_SNAPSHOT && FF_FS_READONLY
+#error FF_FS_SNAPSHOT must be 0 at read-only configuration
+#endif
+#if FF_FS_JOURNAL
+#if FF_FS_READONLY
+#error FF_FS_JOURNAL must be 0 at read-only configuration
+#endif
+#if FF_JOURNAL_NSECT < 1 || FF_JOURNAL_NSECT > (FF_MIN_SS - JH_Sect) / 8
+#error Wrong FF_JOURNAL_NSECT setting
+#endif
+#define JNL_SIG			0x4C4E4A46	/* Signature of the journal header "FJNL" */
+#define JNL_OFS_FAT		16			/* Offset of the journal area in the reserved area (FAT/FAT32) */
+#define JNL_OFS_EXFAT	24			/* Offset of the journal area next to the backup boot region (exFAT) */
+#define JNL_SIZE		(1 + FF_JOURNAL_NSECT)	/* Size of the journal area [sector] (header + sector images) */
+#endif
+
+
 /* Timestamp */
 #if FF_FS_NORTC == 1
 #if FF_NORTC_YEAR < 1980 || FF_NORTC_YEAR > 2107 || FF_NORTC_MON < 1 || FF_NORTC_MON > 12 || FF_NORTC_MDAY < 1 || FF_NORTC_MDAY > 31
@@ -291,6 +364,121 @@ typedef struct {
 #endif
 
 
+/* Directory name index */
+#if FF_DIR_INDEX != 0
+#if FF_DIR_INDEX < 640 || FF_DIR_INDEX / 10 >= 0xFFFF
+#error Wrong FF_DIR_INDEX setting
+#endif
+#if FF_DIR_INDEX_NUM < 1 || FF_DIR_INDEX_NUM > 16
+#error Wrong FF_DIR_INDEX_NUM setting
+#endif
+#if FF_FS_REENTRANT && FF_VOLUMES > 1
+#error FF_DIR_INDEX cannot be used in re-entrant configuration with multiple volumes
+#endif
+#define DIRIDX_NREC	(FF_DIR_INDEX / 10)	/* Number of index records (a record and a hash slot per record) */
+#define DIRIDX_MIN	64					/* Minimum number of scanned entries to build the index */
+typedef struct {
+	WORD hash;		/* Hash value of the name (LFN or SFN) */
+	WORD nxt;		/* Next record in the hash chain (0xFFFF:end of chain) */
+	WORD ent;		/* Index of the SFN entry in the directory */
+	BYTE nlfn;		/* Number of LFN entries preceding the SFN entry */
+} DIRIREC;
+typedef struct {
+	FATFS *fs;		/* Volume of the indexed directory (NULL:blank slot) */
+	WORD id;		/* Volume mount ID */
+	BYTE valid;		/* Index status (0:too many names to be indexed, 1:valid) */
+	DWORD clu;		/* Start cluster of the indexed directory (key of the slot) */
+	DWORD age;		/* Last used time stamp */
+	UINT nrec;		/* Number of records in use */
+	WORD head[DIRIDX_NREC];		/* Hash slots (top record of the hash chain) */
+	DIRIREC rec[DIRIDX_NREC];	/* Name records */
+} DIRIDX;
+#endif
+
+
+/* Path resolution cache */
+#if FF_PATH_CACHE != 0
+#if FF_PATH_CACHE < 0 || FF_PATH_CACHE > 64
+#error Wrong FF_PATH_CACHE setting
+#endif
+#if FF_FS_REENTRANT && FF_VOLUMES > 1
+#error FF_PATH_CACHE cannot be used in re-entrant configuration with multiple volumes
+#endif
+#define PCACHE_NAME	32		/* Maximum length of the cached sub-directory name */
+typedef struct {
+	FATFS *fs;		/* Volume of the sub-directory (NULL:blank entry) */
+	WORD id;		/* Volume mount ID */
+	DWORD age;		/* Time stamp of the last use */
+	DWORD pclu;		/* Start cluster of the parent directory */
+	DWORD ofs;		/* Offset of the entry in the parent directory */
+	DWORD clu;		/* Start cluster of the sub-directory */
+#if FF_FS_EXFAT
+	DWORD size;		/* exFAT: Size of the sub-directory */
+	BYTE stat;		/* exFAT: Allocation status of the sub-directory */
+#endif
+#if FF_USE_LFN
+	WCHAR name[PCACHE_NAME + 1];	/* Up-case converted name of the sub-directory */
+#else
+	BYTE name[11];	/* SFN of the sub-directory */
+#endif
+} PATHCACHE;
+#endif
+
+
+/* Streaming file controls */
+#if FF_USE_STREAM != 0
+#if FF_FS_READONLY
+#error FF_USE_STREAM must be 0 at read-only configuration
+#endif
+#if FF_USE_STREAM < 0 || FF_USE_STREAM > 16
+#error Wrong FF_USE_STREAM setting
+#endif
+#if FF_FS_REENTRANT && FF_VOLUMES > 1
+#error FF_USE_STREAM cannot be used in re-entrant configuration with multiple volumes
+#endif
+#define IN_STRM_BLK(fp, clst)	((clst) >= (fp)->strm_top && (clst) < (fp)->strm_end)	/* Is the cluster in the uncommitted part of the reserved block? */
+#endif
+
+
+/* Extent allocator controls */
+#if FF_ALLOC_WIN != 0
+#if FF_FS_READONLY
+#error FF_ALLOC_WIN must be 0 at read-only configuration
+#endif
+#if FF_ALLOC_WIN < 0 || FF_ALLOC_WIN > 16
+#error Wrong FF_ALLOC_WIN setting
+#endif
+#if FF_FS_REENTRANT && FF_VOLUMES > 1
+#error FF_ALLOC_WIN cannot be used in re-entrant configuration with multiple volumes
+#endif
+#define ALC_MINWIN	16		/* Minimum window size [clusters] */
+#define ALC_GROW	8		/* Maximum growth of the window size */
+#define ALC_SCAN	4096	/* Maximum number of clusters checked to place a window */
+#define ALC_RETRY(fs)	alc_drop(fs)	/* Release the claims to retry the search of a free cluster */
+
+typedef struct {
+	FATFS*	fs;			/* Volume of the owner (null:blank entry) */
+	const FFOBJID* obj;	/* Owner file (only compared, never dereferenced) */
+	WORD	id;			/* Volume mount ID of the owner */
+	BYTE	grow;		/* Growth of the window size (1..ALC_GROW) */
+	DWORD	top;		/* Next cluster to be allocated in the window */
+	DWORD	end;		/* End of the window (next to the last cluster, 0:no window) */
+	DWORD	decl;		/* Number of clusters declared by f_sizehint() and not allocated yet */
+} ALCWIN;
+#else
+#define ALC_RETRY(fs)	0
+#endif
+
+
+/* Defragmenter controls */
+#if FF_USE_DEFRAG && FF_FS_READONLY
+#error FF_USE_DEFRAG must be 0 at read-only configuration
+#endif
+#if FF_USE_DEFRAG && FF_FS_LOCK == 0
+#error FF_USE_DEFRAG needs FF_FS_LOCK to skip the open files
+#endif
+
+
 /* SBCS up-case tables (\x80-\xFF) */
 #define TBL_CT437  {0x80,0x9A,0x45,0x41,0x8E,0x41,0x8F,0x80,0x45,0x45,0x45,0x49,0x49,0x49,0x8E,0x8F, \
 					0x90,0x92,0x92,0x4F,0x99,0x4F,0x55,0x55,0x59,0x99,0x9A,0x9B,0x9C,0x9D,0x9E,0x9F, \
@@ -472,6 +660,29 @@ static BYTE CurrVol;				/* Current drive */
 static FILESEM Files[FF_FS_LOCK];	/* Open object lock semaphores */
 #endif
 
+#if FF_DIR_INDEX != 0
+static DIRIDX DirIdx[FF_DIR_INDEX_NUM];	/* Name index slots, one per indexed directory */
+static DWORD DiAge;						/* Time stamp counter of the index slots */
+#endif
+
+#if FF_PATH_CACHE != 0
+static PATHCACHE PathCache[FF_PATH_CACHE];	/* Path resolution cache */
+static DWORD PcAge;							/* Time stamp counter of the cache */
+#endif
+
+#if FF_USE_STREAM != 0
+static FIL* StrmFiles[FF_USE_STREAM];		/* Files in streaming mode */
+#endif
+
+#if FF_ALLOC_WIN != 0
+static ALCWIN AlcWin[FF_ALLOC_WIN];			/* Allocation windows of the files */
+#endif
+
+#if FF_FBUF_POOL != 0
+static BYTE FbufPool[FF_FBUF_POOL * FF_MAX_SS];	/* File buffer pool */
+static FATFS* FbufOwner[FF_FBUF_POOL];			/* Volume of the file using each sector of the pool (NULL:free) */
+#endif
+
 #if FF_STR_VOLUME_ID
 #ifdef FF_VOLUME_STRS
 static const char* const VolumeStr[FF_VOLUMES] = {FF_VOLUME_STRS};	/* Pre-defined volume ID */
@@ -510,6 +721,9 @@ static const BYTE GUID_MS_Basic[16] = {0xA2,0xA0,0xD0,0xEB,0xE5,0xB9,0x33,0x44,0
 #if FF_LFN_UNICODE < 0 || FF_LFN_UNICODE > 3
 #error Wrong setting of FF_LFN_UNICODE
 #endif
+#if FF_SFN_TAIL < 0 || FF_SFN_TAIL > 2
+#error Wrong setting of FF_SFN_TAIL
+#endif
 static const BYTE LfnOfs[] = {1,3,5,7,9,14,16,18,20,22,24,28,30};	/* FAT: Offset of LFN characters in the directory entry */
 #define MAXDIRB(nc)	((nc + 44U) / 15 * SZDIRE)	/* exFAT: Size of directory entry block scratchpad buffer needed for the name length */
 
@@ -565,6 +779,10 @@ static WCHAR LfnBuf[FF_MAX_LFN + 1];		/* LFN working buffer */
 static WORD CodePage;	/* Current code page */
 static const BYTE *ExCvt, *DbcTbl;	/* Pointer to current SBCS up-case table and DBCS code range table below */
 
+#if FF_USE_CPTBL
+#define FF_CPTBL_FFC	/* Only the code pages in ffcptbl.h are available */
+#include "ffcptbl.h"
+#else
 static const BYTE Ct437[] = TBL_CT437;
 static const BYTE Ct720[] = TBL_CT720;
 static const BYTE Ct737[] = TBL_CT737;
@@ -586,6 +804,7 @@ static const BYTE Dc932[] = TBL_DC932;
 static const BYTE Dc936[] = TBL_DC936;
 static const BYTE Dc949[] = TBL_DC949;
 static const BYTE Dc950[] = TBL_DC950;
+#endif
 
 #elif FF_CODE_PAGE < 900	/* Static code page configuration (SBCS) */
 #define CODEPAGE FF_CODE_PAGE
@@ -1018,148 +1237,640 @@ static void clear_lock (	/* Clear lock entries of the volume */
 
 
 
+#if FF_FS_SNAPSHOT
 /*-----------------------------------------------------------------------*/
-/* Move/Flush disk access window in the filesystem object                */
+/* Discard the mount snapshot before the allocation on the disk changes  */
 /*-----------------------------------------------------------------------*/
-#if !FF_FS_READONLY
-static FRESULT sync_window (	/* Returns FR_OK or FR_DISK_ERR */
-	FATFS* fs			/* Filesystem object */
+
+static void snap_drop (
+	FATFS* fs		/* Filesystem object (a dirty window is to be written) */
 )
 {
-	FRESULT res = FR_OK;
+	if ((fs->snap & 1)								/* Can the disk be in the state of a snapshot? */
+		&& ((fs->fsi_flag & 1)						/* Allocation information has been changed */
+		|| fs->winsect - fs->fatbase < fs->fsize * fs->n_fats	/* or the window is in the FAT */
+#if FF_FS_EXFAT
+		|| (fs->fs_type == FS_EXFAT && fs->winsect - fs->bitbase < (fs->n_fatent - 2 + SS(fs) * 8 - 1) / (SS(fs) * 8))	/* or in the allocation bitmap */
+#endif
+		)) {
+		ff_snap_save(fs->pdrv, 0);	/* Discard the snapshot */
+		fs->snap = (fs->snap & 2) ? 2 : 4;	/* It is saved again on unmount */
+	}
+}
 
+#endif
 
-	if (fs->wflag) {	/* Is the disk access window dirty? */
-		if (disk_write(fs->pdrv, fs->win, fs->winsect, 1) == RES_OK) {	/* Write it back into the volume */
-			fs->wflag = 0;	/* Clear window dirty flag */
-			if (fs->winsect - fs->fatbase < fs->fsize) {	/* Is it in the 1st FAT? */
-				if (fs->n_fats == 2) disk_write(fs->pdrv, fs->win, fs->winsect + fs->fsize, 1);	/* Reflect it to 2nd FAT if needed */
-			}
-		} else {
-			res = FR_DISK_ERR;
-		}
+
+
+#if FF_FS_JOURNAL
+/*-----------------------------------------------------------------------*/
+/* Metadata journal                                                      */
+/*-----------------------------------------------------------------------*/
+/* The metadata sectors flushed from the window (FAT, allocation bitmap,
+/  directory and FSInfo) are collected in the journal buffer in ascending
+/  order of the home location. On the sync, they are written into the journal
+/  area with the header sector in a burst and the sync of the volume makes it
+/  durable. The committed sectors stay in the journal buffer and are written
+/  to the home locations with consecutive sectors merged when the next
+/  transaction begins or the volume is unmounted. The header is cleared at
+/  last. A transaction left in the journal area is replayed at the next mount. */
+
+static DWORD jnl_sum (	/* Returns checksum of the transaction */
+	const BYTE* buf,	/* Header sector and sector images */
+	UINT nb				/* Number of bytes */
+)
+{
+	DWORD sum = 0;
+
+
+	while (nb--) sum = ((sum & 1) ? 0x80000000 : 0) + (sum >> 1) + *buf++;
+	return sum;
+}
+
+
+static UINT jnl_find (	/* Returns index of the first sector image at or after the sector */
+	FATFS* fs,			/* Filesystem object */
+	LBA_t sect			/* Sector to find */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < fs->jnl_n && fs->jnl_sect[i] < sect; i++) ;
+	return i;
+}
+
+
+static UINT jnl_get (	/* Returns number of the sectors taken from the journal buffer */
+	FATFS* fs,			/* Filesystem object */
+	BYTE* buf,			/* Buffer holding the sectors read from the disk */
+	LBA_t sect,			/* Start sector */
+	UINT cnt			/* Number of sectors */
+)
+{
+	UINT i, n = 0;
+
+
+	for (i = jnl_find(fs, sect); i < fs->jnl_n && fs->jnl_sect[i] - sect < cnt; i++, n++) {	/* Overlay the newer images */
+		memcpy(buf + (UINT)(fs->jnl_sect[i] - sect) * SS(fs), fs->jnlbuf + (i + 1) * SS(fs), SS(fs));
 	}
-	return res;
+	return n;
 }
-#endif
 
 
-static FRESULT move_window (	/* Returns FR_OK or FR_DISK_ERR */
-	FATFS* fs,		/* Filesystem object */
-	LBA_t sect		/* Sector LBA to make appearance in the fs->win[] */
+static FRESULT jnl_apply (	/* Write the sector images of the committed transaction to the home locations */
+	FATFS* fs			/* Filesystem object */
 )
 {
-	FRESULT res = FR_OK;
+	UINT i, n;
+	BYTE *img;
+	LBA_t sect;
 
 
-	if (sect != fs->winsect) {	/* Window offset changed? */
-#if !FF_FS_READONLY
-		res = sync_window(fs);		/* Flush the window */
-#endif
-		if (res == FR_OK) {			/* Fill sector window with new data */
-			if (disk_read(fs->pdrv, fs->win, sect, 1) != RES_OK) {
-				sect = (LBA_t)0 - 1;	/* Invalidate window if read data is not valid */
-				res = FR_DISK_ERR;
-			}
-			fs->winsect = sect;
+	if (fs->jnl_cmt == 1 && disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK) return FR_DISK_ERR;	/* The transaction needs to be durable before the home locations are overwritten */
+	for (i = 0; i < fs->jnl_n; i += n) {
+		sect = fs->jnl_sect[i];
+		for (n = 1; i + n < fs->jnl_n && fs->jnl_sect[i + n] == sect + n; n++) ;	/* Merge consecutive sectors */
+		img = fs->jnlbuf + (i + 1) * SS(fs);
+		if (disk_write(fs->pdrv, img, sect, n) != RES_OK) return FR_DISK_ERR;
+#if FF_FAT_MIRROR == 0
+		if (sect - fs->fatbase < fs->fsize && fs->n_fats == 2) {	/* Is it in the 1st FAT of two? */
+			if (n > fs->fatbase + fs->fsize - sect) n = (UINT)(fs->fatbase + fs->fsize - sect);
+			disk_write(fs->pdrv, img, sect + fs->fsize, n);	/* Reflect it to 2nd FAT */
 		}
+#endif
 	}
-	return res;
+	if (disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK) return FR_DISK_ERR;	/* The home locations need to be durable before the journal area is reused */
+	memset(fs->jnlbuf, 0, SS(fs));	/* Clear the header */
+	if (disk_write(fs->pdrv, fs->jnlbuf, fs->jnlbase, 1) != RES_OK) return FR_DISK_ERR;
+	fs->jnl_n = 0; fs->jnl_cmt = 0;
+	return FR_OK;
 }
 
 
+static FRESULT jnl_commit (	/* Write the sectors in the journal buffer into the journal area */
+	FATFS* fs			/* Filesystem object */
+)
+{
+	UINT i, n = fs->jnl_n;
+	BYTE *hdr = fs->jnlbuf;
 
 
-#if !FF_FS_READONLY
-/*-----------------------------------------------------------------------*/
-/* Synchronize filesystem and data on the storage                        */
-/*-----------------------------------------------------------------------*/
+	if (n == 0 || fs->jnl_cmt) return FR_OK;	/* Nothing to commit? */
+	memset(hdr, 0, SS(fs));	/* Create the header sector */
+	st_dword(hdr + JH_Sig, JNL_SIG);
+	st_dword(hdr + JH_VolSN, fs->jnlsn);
+	st_word(hdr + JH_Count, (WORD)n);
+	for (i = 0; i < n; i++) {
+#if FF_LBA64
+		st_qword(hdr + JH_Sect + i * 8, fs->jnl_sect[i]);
+#else
+		st_dword(hdr + JH_Sect + i * 8, fs->jnl_sect[i]);
+#endif
+	}
+	st_dword(hdr + JH_Sum, jnl_sum(hdr, (n + 1) * SS(fs)));
+	if (disk_write(fs->pdrv, hdr, fs->jnlbase, n + 1) != RES_OK) return FR_DISK_ERR;	/* Write the transaction in a burst */
+	fs->jnl_cmt = 1;		/* The transaction is committed (it is durable at the following sync) */
+	return FR_OK;
+}
 
-static FRESULT sync_fs (	/* Returns FR_OK or FR_DISK_ERR */
-	FATFS* fs		/* Filesystem object */
+
+static FRESULT jnl_put (	/* Put a sector into the journal buffer */
+	FATFS* fs,			/* Filesystem object */
+	const BYTE* buf,	/* Sector data */
+	LBA_t sect			/* Home location */
 )
 {
+	UINT i;
 	FRESULT res;
 
 
-	res = sync_window(fs);
-	if (res == FR_OK) {
-		if (fs->fs_type == FS_FAT32 && fs->fsi_flag == 1) {	/* FAT32: Update FSInfo sector if needed */
-			/* Create FSInfo structure */
-			memset(fs->win, 0, sizeof fs->win);
-			st_word(fs->win + BS_55AA, 0xAA55);					/* Boot signature */
-			st_dword(fs->win + FSI_LeadSig, 0x41615252);		/* Leading signature */
-			st_dword(fs->win + FSI_StrucSig, 0x61417272);		/* Structure signature */
-			st_dword(fs->win + FSI_Free_Count, fs->free_clst);	/* Number of free clusters */
-			st_dword(fs->win + FSI_Nxt_Free, fs->last_clst);	/* Last allocated culuster */
-			fs->winsect = fs->volbase + 1;						/* Write it into the FSInfo sector (Next to VBR) */
-			disk_write(fs->pdrv, fs->win, fs->winsect, 1);
-			fs->fsi_flag = 0;
+	if (fs->jnl_cmt) {		/* Begin a new transaction after the committed one is applied */
+		res = jnl_apply(fs);
+		if (res != FR_OK) return res;
+	}
+	i = jnl_find(fs, sect);
+	if (i == fs->jnl_n || fs->jnl_sect[i] != sect) {	/* Not in the journal buffer? */
+		if (fs->jnl_n == FF_JOURNAL_NSECT) {	/* Split the operation into another transaction if the journal buffer is full */
+			res = jnl_commit(fs);
+			if (res == FR_OK) res = jnl_apply(fs);
+			if (res != FR_OK) return res;
+			i = 0;
 		}
-		/* Make sure that no pending write process in the lower layer */
-		if (disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK) res = FR_DISK_ERR;
+		memmove(fs->jnlbuf + (i + 2) * SS(fs), fs->jnlbuf + (i + 1) * SS(fs), (fs->jnl_n - i) * SS(fs));	/* Make a room for the sector */
+		memmove(&fs->jnl_sect[i + 1], &fs->jnl_sect[i], (fs->jnl_n - i) * sizeof (LBA_t));
+		fs->jnl_sect[i] = sect;
+		fs->jnl_n++;
 	}
+	memcpy(fs->jnlbuf + (i + 1) * SS(fs), buf, SS(fs));
+	return FR_OK;
+}
 
-	return res;
+
+static FRESULT meta_write (	/* Write a metadata sector (into the journal buffer if the journal is active) */
+	FATFS* fs,			/* Filesystem object */
+	const BYTE* buf,	/* Sector data */
+	LBA_t sect			/* Sector to write */
+)
+{
+	if (fs->jnlbase) return jnl_put(fs, buf, sect);
+	return (disk_write(fs->pdrv, buf, sect, 1) == RES_OK) ? FR_OK : FR_DISK_ERR;
 }
 
+
+static FRESULT jnl_open (	/* Attach the journal area of the volume and replay the transaction left in it */
+	FATFS* fs,			/* Filesystem object */
+	UINT fmt,			/* FAT sub-type */
+	DWORD vsn,			/* Volume serial number */
+	DSTATUS stat		/* Drive status */
+)
+{
+	UINT i, n;
+	LBA_t sect, vmax;
+	BYTE *hdr = fs->jnlbuf;
+	DWORD sum;
+
+
+	sect = fs->volbase + (fmt == FS_EXFAT ? JNL_OFS_EXFAT : JNL_OFS_FAT);
+	if ((stat & STA_PROTECT) || fs->fatbase < sect + JNL_SIZE) return FR_OK;	/* No journal on write-protected disk or volume without room for it */
+	if (disk_read(fs->pdrv, hdr, sect, 1) != RES_OK) return FR_DISK_ERR;
+	fs->jnlbase = sect; fs->jnlsn = vsn;
+
+	n = ld_word(hdr + JH_Count);
+	if (ld_dword(hdr + JH_Sig) != JNL_SIG || ld_dword(hdr + JH_VolSN) != vsn || n == 0 || n > FF_JOURNAL_NSECT) return FR_OK;	/* No transaction left */
+	if (disk_read(fs->pdrv, hdr + SS(fs), sect + 1, n) != RES_OK) return FR_DISK_ERR;
+	sum = ld_dword(hdr + JH_Sum);
+	st_dword(hdr + JH_Sum, 0);
+	if (jnl_sum(hdr, (n + 1) * SS(fs)) != sum) return FR_OK;	/* Torn transaction is not committed */
+	vmax = fs->database + (LBA_t)fs->csize * (fs->n_fatent - 2);
+	for (i = 0; i < n; i++) {
+#if FF_LBA64
+		fs->jnl_sect[i] = ld_qword(hdr + JH_Sect + i * 8);
+#else
+		fs->jnl_sect[i] = ld_dword(hdr + JH_Sect + i * 8);
 #endif
+		if (fs->jnl_sect[i] <= fs->volbase || fs->jnl_sect[i] >= vmax || (i > 0 && fs->jnl_sect[i] <= fs->jnl_sect[i - 1])) return FR_OK;	/* Broken? */
+	}
+
+	fs->jnl_n = n; fs->jnl_cmt = 2;
+	fs->winsect = (LBA_t)0 - 1;		/* Invalidate window */
+	if (fs->jnl_sect[0] == fs->volbase + 1) {	/* FSInfo is replaced? */
+		fs->last_clst = fs->free_clst = 0xFFFFFFFF;
+	}
+	return jnl_apply(fs);	/* Replay the transaction */
+}
+
+#else
+#define meta_write(fs, buf, sect) (disk_write((fs)->pdrv, buf, sect, 1) == RES_OK ? FR_OK : FR_DISK_ERR)
+#endif	/* FF_FS_JOURNAL */
 
 
 
+#if FF_FAT_MIRROR == 1 && !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* Get physical sector number from cluster number                        */
+/* Deferred FAT mirroring                                                */
 /*-----------------------------------------------------------------------*/
 
-static LBA_t clst2sect (	/* !=0:Sector number, 0:Failed (invalid cluster#) */
+static void mirror_mark (	/* Record a FAT sector to be reflected to the 2nd FAT */
 	FATFS* fs,		/* Filesystem object */
-	DWORD clst		/* Cluster# to be converted */
+	DWORD ofs		/* Sector offset in the FAT */
 )
 {
-	clst -= 2;		/* Cluster number is origin from 2 */
-	if (clst >= fs->n_fatent - 2) return 0;		/* Is it invalid cluster number? */
-	return fs->database + (LBA_t)fs->csize * clst;	/* Start sector number of the cluster */
+	UINT i, n = fs->mir_n;
+
+
+	for (i = 0; i < n && fs->mir_end[i] < ofs; i++) ;	/* Find the range which can contain the sector */
+	if (i == n || ofs + 1 < fs->mir_top[i]) {	/* Not adjoining any range? */
+		if (n < MIR_NRNG) {		/* Insert a new range */
+			memmove(&fs->mir_top[i + 1], &fs->mir_top[i], (n - i) * sizeof (DWORD));
+			memmove(&fs->mir_end[i + 1], &fs->mir_end[i], (n - i) * sizeof (DWORD));
+			fs->mir_top[i] = ofs; fs->mir_end[i] = ofs + 1;
+			fs->mir_n++;
+			return;
+		}
+		if (i == n || (i > 0 && ofs - fs->mir_end[i - 1] < fs->mir_top[i] - ofs)) i--;	/* Table is full. Stretch the nearest range instead. */
+	}
+	if (ofs < fs->mir_top[i]) fs->mir_top[i] = ofs;
+	if (ofs >= fs->mir_end[i]) fs->mir_end[i] = ofs + 1;
+	if (i + 1 < n && fs->mir_end[i] >= fs->mir_top[i + 1]) {	/* Merge it with the next range if they adjoin */
+		fs->mir_end[i] = fs->mir_end[i + 1];
+		memmove(&fs->mir_top[i + 1], &fs->mir_top[i + 2], (n - i - 2) * sizeof (DWORD));
+		memmove(&fs->mir_end[i + 1], &fs->mir_end[i + 2], (n - i - 2) * sizeof (DWORD));
+		fs->mir_n--;
+	}
 }
 
 
+static FRESULT mirror_fat (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs		/* Filesystem object */
+)
+{
+	DWORD ofs;
+	UINT n;
+
+
+	while (fs->mir_n > 0) {	/* Copy the dirty ranges from the 1st FAT to the 2nd FAT in ascending order */
+		for (ofs = fs->mir_top[0]; ofs < fs->mir_end[0]; ofs += n) {
+			n = (fs->mir_end[0] - ofs > FF_MIRROR_BUF) ? FF_MIRROR_BUF : (UINT)(fs->mir_end[0] - ofs);
+			if (disk_read(fs->pdrv, fs->mirbuf, fs->fatbase + ofs, n) != RES_OK) return FR_DISK_ERR;
+#if FF_FS_JOURNAL
+			jnl_get(fs, fs->mirbuf, fs->fatbase + ofs, n);	/* Take the sectors not applied yet */
+#endif
+			if (disk_write(fs->pdrv, fs->mirbuf, fs->fatbase + fs->fsize + ofs, n) != RES_OK) return FR_DISK_ERR;
+			fs->mir_top[0] = ofs + n;	/* Done up to here */
+		}
+		fs->mir_n--;
+		memmove(&fs->mir_top[0], &fs->mir_top[1], fs->mir_n * sizeof (DWORD));
+		memmove(&fs->mir_end[0], &fs->mir_end[1], fs->mir_n * sizeof (DWORD));
+	}
+	return FR_OK;
+}
+
+#endif	/* FF_FAT_MIRROR == 1 && !FF_FS_READONLY */
 
 
+
+#if FF_FAT_RAM
 /*-----------------------------------------------------------------------*/
-/* FAT access - Read value of an FAT entry                               */
+/* Whole FAT in RAM (FAT12/16)                                           */
 /*-----------------------------------------------------------------------*/
 
-static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFFF:Cluster status */
-	FFOBJID* obj,	/* Corresponding object */
-	DWORD clst		/* Cluster number to get the value */
+static FRESULT fat_load (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs,		/* Filesystem object */
+	UINT fmt		/* FAT sub-type */
 )
 {
-	UINT wc, bc;
-	DWORD val;
-	FATFS *fs = obj->fs;
+	UINT n;
 
 
-	if (clst < 2 || clst >= fs->n_fatent) {	/* Check if in valid range */
-		val = 1;	/* Internal error */
+	fs->fr_n = 0;
+#if !FF_FS_READONLY
+	fs->fr_wflag = 0;
+	memset(fs->fr_dirty, 0, sizeof fs->fr_dirty);
+#endif
+	ff_memfree(fs->fatram);	/* Release the buffer of the previous mount */
+	fs->fatram = 0;
+	if (fmt != FS_FAT12 && fmt != FS_FAT16) return FR_OK;
+	n = (fmt == FS_FAT16) ? fs->n_fatent * 2 : fs->n_fatent * 3 / 2 + (fs->n_fatent & 1);	/* Size of the FAT in use [byte] */
+	n = (n + SS(fs) - 1) / SS(fs);
+	if (n > FF_FAT_RAM) return FR_OK;	/* Too large, use the window */
+	fs->fatram = ff_memalloc(n * SS(fs));
+	if (!fs->fatram) return FR_OK;		/* Not enough core, use the window */
+	if (disk_read(fs->pdrv, fs->fatram, fs->fatbase, n) != RES_OK) return FR_DISK_ERR;	/* Load the FAT in a multiple sector read */
+	fs->fr_n = n;
+	return FR_OK;
+}
 
-	} else {
-		val = 0xFFFFFFFF;	/* Default value falls on disk error */
 
-		switch (fs->fs_type) {
-		case FS_FAT12 :
-			bc = (UINT)clst; bc += bc / 2;
-			if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) break;
-			wc = fs->win[bc++ % SS(fs)];		/* Get 1st byte of the entry */
-			if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) break;
-			wc |= fs->win[bc % SS(fs)] << 8;	/* Merge 2nd byte of the entry */
-			val = (clst & 1) ? (wc >> 4) : (wc & 0xFFF);	/* Adjust bit position */
-			break;
+#if !FF_FS_READONLY
+static FRESULT fat_flush (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs		/* Filesystem object */
+)
+{
+	FRESULT res = FR_OK;
+	UINT i, n, k;
+	BYTE *img;
 
-		case FS_FAT16 :
-			if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 2))) != FR_OK) break;
-			val = ld_word(fs->win + clst * 2 % SS(fs));		/* Simple WORD array */
-			break;
 
-		case FS_FAT32 :
+	for (i = 0; i < fs->fr_n && res == FR_OK; i += n) {
+		for (n = 0; i + n < fs->fr_n && (fs->fr_dirty[(i + n) / 8] & (1 << ((i + n) % 8))); n++) ;	/* Get a run of dirty sectors */
+		if (n == 0) {
+			n = 1; continue;
+		}
+#if FF_FS_SNAPSHOT
+		if (fs->snap & 1) {		/* The allocation on the disk changes */
+			ff_snap_save(fs->pdrv, 0);
+			fs->snap = (fs->snap & 2) ? 2 : 4;
+		}
+#endif
+		img = fs->fatram + i * SS(fs);
+#if FF_FS_JOURNAL
+		if (fs->jnlbase) {		/* Put them into the journal buffer (the 2nd FAT is reflected when the transaction is applied) */
+			for (k = 0; k < n && res == FR_OK; k++) {
+				res = jnl_put(fs, img + k * SS(fs), fs->fatbase + i + k);
+			}
+		} else
+#endif
+		{
+			if (disk_write(fs->pdrv, img, fs->fatbase + i, n) != RES_OK) res = FR_DISK_ERR;	/* Write the run in a multiple sector write */
+#if FF_FAT_MIRROR == 0
+			if (res == FR_OK && fs->n_fats == 2) disk_write(fs->pdrv, img, fs->fatbase + fs->fsize + i, n);	/* Reflect it to 2nd FAT */
+#endif
+		}
+#if FF_FAT_MIRROR == 1
+		for (k = 0; k < n && res == FR_OK && fs->n_fats == 2; k++) mirror_mark(fs, i + k);	/* Reflect it to 2nd FAT at sync */
+#endif
+		for (k = i; k < i + n && res == FR_OK; k++) fs->fr_dirty[k / 8] &= (BYTE)~(1 << (k % 8));
+	}
+	if (res == FR_OK) fs->fr_wflag = 0;
+	return res;
+}
+#endif	/* !FF_FS_READONLY */
+
+#endif	/* FF_FAT_RAM */
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Move/Flush disk access window in the filesystem object                */
+/*-----------------------------------------------------------------------*/
+#if !FF_FS_READONLY
+static FRESULT sync_window (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs			/* Filesystem object */
+)
+{
+	FRESULT res = FR_OK;
+
+
+	if (fs->wflag) {	/* Is the disk access window dirty? */
+#if FF_FAT_RAM
+		if (fs->fr_wflag && fat_flush(fs) != FR_OK) return FR_DISK_ERR;	/* The FAT in RAM goes to the disk ahead of the other metadata */
+#endif
+#if FF_FS_SNAPSHOT
+		snap_drop(fs);
+#endif
+		if (meta_write(fs, fs->win, fs->winsect) == FR_OK) {	/* Write it back into the volume */
+			fs->wflag = 0;	/* Clear window dirty flag */
+#if FF_DIR_SCAN != 0
+			if (fs->winsect - fs->dstop < fs->dscnt) {	/* Reflect it to the directory scan buffer if exist */
+				memcpy(fs->dsbuf + (UINT)(fs->winsect - fs->dstop) * SS(fs), fs->win, SS(fs));
+			}
+#endif
+			if (fs->winsect - fs->fatbase < fs->fsize && fs->n_fats == 2) {	/* Is it in the 1st FAT of two? */
+#if FF_FAT_MIRROR == 0
+#if FF_FS_JOURNAL
+				if (!fs->jnlbase)	/* (The journal reflects it when the transaction is applied) */
+#endif
+				disk_write(fs->pdrv, fs->win, fs->winsect + fs->fsize, 1);	/* Reflect it to 2nd FAT */
+#elif FF_FAT_MIRROR == 1
+				mirror_mark(fs, (DWORD)(fs->winsect - fs->fatbase));	/* Reflect it to 2nd FAT at sync */
+#endif
+			}
+		} else {
+			res = FR_DISK_ERR;
+		}
+	}
+	return res;
+}
+#endif
+
+
+static FRESULT move_window (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs,		/* Filesystem object */
+	LBA_t sect		/* Sector LBA to make appearance in the fs->win[] */
+)
+{
+	FRESULT res = FR_OK;
+
+
+	if (sect != fs->winsect) {	/* Window offset changed? */
+#if !FF_FS_READONLY
+		res = sync_window(fs);		/* Flush the window */
+#endif
+		if (res == FR_OK) {			/* Fill sector window with new data */
+#if FF_FS_JOURNAL
+			if (jnl_get(fs, fs->win, sect, 1)) {	/* Take it from the journal buffer if it is there */
+				fs->winsect = sect;
+				return FR_OK;
+			}
+#endif
+			if (disk_read(fs->pdrv, fs->win, sect, 1) != RES_OK) {
+				sect = (LBA_t)0 - 1;	/* Invalidate window if read data is not valid */
+				res = FR_DISK_ERR;
+			}
+			fs->winsect = sect;
+		}
+	}
+	return res;
+}
+
+
+
+#if FF_FAT_RAM && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Mark the FAT sectors in RAM dirty prior to change an entry            */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT fat_mark (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs,		/* Filesystem object */
+	UINT ofs,		/* Byte offset of the FAT entry in fatram[] */
+	UINT len		/* Size of the FAT entry [byte] */
+)
+{
+	UINT i;
+
+
+	if (sync_window(fs) != FR_OK) return FR_DISK_ERR;	/* Write back the window first to keep the metadata written in order of the changes */
+	for (i = ofs / SS(fs); i <= (ofs + len - 1) / SS(fs); i++) {
+		fs->fr_dirty[i / 8] |= (BYTE)(1 << (i % 8));
+	}
+	fs->fr_wflag = 1;
+	return FR_OK;
+}
+#endif
+
+
+
+#if FF_DIR_SCAN != 0
+/*-----------------------------------------------------------------------*/
+/* Move disk access window to a directory sector via the scan buffer     */
+/*-----------------------------------------------------------------------*/
+
+#define MOVE_DIRWIN(fs, dp) move_dirwin(fs, dp)
+
+static FRESULT move_dirwin (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs,		/* Filesystem object */
+	DIR* dp			/* Directory object pointing the sector to be loaded */
+)
+{
+	LBA_t sect = dp->sect;
+	UINT n;
+
+
+	if (sect == fs->winsect) return FR_OK;	/* Already in the window */
+#if !FF_FS_READONLY
+	if (sync_window(fs) != FR_OK) return FR_DISK_ERR;	/* Flush the window */
+#endif
+	if (sect - fs->dstop >= fs->dscnt) {	/* Not in the scan buffer? Load the following sectors of the directory */
+		if (dp->clust) {	/* Sectors remaining in the cluster */
+			n = fs->csize - (UINT)((sect - fs->database) % fs->csize);
+		} else {			/* Sectors remaining in the root directory (FAT12/16) */
+			n = (UINT)(fs->dirbase + fs->n_rootdir / (SS(fs) / SZDIRE) - sect);
+		}
+		if (n > FF_DIR_SCAN) n = FF_DIR_SCAN;
+		fs->dscnt = 0;
+		if (disk_read(fs->pdrv, fs->dsbuf, sect, n) != RES_OK) return FR_DISK_ERR;
+#if FF_FS_JOURNAL
+		jnl_get(fs, fs->dsbuf, sect, n);	/* Take the sectors in the journal buffer */
+#endif
+		fs->dstop = sect; fs->dscnt = n;
+	}
+	memcpy(fs->win, fs->dsbuf + (UINT)(sect - fs->dstop) * SS(fs), SS(fs));	/* Take the sector from the scan buffer */
+	fs->winsect = sect;
+	return FR_OK;
+}
+#else
+#define MOVE_DIRWIN(fs, dp) move_window(fs, (dp)->sect)
+#endif
+
+
+
+
+#if !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Synchronize filesystem and data on the storage                        */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT sync_fs (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs		/* Filesystem object */
+)
+{
+	FRESULT res;
+
+
+	res = sync_window(fs);
+#if FF_FAT_RAM
+	if (res == FR_OK && fs->fr_wflag) res = fat_flush(fs);	/* Write back the dirty FAT sectors in RAM */
+#endif
+	if (res == FR_OK && fs->fs_type == FS_FAT32 && fs->fsi_flag == 1) {	/* FAT32: Update FSInfo sector if needed */
+		/* Create FSInfo structure */
+		memset(fs->win, 0, sizeof fs->win);
+		st_word(fs->win + BS_55AA, 0xAA55);					/* Boot signature */
+		st_dword(fs->win + FSI_LeadSig, 0x41615252);		/* Leading signature */
+		st_dword(fs->win + FSI_StrucSig, 0x61417272);		/* Structure signature */
+		st_dword(fs->win + FSI_Free_Count, fs->free_clst);	/* Number of free clusters */
+		st_dword(fs->win + FSI_Nxt_Free, fs->last_clst);	/* Last allocated culuster */
+		fs->winsect = fs->volbase + 1;						/* Write it into the FSInfo sector (Next to VBR) */
+		res = meta_write(fs, fs->win, fs->winsect);
+		fs->fsi_flag = 0;
+	}
+#if FF_FS_JOURNAL
+	if (res == FR_OK) res = jnl_commit(fs);	/* Commit the metadata transaction */
+#endif
+#if FF_FAT_MIRROR == 1
+	if (res == FR_OK) res = mirror_fat(fs);	/* Reflect changes of the 1st FAT to the 2nd FAT */
+#endif
+	if (res == FR_OK) {
+		/* Make sure that no pending write process in the lower layer */
+		if (disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK) res = FR_DISK_ERR;
+#if FF_FS_JOURNAL
+		if (res == FR_OK && fs->jnl_cmt) fs->jnl_cmt = 2;	/* The committed transaction is durable */
+#endif
+	}
+
+	return res;
+}
+
+#endif
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Get physical sector number from cluster number                        */
+/*-----------------------------------------------------------------------*/
+
+static LBA_t clst2sect (	/* !=0:Sector number, 0:Failed (invalid cluster#) */
+	FATFS* fs,		/* Filesystem object */
+	DWORD clst		/* Cluster# to be converted */
+)
+{
+	clst -= 2;		/* Cluster number is origin from 2 */
+	if (clst >= fs->n_fatent - 2) return 0;		/* Is it invalid cluster number? */
+	return fs->database + (LBA_t)fs->csize * clst;	/* Start sector number of the cluster */
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* FAT access - Read value of an FAT entry                               */
+/*-----------------------------------------------------------------------*/
+
+static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFFF:Cluster status */
+	FFOBJID* obj,	/* Corresponding object */
+	DWORD clst		/* Cluster number to get the value */
+)
+{
+	UINT wc, bc;
+	DWORD val;
+	FATFS *fs = obj->fs;
+
+
+	if (clst < 2 || clst >= fs->n_fatent) {	/* Check if in valid range */
+		val = 1;	/* Internal error */
+
+	} else {
+		val = 0xFFFFFFFF;	/* Default value falls on disk error */
+
+		switch (fs->fs_type) {
+		case FS_FAT12 :
+			bc = (UINT)clst; bc += bc / 2;
+#if FF_FAT_RAM
+			if (fs->fr_n) {		/* FAT in RAM */
+				wc = ld_word(fs->fatram + bc);
+				val = (clst & 1) ? (wc >> 4) : (wc & 0xFFF);
+				break;
+			}
+#endif
+			if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) break;
+			wc = fs->win[bc++ % SS(fs)];		/* Get 1st byte of the entry */
+			if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) break;
+			wc |= fs->win[bc % SS(fs)] << 8;	/* Merge 2nd byte of the entry */
+			val = (clst & 1) ? (wc >> 4) : (wc & 0xFFF);	/* Adjust bit position */
+			break;
+
+		case FS_FAT16 :
+#if FF_FAT_RAM
+			if (fs->fr_n) {		/* FAT in RAM */
+				val = ld_word(fs->fatram + clst * 2);
+				break;
+			}
+#endif
+			if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 2))) != FR_OK) break;
+			val = ld_word(fs->win + clst * 2 % SS(fs));		/* Simple WORD array */
+			break;
+
+		case FS_FAT32 :
 			if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 4))) != FR_OK) break;
 			val = ld_dword(fs->win + clst * 4 % SS(fs)) & 0x0FFFFFFF;	/* Simple DWORD array but mask out upper 4 bits */
 			break;
@@ -1221,6 +1932,16 @@ static FRESULT put_fat (	/* FR_OK(0):succeeded, !=0:error */
 		switch (fs->fs_type) {
 		case FS_FAT12:
 			bc = (UINT)clst; bc += bc / 2;	/* bc: byte offset of the entry */
+#if FF_FAT_RAM
+			if (fs->fr_n) {		/* FAT in RAM */
+				res = fat_mark(fs, bc, 2);
+				if (res != FR_OK) break;
+				p = fs->fatram + bc;
+				p[0] = (clst & 1) ? ((p[0] & 0x0F) | ((BYTE)val << 4)) : (BYTE)val;
+				p[1] = (clst & 1) ? (BYTE)(val >> 4) : ((p[1] & 0xF0) | ((BYTE)(val >> 8) & 0x0F));
+				break;
+			}
+#endif
 			res = move_window(fs, fs->fatbase + (bc / SS(fs)));
 			if (res != FR_OK) break;
 			p = fs->win + bc++ % SS(fs);
@@ -1234,6 +1955,14 @@ static FRESULT put_fat (	/* FR_OK(0):succeeded, !=0:error */
 			break;
 
 		case FS_FAT16:
+#if FF_FAT_RAM
+			if (fs->fr_n) {		/* FAT in RAM */
+				res = fat_mark(fs, clst * 2, 2);
+				if (res != FR_OK) break;
+				st_word(fs->fatram + clst * 2, (WORD)val);
+				break;
+			}
+#endif
 			res = move_window(fs, fs->fatbase + (clst / (SS(fs) / 2)));
 			if (res != FR_OK) break;
 			st_word(fs->win + clst * 2 % SS(fs), (WORD)val);	/* Simple WORD array */
@@ -1257,59 +1986,207 @@ static FRESULT put_fat (	/* FR_OK(0):succeeded, !=0:error */
 	return res;
 }
 
-#endif /* !FF_FS_READONLY */
-
 
 
 
-#if FF_FS_EXFAT && !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* exFAT: Accessing FAT and Allocation Bitmap                            */
+/* FAT access - Get and free an FAT16/32 entry in a window access        */
 /*-----------------------------------------------------------------------*/
 
-/*--------------------------------------*/
-/* Find a contiguous free cluster block */
-/*--------------------------------------*/
-
-static DWORD find_bitmap (	/* 0:Not found, 2..:Cluster block found, 0xFFFFFFFF:Disk error */
-	FATFS* fs,	/* Filesystem object */
-	DWORD clst,	/* Cluster number to scan from */
-	DWORD ncl	/* Number of contiguous clusters to find (1..) */
+static DWORD take_fat (	/* 0xFFFFFFFF:Disk error, 0..0x0FFFFFFF:Value of the entry before it is freed */
+	FATFS* fs,		/* Filesystem object (FAT16 or FAT32) */
+	DWORD clst		/* FAT index number (2..n_fatent-1) */
 )
 {
-	BYTE bm, bv;
-	UINT i;
-	DWORD val, scl, ctr;
+	BYTE *p;
+	DWORD val;
 
 
-	clst -= 2;	/* The first bit in the bitmap corresponds to cluster #2 */
-	if (clst >= fs->n_fatent - 2) clst = 0;
-	scl = val = clst; ctr = 0;
-	for (;;) {
-		if (move_window(fs, fs->bitbase + val / 8 / SS(fs)) != FR_OK) return 0xFFFFFFFF;
-		i = val / 8 % SS(fs); bm = 1 << (val % 8);
-		do {
-			do {
-				bv = fs->win[i] & bm; bm <<= 1;		/* Get bit value */
-				if (++val >= fs->n_fatent - 2) {	/* Next cluster (with wrap-around) */
-					val = 0; bm = 0; i = SS(fs);
-				}
-				if (bv == 0) {	/* Is it a free cluster? */
-					if (++ctr == ncl) return scl + 2;	/* Check if run length is sufficient for required */
-				} else {
-					scl = val; ctr = 0;		/* Encountered a cluster in-use, restart to scan */
-				}
-				if (val == clst) return 0;	/* All cluster scanned? */
-			} while (bm != 0);
-			bm = 1;
-		} while (++i < SS(fs));
+	if (fs->fs_type == FS_FAT32) {
+		if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 4))) != FR_OK) return 0xFFFFFFFF;
+		p = fs->win + clst * 4 % SS(fs);
+		val = ld_dword(p) & 0x0FFFFFFF;
+		if (val >= 2) {		/* Mark it 'free' if it is in use (the upper 4 bits are preserved) */
+			st_dword(p, ld_dword(p) & 0xF0000000);
+			fs->wflag = 1;
+		}
+	} else {
+#if FF_FAT_RAM
+		if (fs->fr_n) {		/* FAT in RAM */
+			p = fs->fatram + clst * 2;
+			val = ld_word(p);
+			if (val >= 2) {
+				if (fat_mark(fs, clst * 2, 2) != FR_OK) return 0xFFFFFFFF;
+				st_word(p, 0);
+			}
+			return val;
+		}
+#endif
+		if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 2))) != FR_OK) return 0xFFFFFFFF;
+		p = fs->win + clst * 2 % SS(fs);
+		val = ld_word(p);
+		if (val >= 2) {		/* Mark it 'free' if it is in use */
+			st_word(p, 0);
+			fs->wflag = 1;
+		}
+	}
+	return val;
+}
+
+#endif /* !FF_FS_READONLY */
+
+
+
+
+#if FF_USE_STREAM != 0
+/*-----------------------------------------------------------------------*/
+/* Streaming: Check if the cluster is reserved by a streaming file       */
+/*-----------------------------------------------------------------------*/
+
+static int strm_busy (	/* 0:Not reserved, 1:Reserved */
+	FATFS* fs,		/* Filesystem object */
+	DWORD clst		/* Cluster# to be checked */
+)
+{
+	UINT i;
+	FIL *fp;
+
+
+	for (i = 0; i < FF_USE_STREAM; i++) {
+		fp = StrmFiles[i];
+		if (fp && fp->obj.fs == fs && IN_STRM_BLK(fp, clst)) return 1;
+	}
+	return 0;
+}
+
+#endif	/* FF_USE_STREAM != 0 */
+
+
+
+
+#if FF_ALLOC_WIN != 0
+/*-----------------------------------------------------------------------*/
+/* Extent allocator: Check if the cluster is claimed by a window         */
+/*-----------------------------------------------------------------------*/
+
+static int alc_busy (	/* 0:Not claimed, 1:Claimed */
+	FATFS* fs,			/* Filesystem object */
+	const ALCWIN* wp,	/* Window not to be checked (null:check all windows) */
+	DWORD clst			/* Cluster# to be checked */
+)
+{
+	UINT i;
+	const ALCWIN *cp;
+
+
+	for (i = 0; i < FF_ALLOC_WIN; i++) {
+		cp = &AlcWin[i];
+		if (cp != wp && cp->fs == fs && cp->id == fs->id && clst >= cp->top && clst < cp->end) return 1;
+	}
+	return 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Extent allocator: Release the claims of all windows on the volume     */
+/*-----------------------------------------------------------------------*/
+
+static int alc_drop (	/* 0:No claim, 1:Released */
+	FATFS* fs			/* Filesystem object */
+)
+{
+	UINT i;
+	int rel = 0;
+
+
+	for (i = 0; i < FF_ALLOC_WIN; i++) {
+		if (AlcWin[i].fs == fs && AlcWin[i].top < AlcWin[i].end) {
+			AlcWin[i].top = AlcWin[i].end = 0;	/* The file places a new window at next allocation */
+			rel = 1;
+		}
+	}
+	return rel;
+}
+
+#endif	/* FF_ALLOC_WIN != 0 */
+
+
+
+
+#if FF_FS_EXFAT && (FF_USE_FRAGSTAT || FF_ALLOC_WIN != 0 || FF_USE_DEFRAG)
+/*-----------------------------------------------------------------------*/
+/* exFAT: Get a bit of the allocation bitmap                             */
+/*-----------------------------------------------------------------------*/
+
+static DWORD test_bitmap (	/* 0:Free, 1:In use, 0xFFFFFFFF:Disk error */
+	FATFS* fs,	/* Filesystem object */
+	DWORD clst	/* Cluster number to be checked */
+)
+{
+	clst -= 2;	/* The first bit in the bitmap corresponds to cluster #2 */
+	if (move_window(fs, fs->bitbase + clst / 8 / SS(fs)) != FR_OK) return 0xFFFFFFFF;
+	return fs->win[clst / 8 % SS(fs)] >> (clst % 8) & 1;
+}
+
+#endif
+
+
+
+
+#if FF_FS_EXFAT && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* exFAT: Accessing FAT and Allocation Bitmap                            */
+/*-----------------------------------------------------------------------*/
+
+/*--------------------------------------*/
+/* Find a contiguous free cluster block */
+/*--------------------------------------*/
+
+static DWORD find_bitmap (	/* 0:Not found, 2..:Cluster block found, 0xFFFFFFFF:Disk error */
+	FATFS* fs,	/* Filesystem object */
+	DWORD clst,	/* Cluster number to scan from */
+	DWORD ncl	/* Number of contiguous clusters to find (1..) */
+)
+{
+	BYTE bm, bv;
+	UINT i;
+	DWORD val, scl, ctr;
+
+
+	clst -= 2;	/* The first bit in the bitmap corresponds to cluster #2 */
+	if (clst >= fs->n_fatent - 2) clst = 0;
+	scl = val = clst; ctr = 0;
+	for (;;) {
+		if (move_window(fs, fs->bitbase + val / 8 / SS(fs)) != FR_OK) return 0xFFFFFFFF;
+		i = val / 8 % SS(fs); bm = 1 << (val % 8);
+		do {
+			do {
+				bv = fs->win[i] & bm; bm <<= 1;		/* Get bit value */
+#if FF_USE_STREAM != 0
+				if (bv == 0 && strm_busy(fs, val + 2)) bv = 1;	/* Reserved by a streaming file? */
+#endif
+#if FF_ALLOC_WIN != 0
+				if (bv == 0 && alc_busy(fs, 0, val + 2)) bv = 1;	/* Claimed by an allocation window? */
+#endif
+				if (++val >= fs->n_fatent - 2) {	/* Next cluster (with wrap-around) */
+					val = 0; bm = 0; i = SS(fs);
+				}
+				if (bv == 0) {	/* Is it a free cluster? */
+					if (++ctr == ncl) return scl + 2;	/* Check if run length is sufficient for required */
+				} else {
+					scl = val; ctr = 0;		/* Encountered a cluster in-use, restart to scan */
+				}
+				if (val == clst) return 0;	/* All cluster scanned? */
+			} while (bm != 0);
+			bm = 1;
+		} while (++i < SS(fs));
 	}
 }
 
 
 /*----------------------------------------*/
-/* Set/Clear a block of allocation bitmap */
-/*----------------------------------------*/
+/* Set/Clear a block of allocation bitmap */
+/*----------------------------------------*/
 
 static FRESULT change_bitmap (
 	FATFS* fs,	/* Filesystem object */
@@ -1330,6 +2207,13 @@ static FRESULT change_bitmap (
 	for (;;) {
 		if (move_window(fs, sect++) != FR_OK) return FR_DISK_ERR;
 		do {
+			if (bm == 1 && ncl >= 8) {	/* Change a whole byte at a time */
+				if (fs->win[i] != (bv ? 0x00 : 0xFF)) return FR_INT_ERR;	/* Are the bits expected value? */
+				fs->win[i] = bv ? 0xFF : 0x00;
+				fs->wflag = 1;
+				if ((ncl -= 8) == 0) return FR_OK;	/* All bits processed? */
+				continue;
+			}
 			do {
 				if (bv == (int)((fs->win[i] & bm) != 0)) return FR_INT_ERR;	/* Is the bit expected value? */
 				fs->win[i] ^= bm;	/* Flip the bit */
@@ -1396,6 +2280,42 @@ static FRESULT fill_last_frag (
 /* FAT handling - Remove a cluster chain                                 */
 /*-----------------------------------------------------------------------*/
 
+#if FF_FS_EXFAT || FF_USE_TRIM
+#define FREE_NRUN	8	/* Number of cluster blocks to be collected before processing them */
+
+static FRESULT free_runs (	/* Mark the cluster blocks 'free' on the bitmap and inform the storage device */
+	FATFS* fs,			/* Filesystem object */
+	const DWORD* top,	/* First cluster of each block */
+	const DWORD* end,	/* Last cluster of each block */
+	UINT n				/* Number of blocks */
+)
+{
+	UINT i;
+#if FF_FS_EXFAT
+	FRESULT res;
+#endif
+#if FF_USE_TRIM
+	LBA_t rt[2];
+#endif
+
+
+	for (i = 0; i < n; i++) {	/* The bitmap is changed after following the FAT, not in turn with it */
+#if FF_FS_EXFAT
+		if (fs->fs_type == FS_EXFAT) {
+			res = change_bitmap(fs, top[i], end[i] - top[i] + 1, 0);	/* Mark the cluster block 'free' on the bitmap */
+			if (res != FR_OK) return res;
+		}
+#endif
+#if FF_USE_TRIM
+		rt[0] = clst2sect(fs, top[i]);					/* Start of data area to be freed */
+		rt[1] = clst2sect(fs, end[i]) + fs->csize - 1;	/* End of data area to be freed */
+		disk_ioctl(fs->pdrv, CTRL_TRIM, rt);			/* Inform storage device that the data in the block may be erased */
+#endif
+	}
+	return FR_OK;
+}
+#endif
+
 static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 	FFOBJID* obj,		/* Corresponding object */
 	DWORD clst,			/* Cluster to remove a chain from */
@@ -1407,9 +2327,8 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 	FATFS *fs = obj->fs;
 #if FF_FS_EXFAT || FF_USE_TRIM
 	DWORD scl = clst, ecl = clst;
-#endif
-#if FF_USE_TRIM
-	LBA_t rt[2];
+	DWORD rtop[FREE_NRUN], rend[FREE_NRUN];
+	UINT nr = 0;
 #endif
 
 	if (clst < 2 || clst >= fs->n_fatent) return FR_INT_ERR;	/* Check if in valid range */
@@ -1420,40 +2339,61 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 		if (res != FR_OK) return res;
 	}
 
+#if FF_ALLOC_WIN != 0
+	fs->alc_fail = 0;		/* Freed clusters can make a larger free extent */
+#endif
+
 	/* Remove the chain */
-	do {
-		nxt = get_fat(obj, clst);			/* Get cluster status */
-		if (nxt == 0) break;				/* Empty cluster? */
-		if (nxt == 1) return FR_INT_ERR;	/* Internal error? */
-		if (nxt == 0xFFFFFFFF) return FR_DISK_ERR;	/* Disk error? */
-		if (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) {
-			res = put_fat(fs, clst, 0);		/* Mark the cluster 'free' on the FAT */
-			if (res != FR_OK) return res;
-		}
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT && obj->stat == 2 && obj->objsize != 0) {	/* Contiguous chain without FAT: free the block at a time */
+		ecl = obj->sclust + (DWORD)((obj->objsize - 1) / SS(fs) / fs->csize);	/* Last cluster of the chain */
+		if (clst < obj->sclust || clst > ecl || ecl >= fs->n_fatent) return FR_INT_ERR;
 		if (fs->free_clst < fs->n_fatent - 2) {	/* Update FSINFO */
-			fs->free_clst++;
+			fs->free_clst += ecl - clst + 1;
+			if (fs->free_clst > fs->n_fatent - 2) fs->free_clst = fs->n_fatent - 2;
 			fs->fsi_flag |= 1;
 		}
-#if FF_FS_EXFAT || FF_USE_TRIM
-		if (ecl + 1 == nxt) {	/* Is next cluster contiguous? */
-			ecl = nxt;
-		} else {				/* End of contiguous cluster block */
-#if FF_FS_EXFAT
-			if (fs->fs_type == FS_EXFAT) {
-				res = change_bitmap(fs, scl, ecl - scl + 1, 0);	/* Mark the cluster block 'free' on the bitmap */
+		rtop[0] = clst; rend[0] = ecl; nr = 1;
+	} else
+#endif
+	{
+		do {
+			if (fs->fs_type == FS_FAT16 || fs->fs_type == FS_FAT32) {
+				nxt = take_fat(fs, clst);		/* Get cluster status and mark the cluster 'free' on the FAT */
+			} else {
+				nxt = get_fat(obj, clst);		/* Get cluster status */
+			}
+			if (nxt == 0) break;				/* Empty cluster? */
+			if (nxt == 1) return FR_INT_ERR;	/* Internal error? */
+			if (nxt == 0xFFFFFFFF) return FR_DISK_ERR;	/* Disk error? */
+			if (fs->fs_type == FS_FAT12) {
+				res = put_fat(fs, clst, 0);		/* Mark the cluster 'free' on the FAT */
 				if (res != FR_OK) return res;
 			}
+			if (fs->free_clst < fs->n_fatent - 2) {	/* Update FSINFO */
+				fs->free_clst++;
+				fs->fsi_flag |= 1;
+			}
+#if FF_FS_EXFAT || FF_USE_TRIM
+			if (ecl + 1 == nxt) {	/* Is next cluster contiguous? */
+				ecl = nxt;
+			} else {				/* End of contiguous cluster block */
+				rtop[nr] = scl; rend[nr] = ecl;
+				if (++nr == FREE_NRUN) {	/* Process the blocks when the list is full */
+					res = free_runs(fs, rtop, rend, nr);
+					if (res != FR_OK) return res;
+					nr = 0;
+				}
+				scl = ecl = nxt;
+			}
 #endif
-#if FF_USE_TRIM
-			rt[0] = clst2sect(fs, scl);					/* Start of data area to be freed */
-			rt[1] = clst2sect(fs, ecl) + fs->csize - 1;	/* End of data area to be freed */
-			disk_ioctl(fs->pdrv, CTRL_TRIM, rt);		/* Inform storage device that the data in the block may be erased */
-#endif
-			scl = ecl = nxt;
-		}
+			clst = nxt;					/* Next cluster */
+		} while (clst < fs->n_fatent);	/* Repeat while not the last link */
+	}
+#if FF_FS_EXFAT || FF_USE_TRIM
+	res = free_runs(fs, rtop, rend, nr);	/* Process the remaining blocks */
+	if (res != FR_OK) return res;
 #endif
-		clst = nxt;					/* Next cluster */
-	} while (clst < fs->n_fatent);	/* Repeat while not the last link */
 
 #if FF_FS_EXFAT
 	/* Some post processes for chain status */
@@ -1487,6 +2427,189 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 
 
 
+#if FF_ALLOC_WIN != 0
+/*-----------------------------------------------------------------------*/
+/* Extent allocator: Allocation window handling                          */
+/*-----------------------------------------------------------------------*/
+
+/* A file with an allocation window stretches its chain with the clusters of
+/  the window in order. The window is claimed only in memory. Other windows
+/  and allocations without window skip the claimed clusters, but the claims
+/  are released when no other free cluster is left. The window of an open
+/  file is never taken over. A file which could not get an entry allocates
+/  without window and gets an entry on f_write() when an entry is released. */
+
+/*-------------------------------------*/
+/* Find or register the window         */
+/*-------------------------------------*/
+
+static ALCWIN* alc_get (	/* Pointer to the window entry (null:not registered) */
+	const FFOBJID* obj,	/* Owner file */
+	int reg				/* 0:Find only, 1:Register the file if not registered, 2:Register the file anew */
+)
+{
+	UINT i;
+	ALCWIN *wp, *lp = 0;
+
+
+	for (i = 0; i < FF_ALLOC_WIN; i++) {
+		wp = &AlcWin[i];
+		if (wp->fs && wp->obj == obj && wp->fs == obj->fs && wp->id == obj->id) {	/* Registered? */
+			if (reg < 2) return wp;
+			lp = wp; break;
+		}
+		if (!lp && (!wp->fs || wp->id != wp->fs->id)) lp = wp;	/* Blank entry or left by the previous mount */
+	}
+	if (!reg || !lp) return 0;	/* Not registered or no entry to be used */
+	memset(lp, 0, sizeof (ALCWIN));	/* Take over the entry */
+	lp->fs = obj->fs; lp->obj = obj; lp->id = obj->id;
+	lp->grow = 1;
+	return lp;
+}
+
+
+/*-------------------------------------*/
+/* Get status of a cluster             */
+/*-------------------------------------*/
+
+static DWORD alc_stat (	/* 0:Free, 1:Internal error, 0xFFFFFFFF:Disk error, Else:In use or claimed */
+	FFOBJID* obj,		/* Owner file */
+	const ALCWIN* wp,	/* Window of the file */
+	DWORD clst			/* Cluster# to be checked */
+)
+{
+	DWORD cs;
+	FATFS *fs = obj->fs;
+
+
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* Get the bit in the allocation bitmap */
+		cs = test_bitmap(fs, clst);
+		if (cs == 1) cs = 2;
+	} else
+#endif
+	{
+		cs = get_fat(obj, clst);
+	}
+#if FF_USE_STREAM != 0
+	if (cs == 0 && strm_busy(fs, clst)) cs = 2;	/* Reserved by a streaming file? */
+#endif
+	if (cs == 0 && alc_busy(fs, wp, clst)) cs = 2;	/* Claimed by another window? */
+	return cs;
+}
+
+
+/*-------------------------------------*/
+/* Place a new window                  */
+/*-------------------------------------*/
+
+static DWORD alc_place (	/* 0:No window, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Top of the window */
+	FFOBJID* obj,		/* Owner file */
+	ALCWIN* wp,			/* Window of the file */
+	DWORD clst			/* Last cluster of the chain (0:new chain) */
+)
+{
+	DWORD want, ncl, stcl, cs, run, rtop, btop, bsz, ltop, lsz, ipsz, scan;
+	FATFS *fs = obj->fs;
+
+
+	if (wp->decl) {		/* Rest of the declared size */
+		want = wp->decl;
+	} else {			/* Erase block size at least, grows as the file goes on */
+		want = fs->blk_size / fs->csize;
+		if (want < ALC_MINWIN) want = ALC_MINWIN;
+		want *= wp->grow;
+	}
+	if (fs->free_clst <= fs->n_fatent - 2 && want > fs->free_clst) want = fs->free_clst;	/* Clip at the free space */
+	if (want == 0) return 0;
+	btop = bsz = ltop = lsz = ipsz = 0;
+
+	if (clst != 0) {	/* Check if the chain can be stretched in place */
+		for ( ; ipsz < want && ipsz < ALC_SCAN && clst + 1 + ipsz < fs->n_fatent; ipsz++) {
+			cs = alc_stat(obj, wp, clst + 1 + ipsz);
+			if (cs == 1 || cs == 0xFFFFFFFF) return cs;
+			if (cs != 0) break;
+		}
+		if (ipsz == want || ipsz == ALC_SCAN) {	/* Enough, or as long as a search can find */
+			btop = clst + 1; bsz = ipsz;
+		}
+	}
+	if (bsz == 0 && (fs->alc_fail == 0 || want < fs->alc_fail || fs->last_clst - fs->alc_fpos >= ALC_SCAN)) {	/* Find a free extent in ALC_SCAN clusters from the last allocation (first-fit, or best-fit for the declared size) */
+		stcl = fs->last_clst + 1;
+		if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+		ncl = stcl; run = rtop = 0; scan = ALC_SCAN;
+		do {
+			cs = alc_stat(obj, wp, ncl);
+			if (cs == 1 || cs == 0xFFFFFFFF) return cs;
+			if (cs == 0 && run++ == 0) rtop = ncl;	/* Free cluster, stretch the run */
+			if (++ncl >= fs->n_fatent) ncl = 2;		/* Next cluster (a run cannot wrap around) */
+			scan--;
+			if (run > 0 && (cs != 0 || ncl == 2 || ncl == stcl || scan == 0 || (!wp->decl && run == want))) {	/* End of the run? */
+				if (run >= want && (bsz == 0 || run < bsz)) {	/* Smallest run to hold the window */
+					btop = rtop; bsz = run;
+				}
+				if (run > lsz) {	/* Largest run */
+					ltop = rtop; lsz = run;
+				}
+				if (bsz == want) break;	/* Just fits */
+				run = 0;
+			}
+		} while (ncl != stcl && scan > 0);
+		if (bsz == 0) {		/* Do not search this size until any cluster is freed or the allocation goes out of the checked range */
+			fs->alc_fail = want; fs->alc_fpos = fs->last_clst;
+		}
+	}
+	if (bsz == 0) {		/* No extent to hold the window, take the largest one */
+		if (ipsz > 0) {		/* Stretch in place as far as possible */
+			btop = clst + 1; bsz = ipsz;
+		} else {
+			btop = ltop; bsz = lsz;
+		}
+		if (bsz == 0) return 0;
+	} else {
+		if (bsz > want) bsz = want;
+		if (clst != 0 && !wp->decl && wp->grow < ALC_GROW) wp->grow *= 2;	/* The file goes on, next window will be larger */
+	}
+	wp->top = btop;
+	wp->end = btop + bsz;
+	return btop;
+}
+
+
+/*-------------------------------------*/
+/* Get next cluster in the window      */
+/*-------------------------------------*/
+
+static DWORD alc_next (	/* 0:No window, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Cluster to be allocated */
+	FFOBJID* obj,		/* Object to be stretched */
+	DWORD clst			/* Last cluster of the chain (0:new chain) */
+)
+{
+	ALCWIN *wp;
+	DWORD cs;
+
+
+	wp = alc_get(obj, 0);
+	if (!wp) return 0;		/* The object has no window */
+	cs = 2;
+	if (clst != 0 && clst + 1 == wp->top && wp->top < wp->end) {	/* Is the next cluster in the window? */
+		cs = alc_stat(obj, wp, wp->top);	/* It may have been taken by an allocation without window */
+		if (cs == 1 || cs == 0xFFFFFFFF) return cs;
+	}
+	if (cs != 0) {			/* Place a new window */
+		wp->top = wp->end = 0;
+		cs = alc_place(obj, wp, clst);
+		if (cs < 2 || cs == 0xFFFFFFFF) return cs;
+	}
+	if (wp->decl) wp->decl--;
+	return wp->top++;
+}
+
+#endif	/* FF_ALLOC_WIN != 0 */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* FAT handling - Stretch a chain or Create a new chain                  */
 /*-----------------------------------------------------------------------*/
@@ -1513,11 +2636,19 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 		scl = clst;							/* Cluster to start to find */
 	}
 	if (fs->free_clst == 0) return 0;		/* No free cluster */
+	ncl = 0;
+#if FF_ALLOC_WIN != 0
+	ncl = alc_next(obj, clst);				/* Get the cluster in the allocation window of the file */
+	if (ncl == 1 || ncl == 0xFFFFFFFF) return ncl;
+#endif
 
 #if FF_FS_EXFAT
 	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-		ncl = find_bitmap(fs, scl, 1);				/* Find a free cluster */
-		if (ncl == 0 || ncl == 0xFFFFFFFF) return ncl;	/* No free cluster or hard error? */
+		if (ncl == 0) {
+			ncl = find_bitmap(fs, scl, 1);			/* Find a free cluster */
+			if (ncl == 0 && ALC_RETRY(fs)) ncl = find_bitmap(fs, scl, 1);
+			if (ncl == 0 || ncl == 0xFFFFFFFF) return ncl;	/* No free cluster or hard error? */
+		}
 		res = change_bitmap(fs, ncl, 1, 1);			/* Mark the cluster 'in use' */
 		if (res == FR_INT_ERR) return 1;
 		if (res == FR_DISK_ERR) return 0xFFFFFFFF;
@@ -1541,12 +2672,17 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 	} else
 #endif
 	{	/* On the FAT/FAT32 volume */
-		ncl = 0;
-		if (scl == clst) {						/* Stretching an existing chain? */
+		if (ncl == 0 && scl == clst) {			/* Stretching an existing chain? */
 			ncl = scl + 1;						/* Test if next cluster is free */
 			if (ncl >= fs->n_fatent) ncl = 2;
 			cs = get_fat(obj, ncl);				/* Get next cluster status */
 			if (cs == 1 || cs == 0xFFFFFFFF) return cs;	/* Test for error */
+#if FF_USE_STREAM != 0
+			if (cs == 0 && strm_busy(fs, ncl)) cs = 2;	/* Reserved by a streaming file? */
+#endif
+#if FF_ALLOC_WIN != 0
+			if (cs == 0 && alc_busy(fs, 0, ncl)) cs = 2;	/* Claimed by an allocation window? */
+#endif
 			if (cs != 0) {						/* Not free? */
 				cs = fs->last_clst;				/* Start at suggested cluster if it is valid */
 				if (cs >= 2 && cs < fs->n_fatent) scl = cs;
@@ -1559,12 +2695,18 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 				ncl++;							/* Next cluster */
 				if (ncl >= fs->n_fatent) {		/* Check wrap-around */
 					ncl = 2;
-					if (ncl > scl) return 0;	/* No free cluster found? */
+					if (ncl > scl && !ALC_RETRY(fs)) return 0;	/* No free cluster found? */
 				}
 				cs = get_fat(obj, ncl);			/* Get the cluster status */
+#if FF_USE_STREAM != 0
+				if (cs == 0 && strm_busy(fs, ncl)) cs = 2;	/* Reserved by a streaming file? */
+#endif
+#if FF_ALLOC_WIN != 0
+				if (cs == 0 && alc_busy(fs, 0, ncl)) cs = 2;	/* Claimed by an allocation window? */
+#endif
 				if (cs == 0) break;				/* Found a free cluster? */
 				if (cs == 1 || cs == 0xFFFFFFFF) return cs;	/* Test for error */
-				if (ncl == scl) return 0;		/* No free cluster found? */
+				if (ncl == scl && !ALC_RETRY(fs)) return 0;	/* No free cluster found? */
 			}
 		}
 		res = put_fat(fs, ncl, 0xFFFFFFFF);		/* Mark the new cluster 'EOC' */
@@ -1589,24 +2731,242 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 
 
 
-#if FF_USE_FASTSEEK
+#if FF_USE_STREAM != 0
 /*-----------------------------------------------------------------------*/
-/* FAT handling - Convert offset into cluster with link map table        */
+/* Streaming: Reserved block handling                                    */
 /*-----------------------------------------------------------------------*/
 
-static DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
-	FIL* fp,		/* Pointer to the file object */
-	FSIZE_t ofs		/* File offset to be converted to cluster# */
+/* In streaming mode, the file is stretched into a contiguous block that is
+/  reserved only in the file object. The clusters of the block are neither
+/  marked on the FAT nor on the allocation bitmap until strm_commit() links
+/  the written part to the chain. Other allocations skip the reserved block
+/  with strm_busy(). */
+
+/*-------------------------------------*/
+/* Get status of a cluster             */
+/*-------------------------------------*/
+
+static DWORD strm_stat (	/* 0:Free, 1:Internal error, 0xFFFFFFFF:Disk error, Else:In use or reserved */
+	FIL* fp,		/* Pointer to the streaming file */
+	DWORD clst		/* Cluster# to be checked */
 )
 {
-	DWORD cl, ncl, *tbl;
+	DWORD cs;
 	FATFS *fs = fp->obj.fs;
 
 
-	tbl = fp->cltbl + 1;	/* Top of CLMT */
-	cl = (DWORD)(ofs / SS(fs) / fs->csize);	/* Cluster order from top of the file */
-	for (;;) {
-		ncl = *tbl++;			/* Number of cluters in the fragment */
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* Check the allocation bitmap */
+		if (move_window(fs, fs->bitbase + (clst - 2) / 8 / SS(fs)) != FR_OK) return 0xFFFFFFFF;
+		cs = (fs->win[(clst - 2) / 8 % SS(fs)] & (1 << ((clst - 2) % 8))) ? 2 : 0;
+	} else
+#endif
+	{								/* Check the FAT */
+		cs = get_fat(&fp->obj, clst);
+	}
+	if (cs == 0 && strm_busy(fs, clst)) cs = 2;	/* Reserved by a streaming file? */
+	return cs;
+}
+
+
+/*-------------------------------------*/
+/* Find a free contiguous cluster block */
+/*-------------------------------------*/
+
+static DWORD strm_find (	/* 0:Not found, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Top of the block */
+	FIL* fp,		/* Pointer to the streaming file */
+	DWORD ncl,		/* Number of contiguous clusters to find (1..) */
+	DWORD align		/* Alignment of the block top [sectors] (power of 2) */
+)
+{
+	DWORD stcl, clst, scl, ctr, cs;
+	FATFS *fs = fp->obj.fs;
+
+
+	stcl = fs->last_clst + 1;		/* Suggested cluster to start to find */
+	if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+	scl = clst = stcl; ctr = 0;
+	for (;;) {
+		if (ctr == 0 && (clst2sect(fs, clst) & (align - 1))) {	/* Cannot be the top of the block? */
+			cs = 2;
+		} else {
+			cs = strm_stat(fp, clst);
+			if (cs == 1 || cs == 0xFFFFFFFF) return cs;
+		}
+		if (cs == 0) {						/* Is it a free cluster? */
+			if (++ctr == ncl) return scl;	/* Check if run length is sufficient for required */
+		} else {
+			ctr = 0;						/* Encountered a cluster in-use, restart to scan */
+		}
+		if (++clst >= fs->n_fatent) {		/* Next cluster (the block cannot wrap around) */
+			clst = 2; ctr = 0;
+		}
+		if (ctr == 0) scl = clst;
+		if (clst == stcl) return 0;			/* All cluster scanned? */
+	}
+}
+
+
+/*-------------------------------------*/
+/* Reserve a new block                 */
+/*-------------------------------------*/
+
+static DWORD strm_reserve (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Top of the block */
+	FIL* fp			/* Pointer to the streaming file */
+)
+{
+	DWORD au, ncl, scl;
+	FATFS *fs = fp->obj.fs;
+
+
+	/* Align the block to the erase block of the device if it is larger than the cluster */
+	au = fs->blk_size;
+	if (au <= fs->csize || (au & (au - 1)) || fs->database % fs->csize) au = 1;
+	ncl = fp->strm_ext;
+	if (au > 1) ncl = (ncl + au / fs->csize - 1) / (au / fs->csize) * (au / fs->csize);	/* Round up to the erase block */
+	if (fs->free_clst <= fs->n_fatent - 2 && ncl > fs->free_clst) ncl = fs->free_clst;	/* Clip at the free space */
+
+	for (scl = 0; ncl > 0; ncl /= 2) {	/* Try smaller block if not found */
+		if (ncl < au / fs->csize) au = 1;	/* Do not align the block smaller than the erase block */
+		scl = strm_find(fp, ncl, au);
+		if (scl != 0) break;
+	}
+	if (scl >= 2 && scl != 0xFFFFFFFF) {
+		fp->strm_top = scl;
+		fp->strm_end = scl + ncl;
+		fs->last_clst = fp->strm_end - 1;	/* Let following allocations start next to the block */
+	}
+	return scl;
+}
+
+
+/*-------------------------------------*/
+/* Commit written part of the block    */
+/*-------------------------------------*/
+
+static FRESULT strm_commit (
+	FIL* fp			/* Pointer to the streaming file */
+)
+{
+	FRESULT res = FR_OK;
+	DWORD top, lcl, cl, n;
+	FATFS *fs = fp->obj.fs;
+
+
+	top = fp->strm_top; lcl = fp->clust;
+	if (fp->fptr == 0 || !IN_STRM_BLK(fp, lcl)) return FR_OK;	/* No cluster has been written in the block? */
+	n = lcl - top + 1;		/* Number of clusters to be committed */
+
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+		res = change_bitmap(fs, top, n, 1);	/* Mark the clusters 'in use' */
+		if (res == FR_OK) {
+			if (fp->strm_tail == 0) {	/* Is it a new chain? */
+				fp->obj.stat = 2;		/* Set status 'contiguous' */
+			} else {
+				if (fp->obj.stat == 2 && top != fp->strm_tail + 1) {	/* Is the chain got fragmented? */
+					fp->obj.n_cont = fp->strm_tail - fp->obj.sclust;	/* Set size of the contiguous part */
+					fp->obj.stat = 3;		/* Change status 'just fragmented' */
+				}
+				if (fp->obj.stat != 2) {	/* Is the file non-contiguous? */
+					if (top == fp->strm_tail + 1) {	/* Is the block next to the chain? */
+						fp->obj.n_frag = fp->obj.n_frag ? fp->obj.n_frag + n : n + 1;	/* Increase size of last fragment */
+					} else {				/* New fragment */
+						if (fp->obj.n_frag == 0) fp->obj.n_frag = 1;
+						res = fill_last_frag(&fp->obj, fp->strm_tail, top);	/* Fill last fragment on the FAT and link it to the block */
+						if (res == FR_OK) fp->obj.n_frag = n;
+					}
+				}
+			}
+		}
+	} else
+#endif
+	{	/* On the FAT/FAT32 volume */
+		for (cl = top; res == FR_OK && cl < lcl; cl++) {	/* Create cluster chain on the FAT */
+			res = put_fat(fs, cl, cl + 1);
+		}
+		if (res == FR_OK) res = put_fat(fs, lcl, 0xFFFFFFFF);	/* Mark the last cluster 'EOC' */
+		if (res == FR_OK && fp->strm_tail != 0) {
+			res = put_fat(fs, fp->strm_tail, top);	/* Link the block from the chain */
+		}
+	}
+
+	if (res == FR_OK) {		/* Update FSINFO and the block */
+		if (fs->free_clst <= fs->n_fatent - 2) fs->free_clst = (fs->free_clst > n) ? fs->free_clst - n : 0;
+		fs->fsi_flag |= 1;
+		fp->strm_tail = lcl;
+		fp->strm_top = lcl + 1;
+		if (fp->strm_top == fp->strm_end) fp->strm_top = fp->strm_end = 0;	/* Entire block has been committed */
+	}
+	return res;
+}
+
+
+/*-------------------------------------*/
+/* Get next cluster to be written      */
+/*-------------------------------------*/
+
+static DWORD strm_next (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Next cluster */
+	FIL* fp			/* Pointer to the streaming file */
+)
+{
+	FRESULT res;
+	DWORD cur, cs, n;
+	FATFS *fs = fp->obj.fs;
+
+
+	cur = (fp->fptr == 0) ? 0 : fp->clust;	/* Current cluster (0:top of the file) */
+	if (cur != 0 && IN_STRM_BLK(fp, cur)) {	/* In the reserved block? */
+		if (cur + 1 < fp->strm_end) return cur + 1;	/* Next cluster in the block */
+		for (n = 0; n < fp->strm_ext && fp->strm_end + n < fs->n_fatent; n++) {	/* Try to stretch the block in place */
+			cs = strm_stat(fp, fp->strm_end + n);
+			if (cs == 1 || cs == 0xFFFFFFFF) return cs;
+			if (cs != 0) break;
+		}
+		if (n > 0) {
+			fp->strm_end += n;
+			fs->last_clst = fp->strm_end - 1;
+			return cur + 1;
+		}
+		res = strm_commit(fp);		/* Commit the entire block and reserve a new one */
+		if (res != FR_OK) return (res == FR_DISK_ERR) ? 0xFFFFFFFF : 1;
+	} else {						/* On the committed chain */
+		if (cur == 0) {
+			if (fp->obj.sclust != 0) return fp->obj.sclust;	/* Follow from the origin */
+		} else {
+			cs = get_fat(&fp->obj, cur);
+			if (cs < 2 || cs == 0xFFFFFFFF) return (cs == 0xFFFFFFFF) ? cs : 1;
+			if (cs < fs->n_fatent) return cs;	/* Follow the chain */
+		}
+		fp->strm_tail = cur;		/* Last cluster of the committed chain */
+		if (fp->strm_top != 0) return fp->strm_top;	/* Continue to the rest of the block */
+	}
+	return strm_reserve(fp);
+}
+
+#endif	/* FF_USE_STREAM != 0 */
+
+
+
+
+#if FF_USE_FASTSEEK
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Convert offset into cluster with link map table        */
+/*-----------------------------------------------------------------------*/
+
+static DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
+	FIL* fp,		/* Pointer to the file object */
+	FSIZE_t ofs		/* File offset to be converted to cluster# */
+)
+{
+	DWORD cl, ncl, *tbl;
+	FATFS *fs = fp->obj.fs;
+
+
+	tbl = fp->cltbl + 1;	/* Top of CLMT */
+	cl = (DWORD)(ofs / SS(fs) / fs->csize);	/* Cluster order from top of the file */
+	for (;;) {
+		ncl = *tbl++;			/* Number of cluters in the fragment */
 		if (ncl == 0) return 0;	/* End of table? (error) */
 		if (cl < ncl) break;	/* In this fragment? */
 		cl -= ncl; tbl++;		/* Next fragment */
@@ -1632,12 +2992,22 @@ static FRESULT dir_clear (	/* Returns FR_OK or FR_DISK_ERR */
 	LBA_t sect;
 	UINT n, szb;
 	BYTE *ibuf;
+#if FF_USE_ZEROFILL
+	LBA_t rt[2];
+#endif
 
 
 	if (sync_window(fs) != FR_OK) return FR_DISK_ERR;	/* Flush disk access window */
+#if FF_DIR_SCAN != 0
+	fs->dscnt = 0;					/* Discard the directory scan buffer (it may have old contents of the cluster) */
+#endif
 	sect = clst2sect(fs, clst);		/* Top of the cluster */
 	fs->winsect = sect;				/* Set window to top of the cluster */
 	memset(fs->win, 0, sizeof fs->win);	/* Clear window buffer */
+#if FF_USE_ZEROFILL
+	rt[0] = sect; rt[1] = sect + fs->csize - 1;	/* Sector range of the cluster */
+	if (disk_ioctl(fs->pdrv, CTRL_ZERO, rt) == RES_OK) return FR_OK;	/* Let the device fill the cluster with 0 */
+#endif
 #if FF_USE_LFN == 3		/* Quick table clear by using multi-secter write */
 	/* Allocate a temporary buffer */
 	for (szb = ((DWORD)fs->csize * SS(fs) >= MAX_MALLOC) ? MAX_MALLOC : fs->csize * SS(fs), ibuf = 0; szb > SS(fs) && (ibuf = ff_memalloc(szb)) == 0; szb /= 2) ;
@@ -1786,7 +3156,7 @@ static FRESULT dir_alloc (	/* FR_OK(0):succeeded, !=0:error */
 	if (res == FR_OK) {
 		n = 0;
 		do {
-			res = move_window(fs, dp->sect);
+			res = MOVE_DIRWIN(fs, dp);
 			if (res != FR_OK) break;
 #if FF_FS_EXFAT
 			if ((fs->fs_type == FS_EXFAT) ? (int)((dp->dir[XDIR_Type] & 0x80) == 0) : (int)(dp->dir[DIR_Name] == DDEM || dp->dir[DIR_Name] == 0)) {	/* Is the entry free? */
@@ -1845,6 +3215,16 @@ static void st_clust (
 #endif
 
 
+#if FF_DIR_INDEX != 0 || FF_PATH_CACHE != 0
+static DWORD dir_clust (	/* Returns start cluster of the directory (root directory is not 0 but its cluster on FAT32/exFAT) */
+	FFOBJID* obj			/* Directory object */
+)
+{
+	return (obj->sclust == 0 && obj->fs->fs_type >= FS_FAT32) ? (DWORD)obj->fs->dirbase : obj->sclust;
+}
+#endif
+
+
 
 #if FF_USE_LFN
 /*--------------------------------------------------------*/
@@ -1962,6 +3342,29 @@ static void put_lfn (
 /* FAT-LFN: Create a Numbered SFN                                        */
 /*-----------------------------------------------------------------------*/
 
+static UINT hash_numname (	/* Returns hash number of the numbered SFN (0..0xFFFF) */
+	const WCHAR* lfn,	/* Pointer to LFN */
+	UINT seq			/* Sequence number */
+)
+{
+	UINT i;
+	WCHAR wc;
+	DWORD sreg;
+
+
+	sreg = seq;
+	while (*lfn) {	/* Create a CRC as hash value */
+		wc = *lfn++;
+		for (i = 0; i < 16; i++) {
+			sreg = (sreg << 1) + (wc & 1);
+			wc >>= 1;
+			if (sreg & 0x10000) sreg ^= 0x11021;
+		}
+	}
+	return (UINT)sreg;
+}
+
+
 static void gen_numname (
 	BYTE* dst,			/* Pointer to the buffer to store numbered SFN */
 	const BYTE* src,	/* Pointer to SFN in directory form */
@@ -1971,23 +3374,12 @@ static void gen_numname (
 {
 	BYTE ns[8], c;
 	UINT i, j;
-	WCHAR wc;
-	DWORD sreg;
 
 
 	memcpy(dst, src, 11);	/* Prepare the SFN to be modified */
 
 	if (seq > 5) {	/* In case of many collisions, generate a hash number instead of sequential number */
-		sreg = seq;
-		while (*lfn) {	/* Create a CRC as hash value */
-			wc = *lfn++;
-			for (i = 0; i < 16; i++) {
-				sreg = (sreg << 1) + (wc & 1);
-				wc >>= 1;
-				if (sreg & 0x10000) sreg ^= 0x11021;
-			}
-		}
-		seq = (UINT)sreg;
+		seq = hash_numname(lfn, seq);
 	}
 
 	/* Make suffix (~ + hexdecimal) */
@@ -2106,7 +3498,7 @@ static FRESULT load_xdir (	/* FR_INT_ERR: invalid entry block */
 
 
 	/* Load file directory entry */
-	res = move_window(dp->obj.fs, dp->sect);
+	res = MOVE_DIRWIN(dp->obj.fs, dp);
 	if (res != FR_OK) return res;
 	if (dp->dir[XDIR_Type] != ET_FILEDIR) return FR_INT_ERR;	/* Invalid order */
 	memcpy(dirb + 0 * SZDIRE, dp->dir, SZDIRE);
@@ -2117,7 +3509,7 @@ static FRESULT load_xdir (	/* FR_INT_ERR: invalid entry block */
 	res = dir_next(dp, 0);
 	if (res == FR_NO_FILE) res = FR_INT_ERR;	/* It cannot be */
 	if (res != FR_OK) return res;
-	res = move_window(dp->obj.fs, dp->sect);
+	res = MOVE_DIRWIN(dp->obj.fs, dp);
 	if (res != FR_OK) return res;
 	if (dp->dir[XDIR_Type] != ET_STREAM) return FR_INT_ERR;	/* Invalid order */
 	memcpy(dirb + 1 * SZDIRE, dp->dir, SZDIRE);
@@ -2129,7 +3521,7 @@ static FRESULT load_xdir (	/* FR_INT_ERR: invalid entry block */
 		res = dir_next(dp, 0);
 		if (res == FR_NO_FILE) res = FR_INT_ERR;	/* It cannot be */
 		if (res != FR_OK) return res;
-		res = move_window(dp->obj.fs, dp->sect);
+		res = MOVE_DIRWIN(dp->obj.fs, dp);
 		if (res != FR_OK) return res;
 		if (dp->dir[XDIR_Type] != ET_FILENAME) return FR_INT_ERR;	/* Invalid order */
 		if (i < MAXDIRB(FF_MAX_LFN)) memcpy(dirb + i, dp->dir, SZDIRE);
@@ -2285,7 +3677,7 @@ static FRESULT dir_read (
 #endif
 
 	while (dp->sect) {
-		res = move_window(fs, dp->sect);
+		res = MOVE_DIRWIN(fs, dp);
 		if (res != FR_OK) break;
 		b = dp->dir[DIR_Name];	/* Test for the entry type */
 		if (b == 0) {
@@ -2347,11 +3739,12 @@ static FRESULT dir_read (
 
 
 /*-----------------------------------------------------------------------*/
-/* Directory handling - Find an object in the directory                  */
+/* FAT: Directory handling - Compare entries with the object name        */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
-	DIR* dp					/* Pointer to the directory object with the file name */
+static FRESULT dir_scan (	/* FR_OK(0):found, FR_NO_FILE:not found, !=0:error */
+	DIR* dp,				/* Pointer to the directory object with the file name */
+	UINT nent				/* Number of entries to be examined (0:until end of the table) */
 )
 {
 	FRESULT res;
@@ -2361,34 +3754,11 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 	BYTE a, ord, sum;
 #endif
 
-	res = dir_sdi(dp, 0);			/* Rewind directory object */
-	if (res != FR_OK) return res;
-#if FF_FS_EXFAT
-	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-		BYTE nc;
-		UINT di, ni;
-		WORD hash = xname_sum(fs->lfnbuf);		/* Hash value of the name to find */
-
-		while ((res = DIR_READ_FILE(dp)) == FR_OK) {	/* Read an item */
-#if FF_MAX_LFN < 255
-			if (fs->dirbuf[XDIR_NumName] > FF_MAX_LFN) continue;		/* Skip comparison if inaccessible object name */
-#endif
-			if (ld_word(fs->dirbuf + XDIR_NameHash) != hash) continue;	/* Skip comparison if hash mismatched */
-			for (nc = fs->dirbuf[XDIR_NumName], di = SZDIRE * 2, ni = 0; nc; nc--, di += 2, ni++) {	/* Compare the name */
-				if ((di % SZDIRE) == 0) di += 2;
-				if (ff_wtoupper(ld_word(fs->dirbuf + di)) != ff_wtoupper(fs->lfnbuf[ni])) break;
-			}
-			if (nc == 0 && !fs->lfnbuf[ni]) break;	/* Name matched? */
-		}
-		return res;
-	}
-#endif
-	/* On the FAT/FAT32 volume */
 #if FF_USE_LFN
 	ord = sum = 0xFF; dp->blk_ofs = 0xFFFFFFFF;	/* Reset LFN sequence */
 #endif
 	do {
-		res = move_window(fs, dp->sect);
+		res = MOVE_DIRWIN(fs, dp);
 		if (res != FR_OK) break;
 		c = dp->dir[DIR_Name];
 		if (c == 0) { res = FR_NO_FILE; break; }	/* Reached to end of table */
@@ -2417,6 +3787,7 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 		dp->obj.attr = dp->dir[DIR_Attr] & AM_MASK;
 		if (!(dp->dir[DIR_Attr] & AM_VOL) && !memcmp(dp->dir, dp->fn, 11)) break;	/* Is it a valid entry? */
 #endif
+		if (nent != 0 && --nent == 0) { res = FR_NO_FILE; break; }	/* All entries in the range have been examined */
 		res = dir_next(dp, 0);	/* Next entry */
 	} while (res == FR_OK);
 
@@ -2426,1753 +3797,3187 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 
 
 
-#if !FF_FS_READONLY
+#if FF_DIR_INDEX != 0
 /*-----------------------------------------------------------------------*/
-/* Register an object to the directory                                   */
+/* FAT: Directory handling - Name index                                  */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT dir_register (	/* FR_OK:succeeded, FR_DENIED:no free entry or too many SFN collision, FR_DISK_ERR:disk error */
-	DIR* dp						/* Target directory with object name to be created */
+static DWORD idx_sum (	/* Returns updated hash sum */
+	DWORD sum,			/* Hash sum of the preceding characters */
+	DWORD chr,			/* Character to be added (up-case converted) */
+	UINT pos			/* Position of the character in the name */
 )
 {
-	FRESULT res;
-	FATFS *fs = dp->obj.fs;
-#if FF_USE_LFN		/* LFN configuration */
-	UINT n, len, n_ent;
-	BYTE sn[12], sum;
+	chr = (chr | (DWORD)pos << 16) * 0x9E3779B1;	/* Position dependent hash of the character */
+	return sum + (chr ^ chr >> 15);					/* The sum can be calculated in any order of the characters */
+}
 
 
-	if (dp->fn[NSFLAG] & (NS_DOT | NS_NONAME)) return FR_INVALID_NAME;	/* Check name validity */
-	for (len = 0; fs->lfnbuf[len]; len++) ;	/* Get lfn length */
+static WORD idx_sfn_hash (	/* Returns hash value of the SFN */
+	const BYTE* sfn			/* Pointer to the SFN in directory form */
+)
+{
+	DWORD sum = 0;
+	UINT i;
 
-#if FF_FS_EXFAT
-	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-		n_ent = (len + 14) / 15 + 2;	/* Number of entries to allocate (85+C0+C1s) */
-		res = dir_alloc(dp, n_ent);		/* Allocate directory entries */
-		if (res != FR_OK) return res;
-		dp->blk_ofs = dp->dptr - SZDIRE * (n_ent - 1);	/* Set the allocated entry block offset */
+	for (i = 0; i < 11; i++) sum = idx_sum(sum, sfn[i], i);
+	return (WORD)(sum ^ sum >> 16);
+}
 
-		if (dp->obj.stat & 4) {			/* Has the directory been stretched by new allocation? */
-			dp->obj.stat &= ~4;
-			res = fill_first_frag(&dp->obj);	/* Fill the first fragment on the FAT if needed */
-			if (res != FR_OK) return res;
-			res = fill_last_frag(&dp->obj, dp->clust, 0xFFFFFFFF);	/* Fill the last fragment on the FAT if needed */
-			if (res != FR_OK) return res;
-			if (dp->obj.sclust != 0) {		/* Is it a sub-directory? */
-				DIR dj;
 
-				res = load_obj_xdir(&dj, &dp->obj);	/* Load the object status */
-				if (res != FR_OK) return res;
-				dp->obj.objsize += (DWORD)fs->csize * SS(fs);		/* Increase the directory size by cluster size */
-				st_qword(fs->dirbuf + XDIR_FileSize, dp->obj.objsize);
-				st_qword(fs->dirbuf + XDIR_ValidFileSize, dp->obj.objsize);
-				fs->dirbuf[XDIR_GenFlags] = dp->obj.stat | 1;		/* Update the allocation status */
-				res = store_xdir(&dj);				/* Store the object status */
-				if (res != FR_OK) return res;
-			}
-		}
+#if FF_USE_LFN
+static WORD idx_lfn_hash (	/* Returns hash value of the LFN */
+	const WCHAR* lfn		/* Pointer to the LFN */
+)
+{
+	DWORD sum = 0;
+	UINT i;
 
-		create_xdir(fs->dirbuf, fs->lfnbuf);	/* Create on-memory directory block to be written later */
-		return FR_OK;
-	}
+	for (i = 0; lfn[i]; i++) sum = idx_sum(sum, ff_wtoupper(lfn[i]), i);
+	return (WORD)(sum ^ sum >> 16);
+}
 #endif
-	/* On the FAT/FAT32 volume */
-	memcpy(sn, dp->fn, 12);
-	if (sn[NSFLAG] & NS_LOSS) {			/* When LFN is out of 8.3 format, generate a numbered name */
-		dp->fn[NSFLAG] = NS_NOLFN;		/* Find only SFN */
-		for (n = 1; n < 100; n++) {
-			gen_numname(dp->fn, sn, fs->lfnbuf, n);	/* Generate a numbered name */
-			res = dir_find(dp);				/* Check if the name collides with existing SFN */
-			if (res != FR_OK) break;
-		}
-		if (n == 100) return FR_DENIED;		/* Abort if too many collisions */
-		if (res != FR_NO_FILE) return res;	/* Abort if the result is other than 'not collided' */
-		dp->fn[NSFLAG] = sn[NSFLAG];
-	}
 
-	/* Create an SFN with/without LFNs. */
-	n_ent = (sn[NSFLAG] & NS_LFN) ? (len + 12) / 13 + 1 : 1;	/* Number of entries to allocate */
-	res = dir_alloc(dp, n_ent);		/* Allocate entries */
-	if (res == FR_OK && --n_ent) {	/* Set LFN entry if needed */
-		res = dir_sdi(dp, dp->dptr - n_ent * SZDIRE);
-		if (res == FR_OK) {
-			sum = sum_sfn(dp->fn);	/* Checksum value of the SFN tied to the LFN */
-			do {					/* Store LFN entries in bottom first */
-				res = move_window(fs, dp->sect);
-				if (res != FR_OK) break;
-				put_lfn(fs->lfnbuf, dp->dir, (BYTE)n_ent, sum);
-				fs->wflag = 1;
-				res = dir_next(dp, 0);	/* Next entry */
-			} while (res == FR_OK && --n_ent);
-		}
-	}
 
-#else	/* Non LFN configuration */
-	res = dir_alloc(dp, 1);		/* Allocate an entry for SFN */
+static DIRIDX* idx_get (	/* Returns the index slot of the directory (NULL:not indexed) */
+	FATFS* fs,			/* Filesystem object */
+	DWORD clu			/* Start cluster of the directory */
+)
+{
+	DIRIDX *di;
 
-#endif
 
-	/* Set SFN entry */
-	if (res == FR_OK) {
-		res = move_window(fs, dp->sect);
-		if (res == FR_OK) {
-			memset(dp->dir, 0, SZDIRE);	/* Clean the entry */
-			memcpy(dp->dir + DIR_Name, dp->fn, 11);	/* Put SFN */
-#if FF_USE_LFN
-			dp->dir[DIR_NTres] = dp->fn[NSFLAG] & (NS_BODY | NS_EXT);	/* Put NT flag */
-#endif
-			fs->wflag = 1;
+	for (di = DirIdx; di < DirIdx + FF_DIR_INDEX_NUM; di++) {
+		if (di->fs == fs && di->id == fs->id && di->clu == clu) {
+			di->age = ++DiAge;
+			return di;
 		}
 	}
-
-	return res;
+	return 0;
 }
 
-#endif /* !FF_FS_READONLY */
 
+static int idx_put (	/* 1:Added, 0:No free record (the index has been discarded) */
+	DIRIDX* di,			/* Index slot */
+	WORD hash,			/* Hash value of the name */
+	UINT ent,			/* Index of the SFN entry */
+	UINT nlfn			/* Number of LFN entries */
+)
+{
+	UINT i = di->nrec;
 
 
-#if !FF_FS_READONLY && FF_FS_MINIMIZE == 0
-/*-----------------------------------------------------------------------*/
-/* Remove an object from the directory                                   */
-/*-----------------------------------------------------------------------*/
+	if (i >= DIRIDX_NREC) {		/* Budget exceeded? */
+		di->valid = 0;
+		return 0;
+	}
+	di->rec[i].hash = hash;
+	di->rec[i].ent = (WORD)ent;
+	di->rec[i].nlfn = (BYTE)nlfn;
+	di->rec[i].nxt = di->head[hash % DIRIDX_NREC];	/* Link it to the top of hash chain */
+	di->head[hash % DIRIDX_NREC] = (WORD)i;
+	di->nrec = i + 1;
+	return 1;
+}
 
-static FRESULT dir_remove (	/* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
-	DIR* dp					/* Directory object pointing the entry to be removed */
+
+static void idx_build (
+	DIR* dp				/* Directory object to be indexed (directory pointer is not changed) */
 )
 {
 	FRESULT res;
 	FATFS *fs = dp->obj.fs;
-#if FF_USE_LFN		/* LFN configuration */
-	DWORD last = dp->dptr;
+	DIRIDX *di;
+	UINT n;
+	DIR dj;
+	BYTE c, a, nlfn = 0;
+#if FF_USE_LFN
+	BYTE ord = 0xFF, sum = 0;
+	UINT i;
+	WCHAR wc;
+	DWORD hs = 0;
+#endif
 
-	res = (dp->blk_ofs == 0xFFFFFFFF) ? FR_OK : dir_sdi(dp, dp->blk_ofs);	/* Goto top of the entry block if LFN is exist */
-	if (res == FR_OK) {
-		do {
-			res = move_window(fs, dp->sect);
-			if (res != FR_OK) break;
-			if (FF_FS_EXFAT && fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-				dp->dir[XDIR_Type] &= 0x7F;	/* Clear the entry InUse flag. */
-			} else {										/* On the FAT/FAT32 volume */
-				dp->dir[DIR_Name] = DDEM;	/* Mark the entry 'deleted'. */
-			}
-			fs->wflag = 1;
-			if (dp->dptr >= last) break;	/* If reached last entry then all entries of the object has been deleted. */
-			res = dir_next(dp, 0);	/* Next entry */
-		} while (res == FR_OK);
-		if (res == FR_NO_FILE) res = FR_INT_ERR;
-	}
-#else			/* Non LFN configuration */
 
-	res = move_window(fs, dp->sect);
-	if (res == FR_OK) {
-		dp->dir[DIR_Name] = DDEM;	/* Mark the entry 'deleted'.*/
-		fs->wflag = 1;
+	di = &DirIdx[0];
+	for (n = 1; n < FF_DIR_INDEX_NUM && di->fs; n++) {	/* Find a blank slot or the least recently used slot */
+		if (!DirIdx[n].fs || DirIdx[n].age - di->age > 0x80000000) di = &DirIdx[n];
 	}
+	di->fs = fs; di->id = fs->id; di->clu = dir_clust(&dp->obj);	/* Register the directory */
+	di->age = ++DiAge;
+	di->valid = 0; di->nrec = 0;
+	memset(di->head, 0xFF, sizeof di->head);	/* Clear hash chains */
+	dj.obj = dp->obj;
+	res = dir_sdi(&dj, 0);
+	while (res == FR_OK) {
+		res = MOVE_DIRWIN(fs, &dj);
+		if (res != FR_OK) break;
+		c = dj.dir[DIR_Name];
+		if (c == 0) break;			/* Reached to end of the table */
+		a = dj.dir[DIR_Attr] & AM_MASK;
+		if (c != DDEM && !(a & AM_VOL)) {	/* An SFN entry */
+#if FF_USE_LFN
+			if (ord != 0 || sum != sum_sfn(dj.dir)) nlfn = 0;	/* Has no valid LFN? */
+			if (nlfn && !idx_put(di, (WORD)(hs ^ hs >> 16), dj.dptr / SZDIRE, nlfn)) { res = FR_NOT_ENOUGH_CORE; break; }
+			ord = 0xFF;
+#endif
+			if (!idx_put(di, idx_sfn_hash(dj.dir), dj.dptr / SZDIRE, nlfn)) { res = FR_NOT_ENOUGH_CORE; break; }
+		}
+#if FF_USE_LFN
+		else if (c != DDEM && a == AM_LFN) {	/* An LFN entry */
+			if (c & LLEF) {			/* Start of LFN sequence */
+				c &= (BYTE)~LLEF; ord = nlfn = c;
+				sum = dj.dir[LDIR_Chksum]; hs = 0;
+			}
+			if (c == ord && c >= 1 && c <= 20 && sum == dj.dir[LDIR_Chksum] && ld_word(dj.dir + LDIR_FstClusLO) == 0) {
+				for (i = 0; i < 13; i++) {	/* Add the name fragment to the hash */
+					wc = ld_word(dj.dir + LfnOfs[i]);
+					if (wc == 0 || wc == 0xFFFF) break;
+					hs = idx_sum(hs, ff_wtoupper(wc), (c - 1) * 13 + i);
+				}
+				ord--;
+			} else {
+				ord = 0xFF;
+			}
+		} else {					/* A deleted entry or volume label */
+			ord = 0xFF;
+		}
 #endif
+		res = dir_next(&dj, 0);
+	}
 
-	return res;
+	if (res == FR_OK || res == FR_NO_FILE) {	/* Reached end of the table? */
+		di->valid = 1;			/* All names in the directory have been indexed */
+	} else {
+		if (res != FR_NOT_ENOUGH_CORE) di->fs = 0;	/* Discard the index on error */
+	}
 }
 
-#endif /* !FF_FS_READONLY && FF_FS_MINIMIZE == 0 */
 
+static FRESULT idx_find (	/* FR_OK(0):found, FR_NO_FILE:not found, !=0:error */
+	DIRIDX* di,				/* Index slot of the directory */
+	DIR* dp					/* Pointer to the directory object with the file name */
+)
+{
+	FRESULT res;
+	WORD hash[2];
+	UINT n, k, i;
 
 
-#if FF_FS_MINIMIZE <= 1 || FF_FS_RPATH >= 2
-/*-----------------------------------------------------------------------*/
-/* Get file information from directory entry                             */
-/*-----------------------------------------------------------------------*/
+	n = 0;
+#if FF_USE_LFN
+	if (!(dp->fn[NSFLAG] & NS_NOLFN)) hash[n++] = idx_lfn_hash(dp->obj.fs->lfnbuf);
+	if (!(dp->fn[NSFLAG] & NS_LOSS)) hash[n++] = idx_sfn_hash(dp->fn);
+#else
+	hash[n++] = idx_sfn_hash(dp->fn);
+#endif
+	for (k = 0; k < n; k++) {
+		for (i = di->head[hash[k] % DIRIDX_NREC]; i != 0xFFFF; i = di->rec[i].nxt) {	/* Follow the hash chain */
+			if (di->rec[i].hash != hash[k]) continue;
+			res = dir_sdi(dp, (DWORD)(di->rec[i].ent - di->rec[i].nlfn) * SZDIRE);	/* Check out the entry block */
+			if (res == FR_OK) res = dir_scan(dp, di->rec[i].nlfn + 1U);
+			if (res != FR_NO_FILE) return res;	/* Found or error */
+		}
+	}
+	return FR_NO_FILE;
+}
 
-static void get_fileinfo (
-	DIR* dp,			/* Pointer to the directory object */
-	FILINFO* fno		/* Pointer to the file information to be filled */
+
+#if !FF_FS_READONLY
+static void idx_add (
+	DIR* dp,			/* Directory object pointing the SFN entry of the new object */
+	UINT nlfn			/* Number of LFN entries of the object */
 )
 {
-	UINT si, di;
+	DIRIDX *di = idx_get(dp->obj.fs, dir_clust(&dp->obj));
+
+
+	if (!di || !di->valid) return;
 #if FF_USE_LFN
-	BYTE lcf;
-	WCHAR wc, hs;
-	FATFS *fs = dp->obj.fs;
-	UINT nw;
-#else
-	TCHAR c;
+	if (nlfn && !idx_put(di, idx_lfn_hash(dp->obj.fs->lfnbuf), dp->dptr / SZDIRE, nlfn)) return;
+#endif
+	idx_put(di, idx_sfn_hash(dp->fn), dp->dptr / SZDIRE, nlfn);
+}
 #endif
 
 
-	fno->fname[0] = 0;			/* Invaidate file info */
-	if (dp->sect == 0) return;	/* Exit if read pointer has reached end of directory */
-
-#if FF_USE_LFN		/* LFN configuration */
-#if FF_FS_EXFAT
-	if (fs->fs_type == FS_EXFAT) {	/* exFAT volume */
-		UINT nc = 0;
+#if !FF_FS_READONLY && FF_FS_MINIMIZE == 0
+static void idx_remove (
+	DIR* dp				/* Directory object pointing the SFN entry of the removed object */
+)
+{
+	DIRIDX *di;
+	DWORD clu;
+	UINT i, last, ent;
+	WORD *p;
 
-		si = SZDIRE * 2; di = 0;	/* 1st C1 entry in the entry block */
-		hs = 0;
-		while (nc < fs->dirbuf[XDIR_NumName]) {
-			if (si >= MAXDIRB(FF_MAX_LFN)) { di = 0; break; }	/* Truncated directory block? */
-			if ((si % SZDIRE) == 0) si += 2;		/* Skip entry type field */
-			wc = ld_word(fs->dirbuf + si); si += 2; nc++;	/* Get a character */
-			if (hs == 0 && IsSurrogate(wc)) {		/* Is it a surrogate? */
-				hs = wc; continue;					/* Get low surrogate */
-			}
-			nw = put_utf((DWORD)hs << 16 | wc, &fno->fname[di], FF_LFN_BUF - di);	/* Store it in API encoding */
-			if (nw == 0) { di = 0; break; }			/* Buffer overflow or wrong char? */
-			di += nw;
-			hs = 0;
-		}
-		if (hs != 0) di = 0;					/* Broken surrogate pair? */
-		if (di == 0) fno->fname[di++] = '?';	/* Inaccessible object name? */
-		fno->fname[di] = 0;						/* Terminate the name */
-		fno->altname[0] = 0;					/* exFAT does not support SFN */
 
-		fno->fattrib = fs->dirbuf[XDIR_Attr] & AM_MASKX;		/* Attribute */
-		fno->fsize = (fno->fattrib & AM_DIR) ? 0 : ld_qword(fs->dirbuf + XDIR_FileSize);	/* Size */
-		fno->ftime = ld_word(fs->dirbuf + XDIR_ModTime + 0);	/* Time */
-		fno->fdate = ld_word(fs->dirbuf + XDIR_ModTime + 2);	/* Date */
-		return;
-	} else
-#endif
-	{	/* FAT/FAT32 volume */
-		if (dp->blk_ofs != 0xFFFFFFFF) {	/* Get LFN if available */
-			si = di = 0;
-			hs = 0;
-			while (fs->lfnbuf[si] != 0) {
-				wc = fs->lfnbuf[si++];		/* Get an LFN character (UTF-16) */
-				if (hs == 0 && IsSurrogate(wc)) {	/* Is it a surrogate? */
-					hs = wc; continue;		/* Get low surrogate */
-				}
-				nw = put_utf((DWORD)hs << 16 | wc, &fno->fname[di], FF_LFN_BUF - di);	/* Store it in API encoding */
-				if (nw == 0) { di = 0; break; }	/* Buffer overflow or wrong char? */
-				di += nw;
-				hs = 0;
-			}
-			if (hs != 0) di = 0;	/* Broken surrogate pair? */
-			fno->fname[di] = 0;		/* Terminate the LFN (null string means LFN is invalid) */
-		}
+	clu = ld_clust(dp->obj.fs, dp->dir);
+	if ((dp->dir[DIR_Attr] & AM_DIR) && clu != 0) {	/* Is a sub-directory removed? */
+		di = idx_get(dp->obj.fs, clu);
+		if (di) di->fs = 0;		/* Discard its index */
 	}
-
-	si = di = 0;
-	while (si < 11) {		/* Get SFN from SFN entry */
-		wc = dp->dir[si++];			/* Get a char */
-		if (wc == ' ') continue;	/* Skip padding spaces */
-		if (wc == RDDEM) wc = DDEM;	/* Restore replaced DDEM character */
-		if (si == 9 && di < FF_SFN_BUF) fno->altname[di++] = '.';	/* Insert a . if extension is exist */
-#if FF_LFN_UNICODE >= 1	/* Unicode output */
-		if (dbc_1st((BYTE)wc) && si != 8 && si != 11 && dbc_2nd(dp->dir[si])) {	/* Make a DBC if needed */
-			wc = wc << 8 | dp->dir[si++];
-		}
-		wc = ff_oem2uni(wc, CODEPAGE);		/* ANSI/OEM -> Unicode */
-		if (wc == 0) { di = 0; break; }		/* Wrong char in the current code page? */
-		nw = put_utf(wc, &fno->altname[di], FF_SFN_BUF - di);	/* Store it in API encoding */
-		if (nw == 0) { di = 0; break; }		/* Buffer overflow? */
-		di += nw;
-#else					/* ANSI/OEM output */
-		fno->altname[di++] = (TCHAR)wc;	/* Store it without any conversion */
-#endif
+	di = idx_get(dp->obj.fs, dir_clust(&dp->obj));
+	if (!di) return;
+	if (!di->valid) {		/* Allow to retry to build the index */
+		di->fs = 0;
+		return;
 	}
-	fno->altname[di] = 0;	/* Terminate the SFN  (null string means SFN is invalid) */
-
-	if (fno->fname[0] == 0) {	/* If LFN is invalid, altname[] needs to be copied to fname[] */
-		if (di == 0) {	/* If LFN and SFN both are invalid, this object is inaccesible */
-			fno->fname[di++] = '?';
-		} else {
-			for (si = di = 0, lcf = NS_BODY; fno->altname[si]; si++, di++) {	/* Copy altname[] to fname[] with case information */
-				wc = (WCHAR)fno->altname[si];
-				if (wc == '.') lcf = NS_EXT;
-				if (IsUpper(wc) && (dp->dir[DIR_NTres] & lcf)) wc += 0x20;
-				fno->fname[di] = (TCHAR)wc;
-			}
+	ent = dp->dptr / SZDIRE;
+	for (i = 0; i < di->nrec; ) {	/* Remove the records of the entry */
+		if (di->rec[i].ent != ent) { i++; continue; }
+		for (p = &di->head[di->rec[i].hash % DIRIDX_NREC]; *p != i; p = &di->rec[*p].nxt) ;
+		*p = di->rec[i].nxt;		/* Unlink the record from the hash chain */
+		last = --di->nrec;
+		if (i != last) {			/* Move the last record into the hole */
+			for (p = &di->head[di->rec[last].hash % DIRIDX_NREC]; *p != last; p = &di->rec[*p].nxt) ;
+			*p = (WORD)i;
+			di->rec[i] = di->rec[last];
 		}
-		fno->fname[di] = 0;	/* Terminate the LFN */
-		if (!dp->dir[DIR_NTres]) fno->altname[0] = 0;	/* Altname is not needed if neither LFN nor case info is exist. */
-	}
-
-#else	/* Non-LFN configuration */
-	si = di = 0;
-	while (si < 11) {		/* Copy name body and extension */
-		c = (TCHAR)dp->dir[si++];
-		if (c == ' ') continue;		/* Skip padding spaces */
-		if (c == RDDEM) c = DDEM;	/* Restore replaced DDEM character */
-		if (si == 9) fno->fname[di++] = '.';/* Insert a . if extension is exist */
-		fno->fname[di++] = c;
 	}
-	fno->fname[di] = 0;		/* Terminate the SFN */
+}
 #endif
 
-	fno->fattrib = dp->dir[DIR_Attr] & AM_MASK;			/* Attribute */
-	fno->fsize = ld_dword(dp->dir + DIR_FileSize);		/* Size */
-	fno->ftime = ld_word(dp->dir + DIR_ModTime + 0);	/* Time */
-	fno->fdate = ld_word(dp->dir + DIR_ModTime + 2);	/* Date */
-}
+#endif	/* FF_DIR_INDEX != 0 */
 
-#endif /* FF_FS_MINIMIZE <= 1 || FF_FS_RPATH >= 2 */
 
 
 
-#if FF_USE_FIND && FF_FS_MINIMIZE <= 1
+#if FF_PATH_CACHE != 0
 /*-----------------------------------------------------------------------*/
-/* Pattern matching                                                      */
+/* Path resolution cache                                                 */
 /*-----------------------------------------------------------------------*/
 
-#define FIND_RECURS	4	/* Maximum number of wildcard terms in the pattern to limit recursion */
-
-
-static DWORD get_achar (	/* Get a character and advance ptr */
-	const TCHAR** ptr		/* Pointer to pointer to the ANSI/OEM or Unicode string */
+static PATHCACHE* pc_search (	/* Returns the cache entry of the sub-directory (NULL:not cached) */
+	DIR* dp						/* Directory object with the segment name */
 )
 {
-	DWORD chr;
-
+	FATFS *fs = dp->obj.fs;
+	DWORD pclu = dir_clust(&dp->obj);
+	PATHCACHE *pc;
+	UINT i;
+#if FF_USE_LFN
+	UINT n;
+	WCHAR wc;
+#endif
 
-#if FF_USE_LFN && FF_LFN_UNICODE >= 1	/* Unicode input */
-	chr = tchar2uni(ptr);
-	if (chr == 0xFFFFFFFF) chr = 0;		/* Wrong UTF encoding is recognized as end of the string */
-	chr = ff_wtoupper(chr);
 
-#else									/* ANSI/OEM input */
-	chr = (BYTE)*(*ptr)++;				/* Get a byte */
-	if (IsLower(chr)) chr -= 0x20;		/* To upper ASCII char */
-#if FF_CODE_PAGE == 0
-	if (ExCvt && chr >= 0x80) chr = ExCvt[chr - 0x80];	/* To upper SBCS extended char */
-#elif FF_CODE_PAGE < 900
-	if (chr >= 0x80) chr = ExCvt[chr - 0x80];	/* To upper SBCS extended char */
+	for (i = 0; i < FF_PATH_CACHE; i++) {
+		pc = &PathCache[i];
+		if (pc->fs != fs || pc->id != fs->id || pc->pclu != pclu) continue;
+#if FF_USE_LFN
+		for (n = 0; n <= PCACHE_NAME; n++) {	/* Compare the name */
+			wc = (WCHAR)ff_wtoupper(fs->lfnbuf[n]);
+			if (wc != pc->name[n] || wc == 0) break;
+		}
+		if (n <= PCACHE_NAME && wc == 0 && pc->name[n] == 0) return pc;
+#else
+		if (!memcmp(pc->name, dp->fn, 11)) return pc;
 #endif
-#if FF_CODE_PAGE == 0 || FF_CODE_PAGE >= 900
-	if (dbc_1st((BYTE)chr)) {	/* Get DBC 2nd byte if needed */
-		chr = dbc_2nd((BYTE)**ptr) ? chr << 8 | (BYTE)*(*ptr)++ : 0;
 	}
-#endif
+	return 0;
+}
 
+
+static int pc_find (	/* 1:Found and opened the sub-directory, 0:Not cached */
+	DIR* dp				/* Directory object with the segment name */
+)
+{
+	PATHCACHE *pc;
+
+
+	pc = pc_search(dp);
+	if (!pc) return 0;
+	pc->age = ++PcAge;
+#if FF_FS_EXFAT
+	if (dp->obj.fs->fs_type == FS_EXFAT) {	/* Save containing directory information for next dir */
+		dp->obj.c_scl = dp->obj.sclust;
+		dp->obj.c_size = ((DWORD)dp->obj.objsize & 0xFFFFFF00) | dp->obj.stat;
+		dp->obj.c_ofs = pc->ofs;
+		dp->obj.objsize = pc->size;
+		dp->obj.stat = pc->stat;
+		dp->obj.n_frag = 0;
+	}
 #endif
-	return chr;
+	dp->obj.sclust = pc->clu;	/* Open next directory */
+	dp->obj.attr = AM_DIR;
+	return 1;
 }
 
 
-static int pattern_match (	/* 0:mismatched, 1:matched */
-	const TCHAR* pat,	/* Matching pattern */
-	const TCHAR* nam,	/* String to be tested */
-	UINT skip,			/* Number of pre-skip chars (number of ?s, b8:infinite (* specified)) */
-	UINT recur			/* Recursion count */
+static void pc_store (
+	DIR* dp,			/* Directory object opened the sub-directory */
+	DWORD pclu,			/* Start cluster of the parent directory */
+	DWORD ofs			/* Offset of the entry in the parent directory */
 )
 {
-	const TCHAR *pptr, *nptr;
-	DWORD pchr, nchr;
-	UINT sk;
+	FATFS *fs = dp->obj.fs;
+	PATHCACHE *pc;
+	UINT i;
 
 
-	while ((skip & 0xFF) != 0) {		/* Pre-skip name chars */
-		if (!get_achar(&nam)) return 0;	/* Branch mismatched if less name chars */
-		skip--;
+#if FF_USE_LFN
+	for (i = 0; fs->lfnbuf[i]; i++) {	/* Check length of the name */
+		if (i >= PCACHE_NAME) return;
 	}
-	if (*pat == 0 && skip) return 1;	/* Matched? (short circuit) */
-
-	do {
-		pptr = pat; nptr = nam;			/* Top of pattern and name to match */
-		for (;;) {
-			if (*pptr == '?' || *pptr == '*') {	/* Wildcard term? */
-				if (recur == 0) return 0;	/* Too many wildcard terms? */
-				sk = 0;
-				do {	/* Analyze the wildcard term */
-					if (*pptr++ == '?') sk++; else sk |= 0x100;
-				} while (*pptr == '?' || *pptr == '*');
-				if (pattern_match(pptr, nptr, sk, recur - 1)) return 1;	/* Test new branch (recursive call) */
-				nchr = *nptr; break;	/* Branch mismatched */
-			}
-			pchr = get_achar(&pptr);	/* Get a pattern char */
-			nchr = get_achar(&nptr);	/* Get a name char */
-			if (pchr != nchr) break;	/* Branch mismatched? */
-			if (pchr == 0) return 1;	/* Branch matched? (matched at end of both strings) */
-		}
-		get_achar(&nam);			/* nam++ */
-	} while (skip && nchr);		/* Retry until end of name if infinite search is specified */
-
-	return 0;
-}
-
-#endif /* FF_USE_FIND && FF_FS_MINIMIZE <= 1 */
-
+#endif
+	pc = &PathCache[0];
+	for (i = 1; i < FF_PATH_CACHE && pc->fs; i++) {	/* Find a blank entry or the least recently used entry */
+		if (!PathCache[i].fs || PathCache[i].age - pc->age > 0x80000000) pc = &PathCache[i];
+	}
+#if FF_USE_LFN
+	for (i = 0; fs->lfnbuf[i]; i++) pc->name[i] = (WCHAR)ff_wtoupper(fs->lfnbuf[i]);
+	pc->name[i] = 0;
+#else
+	memcpy(pc->name, dp->fn, 11);
+#endif
+	pc->fs = fs;
+	pc->id = fs->id;
+	pc->age = ++PcAge;
+	pc->pclu = pclu;
+	pc->ofs = ofs;
+	pc->clu = dp->obj.sclust;
+#if FF_FS_EXFAT
+	pc->size = (DWORD)dp->obj.objsize;
+	pc->stat = dp->obj.stat;
+#endif
+}
 
 
-/*-----------------------------------------------------------------------*/
-/* Pick a top segment and create the object name in directory form       */
-/*-----------------------------------------------------------------------*/
-
-static FRESULT create_name (	/* FR_OK: successful, FR_INVALID_NAME: could not create */
-	DIR* dp,					/* Pointer to the directory object */
-	const TCHAR** path			/* Pointer to pointer to the segment in the path string */
+#if !FF_FS_READONLY && FF_FS_EXFAT
+static void pc_resize (
+	FFOBJID* obj		/* Sub-directory object stretched */
 )
 {
-#if FF_USE_LFN		/* LFN configuration */
-	BYTE b, cf;
-	WCHAR wc, *lfn;
-	DWORD uc;
-	UINT i, ni, si, di;
-	const TCHAR *p;
-
+	UINT i;
 
-	/* Create LFN into LFN working buffer */
-	p = *path; lfn = dp->obj.fs->lfnbuf; di = 0;
-	for (;;) {
-		uc = tchar2uni(&p);			/* Get a character */
-		if (uc == 0xFFFFFFFF) return FR_INVALID_NAME;		/* Invalid code or UTF decode error */
-		if (uc >= 0x10000) lfn[di++] = (WCHAR)(uc >> 16);	/* Store high surrogate if needed */
-		wc = (WCHAR)uc;
-		if (wc < ' ' || IsSeparator(wc)) break;	/* Break if end of the path or a separator is found */
-		if (wc < 0x80 && strchr("*:<>|\"\?\x7F", (int)wc)) return FR_INVALID_NAME;	/* Reject illegal characters for LFN */
-		if (di >= FF_MAX_LFN) return FR_INVALID_NAME;	/* Reject too long name */
-		lfn[di++] = wc;				/* Store the Unicode character */
-	}
-	if (wc < ' ') {				/* Stopped at end of the path? */
-		cf = NS_LAST;			/* Last segment */
-	} else {					/* Stopped at a separator */
-		while (IsSeparator(*p)) p++;	/* Skip duplicated separators if exist */
-		cf = 0;					/* Next segment may follow */
-		if (IsTerminator(*p)) cf = NS_LAST;	/* Ignore terminating separator */
-	}
-	*path = p;					/* Return pointer to the next segment */
 
-#if FF_FS_RPATH != 0
-	if ((di == 1 && lfn[di - 1] == '.') ||
-		(di == 2 && lfn[di - 1] == '.' && lfn[di - 2] == '.')) {	/* Is this segment a dot name? */
-		lfn[di] = 0;
-		for (i = 0; i < 11; i++) {	/* Create dot name for SFN entry */
-			dp->fn[i] = (i < di) ? '.' : ' ';
+	for (i = 0; i < FF_PATH_CACHE; i++) {	/* Update size and allocation status of the sub-directory */
+		if (PathCache[i].fs == obj->fs && PathCache[i].clu == obj->sclust) {
+			PathCache[i].size = (DWORD)obj->objsize;
+			PathCache[i].stat = obj->stat;
 		}
-		dp->fn[i] = cf | NS_DOT;	/* This is a dot entry */
-		return FR_OK;
 	}
+}
 #endif
-	while (di) {					/* Snip off trailing spaces and dots if exist */
-		wc = lfn[di - 1];
-		if (wc != ' ' && wc != '.') break;
-		di--;
-	}
-	lfn[di] = 0;							/* LFN is created into the working buffer */
-	if (di == 0) return FR_INVALID_NAME;	/* Reject null name */
-
-	/* Create SFN in directory form */
-	for (si = 0; lfn[si] == ' '; si++) ;	/* Remove leading spaces */
-	if (si > 0 || lfn[si] == '.') cf |= NS_LOSS | NS_LFN;	/* Is there any leading space or dot? */
-	while (di > 0 && lfn[di - 1] != '.') di--;	/* Find last dot (di<=si: no extension) */
 
-	memset(dp->fn, ' ', 11);
-	i = b = 0; ni = 8;
-	for (;;) {
-		wc = lfn[si++];					/* Get an LFN character */
-		if (wc == 0) break;				/* Break on end of the LFN */
-		if (wc == ' ' || (wc == '.' && si != di)) {	/* Remove embedded spaces and dots */
-			cf |= NS_LOSS | NS_LFN;
-			continue;
-		}
 
-		if (i >= ni || si == di) {		/* End of field? */
-			if (ni == 11) {				/* Name extension overflow? */
-				cf |= NS_LOSS | NS_LFN;
-				break;
-			}
-			if (si != di) cf |= NS_LOSS | NS_LFN;	/* Name body overflow? */
-			if (si > di) break;						/* No name extension? */
-			si = di; i = 8; ni = 11; b <<= 2;		/* Enter name extension */
-			continue;
-		}
+#if !FF_FS_READONLY && FF_FS_MINIMIZE == 0
+static void pc_remove (
+	DIR* dp,			/* Directory object containing the removed entry */
+	DWORD ofs,			/* Offset of the first entry of the removed object */
+	DWORD last			/* Offset of the last entry of the removed object */
+)
+{
+	DWORD pclu = dir_clust(&dp->obj);
+	UINT i;
 
-		if (wc >= 0x80) {	/* Is this an extended character? */
-			cf |= NS_LFN;	/* LFN entry needs to be created */
-#if FF_CODE_PAGE == 0
-			if (ExCvt) {	/* In SBCS cfg */
-				wc = ff_uni2oem(wc, CODEPAGE);			/* Unicode ==> ANSI/OEM code */
-				if (wc & 0x80) wc = ExCvt[wc & 0x7F];	/* Convert extended character to upper (SBCS) */
-			} else {		/* In DBCS cfg */
-				wc = ff_uni2oem(ff_wtoupper(wc), CODEPAGE);	/* Unicode ==> Up-convert ==> ANSI/OEM code */
-			}
-#elif FF_CODE_PAGE < 900	/* In SBCS cfg */
-			wc = ff_uni2oem(wc, CODEPAGE);			/* Unicode ==> ANSI/OEM code */
-			if (wc & 0x80) wc = ExCvt[wc & 0x7F];	/* Convert extended character to upper (SBCS) */
-#else						/* In DBCS cfg */
-			wc = ff_uni2oem(ff_wtoupper(wc), CODEPAGE);	/* Unicode ==> Up-convert ==> ANSI/OEM code */
-#endif
-		}
 
-		if (wc >= 0x100) {				/* Is this a DBC? */
-			if (i >= ni - 1) {			/* Field overflow? */
-				cf |= NS_LOSS | NS_LFN;
-				i = ni; continue;		/* Next field */
-			}
-			dp->fn[i++] = (BYTE)(wc >> 8);	/* Put 1st byte */
-		} else {						/* SBC */
-			if (wc == 0 || strchr("+,;=[]", (int)wc)) {	/* Replace illegal characters for SFN */
-				wc = '_'; cf |= NS_LOSS | NS_LFN;/* Lossy conversion */
-			} else {
-				if (IsUpper(wc)) {		/* ASCII upper case? */
-					b |= 2;
-				}
-				if (IsLower(wc)) {		/* ASCII lower case? */
-					b |= 1; wc -= 0x20;
-				}
-			}
+	for (i = 0; i < FF_PATH_CACHE; i++) {	/* Forget the sub-directory at the entry */
+		if (PathCache[i].fs == dp->obj.fs && PathCache[i].pclu == pclu && PathCache[i].ofs >= ofs && PathCache[i].ofs <= last) {
+			PathCache[i].fs = 0;
 		}
-		dp->fn[i++] = (BYTE)wc;
 	}
+}
+#endif
 
-	if (dp->fn[0] == DDEM) dp->fn[0] = RDDEM;	/* If the first character collides with DDEM, replace it with RDDEM */
+#endif	/* FF_PATH_CACHE != 0 */
 
-	if (ni == 8) b <<= 2;				/* Shift capital flags if no extension */
-	if ((b & 0x0C) == 0x0C || (b & 0x03) == 0x03) cf |= NS_LFN;	/* LFN entry needs to be created if composite capitals */
-	if (!(cf & NS_LFN)) {				/* When LFN is in 8.3 format without extended character, NT flags are created */
-		if (b & 0x01) cf |= NS_EXT;		/* NT flag (Extension has small capital letters only) */
-		if (b & 0x04) cf |= NS_BODY;	/* NT flag (Body has small capital letters only) */
-	}
 
-	dp->fn[NSFLAG] = cf;	/* SFN is created into dp->fn[] */
 
-	return FR_OK;
 
+/*-----------------------------------------------------------------------*/
+/* Directory handling - Find an object in the directory                  */
+/*-----------------------------------------------------------------------*/
 
-#else	/* FF_USE_LFN : Non-LFN configuration */
-	BYTE c, d, *sfn;
-	UINT ni, si, i;
-	const char *p;
+static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
+	DIR* dp					/* Pointer to the directory object with the file name */
+)
+{
+	FRESULT res;
+#if FF_FS_EXFAT || FF_DIR_INDEX != 0
+	FATFS *fs = dp->obj.fs;
+#endif
+#if FF_DIR_INDEX != 0
+	DIRIDX *di;
+#endif
 
-	/* Create file name in directory form */
-	p = *path; sfn = dp->fn;
-	memset(sfn, ' ', 11);
-	si = i = 0; ni = 8;
-#if FF_FS_RPATH != 0
-	if (p[si] == '.') { /* Is this a dot entry? */
-		for (;;) {
-			c = (BYTE)p[si++];
-			if (c != '.' || si >= 3) break;
-			sfn[i++] = c;
+	res = dir_sdi(dp, 0);			/* Rewind directory object */
+	if (res != FR_OK) return res;
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+		BYTE nc;
+		UINT di, ni;
+		WORD hash = xname_sum(fs->lfnbuf);		/* Hash value of the name to find */
+
+		while ((res = DIR_READ_FILE(dp)) == FR_OK) {	/* Read an item */
+#if FF_MAX_LFN < 255
+			if (fs->dirbuf[XDIR_NumName] > FF_MAX_LFN) continue;		/* Skip comparison if inaccessible object name */
+#endif
+			if (ld_word(fs->dirbuf + XDIR_NameHash) != hash) continue;	/* Skip comparison if hash mismatched */
+			for (nc = fs->dirbuf[XDIR_NumName], di = SZDIRE * 2, ni = 0; nc; nc--, di += 2, ni++) {	/* Compare the name */
+				if ((di % SZDIRE) == 0) di += 2;
+				if (ff_wtoupper(ld_word(fs->dirbuf + di)) != ff_wtoupper(fs->lfnbuf[ni])) break;
+			}
+			if (nc == 0 && !fs->lfnbuf[ni]) break;	/* Name matched? */
 		}
-		if (!IsSeparator(c) && c > ' ') return FR_INVALID_NAME;
-		*path = p + si;					/* Return pointer to the next segment */
-		sfn[NSFLAG] = (c <= ' ') ? NS_LAST | NS_DOT : NS_DOT;	/* Set last segment flag if end of the path */
-		return FR_OK;
+		return res;
 	}
 #endif
-	for (;;) {
-		c = (BYTE)p[si++];				/* Get a byte */
-		if (c <= ' ') break; 			/* Break if end of the path name */
-		if (IsSeparator(c)) {			/* Break if a separator is found */
-			while (IsSeparator(p[si])) si++;	/* Skip duplicated separator if exist */
-			break;
-		}
-		if (c == '.' || i >= ni) {		/* End of body or field overflow? */
-			if (ni == 11 || c != '.') return FR_INVALID_NAME;	/* Field overflow or invalid dot? */
-			i = 8; ni = 11;				/* Enter file extension field */
-			continue;
-		}
-#if FF_CODE_PAGE == 0
-		if (ExCvt && c >= 0x80) {		/* Is SBC extended character? */
-			c = ExCvt[c & 0x7F];		/* To upper SBC extended character */
-		}
-#elif FF_CODE_PAGE < 900
-		if (c >= 0x80) {				/* Is SBC extended character? */
-			c = ExCvt[c & 0x7F];		/* To upper SBC extended character */
-		}
+	/* On the FAT/FAT32 volume */
+#if FF_DIR_INDEX != 0
+	di = idx_get(fs, dir_clust(&dp->obj));
+	if (di) {						/* Is the directory indexed? */
+		if (di->valid) return idx_find(di, dp);
+		return dir_scan(dp, 0);		/* Too many names to be indexed */
+	}
 #endif
-		if (dbc_1st(c)) {				/* Check if it is a DBC 1st byte */
-			d = (BYTE)p[si++];			/* Get 2nd byte */
-			if (!dbc_2nd(d) || i >= ni - 1) return FR_INVALID_NAME;	/* Reject invalid DBC */
-			sfn[i++] = c;
-			sfn[i++] = d;
-		} else {						/* SBC */
-			if (strchr("*+,:;<=>[]|\"\?\x7F", (int)c)) return FR_INVALID_NAME;	/* Reject illegal chrs for SFN */
-			if (IsLower(c)) c -= 0x20;	/* To upper */
-			sfn[i++] = c;
-		}
+	res = dir_scan(dp, 0);			/* Search the table from top */
+#if FF_DIR_INDEX != 0
+	if ((res == FR_OK || res == FR_NO_FILE) && dp->dptr / SZDIRE >= DIRIDX_MIN) {	/* Large directory? */
+		idx_build(dp);				/* Create the index of the directory for following lookups */
+		if (res == FR_OK && move_window(fs, dp->sect) != FR_OK) res = FR_DISK_ERR;	/* Reload the found entry */
 	}
-	*path = &p[si];						/* Return pointer to the next segment */
-	if (i == 0) return FR_INVALID_NAME;	/* Reject nul string */
-
-	if (sfn[0] == DDEM) sfn[0] = RDDEM;	/* If the first character collides with DDEM, replace it with RDDEM */
-	sfn[NSFLAG] = (c <= ' ' || p[si] <= ' ') ? NS_LAST : 0;	/* Set last segment flag if end of the path */
+#endif
 
-	return FR_OK;
-#endif /* FF_USE_LFN */
+	return res;
 }
 
 
 
 
+#if FF_USE_LFN && !FF_FS_READONLY && FF_SFN_TAIL != 0
 /*-----------------------------------------------------------------------*/
-/* Follow a file path                                                    */
+/* FAT-LFN: Find a free numbered SFN in a single directory scan          */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT follow_path (	/* FR_OK(0): successful, !=0: error code */
-	DIR* dp,					/* Directory object to return last directory and found object */
-	const TCHAR* path			/* Full-path string to find a file or directory */
+static FRESULT dir_numname (	/* FR_OK:succeeded, FR_DENIED:too many collisions, FR_DISK_ERR:disk error */
+	DIR* dp,					/* Directory object to be scanned (dp->fn receives the numbered SFN) */
+	const BYTE* sn				/* SFN in directory form to be numbered */
 )
 {
 	FRESULT res;
-	BYTE ns;
 	FATFS *fs = dp->obj.fs;
+	WORD num[100];		/* Number put in the tail of each sequence */
+	BYTE used[13];		/* Bitmap of the sequences in use */
+	BYTE nsfn[11], *dir, c;
+	UINT seq, i;
+	DWORD n;
+#if FF_DIR_INDEX != 0
+	DIRIDX *di;
+#endif
 
 
-#if FF_FS_RPATH != 0
-	if (!IsSeparator(*path) && (FF_STR_VOLUME_ID != 2 || !IsTerminator(*path))) {	/* Without heading separator */
-		dp->obj.sclust = fs->cdir;			/* Start at the current directory */
-	} else
-#endif
-	{										/* With heading separator */
-		while (IsSeparator(*path)) path++;	/* Strip separators */
-		dp->obj.sclust = 0;					/* Start from the root directory */
+	for (seq = (FF_SFN_TAIL == 2) ? 6 : 1; seq < 100; seq++) {	/* Numbers to be tried */
+		num[seq] = (WORD)((seq > 5) ? hash_numname(fs->lfnbuf, seq) : seq);
 	}
-#if FF_FS_EXFAT
-	dp->obj.n_frag = 0;	/* Invalidate last fragment counter of the object */
-#if FF_FS_RPATH != 0
-	if (fs->fs_type == FS_EXFAT && dp->obj.sclust) {	/* exFAT: Retrieve the sub-directory's status */
-		DIR dj;
-
-		dp->obj.c_scl = fs->cdc_scl;
-		dp->obj.c_size = fs->cdc_size;
-		dp->obj.c_ofs = fs->cdc_ofs;
-		res = load_obj_xdir(&dj, &dp->obj);
-		if (res != FR_OK) return res;
-		dp->obj.objsize = ld_dword(fs->dirbuf + XDIR_FileSize);
-		dp->obj.stat = fs->dirbuf[XDIR_GenFlags] & 2;
+#if FF_DIR_INDEX != 0
+	di = idx_get(fs, dir_clust(&dp->obj));
+	if (di && di->valid) {	/* Check the SFNs with the directory index instead of scan */
+		for (seq = (FF_SFN_TAIL == 2) ? 6 : 1; seq < 100; seq++) {
+			gen_numname(dp->fn, sn, fs->lfnbuf, seq);
+			dp->fn[NSFLAG] = NS_NOLFN;		/* Find only SFN */
+			res = idx_find(di, dp);
+			dp->fn[NSFLAG] = sn[NSFLAG];
+			if (res != FR_OK) return (res == FR_NO_FILE) ? FR_OK : res;
+		}
+		return FR_DENIED;
 	}
 #endif
-#endif
-
-	if ((UINT)*path < ' ') {				/* Null path name is the origin directory itself */
-		dp->fn[NSFLAG] = NS_NONAME;
-		res = dir_sdi(dp, 0);
+	memset(used, 0, sizeof used);
 
-	} else {								/* Follow path */
-		for (;;) {
-			res = create_name(dp, &path);	/* Get a segment name of the path */
-			if (res != FR_OK) break;
-			res = dir_find(dp);				/* Find an object with the segment name */
-			ns = dp->fn[NSFLAG];
-			if (res != FR_OK) {				/* Failed to find the object */
-				if (res == FR_NO_FILE) {	/* Object is not found */
-					if (FF_FS_RPATH && (ns & NS_DOT)) {	/* If dot entry is not exist, stay there */
-						if (!(ns & NS_LAST)) continue;	/* Continue to follow if not last segment */
-						dp->fn[NSFLAG] = NS_NONAME;
-						res = FR_OK;
-					} else {							/* Could not find the object */
-						if (!(ns & NS_LAST)) res = FR_NO_PATH;	/* Adjust error code if not last segment */
-					}
+	res = dir_sdi(dp, 0);
+	while (res == FR_OK) {	/* Scan the directory for the numbered SFNs in use */
+		res = MOVE_DIRWIN(fs, dp);
+		if (res != FR_OK) break;
+		dir = dp->dir;
+		if (dir[DIR_Name] == 0) break;	/* Reached to end of the table */
+		if (dir[DIR_Name] != DDEM && !(dir[DIR_Attr] & AM_VOL) && !memcmp(dir + 8, sn + 8, 3)) {	/* An SFN with the same extension */
+			for (i = 7; i > 0 && dir[i] == ' '; i--) ;	/* Get the numeric tail (~ + hexdecimal) */
+			for (n = 0, c = 0; i > 0 && dir[i] != '~'; i--, c += 4) {
+				if (IsDigit(dir[i])) {
+					n |= (DWORD)(dir[i] - '0') << c;
+				} else if (dir[i] >= 'A' && dir[i] <= 'F') {
+					n |= (DWORD)(dir[i] - 'A' + 10) << c;
+				} else {
+					break;
 				}
-				break;
-			}
-			if (ns & NS_LAST) break;		/* Last segment matched. Function completed. */
-			/* Get into the sub-directory */
-			if (!(dp->obj.attr & AM_DIR)) {	/* It is not a sub-directory and cannot follow */
-				res = FR_NO_PATH; break;
 			}
-#if FF_FS_EXFAT
-			if (fs->fs_type == FS_EXFAT) {	/* Save containing directory information for next dir */
-				dp->obj.c_scl = dp->obj.sclust;
-				dp->obj.c_size = ((DWORD)dp->obj.objsize & 0xFFFFFF00) | dp->obj.stat;
-				dp->obj.c_ofs = dp->blk_ofs;
-				init_alloc_info(fs, &dp->obj);	/* Open next directory */
-			} else
-#endif
-			{
-				dp->obj.sclust = ld_clust(fs, fs->win + dp->dptr % SS(fs));	/* Open next directory */
+			if (i > 0 && dir[i] == '~' && c > 0 && c <= 16) {
+				for (seq = (FF_SFN_TAIL == 2) ? 6 : 1; seq < 100; seq++) {	/* Check the sequences which generate the number */
+					if (num[seq] != n || (used[seq / 8] & (1 << seq % 8))) continue;
+					gen_numname(nsfn, sn, fs->lfnbuf, seq);
+					if (!memcmp(nsfn, dir, 11)) used[seq / 8] |= 1 << seq % 8;	/* The SFN is in use */
+				}
 			}
 		}
+		res = dir_next(dp, 0);
 	}
+	if (res != FR_OK && res != FR_NO_FILE) return res;
 
-	return res;
+	for (seq = (FF_SFN_TAIL == 2) ? 6 : 1; seq < 100 && (used[seq / 8] & (1 << seq % 8)); seq++) ;	/* Find a free sequence */
+	if (seq == 100) return FR_DENIED;	/* Too many collisions */
+	gen_numname(dp->fn, sn, fs->lfnbuf, seq);
+	return FR_OK;
 }
 
+#endif	/* FF_USE_LFN && !FF_FS_READONLY && FF_SFN_TAIL != 0 */
+
 
 
 
+#if !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* Get logical drive number from path name                               */
+/* Register an object to the directory                                   */
 /*-----------------------------------------------------------------------*/
 
-static int get_ldnumber (	/* Returns logical drive number (-1:invalid drive number or null pointer) */
-	const TCHAR** path		/* Pointer to pointer to the path name */
+static FRESULT dir_register (	/* FR_OK:succeeded, FR_DENIED:no free entry or too many SFN collision, FR_DISK_ERR:disk error */
+	DIR* dp						/* Target directory with object name to be created */
 )
 {
-	const TCHAR *tp, *tt;
-	TCHAR tc;
-	int i;
-	int vol = -1;
-#if FF_STR_VOLUME_ID		/* Find string volume ID */
-	const char *sp;
-	char c;
+	FRESULT res;
+	FATFS *fs = dp->obj.fs;
+#if FF_USE_LFN		/* LFN configuration */
+	UINT len, n_ent;
+	BYTE sn[12], sum;
+#if FF_SFN_TAIL == 0
+	UINT n;
 #endif
 
-	tt = tp = *path;
-	if (!tp) return vol;	/* Invalid path name? */
-	do tc = *tt++; while (!IsTerminator(tc) && tc != ':');	/* Find a colon in the path */
 
-	if (tc == ':') {	/* DOS/Windows style volume ID? */
-		i = FF_VOLUMES;
-		if (IsDigit(*tp) && tp + 2 == tt) {	/* Is there a numeric volume ID + colon? */
-			i = (int)*tp - '0';	/* Get the LD number */
-		}
-#if FF_STR_VOLUME_ID == 1	/* Arbitrary string is enabled */
-		else {
-			i = 0;
-			do {
-				sp = VolumeStr[i]; tp = *path;	/* This string volume ID and path name */
-				do {	/* Compare the volume ID with path name */
-					c = *sp++; tc = *tp++;
-					if (IsLower(c)) c -= 0x20;
-					if (IsLower(tc)) tc -= 0x20;
-				} while (c && (TCHAR)c == tc);
-			} while ((c || tp != tt) && ++i < FF_VOLUMES);	/* Repeat for each id until pattern match */
+	if (dp->fn[NSFLAG] & (NS_DOT | NS_NONAME)) return FR_INVALID_NAME;	/* Check name validity */
+	for (len = 0; fs->lfnbuf[len]; len++) ;	/* Get lfn length */
+
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+		n_ent = (len + 14) / 15 + 2;	/* Number of entries to allocate (85+C0+C1s) */
+		res = dir_alloc(dp, n_ent);		/* Allocate directory entries */
+		if (res != FR_OK) return res;
+		dp->blk_ofs = dp->dptr - SZDIRE * (n_ent - 1);	/* Set the allocated entry block offset */
+
+		if (dp->obj.stat & 4) {			/* Has the directory been stretched by new allocation? */
+			dp->obj.stat &= ~4;
+			res = fill_first_frag(&dp->obj);	/* Fill the first fragment on the FAT if needed */
+			if (res != FR_OK) return res;
+			res = fill_last_frag(&dp->obj, dp->clust, 0xFFFFFFFF);	/* Fill the last fragment on the FAT if needed */
+			if (res != FR_OK) return res;
+			if (dp->obj.sclust != 0) {		/* Is it a sub-directory? */
+				DIR dj;
+
+				res = load_obj_xdir(&dj, &dp->obj);	/* Load the object status */
+				if (res != FR_OK) return res;
+				dp->obj.objsize += (DWORD)fs->csize * SS(fs);		/* Increase the directory size by cluster size */
+				st_qword(fs->dirbuf + XDIR_FileSize, dp->obj.objsize);
+				st_qword(fs->dirbuf + XDIR_ValidFileSize, dp->obj.objsize);
+				fs->dirbuf[XDIR_GenFlags] = dp->obj.stat | 1;		/* Update the allocation status */
+				res = store_xdir(&dj);				/* Store the object status */
+				if (res != FR_OK) return res;
+#if FF_PATH_CACHE != 0
+				pc_resize(&dp->obj);				/* Update the directory status in the path cache */
+#endif
+			}
 		}
+
+		create_xdir(fs->dirbuf, fs->lfnbuf);	/* Create on-memory directory block to be written later */
+		return FR_OK;
+	}
 #endif
-		if (i < FF_VOLUMES) {	/* If a volume ID is found, get the drive number and strip it */
-			vol = i;		/* Drive number */
-			*path = tt;		/* Snip the drive prefix off */
+	/* On the FAT/FAT32 volume */
+	memcpy(sn, dp->fn, 12);
+	if (sn[NSFLAG] & NS_LOSS) {			/* When LFN is out of 8.3 format, generate a numbered name */
+#if FF_SFN_TAIL != 0
+		res = dir_numname(dp, sn);		/* Pick a free numbered name in a single directory scan */
+		if (res != FR_OK) return res;
+#else
+		dp->fn[NSFLAG] = NS_NOLFN;		/* Find only SFN */
+		for (n = 1; n < 100; n++) {
+			gen_numname(dp->fn, sn, fs->lfnbuf, n);	/* Generate a numbered name */
+			res = dir_find(dp);				/* Check if the name collides with existing SFN */
+			if (res != FR_OK) break;
 		}
-		return vol;
+		if (n == 100) return FR_DENIED;		/* Abort if too many collisions */
+		if (res != FR_NO_FILE) return res;	/* Abort if the result is other than 'not collided' */
+		dp->fn[NSFLAG] = sn[NSFLAG];
+#endif
 	}
-#if FF_STR_VOLUME_ID == 2		/* Unix style volume ID is enabled */
-	if (*tp == '/') {			/* Is there a volume ID? */
-		while (*(tp + 1) == '/') tp++;	/* Skip duplicated separator */
-		i = 0;
-		do {
-			tt = tp; sp = VolumeStr[i]; /* Path name and this string volume ID */
-			do {	/* Compare the volume ID with path name */
-				c = *sp++; tc = *(++tt);
-				if (IsLower(c)) c -= 0x20;
-				if (IsLower(tc)) tc -= 0x20;
-			} while (c && (TCHAR)c == tc);
-		} while ((c || (tc != '/' && !IsTerminator(tc))) && ++i < FF_VOLUMES);	/* Repeat for each ID until pattern match */
-		if (i < FF_VOLUMES) {	/* If a volume ID is found, get the drive number and strip it */
-			vol = i;		/* Drive number */
-			*path = tt;		/* Snip the drive prefix off */
+
+	/* Create an SFN with/without LFNs. */
+	n_ent = (sn[NSFLAG] & NS_LFN) ? (len + 12) / 13 + 1 : 1;	/* Number of entries to allocate */
+	res = dir_alloc(dp, n_ent);		/* Allocate entries */
+	if (res == FR_OK && --n_ent) {	/* Set LFN entry if needed */
+		res = dir_sdi(dp, dp->dptr - n_ent * SZDIRE);
+		if (res == FR_OK) {
+			sum = sum_sfn(dp->fn);	/* Checksum value of the SFN tied to the LFN */
+			do {					/* Store LFN entries in bottom first */
+				res = move_window(fs, dp->sect);
+				if (res != FR_OK) break;
+				put_lfn(fs->lfnbuf, dp->dir, (BYTE)n_ent, sum);
+				fs->wflag = 1;
+				res = dir_next(dp, 0);	/* Next entry */
+			} while (res == FR_OK && --n_ent);
 		}
-		return vol;
 	}
+
+#else	/* Non LFN configuration */
+	res = dir_alloc(dp, 1);		/* Allocate an entry for SFN */
+
 #endif
-	/* No drive prefix is found */
-#if FF_FS_RPATH != 0
-	vol = CurrVol;	/* Default drive is current drive */
+
+	/* Set SFN entry */
+	if (res == FR_OK) {
+		res = move_window(fs, dp->sect);
+		if (res == FR_OK) {
+			memset(dp->dir, 0, SZDIRE);	/* Clean the entry */
+			memcpy(dp->dir + DIR_Name, dp->fn, 11);	/* Put SFN */
+#if FF_USE_LFN
+			dp->dir[DIR_NTres] = dp->fn[NSFLAG] & (NS_BODY | NS_EXT);	/* Put NT flag */
+#endif
+			fs->wflag = 1;
+#if FF_DIR_INDEX != 0
+#if FF_USE_LFN
+			idx_add(dp, (sn[NSFLAG] & NS_LFN) ? (len + 12) / 13 : 0);	/* Add the object to the directory index */
 #else
-	vol = 0;		/* Default drive is 0 */
+			idx_add(dp, 0);
 #endif
-	return vol;		/* Return the default drive */
+#endif
+		}
+	}
+
+	return res;
 }
 
+#endif /* !FF_FS_READONLY */
 
 
 
+#if !FF_FS_READONLY && FF_FS_MINIMIZE == 0
 /*-----------------------------------------------------------------------*/
-/* GPT support functions                                                 */
+/* Remove an object from the directory                                   */
 /*-----------------------------------------------------------------------*/
 
-#if FF_LBA64
-
-/* Calculate CRC32 in byte-by-byte */
-
-static DWORD crc32 (	/* Returns next CRC value */
-	DWORD crc,			/* Current CRC value */
-	BYTE d				/* A byte to be processed */
+static FRESULT dir_remove (	/* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
+	DIR* dp					/* Directory object pointing the entry to be removed */
 )
 {
-	BYTE b;
+	FRESULT res;
+	FATFS *fs = dp->obj.fs;
+#if FF_USE_LFN		/* LFN configuration */
+	DWORD last = dp->dptr;
 
+	res = (dp->blk_ofs == 0xFFFFFFFF) ? FR_OK : dir_sdi(dp, dp->blk_ofs);	/* Goto top of the entry block if LFN is exist */
+	if (res == FR_OK) {
+		do {
+			res = move_window(fs, dp->sect);
+			if (res != FR_OK) break;
+			if (FF_FS_EXFAT && fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+				dp->dir[XDIR_Type] &= 0x7F;	/* Clear the entry InUse flag. */
+			} else {										/* On the FAT/FAT32 volume */
+				dp->dir[DIR_Name] = DDEM;	/* Mark the entry 'deleted'. */
+			}
+			fs->wflag = 1;
+			if (dp->dptr >= last) break;	/* If reached last entry then all entries of the object has been deleted. */
+			res = dir_next(dp, 0);	/* Next entry */
+		} while (res == FR_OK);
+		if (res == FR_NO_FILE) res = FR_INT_ERR;
+	}
+#else			/* Non LFN configuration */
 
-	for (b = 1; b; b <<= 1) {
-		crc ^= (d & b) ? 1 : 0;
-		crc = (crc & 1) ? crc >> 1 ^ 0xEDB88320 : crc >> 1;
+	res = move_window(fs, dp->sect);
+	if (res == FR_OK) {
+		dp->dir[DIR_Name] = DDEM;	/* Mark the entry 'deleted'.*/
+		fs->wflag = 1;
 	}
-	return crc;
+#endif
+#if FF_DIR_INDEX != 0
+	if (res == FR_OK && fs->fs_type != FS_EXFAT) idx_remove(dp);	/* Remove the object from the directory index */
+#endif
+#if FF_PATH_CACHE != 0
+#if FF_USE_LFN
+	if (res == FR_OK) pc_remove(dp, (dp->blk_ofs == 0xFFFFFFFF) ? last : dp->blk_ofs, last);	/* Remove the object from the path cache */
+#else
+	if (res == FR_OK) pc_remove(dp, dp->dptr, dp->dptr);
+#endif
+#endif
+
+	return res;
 }
 
+#endif /* !FF_FS_READONLY && FF_FS_MINIMIZE == 0 */
 
-/* Check validity of GPT header */
 
-static int test_gpt_header (	/* 0:Invalid, 1:Valid */
-	const BYTE* gpth			/* Pointer to the GPT header */
-)
-{
-	UINT i;
-	DWORD bcc;
 
+#if FF_FS_MINIMIZE <= 1 || FF_FS_RPATH >= 2
+/*-----------------------------------------------------------------------*/
+/* Get file information from directory entry                             */
+/*-----------------------------------------------------------------------*/
 
-	if (memcmp(gpth + GPTH_Sign, "EFI PART" "\0\0\1\0" "\x5C\0\0", 16)) return 0;	/* Check sign, version (1.0) and length (92) */
-	for (i = 0, bcc = 0xFFFFFFFF; i < 92; i++) {		/* Check header BCC */
-		bcc = crc32(bcc, i - GPTH_Bcc < 4 ? 0 : gpth[i]);
-	}
-	if (~bcc != ld_dword(gpth + GPTH_Bcc)) return 0;
-	if (ld_dword(gpth + GPTH_PteSize) != SZ_GPTE) return 0;	/* Table entry size (must be SZ_GPTE bytes) */
-	if (ld_dword(gpth + GPTH_PtNum) > 128) return 0;	/* Table size (must be 128 entries or less) */
+static void get_fileinfo (
+	DIR* dp,			/* Pointer to the directory object */
+	FILINFO* fno		/* Pointer to the file information to be filled */
+)
+{
+	UINT si, di;
+#if FF_USE_LFN
+	BYTE lcf;
+	WCHAR wc, hs;
+	FATFS *fs = dp->obj.fs;
+	UINT nw;
+#else
+	TCHAR c;
+#endif
 
-	return 1;
-}
 
-#if !FF_FS_READONLY && FF_USE_MKFS
+	fno->fname[0] = 0;			/* Invaidate file info */
+	if (dp->sect == 0) return;	/* Exit if read pointer has reached end of directory */
 
-/* Generate random value */
-static DWORD make_rand (
-	DWORD seed,		/* Seed value */
-	BYTE* buff,		/* Output buffer */
-	UINT n			/* Data length */
-)
-{
-	UINT r;
+#if FF_USE_LFN		/* LFN configuration */
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* exFAT volume */
+		UINT nc = 0;
 
+		si = SZDIRE * 2; di = 0;	/* 1st C1 entry in the entry block */
+		hs = 0;
+		while (nc < fs->dirbuf[XDIR_NumName]) {
+			if (si >= MAXDIRB(FF_MAX_LFN)) { di = 0; break; }	/* Truncated directory block? */
+			if ((si % SZDIRE) == 0) si += 2;		/* Skip entry type field */
+			wc = ld_word(fs->dirbuf + si); si += 2; nc++;	/* Get a character */
+			if (hs == 0 && IsSurrogate(wc)) {		/* Is it a surrogate? */
+				hs = wc; continue;					/* Get low surrogate */
+			}
+			nw = put_utf((DWORD)hs << 16 | wc, &fno->fname[di], FF_LFN_BUF - di);	/* Store it in API encoding */
+			if (nw == 0) { di = 0; break; }			/* Buffer overflow or wrong char? */
+			di += nw;
+			hs = 0;
+		}
+		if (hs != 0) di = 0;					/* Broken surrogate pair? */
+		if (di == 0) fno->fname[di++] = '?';	/* Inaccessible object name? */
+		fno->fname[di] = 0;						/* Terminate the name */
+		fno->altname[0] = 0;					/* exFAT does not support SFN */
 
-	if (seed == 0) seed = 1;
-	do {
-		for (r = 0; r < 8; r++) seed = seed & 1 ? seed >> 1 ^ 0xA3000000 : seed >> 1;	/* Shift 8 bits the 32-bit LFSR */
-		*buff++ = (BYTE)seed;
-	} while (--n);
-	return seed;
-}
+		fno->fattrib = fs->dirbuf[XDIR_Attr] & AM_MASKX;		/* Attribute */
+		fno->fsize = (fno->fattrib & AM_DIR) ? 0 : ld_qword(fs->dirbuf + XDIR_FileSize);	/* Size */
+		fno->ftime = ld_word(fs->dirbuf + XDIR_ModTime + 0);	/* Time */
+		fno->fdate = ld_word(fs->dirbuf + XDIR_ModTime + 2);	/* Date */
+		return;
+	} else
+#endif
+	{	/* FAT/FAT32 volume */
+		if (dp->blk_ofs != 0xFFFFFFFF) {	/* Get LFN if available */
+			si = di = 0;
+			hs = 0;
+			while (fs->lfnbuf[si] != 0) {
+				wc = fs->lfnbuf[si++];		/* Get an LFN character (UTF-16) */
+				if (hs == 0 && IsSurrogate(wc)) {	/* Is it a surrogate? */
+					hs = wc; continue;		/* Get low surrogate */
+				}
+				nw = put_utf((DWORD)hs << 16 | wc, &fno->fname[di], FF_LFN_BUF - di);	/* Store it in API encoding */
+				if (nw == 0) { di = 0; break; }	/* Buffer overflow or wrong char? */
+				di += nw;
+				hs = 0;
+			}
+			if (hs != 0) di = 0;	/* Broken surrogate pair? */
+			fno->fname[di] = 0;		/* Terminate the LFN (null string means LFN is invalid) */
+		}
+	}
 
+	si = di = 0;
+	while (si < 11) {		/* Get SFN from SFN entry */
+		wc = dp->dir[si++];			/* Get a char */
+		if (wc == ' ') continue;	/* Skip padding spaces */
+		if (wc == RDDEM) wc = DDEM;	/* Restore replaced DDEM character */
+		if (si == 9 && di < FF_SFN_BUF) fno->altname[di++] = '.';	/* Insert a . if extension is exist */
+#if FF_LFN_UNICODE >= 1	/* Unicode output */
+		if (dbc_1st((BYTE)wc) && si != 8 && si != 11 && dbc_2nd(dp->dir[si])) {	/* Make a DBC if needed */
+			wc = wc << 8 | dp->dir[si++];
+		}
+		wc = ff_oem2uni(wc, CODEPAGE);		/* ANSI/OEM -> Unicode */
+		if (wc == 0) { di = 0; break; }		/* Wrong char in the current code page? */
+		nw = put_utf(wc, &fno->altname[di], FF_SFN_BUF - di);	/* Store it in API encoding */
+		if (nw == 0) { di = 0; break; }		/* Buffer overflow? */
+		di += nw;
+#else					/* ANSI/OEM output */
+		fno->altname[di++] = (TCHAR)wc;	/* Store it without any conversion */
 #endif
+	}
+	fno->altname[di] = 0;	/* Terminate the SFN  (null string means SFN is invalid) */
+
+	if (fno->fname[0] == 0) {	/* If LFN is invalid, altname[] needs to be copied to fname[] */
+		if (di == 0) {	/* If LFN and SFN both are invalid, this object is inaccesible */
+			fno->fname[di++] = '?';
+		} else {
+			for (si = di = 0, lcf = NS_BODY; fno->altname[si]; si++, di++) {	/* Copy altname[] to fname[] with case information */
+				wc = (WCHAR)fno->altname[si];
+				if (wc == '.') lcf = NS_EXT;
+				if (IsUpper(wc) && (dp->dir[DIR_NTres] & lcf)) wc += 0x20;
+				fno->fname[di] = (TCHAR)wc;
+			}
+		}
+		fno->fname[di] = 0;	/* Terminate the LFN */
+		if (!dp->dir[DIR_NTres]) fno->altname[0] = 0;	/* Altname is not needed if neither LFN nor case info is exist. */
+	}
+
+#else	/* Non-LFN configuration */
+	si = di = 0;
+	while (si < 11) {		/* Copy name body and extension */
+		c = (TCHAR)dp->dir[si++];
+		if (c == ' ') continue;		/* Skip padding spaces */
+		if (c == RDDEM) c = DDEM;	/* Restore replaced DDEM character */
+		if (si == 9) fno->fname[di++] = '.';/* Insert a . if extension is exist */
+		fno->fname[di++] = c;
+	}
+	fno->fname[di] = 0;		/* Terminate the SFN */
 #endif
 
+	fno->fattrib = dp->dir[DIR_Attr] & AM_MASK;			/* Attribute */
+	fno->fsize = ld_dword(dp->dir + DIR_FileSize);		/* Size */
+	fno->ftime = ld_word(dp->dir + DIR_ModTime + 0);	/* Time */
+	fno->fdate = ld_word(dp->dir + DIR_ModTime + 2);	/* Date */
+}
+
+#endif /* FF_FS_MINIMIZE <= 1 || FF_FS_RPATH >= 2 */
+
 
 
+#if (FF_USE_FIND || FF_USE_DIRBATCH) && FF_FS_MINIMIZE <= 1
 /*-----------------------------------------------------------------------*/
-/* Load a sector and check if it is an FAT VBR                           */
+/* Pattern matching                                                      */
 /*-----------------------------------------------------------------------*/
 
-/* Check what the sector is */
+#define FIND_RECURS	4	/* Maximum number of wildcard terms in the pattern to limit recursion */
 
-static UINT check_fs (	/* 0:FAT/FAT32 VBR, 1:exFAT VBR, 2:Not FAT and valid BS, 3:Not FAT and invalid BS, 4:Disk error */
-	FATFS* fs,			/* Filesystem object */
-	LBA_t sect			/* Sector to load and check if it is an FAT-VBR or not */
+
+static DWORD get_achar (	/* Get a character and advance ptr */
+	const TCHAR** ptr		/* Pointer to pointer to the ANSI/OEM or Unicode string */
 )
 {
-	WORD w, sign;
-	BYTE b;
+	DWORD chr;
 
 
-	fs->wflag = 0; fs->winsect = (LBA_t)0 - 1;		/* Invaidate window */
-	if (move_window(fs, sect) != FR_OK) return 4;	/* Load the boot sector */
-	sign = ld_word(fs->win + BS_55AA);
-#if FF_FS_EXFAT
-	if (sign == 0xAA55 && !memcmp(fs->win + BS_JmpBoot, "\xEB\x76\x90" "EXFAT   ", 11)) return 1;	/* It is an exFAT VBR */
+#if FF_USE_LFN && FF_LFN_UNICODE >= 1	/* Unicode input */
+	chr = tchar2uni(ptr);
+	if (chr == 0xFFFFFFFF) chr = 0;		/* Wrong UTF encoding is recognized as end of the string */
+	chr = ff_wtoupper(chr);
+
+#else									/* ANSI/OEM input */
+	chr = (BYTE)*(*ptr)++;				/* Get a byte */
+	if (IsLower(chr)) chr -= 0x20;		/* To upper ASCII char */
+#if FF_CODE_PAGE == 0
+	if (ExCvt && chr >= 0x80) chr = ExCvt[chr - 0x80];	/* To upper SBCS extended char */
+#elif FF_CODE_PAGE < 900
+	if (chr >= 0x80) chr = ExCvt[chr - 0x80];	/* To upper SBCS extended char */
 #endif
-	b = fs->win[BS_JmpBoot];
-	if (b == 0xEB || b == 0xE9 || b == 0xE8) {	/* Valid JumpBoot code? (short jump, near jump or near call) */
-		if (sign == 0xAA55 && !memcmp(fs->win + BS_FilSysType32, "FAT32   ", 8)) {
-			return 0;	/* It is an FAT32 VBR */
-		}
-		/* FAT volumes formatted with early MS-DOS lack BS_55AA and BS_FilSysType, so FAT VBR needs to be identified without them. */
-		w = ld_word(fs->win + BPB_BytsPerSec);
-		b = fs->win[BPB_SecPerClus];
-		if ((w & (w - 1)) == 0 && w >= FF_MIN_SS && w <= FF_MAX_SS	/* Properness of sector size (512-4096 and 2^n) */
-			&& b != 0 && (b & (b - 1)) == 0				/* Properness of cluster size (2^n) */
-			&& ld_word(fs->win + BPB_RsvdSecCnt) != 0	/* Properness of reserved sectors (MNBZ) */
-			&& (UINT)fs->win[BPB_NumFATs] - 1 <= 1		/* Properness of FATs (1 or 2) */
-			&& ld_word(fs->win + BPB_RootEntCnt) != 0	/* Properness of root dir entries (MNBZ) */
-			&& (ld_word(fs->win + BPB_TotSec16) >= 128 || ld_dword(fs->win + BPB_TotSec32) >= 0x10000)	/* Properness of volume sectors (>=128) */
-			&& ld_word(fs->win + BPB_FATSz16) != 0) {	/* Properness of FAT size (MNBZ) */
-				return 0;	/* It can be presumed an FAT VBR */
-		}
+#if FF_CODE_PAGE == 0 || FF_CODE_PAGE >= 900
+	if (dbc_1st((BYTE)chr)) {	/* Get DBC 2nd byte if needed */
+		chr = dbc_2nd((BYTE)**ptr) ? chr << 8 | (BYTE)*(*ptr)++ : 0;
 	}
-	return sign == 0xAA55 ? 2 : 3;	/* Not an FAT VBR (valid or invalid BS) */
-}
+#endif
 
+#endif
+	return chr;
+}
 
-/* Find an FAT volume */
-/* (It supports only generic partitioning rules, MBR, GPT and SFD) */
 
-static UINT find_volume (	/* Returns BS status found in the hosting drive */
-	FATFS* fs,		/* Filesystem object */
-	UINT part		/* Partition to fined = 0:auto, 1..:forced */
+static int pattern_match (	/* 0:mismatched, 1:matched */
+	const TCHAR* pat,	/* Matching pattern */
+	const TCHAR* nam,	/* String to be tested */
+	UINT skip,			/* Number of pre-skip chars (number of ?s, b8:infinite (* specified)) */
+	UINT recur			/* Recursion count */
 )
 {
-	UINT fmt, i;
-	DWORD mbr_pt[4];
+	const TCHAR *pptr, *nptr;
+	DWORD pchr, nchr;
+	UINT sk;
 
 
-	fmt = check_fs(fs, 0);				/* Load sector 0 and check if it is an FAT VBR as SFD format */
-	if (fmt != 2 && (fmt >= 3 || part == 0)) return fmt;	/* Returns if it is an FAT VBR as auto scan, not a BS or disk error */
+	while ((skip & 0xFF) != 0) {		/* Pre-skip name chars */
+		if (!get_achar(&nam)) return 0;	/* Branch mismatched if less name chars */
+		skip--;
+	}
+	if (*pat == 0 && skip) return 1;	/* Matched? (short circuit) */
 
-	/* Sector 0 is not an FAT VBR or forced partition number wants a partition */
+	do {
+		pptr = pat; nptr = nam;			/* Top of pattern and name to match */
+		for (;;) {
+			if (*pptr == '?' || *pptr == '*') {	/* Wildcard term? */
+				if (recur == 0) return 0;	/* Too many wildcard terms? */
+				sk = 0;
+				do {	/* Analyze the wildcard term */
+					if (*pptr++ == '?') sk++; else sk |= 0x100;
+				} while (*pptr == '?' || *pptr == '*');
+				if (pattern_match(pptr, nptr, sk, recur - 1)) return 1;	/* Test new branch (recursive call) */
+				nchr = *nptr; break;	/* Branch mismatched */
+			}
+			pchr = get_achar(&pptr);	/* Get a pattern char */
+			nchr = get_achar(&nptr);	/* Get a name char */
+			if (pchr != nchr) break;	/* Branch mismatched? */
+			if (pchr == 0) return 1;	/* Branch matched? (matched at end of both strings) */
+		}
+		get_achar(&nam);			/* nam++ */
+	} while (skip && nchr);		/* Retry until end of name if infinite search is specified */
 
-#if FF_LBA64
-	if (fs->win[MBR_Table + PTE_System] == 0xEE) {	/* GPT protective MBR? */
-		DWORD n_ent, v_ent, ofs;
-		QWORD pt_lba;
-
-		if (move_window(fs, 1) != FR_OK) return 4;	/* Load GPT header sector (next to MBR) */
-		if (!test_gpt_header(fs->win)) return 3;	/* Check if GPT header is valid */
-		n_ent = ld_dword(fs->win + GPTH_PtNum);		/* Number of entries */
-		pt_lba = ld_qword(fs->win + GPTH_PtOfs);	/* Table location */
-		for (v_ent = i = 0; i < n_ent; i++) {		/* Find FAT partition */
-			if (move_window(fs, pt_lba + i * SZ_GPTE / SS(fs)) != FR_OK) return 4;	/* PT sector */
-			ofs = i * SZ_GPTE % SS(fs);												/* Offset in the sector */
-			if (!memcmp(fs->win + ofs + GPTE_PtGuid, GUID_MS_Basic, 16)) {	/* MS basic data partition? */
-				v_ent++;
-				fmt = check_fs(fs, ld_qword(fs->win + ofs + GPTE_FstLba));	/* Load VBR and check status */
-				if (part == 0 && fmt <= 1) return fmt;			/* Auto search (valid FAT volume found first) */
-				if (part != 0 && v_ent == part) return fmt;		/* Forced partition order (regardless of it is valid or not) */
-			}
-		}
-		return 3;	/* Not found */
-	}
-#endif
-	if (FF_MULTI_PARTITION && part > 4) return 3;	/* MBR has 4 partitions max */
-	for (i = 0; i < 4; i++) {		/* Load partition offset in the MBR */
-		mbr_pt[i] = ld_dword(fs->win + MBR_Table + i * SZ_PTE + PTE_StLba);
-	}
-	i = part ? part - 1 : 0;		/* Table index to find first */
-	do {							/* Find an FAT volume */
-		fmt = mbr_pt[i] ? check_fs(fs, mbr_pt[i]) : 3;	/* Check if the partition is FAT */
-	} while (part == 0 && fmt >= 2 && ++i < 4);
-	return fmt;
-}
+	return 0;
+}
 
+#endif /* (FF_USE_FIND || FF_USE_DIRBATCH) && FF_FS_MINIMIZE <= 1 */
 
 
 
 /*-----------------------------------------------------------------------*/
-/* Determine logical drive number and mount the volume if needed         */
+/* Pick a top segment and create the object name in directory form       */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
-	const TCHAR** path,			/* Pointer to pointer to the path name (drive number) */
-	FATFS** rfs,				/* Pointer to pointer to the found filesystem object */
-	BYTE mode					/* !=0: Check write protection for write access */
+static FRESULT create_name (	/* FR_OK: successful, FR_INVALID_NAME: could not create */
+	DIR* dp,					/* Pointer to the directory object */
+	const TCHAR** path			/* Pointer to pointer to the segment in the path string */
 )
 {
-	int vol;
-	DSTATUS stat;
-	LBA_t bsect;
-	DWORD tsect, sysect, fasize, nclst, szbfat;
-	WORD nrsv;
-	FATFS *fs;
-	UINT fmt;
-
-
-	/* Get logical drive number */
-	*rfs = 0;
-	vol = get_ldnumber(path);
-	if (vol < 0) return FR_INVALID_DRIVE;
+#if FF_USE_LFN		/* LFN configuration */
+	BYTE b, cf;
+	WCHAR wc, *lfn;
+	DWORD uc;
+	UINT i, ni, si, di;
+	const TCHAR *p;
 
-	/* Check if the filesystem object is valid or not */
-	fs = FatFs[vol];					/* Get pointer to the filesystem object */
-	if (!fs) return FR_NOT_ENABLED;		/* Is the filesystem object available? */
-#if FF_FS_REENTRANT
-	if (!lock_fs(fs)) return FR_TIMEOUT;	/* Lock the volume */
-#endif
-	*rfs = fs;							/* Return pointer to the filesystem object */
 
-	mode &= (BYTE)~FA_READ;				/* Desired access mode, write access or not */
-	if (fs->fs_type != 0) {				/* If the volume has been mounted */
-		stat = disk_status(fs->pdrv);
-		if (!(stat & STA_NOINIT)) {		/* and the physical drive is kept initialized */
-			if (!FF_FS_READONLY && mode && (stat & STA_PROTECT)) {	/* Check write protection if needed */
-				return FR_WRITE_PROTECTED;
-			}
-			return FR_OK;				/* The filesystem object is already valid */
-		}
+	/* Create LFN into LFN working buffer */
+	p = *path; lfn = dp->obj.fs->lfnbuf; di = 0;
+	for (;;) {
+		uc = tchar2uni(&p);			/* Get a character */
+		if (uc == 0xFFFFFFFF) return FR_INVALID_NAME;		/* Invalid code or UTF decode error */
+		if (uc >= 0x10000) lfn[di++] = (WCHAR)(uc >> 16);	/* Store high surrogate if needed */
+		wc = (WCHAR)uc;
+		if (wc < ' ' || IsSeparator(wc)) break;	/* Break if end of the path or a separator is found */
+		if (wc < 0x80 && strchr("*:<>|\"\?\x7F", (int)wc)) return FR_INVALID_NAME;	/* Reject illegal characters for LFN */
+		if (di >= FF_MAX_LFN) return FR_INVALID_NAME;	/* Reject too long name */
+		lfn[di++] = wc;				/* Store the Unicode character */
 	}
-
-	/* The filesystem object is not valid. */
-	/* Following code attempts to mount the volume. (find an FAT volume, analyze the BPB and initialize the filesystem object) */
-
-	fs->fs_type = 0;					/* Clear the filesystem object */
-	fs->pdrv = LD2PD(vol);				/* Volume hosting physical drive */
-	stat = disk_initialize(fs->pdrv);	/* Initialize the physical drive */
-	if (stat & STA_NOINIT) { 			/* Check if the initialization succeeded */
-		return FR_NOT_READY;			/* Failed to initialize due to no medium or hard error */
+	if (wc < ' ') {				/* Stopped at end of the path? */
+		cf = NS_LAST;			/* Last segment */
+	} else {					/* Stopped at a separator */
+		while (IsSeparator(*p)) p++;	/* Skip duplicated separators if exist */
+		cf = 0;					/* Next segment may follow */
+		if (IsTerminator(*p)) cf = NS_LAST;	/* Ignore terminating separator */
 	}
-	if (!FF_FS_READONLY && mode && (stat & STA_PROTECT)) { /* Check disk write protection if needed */
-		return FR_WRITE_PROTECTED;
+	*path = p;					/* Return pointer to the next segment */
+
+#if FF_FS_RPATH != 0
+	if ((di == 1 && lfn[di - 1] == '.') ||
+		(di == 2 && lfn[di - 1] == '.' && lfn[di - 2] == '.')) {	/* Is this segment a dot name? */
+		lfn[di] = 0;
+		for (i = 0; i < 11; i++) {	/* Create dot name for SFN entry */
+			dp->fn[i] = (i < di) ? '.' : ' ';
+		}
+		dp->fn[i] = cf | NS_DOT;	/* This is a dot entry */
+		return FR_OK;
 	}
-#if FF_MAX_SS != FF_MIN_SS				/* Get sector size (multiple sector size cfg only) */
-	if (disk_ioctl(fs->pdrv, GET_SECTOR_SIZE, &SS(fs)) != RES_OK) return FR_DISK_ERR;
-	if (SS(fs) > FF_MAX_SS || SS(fs) < FF_MIN_SS || (SS(fs) & (SS(fs) - 1))) return FR_DISK_ERR;
 #endif
+	while (di) {					/* Snip off trailing spaces and dots if exist */
+		wc = lfn[di - 1];
+		if (wc != ' ' && wc != '.') break;
+		di--;
+	}
+	lfn[di] = 0;							/* LFN is created into the working buffer */
+	if (di == 0) return FR_INVALID_NAME;	/* Reject null name */
 
-	/* Find an FAT volume on the drive */
-	fmt = find_volume(fs, LD2PT(vol));
-	if (fmt == 4) return FR_DISK_ERR;		/* An error occured in the disk I/O layer */
-	if (fmt >= 2) return FR_NO_FILESYSTEM;	/* No FAT volume is found */
-	bsect = fs->winsect;					/* Volume offset */
-
-	/* An FAT volume is found (bsect). Following code initializes the filesystem object */
+	/* Create SFN in directory form */
+	for (si = 0; lfn[si] == ' '; si++) ;	/* Remove leading spaces */
+	if (si > 0 || lfn[si] == '.') cf |= NS_LOSS | NS_LFN;	/* Is there any leading space or dot? */
+	while (di > 0 && lfn[di - 1] != '.') di--;	/* Find last dot (di<=si: no extension) */
 
-#if FF_FS_EXFAT
-	if (fmt == 1) {
-		QWORD maxlba;
-		DWORD so, cv, bcl, i;
+	memset(dp->fn, ' ', 11);
+	i = b = 0; ni = 8;
+	for (;;) {
+		wc = lfn[si++];					/* Get an LFN character */
+		if (wc == 0) break;				/* Break on end of the LFN */
+		if (wc == ' ' || (wc == '.' && si != di)) {	/* Remove embedded spaces and dots */
+			cf |= NS_LOSS | NS_LFN;
+			continue;
+		}
 
-		for (i = BPB_ZeroedEx; i < BPB_ZeroedEx + 53 && fs->win[i] == 0; i++) ;	/* Check zero filler */
-		if (i < BPB_ZeroedEx + 53) return FR_NO_FILESYSTEM;
+		if (i >= ni || si == di) {		/* End of field? */
+			if (ni == 11) {				/* Name extension overflow? */
+				cf |= NS_LOSS | NS_LFN;
+				break;
+			}
+			if (si != di) cf |= NS_LOSS | NS_LFN;	/* Name body overflow? */
+			if (si > di) break;						/* No name extension? */
+			si = di; i = 8; ni = 11; b <<= 2;		/* Enter name extension */
+			continue;
+		}
 
-		if (ld_word(fs->win + BPB_FSVerEx) != 0x100) return FR_NO_FILESYSTEM;	/* Check exFAT version (must be version 1.0) */
+		if (wc >= 0x80) {	/* Is this an extended character? */
+			cf |= NS_LFN;	/* LFN entry needs to be created */
+#if FF_CODE_PAGE == 0
+			if (ExCvt) {	/* In SBCS cfg */
+				wc = ff_uni2oem(wc, CODEPAGE);			/* Unicode ==> ANSI/OEM code */
+				if (wc & 0x80) wc = ExCvt[wc & 0x7F];	/* Convert extended character to upper (SBCS) */
+			} else {		/* In DBCS cfg */
+				wc = ff_uni2oem(ff_wtoupper(wc), CODEPAGE);	/* Unicode ==> Up-convert ==> ANSI/OEM code */
+			}
+#elif FF_CODE_PAGE < 900	/* In SBCS cfg */
+			wc = ff_uni2oem(wc, CODEPAGE);			/* Unicode ==> ANSI/OEM code */
+			if (wc & 0x80) wc = ExCvt[wc & 0x7F];	/* Convert extended character to upper (SBCS) */
+#else						/* In DBCS cfg */
+			wc = ff_uni2oem(ff_wtoupper(wc), CODEPAGE);	/* Unicode ==> Up-convert ==> ANSI/OEM code */
+#endif
+		}
 
-		if (1 << fs->win[BPB_BytsPerSecEx] != SS(fs)) {	/* (BPB_BytsPerSecEx must be equal to the physical sector size) */
-			return FR_NO_FILESYSTEM;
+		if (wc >= 0x100) {				/* Is this a DBC? */
+			if (i >= ni - 1) {			/* Field overflow? */
+				cf |= NS_LOSS | NS_LFN;
+				i = ni; continue;		/* Next field */
+			}
+			dp->fn[i++] = (BYTE)(wc >> 8);	/* Put 1st byte */
+		} else {						/* SBC */
+			if (wc == 0 || strchr("+,;=[]", (int)wc)) {	/* Replace illegal characters for SFN */
+				wc = '_'; cf |= NS_LOSS | NS_LFN;/* Lossy conversion */
+			} else {
+				if (IsUpper(wc)) {		/* ASCII upper case? */
+					b |= 2;
+				}
+				if (IsLower(wc)) {		/* ASCII lower case? */
+					b |= 1; wc -= 0x20;
+				}
+			}
 		}
+		dp->fn[i++] = (BYTE)wc;
+	}
 
-		maxlba = ld_qword(fs->win + BPB_TotSecEx) + bsect;	/* Last LBA of the volume + 1 */
-		if (!FF_LBA64 && maxlba >= 0x100000000) return FR_NO_FILESYSTEM;	/* (It cannot be accessed in 32-bit LBA) */
+	if (dp->fn[0] == DDEM) dp->fn[0] = RDDEM;	/* If the first character collides with DDEM, replace it with RDDEM */
 
-		fs->fsize = ld_dword(fs->win + BPB_FatSzEx);	/* Number of sectors per FAT */
+	if (ni == 8) b <<= 2;				/* Shift capital flags if no extension */
+	if ((b & 0x0C) == 0x0C || (b & 0x03) == 0x03) cf |= NS_LFN;	/* LFN entry needs to be created if composite capitals */
+	if (!(cf & NS_LFN)) {				/* When LFN is in 8.3 format without extended character, NT flags are created */
+		if (b & 0x01) cf |= NS_EXT;		/* NT flag (Extension has small capital letters only) */
+		if (b & 0x04) cf |= NS_BODY;	/* NT flag (Body has small capital letters only) */
+	}
 
-		fs->n_fats = fs->win[BPB_NumFATsEx];			/* Number of FATs */
-		if (fs->n_fats != 1) return FR_NO_FILESYSTEM;	/* (Supports only 1 FAT) */
+	dp->fn[NSFLAG] = cf;	/* SFN is created into dp->fn[] */
 
-		fs->csize = 1 << fs->win[BPB_SecPerClusEx];		/* Cluster size */
-		if (fs->csize == 0)	return FR_NO_FILESYSTEM;	/* (Must be 1..32768 sectors) */
+	return FR_OK;
 
-		nclst = ld_dword(fs->win + BPB_NumClusEx);		/* Number of clusters */
-		if (nclst > MAX_EXFAT) return FR_NO_FILESYSTEM;	/* (Too many clusters) */
-		fs->n_fatent = nclst + 2;
 
-		/* Boundaries and Limits */
-		fs->volbase = bsect;
-		fs->database = bsect + ld_dword(fs->win + BPB_DataOfsEx);
-		fs->fatbase = bsect + ld_dword(fs->win + BPB_FatOfsEx);
-		if (maxlba < (QWORD)fs->database + nclst * fs->csize) return FR_NO_FILESYSTEM;	/* (Volume size must not be smaller than the size requiered) */
-		fs->dirbase = ld_dword(fs->win + BPB_RootClusEx);
+#else	/* FF_USE_LFN : Non-LFN configuration */
+	BYTE c, d, *sfn;
+	UINT ni, si, i;
+	const char *p;
 
-		/* Get bitmap location and check if it is contiguous (implementation assumption) */
-		so = i = 0;
-		for (;;) {	/* Find the bitmap entry in the root directory (in only first cluster) */
-			if (i == 0) {
-				if (so >= fs->csize) return FR_NO_FILESYSTEM;	/* Not found? */
-				if (move_window(fs, clst2sect(fs, (DWORD)fs->dirbase) + so) != FR_OK) return FR_DISK_ERR;
-				so++;
-			}
-			if (fs->win[i] == ET_BITMAP) break;			/* Is it a bitmap entry? */
-			i = (i + SZDIRE) % SS(fs);	/* Next entry */
-		}
-		bcl = ld_dword(fs->win + i + 20);				/* Bitmap cluster */
-		if (bcl < 2 || bcl >= fs->n_fatent) return FR_NO_FILESYSTEM;	/* (Wrong cluster#) */
-		fs->bitbase = fs->database + fs->csize * (bcl - 2);	/* Bitmap sector */
-		for (;;) {	/* Check if bitmap is contiguous */
-			if (move_window(fs, fs->fatbase + bcl / (SS(fs) / 4)) != FR_OK) return FR_DISK_ERR;
-			cv = ld_dword(fs->win + bcl % (SS(fs) / 4) * 4);
-			if (cv == 0xFFFFFFFF) break;				/* Last link? */
-			if (cv != ++bcl) return FR_NO_FILESYSTEM;	/* Fragmented? */
+	/* Create file name in directory form */
+	p = *path; sfn = dp->fn;
+	memset(sfn, ' ', 11);
+	si = i = 0; ni = 8;
+#if FF_FS_RPATH != 0
+	if (p[si] == '.') { /* Is this a dot entry? */
+		for (;;) {
+			c = (BYTE)p[si++];
+			if (c != '.' || si >= 3) break;
+			sfn[i++] = c;
 		}
-
-#if !FF_FS_READONLY
-		fs->last_clst = fs->free_clst = 0xFFFFFFFF;		/* Initialize cluster allocation information */
+		if (!IsSeparator(c) && c > ' ') return FR_INVALID_NAME;
+		*path = p + si;					/* Return pointer to the next segment */
+		sfn[NSFLAG] = (c <= ' ') ? NS_LAST | NS_DOT : NS_DOT;	/* Set last segment flag if end of the path */
+		return FR_OK;
+	}
 #endif
-		fmt = FS_EXFAT;			/* FAT sub-type */
-	} else
-#endif	/* FF_FS_EXFAT */
-	{
-		if (ld_word(fs->win + BPB_BytsPerSec) != SS(fs)) return FR_NO_FILESYSTEM;	/* (BPB_BytsPerSec must be equal to the physical sector size) */
-
-		fasize = ld_word(fs->win + BPB_FATSz16);		/* Number of sectors per FAT */
-		if (fasize == 0) fasize = ld_dword(fs->win + BPB_FATSz32);
-		fs->fsize = fasize;
-
-		fs->n_fats = fs->win[BPB_NumFATs];				/* Number of FATs */
-		if (fs->n_fats != 1 && fs->n_fats != 2) return FR_NO_FILESYSTEM;	/* (Must be 1 or 2) */
-		fasize *= fs->n_fats;							/* Number of sectors for FAT area */
-
-		fs->csize = fs->win[BPB_SecPerClus];			/* Cluster size */
-		if (fs->csize == 0 || (fs->csize & (fs->csize - 1))) return FR_NO_FILESYSTEM;	/* (Must be power of 2) */
-
-		fs->n_rootdir = ld_word(fs->win + BPB_RootEntCnt);	/* Number of root directory entries */
-		if (fs->n_rootdir % (SS(fs) / SZDIRE)) return FR_NO_FILESYSTEM;	/* (Must be sector aligned) */
-
-		tsect = ld_word(fs->win + BPB_TotSec16);		/* Number of sectors on the volume */
-		if (tsect == 0) tsect = ld_dword(fs->win + BPB_TotSec32);
-
-		nrsv = ld_word(fs->win + BPB_RsvdSecCnt);		/* Number of reserved sectors */
-		if (nrsv == 0) return FR_NO_FILESYSTEM;			/* (Must not be 0) */
-
-		/* Determine the FAT sub type */
-		sysect = nrsv + fasize + fs->n_rootdir / (SS(fs) / SZDIRE);	/* RSV + FAT + DIR */
-		if (tsect < sysect) return FR_NO_FILESYSTEM;	/* (Invalid volume size) */
-		nclst = (tsect - sysect) / fs->csize;			/* Number of clusters */
-		if (nclst == 0) return FR_NO_FILESYSTEM;		/* (Invalid volume size) */
-		fmt = 0;
-		if (nclst <= MAX_FAT32) fmt = FS_FAT32;
-		if (nclst <= MAX_FAT16) fmt = FS_FAT16;
-		if (nclst <= MAX_FAT12) fmt = FS_FAT12;
-		if (fmt == 0) return FR_NO_FILESYSTEM;
-
-		/* Boundaries and Limits */
-		fs->n_fatent = nclst + 2;						/* Number of FAT entries */
-		fs->volbase = bsect;							/* Volume start sector */
-		fs->fatbase = bsect + nrsv; 					/* FAT start sector */
-		fs->database = bsect + sysect;					/* Data start sector */
-		if (fmt == FS_FAT32) {
-			if (ld_word(fs->win + BPB_FSVer32) != 0) return FR_NO_FILESYSTEM;	/* (Must be FAT32 revision 0.0) */
-			if (fs->n_rootdir != 0) return FR_NO_FILESYSTEM;	/* (BPB_RootEntCnt must be 0) */
-			fs->dirbase = ld_dword(fs->win + BPB_RootClus32);	/* Root directory start cluster */
-			szbfat = fs->n_fatent * 4;					/* (Needed FAT size) */
-		} else {
-			if (fs->n_rootdir == 0)	return FR_NO_FILESYSTEM;	/* (BPB_RootEntCnt must not be 0) */
-			fs->dirbase = fs->fatbase + fasize;			/* Root directory start sector */
-			szbfat = (fmt == FS_FAT16) ?				/* (Needed FAT size) */
-				fs->n_fatent * 2 : fs->n_fatent * 3 / 2 + (fs->n_fatent & 1);
+	for (;;) {
+		c = (BYTE)p[si++];				/* Get a byte */
+		if (c <= ' ') break; 			/* Break if end of the path name */
+		if (IsSeparator(c)) {			/* Break if a separator is found */
+			while (IsSeparator(p[si])) si++;	/* Skip duplicated separator if exist */
+			break;
+		}
+		if (c == '.' || i >= ni) {		/* End of body or field overflow? */
+			if (ni == 11 || c != '.') return FR_INVALID_NAME;	/* Field overflow or invalid dot? */
+			i = 8; ni = 11;				/* Enter file extension field */
+			continue;
+		}
+#if FF_CODE_PAGE == 0
+		if (ExCvt && c >= 0x80) {		/* Is SBC extended character? */
+			c = ExCvt[c & 0x7F];		/* To upper SBC extended character */
+		}
+#elif FF_CODE_PAGE < 900
+		if (c >= 0x80) {				/* Is SBC extended character? */
+			c = ExCvt[c & 0x7F];		/* To upper SBC extended character */
 		}
-		if (fs->fsize < (szbfat + (SS(fs) - 1)) / SS(fs)) return FR_NO_FILESYSTEM;	/* (BPB_FATSz must not be less than the size needed) */
-
-#if !FF_FS_READONLY
-		/* Get FSInfo if available */
-		fs->last_clst = fs->free_clst = 0xFFFFFFFF;		/* Initialize cluster allocation information */
-		fs->fsi_flag = 0x80;
-#if (FF_FS_NOFSINFO & 3) != 3
-		if (fmt == FS_FAT32				/* Allow to update FSInfo only if BPB_FSInfo32 == 1 */
-			&& ld_word(fs->win + BPB_FSInfo32) == 1
-			&& move_window(fs, bsect + 1) == FR_OK)
-		{
-			fs->fsi_flag = 0;
-			if (ld_word(fs->win + BS_55AA) == 0xAA55	/* Load FSInfo data if available */
-				&& ld_dword(fs->win + FSI_LeadSig) == 0x41615252
-				&& ld_dword(fs->win + FSI_StrucSig) == 0x61417272)
-			{
-#if (FF_FS_NOFSINFO & 1) == 0
-				fs->free_clst = ld_dword(fs->win + FSI_Free_Count);
-#endif
-#if (FF_FS_NOFSINFO & 2) == 0
-				fs->last_clst = ld_dword(fs->win + FSI_Nxt_Free);
 #endif
-			}
+		if (dbc_1st(c)) {				/* Check if it is a DBC 1st byte */
+			d = (BYTE)p[si++];			/* Get 2nd byte */
+			if (!dbc_2nd(d) || i >= ni - 1) return FR_INVALID_NAME;	/* Reject invalid DBC */
+			sfn[i++] = c;
+			sfn[i++] = d;
+		} else {						/* SBC */
+			if (strchr("*+,:;<=>[]|\"\?\x7F", (int)c)) return FR_INVALID_NAME;	/* Reject illegal chrs for SFN */
+			if (IsLower(c)) c -= 0x20;	/* To upper */
+			sfn[i++] = c;
 		}
-#endif	/* (FF_FS_NOFSINFO & 3) != 3 */
-#endif	/* !FF_FS_READONLY */
 	}
+	*path = &p[si];						/* Return pointer to the next segment */
+	if (i == 0) return FR_INVALID_NAME;	/* Reject nul string */
+
+	if (sfn[0] == DDEM) sfn[0] = RDDEM;	/* If the first character collides with DDEM, replace it with RDDEM */
+	sfn[NSFLAG] = (c <= ' ' || p[si] <= ' ') ? NS_LAST : 0;	/* Set last segment flag if end of the path */
 
-	fs->fs_type = (BYTE)fmt;/* FAT sub-type */
-	fs->id = ++Fsid;		/* Volume mount ID */
-#if FF_USE_LFN == 1
-	fs->lfnbuf = LfnBuf;	/* Static LFN working buffer */
-#if FF_FS_EXFAT
-	fs->dirbuf = DirBuf;	/* Static directory block scratchpad buuffer */
-#endif
-#endif
-#if FF_FS_RPATH != 0
-	fs->cdir = 0;			/* Initialize current directory */
-#endif
-#if FF_FS_LOCK != 0			/* Clear file lock semaphores */
-	clear_lock(fs);
-#endif
 	return FR_OK;
+#endif /* FF_USE_LFN */
 }
 
 
 
 
 /*-----------------------------------------------------------------------*/
-/* Check if the file/directory object is valid or not                    */
+/* Follow a file path                                                    */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT validate (	/* Returns FR_OK or FR_INVALID_OBJECT */
-	FFOBJID* obj,			/* Pointer to the FFOBJID, the 1st member in the FIL/DIR object, to check validity */
-	FATFS** rfs				/* Pointer to pointer to the owner filesystem object to return */
+static FRESULT follow_path (	/* FR_OK(0): successful, !=0: error code */
+	DIR* dp,					/* Directory object to return last directory and found object */
+	const TCHAR* path			/* Full-path string to find a file or directory */
 )
 {
-	FRESULT res = FR_INVALID_OBJECT;
+	FRESULT res;
+	BYTE ns;
+	FATFS *fs = dp->obj.fs;
+#if FF_PATH_CACHE != 0
+	DWORD pclu;
+#endif
 
 
-	if (obj && obj->fs && obj->fs->fs_type && obj->id == obj->fs->id) {	/* Test if the object is valid */
-#if FF_FS_REENTRANT
-		if (lock_fs(obj->fs)) {	/* Obtain the filesystem object */
-			if (!(disk_status(obj->fs->pdrv) & STA_NOINIT)) { /* Test if the phsical drive is kept initialized */
-				res = FR_OK;
-			} else {
-				unlock_fs(obj->fs, FR_OK);
-			}
-		} else {
-			res = FR_TIMEOUT;
-		}
-#else
-		if (!(disk_status(obj->fs->pdrv) & STA_NOINIT)) { /* Test if the phsical drive is kept initialized */
-			res = FR_OK;
-		}
+#if FF_FS_RPATH != 0
+	if (!IsSeparator(*path) && (FF_STR_VOLUME_ID != 2 || !IsTerminator(*path))) {	/* Without heading separator */
+		dp->obj.sclust = fs->cdir;			/* Start at the current directory */
+	} else
 #endif
+	{										/* With heading separator */
+		while (IsSeparator(*path)) path++;	/* Strip separators */
+		dp->obj.sclust = 0;					/* Start from the root directory */
 	}
-	*rfs = (res == FR_OK) ? obj->fs : 0;	/* Corresponding filesystem object */
-	return res;
-}
-
+#if FF_FS_EXFAT
+	dp->obj.n_frag = 0;	/* Invalidate last fragment counter of the object */
+#if FF_FS_RPATH != 0
+	if (fs->fs_type == FS_EXFAT && dp->obj.sclust) {	/* exFAT: Retrieve the sub-directory's status */
+		DIR dj;
 
+		dp->obj.c_scl = fs->cdc_scl;
+		dp->obj.c_size = fs->cdc_size;
+		dp->obj.c_ofs = fs->cdc_ofs;
+		res = load_obj_xdir(&dj, &dp->obj);
+		if (res != FR_OK) return res;
+		dp->obj.objsize = ld_dword(fs->dirbuf + XDIR_FileSize);
+		dp->obj.stat = fs->dirbuf[XDIR_GenFlags] & 2;
+	}
+#endif
+#endif
 
+	if ((UINT)*path < ' ') {				/* Null path name is the origin directory itself */
+		dp->fn[NSFLAG] = NS_NONAME;
+		res = dir_sdi(dp, 0);
 
-/*---------------------------------------------------------------------------
+	} else {								/* Follow path */
+		for (;;) {
+			res = create_name(dp, &path);	/* Get a segment name of the path */
+			if (res != FR_OK) break;
+#if FF_PATH_CACHE != 0
+			if (!(dp->fn[NSFLAG] & (NS_LAST | NS_DOT)) && pc_find(dp)) continue;	/* Sub-directory found in the cache */
+			pclu = dir_clust(&dp->obj);
+#endif
+			res = dir_find(dp);				/* Find an object with the segment name */
+			ns = dp->fn[NSFLAG];
+			if (res != FR_OK) {				/* Failed to find the object */
+				if (res == FR_NO_FILE) {	/* Object is not found */
+					if (FF_FS_RPATH && (ns & NS_DOT)) {	/* If dot entry is not exist, stay there */
+						if (!(ns & NS_LAST)) continue;	/* Continue to follow if not last segment */
+						dp->fn[NSFLAG] = NS_NONAME;
+						res = FR_OK;
+					} else {							/* Could not find the object */
+						if (!(ns & NS_LAST)) res = FR_NO_PATH;	/* Adjust error code if not last segment */
+					}
+				}
+				break;
+			}
+			if (ns & NS_LAST) break;		/* Last segment matched. Function completed. */
+			/* Get into the sub-directory */
+			if (!(dp->obj.attr & AM_DIR)) {	/* It is not a sub-directory and cannot follow */
+				res = FR_NO_PATH; break;
+			}
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {	/* Save containing directory information for next dir */
+				dp->obj.c_scl = dp->obj.sclust;
+				dp->obj.c_size = ((DWORD)dp->obj.objsize & 0xFFFFFF00) | dp->obj.stat;
+				dp->obj.c_ofs = dp->blk_ofs;
+				init_alloc_info(fs, &dp->obj);	/* Open next directory */
+			} else
+#endif
+			{
+				dp->obj.sclust = ld_clust(fs, fs->win + dp->dptr % SS(fs));	/* Open next directory */
+			}
+#if FF_PATH_CACHE != 0
+			if (!(ns & NS_DOT)) {			/* Register the sub-directory to the cache */
+#if FF_FS_EXFAT
+				pc_store(dp, pclu, (fs->fs_type == FS_EXFAT) ? dp->blk_ofs : dp->dptr);
+#else
+				pc_store(dp, pclu, dp->dptr);
+#endif
+			}
+#endif
+		}
+	}
 
-   Public Functions (FatFs API)
+	return res;
+}
 
-----------------------------------------------------------------------------*/
 
 
 
 /*-----------------------------------------------------------------------*/
-/* Mount/Unmount a Logical Drive                                         */
+/* Get logical drive number from path name                               */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_mount (
-	FATFS* fs,			/* Pointer to the filesystem object to be registered (NULL:unmount)*/
-	const TCHAR* path,	/* Logical drive number to be mounted/unmounted */
-	BYTE opt			/* Mount option: 0=Do not mount (delayed mount), 1=Mount immediately */
+static int get_ldnumber (	/* Returns logical drive number (-1:invalid drive number or null pointer) */
+	const TCHAR** path		/* Pointer to pointer to the path name */
 )
 {
-	FATFS *cfs;
-	int vol;
-	FRESULT res;
-	const TCHAR *rp = path;
-
+	const TCHAR *tp, *tt;
+	TCHAR tc;
+	int i;
+	int vol = -1;
+#if FF_STR_VOLUME_ID		/* Find string volume ID */
+	const char *sp;
+	char c;
+#endif
 
-	/* Get logical drive number */
-	vol = get_ldnumber(&rp);
-	if (vol < 0) return FR_INVALID_DRIVE;
-	cfs = FatFs[vol];					/* Pointer to fs object */
+	tt = tp = *path;
+	if (!tp) return vol;	/* Invalid path name? */
+	do tc = *tt++; while (!IsTerminator(tc) && tc != ':');	/* Find a colon in the path */
+
+	if (tc == ':') {	/* DOS/Windows style volume ID? */
+		i = FF_VOLUMES;
+		if (IsDigit(*tp) && tp + 2 == tt) {	/* Is there a numeric volume ID + colon? */
+			i = (int)*tp - '0';	/* Get the LD number */
+		}
+#if FF_STR_VOLUME_ID == 1	/* Arbitrary string is enabled */
+		else {
+			i = 0;
+			do {
+				sp = VolumeStr[i]; tp = *path;	/* This string volume ID and path name */
+				do {	/* Compare the volume ID with path name */
+					c = *sp++; tc = *tp++;
+					if (IsLower(c)) c -= 0x20;
+					if (IsLower(tc)) tc -= 0x20;
+				} while (c && (TCHAR)c == tc);
+			} while ((c || tp != tt) && ++i < FF_VOLUMES);	/* Repeat for each id until pattern match */
+		}
+#endif
+		if (i < FF_VOLUMES) {	/* If a volume ID is found, get the drive number and strip it */
+			vol = i;		/* Drive number */
+			*path = tt;		/* Snip the drive prefix off */
+		}
+		return vol;
+	}
+#if FF_STR_VOLUME_ID == 2		/* Unix style volume ID is enabled */
+	if (*tp == '/') {			/* Is there a volume ID? */
+		while (*(tp + 1) == '/') tp++;	/* Skip duplicated separator */
+		i = 0;
+		do {
+			tt = tp; sp = VolumeStr[i]; /* Path name and this string volume ID */
+			do {	/* Compare the volume ID with path name */
+				c = *sp++; tc = *(++tt);
+				if (IsLower(c)) c -= 0x20;
+				if (IsLower(tc)) tc -= 0x20;
+			} while (c && (TCHAR)c == tc);
+		} while ((c || (tc != '/' && !IsTerminator(tc))) && ++i < FF_VOLUMES);	/* Repeat for each ID until pattern match */
+		if (i < FF_VOLUMES) {	/* If a volume ID is found, get the drive number and strip it */
+			vol = i;		/* Drive number */
+			*path = tt;		/* Snip the drive prefix off */
+		}
+		return vol;
+	}
+#endif
+	/* No drive prefix is found */
+#if FF_FS_RPATH != 0
+	vol = CurrVol;	/* Default drive is current drive */
+#else
+	vol = 0;		/* Default drive is 0 */
+#endif
+	return vol;		/* Return the default drive */
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* GPT support functions                                                 */
+/*-----------------------------------------------------------------------*/
+
+#if FF_LBA64
+
+/* Calculate CRC32 in byte-by-byte */
+
+static DWORD crc32 (	/* Returns next CRC value */
+	DWORD crc,			/* Current CRC value */
+	BYTE d				/* A byte to be processed */
+)
+{
+	BYTE b;
+
+
+	for (b = 1; b; b <<= 1) {
+		crc ^= (d & b) ? 1 : 0;
+		crc = (crc & 1) ? crc >> 1 ^ 0xEDB88320 : crc >> 1;
+	}
+	return crc;
+}
+
+
+/* Check validity of GPT header */
+
+static int test_gpt_header (	/* 0:Invalid, 1:Valid */
+	const BYTE* gpth			/* Pointer to the GPT header */
+)
+{
+	UINT i;
+	DWORD bcc;
+
+
+	if (memcmp(gpth + GPTH_Sign, "EFI PART" "\0\0\1\0" "\x5C\0\0", 16)) return 0;	/* Check sign, version (1.0) and length (92) */
+	for (i = 0, bcc = 0xFFFFFFFF; i < 92; i++) {		/* Check header BCC */
+		bcc = crc32(bcc, i - GPTH_Bcc < 4 ? 0 : gpth[i]);
+	}
+	if (~bcc != ld_dword(gpth + GPTH_Bcc)) return 0;
+	if (ld_dword(gpth + GPTH_PteSize) != SZ_GPTE) return 0;	/* Table entry size (must be SZ_GPTE bytes) */
+	if (ld_dword(gpth + GPTH_PtNum) > 128) return 0;	/* Table size (must be 128 entries or less) */
+
+	return 1;
+}
+
+#if !FF_FS_READONLY && FF_USE_MKFS
+
+/* Generate random value */
+static DWORD make_rand (
+	DWORD seed,		/* Seed value */
+	BYTE* buff,		/* Output buffer */
+	UINT n			/* Data length */
+)
+{
+	UINT r;
+
+
+	if (seed == 0) seed = 1;
+	do {
+		for (r = 0; r < 8; r++) seed = seed & 1 ? seed >> 1 ^ 0xA3000000 : seed >> 1;	/* Shift 8 bits the 32-bit LFSR */
+		*buff++ = (BYTE)seed;
+	} while (--n);
+	return seed;
+}
+
+#endif
+#endif
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Load a sector and check if it is an FAT VBR                           */
+/*-----------------------------------------------------------------------*/
+
+/* Check what the sector is */
+
+static UINT check_fs (	/* 0:FAT/FAT32 VBR, 1:exFAT VBR, 2:Not FAT and valid BS, 3:Not FAT and invalid BS, 4:Disk error */
+	FATFS* fs,			/* Filesystem object */
+	LBA_t sect			/* Sector to load and check if it is an FAT-VBR or not */
+)
+{
+	WORD w, sign;
+	BYTE b;
+
+
+	fs->wflag = 0; fs->winsect = (LBA_t)0 - 1;		/* Invaidate window */
+	if (move_window(fs, sect) != FR_OK) return 4;	/* Load the boot sector */
+	sign = ld_word(fs->win + BS_55AA);
+#if FF_FS_EXFAT
+	if (sign == 0xAA55 && !memcmp(fs->win + BS_JmpBoot, "\xEB\x76\x90" "EXFAT   ", 11)) return 1;	/* It is an exFAT VBR */
+#endif
+	b = fs->win[BS_JmpBoot];
+	if (b == 0xEB || b == 0xE9 || b == 0xE8) {	/* Valid JumpBoot code? (short jump, near jump or near call) */
+		if (sign == 0xAA55 && !memcmp(fs->win + BS_FilSysType32, "FAT32   ", 8)) {
+			return 0;	/* It is an FAT32 VBR */
+		}
+		/* FAT volumes formatted with early MS-DOS lack BS_55AA and BS_FilSysType, so FAT VBR needs to be identified without them. */
+		w = ld_word(fs->win + BPB_BytsPerSec);
+		b = fs->win[BPB_SecPerClus];
+		if ((w & (w - 1)) == 0 && w >= FF_MIN_SS && w <= FF_MAX_SS	/* Properness of sector size (512-4096 and 2^n) */
+			&& b != 0 && (b & (b - 1)) == 0				/* Properness of cluster size (2^n) */
+			&& ld_word(fs->win + BPB_RsvdSecCnt) != 0	/* Properness of reserved sectors (MNBZ) */
+			&& (UINT)fs->win[BPB_NumFATs] - 1 <= 1		/* Properness of FATs (1 or 2) */
+			&& ld_word(fs->win + BPB_RootEntCnt) != 0	/* Properness of root dir entries (MNBZ) */
+			&& (ld_word(fs->win + BPB_TotSec16) >= 128 || ld_dword(fs->win + BPB_TotSec32) >= 0x10000)	/* Properness of volume sectors (>=128) */
+			&& ld_word(fs->win + BPB_FATSz16) != 0) {	/* Properness of FAT size (MNBZ) */
+				return 0;	/* It can be presumed an FAT VBR */
+		}
+	}
+	return sign == 0xAA55 ? 2 : 3;	/* Not an FAT VBR (valid or invalid BS) */
+}
+
+
+/* Find an FAT volume */
+/* (It supports only generic partitioning rules, MBR, GPT and SFD) */
+
+static UINT find_volume (	/* Returns BS status found in the hosting drive */
+	FATFS* fs,		/* Filesystem object */
+	UINT part		/* Partition to fined = 0:auto, 1..:forced */
+)
+{
+	UINT fmt, i;
+	DWORD mbr_pt[4];
+
+
+	fmt = check_fs(fs, 0);				/* Load sector 0 and check if it is an FAT VBR as SFD format */
+	if (fmt != 2 && (fmt >= 3 || part == 0)) return fmt;	/* Returns if it is an FAT VBR as auto scan, not a BS or disk error */
+
+	/* Sector 0 is not an FAT VBR or forced partition number wants a partition */
+
+#if FF_LBA64
+	if (fs->win[MBR_Table + PTE_System] == 0xEE) {	/* GPT protective MBR? */
+		DWORD n_ent, v_ent, ofs;
+		QWORD pt_lba;
+
+		if (move_window(fs, 1) != FR_OK) return 4;	/* Load GPT header sector (next to MBR) */
+		if (!test_gpt_header(fs->win)) return 3;	/* Check if GPT header is valid */
+		n_ent = ld_dword(fs->win + GPTH_PtNum);		/* Number of entries */
+		pt_lba = ld_qword(fs->win + GPTH_PtOfs);	/* Table location */
+		for (v_ent = i = 0; i < n_ent; i++) {		/* Find FAT partition */
+			if (move_window(fs, pt_lba + i * SZ_GPTE / SS(fs)) != FR_OK) return 4;	/* PT sector */
+			ofs = i * SZ_GPTE % SS(fs);												/* Offset in the sector */
+			if (!memcmp(fs->win + ofs + GPTE_PtGuid, GUID_MS_Basic, 16)) {	/* MS basic data partition? */
+				v_ent++;
+				fmt = check_fs(fs, ld_qword(fs->win + ofs + GPTE_FstLba));	/* Load VBR and check status */
+				if (part == 0 && fmt <= 1) return fmt;			/* Auto search (valid FAT volume found first) */
+				if (part != 0 && v_ent == part) return fmt;		/* Forced partition order (regardless of it is valid or not) */
+			}
+		}
+		return 3;	/* Not found */
+	}
+#endif
+	if (FF_MULTI_PARTITION && part > 4) return 3;	/* MBR has 4 partitions max */
+	for (i = 0; i < 4; i++) {		/* Load partition offset in the MBR */
+		mbr_pt[i] = ld_dword(fs->win + MBR_Table + i * SZ_PTE + PTE_StLba);
+	}
+	i = part ? part - 1 : 0;		/* Table index to find first */
+	do {							/* Find an FAT volume */
+		fmt = mbr_pt[i] ? check_fs(fs, mbr_pt[i]) : 3;	/* Check if the partition is FAT */
+	} while (part == 0 && fmt >= 2 && ++i < 4);
+	return fmt;
+}
+
+
+
+
+#if FF_FS_SNAPSHOT || FF_FS_JOURNAL
+static DWORD ld_vsn (	/* Returns volume serial number in the VBR */
+	const BYTE* vbr		/* VBR of FAT/FAT32/exFAT volume */
+)
+{
+	if (!memcmp(vbr + BS_JmpBoot, "\xEB\x76\x90" "EXFAT   ", 11)) return ld_dword(vbr + BPB_VolIDEx);
+	return ld_dword(vbr + (ld_word(vbr + BPB_FATSz16) ? BS_VolID : BS_VolID32));
+}
+#endif
+
+
+
+
+#if FF_FS_SNAPSHOT
+/*-----------------------------------------------------------------------*/
+/* Mount snapshot handling                                               */
+/*-----------------------------------------------------------------------*/
+/* The mount snapshot is valid while the card (media ID) and the VBR are
+/  the same and the cluster allocation on the disk is not changed since it
+/  was saved. */
+
+static DWORD snap_sum (	/* Returns checksum of the sector in the window */
+	FATFS* fs			/* Filesystem object */
+)
+{
+	UINT i;
+	DWORD sum = 0;
+
+
+	for (i = 0; i < SS(fs); i++) sum = ((sum & 1) ? 0x80000000 : 0) + (sum >> 1) + fs->win[i];
+	return sum;
+}
+
+
+static UINT snap_load (	/* 0:Not restored, 5..8:Restored (FAT sub-type + 4) */
+	FATFS* fs,			/* Filesystem object */
+	UINT part			/* Partition to be mounted */
+)
+{
+	FFSNAP sn;
+
+
+	fs->snap = 3; fs->snappt = (BYTE)part;
+	if (disk_ioctl(fs->pdrv, MMC_GET_CID, fs->snapcid) != RES_OK) return 0;	/* No media ID, no snapshot (but discard the one of the drive on change) */
+	fs->snap = 0;
+	if (!ff_snap_load(fs->pdrv, &sn)) return 0;	/* No snapshot is saved? */
+	if (memcmp(sn.cid, fs->snapcid, 16) || sn.part != part) return 0;	/* Another card or partition? */
+	if (sn.fs_type < FS_FAT12 || sn.fs_type > (FF_FS_EXFAT ? FS_EXFAT : FS_FAT32)) return 0;
+	fs->wflag = 0; fs->winsect = (LBA_t)0 - 1;		/* Invaidate window */
+	if (move_window(fs, sn.volbase) != FR_OK || snap_sum(fs) != sn.vbrsum) return 0;	/* Load the VBR and check if it is the same */
+
+	fs->n_fats = sn.n_fats; fs->csize = sn.csize; fs->n_rootdir = sn.n_rootdir;	/* Restore the volume parameters */
+	fs->n_fatent = sn.n_fatent; fs->fsize = sn.fsize;
+	fs->volbase = sn.volbase; fs->fatbase = sn.fatbase; fs->dirbase = sn.dirbase; fs->database = sn.database;
+#if FF_FS_EXFAT
+	fs->bitbase = sn.bitbase;
+#endif
+	fs->last_clst = sn.last_clst; fs->free_clst = sn.free_clst; fs->fsi_flag = sn.fsi_flag;	/* Restore the allocation information */
+#if FF_FAT_MIRROR == 1
+	fs->mir_n = 0;
+#endif
+	fs->snapsum = sn.vbrsum; fs->snapsn = sn.volsn;
+	fs->snap = 1;		/* The disk is in the state of the snapshot */
+	return sn.fs_type + 4;
+}
+
+
+static void snap_save (
+	FATFS* fs,			/* Filesystem object */
+	int umnt			/* 0:On closing a file, 1:On unmount (save the one discarded in the session) */
+)
+{
+	FFSNAP sn;
+
+
+	if (fs->fs_type == 0 || (fs->snap != 0 && !(umnt && fs->snap == 4))) return;	/* Not mounted, already saved, discarded in the session or not available */
+	if (sync_fs(fs) != FR_OK) return;	/* Flush the volume so that the disk is in the state of the snapshot */
+
+	memset(&sn, 0, sizeof sn);
+	memcpy(sn.cid, fs->snapcid, 16); sn.vbrsum = fs->snapsum; sn.volsn = fs->snapsn; sn.part = fs->snappt;
+	sn.fs_type = fs->fs_type; sn.n_fats = fs->n_fats; sn.csize = fs->csize; sn.n_rootdir = fs->n_rootdir;
+	sn.n_fatent = fs->n_fatent; sn.fsize = fs->fsize;
+	sn.volbase = fs->volbase; sn.fatbase = fs->fatbase; sn.dirbase = fs->dirbase; sn.database = fs->database;
+#if FF_FS_EXFAT
+	sn.bitbase = fs->bitbase;
+#endif
+	sn.last_clst = fs->last_clst; sn.free_clst = fs->free_clst; sn.fsi_flag = fs->fsi_flag & (BYTE)~1;
+	if (ff_snap_save(fs->pdrv, &sn)) {
+		fs->snap = 1;
+		fs->fsi_flag &= (BYTE)~1;	/* Allocation information is in the snapshot */
+	}
+}
+
+#endif	/* FF_FS_SNAPSHOT */
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Determine logical drive number and mount the volume if needed         */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
+	const TCHAR** path,			/* Pointer to pointer to the path name (drive number) */
+	FATFS** rfs,				/* Pointer to pointer to the found filesystem object */
+	BYTE mode					/* !=0: Check write protection for write access */
+)
+{
+	int vol;
+	DSTATUS stat;
+	LBA_t bsect;
+	DWORD tsect, sysect, fasize, nclst, szbfat;
+	WORD nrsv;
+	FATFS *fs;
+	UINT fmt;
+#if FF_FS_JOURNAL
+	DWORD vsn;
+#endif
+
+
+	/* Get logical drive number */
+	*rfs = 0;
+	vol = get_ldnumber(path);
+	if (vol < 0) return FR_INVALID_DRIVE;
+
+	/* Check if the filesystem object is valid or not */
+	fs = FatFs[vol];					/* Get pointer to the filesystem object */
+	if (!fs) return FR_NOT_ENABLED;		/* Is the filesystem object available? */
+#if FF_FS_REENTRANT
+	if (!lock_fs(fs)) return FR_TIMEOUT;	/* Lock the volume */
+#endif
+	*rfs = fs;							/* Return pointer to the filesystem object */
+
+	mode &= (BYTE)~FA_READ;				/* Desired access mode, write access or not */
+	if (fs->fs_type != 0) {				/* If the volume has been mounted */
+		stat = disk_status(fs->pdrv);
+		if (!(stat & STA_NOINIT)) {		/* and the physical drive is kept initialized */
+			if (!FF_FS_READONLY && mode && (stat & STA_PROTECT)) {	/* Check write protection if needed */
+				return FR_WRITE_PROTECTED;
+			}
+			return FR_OK;				/* The filesystem object is already valid */
+		}
+	}
+
+	/* The filesystem object is not valid. */
+	/* Following code attempts to mount the volume. (find an FAT volume, analyze the BPB and initialize the filesystem object) */
+
+	fs->fs_type = 0;					/* Clear the filesystem object */
+	fs->pdrv = LD2PD(vol);				/* Volume hosting physical drive */
+#if FF_FS_JOURNAL
+	fs->jnlbase = 0; fs->jnl_n = 0; fs->jnl_cmt = 0;	/* No journal until the volume is mounted */
+#endif
+#if FF_ALLOC_WIN != 0
+	fs->alc_fail = 0;					/* Any free extent can be searched */
+#endif
+	stat = disk_initialize(fs->pdrv);	/* Initialize the physical drive */
+	if (stat & STA_NOINIT) { 			/* Check if the initialization succeeded */
+		return FR_NOT_READY;			/* Failed to initialize due to no medium or hard error */
+	}
+	if (!FF_FS_READONLY && mode && (stat & STA_PROTECT)) { /* Check disk write protection if needed */
+		return FR_WRITE_PROTECTED;
+	}
+#if FF_MAX_SS != FF_MIN_SS				/* Get sector size (multiple sector size cfg only) */
+	if (disk_ioctl(fs->pdrv, GET_SECTOR_SIZE, &SS(fs)) != RES_OK) return FR_DISK_ERR;
+	if (SS(fs) > FF_MAX_SS || SS(fs) < FF_MIN_SS || (SS(fs) & (SS(fs) - 1))) return FR_DISK_ERR;
+#endif
+#if FF_ALLOC_WIN != 0 || FF_USE_STREAM != 0	/* Get erase block size once for the allocations */
+	if (disk_ioctl(fs->pdrv, GET_BLOCK_SIZE, &fs->blk_size) != RES_OK || fs->blk_size == 0 || fs->blk_size > 32768) fs->blk_size = 1;
+#endif
+
+	/* Find an FAT volume on the drive */
+#if FF_FS_SNAPSHOT
+	fmt = snap_load(fs, LD2PT(vol));		/* Restore the volume from the mount snapshot if it is valid */
+	if (fmt == 0) {
+		fmt = find_volume(fs, LD2PT(vol));
+		if (fmt <= 1) {						/* Identity of the VBR to be saved in the snapshot */
+			fs->snapsum = snap_sum(fs);
+			fs->snapsn = ld_vsn(fs->win);
+		}
+	}
+#else
+	fmt = find_volume(fs, LD2PT(vol));
+#endif
+	if (fmt == 4) return FR_DISK_ERR;		/* An error occured in the disk I/O layer */
+	if (fmt == 2 || fmt == 3) return FR_NO_FILESYSTEM;	/* No FAT volume is found */
+	bsect = fs->winsect;					/* Volume offset */
+#if FF_FS_JOURNAL
+	vsn = ld_vsn(fs->win);					/* Volume serial number to identify the journal */
+#endif
+
+	/* An FAT volume is found (bsect). Following code initializes the filesystem object */
+
+#if FF_FS_SNAPSHOT
+	if (fmt >= 5) {		/* The volume has been restored from the snapshot */
+		fmt -= 4;		/* FAT sub-type */
+	} else
+#endif
+#if FF_FS_EXFAT
+	if (fmt == 1) {
+		QWORD maxlba;
+		DWORD so, cv, bcl, i;
+
+		for (i = BPB_ZeroedEx; i < BPB_ZeroedEx + 53 && fs->win[i] == 0; i++) ;	/* Check zero filler */
+		if (i < BPB_ZeroedEx + 53) return FR_NO_FILESYSTEM;
+
+		if (ld_word(fs->win + BPB_FSVerEx) != 0x100) return FR_NO_FILESYSTEM;	/* Check exFAT version (must be version 1.0) */
+
+		if (1 << fs->win[BPB_BytsPerSecEx] != SS(fs)) {	/* (BPB_BytsPerSecEx must be equal to the physical sector size) */
+			return FR_NO_FILESYSTEM;
+		}
+
+		maxlba = ld_qword(fs->win + BPB_TotSecEx) + bsect;	/* Last LBA of the volume + 1 */
+		if (!FF_LBA64 && maxlba >= 0x100000000) return FR_NO_FILESYSTEM;	/* (It cannot be accessed in 32-bit LBA) */
+
+		fs->fsize = ld_dword(fs->win + BPB_FatSzEx);	/* Number of sectors per FAT */
+
+		fs->n_fats = fs->win[BPB_NumFATsEx];			/* Number of FATs */
+		if (fs->n_fats != 1) return FR_NO_FILESYSTEM;	/* (Supports only 1 FAT) */
+
+		fs->csize = 1 << fs->win[BPB_SecPerClusEx];		/* Cluster size */
+		if (fs->csize == 0)	return FR_NO_FILESYSTEM;	/* (Must be 1..32768 sectors) */
+
+		nclst = ld_dword(fs->win + BPB_NumClusEx);		/* Number of clusters */
+		if (nclst > MAX_EXFAT) return FR_NO_FILESYSTEM;	/* (Too many clusters) */
+		fs->n_fatent = nclst + 2;
+
+		/* Boundaries and Limits */
+		fs->volbase = bsect;
+		fs->database = bsect + ld_dword(fs->win + BPB_DataOfsEx);
+		fs->fatbase = bsect + ld_dword(fs->win + BPB_FatOfsEx);
+		if (maxlba < (QWORD)fs->database + nclst * fs->csize) return FR_NO_FILESYSTEM;	/* (Volume size must not be smaller than the size requiered) */
+		fs->dirbase = ld_dword(fs->win + BPB_RootClusEx);
+
+		/* Get bitmap location and check if it is contiguous (implementation assumption) */
+		so = i = 0;
+		for (;;) {	/* Find the bitmap entry in the root directory (in only first cluster) */
+			if (i == 0) {
+				if (so >= fs->csize) return FR_NO_FILESYSTEM;	/* Not found? */
+				if (move_window(fs, clst2sect(fs, (DWORD)fs->dirbase) + so) != FR_OK) return FR_DISK_ERR;
+				so++;
+			}
+			if (fs->win[i] == ET_BITMAP) break;			/* Is it a bitmap entry? */
+			i = (i + SZDIRE) % SS(fs);	/* Next entry */
+		}
+		bcl = ld_dword(fs->win + i + 20);				/* Bitmap cluster */
+		if (bcl < 2 || bcl >= fs->n_fatent) return FR_NO_FILESYSTEM;	/* (Wrong cluster#) */
+		fs->bitbase = fs->database + fs->csize * (bcl - 2);	/* Bitmap sector */
+		for (;;) {	/* Check if bitmap is contiguous */
+			if (move_window(fs, fs->fatbase + bcl / (SS(fs) / 4)) != FR_OK) return FR_DISK_ERR;
+			cv = ld_dword(fs->win + bcl % (SS(fs) / 4) * 4);
+			if (cv == 0xFFFFFFFF) break;				/* Last link? */
+			if (cv != ++bcl) return FR_NO_FILESYSTEM;	/* Fragmented? */
+		}
+
+#if !FF_FS_READONLY
+		fs->last_clst = fs->free_clst = 0xFFFFFFFF;		/* Initialize cluster allocation information */
+#endif
+		fmt = FS_EXFAT;			/* FAT sub-type */
+	} else
+#endif	/* FF_FS_EXFAT */
+	{
+		if (ld_word(fs->win + BPB_BytsPerSec) != SS(fs)) return FR_NO_FILESYSTEM;	/* (BPB_BytsPerSec must be equal to the physical sector size) */
+
+		fasize = ld_word(fs->win + BPB_FATSz16);		/* Number of sectors per FAT */
+		if (fasize == 0) fasize = ld_dword(fs->win + BPB_FATSz32);
+		fs->fsize = fasize;
+
+		fs->n_fats = fs->win[BPB_NumFATs];				/* Number of FATs */
+		if (fs->n_fats != 1 && fs->n_fats != 2) return FR_NO_FILESYSTEM;	/* (Must be 1 or 2) */
+		fasize *= fs->n_fats;							/* Number of sectors for FAT area */
+
+		fs->csize = fs->win[BPB_SecPerClus];			/* Cluster size */
+		if (fs->csize == 0 || (fs->csize & (fs->csize - 1))) return FR_NO_FILESYSTEM;	/* (Must be power of 2) */
+
+		fs->n_rootdir = ld_word(fs->win + BPB_RootEntCnt);	/* Number of root directory entries */
+		if (fs->n_rootdir % (SS(fs) / SZDIRE)) return FR_NO_FILESYSTEM;	/* (Must be sector aligned) */
+
+		tsect = ld_word(fs->win + BPB_TotSec16);		/* Number of sectors on the volume */
+		if (tsect == 0) tsect = ld_dword(fs->win + BPB_TotSec32);
+
+		nrsv = ld_word(fs->win + BPB_RsvdSecCnt);		/* Number of reserved sectors */
+		if (nrsv == 0) return FR_NO_FILESYSTEM;			/* (Must not be 0) */
+
+		/* Determine the FAT sub type */
+		sysect = nrsv + fasize + fs->n_rootdir / (SS(fs) / SZDIRE);	/* RSV + FAT + DIR */
+		if (tsect < sysect) return FR_NO_FILESYSTEM;	/* (Invalid volume size) */
+		nclst = (tsect - sysect) / fs->csize;			/* Number of clusters */
+		if (nclst == 0) return FR_NO_FILESYSTEM;		/* (Invalid volume size) */
+		fmt = 0;
+		if (nclst <= MAX_FAT32) fmt = FS_FAT32;
+		if (nclst <= MAX_FAT16) fmt = FS_FAT16;
+		if (nclst <= MAX_FAT12) fmt = FS_FAT12;
+		if (fmt == 0) return FR_NO_FILESYSTEM;
+
+		/* Boundaries and Limits */
+		fs->n_fatent = nclst + 2;						/* Number of FAT entries */
+		fs->volbase = bsect;							/* Volume start sector */
+		fs->fatbase = bsect + nrsv; 					/* FAT start sector */
+		fs->database = bsect + sysect;					/* Data start sector */
+		if (fmt == FS_FAT32) {
+			if (ld_word(fs->win + BPB_FSVer32) != 0) return FR_NO_FILESYSTEM;	/* (Must be FAT32 revision 0.0) */
+			if (fs->n_rootdir != 0) return FR_NO_FILESYSTEM;	/* (BPB_RootEntCnt must be 0) */
+			fs->dirbase = ld_dword(fs->win + BPB_RootClus32);	/* Root directory start cluster */
+			szbfat = fs->n_fatent * 4;					/* (Needed FAT size) */
+		} else {
+			if (fs->n_rootdir == 0)	return FR_NO_FILESYSTEM;	/* (BPB_RootEntCnt must not be 0) */
+			fs->dirbase = fs->fatbase + fasize;			/* Root directory start sector */
+			szbfat = (fmt == FS_FAT16) ?				/* (Needed FAT size) */
+				fs->n_fatent * 2 : fs->n_fatent * 3 / 2 + (fs->n_fatent & 1);
+		}
+		if (fs->fsize < (szbfat + (SS(fs) - 1)) / SS(fs)) return FR_NO_FILESYSTEM;	/* (BPB_FATSz must not be less than the size needed) */
+
+#if !FF_FS_READONLY
+		/* Get FSInfo if available */
+		fs->last_clst = fs->free_clst = 0xFFFFFFFF;		/* Initialize cluster allocation information */
+		fs->fsi_flag = 0x80;
+#if FF_FAT_MIRROR == 1
+		fs->mir_n = 0;		/* No FAT sector to be mirrored */
+#endif
+#if (FF_FS_NOFSINFO & 3) != 3
+		if (fmt == FS_FAT32				/* Allow to update FSInfo only if BPB_FSInfo32 == 1 */
+			&& ld_word(fs->win + BPB_FSInfo32) == 1
+			&& move_window(fs, bsect + 1) == FR_OK)
+		{
+			fs->fsi_flag = 0;
+			if (ld_word(fs->win + BS_55AA) == 0xAA55	/* Load FSInfo data if available */
+				&& ld_dword(fs->win + FSI_LeadSig) == 0x41615252
+				&& ld_dword(fs->win + FSI_StrucSig) == 0x61417272)
+			{
+#if (FF_FS_NOFSINFO & 1) == 0
+				fs->free_clst = ld_dword(fs->win + FSI_Free_Count);
+#endif
+#if (FF_FS_NOFSINFO & 2) == 0
+				fs->last_clst = ld_dword(fs->win + FSI_Nxt_Free);
+#endif
+			}
+		}
+#endif	/* (FF_FS_NOFSINFO & 3) != 3 */
+#endif	/* !FF_FS_READONLY */
+	}
+
+#if FF_FS_JOURNAL
+	if (jnl_open(fs, fmt, vsn, stat) != FR_OK) return FR_DISK_ERR;	/* Replay the metadata journal if needed */
+#endif
+#if FF_FAT_RAM
+	if (fat_load(fs, fmt) != FR_OK) return FR_DISK_ERR;	/* Load the whole FAT if it fits in the buffer */
+#endif
+	fs->fs_type = (BYTE)fmt;/* FAT sub-type */
+	fs->id = ++Fsid;		/* Volume mount ID */
+#if FF_DIR_SCAN != 0
+	fs->dscnt = 0;			/* Invalidate directory scan buffer */
+#endif
+#if FF_USE_LFN == 1
+	fs->lfnbuf = LfnBuf;	/* Static LFN working buffer */
+#if FF_FS_EXFAT
+	fs->dirbuf = DirBuf;	/* Static directory block scratchpad buuffer */
+#endif
+#endif
+#if FF_FS_RPATH != 0
+	fs->cdir = 0;			/* Initialize current directory */
+#endif
+#if FF_FS_LOCK != 0			/* Clear file lock semaphores */
+	clear_lock(fs);
+#endif
+	return FR_OK;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Check if the file/directory object is valid or not                    */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT validate (	/* Returns FR_OK or FR_INVALID_OBJECT */
+	FFOBJID* obj,			/* Pointer to the FFOBJID, the 1st member in the FIL/DIR object, to check validity */
+	FATFS** rfs				/* Pointer to pointer to the owner filesystem object to return */
+)
+{
+	FRESULT res = FR_INVALID_OBJECT;
+
+
+	if (obj && obj->fs && obj->fs->fs_type && obj->id == obj->fs->id) {	/* Test if the object is valid */
+#if FF_FS_REENTRANT
+		if (lock_fs(obj->fs)) {	/* Obtain the filesystem object */
+			if (!(disk_status(obj->fs->pdrv) & STA_NOINIT)) { /* Test if the phsical drive is kept initialized */
+				res = FR_OK;
+			} else {
+				unlock_fs(obj->fs, FR_OK);
+			}
+		} else {
+			res = FR_TIMEOUT;
+		}
+#else
+		if (!(disk_status(obj->fs->pdrv) & STA_NOINIT)) { /* Test if the phsical drive is kept initialized */
+			res = FR_OK;
+		}
+#endif
+	}
+	*rfs = (res == FR_OK) ? obj->fs : 0;	/* Corresponding filesystem object */
+	return res;
+}
+
+
+
+
+#if FF_FBUF_POOL != 0
+/*-----------------------------------------------------------------------*/
+/* File buffer handling with the buffer pool                             */
+/*-----------------------------------------------------------------------*/
+/* The file buffer mbuf[] holds a block of up to mbsz sectors, mtop to
+/  mtop + mbcnt - 1. The block is aligned to the buffer size in the cluster.
+/  fp->sect is the sector containing the file pointer in the block, and the
+/  dirty part of the block is mtop to mtop + mbdty - 1. */
+
+#define FBUF_PTR(fp)	((fp)->mbuf + (UINT)((fp)->sect - (fp)->mtop) * SS((fp)->obj.fs))	/* Data of fp->sect in the buffer */
+
+
+static void fbuf_get (	/* Give a block of the pool to the file */
+	FIL* fp			/* Pointer to the file object */
+)
+{
+	UINT i, n, top, len;
+
+
+	for (i = n = top = len = 0; i < FF_FBUF_POOL && len < FF_FBUF_SECT; i++) {	/* Find the largest free block up to FF_FBUF_SECT sectors */
+		n = FbufOwner[i] ? 0 : n + 1;
+		if (n > len) {
+			len = n; top = i + 1 - n;
+		}
+	}
+	if (len >= 2) {		/* Use the block of the pool */
+		for (i = 0; i < len; i++) FbufOwner[top + i] = fp->obj.fs;
+		fp->mbuf = FbufPool + top * FF_MAX_SS;
+		fp->mbsz = len;
+	} else {			/* Use the sector buffer in the file object */
+		fp->mbuf = fp->buf;
+		fp->mbsz = 1;
+	}
+	fp->mbcnt = fp->mbdty = 0;
+}
+
+
+static void fbuf_put (	/* Return the block to the pool */
+	FIL* fp			/* Pointer to the file object */
+)
+{
+	UINT i;
+
+
+	if (fp->mbuf != fp->buf) {
+		for (i = 0; i < fp->mbsz; i++) FbufOwner[(fp->mbuf - FbufPool) / FF_MAX_SS + i] = 0;
+		fp->mbuf = fp->buf;
+		fp->mbsz = 1;
+	}
+	fp->mbcnt = 0;
+}
+
+
+static FRESULT fbuf_flush (	/* FR_OK(0):succeeded, !=0:error */
+	FIL* fp			/* Pointer to the file object */
+)
+{
+#if !FF_FS_READONLY
+	if (fp->flag & FA_DIRTY) {	/* Write-back dirty sectors at a time */
+		if (disk_write(fp->obj.fs->pdrv, fp->mbuf, fp->mtop, fp->mbdty) != RES_OK) return FR_DISK_ERR;
+		fp->flag &= (BYTE)~FA_DIRTY;
+		fp->mbdty = 0;
+	}
+#endif
+	return FR_OK;
+}
+
+
+static FRESULT fbuf_load (	/* FR_OK(0):succeeded, !=0:error */
+	FIL* fp,		/* Pointer to the file object */
+	LBA_t sect		/* Sector containing the file pointer */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	UINT csect, bofs, n;
+
+
+	if (sect - fp->mtop >= fp->mbcnt) {	/* Is the sector out of the block in the buffer? */
+		if (fbuf_flush(fp) != FR_OK) return FR_DISK_ERR;
+		csect = (UINT)(fp->fptr / SS(fs)) & (fs->csize - 1);	/* Sector offset in the cluster */
+		n = (fp->mbsz < fs->csize) ? fp->mbsz : fs->csize;		/* Block size */
+		bofs = csect % n;					/* Sector offset in the block */
+		fp->mtop = sect - bofs;				/* Top of the block */
+		if (n > fs->csize - (csect - bofs)) n = fs->csize - (csect - bofs);	/* Clip the block at the cluster boundary */
+		fp->mbcnt = 0;
+		if ((fp->fptr / SS(fs) - bofs) * SS(fs) < fp->obj.objsize) {	/* Fill the block if it has file data */
+			if (disk_read(fs->pdrv, fp->mbuf, fp->mtop, n) != RES_OK) return FR_DISK_ERR;
+		}
+		fp->mbcnt = n;
+	}
+	fp->sect = sect;
+	return FR_OK;
+}
+
+#endif	/* FF_FBUF_POOL != 0 */
+
+
+
+
+/*---------------------------------------------------------------------------
+
+   Public Functions (FatFs API)
+
+----------------------------------------------------------------------------*/
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Mount/Unmount a Logical Drive                                         */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_mount (
+	FATFS* fs,			/* Pointer to the filesystem object to be registered (NULL:unmount)*/
+	const TCHAR* path,	/* Logical drive number to be mounted/unmounted */
+	BYTE opt			/* Mount option: 0=Do not mount (delayed mount), 1=Mount immediately */
+)
+{
+	FATFS *cfs;
+	int vol;
+	FRESULT res;
+	const TCHAR *rp = path;
+#if FF_USE_STREAM != 0 || FF_FBUF_POOL != 0 || FF_ALLOC_WIN != 0
+	UINT i;
+#endif
+
+
+	/* Get logical drive number */
+	vol = get_ldnumber(&rp);
+	if (vol < 0) return FR_INVALID_DRIVE;
+	cfs = FatFs[vol];					/* Pointer to fs object */
 
 	if (cfs) {
 #if FF_FS_LOCK != 0
-		clear_lock(cfs);
+		clear_lock(cfs);
+#endif
+#if FF_USE_STREAM != 0
+		for (i = 0; i < FF_USE_STREAM; i++) {	/* Discard streaming files on the volume */
+			if (StrmFiles[i] && StrmFiles[i]->obj.fs == cfs) StrmFiles[i] = 0;
+		}
+#endif
+#if FF_ALLOC_WIN != 0
+		for (i = 0; i < FF_ALLOC_WIN; i++) {	/* Discard allocation windows on the volume */
+			if (AlcWin[i].fs == cfs) AlcWin[i].fs = 0;
+		}
+#endif
+#if FF_FBUF_POOL != 0
+		for (i = 0; i < FF_FBUF_POOL; i++) {	/* Discard file buffers used on the volume */
+			if (FbufOwner[i] == cfs) FbufOwner[i] = 0;
+		}
+#endif
+#if FF_FS_SNAPSHOT
+		snap_save(cfs, 1);				/* Save the mount snapshot if needed */
+#endif
+#if FF_FS_JOURNAL
+		if (cfs->fs_type && cfs->jnlbase && sync_fs(cfs) == FR_OK && cfs->jnl_cmt) jnl_apply(cfs);	/* Commit the last transaction and write it in place (replayed at next mount on failure) */
+#endif
+#if FF_FAT_RAM
+		ff_memfree(cfs->fatram);		/* Release the FAT buffer after the last sync */
+		cfs->fatram = 0; cfs->fr_n = 0;
+#if !FF_FS_READONLY
+		cfs->fr_wflag = 0;
+#endif
+#endif
+#if FF_FS_REENTRANT						/* Discard sync object of the current volume */
+		if (!ff_del_syncobj(cfs->sobj)) return FR_INT_ERR;
+#endif
+		cfs->fs_type = 0;				/* Clear old fs object */
+	}
+
+	if (fs) {
+		fs->fs_type = 0;				/* Clear new fs object */
+#if FF_FAT_RAM
+		fs->fatram = 0;					/* No FAT buffer until the volume is mounted */
+#endif
+#if FF_FS_REENTRANT						/* Create sync object for the new volume */
+		if (!ff_cre_syncobj((BYTE)vol, &fs->sobj)) return FR_INT_ERR;
+#endif
+	}
+	FatFs[vol] = fs;					/* Register new fs object */
+
+	if (opt == 0) return FR_OK;			/* Do not mount now, it will be mounted later */
+
+	res = mount_volume(&path, &fs, 0);	/* Force mounted the volume */
+	LEAVE_FF(fs, res);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Open or Create a File                                                 */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_open (
+	FIL* fp,			/* Pointer to the blank file object */
+	const TCHAR* path,	/* Pointer to the file name */
+	BYTE mode			/* Access mode and open mode flags */
+)
+{
+	FRESULT res;
+	DIR dj;
+	FATFS *fs;
+#if !FF_FS_READONLY
+	DWORD cl, bcs, clst, tm;
+	LBA_t sc;
+	FSIZE_t ofs;
+#endif
+	DEF_NAMBUF
+
+
+	if (!fp) return FR_INVALID_OBJECT;
+
+	/* Get logical drive number */
+	mode &= FF_FS_READONLY ? FA_READ : FA_READ | FA_WRITE | FA_CREATE_ALWAYS | FA_CREATE_NEW | FA_OPEN_ALWAYS | FA_OPEN_APPEND;
+	res = mount_volume(&path, &fs, mode);
+	if (res == FR_OK) {
+		dj.obj.fs = fs;
+		INIT_NAMBUF(fs);
+		res = follow_path(&dj, path);	/* Follow the file path */
+#if !FF_FS_READONLY	/* Read/Write configuration */
+		if (res == FR_OK) {
+			if (dj.fn[NSFLAG] & NS_NONAME) {	/* Origin directory itself? */
+				res = FR_INVALID_NAME;
+			}
+#if FF_FS_LOCK != 0
+			else {
+				res = chk_lock(&dj, (mode & ~FA_READ) ? 1 : 0);		/* Check if the file can be used */
+			}
+#endif
+		}
+		/* Create or Open a file */
+		if (mode & (FA_CREATE_ALWAYS | FA_OPEN_ALWAYS | FA_CREATE_NEW)) {
+			if (res != FR_OK) {					/* No file, create new */
+				if (res == FR_NO_FILE) {		/* There is no file to open, create a new entry */
+#if FF_FS_LOCK != 0
+					res = enq_lock() ? dir_register(&dj) : FR_TOO_MANY_OPEN_FILES;
+#else
+					res = dir_register(&dj);
+#endif
+				}
+				mode |= FA_CREATE_ALWAYS;		/* File is created */
+			}
+			else {								/* Any object with the same name is already existing */
+				if (dj.obj.attr & (AM_RDO | AM_DIR)) {	/* Cannot overwrite it (R/O or DIR) */
+					res = FR_DENIED;
+				} else {
+					if (mode & FA_CREATE_NEW) res = FR_EXIST;	/* Cannot create as new file */
+				}
+			}
+			if (res == FR_OK && (mode & FA_CREATE_ALWAYS)) {	/* Truncate the file if overwrite mode */
+#if FF_FS_EXFAT
+				if (fs->fs_type == FS_EXFAT) {
+					/* Get current allocation info */
+					fp->obj.fs = fs;
+					init_alloc_info(fs, &fp->obj);
+					/* Set directory entry block initial state */
+					memset(fs->dirbuf + 2, 0, 30);	/* Clear 85 entry except for NumSec */
+					memset(fs->dirbuf + 38, 0, 26);	/* Clear C0 entry except for NumName and NameHash */
+					fs->dirbuf[XDIR_Attr] = AM_ARC;
+					st_dword(fs->dirbuf + XDIR_CrtTime, GET_FATTIME());
+					fs->dirbuf[XDIR_GenFlags] = 1;
+					res = store_xdir(&dj);
+					if (res == FR_OK && fp->obj.sclust != 0) {	/* Remove the cluster chain if exist */
+						res = remove_chain(&fp->obj, fp->obj.sclust, 0);
+						fs->last_clst = fp->obj.sclust - 1;		/* Reuse the cluster hole */
+					}
+				} else
+#endif
+				{
+					/* Set directory entry initial state */
+					tm = GET_FATTIME();					/* Set created time */
+					st_dword(dj.dir + DIR_CrtTime, tm);
+					st_dword(dj.dir + DIR_ModTime, tm);
+					cl = ld_clust(fs, dj.dir);			/* Get current cluster chain */
+					dj.dir[DIR_Attr] = AM_ARC;			/* Reset attribute */
+					st_clust(fs, dj.dir, 0);			/* Reset file allocation info */
+					st_dword(dj.dir + DIR_FileSize, 0);
+					fs->wflag = 1;
+					if (cl != 0) {						/* Remove the cluster chain if exist */
+						sc = fs->winsect;
+						res = remove_chain(&dj.obj, cl, 0);
+						if (res == FR_OK) {
+							res = move_window(fs, sc);
+							fs->last_clst = cl - 1;		/* Reuse the cluster hole */
+						}
+					}
+				}
+			}
+		}
+		else {	/* Open an existing file */
+			if (res == FR_OK) {					/* Is the object exsiting? */
+				if (dj.obj.attr & AM_DIR) {		/* File open against a directory */
+					res = FR_NO_FILE;
+				} else {
+					if ((mode & FA_WRITE) && (dj.obj.attr & AM_RDO)) { /* Write mode open against R/O file */
+						res = FR_DENIED;
+					}
+				}
+			}
+		}
+		if (res == FR_OK) {
+			if (mode & FA_CREATE_ALWAYS) mode |= FA_MODIFIED;	/* Set file change flag if created or overwritten */
+			fp->dir_sect = fs->winsect;			/* Pointer to the directory entry */
+			fp->dir_ptr = dj.dir;
+#if FF_FS_LOCK != 0
+			fp->obj.lockid = inc_lock(&dj, (mode & ~FA_READ) ? 1 : 0);	/* Lock the file for this session */
+			if (fp->obj.lockid == 0) res = FR_INT_ERR;
+#endif
+		}
+#else		/* R/O configuration */
+		if (res == FR_OK) {
+			if (dj.fn[NSFLAG] & NS_NONAME) {	/* Is it origin directory itself? */
+				res = FR_INVALID_NAME;
+			} else {
+				if (dj.obj.attr & AM_DIR) {		/* Is it a directory? */
+					res = FR_NO_FILE;
+				}
+			}
+		}
+#endif
+
+		if (res == FR_OK) {
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {
+				fp->obj.c_scl = dj.obj.sclust;							/* Get containing directory info */
+				fp->obj.c_size = ((DWORD)dj.obj.objsize & 0xFFFFFF00) | dj.obj.stat;
+				fp->obj.c_ofs = dj.blk_ofs;
+				init_alloc_info(fs, &fp->obj);
+			} else
+#endif
+			{
+				fp->obj.sclust = ld_clust(fs, dj.dir);					/* Get object allocation info */
+				fp->obj.objsize = ld_dword(dj.dir + DIR_FileSize);
+			}
+#if FF_USE_FASTSEEK
+			fp->cltbl = 0;		/* Disable fast seek mode */
+#endif
+#if FF_USE_STREAM != 0
+			fp->strm_ext = fp->strm_top = fp->strm_end = 0;	/* Not in streaming mode */
+#endif
+			fp->obj.fs = fs;	/* Validate the file object */
+			fp->obj.id = fs->id;
+#if FF_ALLOC_WIN != 0
+			if (mode & FA_WRITE) alc_get(&fp->obj, 2);	/* Give the file an allocation window */
+#endif
+			fp->flag = mode;	/* Set file access mode */
+			fp->err = 0;		/* Clear error flag */
+			fp->sect = 0;		/* Invalidate current data sector */
+			fp->fptr = 0;		/* Set file pointer top of the file */
+#if FF_FBUF_POOL != 0
+			fbuf_get(fp);		/* Get the file buffer from the pool */
+#endif
+#if !FF_FS_READONLY
+#if !FF_FS_TINY
+			memset(fp->buf, 0, sizeof fp->buf);	/* Clear sector buffer */
+#endif
+			if ((mode & FA_SEEKEND) && fp->obj.objsize > 0) {	/* Seek to end of file if FA_OPEN_APPEND is specified */
+				fp->fptr = fp->obj.objsize;			/* Offset to seek */
+				bcs = (DWORD)fs->csize * SS(fs);	/* Cluster size in byte */
+				clst = fp->obj.sclust;				/* Follow the cluster chain */
+				for (ofs = fp->obj.objsize; res == FR_OK && ofs > bcs; ofs -= bcs) {
+					clst = get_fat(&fp->obj, clst);
+					if (clst <= 1) res = FR_INT_ERR;
+					if (clst == 0xFFFFFFFF) res = FR_DISK_ERR;
+				}
+				fp->clust = clst;
+				if (res == FR_OK && ofs % SS(fs)) {	/* Fill sector buffer if not on the sector boundary */
+					sc = clst2sect(fs, clst);
+					if (sc == 0) {
+						res = FR_INT_ERR;
+					} else {
+#if FF_FBUF_POOL != 0
+						if (fbuf_load(fp, sc + (DWORD)(ofs / SS(fs))) != FR_OK) res = FR_DISK_ERR;
+#else
+						fp->sect = sc + (DWORD)(ofs / SS(fs));
+#if !FF_FS_TINY
+						if (disk_read(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) res = FR_DISK_ERR;
+#endif
+#endif
+					}
+				}
+#if FF_FS_LOCK != 0
+				if (res != FR_OK) dec_lock(fp->obj.lockid); /* Decrement file open counter if seek failed */
+#endif
+#if FF_FBUF_POOL != 0
+				if (res != FR_OK) fbuf_put(fp);	/* Return the file buffer if seek failed */
+#endif
+			}
+#endif
+		}
+
+		FREE_NAMBUF();
+	}
+
+	if (res != FR_OK) fp->obj.fs = 0;	/* Invalidate file object on error */
+
+	LEAVE_FF(fs, res);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Read File                                                             */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_read (
+	FIL* fp, 	/* Open file to be read */
+	void* buff,	/* Data buffer to store the read data */
+	UINT btr,	/* Number of bytes to read */
+	UINT* br	/* Number of bytes read */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD clst;
+	LBA_t sect;
+	FSIZE_t remain;
+	UINT rcnt, cc, csect;
+	BYTE *rbuff = (BYTE*)buff;
+#if FF_FS_REENTRANT && FF_SYNC_SLICE != 0
+	UINT slc = 0;
+#endif
+#if FF_FBUF_POOL != 0 && !FF_FS_READONLY
+	UINT i;
 #endif
-#if FF_FS_REENTRANT						/* Discard sync object of the current volume */
-		if (!ff_del_syncobj(cfs->sobj)) return FR_INT_ERR;
+
+
+	*br = 0;	/* Clear read byte counter */
+	res = validate(&fp->obj, &fs);				/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);	/* Check validity */
+	if (!(fp->flag & FA_READ)) LEAVE_FF(fs, FR_DENIED); /* Check access mode */
+	remain = fp->obj.objsize - fp->fptr;
+	if (btr > remain) btr = (UINT)remain;		/* Truncate btr by remaining bytes */
+
+	for ( ; btr > 0; btr -= rcnt, *br += rcnt, rbuff += rcnt, fp->fptr += rcnt) {	/* Repeat until btr bytes read */
+#if FF_FS_REENTRANT && FF_SYNC_SLICE != 0
+		if (slc >= FF_SYNC_SLICE) {	/* Let other tasks access the volume after a slice of direct transfer */
+			slc = 0;
+			ff_pass_grant(fs->sobj);		/* Hand the grant over to the waiting tasks */
+			res = validate(&fp->obj, &fs);	/* Get the grant again and check if the volume is still valid */
+			if (res != FR_OK) LEAVE_FF(fs, res);
+		}
+#endif
+		if (fp->fptr % SS(fs) == 0) {			/* On the sector boundary? */
+			csect = (UINT)(fp->fptr / SS(fs) & (fs->csize - 1));	/* Sector offset in the cluster */
+			if (csect == 0) {					/* On the cluster boundary? */
+				if (fp->fptr == 0) {			/* On the top of the file? */
+					clst = fp->obj.sclust;		/* Follow cluster chain from the origin */
+				} else {						/* Middle or end of the file */
+#if FF_USE_FASTSEEK
+					if (fp->cltbl) {
+						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
+					} else
+#endif
+					{
+						clst = get_fat(&fp->obj, fp->clust);	/* Follow cluster chain on the FAT */
+					}
+				}
+				if (clst < 2) ABORT(fs, FR_INT_ERR);
+				if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
+				fp->clust = clst;				/* Update current cluster */
+			}
+			sect = clst2sect(fs, fp->clust);	/* Get current sector */
+			if (sect == 0) ABORT(fs, FR_INT_ERR);
+			sect += csect;
+			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
+#if FF_FBUF_POOL != 0
+			if (cc < fp->mbsz || sect - fp->mtop < fp->mbcnt) cc = 0;	/* Read via the file buffer if it is short or in the buffer */
+#endif
+			if (cc > 0) {						/* Read maximum contiguous sectors directly */
+				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
+					cc = fs->csize - csect;
+				}
+#if FF_FS_REENTRANT && FF_SYNC_SLICE != 0
+				if (cc > FF_SYNC_SLICE) cc = FF_SYNC_SLICE;	/* Clip at the slice size */
+				slc += cc;
+#endif
+				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
+#if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2		/* Replace one of the read sectors with cached data if it contains a dirty sector */
+#if FF_FS_TINY
+				if (fs->wflag && fs->winsect - sect < cc) {
+					memcpy(rbuff + ((fs->winsect - sect) * SS(fs)), fs->win, SS(fs));
+				}
+#elif FF_FBUF_POOL != 0
+				if (fp->flag & FA_DIRTY) {
+					for (i = 0; i < fp->mbdty; i++) {
+						if (fp->mtop + i - sect < cc) memcpy(rbuff + (UINT)(fp->mtop + i - sect) * SS(fs), fp->mbuf + i * SS(fs), SS(fs));
+					}
+				}
+#else
+				if ((fp->flag & FA_DIRTY) && fp->sect - sect < cc) {
+					memcpy(rbuff + ((fp->sect - sect) * SS(fs)), fp->buf, SS(fs));
+				}
+#endif
+#endif
+				rcnt = SS(fs) * cc;				/* Number of bytes transferred */
+				continue;
+			}
+#if FF_FBUF_POOL != 0
+			if (fbuf_load(fp, sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move the file buffer to the sector */
+#elif !FF_FS_TINY
+			if (fp->sect != sect) {			/* Load data sector if not in cache */
+#if !FF_FS_READONLY
+				if (fp->flag & FA_DIRTY) {		/* Write-back dirty sector cache */
+					if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
+					fp->flag &= (BYTE)~FA_DIRTY;
+				}
+#endif
+				if (disk_read(fs->pdrv, fp->buf, sect, 1) != RES_OK)	ABORT(fs, FR_DISK_ERR);	/* Fill sector cache */
+			}
+#endif
+			fp->sect = sect;
+		}
+		rcnt = SS(fs) - (UINT)fp->fptr % SS(fs);	/* Number of bytes remains in the sector */
+		if (rcnt > btr) rcnt = btr;					/* Clip it by btr if needed */
+#if FF_FS_TINY
+		if (move_window(fs, fp->sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move sector window */
+		memcpy(rbuff, fs->win + fp->fptr % SS(fs), rcnt);	/* Extract partial sector */
+#elif FF_FBUF_POOL != 0
+		memcpy(rbuff, FBUF_PTR(fp) + fp->fptr % SS(fs), rcnt);	/* Extract partial sector */
+#else
+		memcpy(rbuff, fp->buf + fp->fptr % SS(fs), rcnt);	/* Extract partial sector */
+#endif
+	}
+
+	LEAVE_FF(fs, FR_OK);
+}
+
+
+
+
+#if !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Write File                                                            */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_write (
+	FIL* fp,			/* Open file to be written */
+	const void* buff,	/* Data to be written */
+	UINT btw,			/* Number of bytes to write */
+	UINT* bw			/* Number of bytes written */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD clst;
+	LBA_t sect;
+	UINT wcnt, cc, csect;
+	const BYTE *wbuff = (const BYTE*)buff;
+#if FF_FS_REENTRANT && FF_SYNC_SLICE != 0
+	UINT slc = 0;
+#endif
+#if FF_FBUF_POOL != 0
+	UINT i;
+#endif
+
+
+	*bw = 0;	/* Clear write byte counter */
+	res = validate(&fp->obj, &fs);			/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);	/* Check validity */
+	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
+
+	/* Check fptr wrap-around (file size cannot reach 4 GiB at FAT volume) */
+	if ((!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) && (DWORD)(fp->fptr + btw) < (DWORD)fp->fptr) {
+		btw = (UINT)(0xFFFFFFFF - (DWORD)fp->fptr);
+	}
+
+	for ( ; btw > 0; btw -= wcnt, *bw += wcnt, wbuff += wcnt, fp->fptr += wcnt, fp->obj.objsize = (fp->fptr > fp->obj.objsize) ? fp->fptr : fp->obj.objsize) {	/* Repeat until all data written */
+#if FF_FS_REENTRANT && FF_SYNC_SLICE != 0
+		if (slc >= FF_SYNC_SLICE) {	/* Let other tasks access the volume after a slice of direct transfer */
+			slc = 0;
+			ff_pass_grant(fs->sobj);		/* Hand the grant over to the waiting tasks */
+			res = validate(&fp->obj, &fs);	/* Get the grant again and check if the volume is still valid */
+			if (res != FR_OK) LEAVE_FF(fs, res);
+		}
+#endif
+		if (fp->fptr % SS(fs) == 0) {		/* On the sector boundary? */
+			csect = (UINT)(fp->fptr / SS(fs)) & (fs->csize - 1);	/* Sector offset in the cluster */
+			if (csect == 0) {				/* On the cluster boundary? */
+#if FF_USE_STREAM != 0
+				if (fp->strm_ext) {			/* In streaming mode? */
+					clst = strm_next(fp);	/* Follow the chain or get next cluster in the reserved block */
+				} else
+#endif
+#if FF_ALLOC_WIN != 0
+				alc_get(&fp->obj, 1);		/* Get an allocation window if the file could not get it at open */
+#endif
+				if (fp->fptr == 0) {		/* On the top of the file? */
+					clst = fp->obj.sclust;	/* Follow from the origin */
+					if (clst == 0) {		/* If no cluster is allocated, */
+						clst = create_chain(&fp->obj, 0);	/* create a new cluster chain */
+					}
+				} else {					/* On the middle or end of the file */
+#if FF_USE_FASTSEEK
+					if (fp->cltbl) {
+						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
+					} else
+#endif
+					{
+						clst = create_chain(&fp->obj, fp->clust);	/* Follow or stretch cluster chain on the FAT */
+					}
+				}
+				if (clst == 0) break;		/* Could not allocate a new cluster (disk full) */
+				if (clst == 1) ABORT(fs, FR_INT_ERR);
+				if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
+				fp->clust = clst;			/* Update current cluster */
+				if (fp->obj.sclust == 0) fp->obj.sclust = clst;	/* Set start cluster if the first write */
+			}
+#if FF_FS_TINY
+			if (fs->winsect == fp->sect && sync_window(fs) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Write-back sector cache */
+#elif FF_FBUF_POOL == 0
+			if (fp->flag & FA_DIRTY) {		/* Write-back sector cache */
+				if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
+				fp->flag &= (BYTE)~FA_DIRTY;
+			}
+#endif
+			sect = clst2sect(fs, fp->clust);	/* Get current sector */
+			if (sect == 0) ABORT(fs, FR_INT_ERR);
+			sect += csect;
+			cc = btw / SS(fs);				/* When remaining bytes >= sector size, */
+#if FF_FBUF_POOL != 0
+			if (cc < fp->mbsz || sect - fp->mtop < fp->mbcnt) cc = 0;	/* Write via the file buffer if it is short or in the buffer */
+#endif
+			if (cc > 0) {					/* Write maximum contiguous sectors directly */
+#if FF_USE_STREAM != 0
+				if (IN_STRM_BLK(fp, fp->clust)) {	/* In the reserved block? */
+					if (cc > (fp->strm_end - fp->clust) * fs->csize - csect) {	/* Clip at end of the block */
+						cc = (fp->strm_end - fp->clust) * fs->csize - csect;
+					}
+				} else
+#endif
+				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
+					cc = fs->csize - csect;
+				}
+#if FF_FS_REENTRANT && FF_SYNC_SLICE != 0
+				if (cc > FF_SYNC_SLICE) cc = FF_SYNC_SLICE;	/* Clip at the slice size */
+				slc += cc;
+#endif
+				if (disk_write(fs->pdrv, wbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
+#if FF_USE_STREAM != 0
+				fp->clust += (csect + cc - 1) / fs->csize;	/* Move to the last cluster written */
+#endif
+#if FF_FS_MINIMIZE <= 2
+#if FF_FS_TINY
+				if (fs->winsect - sect < cc) {	/* Refill sector cache if it gets invalidated by the direct write */
+					memcpy(fs->win, wbuff + ((fs->winsect - sect) * SS(fs)), SS(fs));
+					fs->wflag = 0;
+				}
+#elif FF_FBUF_POOL != 0
+				for (i = 0; i < fp->mbcnt; i++) {	/* Refill the file buffer if it gets invalidated by the direct write */
+					if (fp->mtop + i - sect < cc) memcpy(fp->mbuf + i * SS(fs), wbuff + (UINT)(fp->mtop + i - sect) * SS(fs), SS(fs));
+				}
+				if ((fp->flag & FA_DIRTY) && fp->mtop - sect < cc && fp->mtop + fp->mbdty - 1 - sect < cc) {	/* Have all dirty sectors been overwritten? */
+					fp->flag &= (BYTE)~FA_DIRTY;
+					fp->mbdty = 0;
+				}
+#else
+				if (fp->sect - sect < cc) { /* Refill sector cache if it gets invalidated by the direct write */
+					memcpy(fp->buf, wbuff + ((fp->sect - sect) * SS(fs)), SS(fs));
+					fp->flag &= (BYTE)~FA_DIRTY;
+				}
+#endif
+#endif
+				wcnt = SS(fs) * cc;		/* Number of bytes transferred */
+				continue;
+			}
+#if FF_FS_TINY
+			if (fp->fptr >= fp->obj.objsize) {	/* Avoid silly cache filling on the growing edge */
+				if (sync_window(fs) != FR_OK) ABORT(fs, FR_DISK_ERR);
+				fs->winsect = sect;
+			}
+#elif FF_FBUF_POOL != 0
+			if (fbuf_load(fp, sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move the file buffer to the sector */
+#else
+			if (fp->sect != sect && 		/* Fill sector cache with file data */
+				fp->fptr < fp->obj.objsize &&
+				disk_read(fs->pdrv, fp->buf, sect, 1) != RES_OK) {
+					ABORT(fs, FR_DISK_ERR);
+			}
+#endif
+			fp->sect = sect;
+		}
+		wcnt = SS(fs) - (UINT)fp->fptr % SS(fs);	/* Number of bytes remains in the sector */
+		if (wcnt > btw) wcnt = btw;					/* Clip it by btw if needed */
+#if FF_FS_TINY
+		if (move_window(fs, fp->sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move sector window */
+		memcpy(fs->win + fp->fptr % SS(fs), wbuff, wcnt);	/* Fit data to the sector */
+		fs->wflag = 1;
+#elif FF_FBUF_POOL != 0
+		memcpy(FBUF_PTR(fp) + fp->fptr % SS(fs), wbuff, wcnt);	/* Fit data to the sector */
+		if (fp->sect - fp->mtop >= fp->mbdty) fp->mbdty = (UINT)(fp->sect - fp->mtop) + 1;	/* Stretch the dirty part */
+		fp->flag |= FA_DIRTY;
+#else
+		memcpy(fp->buf + fp->fptr % SS(fs), wbuff, wcnt);	/* Fit data to the sector */
+		fp->flag |= FA_DIRTY;
 #endif
-		cfs->fs_type = 0;				/* Clear old fs object */
 	}
 
-	if (fs) {
-		fs->fs_type = 0;				/* Clear new fs object */
-#if FF_FS_REENTRANT						/* Create sync object for the new volume */
-		if (!ff_cre_syncobj((BYTE)vol, &fs->sobj)) return FR_INT_ERR;
+	fp->flag |= FA_MODIFIED;				/* Set file change flag */
+
+	LEAVE_FF(fs, FR_OK);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Synchronize the File                                                  */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_sync (
+	FIL* fp		/* Open file to be synced */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD tm;
+	BYTE *dir;
+
+
+	res = validate(&fp->obj, &fs);	/* Check validity of the file object */
+	if (res == FR_OK) {
+		if (fp->flag & FA_MODIFIED) {	/* Is there any change to the file? */
+#if FF_USE_STREAM != 0
+			res = strm_commit(fp);		/* Commit written part of the reserved block */
+			if (res != FR_OK) LEAVE_FF(fs, res);
+#endif
+#if FF_FBUF_POOL != 0
+			if (fbuf_flush(fp) != FR_OK) LEAVE_FF(fs, FR_DISK_ERR);	/* Write-back cached data if needed */
+#elif !FF_FS_TINY
+			if (fp->flag & FA_DIRTY) {	/* Write-back cached data if needed */
+				if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) LEAVE_FF(fs, FR_DISK_ERR);
+				fp->flag &= (BYTE)~FA_DIRTY;
+			}
+#endif
+			/* Update the directory entry */
+			tm = GET_FATTIME();				/* Modified time */
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {
+				res = fill_first_frag(&fp->obj);	/* Fill first fragment on the FAT if needed */
+				if (res == FR_OK) {
+					res = fill_last_frag(&fp->obj, fp->clust, 0xFFFFFFFF);	/* Fill last fragment on the FAT if needed */
+				}
+				if (res == FR_OK) {
+					DIR dj;
+					DEF_NAMBUF
+
+					INIT_NAMBUF(fs);
+					res = load_obj_xdir(&dj, &fp->obj);	/* Load directory entry block */
+					if (res == FR_OK) {
+						fs->dirbuf[XDIR_Attr] |= AM_ARC;				/* Set archive attribute to indicate that the file has been changed */
+						fs->dirbuf[XDIR_GenFlags] = fp->obj.stat | 1;	/* Update file allocation information */
+						st_dword(fs->dirbuf + XDIR_FstClus, fp->obj.sclust);		/* Update start cluster */
+						st_qword(fs->dirbuf + XDIR_FileSize, fp->obj.objsize);		/* Update file size */
+						st_qword(fs->dirbuf + XDIR_ValidFileSize, fp->obj.objsize);	/* (FatFs does not support Valid File Size feature) */
+						st_dword(fs->dirbuf + XDIR_ModTime, tm);		/* Update modified time */
+						fs->dirbuf[XDIR_ModTime10] = 0;
+						st_dword(fs->dirbuf + XDIR_AccTime, 0);
+						res = store_xdir(&dj);	/* Restore it to the directory */
+						if (res == FR_OK) {
+							res = sync_fs(fs);
+							fp->flag &= (BYTE)~FA_MODIFIED;
+						}
+					}
+					FREE_NAMBUF();
+				}
+			} else
 #endif
+			{
+				res = move_window(fs, fp->dir_sect);
+				if (res == FR_OK) {
+					dir = fp->dir_ptr;
+					dir[DIR_Attr] |= AM_ARC;						/* Set archive attribute to indicate that the file has been changed */
+					st_clust(fp->obj.fs, dir, fp->obj.sclust);		/* Update file allocation information  */
+					st_dword(dir + DIR_FileSize, (DWORD)fp->obj.objsize);	/* Update file size */
+					st_dword(dir + DIR_ModTime, tm);				/* Update modified time */
+					st_word(dir + DIR_LstAccDate, 0);
+					fs->wflag = 1;
+					res = sync_fs(fs);					/* Restore it to the directory */
+					fp->flag &= (BYTE)~FA_MODIFIED;
+				}
+			}
+		}
 	}
-	FatFs[vol] = fs;					/* Register new fs object */
-
-	if (opt == 0) return FR_OK;			/* Do not mount now, it will be mounted later */
 
-	res = mount_volume(&path, &fs, 0);	/* Force mounted the volume */
 	LEAVE_FF(fs, res);
 }
 
+#endif /* !FF_FS_READONLY */
+
 
 
 
 /*-----------------------------------------------------------------------*/
-/* Open or Create a File                                                 */
+/* Close File                                                            */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_open (
-	FIL* fp,			/* Pointer to the blank file object */
-	const TCHAR* path,	/* Pointer to the file name */
-	BYTE mode			/* Access mode and open mode flags */
+FRESULT f_close (
+	FIL* fp		/* Open file to be closed */
 )
 {
 	FRESULT res;
-	DIR dj;
 	FATFS *fs;
+#if FF_USE_STREAM != 0
+	UINT i;
+#endif
+#if FF_ALLOC_WIN != 0
+	ALCWIN *wp;
+#endif
+
 #if !FF_FS_READONLY
-	DWORD cl, bcs, clst, tm;
-	LBA_t sc;
-	FSIZE_t ofs;
+	res = f_sync(fp);					/* Flush cached data */
+#if FF_USE_STREAM != 0
+	if (res != FR_OK && validate(&fp->obj, &fs) == FR_OK) {	/* Leave streaming mode even if the file could not be flushed */
+		for (i = 0; i < FF_USE_STREAM; i++) {
+			if (StrmFiles[i] == fp) StrmFiles[i] = 0;
+		}
+		fp->strm_ext = fp->strm_top = fp->strm_end = 0;
+#if FF_FS_REENTRANT
+		unlock_fs(fs, FR_OK);
 #endif
-	DEF_NAMBUF
+	}
+#endif
+	if (res == FR_OK)
+#endif
+	{
+		res = validate(&fp->obj, &fs);	/* Lock volume */
+		if (res == FR_OK) {
+#if FF_USE_STREAM != 0
+			for (i = 0; i < FF_USE_STREAM; i++) {	/* Leave streaming mode (release the reserved block) */
+				if (StrmFiles[i] == fp) StrmFiles[i] = 0;
+			}
+#endif
+#if FF_ALLOC_WIN != 0
+			wp = alc_get(&fp->obj, 0);
+			if (wp) wp->fs = 0;	/* Release the allocation window */
+#endif
+#if FF_FBUF_POOL != 0
+			fbuf_put(fp);	/* Return the file buffer to the pool */
+#endif
+#if FF_FS_SNAPSHOT
+			snap_save(fs, 0);	/* Save the mount snapshot if it has not been saved in the session */
+#endif
+#if FF_FS_LOCK != 0
+			res = dec_lock(fp->obj.lockid);		/* Decrement file open counter */
+			if (res == FR_OK) fp->obj.fs = 0;	/* Invalidate file object */
+#else
+			fp->obj.fs = 0;	/* Invalidate file object */
+#endif
+#if FF_FS_REENTRANT
+			unlock_fs(fs, FR_OK);		/* Unlock volume */
+#endif
+		}
+	}
+	return res;
+}
 
 
-	if (!fp) return FR_INVALID_OBJECT;
+
+
+#if FF_FS_RPATH >= 1
+/*-----------------------------------------------------------------------*/
+/* Change Current Directory or Current Drive, Get Current Directory      */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_chdrive (
+	const TCHAR* path		/* Drive number to set */
+)
+{
+	int vol;
+
 
 	/* Get logical drive number */
-	mode &= FF_FS_READONLY ? FA_READ : FA_READ | FA_WRITE | FA_CREATE_ALWAYS | FA_CREATE_NEW | FA_OPEN_ALWAYS | FA_OPEN_APPEND;
-	res = mount_volume(&path, &fs, mode);
+	vol = get_ldnumber(&path);
+	if (vol < 0) return FR_INVALID_DRIVE;
+	CurrVol = (BYTE)vol;	/* Set it as current volume */
+
+	return FR_OK;
+}
+
+
+
+FRESULT f_chdir (
+	const TCHAR* path	/* Pointer to the directory path */
+)
+{
+#if FF_STR_VOLUME_ID == 2
+	UINT i;
+#endif
+	FRESULT res;
+	DIR dj;
+	FATFS *fs;
+	DEF_NAMBUF
+
+
+	/* Get logical drive */
+	res = mount_volume(&path, &fs, 0);
 	if (res == FR_OK) {
 		dj.obj.fs = fs;
 		INIT_NAMBUF(fs);
-		res = follow_path(&dj, path);	/* Follow the file path */
-#if !FF_FS_READONLY	/* Read/Write configuration */
-		if (res == FR_OK) {
-			if (dj.fn[NSFLAG] & NS_NONAME) {	/* Origin directory itself? */
-				res = FR_INVALID_NAME;
-			}
-#if FF_FS_LOCK != 0
-			else {
-				res = chk_lock(&dj, (mode & ~FA_READ) ? 1 : 0);		/* Check if the file can be used */
-			}
-#endif
-		}
-		/* Create or Open a file */
-		if (mode & (FA_CREATE_ALWAYS | FA_OPEN_ALWAYS | FA_CREATE_NEW)) {
-			if (res != FR_OK) {					/* No file, create new */
-				if (res == FR_NO_FILE) {		/* There is no file to open, create a new entry */
-#if FF_FS_LOCK != 0
-					res = enq_lock() ? dir_register(&dj) : FR_TOO_MANY_OPEN_FILES;
-#else
-					res = dir_register(&dj);
-#endif
-				}
-				mode |= FA_CREATE_ALWAYS;		/* File is created */
-			}
-			else {								/* Any object with the same name is already existing */
-				if (dj.obj.attr & (AM_RDO | AM_DIR)) {	/* Cannot overwrite it (R/O or DIR) */
-					res = FR_DENIED;
-				} else {
-					if (mode & FA_CREATE_NEW) res = FR_EXIST;	/* Cannot create as new file */
-				}
-			}
-			if (res == FR_OK && (mode & FA_CREATE_ALWAYS)) {	/* Truncate the file if overwrite mode */
+		res = follow_path(&dj, path);		/* Follow the path */
+		if (res == FR_OK) {					/* Follow completed */
+			if (dj.fn[NSFLAG] & NS_NONAME) {	/* Is it the start directory itself? */
+				fs->cdir = dj.obj.sclust;
 #if FF_FS_EXFAT
 				if (fs->fs_type == FS_EXFAT) {
-					/* Get current allocation info */
-					fp->obj.fs = fs;
-					init_alloc_info(fs, &fp->obj);
-					/* Set directory entry block initial state */
-					memset(fs->dirbuf + 2, 0, 30);	/* Clear 85 entry except for NumSec */
-					memset(fs->dirbuf + 38, 0, 26);	/* Clear C0 entry except for NumName and NameHash */
-					fs->dirbuf[XDIR_Attr] = AM_ARC;
-					st_dword(fs->dirbuf + XDIR_CrtTime, GET_FATTIME());
-					fs->dirbuf[XDIR_GenFlags] = 1;
-					res = store_xdir(&dj);
-					if (res == FR_OK && fp->obj.sclust != 0) {	/* Remove the cluster chain if exist */
-						res = remove_chain(&fp->obj, fp->obj.sclust, 0);
-						fs->last_clst = fp->obj.sclust - 1;		/* Reuse the cluster hole */
-					}
-				} else
+					fs->cdc_scl = dj.obj.c_scl;
+					fs->cdc_size = dj.obj.c_size;
+					fs->cdc_ofs = dj.obj.c_ofs;
+				}
 #endif
-				{
-					/* Set directory entry initial state */
-					tm = GET_FATTIME();					/* Set created time */
-					st_dword(dj.dir + DIR_CrtTime, tm);
-					st_dword(dj.dir + DIR_ModTime, tm);
-					cl = ld_clust(fs, dj.dir);			/* Get current cluster chain */
-					dj.dir[DIR_Attr] = AM_ARC;			/* Reset attribute */
-					st_clust(fs, dj.dir, 0);			/* Reset file allocation info */
-					st_dword(dj.dir + DIR_FileSize, 0);
-					fs->wflag = 1;
-					if (cl != 0) {						/* Remove the cluster chain if exist */
-						sc = fs->winsect;
-						res = remove_chain(&dj.obj, cl, 0);
-						if (res == FR_OK) {
-							res = move_window(fs, sc);
-							fs->last_clst = cl - 1;		/* Reuse the cluster hole */
-						}
+			} else {
+				if (dj.obj.attr & AM_DIR) {	/* It is a sub-directory */
+#if FF_FS_EXFAT
+					if (fs->fs_type == FS_EXFAT) {
+						fs->cdir = ld_dword(fs->dirbuf + XDIR_FstClus);		/* Sub-directory cluster */
+						fs->cdc_scl = dj.obj.sclust;						/* Save containing directory information */
+						fs->cdc_size = ((DWORD)dj.obj.objsize & 0xFFFFFF00) | dj.obj.stat;
+						fs->cdc_ofs = dj.blk_ofs;
+					} else
+#endif
+					{
+						fs->cdir = ld_clust(fs, dj.dir);					/* Sub-directory cluster */
 					}
-				}
-			}
-		}
-		else {	/* Open an existing file */
-			if (res == FR_OK) {					/* Is the object exsiting? */
-				if (dj.obj.attr & AM_DIR) {		/* File open against a directory */
-					res = FR_NO_FILE;
 				} else {
-					if ((mode & FA_WRITE) && (dj.obj.attr & AM_RDO)) { /* Write mode open against R/O file */
-						res = FR_DENIED;
-					}
+					res = FR_NO_PATH;		/* Reached but a file */
 				}
 			}
 		}
+		FREE_NAMBUF();
+		if (res == FR_NO_FILE) res = FR_NO_PATH;
+#if FF_STR_VOLUME_ID == 2	/* Also current drive is changed if in Unix style volume ID */
 		if (res == FR_OK) {
-			if (mode & FA_CREATE_ALWAYS) mode |= FA_MODIFIED;	/* Set file change flag if created or overwritten */
-			fp->dir_sect = fs->winsect;			/* Pointer to the directory entry */
-			fp->dir_ptr = dj.dir;
-#if FF_FS_LOCK != 0
-			fp->obj.lockid = inc_lock(&dj, (mode & ~FA_READ) ? 1 : 0);	/* Lock the file for this session */
-			if (fp->obj.lockid == 0) res = FR_INT_ERR;
+			for (i = FF_VOLUMES - 1; i && fs != FatFs[i]; i--) ;	/* Set current drive */
+			CurrVol = (BYTE)i;
+		}
+#endif
+	}
+
+	LEAVE_FF(fs, res);
+}
+
+
+#if FF_FS_RPATH >= 2
+FRESULT f_getcwd (
+	TCHAR* buff,	/* Pointer to the directory path */
+	UINT len		/* Size of buff in unit of TCHAR */
+)
+{
+	FRESULT res;
+	DIR dj;
+	FATFS *fs;
+	UINT i, n;
+	DWORD ccl;
+	TCHAR *tp = buff;
+#if FF_VOLUMES >= 2
+	UINT vl;
+#if FF_STR_VOLUME_ID
+	const char *vp;
 #endif
-		}
-#else		/* R/O configuration */
-		if (res == FR_OK) {
-			if (dj.fn[NSFLAG] & NS_NONAME) {	/* Is it origin directory itself? */
-				res = FR_INVALID_NAME;
-			} else {
-				if (dj.obj.attr & AM_DIR) {		/* Is it a directory? */
-					res = FR_NO_FILE;
+#endif
+	FILINFO fno;
+	DEF_NAMBUF
+
+
+	/* Get logical drive */
+	buff[0] = 0;	/* Set null string to get current volume */
+	res = mount_volume((const TCHAR**)&buff, &fs, 0);	/* Get current volume */
+	if (res == FR_OK) {
+		dj.obj.fs = fs;
+		INIT_NAMBUF(fs);
+
+		/* Follow parent directories and create the path */
+		i = len;			/* Bottom of buffer (directory stack base) */
+		if (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) {	/* (Cannot do getcwd on exFAT and returns root path) */
+			dj.obj.sclust = fs->cdir;				/* Start to follow upper directory from current directory */
+			while ((ccl = dj.obj.sclust) != 0) {	/* Repeat while current directory is a sub-directory */
+				res = dir_sdi(&dj, 1 * SZDIRE);	/* Get parent directory */
+				if (res != FR_OK) break;
+				res = move_window(fs, dj.sect);
+				if (res != FR_OK) break;
+				dj.obj.sclust = ld_clust(fs, dj.dir);	/* Goto parent directory */
+				res = dir_sdi(&dj, 0);
+				if (res != FR_OK) break;
+				do {							/* Find the entry links to the child directory */
+					res = DIR_READ_FILE(&dj);
+					if (res != FR_OK) break;
+					if (ccl == ld_clust(fs, dj.dir)) break;	/* Found the entry */
+					res = dir_next(&dj, 0);
+				} while (res == FR_OK);
+				if (res == FR_NO_FILE) res = FR_INT_ERR;/* It cannot be 'not found'. */
+				if (res != FR_OK) break;
+				get_fileinfo(&dj, &fno);		/* Get the directory name and push it to the buffer */
+				for (n = 0; fno.fname[n]; n++) ;	/* Name length */
+				if (i < n + 1) {	/* Insufficient space to store the path name? */
+					res = FR_NOT_ENOUGH_CORE; break;
 				}
+				while (n) buff[--i] = fno.fname[--n];	/* Stack the name */
+				buff[--i] = '/';
 			}
 		}
-#endif
-
 		if (res == FR_OK) {
-#if FF_FS_EXFAT
-			if (fs->fs_type == FS_EXFAT) {
-				fp->obj.c_scl = dj.obj.sclust;							/* Get containing directory info */
-				fp->obj.c_size = ((DWORD)dj.obj.objsize & 0xFFFFFF00) | dj.obj.stat;
-				fp->obj.c_ofs = dj.blk_ofs;
-				init_alloc_info(fs, &fp->obj);
-			} else
-#endif
-			{
-				fp->obj.sclust = ld_clust(fs, dj.dir);					/* Get object allocation info */
-				fp->obj.objsize = ld_dword(dj.dir + DIR_FileSize);
+			if (i == len) buff[--i] = '/';	/* Is it the root-directory? */
+#if FF_VOLUMES >= 2			/* Put drive prefix */
+			vl = 0;
+#if FF_STR_VOLUME_ID >= 1	/* String volume ID */
+			for (n = 0, vp = (const char*)VolumeStr[CurrVol]; vp[n]; n++) ;
+			if (i >= n + 2) {
+				if (FF_STR_VOLUME_ID == 2) *tp++ = (TCHAR)'/';
+				for (vl = 0; vl < n; *tp++ = (TCHAR)vp[vl], vl++) ;
+				if (FF_STR_VOLUME_ID == 1) *tp++ = (TCHAR)':';
+				vl++;
+			}
+#else						/* Numeric volume ID */
+			if (i >= 3) {
+				*tp++ = (TCHAR)'0' + CurrVol;
+				*tp++ = (TCHAR)':';
+				vl = 2;
 			}
-#if FF_USE_FASTSEEK
-			fp->cltbl = 0;		/* Disable fast seek mode */
-#endif
-			fp->obj.fs = fs;	/* Validate the file object */
-			fp->obj.id = fs->id;
-			fp->flag = mode;	/* Set file access mode */
-			fp->err = 0;		/* Clear error flag */
-			fp->sect = 0;		/* Invalidate current data sector */
-			fp->fptr = 0;		/* Set file pointer top of the file */
-#if !FF_FS_READONLY
-#if !FF_FS_TINY
-			memset(fp->buf, 0, sizeof fp->buf);	/* Clear sector buffer */
-#endif
-			if ((mode & FA_SEEKEND) && fp->obj.objsize > 0) {	/* Seek to end of file if FA_OPEN_APPEND is specified */
-				fp->fptr = fp->obj.objsize;			/* Offset to seek */
-				bcs = (DWORD)fs->csize * SS(fs);	/* Cluster size in byte */
-				clst = fp->obj.sclust;				/* Follow the cluster chain */
-				for (ofs = fp->obj.objsize; res == FR_OK && ofs > bcs; ofs -= bcs) {
-					clst = get_fat(&fp->obj, clst);
-					if (clst <= 1) res = FR_INT_ERR;
-					if (clst == 0xFFFFFFFF) res = FR_DISK_ERR;
-				}
-				fp->clust = clst;
-				if (res == FR_OK && ofs % SS(fs)) {	/* Fill sector buffer if not on the sector boundary */
-					sc = clst2sect(fs, clst);
-					if (sc == 0) {
-						res = FR_INT_ERR;
-					} else {
-						fp->sect = sc + (DWORD)(ofs / SS(fs));
-#if !FF_FS_TINY
-						if (disk_read(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) res = FR_DISK_ERR;
 #endif
-					}
-				}
-#if FF_FS_LOCK != 0
-				if (res != FR_OK) dec_lock(fp->obj.lockid); /* Decrement file open counter if seek failed */
+			if (vl == 0) res = FR_NOT_ENOUGH_CORE;
 #endif
+			/* Add current directory path */
+			if (res == FR_OK) {
+				do *tp++ = buff[i++]; while (i < len);	/* Copy stacked path string */
 			}
-#endif
 		}
-
 		FREE_NAMBUF();
 	}
 
-	if (res != FR_OK) fp->obj.fs = 0;	/* Invalidate file object on error */
-
+	*tp = 0;
 	LEAVE_FF(fs, res);
 }
 
+#endif /* FF_FS_RPATH >= 2 */
+#endif /* FF_FS_RPATH >= 1 */
 
 
 
+#if FF_FS_MINIMIZE <= 2
 /*-----------------------------------------------------------------------*/
-/* Read File                                                             */
+/* Seek File Read/Write Pointer                                          */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_read (
-	FIL* fp, 	/* Open file to be read */
-	void* buff,	/* Data buffer to store the read data */
-	UINT btr,	/* Number of bytes to read */
-	UINT* br	/* Number of bytes read */
+FRESULT f_lseek (
+	FIL* fp,		/* Pointer to the file object */
+	FSIZE_t ofs		/* File pointer from top of file */
 )
 {
 	FRESULT res;
 	FATFS *fs;
-	DWORD clst;
-	LBA_t sect;
-	FSIZE_t remain;
-	UINT rcnt, cc, csect;
-	BYTE *rbuff = (BYTE*)buff;
-
+	DWORD clst, bcs;
+	LBA_t nsect;
+	FSIZE_t ifptr;
+#if FF_USE_FASTSEEK
+	DWORD cl, pcl, ncl, tcl, tlen, ulen;
+	DWORD *tbl;
+	LBA_t dsc;
+#endif
 
-	*br = 0;	/* Clear read byte counter */
-	res = validate(&fp->obj, &fs);				/* Check validity of the file object */
-	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);	/* Check validity */
-	if (!(fp->flag & FA_READ)) LEAVE_FF(fs, FR_DENIED); /* Check access mode */
-	remain = fp->obj.objsize - fp->fptr;
-	if (btr > remain) btr = (UINT)remain;		/* Truncate btr by remaining bytes */
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res == FR_OK) res = (FRESULT)fp->err;
+#if FF_USE_STREAM != 0
+	if (res == FR_OK) {
+		res = strm_commit(fp);	/* The chain must be on the FAT to be followed */
+	}
+#endif
+#if FF_FS_EXFAT && !FF_FS_READONLY
+	if (res == FR_OK && fs->fs_type == FS_EXFAT) {
+		res = fill_last_frag(&fp->obj, fp->clust, 0xFFFFFFFF);	/* Fill last fragment on the FAT if needed */
+	}
+#endif
+	if (res != FR_OK) LEAVE_FF(fs, res);
 
-	for ( ; btr > 0; btr -= rcnt, *br += rcnt, rbuff += rcnt, fp->fptr += rcnt) {	/* Repeat until btr bytes read */
-		if (fp->fptr % SS(fs) == 0) {			/* On the sector boundary? */
-			csect = (UINT)(fp->fptr / SS(fs) & (fs->csize - 1));	/* Sector offset in the cluster */
-			if (csect == 0) {					/* On the cluster boundary? */
-				if (fp->fptr == 0) {			/* On the top of the file? */
-					clst = fp->obj.sclust;		/* Follow cluster chain from the origin */
-				} else {						/* Middle or end of the file */
 #if FF_USE_FASTSEEK
-					if (fp->cltbl) {
-						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
-					} else
-#endif
-					{
-						clst = get_fat(&fp->obj, fp->clust);	/* Follow cluster chain on the FAT */
+	if (fp->cltbl) {	/* Fast seek */
+		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
+			tbl = fp->cltbl;
+			tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
+			cl = fp->obj.sclust;		/* Origin of the chain */
+			if (cl != 0) {
+				do {
+					/* Get a fragment */
+					tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
+					do {
+						pcl = cl; ncl++;
+						cl = get_fat(&fp->obj, cl);
+						if (cl <= 1) ABORT(fs, FR_INT_ERR);
+						if (cl == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
+					} while (cl == pcl + 1);
+					if (ulen <= tlen) {		/* Store the length and top of the fragment */
+						*tbl++ = ncl; *tbl++ = tcl;
 					}
-				}
-				if (clst < 2) ABORT(fs, FR_INT_ERR);
-				if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
-				fp->clust = clst;				/* Update current cluster */
+				} while (cl < fs->n_fatent);	/* Repeat until end of chain */
 			}
-			sect = clst2sect(fs, fp->clust);	/* Get current sector */
-			if (sect == 0) ABORT(fs, FR_INT_ERR);
-			sect += csect;
-			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
-			if (cc > 0) {						/* Read maximum contiguous sectors directly */
-				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
-					cc = fs->csize - csect;
-				}
-				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
-#if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2		/* Replace one of the read sectors with cached data if it contains a dirty sector */
-#if FF_FS_TINY
-				if (fs->wflag && fs->winsect - sect < cc) {
-					memcpy(rbuff + ((fs->winsect - sect) * SS(fs)), fs->win, SS(fs));
-				}
-#else
-				if ((fp->flag & FA_DIRTY) && fp->sect - sect < cc) {
-					memcpy(rbuff + ((fp->sect - sect) * SS(fs)), fp->buf, SS(fs));
-				}
-#endif
-#endif
-				rcnt = SS(fs) * cc;				/* Number of bytes transferred */
-				continue;
+			*fp->cltbl = ulen;	/* Number of items used */
+			if (ulen <= tlen) {
+				*tbl = 0;		/* Terminate table */
+			} else {
+				res = FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
 			}
-#if !FF_FS_TINY
-			if (fp->sect != sect) {			/* Load data sector if not in cache */
+		} else {						/* Fast seek */
+			if (ofs > fp->obj.objsize) ofs = fp->obj.objsize;	/* Clip offset at the file size */
+			fp->fptr = ofs;				/* Set file pointer */
+			if (ofs > 0) {
+				fp->clust = clmt_clust(fp, ofs - 1);
+				dsc = clst2sect(fs, fp->clust);
+				if (dsc == 0) ABORT(fs, FR_INT_ERR);
+				dsc += (DWORD)((ofs - 1) / SS(fs)) & (fs->csize - 1);
+				if (fp->fptr % SS(fs) && dsc != fp->sect) {	/* Refill sector cache if needed */
+#if FF_FBUF_POOL != 0
+					if (fbuf_load(fp, dsc) != FR_OK) ABORT(fs, FR_DISK_ERR);
+#elif !FF_FS_TINY
 #if !FF_FS_READONLY
-				if (fp->flag & FA_DIRTY) {		/* Write-back dirty sector cache */
-					if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
-					fp->flag &= (BYTE)~FA_DIRTY;
+					if (fp->flag & FA_DIRTY) {		/* Write-back dirty sector cache */
+						if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
+						fp->flag &= (BYTE)~FA_DIRTY;
+					}
+#endif
+					if (disk_read(fs->pdrv, fp->buf, dsc, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);	/* Load current sector */
+#endif
+					fp->sect = dsc;
 				}
-#endif
-				if (disk_read(fs->pdrv, fp->buf, sect, 1) != RES_OK)	ABORT(fs, FR_DISK_ERR);	/* Fill sector cache */
 			}
-#endif
-			fp->sect = sect;
 		}
-		rcnt = SS(fs) - (UINT)fp->fptr % SS(fs);	/* Number of bytes remains in the sector */
-		if (rcnt > btr) rcnt = btr;					/* Clip it by btr if needed */
-#if FF_FS_TINY
-		if (move_window(fs, fp->sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move sector window */
-		memcpy(rbuff, fs->win + fp->fptr % SS(fs), rcnt);	/* Extract partial sector */
-#else
-		memcpy(rbuff, fp->buf + fp->fptr % SS(fs), rcnt);	/* Extract partial sector */
+	} else
 #endif
-	}
-
-	LEAVE_FF(fs, FR_OK);
-}
-
-
-
 
+	/* Normal Seek */
+	{
+#if FF_FS_EXFAT
+		if (fs->fs_type != FS_EXFAT && ofs >= 0x100000000) ofs = 0xFFFFFFFF;	/* Clip at 4 GiB - 1 if at FATxx */
+#endif
+		if (ofs > fp->obj.objsize && (FF_FS_READONLY || !(fp->flag & FA_WRITE))) {	/* In read-only mode, clip offset with the file size */
+			ofs = fp->obj.objsize;
+		}
+		ifptr = fp->fptr;
+		fp->fptr = nsect = 0;
+		if (ofs > 0) {
+			bcs = (DWORD)fs->csize * SS(fs);	/* Cluster size (byte) */
+			if (ifptr > 0 &&
+				(ofs - 1) / bcs >= (ifptr - 1) / bcs) {	/* When seek to same or following cluster, */
+				fp->fptr = (ifptr - 1) & ~(FSIZE_t)(bcs - 1);	/* start from the current cluster */
+				ofs -= fp->fptr;
+				clst = fp->clust;
+			} else {									/* When seek to back cluster, */
+				clst = fp->obj.sclust;					/* start from the first cluster */
 #if !FF_FS_READONLY
-/*-----------------------------------------------------------------------*/
-/* Write File                                                            */
-/*-----------------------------------------------------------------------*/
-
-FRESULT f_write (
-	FIL* fp,			/* Open file to be written */
-	const void* buff,	/* Data to be written */
-	UINT btw,			/* Number of bytes to write */
-	UINT* bw			/* Number of bytes written */
-)
-{
-	FRESULT res;
-	FATFS *fs;
-	DWORD clst;
-	LBA_t sect;
-	UINT wcnt, cc, csect;
-	const BYTE *wbuff = (const BYTE*)buff;
-
-
-	*bw = 0;	/* Clear write byte counter */
-	res = validate(&fp->obj, &fs);			/* Check validity of the file object */
-	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);	/* Check validity */
-	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
-
-	/* Check fptr wrap-around (file size cannot reach 4 GiB at FAT volume) */
-	if ((!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) && (DWORD)(fp->fptr + btw) < (DWORD)fp->fptr) {
-		btw = (UINT)(0xFFFFFFFF - (DWORD)fp->fptr);
-	}
-
-	for ( ; btw > 0; btw -= wcnt, *bw += wcnt, wbuff += wcnt, fp->fptr += wcnt, fp->obj.objsize = (fp->fptr > fp->obj.objsize) ? fp->fptr : fp->obj.objsize) {	/* Repeat until all data written */
-		if (fp->fptr % SS(fs) == 0) {		/* On the sector boundary? */
-			csect = (UINT)(fp->fptr / SS(fs)) & (fs->csize - 1);	/* Sector offset in the cluster */
-			if (csect == 0) {				/* On the cluster boundary? */
-				if (fp->fptr == 0) {		/* On the top of the file? */
-					clst = fp->obj.sclust;	/* Follow from the origin */
-					if (clst == 0) {		/* If no cluster is allocated, */
-						clst = create_chain(&fp->obj, 0);	/* create a new cluster chain */
-					}
-				} else {					/* On the middle or end of the file */
-#if FF_USE_FASTSEEK
-					if (fp->cltbl) {
-						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
+				if (clst == 0) {						/* If no cluster chain, create a new chain */
+					clst = create_chain(&fp->obj, 0);
+					if (clst == 1) ABORT(fs, FR_INT_ERR);
+					if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
+					fp->obj.sclust = clst;
+				}
+#endif
+				fp->clust = clst;
+			}
+			if (clst != 0) {
+				while (ofs > bcs) {						/* Cluster following loop */
+					ofs -= bcs; fp->fptr += bcs;
+#if !FF_FS_READONLY
+					if (fp->flag & FA_WRITE) {			/* Check if in write mode or not */
+						if (FF_FS_EXFAT && fp->fptr > fp->obj.objsize) {	/* No FAT chain object needs correct objsize to generate FAT value */
+							fp->obj.objsize = fp->fptr;
+							fp->flag |= FA_MODIFIED;
+						}
+						clst = create_chain(&fp->obj, clst);	/* Follow chain with forceed stretch */
+						if (clst == 0) {				/* Clip file size in case of disk full */
+							ofs = 0; break;
+						}
 					} else
 #endif
 					{
-						clst = create_chain(&fp->obj, fp->clust);	/* Follow or stretch cluster chain on the FAT */
+						clst = get_fat(&fp->obj, clst);	/* Follow cluster chain if not in write mode */
 					}
+					if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
+					if (clst <= 1 || clst >= fs->n_fatent) ABORT(fs, FR_INT_ERR);
+					fp->clust = clst;
+				}
+				fp->fptr += ofs;
+				if (ofs % SS(fs)) {
+					nsect = clst2sect(fs, clst);	/* Current sector */
+					if (nsect == 0) ABORT(fs, FR_INT_ERR);
+					nsect += (DWORD)(ofs / SS(fs));
 				}
-				if (clst == 0) break;		/* Could not allocate a new cluster (disk full) */
-				if (clst == 1) ABORT(fs, FR_INT_ERR);
-				if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
-				fp->clust = clst;			/* Update current cluster */
-				if (fp->obj.sclust == 0) fp->obj.sclust = clst;	/* Set start cluster if the first write */
 			}
-#if FF_FS_TINY
-			if (fs->winsect == fp->sect && sync_window(fs) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Write-back sector cache */
-#else
-			if (fp->flag & FA_DIRTY) {		/* Write-back sector cache */
+		}
+		if (!FF_FS_READONLY && fp->fptr > fp->obj.objsize) {	/* Set file change flag if the file size is extended */
+			fp->obj.objsize = fp->fptr;
+			fp->flag |= FA_MODIFIED;
+		}
+		if (fp->fptr % SS(fs) && nsect != fp->sect) {	/* Fill sector cache if needed */
+#if FF_FBUF_POOL != 0
+			if (fbuf_load(fp, nsect) != FR_OK) ABORT(fs, FR_DISK_ERR);
+#elif !FF_FS_TINY
+#if !FF_FS_READONLY
+			if (fp->flag & FA_DIRTY) {			/* Write-back dirty sector cache */
 				if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
 				fp->flag &= (BYTE)~FA_DIRTY;
 			}
 #endif
-			sect = clst2sect(fs, fp->clust);	/* Get current sector */
-			if (sect == 0) ABORT(fs, FR_INT_ERR);
-			sect += csect;
-			cc = btw / SS(fs);				/* When remaining bytes >= sector size, */
-			if (cc > 0) {					/* Write maximum contiguous sectors directly */
-				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
-					cc = fs->csize - csect;
-				}
-				if (disk_write(fs->pdrv, wbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
-#if FF_FS_MINIMIZE <= 2
-#if FF_FS_TINY
-				if (fs->winsect - sect < cc) {	/* Refill sector cache if it gets invalidated by the direct write */
-					memcpy(fs->win, wbuff + ((fs->winsect - sect) * SS(fs)), SS(fs));
-					fs->wflag = 0;
-				}
-#else
-				if (fp->sect - sect < cc) { /* Refill sector cache if it gets invalidated by the direct write */
-					memcpy(fp->buf, wbuff + ((fp->sect - sect) * SS(fs)), SS(fs));
-					fp->flag &= (BYTE)~FA_DIRTY;
-				}
-#endif
-#endif
-				wcnt = SS(fs) * cc;		/* Number of bytes transferred */
-				continue;
-			}
-#if FF_FS_TINY
-			if (fp->fptr >= fp->obj.objsize) {	/* Avoid silly cache filling on the growing edge */
-				if (sync_window(fs) != FR_OK) ABORT(fs, FR_DISK_ERR);
-				fs->winsect = sect;
-			}
-#else
-			if (fp->sect != sect && 		/* Fill sector cache with file data */
-				fp->fptr < fp->obj.objsize &&
-				disk_read(fs->pdrv, fp->buf, sect, 1) != RES_OK) {
-					ABORT(fs, FR_DISK_ERR);
-			}
+			if (disk_read(fs->pdrv, fp->buf, nsect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);	/* Fill sector cache */
 #endif
-			fp->sect = sect;
+			fp->sect = nsect;
 		}
-		wcnt = SS(fs) - (UINT)fp->fptr % SS(fs);	/* Number of bytes remains in the sector */
-		if (wcnt > btw) wcnt = btw;					/* Clip it by btw if needed */
-#if FF_FS_TINY
-		if (move_window(fs, fp->sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move sector window */
-		memcpy(fs->win + fp->fptr % SS(fs), wbuff, wcnt);	/* Fit data to the sector */
-		fs->wflag = 1;
-#else
-		memcpy(fp->buf + fp->fptr % SS(fs), wbuff, wcnt);	/* Fit data to the sector */
-		fp->flag |= FA_DIRTY;
-#endif
 	}
 
-	fp->flag |= FA_MODIFIED;				/* Set file change flag */
-
-	LEAVE_FF(fs, FR_OK);
+	LEAVE_FF(fs, res);
 }
 
 
 
-
+#if FF_FS_MINIMIZE <= 1
 /*-----------------------------------------------------------------------*/
-/* Synchronize the File                                                  */
+/* Create a Directory Object                                             */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_sync (
-	FIL* fp		/* Open file to be synced */
+FRESULT f_opendir (
+	DIR* dp,			/* Pointer to directory object to create */
+	const TCHAR* path	/* Pointer to the directory path */
 )
 {
 	FRESULT res;
 	FATFS *fs;
-	DWORD tm;
-	BYTE *dir;
+	DEF_NAMBUF
 
 
-	res = validate(&fp->obj, &fs);	/* Check validity of the file object */
+	if (!dp) return FR_INVALID_OBJECT;
+
+	/* Get logical drive */
+	res = mount_volume(&path, &fs, 0);
 	if (res == FR_OK) {
-		if (fp->flag & FA_MODIFIED) {	/* Is there any change to the file? */
-#if !FF_FS_TINY
-			if (fp->flag & FA_DIRTY) {	/* Write-back cached data if needed */
-				if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) LEAVE_FF(fs, FR_DISK_ERR);
-				fp->flag &= (BYTE)~FA_DIRTY;
-			}
-#endif
-			/* Update the directory entry */
-			tm = GET_FATTIME();				/* Modified time */
+		dp->obj.fs = fs;
+		INIT_NAMBUF(fs);
+		res = follow_path(dp, path);			/* Follow the path to the directory */
+		if (res == FR_OK) {						/* Follow completed */
+			if (!(dp->fn[NSFLAG] & NS_NONAME)) {	/* It is not the origin directory itself */
+				if (dp->obj.attr & AM_DIR) {		/* This object is a sub-directory */
 #if FF_FS_EXFAT
-			if (fs->fs_type == FS_EXFAT) {
-				res = fill_first_frag(&fp->obj);	/* Fill first fragment on the FAT if needed */
-				if (res == FR_OK) {
-					res = fill_last_frag(&fp->obj, fp->clust, 0xFFFFFFFF);	/* Fill last fragment on the FAT if needed */
+					if (fs->fs_type == FS_EXFAT) {
+						dp->obj.c_scl = dp->obj.sclust;							/* Get containing directory inforamation */
+						dp->obj.c_size = ((DWORD)dp->obj.objsize & 0xFFFFFF00) | dp->obj.stat;
+						dp->obj.c_ofs = dp->blk_ofs;
+						init_alloc_info(fs, &dp->obj);	/* Get object allocation info */
+					} else
+#endif
+					{
+						dp->obj.sclust = ld_clust(fs, dp->dir);	/* Get object allocation info */
+					}
+				} else {						/* This object is a file */
+					res = FR_NO_PATH;
 				}
-				if (res == FR_OK) {
-					DIR dj;
-					DEF_NAMBUF
-
-					INIT_NAMBUF(fs);
-					res = load_obj_xdir(&dj, &fp->obj);	/* Load directory entry block */
-					if (res == FR_OK) {
-						fs->dirbuf[XDIR_Attr] |= AM_ARC;				/* Set archive attribute to indicate that the file has been changed */
-						fs->dirbuf[XDIR_GenFlags] = fp->obj.stat | 1;	/* Update file allocation information */
-						st_dword(fs->dirbuf + XDIR_FstClus, fp->obj.sclust);		/* Update start cluster */
-						st_qword(fs->dirbuf + XDIR_FileSize, fp->obj.objsize);		/* Update file size */
-						st_qword(fs->dirbuf + XDIR_ValidFileSize, fp->obj.objsize);	/* (FatFs does not support Valid File Size feature) */
-						st_dword(fs->dirbuf + XDIR_ModTime, tm);		/* Update modified time */
-						fs->dirbuf[XDIR_ModTime10] = 0;
-						st_dword(fs->dirbuf + XDIR_AccTime, 0);
-						res = store_xdir(&dj);	/* Restore it to the directory */
-						if (res == FR_OK) {
-							res = sync_fs(fs);
-							fp->flag &= (BYTE)~FA_MODIFIED;
-						}
+			}
+			if (res == FR_OK) {
+				dp->obj.id = fs->id;
+				res = dir_sdi(dp, 0);			/* Rewind directory */
+#if FF_FS_LOCK != 0
+				if (res == FR_OK) {
+					if (dp->obj.sclust != 0) {
+						dp->obj.lockid = inc_lock(dp, 0);	/* Lock the sub directory */
+						if (!dp->obj.lockid) res = FR_TOO_MANY_OPEN_FILES;
+					} else {
+						dp->obj.lockid = 0;	/* Root directory need not to be locked */
 					}
-					FREE_NAMBUF();
 				}
-			} else
 #endif
-			{
-				res = move_window(fs, fp->dir_sect);
-				if (res == FR_OK) {
-					dir = fp->dir_ptr;
-					dir[DIR_Attr] |= AM_ARC;						/* Set archive attribute to indicate that the file has been changed */
-					st_clust(fp->obj.fs, dir, fp->obj.sclust);		/* Update file allocation information  */
-					st_dword(dir + DIR_FileSize, (DWORD)fp->obj.objsize);	/* Update file size */
-					st_dword(dir + DIR_ModTime, tm);				/* Update modified time */
-					st_word(dir + DIR_LstAccDate, 0);
-					fs->wflag = 1;
-					res = sync_fs(fs);					/* Restore it to the directory */
-					fp->flag &= (BYTE)~FA_MODIFIED;
-				}
 			}
 		}
+		FREE_NAMBUF();
+		if (res == FR_NO_FILE) res = FR_NO_PATH;
 	}
+	if (res != FR_OK) dp->obj.fs = 0;		/* Invalidate the directory object if function faild */
 
 	LEAVE_FF(fs, res);
 }
 
-#endif /* !FF_FS_READONLY */
-
 
 
 
 /*-----------------------------------------------------------------------*/
-/* Close File                                                            */
+/* Close Directory                                                       */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_close (
-	FIL* fp		/* Open file to be closed */
+FRESULT f_closedir (
+	DIR *dp		/* Pointer to the directory object to be closed */
 )
 {
 	FRESULT res;
 	FATFS *fs;
 
-#if !FF_FS_READONLY
-	res = f_sync(fp);					/* Flush cached data */
-	if (res == FR_OK)
-#endif
-	{
-		res = validate(&fp->obj, &fs);	/* Lock volume */
-		if (res == FR_OK) {
+
+	res = validate(&dp->obj, &fs);	/* Check validity of the file object */
+	if (res == FR_OK) {
 #if FF_FS_LOCK != 0
-			res = dec_lock(fp->obj.lockid);		/* Decrement file open counter */
-			if (res == FR_OK) fp->obj.fs = 0;	/* Invalidate file object */
+		if (dp->obj.lockid) res = dec_lock(dp->obj.lockid);	/* Decrement sub-directory open counter */
+		if (res == FR_OK) dp->obj.fs = 0;	/* Invalidate directory object */
 #else
-			fp->obj.fs = 0;	/* Invalidate file object */
+		dp->obj.fs = 0;	/* Invalidate directory object */
 #endif
 #if FF_FS_REENTRANT
-			unlock_fs(fs, FR_OK);		/* Unlock volume */
+		unlock_fs(fs, FR_OK);		/* Unlock volume */
 #endif
-		}
 	}
 	return res;
 }
@@ -4180,341 +6985,331 @@ FRESULT f_close (
 
 
 
-#if FF_FS_RPATH >= 1
 /*-----------------------------------------------------------------------*/
-/* Change Current Directory or Current Drive, Get Current Directory      */
+/* Read Directory Entries in Sequence                                    */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_chdrive (
-	const TCHAR* path		/* Drive number to set */
+FRESULT f_readdir (
+	DIR* dp,			/* Pointer to the open directory object */
+	FILINFO* fno		/* Pointer to file information to return */
 )
 {
-	int vol;
-
+	FRESULT res;
+	FATFS *fs;
+	DEF_NAMBUF
 
-	/* Get logical drive number */
-	vol = get_ldnumber(&path);
-	if (vol < 0) return FR_INVALID_DRIVE;
-	CurrVol = (BYTE)vol;	/* Set it as current volume */
 
-	return FR_OK;
+	res = validate(&dp->obj, &fs);	/* Check validity of the directory object */
+	if (res == FR_OK) {
+		if (!fno) {
+			res = dir_sdi(dp, 0);			/* Rewind the directory object */
+		} else {
+			INIT_NAMBUF(fs);
+			res = DIR_READ_FILE(dp);		/* Read an item */
+			if (res == FR_NO_FILE) res = FR_OK;	/* Ignore end of directory */
+			if (res == FR_OK) {				/* A valid entry is found */
+				get_fileinfo(dp, fno);		/* Get the object information */
+				res = dir_next(dp, 0);		/* Increment index for next */
+				if (res == FR_NO_FILE) res = FR_OK;	/* Ignore end of directory now */
+			}
+			FREE_NAMBUF();
+		}
+	}
+	LEAVE_FF(fs, res);
 }
 
 
 
-FRESULT f_chdir (
-	const TCHAR* path	/* Pointer to the directory path */
+#if FF_USE_FIND
+/*-----------------------------------------------------------------------*/
+/* Find Next File                                                        */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_findnext (
+	DIR* dp,		/* Pointer to the open directory object */
+	FILINFO* fno	/* Pointer to the file information structure */
 )
 {
-#if FF_STR_VOLUME_ID == 2
-	UINT i;
-#endif
 	FRESULT res;
-	DIR dj;
-	FATFS *fs;
-	DEF_NAMBUF
 
 
-	/* Get logical drive */
-	res = mount_volume(&path, &fs, 0);
-	if (res == FR_OK) {
-		dj.obj.fs = fs;
-		INIT_NAMBUF(fs);
-		res = follow_path(&dj, path);		/* Follow the path */
-		if (res == FR_OK) {					/* Follow completed */
-			if (dj.fn[NSFLAG] & NS_NONAME) {	/* Is it the start directory itself? */
-				fs->cdir = dj.obj.sclust;
-#if FF_FS_EXFAT
-				if (fs->fs_type == FS_EXFAT) {
-					fs->cdc_scl = dj.obj.c_scl;
-					fs->cdc_size = dj.obj.c_size;
-					fs->cdc_ofs = dj.obj.c_ofs;
-				}
-#endif
-			} else {
-				if (dj.obj.attr & AM_DIR) {	/* It is a sub-directory */
-#if FF_FS_EXFAT
-					if (fs->fs_type == FS_EXFAT) {
-						fs->cdir = ld_dword(fs->dirbuf + XDIR_FstClus);		/* Sub-directory cluster */
-						fs->cdc_scl = dj.obj.sclust;						/* Save containing directory information */
-						fs->cdc_size = ((DWORD)dj.obj.objsize & 0xFFFFFF00) | dj.obj.stat;
-						fs->cdc_ofs = dj.blk_ofs;
-					} else
-#endif
-					{
-						fs->cdir = ld_clust(fs, dj.dir);					/* Sub-directory cluster */
-					}
-				} else {
-					res = FR_NO_PATH;		/* Reached but a file */
-				}
-			}
-		}
-		FREE_NAMBUF();
-		if (res == FR_NO_FILE) res = FR_NO_PATH;
-#if FF_STR_VOLUME_ID == 2	/* Also current drive is changed if in Unix style volume ID */
-		if (res == FR_OK) {
-			for (i = FF_VOLUMES - 1; i && fs != FatFs[i]; i--) ;	/* Set current drive */
-			CurrVol = (BYTE)i;
-		}
+	for (;;) {
+		res = f_readdir(dp, fno);		/* Get a directory item */
+		if (res != FR_OK || !fno || !fno->fname[0]) break;	/* Terminate if any error or end of directory */
+		if (pattern_match(dp->pat, fno->fname, 0, FIND_RECURS)) break;		/* Test for the file name */
+#if FF_USE_LFN && FF_USE_FIND == 2
+		if (pattern_match(dp->pat, fno->altname, 0, FIND_RECURS)) break;	/* Test for alternative name if exist */
 #endif
 	}
-
-	LEAVE_FF(fs, res);
+	return res;
 }
 
 
-#if FF_FS_RPATH >= 2
-FRESULT f_getcwd (
-	TCHAR* buff,	/* Pointer to the directory path */
-	UINT len		/* Size of buff in unit of TCHAR */
+
+/*-----------------------------------------------------------------------*/
+/* Find First File                                                       */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_findfirst (
+	DIR* dp,				/* Pointer to the blank directory object */
+	FILINFO* fno,			/* Pointer to the file information structure */
+	const TCHAR* path,		/* Pointer to the directory to open */
+	const TCHAR* pattern	/* Pointer to the matching pattern */
 )
 {
 	FRESULT res;
-	DIR dj;
-	FATFS *fs;
-	UINT i, n;
-	DWORD ccl;
-	TCHAR *tp = buff;
-#if FF_VOLUMES >= 2
-	UINT vl;
-#if FF_STR_VOLUME_ID
-	const char *vp;
-#endif
-#endif
-	FILINFO fno;
-	DEF_NAMBUF
 
 
-	/* Get logical drive */
-	buff[0] = 0;	/* Set null string to get current volume */
-	res = mount_volume((const TCHAR**)&buff, &fs, 0);	/* Get current volume */
+	dp->pat = pattern;		/* Save pointer to pattern string */
+	res = f_opendir(dp, path);		/* Open the target directory */
 	if (res == FR_OK) {
-		dj.obj.fs = fs;
-		INIT_NAMBUF(fs);
+		res = f_findnext(dp, fno);	/* Find the first item */
+	}
+	return res;
+}
 
-		/* Follow parent directories and create the path */
-		i = len;			/* Bottom of buffer (directory stack base) */
-		if (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) {	/* (Cannot do getcwd on exFAT and returns root path) */
-			dj.obj.sclust = fs->cdir;				/* Start to follow upper directory from current directory */
-			while ((ccl = dj.obj.sclust) != 0) {	/* Repeat while current directory is a sub-directory */
-				res = dir_sdi(&dj, 1 * SZDIRE);	/* Get parent directory */
-				if (res != FR_OK) break;
-				res = move_window(fs, dj.sect);
-				if (res != FR_OK) break;
-				dj.obj.sclust = ld_clust(fs, dj.dir);	/* Goto parent directory */
-				res = dir_sdi(&dj, 0);
-				if (res != FR_OK) break;
-				do {							/* Find the entry links to the child directory */
-					res = DIR_READ_FILE(&dj);
-					if (res != FR_OK) break;
-					if (ccl == ld_clust(fs, dj.dir)) break;	/* Found the entry */
-					res = dir_next(&dj, 0);
-				} while (res == FR_OK);
-				if (res == FR_NO_FILE) res = FR_INT_ERR;/* It cannot be 'not found'. */
-				if (res != FR_OK) break;
-				get_fileinfo(&dj, &fno);		/* Get the directory name and push it to the buffer */
-				for (n = 0; fno.fname[n]; n++) ;	/* Name length */
-				if (i < n + 1) {	/* Insufficient space to store the path name? */
-					res = FR_NOT_ENOUGH_CORE; break;
-				}
-				while (n) buff[--i] = fno.fname[--n];	/* Stack the name */
-				buff[--i] = '/';
-			}
+#endif	/* FF_USE_FIND */
+
+
+
+#if FF_USE_DIRBATCH
+/*-----------------------------------------------------------------------*/
+/* Read a Batch of Directory Entries                                     */
+/*-----------------------------------------------------------------------*/
+
+static int rd_cmp (		/* <0:a is prior to b, 0:same order, >0:b is prior to a */
+	const FFDIRENT* a,
+	const FFDIRENT* b,
+	BYTE opt			/* Sort options */
+)
+{
+	int r = 0;
+	UINT i;
+	DWORD ca, cb;
+
+
+	if (opt & RD_SORTTIME) {	/* Compare modified time */
+		ca = (DWORD)a->fdate << 16 | a->ftime;
+		cb = (DWORD)b->fdate << 16 | b->ftime;
+		r = (ca > cb) - (ca < cb);
+	}
+	if (r == 0 && (opt & RD_SORTNAME)) {	/* Compare name in case-insensitive */
+		for (i = 0; ; i++) {
+			ca = (TCHAR)a->fname[i]; cb = (TCHAR)b->fname[i];
+			if (IsLower(ca)) ca -= 0x20;
+			if (IsLower(cb)) cb -= 0x20;
+			if (ca != cb || ca == 0) break;
 		}
-		if (res == FR_OK) {
-			if (i == len) buff[--i] = '/';	/* Is it the root-directory? */
-#if FF_VOLUMES >= 2			/* Put drive prefix */
-			vl = 0;
-#if FF_STR_VOLUME_ID >= 1	/* String volume ID */
-			for (n = 0, vp = (const char*)VolumeStr[CurrVol]; vp[n]; n++) ;
-			if (i >= n + 2) {
-				if (FF_STR_VOLUME_ID == 2) *tp++ = (TCHAR)'/';
-				for (vl = 0; vl < n; *tp++ = (TCHAR)vp[vl], vl++) ;
-				if (FF_STR_VOLUME_ID == 1) *tp++ = (TCHAR)':';
-				vl++;
-			}
-#else						/* Numeric volume ID */
-			if (i >= 3) {
-				*tp++ = (TCHAR)'0' + CurrVol;
-				*tp++ = (TCHAR)':';
-				vl = 2;
-			}
+		r = (ca > cb) - (ca < cb);
+	}
+	return (opt & RD_REVERSE) ? -r : r;
+}
+
+
+FRESULT f_readdirs (
+	DIR* dp,			/* Pointer to the open directory object */
+	FFDIRENT* ent,		/* Pointer to the array of entries to return */
+	UINT n,				/* Number of entries in the array */
+	UINT* nr,			/* Pointer to the variable to return number of entries read (<n:end of directory) */
+	const TCHAR* pat,	/* Pointer to the name matching pattern (null:all items) */
+	BYTE opt			/* Filter and sort options (RD_xxx) */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	FILINFO fno;
+	FFDIRENT tmp;
+	DWORD sclust;
+	UINT i, j, gap;
+	const TCHAR *nm;
+	DEF_NAMBUF
+
+
+	*nr = 0;
+	res = validate(&dp->obj, &fs);	/* Check validity of the directory object (once for the batch) */
+	if (res == FR_OK) {
+		INIT_NAMBUF(fs);
+		while (*nr < n) {
+			res = DIR_READ_FILE(dp);		/* Read an item */
+			if (res != FR_OK) break;
+			get_fileinfo(dp, &fno);			/* Get the object information */
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {
+				sclust = ld_dword(fs->dirbuf + XDIR_FstClus);
+			} else
 #endif
-			if (vl == 0) res = FR_NOT_ENOUGH_CORE;
+			{
+				sclust = ld_clust(fs, dp->dir);
+			}
+			res = dir_next(dp, 0);			/* Increment index for next */
+			if ((fno.fattrib & AM_DIR) ? (opt & RD_NODIR) : (opt & RD_NOFILE)) continue;	/* Filter by type */
+			if ((opt & RD_NOHIDDEN) && (fno.fattrib & (AM_HID | AM_SYS))) continue;
+			if (!pat || pattern_match(pat, fno.fname, 0, FIND_RECURS)) {	/* Filter by name */
+				nm = fno.fname;
+				for (i = 0; nm[i] && i < FF_DIRENT_NAME; i++) ;
+#if FF_USE_LFN
+				if (i == FF_DIRENT_NAME) {	/* Substitute the short name if the name does not fit */
+					nm = fno.altname[0] ? fno.altname : _T("?");
+				}
 #endif
-			/* Add current directory path */
-			if (res == FR_OK) {
-				do *tp++ = buff[i++]; while (i < len);	/* Copy stacked path string */
+				for (i = 0; nm[i] && i < FF_DIRENT_NAME - 1; i++) ent[*nr].fname[i] = nm[i];
+				ent[*nr].fname[i] = 0;
+				ent[*nr].fsize = fno.fsize;
+				ent[*nr].sclust = sclust;
+				ent[*nr].fdate = fno.fdate;
+				ent[*nr].ftime = fno.ftime;
+				ent[*nr].fattrib = fno.fattrib;
+				(*nr)++;
 			}
+			if (res != FR_OK) break;
 		}
+		if (res == FR_NO_FILE) res = FR_OK;	/* Ignore end of directory */
 		FREE_NAMBUF();
-	}
 
-	*tp = 0;
+		if (opt & (RD_SORTNAME | RD_SORTTIME)) {	/* Sort the entries (shell sort) */
+			for (gap = *nr / 2; gap > 0; gap /= 2) {
+				for (i = gap; i < *nr; i++) {
+					tmp = ent[i];
+					for (j = i; j >= gap && rd_cmp(&ent[j - gap], &tmp, opt) > 0; j -= gap) ent[j] = ent[j - gap];
+					ent[j] = tmp;
+				}
+			}
+		}
+	}
 	LEAVE_FF(fs, res);
 }
 
-#endif /* FF_FS_RPATH >= 2 */
-#endif /* FF_FS_RPATH >= 1 */
+#endif	/* FF_USE_DIRBATCH */
 
 
 
-#if FF_FS_MINIMIZE <= 2
+#if FF_FS_MINIMIZE == 0
 /*-----------------------------------------------------------------------*/
-/* Seek File Read/Write Pointer                                          */
+/* Get File Status                                                       */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_lseek (
-	FIL* fp,		/* Pointer to the file object */
-	FSIZE_t ofs		/* File pointer from top of file */
+FRESULT f_stat (
+	const TCHAR* path,	/* Pointer to the file path */
+	FILINFO* fno		/* Pointer to file information to return */
 )
 {
 	FRESULT res;
-	FATFS *fs;
-	DWORD clst, bcs;
-	LBA_t nsect;
-	FSIZE_t ifptr;
-#if FF_USE_FASTSEEK
-	DWORD cl, pcl, ncl, tcl, tlen, ulen;
-	DWORD *tbl;
-	LBA_t dsc;
-#endif
+	DIR dj;
+	DEF_NAMBUF
 
-	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
-	if (res == FR_OK) res = (FRESULT)fp->err;
-#if FF_FS_EXFAT && !FF_FS_READONLY
-	if (res == FR_OK && fs->fs_type == FS_EXFAT) {
-		res = fill_last_frag(&fp->obj, fp->clust, 0xFFFFFFFF);	/* Fill last fragment on the FAT if needed */
-	}
-#endif
-	if (res != FR_OK) LEAVE_FF(fs, res);
 
-#if FF_USE_FASTSEEK
-	if (fp->cltbl) {	/* Fast seek */
-		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
-			tbl = fp->cltbl;
-			tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
-			cl = fp->obj.sclust;		/* Origin of the chain */
-			if (cl != 0) {
-				do {
-					/* Get a fragment */
-					tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
-					do {
-						pcl = cl; ncl++;
-						cl = get_fat(&fp->obj, cl);
-						if (cl <= 1) ABORT(fs, FR_INT_ERR);
-						if (cl == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
-					} while (cl == pcl + 1);
-					if (ulen <= tlen) {		/* Store the length and top of the fragment */
-						*tbl++ = ncl; *tbl++ = tcl;
-					}
-				} while (cl < fs->n_fatent);	/* Repeat until end of chain */
-			}
-			*fp->cltbl = ulen;	/* Number of items used */
-			if (ulen <= tlen) {
-				*tbl = 0;		/* Terminate table */
-			} else {
-				res = FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
-			}
-		} else {						/* Fast seek */
-			if (ofs > fp->obj.objsize) ofs = fp->obj.objsize;	/* Clip offset at the file size */
-			fp->fptr = ofs;				/* Set file pointer */
-			if (ofs > 0) {
-				fp->clust = clmt_clust(fp, ofs - 1);
-				dsc = clst2sect(fs, fp->clust);
-				if (dsc == 0) ABORT(fs, FR_INT_ERR);
-				dsc += (DWORD)((ofs - 1) / SS(fs)) & (fs->csize - 1);
-				if (fp->fptr % SS(fs) && dsc != fp->sect) {	/* Refill sector cache if needed */
-#if !FF_FS_TINY
-#if !FF_FS_READONLY
-					if (fp->flag & FA_DIRTY) {		/* Write-back dirty sector cache */
-						if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
-						fp->flag &= (BYTE)~FA_DIRTY;
-					}
-#endif
-					if (disk_read(fs->pdrv, fp->buf, dsc, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);	/* Load current sector */
-#endif
-					fp->sect = dsc;
-				}
+	/* Get logical drive */
+	res = mount_volume(&path, &dj.obj.fs, 0);
+	if (res == FR_OK) {
+		INIT_NAMBUF(dj.obj.fs);
+		res = follow_path(&dj, path);	/* Follow the file path */
+		if (res == FR_OK) {				/* Follow completed */
+			if (dj.fn[NSFLAG] & NS_NONAME) {	/* It is origin directory */
+				res = FR_INVALID_NAME;
+			} else {							/* Found an object */
+				if (fno) get_fileinfo(&dj, fno);
 			}
 		}
-	} else
-#endif
+		FREE_NAMBUF();
+	}
+
+	LEAVE_FF(dj.obj.fs, res);
+}
+
+
 
-	/* Normal Seek */
-	{
-#if FF_FS_EXFAT
-		if (fs->fs_type != FS_EXFAT && ofs >= 0x100000000) ofs = 0xFFFFFFFF;	/* Clip at 4 GiB - 1 if at FATxx */
-#endif
-		if (ofs > fp->obj.objsize && (FF_FS_READONLY || !(fp->flag & FA_WRITE))) {	/* In read-only mode, clip offset with the file size */
-			ofs = fp->obj.objsize;
-		}
-		ifptr = fp->fptr;
-		fp->fptr = nsect = 0;
-		if (ofs > 0) {
-			bcs = (DWORD)fs->csize * SS(fs);	/* Cluster size (byte) */
-			if (ifptr > 0 &&
-				(ofs - 1) / bcs >= (ifptr - 1) / bcs) {	/* When seek to same or following cluster, */
-				fp->fptr = (ifptr - 1) & ~(FSIZE_t)(bcs - 1);	/* start from the current cluster */
-				ofs -= fp->fptr;
-				clst = fp->clust;
-			} else {									/* When seek to back cluster, */
-				clst = fp->obj.sclust;					/* start from the first cluster */
-#if !FF_FS_READONLY
-				if (clst == 0) {						/* If no cluster chain, create a new chain */
-					clst = create_chain(&fp->obj, 0);
-					if (clst == 1) ABORT(fs, FR_INT_ERR);
-					if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
-					fp->obj.sclust = clst;
-				}
-#endif
-				fp->clust = clst;
-			}
-			if (clst != 0) {
-				while (ofs > bcs) {						/* Cluster following loop */
-					ofs -= bcs; fp->fptr += bcs;
 #if !FF_FS_READONLY
-					if (fp->flag & FA_WRITE) {			/* Check if in write mode or not */
-						if (FF_FS_EXFAT && fp->fptr > fp->obj.objsize) {	/* No FAT chain object needs correct objsize to generate FAT value */
-							fp->obj.objsize = fp->fptr;
-							fp->flag |= FA_MODIFIED;
+/*-----------------------------------------------------------------------*/
+/* Get Number of Free Clusters                                           */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_getfree (
+	const TCHAR* path,	/* Logical drive number */
+	DWORD* nclst,		/* Pointer to a variable to return number of free clusters */
+	FATFS** fatfs		/* Pointer to return pointer to corresponding filesystem object */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD nfree, clst, stat;
+	LBA_t sect;
+	UINT i;
+	FFOBJID obj;
+
+
+	/* Get logical drive */
+	res = mount_volume(&path, &fs, 0);
+	if (res == FR_OK) {
+		*fatfs = fs;				/* Return ptr to the fs object */
+		/* If free_clst is valid, return it without full FAT scan */
+		if (fs->free_clst <= fs->n_fatent - 2) {
+			*nclst = fs->free_clst;
+		} else {
+			/* Scan FAT to obtain number of free clusters */
+			nfree = 0;
+			if (fs->fs_type == FS_FAT12) {	/* FAT12: Scan bit field FAT entries */
+				clst = 2; obj.fs = fs;
+				do {
+					stat = get_fat(&obj, clst);
+					if (stat == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+					if (stat == 1) { res = FR_INT_ERR; break; }
+					if (stat == 0) nfree++;
+				} while (++clst < fs->n_fatent);
+			} else {
+#if FF_FS_EXFAT
+				if (fs->fs_type == FS_EXFAT) {	/* exFAT: Scan allocation bitmap */
+					BYTE bm;
+					UINT b;
+
+					clst = fs->n_fatent - 2;	/* Number of clusters */
+					sect = fs->bitbase;			/* Bitmap sector */
+					i = 0;						/* Offset in the sector */
+					do {	/* Counts numbuer of bits with zero in the bitmap */
+						if (i == 0) {
+							res = move_window(fs, sect++);
+							if (res != FR_OK) break;
 						}
-						clst = create_chain(&fp->obj, clst);	/* Follow chain with forceed stretch */
-						if (clst == 0) {				/* Clip file size in case of disk full */
-							ofs = 0; break;
+						for (b = 8, bm = fs->win[i]; b && clst; b--, clst--) {
+							if (!(bm & 1)) nfree++;
+							bm >>= 1;
 						}
+						i = (i + 1) % SS(fs);
+					} while (clst);
+				} else
+#endif
+				{	/* FAT16/32: Scan WORD/DWORD FAT entries */
+					clst = fs->n_fatent;	/* Number of entries */
+					sect = fs->fatbase;		/* Top of the FAT */
+					i = 0;					/* Offset in the sector */
+#if FF_FAT_RAM
+					if (fs->fr_n) {		/* FAT16 in RAM */
+						do {
+							if (ld_word(fs->fatram + i) == 0) nfree++;
+							i += 2;
+						} while (--clst);
 					} else
 #endif
-					{
-						clst = get_fat(&fp->obj, clst);	/* Follow cluster chain if not in write mode */
-					}
-					if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
-					if (clst <= 1 || clst >= fs->n_fatent) ABORT(fs, FR_INT_ERR);
-					fp->clust = clst;
-				}
-				fp->fptr += ofs;
-				if (ofs % SS(fs)) {
-					nsect = clst2sect(fs, clst);	/* Current sector */
-					if (nsect == 0) ABORT(fs, FR_INT_ERR);
-					nsect += (DWORD)(ofs / SS(fs));
-				}
-			}
-		}
-		if (!FF_FS_READONLY && fp->fptr > fp->obj.objsize) {	/* Set file change flag if the file size is extended */
-			fp->obj.objsize = fp->fptr;
-			fp->flag |= FA_MODIFIED;
-		}
-		if (fp->fptr % SS(fs) && nsect != fp->sect) {	/* Fill sector cache if needed */
-#if !FF_FS_TINY
-#if !FF_FS_READONLY
-			if (fp->flag & FA_DIRTY) {			/* Write-back dirty sector cache */
-				if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
-				fp->flag &= (BYTE)~FA_DIRTY;
+					do {	/* Counts numbuer of entries with zero in the FAT */
+						if (i == 0) {
+							res = move_window(fs, sect++);
+							if (res != FR_OK) break;
+						}
+						if (fs->fs_type == FS_FAT16) {
+							if (ld_word(fs->win + i) == 0) nfree++;
+							i += 2;
+						} else {
+							if ((ld_dword(fs->win + i) & 0x0FFFFFFF) == 0) nfree++;
+							i += 4;
+						}
+						i %= SS(fs);
+					} while (--clst);
+				}
+			}
+			if (res == FR_OK) {		/* Update parameters if succeeded */
+				*nclst = nfree;			/* Return the free clusters */
+				fs->free_clst = nfree;	/* Now free_clst is valid */
+				fs->fsi_flag |= 1;		/* FAT32: FSInfo is to be updated */
 			}
-#endif
-			if (disk_read(fs->pdrv, fp->buf, nsect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);	/* Fill sector cache */
-#endif
-			fp->sect = nsect;
 		}
 	}
 
@@ -4523,66 +7318,57 @@ FRESULT f_lseek (
 
 
 
-#if FF_FS_MINIMIZE <= 1
+
 /*-----------------------------------------------------------------------*/
-/* Create a Directory Object                                             */
+/* Truncate File                                                         */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_opendir (
-	DIR* dp,			/* Pointer to directory object to create */
-	const TCHAR* path	/* Pointer to the directory path */
+FRESULT f_truncate (
+	FIL* fp		/* Pointer to the file object */
 )
 {
 	FRESULT res;
 	FATFS *fs;
-	DEF_NAMBUF
-
+	DWORD ncl;
 
-	if (!dp) return FR_INVALID_OBJECT;
 
-	/* Get logical drive */
-	res = mount_volume(&path, &fs, 0);
-	if (res == FR_OK) {
-		dp->obj.fs = fs;
-		INIT_NAMBUF(fs);
-		res = follow_path(dp, path);			/* Follow the path to the directory */
-		if (res == FR_OK) {						/* Follow completed */
-			if (!(dp->fn[NSFLAG] & NS_NONAME)) {	/* It is not the origin directory itself */
-				if (dp->obj.attr & AM_DIR) {		/* This object is a sub-directory */
-#if FF_FS_EXFAT
-					if (fs->fs_type == FS_EXFAT) {
-						dp->obj.c_scl = dp->obj.sclust;							/* Get containing directory inforamation */
-						dp->obj.c_size = ((DWORD)dp->obj.objsize & 0xFFFFFF00) | dp->obj.stat;
-						dp->obj.c_ofs = dp->blk_ofs;
-						init_alloc_info(fs, &dp->obj);	/* Get object allocation info */
-					} else
+	res = validate(&fp->obj, &fs);	/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
+	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
+#if FF_USE_STREAM != 0
+	res = strm_commit(fp);	/* The chain must be on the FAT to be truncated */
+	if (res != FR_OK) ABORT(fs, res);
 #endif
-					{
-						dp->obj.sclust = ld_clust(fs, dp->dir);	/* Get object allocation info */
-					}
-				} else {						/* This object is a file */
-					res = FR_NO_PATH;
-				}
+
+	if (fp->fptr < fp->obj.objsize) {	/* Process when fptr is not on the eof */
+		if (fp->fptr == 0) {	/* When set file size to zero, remove entire cluster chain */
+			res = remove_chain(&fp->obj, fp->obj.sclust, 0);
+			fp->obj.sclust = 0;
+		} else {				/* When truncate a part of the file, remove remaining clusters */
+			ncl = get_fat(&fp->obj, fp->clust);
+			res = FR_OK;
+			if (ncl == 0xFFFFFFFF) res = FR_DISK_ERR;
+			if (ncl == 1) res = FR_INT_ERR;
+			if (res == FR_OK && ncl < fs->n_fatent) {
+				res = remove_chain(&fp->obj, ncl, fp->clust);
 			}
-			if (res == FR_OK) {
-				dp->obj.id = fs->id;
-				res = dir_sdi(dp, 0);			/* Rewind directory */
-#if FF_FS_LOCK != 0
-				if (res == FR_OK) {
-					if (dp->obj.sclust != 0) {
-						dp->obj.lockid = inc_lock(dp, 0);	/* Lock the sub directory */
-						if (!dp->obj.lockid) res = FR_TOO_MANY_OPEN_FILES;
-					} else {
-						dp->obj.lockid = 0;	/* Root directory need not to be locked */
-					}
-				}
-#endif
+		}
+		fp->obj.objsize = fp->fptr;	/* Set file size to current read/write point */
+		fp->flag |= FA_MODIFIED;
+#if FF_FBUF_POOL != 0
+		if (res == FR_OK) res = fbuf_flush(fp);
+		fp->mbcnt = 0;	/* Discard the file buffer (it may be on the removed clusters) */
+#elif !FF_FS_TINY
+		if (res == FR_OK && (fp->flag & FA_DIRTY)) {
+			if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
+				res = FR_DISK_ERR;
+			} else {
+				fp->flag &= (BYTE)~FA_DIRTY;
 			}
 		}
-		FREE_NAMBUF();
-		if (res == FR_NO_FILE) res = FR_NO_PATH;
+#endif
+		if (res != FR_OK) ABORT(fs, res);
 	}
-	if (res != FR_OK) dp->obj.fs = 0;		/* Invalidate the directory object if function faild */
 
 	LEAVE_FF(fs, res);
 }
@@ -4591,241 +7377,475 @@ FRESULT f_opendir (
 
 
 /*-----------------------------------------------------------------------*/
-/* Close Directory                                                       */
+/* Delete a File/Directory                                               */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_closedir (
-	DIR *dp		/* Pointer to the directory object to be closed */
+FRESULT f_unlink (
+	const TCHAR* path		/* Pointer to the file or directory path */
 )
 {
 	FRESULT res;
+	DIR dj, sdj;
+	DWORD dclst = 0;
 	FATFS *fs;
+#if FF_FS_EXFAT
+	FFOBJID obj;
+#endif
+	DEF_NAMBUF
 
 
-	res = validate(&dp->obj, &fs);	/* Check validity of the file object */
+	/* Get logical drive */
+	res = mount_volume(&path, &fs, FA_WRITE);
 	if (res == FR_OK) {
+		dj.obj.fs = fs;
+		INIT_NAMBUF(fs);
+		res = follow_path(&dj, path);		/* Follow the file path */
+		if (FF_FS_RPATH && res == FR_OK && (dj.fn[NSFLAG] & NS_DOT)) {
+			res = FR_INVALID_NAME;			/* Cannot remove dot entry */
+		}
 #if FF_FS_LOCK != 0
-		if (dp->obj.lockid) res = dec_lock(dp->obj.lockid);	/* Decrement sub-directory open counter */
-		if (res == FR_OK) dp->obj.fs = 0;	/* Invalidate directory object */
-#else
-		dp->obj.fs = 0;	/* Invalidate directory object */
+		if (res == FR_OK) res = chk_lock(&dj, 2);	/* Check if it is an open object */
 #endif
-#if FF_FS_REENTRANT
-		unlock_fs(fs, FR_OK);		/* Unlock volume */
+		if (res == FR_OK) {					/* The object is accessible */
+			if (dj.fn[NSFLAG] & NS_NONAME) {
+				res = FR_INVALID_NAME;		/* Cannot remove the origin directory */
+			} else {
+				if (dj.obj.attr & AM_RDO) {
+					res = FR_DENIED;		/* Cannot remove R/O object */
+				}
+			}
+			if (res == FR_OK) {
+#if FF_FS_EXFAT
+				obj.fs = fs;
+				if (fs->fs_type == FS_EXFAT) {
+					init_alloc_info(fs, &obj);
+					dclst = obj.sclust;
+				} else
+#endif
+				{
+					dclst = ld_clust(fs, dj.dir);
+				}
+				if (dj.obj.attr & AM_DIR) {			/* Is it a sub-directory? */
+#if FF_FS_RPATH != 0
+					if (dclst == fs->cdir) {	 	/* Is it the current directory? */
+						res = FR_DENIED;
+					} else
+#endif
+					{
+						sdj.obj.fs = fs;			/* Open the sub-directory */
+						sdj.obj.sclust = dclst;
+#if FF_FS_EXFAT
+						if (fs->fs_type == FS_EXFAT) {
+							sdj.obj.objsize = obj.objsize;
+							sdj.obj.stat = obj.stat;
+						}
+#endif
+						res = dir_sdi(&sdj, 0);
+						if (res == FR_OK) {
+							res = DIR_READ_FILE(&sdj);			/* Test if the directory is empty */
+							if (res == FR_OK) res = FR_DENIED;	/* Not empty? */
+							if (res == FR_NO_FILE) res = FR_OK;	/* Empty? */
+						}
+					}
+				}
+			}
+			if (res == FR_OK) {
+				res = dir_remove(&dj);			/* Remove the directory entry */
+				if (res == FR_OK && dclst != 0) {	/* Remove the cluster chain if exist */
+#if FF_FS_EXFAT
+					res = remove_chain(&obj, dclst, 0);
+#else
+					res = remove_chain(&dj.obj, dclst, 0);
 #endif
+				}
+				if (res == FR_OK) res = sync_fs(fs);
+			}
+		}
+		FREE_NAMBUF();
 	}
-	return res;
+
+	LEAVE_FF(fs, res);
 }
 
 
 
 
 /*-----------------------------------------------------------------------*/
-/* Read Directory Entries in Sequence                                    */
+/* Create a Directory                                                    */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_readdir (
-	DIR* dp,			/* Pointer to the open directory object */
-	FILINFO* fno		/* Pointer to file information to return */
+FRESULT f_mkdir (
+	const TCHAR* path		/* Pointer to the directory path */
 )
 {
 	FRESULT res;
+	DIR dj;
+	FFOBJID sobj;
 	FATFS *fs;
+	DWORD dcl, pcl, tm;
 	DEF_NAMBUF
 
 
-	res = validate(&dp->obj, &fs);	/* Check validity of the directory object */
+	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive */
 	if (res == FR_OK) {
-		if (!fno) {
-			res = dir_sdi(dp, 0);			/* Rewind the directory object */
-		} else {
-			INIT_NAMBUF(fs);
-			res = DIR_READ_FILE(dp);		/* Read an item */
-			if (res == FR_NO_FILE) res = FR_OK;	/* Ignore end of directory */
-			if (res == FR_OK) {				/* A valid entry is found */
-				get_fileinfo(dp, fno);		/* Get the object information */
-				res = dir_next(dp, 0);		/* Increment index for next */
-				if (res == FR_NO_FILE) res = FR_OK;	/* Ignore end of directory now */
+		dj.obj.fs = fs;
+		INIT_NAMBUF(fs);
+		res = follow_path(&dj, path);			/* Follow the file path */
+		if (res == FR_OK) res = FR_EXIST;		/* Name collision? */
+		if (FF_FS_RPATH && res == FR_NO_FILE && (dj.fn[NSFLAG] & NS_DOT)) {	/* Invalid name? */
+			res = FR_INVALID_NAME;
+		}
+		if (res == FR_NO_FILE) {				/* It is clear to create a new directory */
+			sobj.fs = fs;						/* New object id to create a new chain */
+			dcl = create_chain(&sobj, 0);		/* Allocate a cluster for the new directory */
+			res = FR_OK;
+			if (dcl == 0) res = FR_DENIED;		/* No space to allocate a new cluster? */
+			if (dcl == 1) res = FR_INT_ERR;		/* Any insanity? */
+			if (dcl == 0xFFFFFFFF) res = FR_DISK_ERR;	/* Disk error? */
+			tm = GET_FATTIME();
+			if (res == FR_OK) {
+				res = dir_clear(fs, dcl);		/* Clean up the new table */
+				if (res == FR_OK) {
+					if (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) {	/* Create dot entries (FAT only) */
+						memset(fs->win + DIR_Name, ' ', 11);	/* Create "." entry */
+						fs->win[DIR_Name] = '.';
+						fs->win[DIR_Attr] = AM_DIR;
+						st_dword(fs->win + DIR_ModTime, tm);
+						st_clust(fs, fs->win, dcl);
+						memcpy(fs->win + SZDIRE, fs->win, SZDIRE);	/* Create ".." entry */
+						fs->win[SZDIRE + 1] = '.'; pcl = dj.obj.sclust;
+						st_clust(fs, fs->win + SZDIRE, pcl);
+						fs->wflag = 1;
+					}
+					res = dir_register(&dj);	/* Register the object to the parent directoy */
+				}
+			}
+			if (res == FR_OK) {
+#if FF_FS_EXFAT
+				if (fs->fs_type == FS_EXFAT) {	/* Initialize directory entry block */
+					st_dword(fs->dirbuf + XDIR_ModTime, tm);	/* Created time */
+					st_dword(fs->dirbuf + XDIR_FstClus, dcl);	/* Table start cluster */
+					st_dword(fs->dirbuf + XDIR_FileSize, (DWORD)fs->csize * SS(fs));	/* Directory size needs to be valid */
+					st_dword(fs->dirbuf + XDIR_ValidFileSize, (DWORD)fs->csize * SS(fs));
+					fs->dirbuf[XDIR_GenFlags] = 3;				/* Initialize the object flag */
+					fs->dirbuf[XDIR_Attr] = AM_DIR;				/* Attribute */
+					res = store_xdir(&dj);
+				} else
+#endif
+				{
+					st_dword(dj.dir + DIR_ModTime, tm);	/* Created time */
+					st_clust(fs, dj.dir, dcl);			/* Table start cluster */
+					dj.dir[DIR_Attr] = AM_DIR;			/* Attribute */
+					fs->wflag = 1;
+				}
+				if (res == FR_OK) {
+					res = sync_fs(fs);
+				}
+			} else {
+				remove_chain(&sobj, dcl, 0);		/* Could not register, remove the allocated cluster */
 			}
-			FREE_NAMBUF();
 		}
+		FREE_NAMBUF();
 	}
+
 	LEAVE_FF(fs, res);
 }
 
 
 
-#if FF_USE_FIND
+
 /*-----------------------------------------------------------------------*/
-/* Find Next File                                                        */
+/* Rename a File/Directory                                               */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_findnext (
-	DIR* dp,		/* Pointer to the open directory object */
-	FILINFO* fno	/* Pointer to the file information structure */
+FRESULT f_rename (
+	const TCHAR* path_old,	/* Pointer to the object name to be renamed */
+	const TCHAR* path_new	/* Pointer to the new name */
 )
 {
 	FRESULT res;
+	DIR djo, djn;
+	FATFS *fs;
+	BYTE buf[FF_FS_EXFAT ? SZDIRE * 2 : SZDIRE], *dir;
+	LBA_t sect;
+	DEF_NAMBUF
 
 
-	for (;;) {
-		res = f_readdir(dp, fno);		/* Get a directory item */
-		if (res != FR_OK || !fno || !fno->fname[0]) break;	/* Terminate if any error or end of directory */
-		if (pattern_match(dp->pat, fno->fname, 0, FIND_RECURS)) break;		/* Test for the file name */
-#if FF_USE_LFN && FF_USE_FIND == 2
-		if (pattern_match(dp->pat, fno->altname, 0, FIND_RECURS)) break;	/* Test for alternative name if exist */
+	get_ldnumber(&path_new);						/* Snip the drive number of new name off */
+	res = mount_volume(&path_old, &fs, FA_WRITE);	/* Get logical drive of the old object */
+	if (res == FR_OK) {
+		djo.obj.fs = fs;
+		INIT_NAMBUF(fs);
+		res = follow_path(&djo, path_old);			/* Check old object */
+		if (res == FR_OK && (djo.fn[NSFLAG] & (NS_DOT | NS_NONAME))) res = FR_INVALID_NAME;	/* Check validity of name */
+#if FF_FS_LOCK != 0
+		if (res == FR_OK) {
+			res = chk_lock(&djo, 2);
+		}
+#endif
+		if (res == FR_OK) {					/* Object to be renamed is found */
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {	/* At exFAT volume */
+				BYTE nf, nn;
+				WORD nh;
+
+				memcpy(buf, fs->dirbuf, SZDIRE * 2);	/* Save 85+C0 entry of old object */
+				memcpy(&djn, &djo, sizeof djo);
+				res = follow_path(&djn, path_new);		/* Make sure if new object name is not in use */
+				if (res == FR_OK) {						/* Is new name already in use by any other object? */
+					res = (djn.obj.sclust == djo.obj.sclust && djn.dptr == djo.dptr) ? FR_NO_FILE : FR_EXIST;
+				}
+				if (res == FR_NO_FILE) { 				/* It is a valid path and no name collision */
+					res = dir_register(&djn);			/* Register the new entry */
+					if (res == FR_OK) {
+						nf = fs->dirbuf[XDIR_NumSec]; nn = fs->dirbuf[XDIR_NumName];
+						nh = ld_word(fs->dirbuf + XDIR_NameHash);
+						memcpy(fs->dirbuf, buf, SZDIRE * 2);	/* Restore 85+C0 entry */
+						fs->dirbuf[XDIR_NumSec] = nf; fs->dirbuf[XDIR_NumName] = nn;
+						st_word(fs->dirbuf + XDIR_NameHash, nh);
+						if (!(fs->dirbuf[XDIR_Attr] & AM_DIR)) fs->dirbuf[XDIR_Attr] |= AM_ARC;	/* Set archive attribute if it is a file */
+/* Start of critical section where an interruption can cause a cross-link */
+						res = store_xdir(&djn);
+					}
+				}
+			} else
 #endif
+			{	/* At FAT/FAT32 volume */
+				memcpy(buf, djo.dir, SZDIRE);			/* Save directory entry of the object */
+				memcpy(&djn, &djo, sizeof (DIR));		/* Duplicate the directory object */
+				res = follow_path(&djn, path_new);		/* Make sure if new object name is not in use */
+				if (res == FR_OK) {						/* Is new name already in use by any other object? */
+					res = (djn.obj.sclust == djo.obj.sclust && djn.dptr == djo.dptr) ? FR_NO_FILE : FR_EXIST;
+				}
+				if (res == FR_NO_FILE) { 				/* It is a valid path and no name collision */
+					res = dir_register(&djn);			/* Register the new entry */
+					if (res == FR_OK) {
+						dir = djn.dir;					/* Copy directory entry of the object except name */
+						memcpy(dir + 13, buf + 13, SZDIRE - 13);
+						dir[DIR_Attr] = buf[DIR_Attr];
+						if (!(dir[DIR_Attr] & AM_DIR)) dir[DIR_Attr] |= AM_ARC;	/* Set archive attribute if it is a file */
+						fs->wflag = 1;
+						if ((dir[DIR_Attr] & AM_DIR) && djo.obj.sclust != djn.obj.sclust) {	/* Update .. entry in the sub-directory if needed */
+							sect = clst2sect(fs, ld_clust(fs, dir));
+							if (sect == 0) {
+								res = FR_INT_ERR;
+							} else {
+/* Start of critical section where an interruption can cause a cross-link */
+								res = move_window(fs, sect);
+								dir = fs->win + SZDIRE * 1;	/* Ptr to .. entry */
+								if (res == FR_OK && dir[1] == '.') {
+									st_clust(fs, dir, djn.obj.sclust);
+									fs->wflag = 1;
+								}
+							}
+						}
+					}
+				}
+			}
+			if (res == FR_OK) {
+				res = dir_remove(&djo);		/* Remove old entry */
+				if (res == FR_OK) {
+					res = sync_fs(fs);
+				}
+			}
+/* End of the critical section */
+		}
+		FREE_NAMBUF();
 	}
-	return res;
+
+	LEAVE_FF(fs, res);
 }
 
+#endif /* !FF_FS_READONLY */
+#endif /* FF_FS_MINIMIZE == 0 */
+#endif /* FF_FS_MINIMIZE <= 1 */
+#endif /* FF_FS_MINIMIZE <= 2 */
+
 
 
+#if FF_USE_CHMOD && !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* Find First File                                                       */
+/* Change Attribute                                                      */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_findfirst (
-	DIR* dp,				/* Pointer to the blank directory object */
-	FILINFO* fno,			/* Pointer to the file information structure */
-	const TCHAR* path,		/* Pointer to the directory to open */
-	const TCHAR* pattern	/* Pointer to the matching pattern */
+FRESULT f_chmod (
+	const TCHAR* path,	/* Pointer to the file path */
+	BYTE attr,			/* Attribute bits */
+	BYTE mask			/* Attribute mask to change */
 )
 {
 	FRESULT res;
+	DIR dj;
+	FATFS *fs;
+	DEF_NAMBUF
 
 
-	dp->pat = pattern;		/* Save pointer to pattern string */
-	res = f_opendir(dp, path);		/* Open the target directory */
+	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive */
 	if (res == FR_OK) {
-		res = f_findnext(dp, fno);	/* Find the first item */
+		dj.obj.fs = fs;
+		INIT_NAMBUF(fs);
+		res = follow_path(&dj, path);	/* Follow the file path */
+		if (res == FR_OK && (dj.fn[NSFLAG] & (NS_DOT | NS_NONAME))) res = FR_INVALID_NAME;	/* Check object validity */
+		if (res == FR_OK) {
+			mask &= AM_RDO|AM_HID|AM_SYS|AM_ARC;	/* Valid attribute mask */
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {
+				fs->dirbuf[XDIR_Attr] = (attr & mask) | (fs->dirbuf[XDIR_Attr] & (BYTE)~mask);	/* Apply attribute change */
+				res = store_xdir(&dj);
+			} else
+#endif
+			{
+				dj.dir[DIR_Attr] = (attr & mask) | (dj.dir[DIR_Attr] & (BYTE)~mask);	/* Apply attribute change */
+				fs->wflag = 1;
+			}
+			if (res == FR_OK) {
+				res = sync_fs(fs);
+			}
+		}
+		FREE_NAMBUF();
 	}
-	return res;
+
+	LEAVE_FF(fs, res);
 }
 
-#endif	/* FF_USE_FIND */
 
 
 
-#if FF_FS_MINIMIZE == 0
 /*-----------------------------------------------------------------------*/
-/* Get File Status                                                       */
+/* Change Timestamp                                                      */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_stat (
-	const TCHAR* path,	/* Pointer to the file path */
-	FILINFO* fno		/* Pointer to file information to return */
+FRESULT f_utime (
+	const TCHAR* path,	/* Pointer to the file/directory name */
+	const FILINFO* fno	/* Pointer to the timestamp to be set */
 )
 {
 	FRESULT res;
 	DIR dj;
+	FATFS *fs;
 	DEF_NAMBUF
 
 
-	/* Get logical drive */
-	res = mount_volume(&path, &dj.obj.fs, 0);
+	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive */
 	if (res == FR_OK) {
-		INIT_NAMBUF(dj.obj.fs);
+		dj.obj.fs = fs;
+		INIT_NAMBUF(fs);
 		res = follow_path(&dj, path);	/* Follow the file path */
-		if (res == FR_OK) {				/* Follow completed */
-			if (dj.fn[NSFLAG] & NS_NONAME) {	/* It is origin directory */
-				res = FR_INVALID_NAME;
-			} else {							/* Found an object */
-				if (fno) get_fileinfo(&dj, fno);
+		if (res == FR_OK && (dj.fn[NSFLAG] & (NS_DOT | NS_NONAME))) res = FR_INVALID_NAME;	/* Check object validity */
+		if (res == FR_OK) {
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {
+				st_dword(fs->dirbuf + XDIR_ModTime, (DWORD)fno->fdate << 16 | fno->ftime);
+				res = store_xdir(&dj);
+			} else
+#endif
+			{
+				st_dword(dj.dir + DIR_ModTime, (DWORD)fno->fdate << 16 | fno->ftime);
+				fs->wflag = 1;
+			}
+			if (res == FR_OK) {
+				res = sync_fs(fs);
 			}
 		}
 		FREE_NAMBUF();
 	}
 
-	LEAVE_FF(dj.obj.fs, res);
+	LEAVE_FF(fs, res);
 }
 
+#endif	/* FF_USE_CHMOD && !FF_FS_READONLY */
 
 
-#if !FF_FS_READONLY
+
+#if FF_USE_LABEL
 /*-----------------------------------------------------------------------*/
-/* Get Number of Free Clusters                                           */
+/* Get Volume Label                                                      */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_getfree (
+FRESULT f_getlabel (
 	const TCHAR* path,	/* Logical drive number */
-	DWORD* nclst,		/* Pointer to a variable to return number of free clusters */
-	FATFS** fatfs		/* Pointer to return pointer to corresponding filesystem object */
+	TCHAR* label,		/* Buffer to store the volume label */
+	DWORD* vsn			/* Variable to store the volume serial number */
 )
 {
 	FRESULT res;
+	DIR dj;
 	FATFS *fs;
-	DWORD nfree, clst, stat;
-	LBA_t sect;
-	UINT i;
-	FFOBJID obj;
-
+	UINT si, di;
+	WCHAR wc;
 
 	/* Get logical drive */
 	res = mount_volume(&path, &fs, 0);
-	if (res == FR_OK) {
-		*fatfs = fs;				/* Return ptr to the fs object */
-		/* If free_clst is valid, return it without full FAT scan */
-		if (fs->free_clst <= fs->n_fatent - 2) {
-			*nclst = fs->free_clst;
-		} else {
-			/* Scan FAT to obtain number of free clusters */
-			nfree = 0;
-			if (fs->fs_type == FS_FAT12) {	/* FAT12: Scan bit field FAT entries */
-				clst = 2; obj.fs = fs;
-				do {
-					stat = get_fat(&obj, clst);
-					if (stat == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
-					if (stat == 1) { res = FR_INT_ERR; break; }
-					if (stat == 0) nfree++;
-				} while (++clst < fs->n_fatent);
-			} else {
+
+	/* Get volume label */
+	if (res == FR_OK && label) {
+		dj.obj.fs = fs; dj.obj.sclust = 0;	/* Open root directory */
+		res = dir_sdi(&dj, 0);
+		if (res == FR_OK) {
+		 	res = DIR_READ_LABEL(&dj);		/* Find a volume label entry */
+		 	if (res == FR_OK) {
 #if FF_FS_EXFAT
-				if (fs->fs_type == FS_EXFAT) {	/* exFAT: Scan allocation bitmap */
-					BYTE bm;
-					UINT b;
+				if (fs->fs_type == FS_EXFAT) {
+					WCHAR hs;
+					UINT nw;
 
-					clst = fs->n_fatent - 2;	/* Number of clusters */
-					sect = fs->bitbase;			/* Bitmap sector */
-					i = 0;						/* Offset in the sector */
-					do {	/* Counts numbuer of bits with zero in the bitmap */
-						if (i == 0) {
-							res = move_window(fs, sect++);
-							if (res != FR_OK) break;
-						}
-						for (b = 8, bm = fs->win[i]; b && clst; b--, clst--) {
-							if (!(bm & 1)) nfree++;
-							bm >>= 1;
+					for (si = di = hs = 0; si < dj.dir[XDIR_NumLabel]; si++) {	/* Extract volume label from 83 entry */
+						wc = ld_word(dj.dir + XDIR_Label + si * 2);
+						if (hs == 0 && IsSurrogate(wc)) {	/* Is the code a surrogate? */
+							hs = wc; continue;
 						}
-						i = (i + 1) % SS(fs);
-					} while (clst);
+						nw = put_utf((DWORD)hs << 16 | wc, &label[di], 4);	/* Store it in API encoding */
+						if (nw == 0) { di = 0; break; }		/* Encode error? */
+						di += nw;
+						hs = 0;
+					}
+					if (hs != 0) di = 0;	/* Broken surrogate pair? */
+					label[di] = 0;
 				} else
 #endif
-				{	/* FAT16/32: Scan WORD/DWORD FAT entries */
-					clst = fs->n_fatent;	/* Number of entries */
-					sect = fs->fatbase;		/* Top of the FAT */
-					i = 0;					/* Offset in the sector */
-					do {	/* Counts numbuer of entries with zero in the FAT */
-						if (i == 0) {
-							res = move_window(fs, sect++);
-							if (res != FR_OK) break;
-						}
-						if (fs->fs_type == FS_FAT16) {
-							if (ld_word(fs->win + i) == 0) nfree++;
-							i += 2;
-						} else {
-							if ((ld_dword(fs->win + i) & 0x0FFFFFFF) == 0) nfree++;
-							i += 4;
-						}
-						i %= SS(fs);
-					} while (--clst);
+				{
+					si = di = 0;		/* Extract volume label from AM_VOL entry */
+					while (si < 11) {
+						wc = dj.dir[si++];
+#if FF_USE_LFN && FF_LFN_UNICODE >= 1 	/* Unicode output */
+						if (dbc_1st((BYTE)wc) && si < 11) wc = wc << 8 | dj.dir[si++];	/* Is it a DBC? */
+						wc = ff_oem2uni(wc, CODEPAGE);		/* Convert it into Unicode */
+						if (wc == 0) { di = 0; break; }		/* Invalid char in current code page? */
+						di += put_utf(wc, &label[di], 4);	/* Store it in Unicode */
+#else									/* ANSI/OEM output */
+						label[di++] = (TCHAR)wc;
+#endif
+					}
+					do {				/* Truncate trailing spaces */
+						label[di] = 0;
+						if (di == 0) break;
+					} while (label[--di] == ' ');
 				}
 			}
-			if (res == FR_OK) {		/* Update parameters if succeeded */
-				*nclst = nfree;			/* Return the free clusters */
-				fs->free_clst = nfree;	/* Now free_clst is valid */
-				fs->fsi_flag |= 1;		/* FAT32: FSInfo is to be updated */
+		}
+		if (res == FR_NO_FILE) {	/* No label entry and return nul string */
+			label[0] = 0;
+			res = FR_OK;
+		}
+	}
+
+	/* Get volume serial number */
+	if (res == FR_OK && vsn) {
+		res = move_window(fs, fs->volbase);
+		if (res == FR_OK) {
+			switch (fs->fs_type) {
+			case FS_EXFAT:
+				di = BPB_VolIDEx;
+				break;
+
+			case FS_FAT32:
+				di = BS_VolID32;
+				break;
+
+			default:
+				di = BS_VolID;
 			}
+			*vsn = ld_dword(fs->win + di);
 		}
 	}
 
@@ -4834,742 +7854,791 @@ FRESULT f_getfree (
 
 
 
-
+#if !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* Truncate File                                                         */
+/* Set Volume Label                                                      */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_truncate (
-	FIL* fp		/* Pointer to the file object */
+FRESULT f_setlabel (
+	const TCHAR* label	/* Volume label to set with heading logical drive number */
 )
 {
 	FRESULT res;
+	DIR dj;
 	FATFS *fs;
-	DWORD ncl;
-
+	BYTE dirvn[22];
+	UINT di;
+	WCHAR wc;
+	static const char badchr[18] = "+.,;=[]" "/*:<>|\\\"\?\x7F";	/* [0..16] for FAT, [7..16] for exFAT */
+#if FF_USE_LFN
+	DWORD dc;
+#endif
 
-	res = validate(&fp->obj, &fs);	/* Check validity of the file object */
-	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
-	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
+	/* Get logical drive */
+	res = mount_volume(&label, &fs, FA_WRITE);
+	if (res != FR_OK) LEAVE_FF(fs, res);
 
-	if (fp->fptr < fp->obj.objsize) {	/* Process when fptr is not on the eof */
-		if (fp->fptr == 0) {	/* When set file size to zero, remove entire cluster chain */
-			res = remove_chain(&fp->obj, fp->obj.sclust, 0);
-			fp->obj.sclust = 0;
-		} else {				/* When truncate a part of the file, remove remaining clusters */
-			ncl = get_fat(&fp->obj, fp->clust);
-			res = FR_OK;
-			if (ncl == 0xFFFFFFFF) res = FR_DISK_ERR;
-			if (ncl == 1) res = FR_INT_ERR;
-			if (res == FR_OK && ncl < fs->n_fatent) {
-				res = remove_chain(&fp->obj, ncl, fp->clust);
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+		memset(dirvn, 0, 22);
+		di = 0;
+		while ((UINT)*label >= ' ') {	/* Create volume label */
+			dc = tchar2uni(&label);	/* Get a Unicode character */
+			if (dc >= 0x10000) {
+				if (dc == 0xFFFFFFFF || di >= 10) {	/* Wrong surrogate or buffer overflow */
+					dc = 0;
+				} else {
+					st_word(dirvn + di * 2, (WCHAR)(dc >> 16)); di++;
+				}
 			}
+			if (dc == 0 || strchr(&badchr[7], (int)dc) || di >= 11) {	/* Check validity of the volume label */
+				LEAVE_FF(fs, FR_INVALID_NAME);
+			}
+			st_word(dirvn + di * 2, (WCHAR)dc); di++;
 		}
-		fp->obj.objsize = fp->fptr;	/* Set file size to current read/write point */
-		fp->flag |= FA_MODIFIED;
-#if !FF_FS_TINY
-		if (res == FR_OK && (fp->flag & FA_DIRTY)) {
-			if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
-				res = FR_DISK_ERR;
+	} else
+#endif
+	{	/* On the FAT/FAT32 volume */
+		memset(dirvn, ' ', 11);
+		di = 0;
+		while ((UINT)*label >= ' ') {	/* Create volume label */
+#if FF_USE_LFN
+			dc = tchar2uni(&label);
+			wc = (dc < 0x10000) ? ff_uni2oem(ff_wtoupper(dc), CODEPAGE) : 0;
+#else									/* ANSI/OEM input */
+			wc = (BYTE)*label++;
+			if (dbc_1st((BYTE)wc)) wc = dbc_2nd((BYTE)*label) ? wc << 8 | (BYTE)*label++ : 0;
+			if (IsLower(wc)) wc -= 0x20;		/* To upper ASCII characters */
+#if FF_CODE_PAGE == 0
+			if (ExCvt && wc >= 0x80) wc = ExCvt[wc - 0x80];	/* To upper extended characters (SBCS cfg) */
+#elif FF_CODE_PAGE < 900
+			if (wc >= 0x80) wc = ExCvt[wc - 0x80];	/* To upper extended characters (SBCS cfg) */
+#endif
+#endif
+			if (wc == 0 || strchr(&badchr[0], (int)wc) || di >= (UINT)((wc >= 0x100) ? 10 : 11)) {	/* Reject invalid characters for volume label */
+				LEAVE_FF(fs, FR_INVALID_NAME);
+			}
+			if (wc >= 0x100) dirvn[di++] = (BYTE)(wc >> 8);
+			dirvn[di++] = (BYTE)wc;
+		}
+		if (dirvn[0] == DDEM) LEAVE_FF(fs, FR_INVALID_NAME);	/* Reject illegal name (heading DDEM) */
+		while (di && dirvn[di - 1] == ' ') di--;				/* Snip trailing spaces */
+	}
+
+	/* Set volume label */
+	dj.obj.fs = fs; dj.obj.sclust = 0;	/* Open root directory */
+	res = dir_sdi(&dj, 0);
+	if (res == FR_OK) {
+		res = DIR_READ_LABEL(&dj);	/* Get volume label entry */
+		if (res == FR_OK) {
+			if (FF_FS_EXFAT && fs->fs_type == FS_EXFAT) {
+				dj.dir[XDIR_NumLabel] = (BYTE)di;	/* Change the volume label */
+				memcpy(dj.dir + XDIR_Label, dirvn, 22);
 			} else {
-				fp->flag &= (BYTE)~FA_DIRTY;
+				if (di != 0) {
+					memcpy(dj.dir, dirvn, 11);	/* Change the volume label */
+				} else {
+					dj.dir[DIR_Name] = DDEM;	/* Remove the volume label */
+				}
+			}
+			fs->wflag = 1;
+			res = sync_fs(fs);
+		} else {			/* No volume label entry or an error */
+			if (res == FR_NO_FILE) {
+				res = FR_OK;
+				if (di != 0) {	/* Create a volume label entry */
+					res = dir_alloc(&dj, 1);	/* Allocate an entry */
+					if (res == FR_OK) {
+						memset(dj.dir, 0, SZDIRE);	/* Clean the entry */
+						if (FF_FS_EXFAT && fs->fs_type == FS_EXFAT) {
+							dj.dir[XDIR_Type] = ET_VLABEL;	/* Create volume label entry */
+							dj.dir[XDIR_NumLabel] = (BYTE)di;
+							memcpy(dj.dir + XDIR_Label, dirvn, 22);
+						} else {
+							dj.dir[DIR_Attr] = AM_VOL;		/* Create volume label entry */
+							memcpy(dj.dir, dirvn, 11);
+						}
+						fs->wflag = 1;
+						res = sync_fs(fs);
+					}
+				}
 			}
 		}
-#endif
-		if (res != FR_OK) ABORT(fs, res);
 	}
 
 	LEAVE_FF(fs, res);
 }
 
+#endif /* !FF_FS_READONLY */
+#endif /* FF_USE_LABEL */
 
 
 
+#if FF_USE_EXPAND && !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* Delete a File/Directory                                               */
+/* Allocate a Contiguous Blocks to the File                              */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_unlink (
-	const TCHAR* path		/* Pointer to the file or directory path */
+FRESULT f_expand (
+	FIL* fp,		/* Pointer to the file object */
+	FSIZE_t fsz,	/* File size to be expanded to */
+	BYTE opt		/* Operation mode 0:Find and prepare or 1:Find and allocate */
 )
 {
 	FRESULT res;
-	DIR dj, sdj;
-	DWORD dclst = 0;
 	FATFS *fs;
-#if FF_FS_EXFAT
-	FFOBJID obj;
-#endif
-	DEF_NAMBUF
+	DWORD n, clst, stcl, scl, ncl, tcl, lclst;
 
 
-	/* Get logical drive */
-	res = mount_volume(&path, &fs, FA_WRITE);
-	if (res == FR_OK) {
-		dj.obj.fs = fs;
-		INIT_NAMBUF(fs);
-		res = follow_path(&dj, path);		/* Follow the file path */
-		if (FF_FS_RPATH && res == FR_OK && (dj.fn[NSFLAG] & NS_DOT)) {
-			res = FR_INVALID_NAME;			/* Cannot remove dot entry */
-		}
-#if FF_FS_LOCK != 0
-		if (res == FR_OK) res = chk_lock(&dj, 2);	/* Check if it is an open object */
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
+	if (fsz == 0 || fp->obj.objsize != 0 || !(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);
+#if FF_FS_EXFAT
+	if (fs->fs_type != FS_EXFAT && fsz >= 0x100000000) LEAVE_FF(fs, FR_DENIED);	/* Check if in size limit */
 #endif
-		if (res == FR_OK) {					/* The object is accessible */
-			if (dj.fn[NSFLAG] & NS_NONAME) {
-				res = FR_INVALID_NAME;		/* Cannot remove the origin directory */
-			} else {
-				if (dj.obj.attr & AM_RDO) {
-					res = FR_DENIED;		/* Cannot remove R/O object */
-				}
-			}
-			if (res == FR_OK) {
+	n = (DWORD)fs->csize * SS(fs);	/* Cluster size */
+	tcl = (DWORD)(fsz / n) + ((fsz & (n - 1)) ? 1 : 0);	/* Number of clusters required */
+	stcl = fs->last_clst; lclst = 0;
+	if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+
 #if FF_FS_EXFAT
-				obj.fs = fs;
-				if (fs->fs_type == FS_EXFAT) {
-					init_alloc_info(fs, &obj);
-					dclst = obj.sclust;
-				} else
+	if (fs->fs_type == FS_EXFAT) {
+		scl = find_bitmap(fs, stcl, tcl);			/* Find a contiguous cluster block */
+		if (scl == 0) res = FR_DENIED;				/* No contiguous cluster block was found */
+		if (scl == 0xFFFFFFFF) res = FR_DISK_ERR;
+		if (res == FR_OK) {	/* A contiguous free area is found */
+			if (opt) {		/* Allocate it now */
+				res = change_bitmap(fs, scl, tcl, 1);	/* Mark the cluster block 'in use' */
+				lclst = scl + tcl - 1;
+			} else {		/* Set it as suggested point for next allocation */
+				lclst = scl - 1;
+			}
+		}
+	} else
 #endif
-				{
-					dclst = ld_clust(fs, dj.dir);
-				}
-				if (dj.obj.attr & AM_DIR) {			/* Is it a sub-directory? */
-#if FF_FS_RPATH != 0
-					if (dclst == fs->cdir) {	 	/* Is it the current directory? */
-						res = FR_DENIED;
-					} else
+	{
+		scl = clst = stcl; ncl = 0;
+		for (;;) {	/* Find a contiguous cluster block */
+			n = get_fat(&fp->obj, clst);
+#if FF_USE_STREAM != 0
+			if (n == 0 && strm_busy(fs, clst)) n = 2;	/* Reserved by a streaming file? */
 #endif
-					{
-						sdj.obj.fs = fs;			/* Open the sub-directory */
-						sdj.obj.sclust = dclst;
-#if FF_FS_EXFAT
-						if (fs->fs_type == FS_EXFAT) {
-							sdj.obj.objsize = obj.objsize;
-							sdj.obj.stat = obj.stat;
-						}
+#if FF_ALLOC_WIN != 0
+			if (n == 0 && alc_busy(fs, 0, clst)) n = 2;	/* Claimed by an allocation window? */
 #endif
-						res = dir_sdi(&sdj, 0);
-						if (res == FR_OK) {
-							res = DIR_READ_FILE(&sdj);			/* Test if the directory is empty */
-							if (res == FR_OK) res = FR_DENIED;	/* Not empty? */
-							if (res == FR_NO_FILE) res = FR_OK;	/* Empty? */
-						}
-					}
-				}
+			if (++clst >= fs->n_fatent) clst = 2;
+			if (n == 1) { res = FR_INT_ERR; break; }
+			if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+			if (n == 0) {	/* Is it a free cluster? */
+				if (++ncl == tcl) break;	/* Break if a contiguous cluster block is found */
+			} else {
+				scl = clst; ncl = 0;		/* Not a free cluster */
 			}
-			if (res == FR_OK) {
-				res = dir_remove(&dj);			/* Remove the directory entry */
-				if (res == FR_OK && dclst != 0) {	/* Remove the cluster chain if exist */
-#if FF_FS_EXFAT
-					res = remove_chain(&obj, dclst, 0);
-#else
-					res = remove_chain(&dj.obj, dclst, 0);
-#endif
+			if (clst == stcl) { res = FR_DENIED; break; }	/* No contiguous cluster? */
+		}
+		if (res == FR_OK) {	/* A contiguous free area is found */
+			if (opt) {		/* Allocate it now */
+				for (clst = scl, n = tcl; n; clst++, n--) {	/* Create a cluster chain on the FAT */
+					res = put_fat(fs, clst, (n == 1) ? 0xFFFFFFFF : clst + 1);
+					if (res != FR_OK) break;
+					lclst = clst;
 				}
-				if (res == FR_OK) res = sync_fs(fs);
+			} else {		/* Set it as suggested point for next allocation */
+				lclst = scl - 1;
+			}
+		}
+	}
+
+	if (res == FR_OK) {
+		fs->last_clst = lclst;		/* Set suggested start cluster to start next */
+		if (opt) {	/* Is it allocated now? */
+			fp->obj.sclust = scl;		/* Update object allocation information */
+			fp->obj.objsize = fsz;
+			if (FF_FS_EXFAT) fp->obj.stat = 2;	/* Set status 'contiguous chain' */
+			fp->flag |= FA_MODIFIED;
+			if (fs->free_clst <= fs->n_fatent - 2) {	/* Update FSINFO */
+				fs->free_clst -= tcl;
+				fs->fsi_flag |= 1;
 			}
 		}
-		FREE_NAMBUF();
 	}
 
 	LEAVE_FF(fs, res);
 }
 
+#endif /* FF_USE_EXPAND && !FF_FS_READONLY */
+
 
 
 
+#if FF_USE_STREAM != 0
 /*-----------------------------------------------------------------------*/
-/* Create a Directory                                                    */
+/* Enter/Leave Streaming Mode of the File                                */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_mkdir (
-	const TCHAR* path		/* Pointer to the directory path */
+FRESULT f_stream (
+	FIL* fp,		/* Pointer to the file object */
+	FSIZE_t fsz		/* Size of the block to be reserved ahead of the write pointer (0:Leave streaming mode) */
 )
 {
 	FRESULT res;
-	DIR dj;
-	FFOBJID sobj;
 	FATFS *fs;
-	DWORD dcl, pcl, tm;
-	DEF_NAMBUF
+	UINT i;
 
 
-	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive */
-	if (res == FR_OK) {
-		dj.obj.fs = fs;
-		INIT_NAMBUF(fs);
-		res = follow_path(&dj, path);			/* Follow the file path */
-		if (res == FR_OK) res = FR_EXIST;		/* Name collision? */
-		if (FF_FS_RPATH && res == FR_NO_FILE && (dj.fn[NSFLAG] & NS_DOT)) {	/* Invalid name? */
-			res = FR_INVALID_NAME;
-		}
-		if (res == FR_NO_FILE) {				/* It is clear to create a new directory */
-			sobj.fs = fs;						/* New object id to create a new chain */
-			dcl = create_chain(&sobj, 0);		/* Allocate a cluster for the new directory */
-			res = FR_OK;
-			if (dcl == 0) res = FR_DENIED;		/* No space to allocate a new cluster? */
-			if (dcl == 1) res = FR_INT_ERR;		/* Any insanity? */
-			if (dcl == 0xFFFFFFFF) res = FR_DISK_ERR;	/* Disk error? */
-			tm = GET_FATTIME();
-			if (res == FR_OK) {
-				res = dir_clear(fs, dcl);		/* Clean up the new table */
-				if (res == FR_OK) {
-					if (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) {	/* Create dot entries (FAT only) */
-						memset(fs->win + DIR_Name, ' ', 11);	/* Create "." entry */
-						fs->win[DIR_Name] = '.';
-						fs->win[DIR_Attr] = AM_DIR;
-						st_dword(fs->win + DIR_ModTime, tm);
-						st_clust(fs, fs->win, dcl);
-						memcpy(fs->win + SZDIRE, fs->win, SZDIRE);	/* Create ".." entry */
-						fs->win[SZDIRE + 1] = '.'; pcl = dj.obj.sclust;
-						st_clust(fs, fs->win + SZDIRE, pcl);
-						fs->wflag = 1;
-					}
-					res = dir_register(&dj);	/* Register the object to the parent directoy */
-				}
-			}
-			if (res == FR_OK) {
-#if FF_FS_EXFAT
-				if (fs->fs_type == FS_EXFAT) {	/* Initialize directory entry block */
-					st_dword(fs->dirbuf + XDIR_ModTime, tm);	/* Created time */
-					st_dword(fs->dirbuf + XDIR_FstClus, dcl);	/* Table start cluster */
-					st_dword(fs->dirbuf + XDIR_FileSize, (DWORD)fs->csize * SS(fs));	/* Directory size needs to be valid */
-					st_dword(fs->dirbuf + XDIR_ValidFileSize, (DWORD)fs->csize * SS(fs));
-					fs->dirbuf[XDIR_GenFlags] = 3;				/* Initialize the object flag */
-					fs->dirbuf[XDIR_Attr] = AM_DIR;				/* Attribute */
-					res = store_xdir(&dj);
-				} else
-#endif
-				{
-					st_dword(dj.dir + DIR_ModTime, tm);	/* Created time */
-					st_clust(fs, dj.dir, dcl);			/* Table start cluster */
-					dj.dir[DIR_Attr] = AM_DIR;			/* Attribute */
-					fs->wflag = 1;
-				}
-				if (res == FR_OK) {
-					res = sync_fs(fs);
-				}
-			} else {
-				remove_chain(&sobj, dcl, 0);		/* Could not register, remove the allocated cluster */
-			}
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
+	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
+
+	for (i = 0; i < FF_USE_STREAM && StrmFiles[i] != fp; i++) ;	/* Find the file in the streaming file table */
+	if (fsz == 0) {		/* Leave streaming mode */
+		res = strm_commit(fp);			/* Commit written part of the reserved block */
+		if (res != FR_OK) ABORT(fs, res);
+		if (i < FF_USE_STREAM) StrmFiles[i] = 0;
+		fp->strm_ext = fp->strm_top = fp->strm_end = 0;	/* Release rest of the block */
+	} else {			/* Enter streaming mode or change the block size */
+		if (i == FF_USE_STREAM) {
+			for (i = 0; i < FF_USE_STREAM && StrmFiles[i]; i++) ;	/* Find a blank entry */
+			if (i == FF_USE_STREAM) LEAVE_FF(fs, FR_TOO_MANY_OPEN_FILES);
+			StrmFiles[i] = fp;
+			fp->strm_top = fp->strm_end = 0;
 		}
-		FREE_NAMBUF();
+		fsz = (fsz + (FSIZE_t)fs->csize * SS(fs) - 1) / ((FSIZE_t)fs->csize * SS(fs));	/* Block size in unit of cluster */
+		fp->strm_ext = (fsz < fs->n_fatent - 2) ? (DWORD)fsz : fs->n_fatent - 2;
 	}
 
-	LEAVE_FF(fs, res);
+	LEAVE_FF(fs, FR_OK);
 }
 
+#endif /* FF_USE_STREAM != 0 */
 
 
 
+
+#if FF_ALLOC_WIN != 0
 /*-----------------------------------------------------------------------*/
-/* Rename a File/Directory                                               */
+/* Declare the Expected Size of the File                                 */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_rename (
-	const TCHAR* path_old,	/* Pointer to the object name to be renamed */
-	const TCHAR* path_new	/* Pointer to the new name */
+FRESULT f_sizehint (
+	FIL* fp,		/* Pointer to the file object */
+	FSIZE_t fsz		/* Expected size of the file (0:Cancel the declaration) */
 )
 {
 	FRESULT res;
-	DIR djo, djn;
 	FATFS *fs;
-	BYTE buf[FF_FS_EXFAT ? SZDIRE * 2 : SZDIRE], *dir;
-	LBA_t sect;
-	DEF_NAMBUF
+	ALCWIN *wp;
+	FSIZE_t bcs, ncl;
 
 
-	get_ldnumber(&path_new);						/* Snip the drive number of new name off */
-	res = mount_volume(&path_old, &fs, FA_WRITE);	/* Get logical drive of the old object */
-	if (res == FR_OK) {
-		djo.obj.fs = fs;
-		INIT_NAMBUF(fs);
-		res = follow_path(&djo, path_old);			/* Check old object */
-		if (res == FR_OK && (djo.fn[NSFLAG] & (NS_DOT | NS_NONAME))) res = FR_INVALID_NAME;	/* Check validity of name */
-#if FF_FS_LOCK != 0
-		if (res == FR_OK) {
-			res = chk_lock(&djo, 2);
-		}
-#endif
-		if (res == FR_OK) {					/* Object to be renamed is found */
-#if FF_FS_EXFAT
-			if (fs->fs_type == FS_EXFAT) {	/* At exFAT volume */
-				BYTE nf, nn;
-				WORD nh;
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
+	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
 
-				memcpy(buf, fs->dirbuf, SZDIRE * 2);	/* Save 85+C0 entry of old object */
-				memcpy(&djn, &djo, sizeof djo);
-				res = follow_path(&djn, path_new);		/* Make sure if new object name is not in use */
-				if (res == FR_OK) {						/* Is new name already in use by any other object? */
-					res = (djn.obj.sclust == djo.obj.sclust && djn.dptr == djo.dptr) ? FR_NO_FILE : FR_EXIST;
-				}
-				if (res == FR_NO_FILE) { 				/* It is a valid path and no name collision */
-					res = dir_register(&djn);			/* Register the new entry */
-					if (res == FR_OK) {
-						nf = fs->dirbuf[XDIR_NumSec]; nn = fs->dirbuf[XDIR_NumName];
-						nh = ld_word(fs->dirbuf + XDIR_NameHash);
-						memcpy(fs->dirbuf, buf, SZDIRE * 2);	/* Restore 85+C0 entry */
-						fs->dirbuf[XDIR_NumSec] = nf; fs->dirbuf[XDIR_NumName] = nn;
-						st_word(fs->dirbuf + XDIR_NameHash, nh);
-						if (!(fs->dirbuf[XDIR_Attr] & AM_DIR)) fs->dirbuf[XDIR_Attr] |= AM_ARC;	/* Set archive attribute if it is a file */
-/* Start of critical section where an interruption can cause a cross-link */
-						res = store_xdir(&djn);
-					}
-				}
-			} else
-#endif
-			{	/* At FAT/FAT32 volume */
-				memcpy(buf, djo.dir, SZDIRE);			/* Save directory entry of the object */
-				memcpy(&djn, &djo, sizeof (DIR));		/* Duplicate the directory object */
-				res = follow_path(&djn, path_new);		/* Make sure if new object name is not in use */
-				if (res == FR_OK) {						/* Is new name already in use by any other object? */
-					res = (djn.obj.sclust == djo.obj.sclust && djn.dptr == djo.dptr) ? FR_NO_FILE : FR_EXIST;
-				}
-				if (res == FR_NO_FILE) { 				/* It is a valid path and no name collision */
-					res = dir_register(&djn);			/* Register the new entry */
-					if (res == FR_OK) {
-						dir = djn.dir;					/* Copy directory entry of the object except name */
-						memcpy(dir + 13, buf + 13, SZDIRE - 13);
-						dir[DIR_Attr] = buf[DIR_Attr];
-						if (!(dir[DIR_Attr] & AM_DIR)) dir[DIR_Attr] |= AM_ARC;	/* Set archive attribute if it is a file */
-						fs->wflag = 1;
-						if ((dir[DIR_Attr] & AM_DIR) && djo.obj.sclust != djn.obj.sclust) {	/* Update .. entry in the sub-directory if needed */
-							sect = clst2sect(fs, ld_clust(fs, dir));
-							if (sect == 0) {
-								res = FR_INT_ERR;
-							} else {
-/* Start of critical section where an interruption can cause a cross-link */
-								res = move_window(fs, sect);
-								dir = fs->win + SZDIRE * 1;	/* Ptr to .. entry */
-								if (res == FR_OK && dir[1] == '.') {
-									st_clust(fs, dir, djn.obj.sclust);
-									fs->wflag = 1;
-								}
-							}
-						}
-					}
-				}
-			}
-			if (res == FR_OK) {
-				res = dir_remove(&djo);		/* Remove old entry */
-				if (res == FR_OK) {
-					res = sync_fs(fs);
-				}
-			}
-/* End of the critical section */
-		}
-		FREE_NAMBUF();
-	}
+	bcs = (FSIZE_t)fs->csize * SS(fs);	/* Cluster size */
+	fsz = (fsz + bcs - 1) / bcs;		/* Expected size in unit of cluster */
+	ncl = (fp->obj.objsize + bcs - 1) / bcs;	/* Current size in unit of cluster */
+	fsz = (fsz > ncl) ? fsz - ncl : 0;	/* Clusters to be allocated */
+	wp = alc_get(&fp->obj, 1);
+	if (!wp) LEAVE_FF(fs, FR_TOO_MANY_OPEN_FILES);	/* No entry for the window */
+	wp->decl = (fsz < fs->n_fatent - 2) ? (DWORD)fsz : fs->n_fatent - 2;
+	wp->top = wp->end = 0;				/* Place a window for the declared size at next allocation */
 
-	LEAVE_FF(fs, res);
+	LEAVE_FF(fs, FR_OK);
 }
 
-#endif /* !FF_FS_READONLY */
-#endif /* FF_FS_MINIMIZE == 0 */
-#endif /* FF_FS_MINIMIZE <= 1 */
-#endif /* FF_FS_MINIMIZE <= 2 */
+#endif /* FF_ALLOC_WIN != 0 */
 
 
 
-#if FF_USE_CHMOD && !FF_FS_READONLY
+
+#if FF_USE_FRAGSTAT
 /*-----------------------------------------------------------------------*/
-/* Change Attribute                                                      */
+/* Get Fragmentation of the File and the Volume                          */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_chmod (
-	const TCHAR* path,	/* Pointer to the file path */
-	BYTE attr,			/* Attribute bits */
-	BYTE mask			/* Attribute mask to change */
+FRESULT f_fragstat (
+	const TCHAR* path,	/* Pointer to the object path (origin directory: volume only) */
+	FFFRAG* st			/* Pointer to the fragmentation report to return */
 )
 {
 	FRESULT res;
 	DIR dj;
-	FATFS *fs;
+	FFOBJID obj;
+	DWORD clst, nxt, run;
 	DEF_NAMBUF
 
 
-	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive */
+	/* Get logical drive */
+	res = mount_volume(&path, &dj.obj.fs, 0);
 	if (res == FR_OK) {
-		dj.obj.fs = fs;
-		INIT_NAMBUF(fs);
+		memset(st, 0, sizeof (FFFRAG));
+		obj.fs = dj.obj.fs; obj.stat = 0;
+		INIT_NAMBUF(obj.fs);
 		res = follow_path(&dj, path);	/* Follow the file path */
-		if (res == FR_OK && (dj.fn[NSFLAG] & (NS_DOT | NS_NONAME))) res = FR_INVALID_NAME;	/* Check object validity */
-		if (res == FR_OK) {
-			mask &= AM_RDO|AM_HID|AM_SYS|AM_ARC;	/* Valid attribute mask */
+		if (res == FR_OK && !(dj.fn[NSFLAG] & NS_NONAME)) {	/* Follow the chain of the object */
 #if FF_FS_EXFAT
-			if (fs->fs_type == FS_EXFAT) {
-				fs->dirbuf[XDIR_Attr] = (attr & mask) | (fs->dirbuf[XDIR_Attr] & (BYTE)~mask);	/* Apply attribute change */
-				res = store_xdir(&dj);
+			if (obj.fs->fs_type == FS_EXFAT) {
+				init_alloc_info(obj.fs, &obj);
 			} else
 #endif
 			{
-				dj.dir[DIR_Attr] = (attr & mask) | (dj.dir[DIR_Attr] & (BYTE)~mask);	/* Apply attribute change */
-				fs->wflag = 1;
+				obj.sclust = ld_clust(obj.fs, dj.dir);
+				obj.objsize = ld_dword(dj.dir + DIR_FileSize);
 			}
-			if (res == FR_OK) {
-				res = sync_fs(fs);
+			if (FF_FS_EXFAT && obj.stat == 2) {	/* Contiguous chain without FAT */
+				nxt = (DWORD)obj.fs->csize * SS(obj.fs);
+				st->n_clst = (DWORD)((obj.objsize + nxt - 1) / nxt);
+				st->n_frag = st->n_clst ? 1 : 0;
+			} else {
+				for (clst = obj.sclust; clst >= 2 && clst < obj.fs->n_fatent; clst = nxt) {
+					nxt = get_fat(&obj, clst);
+					if (nxt < 2 || st->n_clst >= obj.fs->n_fatent) { res = FR_INT_ERR; break; }	/* Broken or circular chain? */
+					if (nxt == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+					st->n_clst++;
+					if (nxt != clst + 1) st->n_frag++;	/* End of a fragment? */
+				}
+			}
+		}
+		if (res == FR_OK) {	/* Scan the FAT or the allocation bitmap */
+			for (clst = 2, run = 0; clst < obj.fs->n_fatent; clst++) {
+#if FF_FS_EXFAT
+				if (obj.fs->fs_type == FS_EXFAT) {
+					nxt = test_bitmap(obj.fs, clst);
+					if (nxt == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+					if (nxt && (run > 0 || clst == 2)) st->n_ufrag++;	/* Top of a used extent? */
+				} else
+#endif
+				{
+					nxt = get_fat(&obj, clst);
+					if (nxt == 1) { res = FR_INT_ERR; break; }
+					if (nxt == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+					if (nxt != 0 && nxt != clst + 1) st->n_ufrag++;	/* End of a fragment? */
+					if (nxt >= obj.fs->n_fatent) st->n_chain++;		/* End of a chain? */
+				}
+				if (nxt != 0) {		/* In use */
+					st->n_used++;
+					run = 0;
+				} else {			/* Free */
+					st->n_free++;
+					if (run++ == 0) st->n_ffrag++;
+					if (run > st->max_free) st->max_free = run;
+				}
 			}
 		}
 		FREE_NAMBUF();
 	}
 
-	LEAVE_FF(fs, res);
+	LEAVE_FF(dj.obj.fs, res);
 }
 
+#endif /* FF_USE_FRAGSTAT */
+
 
 
 
+#if FF_USE_DEFRAG
 /*-----------------------------------------------------------------------*/
-/* Change Timestamp                                                      */
+/* Defragmenter: Get status of a cluster                                 */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_utime (
-	const TCHAR* path,	/* Pointer to the file/directory name */
-	const FILINFO* fno	/* Pointer to the timestamp to be set */
+static DWORD dfr_stat (	/* 0:Free, 1:Internal error, 0xFFFFFFFF:Disk error, Else:In use or reserved */
+	FFOBJID* obj,		/* Object on the volume */
+	DWORD clst			/* Cluster# to be checked */
 )
 {
-	FRESULT res;
-	DIR dj;
-	FATFS *fs;
-	DEF_NAMBUF
+	DWORD cs;
 
 
-	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive */
-	if (res == FR_OK) {
-		dj.obj.fs = fs;
-		INIT_NAMBUF(fs);
-		res = follow_path(&dj, path);	/* Follow the file path */
-		if (res == FR_OK && (dj.fn[NSFLAG] & (NS_DOT | NS_NONAME))) res = FR_INVALID_NAME;	/* Check object validity */
-		if (res == FR_OK) {
 #if FF_FS_EXFAT
-			if (fs->fs_type == FS_EXFAT) {
-				st_dword(fs->dirbuf + XDIR_ModTime, (DWORD)fno->fdate << 16 | fno->ftime);
-				res = store_xdir(&dj);
-			} else
+	if (obj->fs->fs_type == FS_EXFAT) {
+		cs = test_bitmap(obj->fs, clst);
+		if (cs == 1) cs = 2;
+	} else
 #endif
-			{
-				st_dword(dj.dir + DIR_ModTime, (DWORD)fno->fdate << 16 | fno->ftime);
-				fs->wflag = 1;
-			}
-			if (res == FR_OK) {
-				res = sync_fs(fs);
-			}
-		}
-		FREE_NAMBUF();
+	{
+		cs = get_fat(obj, clst);
 	}
-
-	LEAVE_FF(fs, res);
+#if FF_USE_STREAM != 0
+	if (cs == 0 && strm_busy(obj->fs, clst)) cs = 2;	/* Reserved by a streaming file? */
+#endif
+#if FF_ALLOC_WIN != 0
+	if (cs == 0 && alc_busy(obj->fs, 0, clst)) cs = 2;	/* Claimed by an allocation window? */
+#endif
+	return cs;
 }
 
-#endif	/* FF_USE_CHMOD && !FF_FS_READONLY */
 
+/*-----------------------------------------------------------------------*/
+/* Defragmenter: Find the smallest free block to hold the file           */
+/*-----------------------------------------------------------------------*/
+
+static DWORD dfr_find (	/* 0:Not found, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Top of the block */
+	FFOBJID* obj,		/* Object on the volume */
+	DWORD ncl			/* Number of contiguous clusters to find */
+)
+{
+	DWORD clst, cs, run, rtop, btop, bsz;
+	FATFS *fs = obj->fs;
+
+
+	run = rtop = btop = bsz = 0;
+	for (clst = 2; clst < fs->n_fatent; clst++) {
+		cs = dfr_stat(obj, clst);
+		if (cs == 1 || cs == 0xFFFFFFFF) return cs;
+		if (cs == 0 && run++ == 0) rtop = clst;	/* Free cluster, stretch the run */
+		if (run > 0 && (cs != 0 || clst + 1 == fs->n_fatent)) {	/* End of the run? */
+			if (run >= ncl && (bsz == 0 || run < bsz)) {	/* Smallest run to hold the file */
+				btop = rtop; bsz = run;
+			}
+			if (bsz == ncl) break;	/* Just fits */
+			run = 0;
+		}
+	}
+	return btop;
+}
 
 
-#if FF_USE_LABEL
 /*-----------------------------------------------------------------------*/
-/* Get Volume Label                                                      */
+/* Defragmenter: Examine the file read by the directory object           */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_getlabel (
-	const TCHAR* path,	/* Logical drive number */
-	TCHAR* label,		/* Buffer to store the volume label */
-	DWORD* vsn			/* Variable to store the volume serial number */
+static FRESULT dfr_open (
+	FFDEFRAG* df,		/* Defragmenter object */
+	UINT mv				/* 0:Analysis only, !0:Plan to move the file */
 )
 {
-	FRESULT res;
-	DIR dj;
-	FATFS *fs;
-	UINT si, di;
-	WCHAR wc;
+	DWORD clst, nxt, n, nf, f1;
+	DIR *dp = &df->dir;
+	FFOBJID *obj = &df->obj;
+	FATFS *fs = dp->obj.fs;
 
-	/* Get logical drive */
-	res = mount_volume(&path, &fs, 0);
 
-	/* Get volume label */
-	if (res == FR_OK && label) {
-		dj.obj.fs = fs; dj.obj.sclust = 0;	/* Open root directory */
-		res = dir_sdi(&dj, 0);
-		if (res == FR_OK) {
-		 	res = DIR_READ_LABEL(&dj);		/* Find a volume label entry */
-		 	if (res == FR_OK) {
+	if (dp->obj.attr & AM_DIR) return FR_OK;	/* Sub-directories are not processed */
+	obj->fs = fs; obj->id = fs->id; obj->stat = 0;
 #if FF_FS_EXFAT
-				if (fs->fs_type == FS_EXFAT) {
-					WCHAR hs;
-					UINT nw;
-
-					for (si = di = hs = 0; si < dj.dir[XDIR_NumLabel]; si++) {	/* Extract volume label from 83 entry */
-						wc = ld_word(dj.dir + XDIR_Label + si * 2);
-						if (hs == 0 && IsSurrogate(wc)) {	/* Is the code a surrogate? */
-							hs = wc; continue;
-						}
-						nw = put_utf((DWORD)hs << 16 | wc, &label[di], 4);	/* Store it in API encoding */
-						if (nw == 0) { di = 0; break; }		/* Encode error? */
-						di += nw;
-						hs = 0;
-					}
-					if (hs != 0) di = 0;	/* Broken surrogate pair? */
-					label[di] = 0;
-				} else
-#endif
-				{
-					si = di = 0;		/* Extract volume label from AM_VOL entry */
-					while (si < 11) {
-						wc = dj.dir[si++];
-#if FF_USE_LFN && FF_LFN_UNICODE >= 1 	/* Unicode output */
-						if (dbc_1st((BYTE)wc) && si < 11) wc = wc << 8 | dj.dir[si++];	/* Is it a DBC? */
-						wc = ff_oem2uni(wc, CODEPAGE);		/* Convert it into Unicode */
-						if (wc == 0) { di = 0; break; }		/* Invalid char in current code page? */
-						di += put_utf(wc, &label[di], 4);	/* Store it in Unicode */
-#else									/* ANSI/OEM output */
-						label[di++] = (TCHAR)wc;
+	if (fs->fs_type == FS_EXFAT) {
+		obj->c_scl = dp->obj.sclust;							/* Get containing directory info */
+		obj->c_size = ((DWORD)dp->obj.objsize & 0xFFFFFF00) | dp->obj.stat;
+		obj->c_ofs = dp->blk_ofs;
+		init_alloc_info(fs, obj);
+	} else
 #endif
-					}
-					do {				/* Truncate trailing spaces */
-						label[di] = 0;
-						if (di == 0) break;
-					} while (label[--di] == ' ');
-				}
-			}
+	{
+		obj->sclust = ld_clust(fs, dp->dir);					/* Get object allocation info */
+		obj->objsize = ld_dword(dp->dir + DIR_FileSize);
+		df->dsect = dp->sect;
+		df->dofs = (UINT)(dp->dir - fs->win);
+	}
+
+	/* Count the fragments */
+	n = nf = f1 = 0;
+	if (obj->stat == 2) {	/* Contiguous chain without FAT */
+		nxt = (DWORD)fs->csize * SS(fs);
+		n = (DWORD)((obj->objsize + nxt - 1) / nxt);
+	} else {
+		for (clst = obj->sclust; clst >= 2 && clst < fs->n_fatent; clst = nxt) {
+			nxt = get_fat(obj, clst);
+			if (nxt < 2 || n >= fs->n_fatent) return FR_INT_ERR;	/* Broken or circular chain? */
+			if (nxt == 0xFFFFFFFF) return FR_DISK_ERR;
+			n++;
+			if (nxt != clst + 1 && nf++ == 0) f1 = n;	/* End of the first fragment? */
 		}
-		if (res == FR_NO_FILE) {	/* No label entry and return nul string */
-			label[0] = 0;
-			res = FR_OK;
+	}
+	df->n_file++;
+	df->nclst = n;
+	if (nf < 2 || !mv) {	/* Not fragmented or analysis only */
+		if (nf >= 2) {
+			df->n_frgfile++; df->n_frag += nf;
 		}
+		obj->fs = 0;
+		return FR_OK;
 	}
+	df->n_frgfile++; df->n_frag += nf;
 
-	/* Get volume serial number */
-	if (res == FR_OK && vsn) {
-		res = move_window(fs, fs->volbase);
-		if (res == FR_OK) {
-			switch (fs->fs_type) {
-			case FS_EXFAT:
-				di = BPB_VolIDEx;
-				break;
-
-			case FS_FAT32:
-				di = BS_VolID32;
-				break;
-
-			default:
-				di = BS_VolID;
-			}
-			*vsn = ld_dword(fs->win + di);
+	/* Stretch the first fragment in place if the following clusters are free, else move the file into the smallest free block to hold it */
+	nxt = 0;
+	if (chk_lock(dp, 2) != FR_OK) nxt = 1;	/* Skip the file if it is open */
+	for (clst = obj->sclust + f1; nxt == 0 && clst < obj->sclust + n; clst++) {
+		nxt = (clst < fs->n_fatent) ? dfr_stat(obj, clst) : 2;
+		if (nxt == 1) return FR_INT_ERR;
+		if (nxt == 0xFFFFFFFF) return FR_DISK_ERR;
+	}
+	if (nxt == 0) {
+		df->tgt = obj->sclust;
+	} else {
+		df->tgt = dfr_find(obj, n);
+		if (df->tgt == 1) return FR_INT_ERR;
+		if (df->tgt == 0xFFFFFFFF) return FR_DISK_ERR;
+		if (df->tgt == 0) {		/* No free block to hold the file */
+			df->n_skip++;
+			obj->fs = 0;
 		}
 	}
-
-	LEAVE_FF(fs, res);
+	return FR_OK;
 }
 
 
-
-#if !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* Set Volume Label                                                      */
+/* Defragmenter: Move a run of the file into the block                   */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_setlabel (
-	const TCHAR* label	/* Volume label to set with heading logical drive number */
+/* A run is copied into the free clusters and the copy is linked to the rest
+/  of the chain first. Then the reference to the run (the previous cluster or
+/  the directory entry) is switched to the copy in a sector write, and the old
+/  run is freed at last. */
+
+static FRESULT dfr_move (
+	FFDEFRAG* df,		/* Defragmenter object */
+	UINT nsect,			/* Number of sectors to be moved (at least a cluster is moved) */
+	UINT* nc			/* Number of sectors moved (incremented) */
 )
 {
 	FRESULT res;
+	DWORD pcl, clst, nxt, ncl, k, dst, n;
+	LBA_t ss, ds;
+	UINT cnt;
+	FFOBJID *obj = &df->obj;
+	FATFS *fs = obj->fs;
+#if FF_FS_EXFAT
 	DIR dj;
-	FATFS *fs;
-	BYTE dirvn[22];
-	UINT di;
-	WCHAR wc;
-	static const char badchr[18] = "+.,;=[]" "/*:<>|\\\"\?\x7F";	/* [0..16] for FAT, [7..16] for exFAT */
-#if FF_USE_LFN
-	DWORD dc;
 #endif
 
-	/* Get logical drive */
-	res = mount_volume(&label, &fs, FA_WRITE);
-	if (res != FR_OK) LEAVE_FF(fs, res);
 
+	/* Check if the file has not been opened or changed since it was examined */
+	res = FR_OK;
+	if (chk_lock(&df->dir, 2) != FR_OK) res = FR_LOCKED;
 #if FF_FS_EXFAT
-	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-		memset(dirvn, 0, 22);
-		di = 0;
-		while ((UINT)*label >= ' ') {	/* Create volume label */
-			dc = tchar2uni(&label);	/* Get a Unicode character */
-			if (dc >= 0x10000) {
-				if (dc == 0xFFFFFFFF || di >= 10) {	/* Wrong surrogate or buffer overflow */
-					dc = 0;
-				} else {
-					st_word(dirvn + di * 2, (WCHAR)(dc >> 16)); di++;
-				}
-			}
-			if (dc == 0 || strchr(&badchr[7], (int)dc) || di >= 11) {	/* Check validity of the volume label */
-				LEAVE_FF(fs, FR_INVALID_NAME);
-			}
-			st_word(dirvn + di * 2, (WCHAR)dc); di++;
-		}
+	if (fs->fs_type == FS_EXFAT) {
+		if (res == FR_OK) res = load_obj_xdir(&dj, obj);
+		if (res == FR_OK && (ld_dword(fs->dirbuf + XDIR_FstClus) != obj->sclust || ld_qword(fs->dirbuf + XDIR_FileSize) != obj->objsize || (fs->dirbuf[XDIR_GenFlags] & 2) != obj->stat)) res = FR_NO_FILE;
 	} else
 #endif
-	{	/* On the FAT/FAT32 volume */
-		memset(dirvn, ' ', 11);
-		di = 0;
-		while ((UINT)*label >= ' ') {	/* Create volume label */
-#if FF_USE_LFN
-			dc = tchar2uni(&label);
-			wc = (dc < 0x10000) ? ff_uni2oem(ff_wtoupper(dc), CODEPAGE) : 0;
-#else									/* ANSI/OEM input */
-			wc = (BYTE)*label++;
-			if (dbc_1st((BYTE)wc)) wc = dbc_2nd((BYTE)*label) ? wc << 8 | (BYTE)*label++ : 0;
-			if (IsLower(wc)) wc -= 0x20;		/* To upper ASCII characters */
-#if FF_CODE_PAGE == 0
-			if (ExCvt && wc >= 0x80) wc = ExCvt[wc - 0x80];	/* To upper extended characters (SBCS cfg) */
-#elif FF_CODE_PAGE < 900
-			if (wc >= 0x80) wc = ExCvt[wc - 0x80];	/* To upper extended characters (SBCS cfg) */
-#endif
-#endif
-			if (wc == 0 || strchr(&badchr[0], (int)wc) || di >= (UINT)((wc >= 0x100) ? 10 : 11)) {	/* Reject invalid characters for volume label */
-				LEAVE_FF(fs, FR_INVALID_NAME);
-			}
-			if (wc >= 0x100) dirvn[di++] = (BYTE)(wc >> 8);
-			dirvn[di++] = (BYTE)wc;
+	{
+		if (res == FR_OK) res = move_window(fs, df->dsect);
+		if (res == FR_OK && (fs->win[df->dofs] == DDEM || ld_clust(fs, fs->win + df->dofs) != obj->sclust || ld_dword(fs->win + df->dofs + DIR_FileSize) != (DWORD)obj->objsize)) res = FR_NO_FILE;
+	}
+	if (res == FR_DISK_ERR) return res;
+	if (res != FR_OK) {		/* Leave the file */
+		df->n_skip++;
+		obj->fs = 0;
+		return FR_OK;
+	}
+
+	/* Find the first cluster out of place */
+	pcl = 0; clst = obj->sclust;
+	for (k = 0; k < df->nclst && clst == df->tgt + k; k++) {
+		pcl = clst;
+		clst = get_fat(obj, clst);
+		if (clst == 0xFFFFFFFF) return FR_DISK_ERR;
+	}
+	if (k == df->nclst) {	/* The file has got contiguous */
+		df->n_done++;
+		obj->fs = 0;
+		return FR_OK;
+	}
+	if (clst < 2 || clst >= fs->n_fatent) return FR_INT_ERR;
+
+	/* Get the run to be moved and the cluster following it */
+	n = nsect / fs->csize;
+	if (n == 0) n = 1;
+	for (ncl = 1; ; ncl++) {
+		nxt = get_fat(obj, clst + ncl - 1);
+		if (nxt == 1) return FR_INT_ERR;
+		if (nxt == 0xFFFFFFFF) return FR_DISK_ERR;
+		if (nxt != clst + ncl || ncl >= n || k + ncl >= df->nclst) break;
+	}
+	if (nxt >= fs->n_fatent) nxt = 0xFFFFFFFF;	/* End of the chain */
+
+	/* Check if the destination is still free */
+	dst = df->tgt + k;
+	for (n = 0; n < ncl; n++) {
+		pcl = (dst + n < fs->n_fatent) ? dfr_stat(obj, dst + n) : 2;
+		if (pcl == 1) return FR_INT_ERR;
+		if (pcl == 0xFFFFFFFF) return FR_DISK_ERR;
+		if (pcl != 0) {		/* Taken by another allocation, leave the file */
+			df->n_skip++;
+			obj->fs = 0;
+			return FR_OK;
 		}
-		if (dirvn[0] == DDEM) LEAVE_FF(fs, FR_INVALID_NAME);	/* Reject illegal name (heading DDEM) */
-		while (di && dirvn[di - 1] == ' ') di--;				/* Snip trailing spaces */
 	}
+	pcl = (k == 0) ? 0 : df->tgt + k - 1;	/* Previous cluster of the run (0:the run is the top of the chain) */
 
-	/* Set volume label */
-	dj.obj.fs = fs; dj.obj.sclust = 0;	/* Open root directory */
-	res = dir_sdi(&dj, 0);
-	if (res == FR_OK) {
-		res = DIR_READ_LABEL(&dj);	/* Get volume label entry */
-		if (res == FR_OK) {
-			if (FF_FS_EXFAT && fs->fs_type == FS_EXFAT) {
-				dj.dir[XDIR_NumLabel] = (BYTE)di;	/* Change the volume label */
-				memcpy(dj.dir + XDIR_Label, dirvn, 22);
-			} else {
-				if (di != 0) {
-					memcpy(dj.dir, dirvn, 11);	/* Change the volume label */
-				} else {
-					dj.dir[DIR_Name] = DDEM;	/* Remove the volume label */
+	/* Copy the run */
+	ss = clst2sect(fs, clst); ds = clst2sect(fs, dst);
+	for (n = ncl * fs->csize; n > 0; n -= cnt) {
+		cnt = (n < df->bsz) ? (UINT)n : df->bsz;
+		if (disk_read(fs->pdrv, df->buf, ss, cnt) != RES_OK) return FR_DISK_ERR;
+		if (disk_write(fs->pdrv, df->buf, ds, cnt) != RES_OK) return FR_DISK_ERR;
+		ss += cnt; ds += cnt;
+	}
+	if (disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK) return FR_DISK_ERR;
+
+	/* Link the copy to the rest of the chain */
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) res = change_bitmap(fs, dst, ncl, 1);	/* Mark the copy 'in use' */
+#endif
+	for (n = 0; n < ncl && res == FR_OK; n++) {
+		res = put_fat(fs, dst + n, (n + 1 < ncl) ? dst + n + 1 : nxt);
+	}
+	if (res == FR_OK) res = sync_window(fs);
+#if FF_FAT_RAM
+	if (res == FR_OK && fs->fr_wflag) res = fat_flush(fs);
+#endif
+
+	/* Switch the reference to the copy */
+	if (res == FR_OK) {
+		if (pcl != 0) {
+			res = put_fat(fs, pcl, dst);
+		} else {
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {
+				res = load_obj_xdir(&dj, obj);
+				if (res == FR_OK) {
+					st_dword(fs->dirbuf + XDIR_FstClus, dst);	/* Update start cluster */
+					res = store_xdir(&dj);
 				}
-			}
-			fs->wflag = 1;
-			res = sync_fs(fs);
-		} else {			/* No volume label entry or an error */
-			if (res == FR_NO_FILE) {
-				res = FR_OK;
-				if (di != 0) {	/* Create a volume label entry */
-					res = dir_alloc(&dj, 1);	/* Allocate an entry */
-					if (res == FR_OK) {
-						memset(dj.dir, 0, SZDIRE);	/* Clean the entry */
-						if (FF_FS_EXFAT && fs->fs_type == FS_EXFAT) {
-							dj.dir[XDIR_Type] = ET_VLABEL;	/* Create volume label entry */
-							dj.dir[XDIR_NumLabel] = (BYTE)di;
-							memcpy(dj.dir + XDIR_Label, dirvn, 22);
-						} else {
-							dj.dir[DIR_Attr] = AM_VOL;		/* Create volume label entry */
-							memcpy(dj.dir, dirvn, 11);
-						}
-						fs->wflag = 1;
-						res = sync_fs(fs);
-					}
+			} else
+#endif
+			{
+				res = move_window(fs, df->dsect);
+				if (res == FR_OK) {
+					st_clust(fs, fs->win + df->dofs, dst);	/* Update start cluster */
+					fs->wflag = 1;
 				}
 			}
+			obj->sclust = dst;
 		}
 	}
+	if (res == FR_OK) res = sync_window(fs);
+#if FF_FAT_RAM
+	if (res == FR_OK && fs->fr_wflag) res = fat_flush(fs);
+#endif
 
-	LEAVE_FF(fs, res);
+	/* Free the old run */
+#if FF_FS_EXFAT
+	if (res == FR_OK && fs->fs_type == FS_EXFAT) {
+		res = change_bitmap(fs, clst, ncl, 0);	/* Mark the run 'free' */
+	} else
+#endif
+	{
+		for (n = 0; n < ncl && res == FR_OK; n++) {
+			res = put_fat(fs, clst + n, 0);
+		}
+	}
+#if FF_ALLOC_WIN != 0
+	fs->alc_fail = 0;		/* Freed clusters can make a larger free extent */
+#endif
+	if (res == FR_OK) res = sync_fs(fs);
+	if (res == FR_OK) {
+		*nc += ncl * fs->csize;
+		df->n_moved += ncl;
+	}
+	return res;
 }
 
-#endif /* !FF_FS_READONLY */
-#endif /* FF_USE_LABEL */
-
-
 
-#if FF_USE_EXPAND && !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
-/* Allocate a Contiguous Blocks to the File                              */
+/* Open a Directory to be Defragmented                                   */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_expand (
-	FIL* fp,		/* Pointer to the file object */
-	FSIZE_t fsz,	/* File size to be expanded to */
-	BYTE opt		/* Operation mode 0:Find and prepare or 1:Find and allocate */
+FRESULT f_defragopen (
+	FFDEFRAG* df,		/* Pointer to the blank defragmenter object */
+	const TCHAR* path,	/* Pointer to the directory path */
+	void* work,			/* Pointer to the work buffer to copy the data (null:analysis only) */
+	UINT len			/* Size of the work buffer [byte] */
 )
 {
 	FRESULT res;
 	FATFS *fs;
-	DWORD n, clst, stcl, scl, ncl, tcl, lclst;
+	DIR *dp;
+	DEF_NAMBUF
 
 
-	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
-	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
-	if (fsz == 0 || fp->obj.objsize != 0 || !(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);
-#if FF_FS_EXFAT
-	if (fs->fs_type != FS_EXFAT && fsz >= 0x100000000) LEAVE_FF(fs, FR_DENIED);	/* Check if in size limit */
-#endif
-	n = (DWORD)fs->csize * SS(fs);	/* Cluster size */
-	tcl = (DWORD)(fsz / n) + ((fsz & (n - 1)) ? 1 : 0);	/* Number of clusters required */
-	stcl = fs->last_clst; lclst = 0;
-	if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+	if (!df) return FR_INVALID_OBJECT;
+	memset(df, 0, sizeof (FFDEFRAG));
+	dp = &df->dir;
 
+	/* Get logical drive */
+	res = mount_volume(&path, &fs, FA_WRITE);
+	if (res == FR_OK) {
+		dp->obj.fs = fs;
+		INIT_NAMBUF(fs);
+		res = follow_path(dp, path);			/* Follow the path to the directory */
+		if (res == FR_OK) {						/* Follow completed */
+			if (!(dp->fn[NSFLAG] & NS_NONAME)) {	/* It is not the origin directory itself */
+				if (dp->obj.attr & AM_DIR) {		/* This object is a sub-directory */
 #if FF_FS_EXFAT
-	if (fs->fs_type == FS_EXFAT) {
-		scl = find_bitmap(fs, stcl, tcl);			/* Find a contiguous cluster block */
-		if (scl == 0) res = FR_DENIED;				/* No contiguous cluster block was found */
-		if (scl == 0xFFFFFFFF) res = FR_DISK_ERR;
-		if (res == FR_OK) {	/* A contiguous free area is found */
-			if (opt) {		/* Allocate it now */
-				res = change_bitmap(fs, scl, tcl, 1);	/* Mark the cluster block 'in use' */
-				lclst = scl + tcl - 1;
-			} else {		/* Set it as suggested point for next allocation */
-				lclst = scl - 1;
-			}
-		}
-	} else
+					if (fs->fs_type == FS_EXFAT) {
+						dp->obj.c_scl = dp->obj.sclust;							/* Get containing directory inforamation */
+						dp->obj.c_size = ((DWORD)dp->obj.objsize & 0xFFFFFF00) | dp->obj.stat;
+						dp->obj.c_ofs = dp->blk_ofs;
+						init_alloc_info(fs, &dp->obj);	/* Get object allocation info */
+					} else
 #endif
-	{
-		scl = clst = stcl; ncl = 0;
-		for (;;) {	/* Find a contiguous cluster block */
-			n = get_fat(&fp->obj, clst);
-			if (++clst >= fs->n_fatent) clst = 2;
-			if (n == 1) { res = FR_INT_ERR; break; }
-			if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
-			if (n == 0) {	/* Is it a free cluster? */
-				if (++ncl == tcl) break;	/* Break if a contiguous cluster block is found */
-			} else {
-				scl = clst; ncl = 0;		/* Not a free cluster */
-			}
-			if (clst == stcl) { res = FR_DENIED; break; }	/* No contiguous cluster? */
-		}
-		if (res == FR_OK) {	/* A contiguous free area is found */
-			if (opt) {		/* Allocate it now */
-				for (clst = scl, n = tcl; n; clst++, n--) {	/* Create a cluster chain on the FAT */
-					res = put_fat(fs, clst, (n == 1) ? 0xFFFFFFFF : clst + 1);
-					if (res != FR_OK) break;
-					lclst = clst;
+					{
+						dp->obj.sclust = ld_clust(fs, dp->dir);	/* Get object allocation info */
+					}
+				} else {						/* This object is a file */
+					res = FR_NO_PATH;
 				}
-			} else {		/* Set it as suggested point for next allocation */
-				lclst = scl - 1;
+			}
+			if (res == FR_OK) {
+				dp->obj.id = fs->id;
+				res = dir_sdi(dp, 0);			/* Rewind directory */
 			}
 		}
+		FREE_NAMBUF();
+		if (res == FR_NO_FILE) res = FR_NO_PATH;
+		df->buf = (BYTE*)work;
+		df->bsz = work ? len / SS(fs) : 0;
 	}
+	if (res != FR_OK) dp->obj.fs = 0;		/* Invalidate the object if function faild */
 
-	if (res == FR_OK) {
-		fs->last_clst = lclst;		/* Set suggested start cluster to start next */
-		if (opt) {	/* Is it allocated now? */
-			fp->obj.sclust = scl;		/* Update object allocation information */
-			fp->obj.objsize = fsz;
-			if (FF_FS_EXFAT) fp->obj.stat = 2;	/* Set status 'contiguous chain' */
-			fp->flag |= FA_MODIFIED;
-			if (fs->free_clst <= fs->n_fatent - 2) {	/* Update FSINFO */
-				fs->free_clst -= tcl;
-				fs->fsi_flag |= 1;
-			}
+	LEAVE_FF(fs, res);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Defragment Files in the Directory by a Slice                          */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_defrag (
+	FFDEFRAG* df,		/* Pointer to the open defragmenter object */
+	UINT nsect			/* Number of sectors to be moved in this slice (0:Analyze rest of the directory without moving) */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	UINT nc;
+	DEF_NAMBUF
+
+
+	res = validate(&df->dir.obj, &fs);	/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fs, res);
+	if (nsect > 0 && df->bsz == 0) LEAVE_FF(fs, FR_NOT_ENOUGH_CORE);
+
+	INIT_NAMBUF(fs);
+	nc = 0;
+	while (res == FR_OK && !df->done && (nsect == 0 || nc < nsect)) {
+		if (!df->obj.fs) {		/* Examine next file */
+			res = DIR_READ_FILE(&df->dir);
+			if (res == FR_OK) res = dfr_open(df, nsect);
+		} else {				/* Move a run of the current file */
+			res = dfr_move(df, nsect - nc, &nc);
+		}
+		if (res == FR_OK && !df->obj.fs) res = dir_next(&df->dir, 0);	/* Go to next item when the file has been processed */
+		if (res == FR_NO_FILE) {	/* End of the directory */
+			df->done = 1;
+			res = FR_OK;
 		}
 	}
+	FREE_NAMBUF();
 
 	LEAVE_FF(fs, res);
 }
 
-#endif /* FF_USE_EXPAND && !FF_FS_READONLY */
+#endif /* FF_USE_DEFRAG */
 
 
 
@@ -5578,9 +8647,10 @@ FRESULT f_expand (
 /* Forward Data to the Stream Directly                                   */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_forward (
+static FRESULT fwd_put (
 	FIL* fp, 						/* Pointer to the file object */
-	UINT (*func)(const BYTE*,UINT),	/* Pointer to the streaming function */
+	UINT (*func)(const BYTE*,UINT),	/* Pointer to the streaming function (null:use sink) */
+	const FFSINK* sk,				/* Pointer to the sink */
 	UINT btf,						/* Number of bytes to forward */
 	UINT* bf						/* Pointer to number of bytes forwarded */
 )
@@ -5590,7 +8660,7 @@ FRESULT f_forward (
 	DWORD clst;
 	LBA_t sect;
 	FSIZE_t remain;
-	UINT rcnt, csect;
+	UINT rcnt, csect, nsect;
 	BYTE *dbuf;
 
 
@@ -5602,7 +8672,7 @@ FRESULT f_forward (
 	remain = fp->obj.objsize - fp->fptr;
 	if (btf > remain) btf = (UINT)remain;			/* Truncate btf by remaining bytes */
 
-	for ( ; btf > 0 && (*func)(0, 0); fp->fptr += rcnt, *bf += rcnt, btf -= rcnt) {	/* Repeat until all data transferred or stream goes busy */
+	for ( ; btf > 0 && (func ? (*func)(0, 0) : sk->put(sk, 0, 0)); fp->fptr += rcnt, *bf += rcnt, btf -= rcnt) {	/* Repeat until all data transferred or stream goes busy */
 		csect = (UINT)(fp->fptr / SS(fs) & (fs->csize - 1));	/* Sector offset in the cluster */
 		if (fp->fptr % SS(fs) == 0) {				/* On the sector boundary? */
 			if (csect == 0) {						/* On the cluster boundary? */
@@ -5616,9 +8686,14 @@ FRESULT f_forward (
 		sect = clst2sect(fs, fp->clust);			/* Get current data sector */
 		if (sect == 0) ABORT(fs, FR_INT_ERR);
 		sect += csect;
+		nsect = 1;									/* Number of sectors in the window */
 #if FF_FS_TINY
 		if (move_window(fs, sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move sector window to the file data */
 		dbuf = fs->win;
+#elif FF_FBUF_POOL != 0
+		if (fbuf_load(fp, sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move the file buffer to the sector */
+		dbuf = FBUF_PTR(fp);
+		nsect = (UINT)(fp->mtop + fp->mbcnt - sect);	/* Hand out the rest of the block at a time */
 #else
 		if (fp->sect != sect) {		/* Fill sector cache with file data */
 #if !FF_FS_READONLY
@@ -5632,18 +8707,172 @@ FRESULT f_forward (
 		dbuf = fp->buf;
 #endif
 		fp->sect = sect;
-		rcnt = SS(fs) - (UINT)fp->fptr % SS(fs);	/* Number of bytes remains in the sector */
+		rcnt = nsect * SS(fs) - (UINT)fp->fptr % SS(fs);	/* Number of bytes remains in the window */
 		if (rcnt > btf) rcnt = btf;					/* Clip it by btr if needed */
-		rcnt = (*func)(dbuf + ((UINT)fp->fptr % SS(fs)), rcnt);	/* Forward the file data */
+		dbuf += (UINT)fp->fptr % SS(fs);
+		rcnt = func ? (*func)(dbuf, rcnt) : sk->put(sk, dbuf, rcnt);	/* Forward the file data */
 		if (rcnt == 0) ABORT(fs, FR_INT_ERR);
+#if FF_FBUF_POOL != 0
+		fp->sect = sect + ((UINT)fp->fptr % SS(fs) + rcnt - 1) / SS(fs);	/* Sector of the last byte forwarded (the sink can stop in the middle of the block) */
+#endif
 	}
 
 	LEAVE_FF(fs, FR_OK);
 }
+
+
+FRESULT f_forward (
+	FIL* fp, 						/* Pointer to the file object */
+	UINT (*func)(const BYTE*,UINT),	/* Pointer to the streaming function */
+	UINT btf,						/* Number of bytes to forward */
+	UINT* bf						/* Pointer to number of bytes forwarded */
+)
+{
+	return fwd_put(fp, func, 0, btf, bf);
+}
+
+
+FRESULT f_forwards (
+	FIL* fp, 			/* Pointer to the file object */
+	const FFSINK* sk,	/* Pointer to the sink */
+	UINT btf,			/* Number of bytes to forward */
+	UINT* bf			/* Pointer to number of bytes forwarded */
+)
+{
+	FRESULT res;
+	UINT n, rcnt;
+	BYTE *buf;
+
+
+	if (!sk->claim) return fwd_put(fp, 0, sk, btf, bf);	/* The sink takes the data in place */
+
+	*bf = 0;	/* The sink lends its own buffer (e.g. DMA buffer) and the file data is read into it */
+	while (btf > 0) {
+		n = btf;
+		buf = sk->claim(sk, &n);			/* Get a buffer from the sink */
+		if (!buf || n == 0) break;			/* Sink is busy? */
+		if (n > btf) n = btf;
+		res = f_read(fp, buf, n, &rcnt);	/* Whole sectors are transferred into the buffer without the cache */
+		if (res != FR_OK) return res;
+		if (rcnt == 0) break;				/* End of file? */
+		if (!sk->commit(sk, buf, rcnt)) return FR_INT_ERR;	/* Pass the data to the sink */
+		*bf += rcnt; btf -= rcnt;
+	}
+	return FR_OK;
+}
 #endif /* FF_USE_FORWARD */
 
 
 
+#if FF_USE_ASYNC
+/*-----------------------------------------------------------------------*/
+/* Asynchronous File Read/Write                                          */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT aio_start (
+	FAIO* aio,				/* Pointer to the transfer object */
+	FIL* fp,				/* Open file to be transferred */
+	BYTE* buff,				/* Data buffer */
+	UINT btx,				/* Number of bytes to transfer */
+	BYTE op,				/* FA_READ or FA_WRITE */
+	void (*func)(FAIO*)		/* Function called on completion */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	if (aio->op) return FR_LOCKED;		/* Reject the object of a transfer in progress */
+	aio->btd = 0;
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res == FR_OK && (res = (FRESULT)fp->err) == FR_OK && !(fp->flag & op)) res = FR_DENIED;	/* Check access mode */
+	if (res == FR_OK && op == FA_WRITE && (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) && (DWORD)(fp->fptr + btx) < (DWORD)fp->fptr) {
+		btx = (UINT)(0xFFFFFFFF - (DWORD)fp->fptr);	/* File size cannot reach 4 GiB at FAT volume */
+	}
+	if (res == FR_OK) {
+		aio->fp = fp; aio->buff = buff; aio->btx = btx; aio->func = func;
+		aio->op = op;			/* Start the transfer */
+	}
+	aio->res = res;
+	LEAVE_FF(fs, res);
+}
+
+
+FRESULT f_aread (
+	FAIO* aio,				/* Pointer to the transfer object (cleared or completed) */
+	FIL* fp, 				/* Open file to be read */
+	void* buff,				/* Data buffer to store the read data (must be kept until completion) */
+	UINT btr,				/* Number of bytes to read */
+	void (*func)(FAIO*)		/* Function called on completion (null:none) */
+)
+{
+	return aio_start(aio, fp, (BYTE*)buff, btr, FA_READ, func);
+}
+
+
+#if !FF_FS_READONLY
+FRESULT f_awrite (
+	FAIO* aio,				/* Pointer to the transfer object (cleared or completed) */
+	FIL* fp,				/* Open file to be written */
+	const void* buff,		/* Data to be written (must be kept until completion) */
+	UINT btw,				/* Number of bytes to write */
+	void (*func)(FAIO*)		/* Function called on completion (null:none) */
+)
+{
+	FRESULT res;
+	FSIZE_t ofs;
+
+
+	res = aio_start(aio, fp, (BYTE*)buff, btw, FA_WRITE, func);
+	if (res == FR_OK && (ofs = fp->fptr) + aio->btx > fp->obj.objsize) {	/* Allocate the clusters to be written here, so that f_apoll() does not search the FAT */
+		res = f_lseek(fp, ofs + aio->btx);	/* Expand the file */
+		if (res == FR_OK && fp->fptr < ofs + aio->btx) aio->btx = (UINT)(fp->fptr - ofs);	/* Clip the transfer at the disk full */
+		if (res == FR_OK) res = f_lseek(fp, ofs);
+		if (res != FR_OK) {		/* Not started */
+			aio->op = 0; aio->res = res;
+		}
+	}
+	return res;
+}
+#endif
+
+
+FRESULT f_apoll (
+	FAIO* aio				/* Pointer to the transfer object */
+)
+{
+	FRESULT res;
+	FIL *fp = aio->fp;
+	BYTE busy = 0;
+	UINT n, nx;
+
+
+	if (!aio->op) return aio->res;	/* No transfer in progress */
+	if (fp->obj.fs && disk_ioctl(fp->obj.fs->pdrv, CTRL_BUSY, &busy) == RES_OK && busy) return FR_OK;	/* Do nothing while the device is busy */
+
+	n = FF_ASYNC_SLICE * SS(fp->obj.fs) - (UINT)(fp->fptr % SS(fp->obj.fs));	/* Transfer up to the slice boundary */
+	if (n > aio->btx) n = aio->btx;
+#if !FF_FS_READONLY
+	if (aio->op == FA_WRITE) {
+		res = f_write(fp, aio->buff, n, &nx);
+	} else
+#endif
+	{
+		res = f_read(fp, aio->buff, n, &nx);
+	}
+	aio->buff += nx; aio->btx -= nx; aio->btd += nx;
+	if (res != FR_OK || nx < n || aio->btx == 0) {	/* Completed? (error, end of file, disk full or all transferred) */
+		aio->res = res;
+		aio->op = 0;
+		if (aio->func) aio->func(aio);
+	}
+	return res;
+}
+
+#endif /* FF_USE_ASYNC */
+
+
+
 #if !FF_FS_READONLY && FF_USE_MKFS
 /*-----------------------------------------------------------------------*/
 /* Create FAT/exFAT volume (with sub-functions)                          */
@@ -5652,6 +8881,7 @@ FRESULT f_forward (
 #define N_SEC_TRACK 63			/* Sectors per track for determination of drive CHS */
 #define	GPT_ALIGN	0x100000	/* Alignment of partitions in GPT [byte] (>=128KB) */
 #define GPT_ITEMS	128			/* Number of GPT table size (>=128, sector aligned) */
+#define ALIGN_UP(n, a)	(((n) + (a) - 1) / (a) * (a))	/* Round up n to multiple of a */
 
 
 /* Create partitions on the physical drive in format of MBR or GPT */
@@ -5660,6 +8890,7 @@ static FRESULT create_partition (
 	BYTE drv,			/* Physical drive number */
 	const LBA_t plst[],	/* Partition list */
 	BYTE sys,			/* System ID (for only MBR, temp setting) */
+	DWORD sz_blk,		/* Alignment of the partitions [sector] (1:no alignment) */
 	BYTE* buf			/* Working buffer for a sector */
 )
 {
@@ -5688,6 +8919,7 @@ static FRESULT create_partition (
 #endif
 		rnd = (DWORD)sz_drv + GET_FATTIME();	/* Random seed */
 		align = GPT_ALIGN / ss;				/* Partition alignment for GPT [sector] */
+		if (align < sz_blk) align = sz_blk;
 		sz_ptbl = GPT_ITEMS * SZ_GPTE / ss;	/* Size of partition table [sector] */
 		top_bpt = sz_drv - sz_ptbl - 1;		/* Backup partiiton table start sector */
 		nxt_alloc = 2 + sz_ptbl;			/* First allocatable sector */
@@ -5763,7 +8995,7 @@ static FRESULT create_partition (
 
 		memset(buf, 0, FF_MAX_SS);		/* Clear MBR */
 		pte = buf + MBR_Table;	/* Partition table in the MBR */
-		for (i = 0, nxt_alloc32 = n_sc; i < 4 && nxt_alloc32 != 0 && nxt_alloc32 < sz_drv32; i++, nxt_alloc32 += sz_part32) {
+		for (i = 0, nxt_alloc32 = ALIGN_UP(n_sc, sz_blk); i < 4 && nxt_alloc32 != 0 && nxt_alloc32 < sz_drv32; i++, nxt_alloc32 = ALIGN_UP(nxt_alloc32 + sz_part32, sz_blk)) {
 			sz_part32 = (DWORD)plst[i];	/* Get partition size */
 			if (sz_part32 <= 100) sz_part32 = (sz_part32 == 100) ? sz_drv32 : sz_drv32 / 100 * sz_part32;	/* Size in percentage? */
 			if (nxt_alloc32 + sz_part32 > sz_drv32 || nxt_alloc32 + sz_part32 < nxt_alloc32) sz_part32 = sz_drv32 - nxt_alloc32;	/* Clip at drive size */
@@ -5826,6 +9058,9 @@ FRESULT f_mkfs (
 	if (vol < 0) return FR_INVALID_DRIVE;
 	if (FatFs[vol]) FatFs[vol]->fs_type = 0;	/* Clear the fs object if mounted */
 	pdrv = LD2PD(vol);			/* Physical drive */
+#if FF_FS_SNAPSHOT
+	ff_snap_save(pdrv, 0);		/* Discard the mount snapshot of the drive */
+#endif
 	ipart = LD2PT(vol);			/* Partition (0:create as new, 1..:get from partition table) */
 	if (!opt) opt = &defopt;	/* Use default parameter if it is not given */
 
@@ -5901,17 +9136,32 @@ FRESULT f_mkfs (
 #if FF_LBA64
 			if (sz_vol >= FF_MIN_GPT) {	/* Which partition type to create, MBR or GPT? */
 				fsopt |= 0x80;		/* Partitioning is in GPT */
-				b_vol = GPT_ALIGN / ss; sz_vol -= b_vol + GPT_ITEMS * SZ_GPTE / ss + 1;	/* Estimated partition offset and size */
+				b_vol = GPT_ALIGN / ss;
+				if (FF_MKFS_SDA && b_vol < sz_blk) b_vol = sz_blk;
+				sz_vol -= b_vol + GPT_ITEMS * SZ_GPTE / ss + 1;	/* Estimated partition offset and size */
 			} else
 #endif
 			{	/* Partitioning is in MBR */
-				if (sz_vol > N_SEC_TRACK) {
-					b_vol = N_SEC_TRACK; sz_vol -= b_vol;	/* Estimated partition offset and size */
+				n = FF_MKFS_SDA ? ALIGN_UP(N_SEC_TRACK, sz_blk) : N_SEC_TRACK;	/* Partition starts at erase block boundary in SDA layout */
+				if (sz_vol > n) {
+					b_vol = n; sz_vol -= b_vol;	/* Estimated partition offset and size */
 				}
 			}
 		}
 	}
 	if (sz_vol < 128) LEAVE_MKFS(FR_MKFS_ABORTED);	/* Check if volume size is >=128s */
+#if FF_MKFS_SDA
+	if (sz_au == 0) {	/* AU auto-selection in SDA layout (recommended cluster size for the card capacity) */
+		n = (DWORD)(sz_vol / (0x100000 / ss));	/* Volume size [MB] */
+		sz_au = 0x40000;						/* 256KB (> 1TB) */
+		if (n <= 0x100000) sz_au = 0x20000;		/* 128KB (<= 1TB) */
+		if (n <= 0x8000) sz_au = 0x8000;		/* 32KB (<= 32GB) */
+		if (n <= 0x400) sz_au = 0x4000;			/* 16KB (<= 1GB) */
+		if (n <= 8) sz_au = 0x2000;				/* 8KB (<= 8MB) */
+		sz_au /= ss;
+		if (sz_blk > 1 && sz_au > sz_blk) sz_au = sz_blk;	/* Do not let a cluster straddle erase blocks */
+	}
+#endif
 
 	/* Now start to create an FAT volume at b_vol and sz_vol */
 
@@ -5953,7 +9203,11 @@ FRESULT f_mkfs (
 			if (sz_vol >= 0x80000) sz_au = 64;		/* >= 512Ks */
 			if (sz_vol >= 0x4000000) sz_au = 256;	/* >= 64Ms */
 		}
+#if FF_FS_JOURNAL && JNL_OFS_EXFAT + JNL_SIZE > 32
+		b_fat = b_vol + JNL_OFS_EXFAT + JNL_SIZE;				/* FAT start next to the journal area */
+#else
 		b_fat = b_vol + 32;										/* FAT start at offset 32 */
+#endif
 		sz_fat = (DWORD)((sz_vol / sz_au + 2) * 4 + ss - 1) / ss;	/* Number of FAT sectors */
 		b_data = (b_fat + sz_fat + sz_blk - 1) & ~((LBA_t)sz_blk - 1);	/* Align data area to the erase block boundary */
 		if (b_data - b_vol >= sz_vol / 2) LEAVE_MKFS(FR_MKFS_ABORTED);	/* Too small volume? */
@@ -6108,7 +9362,11 @@ FRESULT f_mkfs (
 				}
 				n_clst = (DWORD)sz_vol / pau;	/* Number of clusters */
 				sz_fat = (n_clst * 4 + 8 + ss - 1) / ss;	/* FAT size [sector] */
+#if FF_FS_JOURNAL && JNL_OFS_FAT + JNL_SIZE > 32
+				sz_rsv = JNL_OFS_FAT + JNL_SIZE;	/* Number of reserved sectors (with the journal area) */
+#else
 				sz_rsv = 32;	/* Number of reserved sectors */
+#endif
 				sz_dir = 0;		/* No static directory */
 				if (n_clst <= MAX_FAT16 || n_clst > MAX_FAT32) LEAVE_MKFS(FR_MKFS_ABORTED);
 			} else {				/* FAT volume */
@@ -6124,7 +9382,11 @@ FRESULT f_mkfs (
 					n = (n_clst * 3 + 1) / 2 + 3;	/* FAT size [byte] */
 				}
 				sz_fat = (n + ss - 1) / ss;		/* FAT size [sector] */
+#if FF_FS_JOURNAL
+				sz_rsv = JNL_OFS_FAT + JNL_SIZE;	/* Number of reserved sectors (with the journal area) */
+#else
 				sz_rsv = 1;						/* Number of reserved sectors */
+#endif
 				sz_dir = (DWORD)n_root * SZDIRE / ss;	/* Root dir size [sector] */
 			}
 			b_fat = b_vol + sz_rsv;						/* FAT base */
@@ -6282,7 +9544,7 @@ FRESULT f_mkfs (
 	} else {								/* Volume as a new single partition */
 		if (!(fsopt & FM_SFD)) {			/* Create partition table if not in SFD */
 			lba[0] = sz_vol; lba[1] = 0;
-			fr = create_partition(pdrv, lba, sys, buf);
+			fr = create_partition(pdrv, lba, sys, FF_MKFS_SDA ? sz_blk : 1, buf);
 			if (fr != FR_OK) LEAVE_MKFS(fr);
 		}
 	}
@@ -6308,17 +9570,24 @@ FRESULT f_fdisk (
 {
 	BYTE *buf = (BYTE*)work;
 	DSTATUS stat;
+	DWORD sz_blk = 1;
 
 
 	stat = disk_initialize(pdrv);
 	if (stat & STA_NOINIT) return FR_NOT_READY;
 	if (stat & STA_PROTECT) return FR_WRITE_PROTECTED;
+#if FF_FS_SNAPSHOT
+	ff_snap_save(pdrv, 0);		/* Discard the mount snapshot of the drive */
+#endif
+#if FF_MKFS_SDA
+	if (disk_ioctl(pdrv, GET_BLOCK_SIZE, &sz_blk) != RES_OK || sz_blk == 0 || sz_blk > 0x8000 || (sz_blk & (sz_blk - 1))) sz_blk = 1;	/* Align partitions to the erase block */
+#endif
 #if FF_USE_LFN == 3
 	if (!buf) buf = ff_memalloc(FF_MAX_SS);	/* Use heap memory for working buffer */
 #endif
 	if (!buf) return FR_NOT_ENOUGH_CORE;
 
-	LEAVE_MKFS(create_partition(pdrv, ptbl, 0x07, buf));
+	LEAVE_MKFS(create_partition(pdrv, ptbl, 0x07, sz_blk, buf));
 }
 
 #endif /* FF_MULTI_PARTITION */
@@ -6960,8 +10229,13 @@ FRESULT f_setcp (
 	WORD cp		/* Value to be set as active code page */
 )
 {
+#if FF_USE_CPTBL
+	const WORD* validcp = CpCode;			/* Code pages in ffcptbl.h */
+	const BYTE* const* tables = CpExt;
+#else
 	static const WORD       validcp[22] = {  437,   720,   737,   771,   775,   850,   852,   855,   857,   860,   861,   862,   863,   864,   865,   866,   869,   932,   936,   949,   950, 0};
 	static const BYTE* const tables[22] = {Ct437, Ct720, Ct737, Ct771, Ct775, Ct850, Ct852, Ct855, Ct857, Ct860, Ct861, Ct862, Ct863, Ct864, Ct865, Ct866, Ct869, Dc932, Dc936, Dc949, Dc950, 0};
+#endif
 	UINT i;
 
 
@@ -154,6 +154,34 @@ typedef struct {
 	DWORD	last_clst;		/* Last allocated cluster */
 	DWORD	free_clst;		/* Number of free clusters */
 #endif
+#if FF_ALLOC_WIN
+	DWORD	alc_fail;		/* Smallest window size not found in the last search (0:none, cleared on freeing clusters) */
+	DWORD	alc_fpos;		/* Last allocated cluster at the failed search */
+#endif
+#if FF_ALLOC_WIN || FF_USE_STREAM
+	DWORD	blk_size;		/* Erase block size of the device [sector] (1:unknown) */
+#endif
+#if FF_FS_SNAPSHOT
+	BYTE	snap;			/* Mount snapshot status (0:not saved, 1:saved, 2:not available, 3:not available and to be discarded, 4:discarded until unmount) */
+	BYTE	snappt;			/* Partition of the volume */
+	DWORD	snapsum;		/* Checksum of the VBR */
+	DWORD	snapsn;			/* Volume serial number */
+	BYTE	snapcid[16];	/* Media ID (CID of the card) */
+#endif
+#if FF_FAT_MIRROR == 1 && !FF_FS_READONLY
+	UINT	mir_n;			/* Number of dirty FAT ranges to be reflected to the 2nd FAT */
+	DWORD	mir_top[4];		/* Top of the dirty FAT ranges (sector offset in the FAT, ascending order) */
+	DWORD	mir_end[4];		/* End of the dirty FAT ranges (next to the last sector) */
+	BYTE	mirbuf[FF_MIRROR_BUF * FF_MAX_SS];	/* Buffer to copy the FAT sectors */
+#endif
+#if FF_FS_JOURNAL
+	LBA_t	jnlbase;		/* Journal area base sector (0:journal is not used) */
+	DWORD	jnlsn;			/* Volume serial number to identify the journal */
+	UINT	jnl_n;			/* Number of sectors in the journal buffer */
+	BYTE	jnl_cmt;		/* Transaction in the journal buffer (0:open, 1:committed, 2:committed and flushed) */
+	LBA_t	jnl_sect[FF_JOURNAL_NSECT];	/* Home locations of the sectors in the journal buffer (ascending order) */
+	BYTE	jnlbuf[(FF_JOURNAL_NSECT + 1) * FF_MAX_SS];	/* Journal buffer (header sector + sector images) */
+#endif
 #if FF_FS_RPATH
 	DWORD	cdir;			/* Current directory start cluster (0:root) */
 #if FF_FS_EXFAT
@@ -170,6 +198,19 @@ typedef struct {
 	LBA_t	database;		/* Data base sector */
 #if FF_FS_EXFAT
 	LBA_t	bitbase;		/* Allocation bitmap base sector */
+#endif
+#if FF_FAT_RAM
+	UINT	fr_n;			/* Number of FAT sectors in fatram[] (0:FAT is accessed via the window) */
+#if !FF_FS_READONLY
+	BYTE	fr_wflag;		/* fatram[] has dirty sectors */
+	BYTE	fr_dirty[(FF_FAT_RAM + 7) / 8];	/* Dirty flags of the sectors in fatram[] */
+#endif
+	BYTE*	fatram;			/* Whole FAT of the FAT12/16 volume (taken by ff_memalloc() at mount, null:not taken) */
+#endif
+#if FF_DIR_SCAN
+	LBA_t	dstop;			/* Top sector of the directory sectors in dsbuf[] */
+	UINT	dscnt;			/* Number of the directory sectors in dsbuf[] (0:invalid) */
+	BYTE	dsbuf[FF_DIR_SCAN * FF_MAX_SS];	/* Directory scan buffer */
 #endif
 	LBA_t	winsect;		/* Current sector appearing in the win[] */
 	BYTE	win[FF_MAX_SS];	/* Disk access window for Directory, FAT (and file data at tiny cfg) */
@@ -216,6 +257,19 @@ typedef struct {
 #if FF_USE_FASTSEEK
 	DWORD*	cltbl;			/* Pointer to the cluster link map table (nulled on open, set by application) */
 #endif
+#if FF_USE_STREAM
+	DWORD	strm_ext;		/* Size of the block to be reserved in streaming mode [clusters] (0:not in streaming mode) */
+	DWORD	strm_top;		/* Top of uncommitted part of the reserved block (0:no block) */
+	DWORD	strm_end;		/* End of the reserved block (next to the last cluster) */
+	DWORD	strm_tail;		/* Last cluster of the committed chain (0:no chain) */
+#endif
+#if FF_FBUF_POOL
+	BYTE*	mbuf;			/* Pointer to the file buffer (a block of the pool or buf[]) */
+	LBA_t	mtop;			/* Top sector of the block in mbuf[] */
+	UINT	mbsz;			/* Size of mbuf[] [sectors] */
+	UINT	mbcnt;			/* Number of sectors of the block in mbuf[] (0:invalid) */
+	UINT	mbdty;			/* Number of sectors to be written back from the top of mbuf[] */
+#endif
 #if !FF_FS_TINY
 	BYTE	buf[FF_MAX_SS];	/* File private data read/write window */
 #endif
@@ -259,6 +313,116 @@ typedef struct {
 
 
 
+#if FF_USE_DIRBATCH
+/* Compact directory entry structure (FFDIRENT) */
+
+typedef struct {
+	FSIZE_t	fsize;			/* File size */
+	DWORD	sclust;			/* Start cluster (0:no cluster) */
+	WORD	fdate;			/* Modified date */
+	WORD	ftime;			/* Modified time */
+	BYTE	fattrib;		/* File attribute */
+	TCHAR	fname[FF_DIRENT_NAME];	/* File name */
+} FFDIRENT;
+#endif
+
+
+
+#if FF_USE_FORWARD
+/* Data sink structure (FFSINK) */
+
+typedef struct FFSINK_ {
+	UINT	(*put)(const struct FFSINK_*, const BYTE*, UINT);	/* Consume file data in place, returns number of bytes consumed (0:busy) */
+	BYTE*	(*claim)(const struct FFSINK_*, UINT*);	/* Lend a buffer to be filled (null:busy), in/out: number of bytes wanted/lent */
+	int		(*commit)(const struct FFSINK_*, BYTE*, UINT);	/* Pass the filled buffer, returns 0 on error */
+	void*	ctx;			/* Sink dependent data */
+} FFSINK;
+#endif
+
+
+
+#if FF_USE_FRAGSTAT
+/* Fragmentation report structure (FFFRAG) */
+
+typedef struct {
+	DWORD	n_clst;			/* Number of clusters of the object */
+	DWORD	n_frag;			/* Number of fragments of the object */
+	DWORD	n_used;			/* Number of clusters in use on the volume */
+	DWORD	n_ufrag;		/* Number of fragments of all chains (FAT) or of used extents (exFAT) */
+	DWORD	n_chain;		/* Number of chains on the FAT (0 at exFAT) */
+	DWORD	n_free;			/* Number of free clusters */
+	DWORD	n_ffrag;		/* Number of free extents */
+	DWORD	max_free;		/* Size of the largest free extent [clusters] */
+} FFFRAG;
+#endif
+
+
+
+#if FF_USE_DEFRAG
+/* Defragmenter object structure (FFDEFRAG) */
+
+typedef struct {
+	DIR		dir;			/* Directory to be processed (points the current file) */
+	FFOBJID	obj;			/* Current file (obj.fs == 0:no current file) */
+	LBA_t	dsect;			/* Sector containing the directory entry of the file (not used at exFAT) */
+	UINT	dofs;			/* Offset of the directory entry in the sector (not used at exFAT) */
+	DWORD	nclst;			/* Number of clusters of the file */
+	DWORD	tgt;			/* Top of the contiguous block the file is moved into */
+	BYTE*	buf;			/* Work buffer to copy the data */
+	UINT	bsz;			/* Size of the work buffer [sectors] */
+	BYTE	done;			/* All files in the directory have been processed */
+	DWORD	n_file;			/* Number of files examined */
+	DWORD	n_frgfile;		/* Number of fragmented files found */
+	DWORD	n_frag;			/* Number of fragments of the fragmented files */
+	DWORD	n_done;			/* Number of files made contiguous */
+	DWORD	n_skip;			/* Number of fragmented files left (no free block, in use or changed) */
+	DWORD	n_moved;		/* Number of clusters moved */
+} FFDEFRAG;
+#endif
+
+
+
+#if FF_FS_SNAPSHOT
+/* Mount snapshot structure (FFSNAP) */
+
+typedef struct {
+	BYTE	cid[16];		/* Media ID (CID of the card) */
+	DWORD	vbrsum;			/* Checksum of the VBR */
+	DWORD	volsn;			/* Volume serial number */
+	LBA_t	volbase;		/* Volume base sector */
+	LBA_t	fatbase;		/* FAT base sector */
+	LBA_t	dirbase;		/* Root directory base sector/cluster */
+	LBA_t	database;		/* Data base sector */
+	LBA_t	bitbase;		/* Allocation bitmap base sector (exFAT) */
+	DWORD	n_fatent;		/* Number of FAT entries (number of clusters + 2) */
+	DWORD	fsize;			/* Size of an FAT [sectors] */
+	DWORD	last_clst;		/* Last allocated cluster */
+	DWORD	free_clst;		/* Number of free clusters (0xFFFFFFFF:unknown) */
+	WORD	csize;			/* Cluster size [sectors] */
+	WORD	n_rootdir;		/* Number of root directory entries (FAT12/16) */
+	BYTE	fs_type;		/* FAT sub-type */
+	BYTE	n_fats;			/* Number of FATs */
+	BYTE	part;			/* Partition of the volume */
+	BYTE	fsi_flag;		/* FSINFO flags */
+} FFSNAP;
+#endif
+
+
+
+#if FF_USE_LFN == 3 && FF_MEMPOOL
+/* Memory pool statistics structure (FFMEMSTAT) */
+
+typedef struct {
+	UINT	bsize;			/* Block size [byte] */
+	UINT	nblk;			/* Number of blocks */
+	UINT	used;			/* Number of blocks in use */
+	UINT	peak;			/* High-water mark of blocks in use */
+	UINT	fail;			/* Number of requests refused due to no free block */
+} FFMEMSTAT;
+#endif
+
+
+
 /* Format parameter structure (MKFS_PARM) */
 
 typedef struct {
@@ -298,6 +462,22 @@ typedef enum {
 
 
 
+#if FF_USE_ASYNC
+/* Asynchronous transfer object structure (FAIO) */
+
+typedef struct FAIO_ {
+	FIL*	fp;				/* File object of the transfer */
+	BYTE*	buff;			/* Pointer to the data to be transferred next */
+	UINT	btx;			/* Number of bytes remaining */
+	UINT	btd;			/* Number of bytes transferred */
+	BYTE	op;				/* Transfer in progress (0:none, FA_READ or FA_WRITE) */
+	FRESULT	res;			/* Result of the transfer (valid when op is 0) */
+	void	(*func)(struct FAIO_*);	/* Function called on completion (null:none) */
+} FAIO;
+#endif
+
+
+
 /*--------------------------------------------------------------*/
 /* FatFs module application interface                           */
 
@@ -313,6 +493,9 @@ FRESULT f_closedir (DIR* dp);										/* Close an open directory */
 FRESULT f_readdir (DIR* dp, FILINFO* fno);							/* Read a directory item */
 FRESULT f_findfirst (DIR* dp, FILINFO* fno, const TCHAR* path, const TCHAR* pattern);	/* Find first file */
 FRESULT f_findnext (DIR* dp, FILINFO* fno);							/* Find next file */
+#if FF_USE_DIRBATCH
+FRESULT f_readdirs (DIR* dp, FFDIRENT* ent, UINT n, UINT* nr, const TCHAR* pat, BYTE opt);	/* Read a batch of directory items */
+#endif
 FRESULT f_mkdir (const TCHAR* path);								/* Create a sub directory */
 FRESULT f_unlink (const TCHAR* path);								/* Delete an existing file or directory */
 FRESULT f_rename (const TCHAR* path_old, const TCHAR* path_new);	/* Rename/Move a file or directory */
@@ -326,7 +509,24 @@ FRESULT f_getfree (const TCHAR* path, DWORD* nclst, FATFS** fatfs);	/* Get numbe
 FRESULT f_getlabel (const TCHAR* path, TCHAR* label, DWORD* vsn);	/* Get volume label */
 FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
+#if FF_USE_FORWARD
+FRESULT f_forwards (FIL* fp, const FFSINK* sk, UINT btf, UINT* bf);	/* Forward data to the sink */
+#endif
 FRESULT f_expand (FIL* fp, FSIZE_t fsz, BYTE opt);					/* Allocate a contiguous block to the file */
+FRESULT f_stream (FIL* fp, FSIZE_t fsz);							/* Enter/Leave streaming mode of the file */
+FRESULT f_sizehint (FIL* fp, FSIZE_t fsz);							/* Declare the expected size of the file */
+#if FF_USE_FRAGSTAT
+FRESULT f_fragstat (const TCHAR* path, FFFRAG* st);					/* Get fragmentation of the file and the volume */
+#endif
+#if FF_USE_DEFRAG
+FRESULT f_defragopen (FFDEFRAG* df, const TCHAR* path, void* work, UINT len);	/* Open a directory to be defragmented */
+FRESULT f_defrag (FFDEFRAG* df, UINT nsect);						/* Defragment files in the directory by a slice (0:analysis only) */
+#endif
+#if FF_USE_ASYNC
+FRESULT f_aread (FAIO* aio, FIL* fp, void* buff, UINT btr, void (*func)(FAIO*));		/* Start to read data from the file */
+FRESULT f_awrite (FAIO* aio, FIL* fp, const void* buff, UINT btw, void (*func)(FAIO*));	/* Start to write data to the file */
+FRESULT f_apoll (FAIO* aio);										/* Move the transfer forward by a slice */
+#endif
 FRESULT f_mount (FATFS* fs, const TCHAR* path, BYTE opt);			/* Mount/Unmount a logical drive */
 FRESULT f_mkfs (const TCHAR* path, const MKFS_PARM* opt, void* work, UINT len);	/* Create a FAT volume */
 FRESULT f_fdisk (BYTE pdrv, const LBA_t ptbl[], void* work);		/* Divide a physical drive into some partitions */
@@ -344,6 +544,7 @@ TCHAR* f_gets (TCHAR* buff, int len, FIL* fp);						/* Get a string from the fil
 #define f_rewinddir(dp) f_readdir((dp), 0)
 #define f_rmdir(path) f_unlink(path)
 #define f_unmount(path) f_mount(0, path, 0)
+#define f_abusy(aio) ((aio)->op != 0)
 
 
 
@@ -351,6 +552,12 @@ TCHAR* f_gets (TCHAR* buff, int len, FIL* fp);						/* Get a string from the fil
 /*--------------------------------------------------------------*/
 /* Additional user defined functions                            */
 
+/* Mount snapshot functions */
+#if FF_FS_SNAPSHOT
+int ff_snap_load (BYTE pdrv, FFSNAP* snap);			/* Load the mount snapshot of the drive (1:loaded) */
+int ff_snap_save (BYTE pdrv, const FFSNAP* snap);	/* Save the mount snapshot of the drive (null:discard) (1:saved) */
+#endif
+
 /* RTC function */
 #if !FF_FS_READONLY && !FF_FS_NORTC
 DWORD get_fattime (void);
@@ -365,6 +572,9 @@ DWORD ff_wtoupper (DWORD uni);			/* Unicode upper-case conversion */
 #if FF_USE_LFN == 3						/* Dynamic memory allocation */
 void* ff_memalloc (UINT msize);			/* Allocate memory block */
 void ff_memfree (void* mblock);			/* Free memory block */
+#if FF_MEMPOOL
+int ff_memstat (UINT cls, FFMEMSTAT* st);	/* Get memory pool statistics */
+#endif
 #endif
 
 /* Sync functions */
@@ -372,6 +582,9 @@ void ff_memfree (void* mblock);			/* Free memory block */
 int ff_cre_syncobj (BYTE vol, FF_SYNC_t* sobj);	/* Create a sync object */
 int ff_req_grant (FF_SYNC_t sobj);		/* Lock sync object */
 void ff_rel_grant (FF_SYNC_t sobj);		/* Unlock sync object */
+#if FF_SYNC_SLICE != 0
+void ff_pass_grant (FF_SYNC_t sobj);	/* Unlock sync object and let waiting tasks run */
+#endif
 int ff_del_syncobj (FF_SYNC_t sobj);	/* Delete a sync object */
 #endif
 
@@ -391,6 +604,14 @@ int ff_del_syncobj (FF_SYNC_t sobj);	/* Delete a sync object */
 #define	FA_OPEN_ALWAYS		0x10
 #define	FA_OPEN_APPEND		0x30
 
+/* Batch directory read options (6th argument of f_readdirs) */
+#define RD_NODIR		0x01	/* Skip directories */
+#define RD_NOFILE		0x02	/* Skip files */
+#define RD_NOHIDDEN		0x04	/* Skip hidden and system items */
+#define RD_SORTNAME		0x10	/* Sort the items by name */
+#define RD_SORTTIME		0x20	/* Sort the items by modified time (and by name if RD_SORTNAME is also given) */
+#define RD_REVERSE		0x40	/* Sort in descending order */
+
 /* Fast seek controls (2nd argument of f_lseek) */
 #define CREATE_LINKMAP	((FSIZE_t)0 - 1)
 
@@ -30,18 +30,102 @@
 /  f_findnext(). (0:Disable, 1:Enable 2:Enable with matching altname[] too) */
 
 
-#define FF_USE_MKFS		0
+#define FF_USE_DIRBATCH	0
+#define FF_DIRENT_NAME	32
+/* This option switches f_readdirs() function, which reads a batch of directory items
+/  into an array of compact entries (FFDIRENT) in a call with optional filtering
+/  and sorting. (0:Disable or 1:Enable)
+/  FF_DIRENT_NAME defines size of the name buffer in FFDIRENT in unit of TCHAR,
+/  13 to FF_LFN_BUF + 1. A name that does not fit in it is returned in the short
+/  name or "?". */
+
+
+#define FF_USE_MKFS		1
 /* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
 
 
+#define FF_MKFS_SDA		1
+/* This option switches the SD card layout of f_mkfs() and f_fdisk(). (0:Disable or 1:Enable)
+/  When enabled, the volume is laid out after the SD Association file system
+/  specification on the erase block size (AU) returned by disk_ioctl(GET_BLOCK_SIZE)
+/  or given by MKFS_PARM.align. The new partition starts at an AU boundary, the
+/  data area is aligned to the AU and the default cluster size is the recommended
+/  one for the card capacity (8KB-256KB), but not larger than the AU. Thus any
+/  cluster is written within an erase block. */
+
+
 #define FF_USE_FASTSEEK	0
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
-#define FF_USE_EXPAND	0
+#define FF_USE_EXPAND	1
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
+#define FF_USE_STREAM	0
+/* This option switches streaming mode of the file, f_stream() function.
+/
+/   0: Disable.
+/  >0: Enable. The value defines how many files can be in streaming mode
+/      simultaneously.
+/
+/  A file in streaming mode reserves a contiguous block of clusters ahead of the
+/  write pointer. The block is aligned to the erase block size (GET_BLOCK_SIZE)
+/  when it is larger than the cluster. File data is written into the block with
+/  multiple sector transfers across the cluster boundaries, and the FAT chain,
+/  allocation bitmap, FSINFO and directory entry are not updated until a
+/  checkpoint: f_sync(), f_close(), f_lseek(), f_truncate() and when the block
+/  is used up and cannot be stretched in place. The reserved block is held in
+/  the file object only, so that the streaming file must be closed or left
+/  streaming mode with f_stream(fp, 0) before it is discarded.
+/  Also FF_FS_READONLY needs to be 0 to enable this option. */
+
+
+#define FF_USE_FRAGSTAT	1
+/* This option switches f_fragstat() function that reports the fragmentation of
+/  a file and of the volume. (0:Disable or 1:Enable) */
+
+
+#define FF_ALLOC_WIN	16
+/* This option switches the extent allocator and f_sizehint() function.
+/
+/   0: Disable. New clusters are allocated by next-fit from the last allocation.
+/  >0: Enable. The value defines how many files can have an allocation window
+/      simultaneously (1-16).
+/
+/  A file opened with write access gets an allocation window, a range of free
+/  clusters ahead of the chain that is claimed for the file in memory. Clusters
+/  are taken from the window in order and other allocations skip the claimed
+/  clusters, so that files written concurrently do not interleave. The claims
+/  are released when no other free cluster is left.
+/  The window size is the erase block size (GET_BLOCK_SIZE) or 16 clusters at
+/  least and is doubled each time a window of the file is used up, up to eight
+/  times. When the expected file size is declared with f_sizehint(), the window
+/  is placed in the smallest free extent that can hold the rest of the file. The
+/  search checks up to 4096 clusters from the last allocation, and the largest free
+/  extent found is taken when none of them can hold the window, so that placing a
+/  window on a large and fragmented volume does not scan the whole FAT.
+/  The window is released on f_close(). The windows are held in a table of this
+/  size, so it should cover the files written concurrently. When the table is
+/  full, the window of an open file is not taken over. A file opened then is
+/  allocated without window until an entry is released, and f_sizehint() fails
+/  with FR_TOO_MANY_OPEN_FILES. The erase block size is read once at the mount.
+/  Also FF_FS_READONLY needs to be 0 to enable this option. */
+
+
+#define FF_USE_DEFRAG	0
+/* This option switches the incremental defragmenter, f_defragopen() and
+/  f_defrag() functions. (0:Disable or 1:Enable)
+/
+/  f_defrag() works on the files in a directory a slice at a time. Each slice
+/  copies a run of clusters into a contiguous block, links the copy to the
+/  chain and then frees the old run, so that a power failure can leave lost
+/  clusters at worst (nothing with FF_FS_JOURNAL). It also gives an analysis
+/  report of the fragmented files. The open files are skipped by the file lock
+/  function, so that FF_FS_LOCK needs to be 1 or larger and FF_FS_READONLY needs
+/  to be 0 to enable this option. */
+
+
 #define FF_USE_CHMOD	0
 /* This option switches attribute manipulation functions, f_chmod() and f_utime().
 /  (0:Disable or 1:Enable) Also FF_FS_READONLY needs to be 0 to enable this option. */
@@ -52,8 +136,29 @@
 /  (0:Disable or 1:Enable) */
 
 
-#define FF_USE_FORWARD	0
-/* This option switches f_forward() function. (0:Disable or 1:Enable) */
+#define FF_USE_FORWARD	1
+/* This option switches f_forward() and f_forwards() functions. (0:Disable or 1:Enable)
+/  f_forwards() passes the file data to a sink (FFSINK) without an intermediate
+/  buffer of the application. A sink with put() gets windows of the file data in the
+/  file buffer, up to a block of FF_FBUF_SECT sectors when FF_FBUF_POOL is enabled.
+/  A sink with claim() lends its own transmit buffer and whole sectors are read into
+/  it directly from the device. */
+
+
+#define FF_USE_ASYNC	0
+#define FF_ASYNC_SLICE	4
+/* This option switches asynchronous file read/write functions, f_aread(), f_awrite()
+/  and f_apoll(). (0:Disable or 1:Enable)
+/  f_aread()/f_awrite() only start a transfer and each call of f_apoll() moves it
+/  forward by up to FF_ASYNC_SLICE sectors (1 to 128), so that a main loop is not
+/  blocked longer than the time for a slice. f_apoll() returns immediately while the
+/  device reports busy to disk_ioctl(CTRL_BUSY). f_awrite() expands the file to the
+/  end of the transfer, so that the clusters are allocated in the start call and a
+/  poll does not search the FAT. A poll costs the sectors of the slice, the write-back
+/  of the file buffer and a FAT sector read per cluster boundary in the slice. The
+/  expanded area has undefined data until it is written. The FAIO object needs to be
+/  cleared before the first use, and a start call on the object of a transfer in
+/  progress is rejected with FR_LOCKED. f_awrite() needs FF_FS_MINIMIZE <= 2. */
 
 
 #define FF_USE_STRFUNC	0
@@ -113,7 +218,7 @@
 */
 
 
-#define FF_USE_LFN		1
+#define FF_USE_LFN		3
 #define FF_MAX_LFN		255
 /* The FF_USE_LFN switches the support for LFN (long file name).
 /
@@ -133,6 +238,27 @@
 /  ff_memfree() exemplified in ffsystem.c, need to be added to the project. */
 
 
+#define FF_MEMPOOL		1
+#define FF_MPL_SBLK		1120
+#define FF_MPL_SNUM		2
+#define FF_MPL_LBLK		4096
+#define FF_MPL_LNUM		1
+/* The FF_MEMPOOL switches the memory management functions in ffsystem.c used at
+/  FF_USE_LFN == 3.
+/
+/   0: ff_memalloc() and ff_memfree() use malloc() and free() of the C library.
+/   1: They use a fixed-block memory pool on the BSS. No heap is needed.
+/
+/  The pool has FF_MPL_SNUM small blocks of FF_MPL_SBLK bytes and FF_MPL_LNUM large
+/  blocks of FF_MPL_LBLK bytes, up to 32 blocks each. A request takes a free block of
+/  the smallest size it fits in, or of the large size if all small blocks are in use,
+/  so that both functions finish in a bounded time and are lock-free in re-entrant
+/  configuration. The small block needs to hold the LFN working buffer shown above and
+/  one is used by each file function in progress. The large block is the scratch buffer
+/  of directory cluster clear and the working buffer of f_mkfs() and f_fdisk() when no
+/  work area is given. The usage and high-water marks can be read by ff_memstat(). */
+
+
 #define FF_LFN_UNICODE	0
 /* This option switches the character encoding on the API when LFN is enabled.
 /
@@ -153,6 +279,55 @@
 /  on character encoding. When LFN is not enabled, these options have no effect. */
 
 
+#define FF_SFN_TAIL		0
+/* This option selects how to find a free numbered SFN (~n tail) for the new object
+/  with LFN which is out of 8.3 format. When LFN is not enabled, this option has no
+/  effect.
+/
+/   0: Try the numbered SFNs in sequence, searching the directory for each of them.
+/      It takes up to 99 directory scans in the directory with many similar names.
+/   1: Collect the numbered SFNs in use in a single directory scan and pick a free
+/      one. The SFNs to be generated are the same as 0.
+/   2: Same as 1 but hash based tail is used from the first try, so that the SFN is
+/      determined by the LFN regardless of order of creation. */
+
+
+#define FF_UNI2OEM_MAP	0
+/* This option selects the lookup method of ff_uni2oem(), which converts a Unicode
+/  character into the OEM code on creating or reading file names. When LFN is not
+/  enabled, this option has no effect.
+/
+/   0: Linear search of the OEM-to-Unicode table (SBCS) and binary search of the
+/      Unicode-to-OEM pair table (DBCS).
+/   1: Binary search of the Unicode-to-OEM pair table for SBCS too. It takes 512 bytes
+/      of constant memory per code page.
+/   2: 1 + Two-level direct map for DBCS instead of the pair table. The size of the
+/      table changes 29.6K->48.2K (932), 87.2K->49.9K (936), 68.2K->71.7K (949) and
+/      54.0K->47.1K (950) bytes. */
+
+
+#define FF_USE_CPTBL	0
+/* This option switches the source of the code conversion tables.
+/
+/   0: Built-in tables in ffunicode.c and ff.c.
+/   1: Tables in ffcptbl.h generated by mkcptbl.py for the code pages given to it.
+/
+/  When FF_USE_CPTBL == 1, only the generated code pages are built into the program
+/  and f_setcp() accepts only them. Each conversion table is compressed into a two-
+/  level map of code blocks that is looked up in constant time, and FF_UNI2OEM_MAP
+/  has no effect. mkcptbl.py reports the table size and lookup cost of each code
+/  page. When FF_CODE_PAGE != 0, it needs to be in the generated code pages. */
+
+
+#define FF_WTOUPPER_TBL	0
+/* This option switches the direct up-case conversion table of ff_wtoupper() for
+/  U+0080 - U+05FF, which covers the letters of all SBCS code pages. The table
+/  takes 2.75 KB of constant memory and converts the letters in constant time
+/  instead of searching the compressed table. ASCII characters are always converted
+/  without the table. When LFN is not enabled, this option has no effect.
+/  (0:Disable or 1:Enable) */
+
+
 #define FF_FS_RPATH		1
 /* This option configures support for relative path.
 /
@@ -219,6 +394,14 @@
 /  disk_ioctl() function. */
 
 
+#define FF_USE_ZEROFILL	1
+/* This option switches support for device side zero fill. (0:Disable or 1:Enable)
+/  When enabled, the cluster of a new or stretched directory is cleared by a CTRL_ZERO
+/  command to the disk_ioctl() function, so that the device can fill the sectors in a
+/  multiple sector write or an erase instead of a write per sector. The generic writes
+/  are used when the command is failed. */
+
+
 
 /*---------------------------------------------------------------------------/
 / System Configurations
@@ -231,6 +414,26 @@
 /  buffer in the filesystem object (FATFS) is used for the file data transfer. */
 
 
+#define FF_DIR_SCAN	0
+/* FF_DIR_SCAN defines size of the directory scan buffer in the filesystem object
+/  in unit of sector. (0:Disable)
+/  When it is not 0, directory scans (reading, finding and allocating entries) load
+/  up to FF_DIR_SCAN sectors of the directory cluster with a multiple sector read
+/  into the scan buffer and the following sectors are taken from the buffer, so
+/  that a scan of a large directory is not bound by the command overhead. */
+
+
+#define FF_FBUF_POOL	0
+#define FF_FBUF_SECT	8
+/* FF_FBUF_POOL defines size of the file buffer pool in unit of sector. (0:Disable)
+/  When the pool is enabled, f_open() gives the file a buffer of up to FF_FBUF_SECT
+/  sectors (2-128) from the pool, or leaves the file the sector buffer in the file
+/  object if the pool has no room. The buffer holds a block of sectors in the
+/  cluster, so that short sequential reads are served from a multiple sector read
+/  and short writes are accumulated into a multiple sector write. The buffer is
+/  returned to the pool by f_close(). This option must be 0 at tiny configuration. */
+
+
 #define FF_FS_EXFAT		1
 /* This option switches support for exFAT filesystem. (0:Disable or 1:Enable)
 /  To enable exFAT, also LFN needs to be enabled. (FF_USE_LFN >= 1)
@@ -263,6 +466,70 @@
 */
 
 
+#define FF_FS_SNAPSHOT	0
+/* The option FF_FS_SNAPSHOT switches the mount snapshot. (0:Disable or 1:Enable)
+/  When enabled, the volume parameters and the cluster allocation information (free
+/  cluster count and last allocated cluster) are saved to a non-volatile memory of the
+/  system on f_close() and unmount. The volume mount restores them instead of searching
+/  the partition table, parsing the VBR and getting the free clusters, when the media ID
+/  got by MMC_GET_CID command and checksum of the VBR match the snapshot. It is discarded
+/  before the first change of the cluster allocation on the disk and then it is not saved
+/  until unmount, so that it is saved at most twice a mount session. The functions ff_snap_load() and ff_snap_save() need to be
+/  added to the project. A card modified by another host without changing the VBR needs
+/  the snapshot to be discarded by the application with ff_snap_save(pdrv, 0). */
+
+
+#define FF_FS_JOURNAL	0
+#define FF_JOURNAL_NSECT	8
+/* The option FF_FS_JOURNAL switches the metadata journal. (0:Disable or 1:Enable)
+/  When enabled, the changes of the FAT, allocation bitmap, directories and FSInfo
+/  are collected in the journal buffer and written at the sync as a transaction.
+/  The transaction is written in a burst to the journal area and made durable by
+/  the sync, and it is written in place when the next transaction begins or the
+/  volume is unmounted. A transaction left in the journal area is replayed at the
+/  next mount, so that each sync leaves the volume consistent on a power failure.
+/  The unmount syncs the volume and writes the last transaction in place, so that
+/  unmount the volume before the medium is taken to another host.
+/  The journal area is 1 + FF_JOURNAL_NSECT sectors in the reserved area of the volume,
+/  at offset 16 (FAT/FAT32) or 24 (exFAT), and f_mkfs() reserves it. Enabling the
+/  journal on an existing volume overwrites these reserved sectors. A volume without
+/  room for it, such as an FAT12/16 volume with one reserved sector, is used without
+/  the journal. FF_JOURNAL_NSECT is number of sectors in a transaction, 1 to 62, and
+/  the FATFS object grows by (FF_JOURNAL_NSECT + 1) * FF_MAX_SS bytes. An operation
+/  which changes more sectors than that, such as a large cluster chain allocation,
+/  is split into multiple transactions and it is atomic only in each part. */
+
+
+#define FF_FAT_MIRROR	0
+#define FF_MIRROR_BUF	4
+/* The option FF_FAT_MIRROR selects how changes of the FAT are reflected to the
+/  2nd FAT on the FAT/FAT32 volume with two FATs.
+/
+/   0: Immediate. Every FAT sector is written to both FATs when it is flushed.
+/   1: Deferred. Flushed FAT sectors are recorded as dirty ranges and copied to
+/      the 2nd FAT in ascending order with multiple sector transfers when the
+/      volume is synchronized. (f_sync(), f_close(), f_mkdir() and so on)
+/   2: Single FAT. The 2nd FAT is never updated. This is the fastest mode, but
+/      the 2nd FAT gets out of date and a disk checker may report a mismatch.
+/
+/  In mode 1, the 2nd FAT keeps the state of the last synchronization until the
+/  next one. FF_MIRROR_BUF defines size of the copy buffer in the filesystem
+/  object in unit of sector. (1-32) */
+
+
+#define FF_FAT_RAM		0
+/* This option defines the largest FAT to be held in RAM in unit of sector.
+/  (0:Disable or 1-128)
+/  When the whole FAT of an FAT12/16 volume is not larger than this, a buffer for it
+/  is taken by ff_memalloc() at mount and the FAT is loaded with a multiple sector
+/  read. All FAT accesses are served from the buffer. The changed sectors are written
+/  back with multiple sector transfers at the sync, or before any other metadata
+/  sector is written so that the FAT always gets to the disk first. The buffer is
+/  released at unmount. A larger FAT, the FAT32/exFAT volumes and a failed allocation
+/  fall back to the window, so they cost no RAM. FF_USE_LFN needs to be 3, and with
+/  FF_MEMPOOL the pool needs a large block of the FAT size in addition. */
+
+
 #define FF_FS_LOCK		0
 /* The option FF_FS_LOCK switches file lock function to control duplicated file open
 /  and illegal operation to open objects. This option must be 0 when FF_FS_READONLY
@@ -275,6 +542,44 @@
 /      lock control is independent of re-entrancy. */
 
 
+#define FF_DIR_INDEX	0
+/* The option FF_DIR_INDEX switches in-memory name index of the FAT/FAT32 directory
+/  to speed up the object lookup in large directories. The index is built when a
+/  lookup scans 64 or more entries of a directory, and then the following lookups
+/  in the directory go through the hashed index instead of the linear search. The
+/  index follows the changes made by FatFs and it is discarded on re-mount. The
+/  exFAT volume does not use the index because it has name hash in the entry.
+/
+/  0:    Disable directory index.
+/  >=640: Enable directory index. The value defines memory budget of the index of
+/        a directory in unit of byte. Every object name takes 10 bytes, and 20 bytes
+/        with LFN. A directory that has more names than the budget is not indexed.
+/  Note that the index is shared by all volumes, so that it is not available in
+/  re-entrant configuration with two or more volumes. */
+
+
+#define FF_DIR_INDEX_NUM	2
+/* This option defines number of directories indexed at a time when FF_DIR_INDEX is
+/  enabled. (1-16) Each directory has its own index keyed by the start cluster and
+/  the least recently used one is replaced when another large directory is looked up.
+/  It takes FF_DIR_INDEX bytes of memory per directory. */
+
+
+#define FF_PATH_CACHE	0
+/* The option FF_PATH_CACHE switches path resolution cache. It holds start cluster
+/  of the sub-directories found in the path names, so that the following accesses
+/  to the objects in the same sub-directory skip directory search at each upper
+/  level of the path. The cache follows rename and removal of the sub-directories
+/  made by FatFs and it is discarded on re-mount. Sub-directory name longer than 32
+/  characters is not cached.
+/
+/  0:     Disable path resolution cache.
+/  1..64: Enable path resolution cache. The value defines how many sub-directories
+/         are cached. Least recently used one is replaced when the cache is full.
+/  Note that the cache is shared by all volumes, so that it is not available in
+/  re-entrant configuration with two or more volumes. */
+
+
 /* #include <somertos.h>	// O/S definitions */
 #define FF_FS_REENTRANT	0
 #define FF_FS_TIMEOUT	1000
@@ -293,8 +598,18 @@
 /
 /  The FF_FS_TIMEOUT defines timeout period in unit of time tick.
 /  The FF_SYNC_t defines O/S dependent sync object type. e.g. HANDLE, ID, OS_EVENT*,
-/  SemaphoreHandle_t and etc. A header file for O/S definitions needs to be
-/  included somewhere in the scope of ff.h. */
+/  SemaphoreHandle_t, osMutexId_t, pthread_mutex_t* and etc. A header file for O/S
+/  definitions needs to be included somewhere in the scope of ff.h. The O/S is
+/  selected with OS_TYPE in ffsystem.c and FF_SYNC_t needs to be matched to it. */
+
+
+#define FF_SYNC_SLICE	0
+/* FF_SYNC_SLICE defines the maximum number of sectors that f_read() and f_write()
+/  transfer directly to/from the application buffer while holding the grant to
+/  the volume in re-entrant configuration. When it is not 0, a long read/write is
+/  divided into slices of this size and the grant is released between slices, so
+/  that other tasks accessing the volume are not kept waiting until the long
+/  transfer completes. (0:Hold the grant during the function) */
 
 
 
@@ -8,6 +8,175 @@
 
 
 #if FF_USE_LFN == 3	/* Dynamic memory allocation */
+#if FF_MEMPOOL			/* Fixed-block memory pool */
+
+#define MPL_SBLK	((FF_MPL_SBLK + 7) / 8 * 8)	/* Block sizes aligned to 8 bytes */
+#define MPL_LBLK	((FF_MPL_LBLK + 7) / 8 * 8)
+
+#if FF_MPL_SNUM < 1 || FF_MPL_SNUM > 32 || FF_MPL_LNUM < 0 || FF_MPL_LNUM > 32
+#error Wrong FF_MPL_SNUM or FF_MPL_LNUM setting
+#endif
+#if FF_MPL_SBLK < (FF_MAX_LFN + 1) * 2 + (FF_FS_EXFAT ? (FF_MAX_LFN + 44) / 15 * 32 : 0)
+#error FF_MPL_SBLK is too small for the LFN working buffer
+#endif
+#if FF_MPL_LNUM && FF_MPL_LBLK < FF_MPL_SBLK
+#error FF_MPL_LBLK must not be smaller than FF_MPL_SBLK
+#endif
+
+/* Atomic compare-and-swap of a block map: returns 1 if *p was o and is updated to n */
+#if !FF_FS_REENTRANT
+#define MPL_CAS(p, o, n)	(*(p) = (n), 1)		/* No contention */
+#elif defined(__CC_ARM)		/* ARM Compiler 5 (LDREX/STREX) */
+#define MPL_CAS(p, o, n)	mpl_cas(p, o, n)
+static int mpl_cas (volatile DWORD* p, DWORD o, DWORD n)
+{
+	if (__ldrex(p) != o) {
+		__clrex(); return 0;
+	}
+	return __strex(n, p) == 0;
+}
+#elif defined(__GNUC__)		/* GCC and ARM Compiler 6 */
+#define MPL_CAS(p, o, n)	mpl_cas(p, o, n)
+static int mpl_cas (volatile DWORD* p, DWORD o, DWORD n)
+{
+	return __atomic_compare_exchange_n(p, &o, n, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+#elif defined(_WIN32)		/* Win32 */
+#include <windows.h>
+#define MPL_CAS(p, o, n)	((DWORD)InterlockedCompareExchange((volatile LONG*)(p), (LONG)(n), (LONG)(o)) == (o))
+#else
+#error No atomic operation for FF_MEMPOOL in re-entrant configuration
+#endif
+
+typedef struct {
+	BYTE* base;				/* Top of the blocks */
+	UINT bsize;				/* Block size [byte] */
+	UINT nblk;				/* Number of blocks */
+	volatile DWORD map;		/* Block usage map (bit0:first block, 1:in use) */
+	volatile DWORD peak;	/* High-water mark of blocks in use */
+	volatile DWORD fail;	/* Number of requests refused due to no free block */
+} MPLCLS;
+
+static DWORD MplSmall[FF_MPL_SNUM][MPL_SBLK / 4];	/* Small blocks */
+static DWORD MplLarge[FF_MPL_LNUM ? FF_MPL_LNUM : 1][MPL_LBLK / 4];	/* Large blocks */
+
+static MPLCLS Mpl[2] = {	/* Block classes in order of block size */
+	{ (BYTE*)MplSmall, MPL_SBLK, FF_MPL_SNUM, 0, 0, 0 },
+	{ (BYTE*)MplLarge, MPL_LBLK, FF_MPL_LNUM, 0, 0, 0 }
+};
+
+
+static UINT mpl_count (	/* Returns number of blocks in use */
+	DWORD map
+)
+{
+	UINT n;
+
+
+	for (n = 0; map; map &= map - 1) n++;
+	return n;
+}
+
+
+static void mpl_raise (	/* Raise a counter to a value (lock-free) */
+	volatile DWORD* p,
+	DWORD val			/* New value (0:increment) */
+)
+{
+	DWORD v;
+
+
+	do {
+		v = *p;
+		if (val != 0 && v >= val) return;	/* Already at or above the value */
+	} while (!MPL_CAS(p, v, val ? val : v + 1));
+}
+
+
+
+/*------------------------------------------------------------------------*/
+/* Allocate a memory block                                                */
+/*------------------------------------------------------------------------*/
+
+void* ff_memalloc (	/* Returns pointer to the allocated memory block (null if not enough core) */
+	UINT msize		/* Number of bytes to allocate */
+)
+{
+	MPLCLS *mc;
+	DWORD map, full, bit;
+	UINT i, n, fit = 0;
+
+
+	for (i = 0; i < 2; i++) {	/* Try block classes in order of block size */
+		mc = &Mpl[i];
+		if (mc->nblk == 0 || msize > mc->bsize) continue;	/* Does not fit in the block? */
+		if (!fit) fit = i + 1;	/* Remember the smallest class it fits in */
+		full = (mc->nblk < 32) ? (1UL << mc->nblk) - 1 : 0xFFFFFFFF;
+		do {						/* Claim the lowest free block */
+			map = mc->map;
+			if (map == full) break;
+			bit = ~map & (map + 1);
+		} while (!MPL_CAS(&mc->map, map, map | bit));
+		if (map == full) continue;	/* All blocks in use? */
+		mpl_raise(&mc->peak, mpl_count(map | bit));	/* Update high-water mark */
+		for (n = 0; bit > 1; bit >>= 1, n++) ;	/* Block number */
+		return mc->base + n * mc->bsize;
+	}
+	if (fit) mpl_raise(&Mpl[fit - 1].fail, 0);	/* Count the refusal on the class it fits best */
+	return 0;	/* No free block (or too large request) */
+}
+
+
+/*------------------------------------------------------------------------*/
+/* Free a memory block                                                    */
+/*------------------------------------------------------------------------*/
+
+void ff_memfree (
+	void* mblock	/* Pointer to the memory block to free (nothing to do if null) */
+)
+{
+	MPLCLS *mc;
+	DWORD map, bit;
+	UINT i;
+
+
+	for (i = 0; i < 2; i++) {
+		mc = &Mpl[i];
+		if ((BYTE*)mblock >= mc->base && (BYTE*)mblock < mc->base + mc->nblk * mc->bsize) {	/* In the class? */
+			bit = 1UL << (((BYTE*)mblock - mc->base) / mc->bsize);
+			do {					/* Release the block */
+				map = mc->map;
+			} while (!MPL_CAS(&mc->map, map, map & ~bit));
+			return;
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------*/
+/* Get memory pool statistics                                             */
+/*------------------------------------------------------------------------*/
+
+int ff_memstat (	/* 1:Succeeded, 0:No such block class */
+	UINT cls,		/* Block class (0:small, 1:large) */
+	FFMEMSTAT* st	/* Pointer to return the statistics */
+)
+{
+	MPLCLS *mc;
+
+
+	if (cls >= 2) return 0;
+	mc = &Mpl[cls];
+	st->bsize = mc->bsize;
+	st->nblk = mc->nblk;
+	st->used = mpl_count(mc->map);
+	st->peak = (UINT)mc->peak;
+	st->fail = (UINT)mc->fail;
+	return 1;
+}
+
+#else					/* Heap of the C library */
+#include <stdlib.h>
 
 /*------------------------------------------------------------------------*/
 /* Allocate a memory block                                                */
@@ -32,12 +201,46 @@ void ff_memfree (
 	free(mblock);	/* Free the memory block with POSIX API */
 }
 
+#endif	/* FF_MEMPOOL */
 #endif
 
 
 
 #if FF_FS_REENTRANT	/* Mutal exclusion */
 
+#define OS_TYPE	0	/* 0:Win32, 1:uITRON4.0, 2:uC/OS-II, 3:FreeRTOS, 4:CMSIS-RTOS, 5:CMSIS-RTOS2, 6:POSIX threads */
+
+#if   OS_TYPE == 0
+#include <windows.h>
+#elif OS_TYPE == 1
+#include "itron.h"
+#include "kernel.h"
+#elif OS_TYPE == 2
+#include "includes.h"
+#elif OS_TYPE == 3
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+#elif OS_TYPE == 4
+#include "cmsis_os.h"
+#elif OS_TYPE == 5
+#include "cmsis_os2.h"
+#elif OS_TYPE == 6
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#else
+#error Wrong OS_TYPE setting
+#endif
+
+#if OS_TYPE == 4
+static const osMutexDef_t Mutex[FF_VOLUMES];	/* Table of CMSIS-RTOS mutex */
+#elif OS_TYPE == 6
+static pthread_mutex_t Mutex[FF_VOLUMES];	/* Table of POSIX mutex (FF_SYNC_t is pthread_mutex_t*) */
+#endif
+
+
+
 /*------------------------------------------------------------------------*/
 /* Create a Synchronization Object                                        */
 /*------------------------------------------------------------------------*/
@@ -46,35 +249,43 @@ void ff_memfree (
 /  When a 0 is returned, the f_mount() function fails with FR_INT_ERR.
 */
 
-//const osMutexDef_t Mutex[FF_VOLUMES];	/* Table of CMSIS-RTOS mutex */
-
-
 int ff_cre_syncobj (	/* 1:Function succeeded, 0:Could not create the sync object */
 	BYTE vol,			/* Corresponding volume (logical drive number) */
 	FF_SYNC_t* sobj		/* Pointer to return the created sync object */
 )
 {
-	/* Win32 */
+#if OS_TYPE == 0	/* Win32 */
 	*sobj = CreateMutex(NULL, FALSE, NULL);
 	return (int)(*sobj != INVALID_HANDLE_VALUE);
 
-	/* uITRON */
-//	T_CSEM csem = {TA_TPRI,1,1};
-//	*sobj = acre_sem(&csem);
-//	return (int)(*sobj > 0);
+#elif OS_TYPE == 1	/* uITRON */
+	T_CSEM csem = {TA_TPRI,1,1};
+	*sobj = acre_sem(&csem);
+	return (int)(*sobj > 0);
+
+#elif OS_TYPE == 2	/* uC/OS-II */
+	OS_ERR err;
+	*sobj = OSMutexCreate(0, &err);
+	return (int)(err == OS_NO_ERR);
+
+#elif OS_TYPE == 3	/* FreeRTOS */
+	*sobj = xSemaphoreCreateMutex();
+	return (int)(*sobj != NULL);
 
-	/* uC/OS-II */
-//	OS_ERR err;
-//	*sobj = OSMutexCreate(0, &err);
-//	return (int)(err == OS_NO_ERR);
+#elif OS_TYPE == 4	/* CMSIS-RTOS */
+	*sobj = osMutexCreate(&Mutex[vol]);
+	return (int)(*sobj != NULL);
 
-	/* FreeRTOS */
-//	*sobj = xSemaphoreCreateMutex();
-//	return (int)(*sobj != NULL);
+#elif OS_TYPE == 5	/* CMSIS-RTOS2 */
+	*sobj = osMutexNew(NULL);
+	return (int)(*sobj != NULL);
 
-	/* CMSIS-RTOS */
-//	*sobj = osMutexCreate(&Mutex[vol]);
-//	return (int)(*sobj != NULL);
+#elif OS_TYPE == 6	/* POSIX threads */
+	if (pthread_mutex_init(&Mutex[vol], NULL) != 0) return 0;
+	*sobj = &Mutex[vol];
+	return 1;
+
+#endif
 }
 
 
@@ -90,23 +301,31 @@ int ff_del_syncobj (	/* 1:Function succeeded, 0:Could not delete due to an error
 	FF_SYNC_t sobj		/* Sync object tied to the logical drive to be deleted */
 )
 {
-	/* Win32 */
+#if OS_TYPE == 0	/* Win32 */
 	return (int)CloseHandle(sobj);
 
-	/* uITRON */
-//	return (int)(del_sem(sobj) == E_OK);
+#elif OS_TYPE == 1	/* uITRON */
+	return (int)(del_sem(sobj) == E_OK);
+
+#elif OS_TYPE == 2	/* uC/OS-II */
+	OS_ERR err;
+	OSMutexDel(sobj, OS_DEL_ALWAYS, &err);
+	return (int)(err == OS_NO_ERR);
 
-	/* uC/OS-II */
-//	OS_ERR err;
-//	OSMutexDel(sobj, OS_DEL_ALWAYS, &err);
-//	return (int)(err == OS_NO_ERR);
+#elif OS_TYPE == 3	/* FreeRTOS */
+	vSemaphoreDelete(sobj);
+	return 1;
 
-	/* FreeRTOS */
-//  vSemaphoreDelete(sobj);
-//	return 1;
+#elif OS_TYPE == 4	/* CMSIS-RTOS */
+	return (int)(osMutexDelete(sobj) == osOK);
 
-	/* CMSIS-RTOS */
-//	return (int)(osMutexDelete(sobj) == osOK);
+#elif OS_TYPE == 5	/* CMSIS-RTOS2 */
+	return (int)(osMutexDelete(sobj) == osOK);
+
+#elif OS_TYPE == 6	/* POSIX threads */
+	return (int)(pthread_mutex_destroy(sobj) == 0);
+
+#endif
 }
 
 
@@ -121,22 +340,38 @@ int ff_req_grant (	/* 1:Got a grant to access the volume, 0:Could not get a gran
 	FF_SYNC_t sobj	/* Sync object to wait */
 )
 {
-	/* Win32 */
+#if OS_TYPE == 0	/* Win32 */
 	return (int)(WaitForSingleObject(sobj, FF_FS_TIMEOUT) == WAIT_OBJECT_0);
 
-	/* uITRON */
-//	return (int)(wai_sem(sobj) == E_OK);
+#elif OS_TYPE == 1	/* uITRON */
+	return (int)(wai_sem(sobj) == E_OK);
+
+#elif OS_TYPE == 2	/* uC/OS-II */
+	OS_ERR err;
+	OSMutexPend(sobj, FF_FS_TIMEOUT, &err);
+	return (int)(err == OS_NO_ERR);
+
+#elif OS_TYPE == 3	/* FreeRTOS */
+	return (int)(xSemaphoreTake(sobj, FF_FS_TIMEOUT) == pdTRUE);
+
+#elif OS_TYPE == 4	/* CMSIS-RTOS */
+	return (int)(osMutexWait(sobj, FF_FS_TIMEOUT) == osOK);
 
-	/* uC/OS-II */
-//	OS_ERR err;
-//	OSMutexPend(sobj, FF_FS_TIMEOUT, &err));
-//	return (int)(err == OS_NO_ERR);
+#elif OS_TYPE == 5	/* CMSIS-RTOS2 */
+	return (int)(osMutexAcquire(sobj, FF_FS_TIMEOUT) == osOK);
 
-	/* FreeRTOS */
-//	return (int)(xSemaphoreTake(sobj, FF_FS_TIMEOUT) == pdTRUE);
+#elif OS_TYPE == 6	/* POSIX threads (FF_FS_TIMEOUT is in unit of ms) */
+	struct timespec ts;
 
-	/* CMSIS-RTOS */
-//	return (int)(osMutexWait(sobj, FF_FS_TIMEOUT) == osOK);
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += FF_FS_TIMEOUT / 1000;
+	ts.tv_nsec += (long)(FF_FS_TIMEOUT % 1000) * 1000000;
+	if (ts.tv_nsec >= 1000000000) {
+		ts.tv_sec++; ts.tv_nsec -= 1000000000;
+	}
+	return (int)(pthread_mutex_timedlock(sobj, &ts) == 0);
+
+#endif
 }
 
 
@@ -150,21 +385,71 @@ void ff_rel_grant (
 	FF_SYNC_t sobj	/* Sync object to be signaled */
 )
 {
-	/* Win32 */
+#if OS_TYPE == 0	/* Win32 */
 	ReleaseMutex(sobj);
 
-	/* uITRON */
-//	sig_sem(sobj);
+#elif OS_TYPE == 1	/* uITRON */
+	sig_sem(sobj);
+
+#elif OS_TYPE == 2	/* uC/OS-II */
+	OSMutexPost(sobj);
+
+#elif OS_TYPE == 3	/* FreeRTOS */
+	xSemaphoreGive(sobj);
 
-	/* uC/OS-II */
-//	OSMutexPost(sobj);
+#elif OS_TYPE == 4	/* CMSIS-RTOS */
+	osMutexRelease(sobj);
 
-	/* FreeRTOS */
-//	xSemaphoreGive(sobj);
+#elif OS_TYPE == 5	/* CMSIS-RTOS2 */
+	osMutexRelease(sobj);
 
-	/* CMSIS-RTOS */
-//	osMutexRelease(sobj);
+#elif OS_TYPE == 6	/* POSIX threads */
+	pthread_mutex_unlock(sobj);
+
+#endif
 }
 
+
+
+#if FF_SYNC_SLICE != 0
+/*------------------------------------------------------------------------*/
+/* Pass Grant to the Waiting Tasks                                        */
+/*------------------------------------------------------------------------*/
+/* This function is called between slices of a long f_read()/f_write() to
+/  unlock the volume and give other tasks waiting for it a chance to run.
+/  Without the yield, a task of the same priority is not switched in and
+/  the caller takes the grant again right away.
+*/
+
+void ff_pass_grant (
+	FF_SYNC_t sobj	/* Sync object to be signaled */
+)
+{
+	ff_rel_grant(sobj);
+
+#if OS_TYPE == 0	/* Win32 */
+	SwitchToThread();
+
+#elif OS_TYPE == 1	/* uITRON */
+	rot_rdq(TPRI_SELF);
+
+#elif OS_TYPE == 2	/* uC/OS-II */
+	OSTimeDly(1);
+
+#elif OS_TYPE == 3	/* FreeRTOS */
+	taskYIELD();
+
+#elif OS_TYPE == 4	/* CMSIS-RTOS */
+	osThreadYield();
+
+#elif OS_TYPE == 5	/* CMSIS-RTOS2 */
+	osThreadYield();
+
+#elif OS_TYPE == 6	/* POSIX threads */
+	sched_yield();
+
+#endif
+}
 #endif
 
+#endif
@@ -35,7 +35,125 @@
 /* Code Conversion Tables                                                 */
 /*------------------------------------------------------------------------*/
 
+#if FF_USE_CPTBL	/* Tables generated by mkcptbl.py */
+
+typedef struct {
+	WORD kmin, kmax;	/* Range of the code to be mapped */
+	BYTE shift;			/* Size of the code block (2^shift codes) */
+	const WORD* idx;	/* Block index (0:empty, 1..:full block + 1, 0x8000|n:delta block + 1) */
+	const WCHAR* blk;	/* Full blocks (2^shift codes each, 0:no char) */
+	const BYTE* dlt;	/* Delta blocks (base code (LE) and 2^shift offsets each, 0xFF:no char) */
+} CPMAP;
+
+typedef struct {
+	WORD cp;			/* Code page */
+	const WCHAR* sbc;	/* OEM code \x80-\xFF to Unicode table (SBCS), null (DBCS) */
+	CPMAP u2o;			/* Unicode to OEM code map */
+	CPMAP o2u;			/* OEM code to Unicode map (DBCS) */
+} CPTBL;
+
+#include "ffcptbl.h"
+
+#if FF_CODE_PAGE != 0 && CVTBL(FF_CPTBL_, FF_CODE_PAGE) != 1
+#error FF_CODE_PAGE is not in ffcptbl.h. Run mkcptbl.py with the code page.
+#endif
+
+
+static const CPTBL* get_cptbl (	/* Returns the tables of the code page, null if not available */
+	WORD cp		/* Code page */
+)
+{
+	const CPTBL* t;
+
+
+	for (t = CpTbl; t->cp != 0 && t->cp != cp; t++) ;
+	return t->cp != 0 ? t : 0;
+}
+
+
+static WCHAR get_cpmap (	/* Returns the mapped code, zero if not mapped */
+	const CPMAP* map,	/* Code map */
+	WCHAR code			/* Code to be mapped */
+)
+{
+	const BYTE* d;
+	UINT i, n = map->shift;
+	WCHAR c = 0;
+
+
+	if (code >= map->kmin && code <= map->kmax) {
+		code -= map->kmin;
+		i = map->idx[code >> n];		/* Get the block */
+		code &= (1 << n) - 1;
+		if (i & 0x8000) {				/* Delta block */
+			d = map->dlt + ((i & 0x7FFF) - 1) * ((1 << n) + 2);
+			if (d[2 + code] != 0xFF) c = (WCHAR)(d[0] + d[1] * 256 + d[2 + code]);
+		} else {
+			if (i != 0) c = map->blk[((i - 1) << n) + code];	/* Full block */
+		}
+	}
+	return c;
+}
+
+
+
+/*------------------------------------------------------------------------*/
+/* OEM <==> Unicode conversions with generated tables                     */
+/*------------------------------------------------------------------------*/
+
+WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
+	DWORD	uni,	/* UTF-16 encoded character to be converted */
+	WORD	cp		/* Code page for the conversion */
+)
+{
+	const CPTBL* t;
+	WCHAR c = 0;
+
+
+	if (uni < 0x80) {	/* ASCII? */
+		c = (WCHAR)uni;
+
+	} else {			/* Non-ASCII */
+		t = get_cptbl(cp);
+		if (uni < 0x10000 && t) {	/* Is it in BMP and valid code page? */
+			c = get_cpmap(&t->u2o, (WCHAR)uni);
+		}
+	}
+
+	return c;
+}
+
+
+WCHAR ff_oem2uni (	/* Returns Unicode character in UTF-16, zero on error */
+	WCHAR	oem,	/* OEM code to be converted (DBC if >=0x100) */
+	WORD	cp		/* Code page for the conversion */
+)
+{
+	const CPTBL* t;
+	WCHAR c = 0;
+
+
+	if (oem < 0x80) {	/* ASCII? */
+		c = oem;
+
+	} else {			/* Extended char */
+		t = get_cptbl(cp);
+		if (t) {	/* Is it a valid code page? */
+			if (t->sbc) {	/* SBCS */
+				if (oem < 0x100) c = t->sbc[oem - 0x80];
+			} else {		/* DBCS */
+				c = get_cpmap(&t->o2u, oem);
+			}
+		}
+	}
+
+	return c;
+}
+
+#else	/* Built-in tables */
+
 #if FF_CODE_PAGE == 932 || FF_CODE_PAGE == 0	/* Japanese */
+#if FF_UNI2OEM_MAP < 2
 static const WCHAR uni2oem932[] = {	/* Unicode --> Shift_JIS pairs */
 	0x00A7, 0x8198, 0x00A8, 0x814E, 0x00B0, 0x818B, 0x00B1, 0x817D,	0x00B4, 0x814C, 0x00B6, 0x81F7, 0x00D7, 0x817E, 0x00F7, 0x8180,
 	0x0391, 0x839F, 0x0392, 0x83A0, 0x0393, 0x83A1, 0x0394, 0x83A2,	0x0395, 0x83A3, 0x0396, 0x83A4, 0x0397, 0x83A5, 0x0398, 0x83A6,
@@ -962,6 +1080,1520 @@ static const WCHAR uni2oem932[] = {	/* Unicode --> Shift_JIS pairs */
 	0xFF99, 0x00D9, 0xFF9A, 0x00DA, 0xFF9B, 0x00DB, 0xFF9C, 0x00DC,	0xFF9D, 0x00DD, 0xFF9E, 0x00DE, 0xFF9F, 0x00DF, 0xFFE0, 0x8191,
 	0xFFE1, 0x8192, 0xFFE2, 0x81CA, 0xFFE3, 0x8150, 0xFFE4, 0xFA55,	0xFFE5, 0x818F, 0, 0
 };
+#else
+static const WORD u2oidx932[] = {	/* Unicode to OEM code map index (block number + 1 of each 64 code points, 0:no char) */
+	0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4,
+	5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7, 0, 0, 0, 8, 9, 10, 11, 12, 13, 14, 0, 15, 0, 0, 0,
+	0, 16, 0, 0, 17, 18, 19, 20, 21, 22, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	23, 24, 25, 26, 0, 0, 0, 0, 27, 0, 28, 0, 29, 30, 31, 32,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+	137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+	185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200,
+	201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216,
+	217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 0, 228, 229, 230, 231,
+	232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+	248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+	264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 0,
+	279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294,
+	295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310,
+	311, 312, 313, 0, 0, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+	325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+	341, 342, 0, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 355, 0, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 358, 359, 360, 361
+};
+static const WCHAR u2oblk932[] = {	/* Unicode to OEM code map blocks (64 code points each, 0:no char) */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8198, 0x814E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x818B, 0x817D, 0x0000, 0x0000, 0x814C, 0x0000, 0x81F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x817E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x839F, 0x83A0, 0x83A1, 0x83A2, 0x83A3, 0x83A4, 0x83A5, 0x83A6, 0x83A7, 0x83A8, 0x83A9, 0x83AA, 0x83AB, 0x83AC, 0x83AD,
+	0x83AE, 0x83AF, 0x0000, 0x83B0, 0x83B1, 0x83B2, 0x83B3, 0x83B4, 0x83B5, 0x83B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x83BF, 0x83C0, 0x83C1, 0x83C2, 0x83C3, 0x83C4, 0x83C5, 0x83C6, 0x83C7, 0x83C8, 0x83C9, 0x83CA, 0x83CB, 0x83CC, 0x83CD,
+	0x83CE, 0x83CF, 0x0000, 0x83D0, 0x83D1, 0x83D2, 0x83D3, 0x83D4, 0x83D5, 0x83D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8440, 0x8441, 0x8442, 0x8443, 0x8444, 0x8445, 0x8447, 0x8448, 0x8449, 0x844A, 0x844B, 0x844C, 0x844D, 0x844E, 0x844F, 0x8450,
+	0x8451, 0x8452, 0x8453, 0x8454, 0x8455, 0x8456, 0x8457, 0x8458, 0x8459, 0x845A, 0x845B, 0x845C, 0x845D, 0x845E, 0x845F, 0x8460,
+	0x8470, 0x8471, 0x8472, 0x8473, 0x8474, 0x8475, 0x8477, 0x8478, 0x8479, 0x847A, 0x847B, 0x847C, 0x847D, 0x847E, 0x8480, 0x8481,
+	0x8482, 0x8483, 0x8484, 0x8485, 0x8486, 0x8487, 0x8488, 0x8489, 0x848A, 0x848B, 0x848C, 0x848D, 0x848E, 0x848F, 0x8490, 0x8491,
+	0x0000, 0x8476, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x815D, 0x0000, 0x0000, 0x0000, 0x0000, 0x815C, 0x0000, 0x0000, 0x8165, 0x8166, 0x0000, 0x0000, 0x8167, 0x8168, 0x0000, 0x0000,
+	0x81F5, 0x81F6, 0x0000, 0x0000, 0x0000, 0x8164, 0x8163, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x81F1, 0x0000, 0x818C, 0x818D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81A6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x818E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8782, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8784, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81F0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8754, 0x8755, 0x8756, 0x8757, 0x8758, 0x8759, 0x875A, 0x875B, 0x875C, 0x875D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFA40, 0xFA41, 0xFA42, 0xFA43, 0xFA44, 0xFA45, 0xFA46, 0xFA47, 0xFA48, 0xFA49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x81A9, 0x81AA, 0x81A8, 0x81AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x81CB, 0x0000, 0x81CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x81CD, 0x0000, 0x81DD, 0x81CE, 0x0000, 0x0000, 0x0000, 0x81DE, 0x81B8, 0x0000, 0x0000, 0x81B9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8794, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81E3, 0x0000, 0x0000, 0x81E5, 0x8187, 0x8798,
+	0x81DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x8161, 0x0000, 0x81C8, 0x81C9, 0x81BF, 0x81BE, 0x81E7, 0x81E8, 0x0000, 0x8793, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8188, 0x81E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81E4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x81E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8182, 0x81DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x8185, 0x8186, 0x0000, 0x0000, 0x81E1, 0x81E2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x81BC, 0x81BD, 0x0000, 0x0000, 0x81BA, 0x81BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8799,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x81DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8740, 0x8741, 0x8742, 0x8743, 0x8744, 0x8745, 0x8746, 0x8747, 0x8748, 0x8749, 0x874A, 0x874B, 0x874C, 0x874D, 0x874E, 0x874F,
+	0x8750, 0x8751, 0x8752, 0x8753, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x849F, 0x84AA, 0x84A0, 0x84AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x84A1, 0x0000, 0x0000, 0x84AC,
+	0x84A2, 0x0000, 0x0000, 0x84AD, 0x84A4, 0x0000, 0x0000, 0x84AF, 0x84A3, 0x0000, 0x0000, 0x84AE, 0x84A5, 0x84BA, 0x0000, 0x0000,
+	0x84B5, 0x0000, 0x0000, 0x84B0, 0x84A7, 0x84BC, 0x0000, 0x0000, 0x84B7, 0x0000, 0x0000, 0x84B2, 0x84A6, 0x0000, 0x0000, 0x84B6,
+	0x84BB, 0x0000, 0x0000, 0x84B1, 0x84A8, 0x0000, 0x0000, 0x84B8, 0x84BD, 0x0000, 0x0000, 0x84B3, 0x84A9, 0x0000, 0x0000, 0x84B9,
+	0x0000, 0x0000, 0x84BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x84B4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x81A1, 0x81A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x81A3, 0x81A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81A5, 0x81A4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x819F, 0x819E, 0x0000, 0x0000, 0x0000, 0x819B, 0x0000, 0x0000, 0x819D, 0x819C,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81FC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x819A, 0x8199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x818A, 0x0000, 0x8189, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x81F4, 0x0000, 0x0000, 0x81F3, 0x0000, 0x81F2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8140, 0x8141, 0x8142, 0x8156, 0x0000, 0x8158, 0x8159, 0x815A, 0x8171, 0x8172, 0x8173, 0x8174, 0x8175, 0x8176, 0x8177, 0x8178,
+	0x8179, 0x817A, 0x81A7, 0x81AC, 0x816B, 0x816C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8780, 0x0000, 0x8781,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x829F, 0x82A0, 0x82A1, 0x82A2, 0x82A3, 0x82A4, 0x82A5, 0x82A6, 0x82A7, 0x82A8, 0x82A9, 0x82AA, 0x82AB, 0x82AC, 0x82AD,
+	0x82AE, 0x82AF, 0x82B0, 0x82B1, 0x82B2, 0x82B3, 0x82B4, 0x82B5, 0x82B6, 0x82B7, 0x82B8, 0x82B9, 0x82BA, 0x82BB, 0x82BC, 0x82BD,
+	0x82BE, 0x82BF, 0x82C0, 0x82C1, 0x82C2, 0x82C3, 0x82C4, 0x82C5, 0x82C6, 0x82C7, 0x82C8, 0x82C9, 0x82CA, 0x82CB, 0x82CC, 0x82CD,
+	0x82CE, 0x82CF, 0x82D0, 0x82D1, 0x82D2, 0x82D3, 0x82D4, 0x82D5, 0x82D6, 0x82D7, 0x82D8, 0x82D9, 0x82DA, 0x82DB, 0x82DC, 0x82DD,
+	0x82DE, 0x82DF, 0x82E0, 0x82E1, 0x82E2, 0x82E3, 0x82E4, 0x82E5, 0x82E6, 0x82E7, 0x82E8, 0x82E9, 0x82EA, 0x82EB, 0x82EC, 0x82ED,
+	0x82EE, 0x82EF, 0x82F0, 0x82F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x814A, 0x814B, 0x8154, 0x8155, 0x0000,
+	0x0000, 0x8340, 0x8341, 0x8342, 0x8343, 0x8344, 0x8345, 0x8346, 0x8347, 0x8348, 0x8349, 0x834A, 0x834B, 0x834C, 0x834D, 0x834E,
+	0x834F, 0x8350, 0x8351, 0x8352, 0x8353, 0x8354, 0x8355, 0x8356, 0x8357, 0x8358, 0x8359, 0x835A, 0x835B, 0x835C, 0x835D, 0x835E,
+	0x835F, 0x8360, 0x8361, 0x8362, 0x8363, 0x8364, 0x8365, 0x8366, 0x8367, 0x8368, 0x8369, 0x836A, 0x836B, 0x836C, 0x836D, 0x836E,
+	0x836F, 0x8370, 0x8371, 0x8372, 0x8373, 0x8374, 0x8375, 0x8376, 0x8377, 0x8378, 0x8379, 0x837A, 0x837B, 0x837C, 0x837D, 0x837E,
+	0x8380, 0x8381, 0x8382, 0x8383, 0x8384, 0x8385, 0x8386, 0x8387, 0x8388, 0x8389, 0x838A, 0x838B, 0x838C, 0x838D, 0x838E, 0x838F,
+	0x8390, 0x8391, 0x8392, 0x8393, 0x8394, 0x8395, 0x8396, 0x0000, 0x0000, 0x0000, 0x0000, 0x8145, 0x815B, 0x8152, 0x8153, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x878A, 0x878B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x878C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8785, 0x8786, 0x8787, 0x8788, 0x8789, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8765, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8769, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8760, 0x0000, 0x0000, 0x0000, 0x8763, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8761, 0x876B, 0x0000, 0x0000, 0x876A, 0x8764, 0x0000, 0x0000, 0x0000, 0x876C, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8766, 0x0000, 0x0000, 0x0000, 0x0000, 0x876E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x875F, 0x876D, 0x0000, 0x0000, 0x8762, 0x0000, 0x0000,
+	0x0000, 0x8767, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8768, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x877E, 0x878F, 0x878E, 0x878D, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8772, 0x8773,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x876F, 0x8770, 0x8771, 0x0000,
+	0x0000, 0x8775, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8774, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8783, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x88EA, 0x929A, 0x0000, 0x8EB5, 0x0000, 0x0000, 0x0000, 0x969C, 0x8FE4, 0x8E4F, 0x8FE3, 0x89BA, 0x0000, 0x9573, 0x975E, 0x0000,
+	0x98A0, 0x894E, 0x0000, 0x0000, 0x8A8E, 0x98A1, 0x90A2, 0x99C0, 0x8B75, 0x95B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FE5, 0x0000,
+	0x0000, 0x97BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x95C0, 0x0000, 0xFA68, 0x0000, 0x98A2, 0x0000, 0x0000, 0x9286, 0x0000, 0x0000,
+	0x0000, 0x98A3, 0x8BF8, 0x0000, 0x0000, 0x0000, 0x98A4, 0x0000, 0x8ADB, 0x924F, 0x0000, 0x8EE5, 0x98A5, 0x0000, 0x0000, 0x98A6,
+	0x0000, 0x0000, 0x98A7, 0x9454, 0x0000, 0x8B76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9456, 0x0000, 0x93E1, 0x8CC1, 0x9652,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE568, 0x98A8, 0x8FE6, 0x98A9, 0x89B3, 0x0000, 0x0000, 0x0000, 0x8BE3, 0x8CEE, 0x96E7,
+	0x0000, 0x0000, 0x9BA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9790, 0x0000, 0x93FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AA3, 0x0000,
+	0x8B54, 0x0000, 0x98AA, 0x0000, 0x0000, 0x98AB, 0x97B9, 0x0000, 0x975C, 0x9188, 0x98AD, 0x8E96, 0x93F1, 0x0000, 0x98B0, 0x0000,
+	0x0000, 0x895D, 0x8CDD, 0x0000, 0x8CDC, 0x88E4, 0x0000, 0x0000, 0x986A, 0x9869, 0x0000, 0x8DB1, 0x889F, 0x0000, 0x98B1, 0x98B2,
+	0x98B3, 0x9653, 0x98B4, 0x0000, 0x8CF0, 0x88E5, 0x9692, 0x0000, 0x8B9C, 0x0000, 0x0000, 0x8B9D, 0x8B9E, 0x92E0, 0x97BA, 0x0000,
+	0x98B5, 0x0000, 0x0000, 0x98B6, 0x0000, 0x0000, 0x98B7, 0x0000, 0x0000, 0x0000, 0x906C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8F59, 0x906D, 0x98BC, 0x0000, 0x98BA, 0x0000, 0x98BB, 0x8B77, 0x0000, 0x0000, 0x8DA1, 0x89EE, 0x0000, 0x98B9, 0x98B8, 0x95A7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8E65, 0x8E64, 0x91BC, 0x98BD, 0x9574, 0x90E5, 0x0000, 0x0000, 0x0000, 0x8157, 0x98BE, 0x98C0,
+	0x0000, 0xFA69, 0x0000, 0x91E3, 0x97DF, 0x88C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98BF, 0x89BC, 0x0000,
+	0x8BC2, 0x0000, 0x9287, 0x0000, 0x0000, 0x0000, 0x8C8F, 0x98C1, 0x0000, 0x0000, 0x0000, 0x9443, 0xFA6A, 0x0000, 0x0000, 0x0000,
+	0xFA6B, 0x8AE9, 0x0000, 0xFA6C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98C2, 0x88C9, 0x0000, 0x0000, 0x8CDE, 0x8AEA, 0x959A,
+	0x94B0, 0x8B78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89EF, 0x0000, 0x98E5, 0x9360, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x948C,
+	0x98C4, 0x0000, 0x0000, 0x0000, 0x94BA, 0x0000, 0x97E0, 0x0000, 0x904C, 0xFA6D, 0x8E66, 0x0000, 0x8E97, 0x89BE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x92CF, 0x0000, 0x0000, 0x9241, 0x98C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x88CA, 0x92E1, 0x8F5A,
+	0x8DB2, 0x9743, 0x0000, 0x91CC, 0x0000, 0x89BD, 0xFA6E, 0x98C7, 0x0000, 0x975D, 0x98C3, 0x98C5, 0x8DEC, 0x98C6, 0x9B43, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98D1,
+	0x98CF, 0x0000, 0x0000, 0x89C0, 0x0000, 0x95B9, 0x98C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x98CD, 0x8CF1, 0x0000, 0x0000, 0x8E67,
+	0x0000, 0x0000, 0x0000, 0x8AA4, 0x0000, 0x0000, 0x98D2, 0x0000, 0x98CA, 0x0000, 0xFA70, 0x97E1, 0x0000, 0x8E98, 0x0000, 0x98CB,
+	0x0000, 0x98D0, 0xFA6F, 0x0000, 0xFA72, 0x0000, 0x98D3, 0x0000, 0x98CC, 0x0000, 0xFA71, 0x8B9F, 0x0000, 0x88CB, 0x0000, 0x0000,
+	0x8BA0, 0x89BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B44, 0x0000, 0x9699, 0x958E, 0x8CF2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x904E, 0x97B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95D6,
+	0x0000, 0x0000, 0x8C57, 0x91A3, 0x89E2, 0x0000, 0x0000, 0x0000, 0x0000, 0xFA61, 0x8F72, 0x0000, 0x0000, 0xFA73, 0x98D7, 0x0000,
+	0x98DC, 0x98DA, 0x0000, 0x0000, 0x98D5, 0x0000, 0x0000, 0x91AD, 0x98D8, 0x0000, 0x98DB, 0x98D9, 0x0000, 0x95DB, 0x0000, 0x98D6,
+	0x0000, 0x904D, 0x0000, 0x9693, 0x98DD, 0x98DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F43, 0x98EB,
+	0x0000, 0x0000, 0x0000, 0x946F, 0x0000, 0x9555, 0x98E6, 0x0000, 0x95EE, 0x0000, 0x89B4, 0x0000, 0x0000, 0x0000, 0x98EA, 0xFA76,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98E4, 0x98ED, 0x0000, 0x0000, 0x9171, 0x0000, 0x8CC2, 0x0000, 0x947B, 0x0000, 0xE0C5,
+	0x0000, 0x98EC, 0x937C, 0x0000, 0x98E1, 0x0000, 0x8CF4, 0x0000, 0x0000, 0x8CF3, 0x98DF, 0x0000, 0x0000, 0x0000, 0xFA77, 0x8ED8,
+	0x0000, 0x98E7, 0xFA75, 0x95ED, 0x926C, 0x98E3, 0x8C91, 0x0000, 0x98E0, 0x98E8, 0x98E2, 0x97CF, 0x98E9, 0x9860, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BE4, 0x0000, 0x0000, 0x8C90, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFA74, 0x0000, 0xFA7A, 0x98EE, 0x0000, 0x0000, 0xFA78, 0x98EF, 0x98F3, 0x88CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95CE,
+	0x98F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x98F1, 0x98F5, 0x0000, 0x0000, 0x0000, 0x98F4, 0x0000, 0x92E2, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98F6, 0x0000, 0x0000, 0x0000,
+	0xFA79, 0x0000, 0x8EC3, 0x0000, 0x91A4, 0x92E3, 0x8BF4, 0x0000, 0x98F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B55, 0x0000, 0x0000,
+	0x98F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x98FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9654, 0x0000, 0x0000,
+	0x0000, 0x8C86, 0x0000, 0x0000, 0xFA7B, 0x0000, 0x0000, 0x0000, 0x8E50, 0x94F5, 0x98F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8DC3, 0x9762, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x98FC, 0x9942, 0x98FB, 0x8DC2, 0x0000, 0x8F9D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C58, 0x0000,
+	0x0000, 0x0000, 0x9943, 0x0000, 0x0000, 0x8BCD, 0x0000, 0x0000, 0x0000, 0x9940, 0x9941, 0x0000, 0x0000, 0x93AD, 0x0000, 0x919C,
+	0x0000, 0x8BA1, 0x0000, 0x0000, 0x0000, 0x966C, 0x9944, 0x0000, 0xFA7D, 0x0000, 0x97BB, 0x0000, 0x0000, 0x0000, 0x9945, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9948, 0x0000, 0x9946, 0x0000, 0x916D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9947, 0x9949, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFA7C, 0x994B, 0x0000, 0x0000, 0x0000, 0x994A, 0x0000, 0x95C6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8B56, 0x994D, 0x994E, 0x0000, 0x89AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x994C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8EF2, 0x0000, 0x9951, 0x9950, 0x994F, 0x0000, 0x98D4, 0x0000, 0x9952, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F9E,
+	0x0000, 0x9953, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9744, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x96D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x9955, 0x0000, 0x0000, 0x9954, 0x9957, 0x9956, 0x0000, 0x0000, 0x9958,
+	0x9959, 0x88F2, 0x0000, 0x8CB3, 0x8C5A, 0x8F5B, 0x929B, 0x8BA2, 0x90E6, 0x8CF5, 0xFA7E, 0x8D8E, 0x995B, 0x96C6, 0x9365, 0x0000,
+	0x8E99, 0x0000, 0x995A, 0x0000, 0x995C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x937D, 0x0000, 0x8A95, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x995D, 0x0000, 0xFA80, 0x93FC, 0x0000, 0x0000, 0x9153, 0x995F, 0x9960, 0x94AA, 0x8CF6, 0x985A, 0x9961, 0x0000,
+	0x0000, 0x8BA4, 0x0000, 0x0000, 0x0000, 0x95BA, 0x91B4, 0x8BEF, 0x9354, 0x0000, 0x0000, 0x0000, 0x8C93, 0x0000, 0x0000, 0x0000,
+	0x9962, 0x0000, 0x9963, 0x0000, 0x0000, 0x93E0, 0x897E, 0x0000, 0x0000, 0x9966, 0x8DFB, 0x0000, 0x9965, 0x8DC4, 0x0000, 0x9967,
+	0xE3EC, 0x9968, 0x9660, 0x9969, 0x0000, 0x996A, 0x996B, 0x8FE7, 0x0000, 0x8ECA, 0x0000, 0x0000, 0x0000, 0xFA81, 0x0000, 0x0000,
+	0x8AA5, 0x0000, 0x996E, 0x0000, 0x996C, 0x96BB, 0x996D, 0x0000, 0x9579, 0x996F, 0x9970, 0x9971, 0x937E, 0x0000, 0x0000, 0x0000,
+	0x9975, 0x9973, 0x9974, 0x9972, 0x8DE1, 0x9976, 0x96E8, 0x97E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9977, 0xFA82, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x90A6, 0x9978, 0x8F79, 0x0000, 0x0000, 0x9979, 0x0000, 0x929C, 0x97BD, 0x9380, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x99C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x997A, 0xEAA3, 0x8BC3, 0x0000, 0x0000,
+	0x997B, 0x967D, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F88, 0x91FA, 0x0000, 0x997D, 0x93E2, 0x0000, 0xFA83, 0x997E, 0x0000, 0x0000,
+	0x9980, 0x8A4D, 0x0000, 0x0000, 0x0000, 0x9981, 0x8BA5, 0x0000, 0x93CA, 0x899A, 0x8F6F, 0x0000, 0x0000, 0x949F, 0x9982, 0x0000,
+	0x9381, 0x0000, 0x0000, 0x906E, 0x9983, 0x0000, 0x95AA, 0x90D8, 0x8AA0, 0x0000, 0x8AA7, 0x9984, 0x0000, 0x0000, 0x9986, 0x0000,
+	0x0000, 0x8C59, 0x0000, 0x0000, 0x9985, 0xFA84, 0x0000, 0x97F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F89, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x94BB, 0x95CA, 0x0000, 0x9987, 0x0000, 0x9798, 0x9988, 0x0000, 0x0000, 0x0000, 0x9989, 0x0000,
+	0x939E, 0x0000, 0x0000, 0x998A, 0x0000, 0x0000, 0x90A7, 0x8DFC, 0x8C94, 0x998B, 0x8E68, 0x8D8F, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x92E4, 0x998D, 0x0000, 0x0000, 0x91A5, 0x0000, 0x0000, 0x8DED, 0x998E, 0x998F, 0x914F, 0x0000, 0x998C,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9991, 0x0000, 0x9655, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D84, 0x0000, 0x0000, 0x9990, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8C95, 0x8DDC, 0x948D, 0x0000, 0x0000, 0x0000, 0x9994, 0x9992, 0x0000, 0x0000, 0x0000, 0x0000, 0x959B,
+	0x8FE8, 0x999B, 0x8A84, 0x9995, 0x9993, 0x916E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9997, 0x0000, 0x9996,
+	0x0000, 0x0000, 0x0000, 0x8A63, 0x0000, 0x0000, 0x0000, 0x8C80, 0x999C, 0x97AB, 0x0000, 0x0000, 0x0000, 0x9998, 0x0000, 0x0000,
+	0x0000, 0x999D, 0x999A, 0x0000, 0x9999, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x97CD, 0xFA85, 0x0000, 0x0000, 0x8CF7,
+	0x89C1, 0x0000, 0x0000, 0x97F2, 0x0000, 0x0000, 0xFA86, 0x0000, 0x0000, 0x8F95, 0x9377, 0x8D85, 0x99A0, 0x99A1, 0x0000, 0xFB77,
+	0x0000, 0x97E3, 0x0000, 0x0000, 0x984A, 0x99A3, 0x0000, 0x0000, 0x0000, 0x8CF8, 0x0000, 0x0000, 0x99A2, 0x0000, 0x8A4E, 0x0000,
+	0xFA87, 0x99A4, 0x0000, 0x9675, 0x0000, 0x92BA, 0x0000, 0x9745, 0x0000, 0x95D7, 0x0000, 0x0000, 0x0000, 0x99A5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE8D3, 0x0000, 0x0000, 0x93AE, 0x0000, 0x99A6, 0x8AA8, 0x96B1, 0x0000, 0xFA88, 0x0000, 0x8F9F, 0x99A7, 0x95E5,
+	0x99AB, 0x0000, 0x90A8, 0x99A8, 0x8BCE, 0x0000, 0x99A9, 0x8AA9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8C4D, 0x99AC, 0x0000, 0x99AD, 0x0000, 0x0000, 0x99AE, 0x99AF, 0x8ED9, 0x0000, 0x0000, 0x0000, 0x8CF9, 0x96DC,
+	0xFA89, 0x96E6, 0x93F5, 0x0000, 0x0000, 0x95EF, 0x99B0, 0xFA8A, 0x99B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x99B3, 0x0000, 0x99B5,
+	0x99B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x99B6, 0x89BB, 0x966B, 0x0000, 0x8DFA, 0x99B7, 0x0000, 0x0000, 0x9178, 0x0000, 0x0000,
+	0x8FA0, 0x8BA7, 0x0000, 0x99B8, 0xFA8B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x99B9,
+	0x0000, 0x99BA, 0x0000, 0x99BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x99BC, 0x9543, 0x8BE6, 0x88E3, 0x0000, 0x0000, 0x0000, 0x93BD,
+	0x99BD, 0x8F5C, 0x0000, 0x90E7, 0x0000, 0x99BF, 0x99BE, 0x8FA1, 0x8CDF, 0x99C1, 0x94BC, 0x0000, 0x0000, 0x99C2, 0x0000, 0x0000,
+	0x0000, 0x94DA, 0x91B2, 0x91EC, 0x8BA6, 0x0000, 0x0000, 0x93EC, 0x9250, 0x0000, 0x948E, 0x0000, 0x966D, 0x0000, 0x99C4, 0x0000,
+	0x90E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C54, 0x0000, 0x0000, 0x99C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x99C6, 0x894B,
+	0x88F3, 0x8AEB, 0xFA8C, 0x91A6, 0x8B70, 0x9791, 0x0000, 0x99C9, 0x89B5, 0x0000, 0x0000, 0x99C8, 0x0000, 0x0000, 0x0000, 0x8BA8,
+	0x0000, 0x0000, 0x99CA, 0x0000, 0x96EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFA8D, 0x0000, 0x0000, 0x99CB, 0x0000, 0x97D0, 0x0000, 0x8CFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CB4,
+	0x99CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x99CE, 0x99CD, 0x0000, 0x907E, 0x8958, 0x0000, 0x0000, 0x0000, 0x897D, 0x99CF, 0x0000,
+	0x99D0, 0x0000, 0xFA8E, 0x8CB5, 0x0000, 0x0000, 0x99D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B8E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8E51, 0x99D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x9694, 0x8DB3, 0x8B79, 0x9746, 0x916F, 0x94BD, 0x8EFB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8F66, 0x0000, 0x8EE6, 0x8EF3, 0x0000, 0x8F96, 0x0000, 0x94BE, 0x0000, 0xFA8F, 0x0000, 0x99D5,
+	0x0000, 0x8962, 0x9170, 0x8CFB, 0x8CC3, 0x8BE5, 0x0000, 0x0000, 0x99D9, 0x9240, 0x91FC, 0x8BA9, 0x8FA2, 0x99DA, 0x99D8, 0x89C2,
+	0x91E4, 0x8EB6, 0x8E6A, 0x8945, 0x0000, 0x0000, 0x8A90, 0x8D86, 0x8E69, 0x0000, 0x99DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x99DC, 0x0000, 0x8B68, 0x8A65, 0x0000, 0x0000, 0x0000, 0x8D87, 0x8B67, 0x92DD, 0x8944, 0x93AF, 0x96BC, 0x8D40, 0x9799,
+	0x9366, 0x8CFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C4E, 0x0000, 0x99E5, 0x0000, 0x8BE1,
+	0x9669, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94DB, 0x0000, 0x0000, 0x99E4, 0x0000, 0x8ADC, 0x99DF, 0x99E0, 0x99E2, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x99E3, 0x0000, 0x8B7A, 0x9081, 0x0000, 0x95AB, 0x99E1, 0x99DD, 0x8CE1, 0x0000,
+	0x99DE, 0x0000, 0x9843, 0x0000, 0x0000, 0x0000, 0x95F0, 0x0000, 0x92E6, 0x8CE0, 0x8D90, 0x0000, 0x0000, 0x0000, 0x99E6, 0x0000,
+	0x0000, 0x93DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x99EA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EFC, 0x0000, 0x8EF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x99ED, 0x99EB, 0x0000, 0x96A1, 0x0000, 0x99E8, 0x99F1, 0x99EC, 0x0000, 0x0000, 0x0000, 0x99EF, 0x8CC4, 0x96BD, 0x0000, 0x0000,
+	0x99F0, 0x0000, 0x0000, 0x0000, 0x99F2, 0x0000, 0x99F4, 0x0000, 0x0000, 0x0000, 0xFA92, 0x8DEE, 0x9861, 0x0000, 0x99E9, 0x99E7,
+	0x99F3, 0x0000, 0x99EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFA91, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x99F6, 0x0000, 0x9A42, 0x99F8, 0x0000, 0x0000, 0x99FC, 0xFA93, 0x0000, 0x9A40, 0x99F9, 0x0000, 0x0000, 0x9A5D,
+	0x0000, 0x0000, 0x8DE7, 0x8A50, 0x0000, 0x0000, 0x0000, 0x0000, 0x99F7, 0x0000, 0x0000, 0x0000, 0x9A44, 0x88F4, 0x9A43, 0x0000,
+	0x88A3, 0x9569, 0x9A41, 0x0000, 0x99FA, 0x0000, 0x0000, 0x99F5, 0x99FB, 0x8DC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x88F5, 0x9A4E, 0x0000, 0x0000, 0x9A46, 0x9A47, 0x0000, 0x8FA3, 0x9689, 0x0000, 0x0000, 0x0000, 0x9A4C, 0x9A4B, 0x0000,
+	0x0000, 0x0000, 0x934E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A4D, 0x0000, 0x0000, 0x9A4A, 0x0000, 0xFA94,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8953, 0x0000, 0x8DB4, 0x904F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A48,
+	0x9382, 0x0000, 0x0000, 0x0000, 0x9A49, 0x0000, 0x88A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A53, 0x9742,
+	0x0000, 0x8FA5, 0x0000, 0x9A59, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A58, 0x9A4F, 0x0000, 0x0000, 0x0000, 0x0000, 0x91C1, 0x0000,
+	0x9A50, 0x0000, 0x0000, 0x0000, 0x91ED, 0x9A55, 0x8FA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A52, 0x0000, 0x0000, 0x96E2,
+	0x0000, 0x0000, 0x0000, 0x8C5B, 0x0000, 0x0000, 0x9A56, 0x9A57, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A54, 0x9A5A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9A51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A60, 0x9A65, 0x0000, 0x9A61, 0x0000,
+	0x9A5C, 0x0000, 0x0000, 0x9A66, 0x9150, 0x0000, 0xFA95, 0x9A68, 0x0000, 0x8D41, 0x9A5E, 0x929D, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A62, 0x9A5B, 0x8AAB, 0x0000, 0x8AEC, 0x8A85, 0x9A63, 0x9A5F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C96, 0x9A69, 0x9A67, 0x9172, 0x8B69, 0x8BAA, 0x0000, 0x9A64, 0x0000,
+	0x8BF2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8963, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9A6D, 0x9A6B, 0x0000, 0x9AA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9A70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A6A, 0x0000, 0x9A6E, 0x0000, 0x0000, 0x9A6C,
+	0x0000, 0x0000, 0x0000, 0x8E6B, 0x9A6F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A72, 0x0000, 0x9A77, 0x0000, 0x0000, 0x0000, 0x9A75, 0x9A74, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9251, 0x0000, 0x0000, 0x89C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9A71, 0x0000, 0x9A73, 0x8FA6, 0x8952, 0x0000, 0x0000, 0x9A76, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A82,
+	0x0000, 0x8FFA, 0x9A7D, 0x0000, 0x9A7B, 0x0000, 0x9A7C, 0x0000, 0x9A7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x895C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9158, 0x0000, 0x9A78, 0x0000,
+	0x9A79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A9A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9A81, 0x0000, 0x0000, 0x0000, 0x8AED, 0x0000, 0x9A84, 0x9A80, 0x9A83, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x95AC, 0x0000, 0x0000, 0x0000, 0x93D3, 0x0000, 0x94B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9A86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A85, 0x8A64, 0x0000, 0x0000, 0x9A87, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A8A,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9A89, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9A88, 0x0000, 0x9458, 0x0000, 0x0000, 0x9A8B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A8C, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9A8E, 0x0000, 0x9A8D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A90, 0x0000, 0x0000, 0x0000,
+	0x9A93, 0x9A91, 0x9A8F, 0x9A92, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A95, 0x0000,
+	0x0000, 0x9A96, 0x0000, 0x9A97, 0x0000, 0x0000, 0x0000, 0x9A98, 0x9964, 0x0000, 0x8EFA, 0x8E6C, 0x0000, 0x0000, 0x89F1, 0x0000,
+	0x88F6, 0x0000, 0x0000, 0x9263, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A99, 0x0000,
+	0x8DA2, 0x0000, 0x88CD, 0x907D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A9A, 0x8CC5, 0x0000, 0x0000, 0x8D91, 0x0000, 0x9A9C,
+	0x9A9B, 0x0000, 0x0000, 0x95DE, 0x9A9D, 0x0000, 0x0000, 0x0000, 0x9A9F, 0x9A9E, 0x0000, 0x9AA0, 0x0000, 0x9AA1, 0x0000, 0x8C97,
+	0x0000, 0x0000, 0x8980, 0x9AA2, 0x0000, 0x0000, 0x9AA4, 0x0000, 0x9AA3, 0x0000, 0x0000, 0x0000, 0x9AA6, 0x0000, 0x0000, 0x9379,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA7, 0x88B3, 0x8DDD, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C5C, 0x0000, 0x0000,
+	0x926E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AA8, 0x9AA9, 0x0000, 0x0000, 0x9AAB, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9AAC, 0x0000, 0x8DE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BCF, 0x0000, 0x0000, 0x9656, 0x0000, 0x0000, 0x0000, 0x9AAA, 0x9AAD,
+	0x8DBF, 0x8D42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFA96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9AB1, 0x0000, 0x0000, 0x8DA3, 0xFA97, 0x9252, 0x0000, 0x0000, 0x9AAE, 0x92D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AB2,
+	0x0000, 0x0000, 0x9082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AB0, 0x9AB3, 0x0000, 0x8C5E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9AB4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9AB5, 0x0000, 0x8D43, 0x8A5F, 0x9AB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AB8, 0x0000, 0xFA98, 0x0000, 0x0000, 0x0000,
+	0x9AB9, 0x0000, 0x0000, 0x9AB6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9AAF, 0x0000, 0x0000, 0x9ABA, 0x0000, 0x0000, 0x9ABB, 0xFA9A, 0xFA99, 0x0000, 0x0000, 0x9684, 0x0000, 0x0000, 0x8FE9, 0x0000,
+	0x0000, 0x0000, 0x9ABD, 0x9ABE, 0x9ABC, 0x0000, 0x9AC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9457, 0x0000, 0x0000, 0x88E6,
+	0x9575, 0x0000, 0x0000, 0x9AC1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8FFB, 0x0000, 0x0000, 0x8EB7, 0x0000, 0x947C, 0x8AEE, 0x0000, 0x8DE9, 0x0000, 0x0000, 0x0000,
+	0x9678, 0x0000, 0x93B0, 0x0000, 0x0000, 0x8C98, 0x91CD, 0x0000, 0x0000, 0x0000, 0x9ABF, 0x9AC2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91C2, 0x0000, 0x0000, 0x0000, 0x9AC3, 0x0000, 0x0000, 0x0000, 0x9AC4, 0x0000, 0x0000,
+	0x0000, 0x9AC6, 0x0000, 0x0000, 0x92E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AAC, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA9F,
+	0x8981, 0x95F1, 0x0000, 0x0000, 0x8FEA, 0x9367, 0x0000, 0x0000, 0x0000, 0x0000, 0x8DE4, 0x0000, 0x0000, 0x9ACC, 0x0000, 0x0000,
+	0x95BB, 0x97DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89F2, 0x9AC8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9159, 0x9ACB, 0x0000, 0x9383, 0x0000, 0x0000, 0x9368, 0x9384, 0x94B7, 0x92CB, 0x0000, 0x0000, 0x0000, 0x8DC7, 0x0000,
+	0x0000, 0x0000, 0x9AC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8996, 0x0000, 0x9355, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9AC9, 0x0000, 0x9AC5, 0x0000, 0x0000, 0x906F, 0x0000, 0x0000, 0x0000, 0x9ACD, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F6D, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8BAB, 0x0000, 0x9ACE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x95E6, 0x0000, 0x0000, 0x0000, 0x919D, 0x0000, 0x0000, 0x0000, 0x0000, 0x92C4, 0x0000, 0xFA9D, 0x9AD0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x966E, 0x0000, 0x0000, 0x9AD1, 0x0000, 0x0000, 0x9AD6, 0x0000,
+	0x0000, 0x0000, 0xFA9E, 0x95AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AD5, 0x9ACF, 0x9AD2, 0x9AD4, 0x0000, 0x0000, 0x8DA4, 0x0000,
+	0x0000, 0x95C7, 0x0000, 0x0000, 0x0000, 0x9AD7, 0x0000, 0x9264, 0x0000, 0x0000, 0x89F3, 0x0000, 0x8FEB, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9AD9, 0x0000, 0x9AD8, 0x0000, 0x8D88, 0x0000, 0x9ADA, 0x9ADC, 0x9ADB, 0x0000, 0x0000, 0x9ADE, 0x0000, 0x9AD3, 0x9AE0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9ADF, 0x9ADD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E6D, 0x9070, 0x0000, 0x9173, 0x9AE1,
+	0x90BA, 0x88EB, 0x9484, 0x0000, 0x0000, 0x0000, 0x0000, 0x92D9, 0x0000, 0x9AE3, 0x9AE2, 0x9AE4, 0x9AE5, 0x9AE6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9AE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95CF, 0x9AE8, 0xFA9F, 0x0000, 0x0000, 0x0000, 0x89C4,
+	0x9AE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x975B, 0x8A4F, 0x0000, 0x99C7, 0x8F67, 0x91BD, 0x9AEA, 0x96E9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x96B2, 0x0000, 0x0000, 0x9AEC, 0x0000, 0x91E5, 0x0000, 0x9356, 0x91BE, 0x9576, 0x9AED, 0x9AEE, 0x899B, 0x0000,
+	0x0000, 0x8EB8, 0x9AEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x88CE, 0x9AF0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AF1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8982, 0x0000, 0x0000, 0x8AEF, 0x93DE, 0x95F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AF5, 0x9174,
+	0x9AF4, 0x8C5F, 0x0000, 0xFAA0, 0x967A, 0x9AF3, 0x0000, 0x9385, 0x9AF7, 0x0000, 0x9AF6, 0xFAA1, 0x0000, 0xFAA2, 0x0000, 0x0000,
+	0x9AF9, 0x0000, 0x9AF8, 0xFAA3, 0x0000, 0x899C, 0x0000, 0x9AFA, 0x8FA7, 0x9AFC, 0x9244, 0x0000, 0x9AFB, 0x0000, 0x95B1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8F97, 0x937A, 0x0000, 0x0000, 0x0000, 0x9B40, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D44, 0x0000, 0x0000,
+	0x0000, 0x9B41, 0x9440, 0x94DC, 0x96CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9444, 0x0000, 0x0000, 0x9B4A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8B57, 0x0000, 0x0000, 0x9764, 0x0000, 0x0000, 0x96AD, 0x0000, 0x9BAA, 0x0000, 0x9B42, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9B45, 0xFAA4, 0x91C3, 0x0000, 0x0000, 0x9657, 0x0000, 0x0000, 0x0000, 0x9369, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9B46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9685, 0xFAA5, 0x8DC8, 0x0000, 0x0000, 0x8FA8, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B47, 0x0000, 0x0000, 0x8E6F, 0x0000, 0x8E6E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x88B7, 0x8CC6, 0x0000, 0x90A9, 0x88CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B4B, 0x9B4C, 0x0000, 0x9B49, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8957, 0x8AAD, 0x0000, 0x9B48, 0x0000, 0x96C3, 0x9550, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x88A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x88F7, 0x0000, 0x0000, 0x0000, 0x8E70,
+	0x0000, 0x88D0, 0x0000, 0x88A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9B4F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96BA, 0x0000, 0x9B52, 0x0000, 0x9B50, 0x0000, 0x0000, 0x9B4E,
+	0x9050, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B4D, 0x0000, 0x0000, 0x0000, 0x95D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CE2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B56, 0x9B57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FA9, 0x0000, 0x0000, 0x0000,
+	0x9B53, 0x984B, 0x0000, 0x0000, 0x0000, 0x0000, 0x946B, 0x0000, 0x0000, 0x9B55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8DA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9B58, 0x0000, 0x0000, 0x0000, 0x9577, 0x0000, 0x0000, 0x0000, 0x9B59, 0x0000, 0x9B54, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96B9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x947D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B5A, 0x9551, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B5B, 0x9B5F, 0x9B5C, 0x0000,
+	0x0000, 0x89C5, 0x9B5E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EB9, 0x0000, 0x9B5D, 0x8C99, 0x0000, 0x0000, 0x0000,
+	0x9B6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B64, 0x9B61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9284, 0x0000, 0x9B60, 0x0000, 0x0000, 0x9B62, 0x0000, 0x0000, 0x9B63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B65, 0x9B66, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AF0, 0x0000, 0x9B68, 0x9B67, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8FEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B6C, 0x0000, 0x92DA, 0x0000, 0x0000, 0x0000,
+	0x8964, 0x0000, 0x9B6A, 0x0000, 0x0000, 0x0000, 0x9B6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B6E, 0x0000,
+	0x9B71, 0x0000, 0x0000, 0x9B6F, 0x0000, 0x9B70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8E71, 0x9B72, 0x0000, 0x0000, 0x8D45, 0x9B73, 0xFAA6, 0x8E9A, 0x91B6, 0x0000, 0x9B74, 0x9B75, 0x8E79, 0x8D46, 0x0000, 0x96D0,
+	0x0000, 0x0000, 0x0000, 0x8B47, 0x8CC7, 0x9B76, 0x8A77, 0x0000, 0x0000, 0x9B77, 0x0000, 0x91B7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9B78, 0x9BA1, 0x0000, 0x9B79, 0x0000, 0x9B7A, 0x0000, 0x0000, 0x9B7B, 0x0000, 0x9B7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9B7E, 0x0000, 0x0000, 0x9B80, 0x0000, 0x91EE, 0x0000, 0x8946, 0x8EE7, 0x88C0, 0x0000, 0x9176, 0x8AAE, 0x8EB3, 0x0000, 0x8D47,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9386, 0x0000, 0x8F40, 0x8AAF, 0x9288, 0x92E8, 0x88B6, 0x8B58, 0x95F3, 0x0000, 0x8EC0,
+	0x0000, 0x0000, 0x8B71, 0x90E9, 0x8EBA, 0x9747, 0x9B81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B7B, 0x0000,
+	0x8DC9, 0x0000, 0x0000, 0x8A51, 0x8983, 0x8FAA, 0x89C6, 0x0000, 0x9B82, 0x9765, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F68,
+	0xFAA7, 0x0000, 0x8EE2, 0x9B83, 0x8AF1, 0x93D0, 0x96A7, 0x9B84, 0x0000, 0x9B85, 0x0000, 0x0000, 0x9578, 0x0000, 0x0000, 0x0000,
+	0x9B87, 0x0000, 0x8AA6, 0x8BF5, 0x9B86, 0x0000, 0x0000, 0x0000, 0xFAA9, 0x0000, 0x0000, 0x8AB0, 0x0000, 0x9051, 0x9B8B, 0x8E40,
+	0x0000, 0x89C7, 0x9B8A, 0x0000, 0x9B88, 0x9B8C, 0x9B89, 0x944A, 0x9ECB, 0x9052, 0x0000, 0x9B8D, 0xFAAA, 0x0000, 0x97BE, 0x0000,
+	0x9B8E, 0x0000, 0x0000, 0x9B90, 0x0000, 0x929E, 0x9B8F, 0x0000, 0x90A1, 0x0000, 0x8E9B, 0x0000, 0x0000, 0x0000, 0x91CE, 0x8EF5,
+	0x0000, 0x9595, 0x90EA, 0x0000, 0x8ECB, 0x9B91, 0x8FAB, 0x9B92, 0x9B93, 0x88D1, 0x91B8, 0x9071, 0x0000, 0x9B94, 0x93B1, 0x8FAC,
+	0x0000, 0x8FAD, 0x0000, 0x9B95, 0x0000, 0x0000, 0x90EB, 0x0000, 0x0000, 0x0000, 0x8FAE, 0x0000, 0x0000, 0x0000, 0xFAAB, 0x0000,
+	0x9B96, 0x0000, 0x9B97, 0x0000, 0x96DE, 0x0000, 0x0000, 0x0000, 0x9B98, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BC4, 0x0000, 0x0000,
+	0x0000, 0x8F41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B99, 0x9B9A, 0x8EDA, 0x904B, 0x93F2, 0x9073, 0x94F6, 0x9441,
+	0x8BC7, 0x9B9B, 0x0000, 0x0000, 0x0000, 0x8B8F, 0x9B9C, 0x0000, 0x8BFC, 0x0000, 0x93CD, 0x89AE, 0x0000, 0x8E72, 0x9B9D, 0x9BA0,
+	0x9B9F, 0x8BFB, 0x0000, 0x9B9E, 0x0000, 0x9357, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91AE, 0x0000,
+	0x936A, 0x8EC6, 0x0000, 0x0000, 0x9177, 0x979A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BA2, 0x0000, 0x9BA3, 0x93D4,
+	0x0000, 0x8E52, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BA5, 0x0000, 0x0000, 0x9BA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BA7, 0x0000, 0x0000, 0x0000,
+	0x8AF2, 0x9BA8, 0x0000, 0x0000, 0x9BA9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x89AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAAC, 0x0000, 0x915A, 0x8AE2, 0x0000, 0x9BAB, 0x96A6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x91D0, 0x0000, 0x8A78, 0x0000, 0x0000, 0x9BAD, 0x9BAF, 0x8ADD, 0x0000, 0xFAAD, 0x9BAC, 0x9BAE, 0x0000, 0x9BB1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BB0, 0x0000, 0x9BB2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BB3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x93BB, 0x8BAC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89E3, 0x9BB4, 0x9BB9, 0x0000, 0x0000, 0x9BB7, 0x0000, 0x95F5,
+	0x95F4, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAAE, 0x9387, 0x0000, 0x0000, 0x0000, 0x9BB6, 0x8F73, 0x0000, 0x9BB5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9092, 0x0000, 0x0000, 0x0000, 0x9BBA, 0x0000, 0x0000, 0x8DE8, 0x0000,
+	0x0000, 0x9BC0, 0x0000, 0x0000, 0x9BC1, 0x9BBB, 0x8A52, 0x9BBC, 0x9BC5, 0x9BC4, 0x9BC3, 0x9BBF, 0x0000, 0x0000, 0x0000, 0x9BBE,
+	0x0000, 0x0000, 0x9BC2, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAAF, 0x0000, 0x95F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFAB2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BC9, 0x9BC6, 0x0000, 0x9BC8, 0x0000,
+	0x9792, 0x0000, 0x9BC7, 0xFAB0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BBD, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9093, 0x0000, 0x0000, 0x9BCA, 0xFAB3, 0x0000, 0x8DB5,
+	0x0000, 0x0000, 0x0000, 0x9BCB, 0x0000, 0x0000, 0x9BCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9BCF, 0x0000, 0x9BCE, 0x0000, 0x0000, 0x9BCD, 0x0000, 0x0000, 0x0000, 0x9388, 0x9BB8, 0x0000, 0x0000, 0x0000,
+	0x9BD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BD1, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9BD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BD2, 0x0000, 0x9BD3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BD6, 0xFAB4, 0xFAB5, 0x97E4, 0x0000, 0x9BD7, 0x9BD4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BD8, 0x0000, 0x0000, 0x8ADE, 0x9BD9, 0x0000, 0x0000,
+	0xFAB6, 0x0000, 0x9BDB, 0x9BDA, 0x0000, 0x0000, 0x9BDC, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BDD, 0x0000, 0x90EC, 0x8F42, 0x0000,
+	0x0000, 0x8F84, 0x0000, 0x9183, 0x0000, 0x8D48, 0x8DB6, 0x8D49, 0x8B90, 0x0000, 0x0000, 0x9BDE, 0x0000, 0x0000, 0x8DB7, 0x0000,
+	0x0000, 0x8CC8, 0x9BDF, 0x96A4, 0x9462, 0x9BE0, 0x0000, 0x8D4A, 0x0000, 0x0000, 0x0000, 0x8AAA, 0x0000, 0x9246, 0x8BD0, 0x0000,
+	0x0000, 0x0000, 0x8E73, 0x957A, 0x0000, 0x0000, 0x94BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BE1, 0x8AF3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9BE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x929F, 0x0000, 0x0000, 0x9BE3, 0x9BE2, 0x9BE5, 0x0000, 0x92E9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E74, 0x0000, 0x90C8, 0x0000, 0x91D1,
+	0x8B41, 0x0000, 0x0000, 0x92A0, 0x0000, 0x0000, 0x9BE6, 0x9BE7, 0x8FED, 0x0000, 0x0000, 0x0000, 0x0000, 0x9658, 0x0000, 0x0000,
+	0x9BEA, 0x0000, 0x0000, 0x9BE9, 0x9BE8, 0x959D, 0x0000, 0x9BF1, 0x0000, 0x0000, 0x0000, 0x0000, 0x9679, 0x0000, 0x9BEB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9BED, 0x968B, 0x0000, 0x9BEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BEE,
+	0x0000, 0x94A6, 0x9BEF, 0x95BC, 0x9BF0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8AB1, 0x95BD, 0x944E, 0x9BF2, 0x9BF3, 0x0000, 0x8D4B, 0x8AB2, 0x9BF4, 0x8CB6, 0x9763, 0x9748, 0x8AF4, 0x9BF6,
+	0x0000, 0x92A1, 0x0000, 0x8D4C, 0x8FAF, 0x0000, 0x0000, 0x94DD, 0x0000, 0x0000, 0x8FB0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F98,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92EA, 0x95F7, 0x9358, 0x0000, 0x0000, 0x8D4D, 0x0000, 0x957B, 0x0000, 0x0000, 0x0000,
+	0x9BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9378, 0x8DC0, 0x0000, 0x0000, 0x0000, 0x8CC9, 0x0000, 0x92EB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x88C1, 0x8F8E, 0x8D4E, 0x9766, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9BF8, 0x9BF9, 0x9470, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BFA, 0x97F5, 0x984C, 0x0000, 0x0000, 0x0000, 0x0000, 0x9BFC,
+	0x9BFB, 0x0000, 0x0000, 0x8A66, 0x0000, 0x0000, 0x9C40, 0x0000, 0x0000, 0x0000, 0x9C43, 0x9C44, 0x0000, 0x9C42, 0x0000, 0x955F,
+	0x8FB1, 0x9C46, 0x9C45, 0x9C41, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C47, 0x9C48, 0x0000, 0x0000, 0x9C49, 0x0000, 0x0000, 0x0000,
+	0x9C4C, 0x9C4A, 0x0000, 0x9C4B, 0x9C4D, 0x0000, 0x8984, 0x92EC, 0x9C4E, 0x0000, 0x8C9A, 0x89F4, 0x9455, 0x0000, 0x9C4F, 0x93F9,
+	0x0000, 0x95D9, 0x0000, 0x9C50, 0x984D, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C51, 0x95BE, 0x9C54, 0x989F, 0x98AF, 0x0000, 0x8EAE,
+	0x93F3, 0x9C55, 0x0000, 0x8B7C, 0x92A2, 0x88F8, 0x9C56, 0x95A4, 0x8D4F, 0x0000, 0x0000, 0x926F, 0x0000, 0x0000, 0x0000, 0x92ED,
+	0x0000, 0xFAB7, 0x0000, 0x0000, 0x0000, 0x96ED, 0x8CB7, 0x8CCA, 0x0000, 0x9C57, 0x0000, 0x0000, 0x0000, 0x9C58, 0x0000, 0x9C5E,
+	0x0000, 0x8EE3, 0x0000, 0x0000, 0xFAB8, 0x92A3, 0x0000, 0x8BAD, 0x9C59, 0x0000, 0x0000, 0x0000, 0x954A, 0x0000, 0x9265, 0x0000,
+	0x0000, 0x9C5A, 0x0000, 0x0000, 0x0000, 0xFA67, 0x0000, 0x0000, 0x9C5B, 0x0000, 0x8BAE, 0x0000, 0x9C5C, 0x0000, 0x9C5D, 0x0000,
+	0x0000, 0x9C5F, 0x0000, 0x9396, 0x0000, 0x0000, 0x9C60, 0x9C61, 0x0000, 0x9C62, 0x0000, 0x0000, 0x9C53, 0x9C52, 0x0000, 0x0000,
+	0x0000, 0x9C63, 0x8C60, 0x0000, 0x0000, 0x0000, 0x9546, 0xFAB9, 0x0000, 0x8DCA, 0x9556, 0x92A4, 0x956A, 0x9C64, 0x0000, 0x0000,
+	0x8FB2, 0x8965, 0x0000, 0x9C65, 0x0000, 0x0000, 0x0000, 0x9C66, 0x0000, 0x96F0, 0x0000, 0x0000, 0x94DE, 0x0000, 0x0000, 0x9C69,
+	0x899D, 0x90AA, 0x9C68, 0x9C67, 0x8C61, 0x91D2, 0x0000, 0x9C6D, 0x9C6B, 0x0000, 0x9C6A, 0x97A5, 0x8CE3, 0x0000, 0x0000, 0x0000,
+	0x8F99, 0x9C6C, 0x936B, 0x8F5D, 0x0000, 0x0000, 0x0000, 0x93BE, 0x9C70, 0x9C6F, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C6E, 0x0000,
+	0x9C71, 0x8CE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C72, 0x959C, 0x8F7A, 0x0000, 0x0000, 0x9C73, 0x94F7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x93BF, 0x92A5, 0x0000, 0x0000, 0xFABA, 0x0000, 0x934F, 0x0000, 0x0000, 0x9C74, 0x8B4A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9053, 0x0000, 0x954B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AF5, 0x9445, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C75, 0x8E75, 0x9659, 0x965A, 0x0000, 0x0000, 0x899E, 0x9C7A, 0xFABB, 0x0000,
+	0x9289, 0x0000, 0x0000, 0x0000, 0x9C77, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89F5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9CAB, 0x9C79, 0x0000, 0x0000, 0x0000, 0x944F, 0x0000, 0x0000, 0x9C78, 0x0000, 0x0000, 0x9C76, 0x0000, 0x8D9A, 0x0000, 0x9C7C,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C83, 0x9C89,
+	0x9C81, 0x0000, 0x937B, 0x0000, 0x0000, 0x9C86, 0x957C, 0x0000, 0x0000, 0x9C80, 0x0000, 0x9C85, 0x97E5, 0x8E76, 0x0000, 0x0000,
+	0x91D3, 0x9C7D, 0x0000, 0x0000, 0x0000, 0x8B7D, 0x9C88, 0x90AB, 0x8985, 0x9C82, 0x89F6, 0x9C87, 0x0000, 0x0000, 0x0000, 0x8BAF,
+	0x0000, 0x9C84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C8A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9C8C, 0x9C96, 0x9C94, 0x0000, 0x0000, 0x9C91, 0x0000, 0x0000, 0x0000, 0x9C90, 0x97F6, 0x0000, 0x9C92, 0x0000, 0x0000,
+	0x8BB0, 0x0000, 0x8D50, 0x0000, 0x0000, 0x8F9A, 0x0000, 0x0000, 0x0000, 0x9C99, 0x9C8B, 0x0000, 0x0000, 0xFABC, 0x0000, 0x9C8F,
+	0x9C7E, 0x0000, 0x89F8, 0x9C93, 0x9C95, 0x9270, 0x0000, 0x0000, 0x8DA6, 0x89B6, 0x9C8D, 0x9C98, 0x9C97, 0x8BB1, 0x0000, 0x91A7,
+	0x8A86, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C62, 0x0000, 0x9C8E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9C9A, 0x0000, 0x9C9D, 0x9C9F, 0xFABD, 0x0000, 0x0000, 0x0000, 0x8EBB, 0xFABE, 0x9CA5, 0x92EE, 0x9C9B, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9CA3, 0x0000, 0x89F7, 0x0000, 0x9CA1, 0x9CA2, 0x0000, 0x0000, 0x9C9E, 0x9CA0, 0x0000, 0x0000, 0x0000, 0x8CE5,
+	0x9749, 0x0000, 0x0000, 0x8AB3, 0x0000, 0x0000, 0x8978, 0x9CA4, 0x0000, 0x9459, 0x88AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x94DF, 0x9C7B, 0x9CAA, 0x9CAE, 0x96E3, 0x0000, 0x9CA7, 0x0000, 0x0000, 0x0000, 0x9389, 0x9CAC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FEE, 0x9CAD, 0x93D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9866, 0x0000, 0x9CA9, 0x0000, 0xFAC0, 0x0000, 0x0000, 0x9CAF, 0x0000, 0x8D9B, 0x0000, 0x90C9, 0x0000, 0xFABF, 0x88D2,
+	0x9CA8, 0x9CA6, 0x0000, 0x9179, 0x0000, 0x0000, 0x0000, 0x9C9C, 0x8E53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x91C4, 0x9CBB, 0xFAC2, 0x917A, 0x9CB6, 0x0000, 0x9CB3, 0x9CB4, 0x0000, 0x8EE4, 0x9CB7, 0x9CBA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9CB5, 0x8F44, 0x0000, 0x9CB8, 0x0000, 0x0000, 0x9CB2, 0x0000, 0x96FA, 0x96F9, 0x0000, 0x0000, 0x0000, 0x9CBC, 0x9CBD, 0x88D3,
+	0x0000, 0xFAC3, 0x0000, 0x0000, 0x0000, 0x9CB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BF0, 0x88A4, 0x0000, 0x0000, 0x0000, 0x8AB4,
+	0xFAC1, 0x9CB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CC1, 0x9CC0, 0x0000, 0x0000, 0x0000, 0x9CC5, 0x0000, 0x0000, 0x0000,
+	0xFAC5, 0x0000, 0x0000, 0x0000, 0x9CC6, 0x0000, 0x0000, 0xFAC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CC4, 0x9CC7, 0x9CBF, 0x9CC3,
+	0x0000, 0x0000, 0x9CC8, 0x0000, 0x9CC9, 0x0000, 0x0000, 0x9CBE, 0x8E9C, 0x0000, 0x9CC2, 0x91D4, 0x8D51, 0x9CB0, 0x9054, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9CD6, 0x0000, 0x95E7, 0x0000, 0x0000, 0x9CCC, 0x9CCD, 0x9CCE, 0x0000, 0x0000, 0x9CD5, 0x0000, 0x9CD4,
+	0x0000, 0x0000, 0x969D, 0x8AB5, 0x0000, 0x9CD2, 0x0000, 0x8C64, 0x8A53, 0x0000, 0x0000, 0x9CCF, 0x0000, 0x0000, 0x97B6, 0x9CD1,
+	0x88D4, 0x9CD3, 0x0000, 0x9CCA, 0x9CD0, 0x9CD7, 0x8C63, 0x9CCB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x977C, 0x0000,
+	0x0000, 0x0000, 0x974A, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CDA, 0x0000, 0x0000, 0x9CDE, 0x0000, 0x0000, 0x0000, 0x919E, 0x0000,
+	0x97F7, 0x9CDF, 0x0000, 0x0000, 0x9CDC, 0x0000, 0x9CD9, 0x0000, 0xFAC6, 0x9CD8, 0x9CDD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x95AE, 0x0000, 0x0000, 0x93B2, 0x0000, 0x8C65, 0x0000, 0x9CE0, 0x9CDB, 0x0000, 0x9CE1, 0x0000,
+	0x0000, 0x0000, 0x8C9B, 0x0000, 0x0000, 0x0000, 0x89AF, 0x0000, 0x0000, 0x0000, 0x9CE9, 0x0000, 0x0000, 0x0000, 0x8AB6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9CE7, 0x0000, 0x0000, 0x9CE8, 0x8DA7, 0x9CE6, 0x9CE4, 0x9CE3, 0x9CEA, 0x9CE2, 0x9CEC, 0x0000, 0x0000,
+	0x89F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9CEE, 0x0000, 0x0000, 0x9CED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x92A6, 0x0000, 0x9CF1, 0x0000, 0x9CEF, 0x9CE5, 0x8C9C, 0x0000, 0x9CF0, 0x0000, 0x9CF4, 0x9CF3, 0x9CF5, 0x9CF2,
+	0x9CF6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CF7, 0x9CF8, 0x95E8, 0x0000, 0x9CFA, 0x9CF9, 0x8F5E, 0x0000,
+	0x90AC, 0x89E4, 0x89FA, 0xFAC7, 0x9CFB, 0x0000, 0x88BD, 0x0000, 0x0000, 0x0000, 0x90CA, 0x9CFC, 0x0000, 0xE6C1, 0x9D40, 0x8C81,
+	0x0000, 0x9D41, 0x0000, 0x0000, 0x0000, 0x0000, 0x90ED, 0x0000, 0x0000, 0x0000, 0x9D42, 0x0000, 0x0000, 0x0000, 0x9D43, 0x8B59,
+	0x9D44, 0x0000, 0x9D45, 0x9D46, 0x91D5, 0x0000, 0x0000, 0x0000, 0x8CCB, 0x0000, 0x0000, 0x96DF, 0x0000, 0x0000, 0x0000, 0x965B,
+	0x8F8A, 0x9D47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90EE, 0xE7BB, 0x94E0, 0x0000, 0x8EE8, 0x0000, 0x8DCB, 0x9D48, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x91C5, 0x0000, 0x95A5, 0x0000, 0x0000, 0x91EF, 0x0000, 0x0000, 0x9D4B, 0x0000, 0x0000, 0x9D49, 0x0000,
+	0x9D4C, 0x0000, 0x0000, 0x9D4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95AF, 0x0000,
+	0x0000, 0x88B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x957D, 0x0000, 0x0000, 0x94E1, 0x0000, 0x0000, 0x9D4E, 0x0000, 0x9D51, 0x8FB3,
+	0x8B5A, 0x0000, 0x9D4F, 0x9D56, 0x8FB4, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D50, 0x9463, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x977D, 0x9D52, 0x9D53, 0x9D57, 0x938A, 0x9D54, 0x8D52, 0x90DC, 0x0000, 0x0000, 0x9D65, 0x94B2, 0x0000, 0x91F0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x94E2, 0x9DAB, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x95F8, 0x0000, 0x0000, 0x0000, 0x92EF, 0x0000, 0x0000, 0x0000, 0x9695, 0x0000, 0x9D5A, 0x899F, 0x928A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9D63, 0x0000, 0x0000, 0x9253, 0x9D5D, 0x9D64, 0x9D5F, 0x9D66, 0x9D62, 0x0000, 0x9D61, 0x948F, 0x0000, 0x9D5B,
+	0x89FB, 0x9D59, 0x8B91, 0x91F1, 0x9D55, 0x0000, 0x0000, 0x9D58, 0x8D53, 0x90D9, 0x0000, 0x8FB5, 0x9D60, 0x9471, 0x0000, 0x0000,
+	0x8B92, 0x8A67, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A87, 0x9040, 0x9D68, 0x9D6D,
+	0x0000, 0x9D69, 0x0000, 0x8C9D, 0x0000, 0x9D6E, 0x8E41, 0x8D89, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F45, 0x9D5C,
+	0x0000, 0x8E9D, 0x9D6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E77, 0x9D6C, 0x88C2, 0x0000, 0x0000, 0x9D67, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x92A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B93, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BB2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D6A, 0x88A5, 0x0000, 0x0000, 0x8DC1, 0x0000, 0x0000, 0x0000, 0x9055,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92F0, 0x0000, 0x0000, 0x94D2, 0x9D70, 0x917D,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91A8, 0x0000, 0x0000, 0x8E4A, 0x9D71, 0x0000, 0x9D73,
+	0x9D6F, 0x0000, 0x0000, 0x0000, 0x0000, 0x95DF, 0x0000, 0x92BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x917B, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95F9, 0x8ECC, 0x9D80, 0x0000, 0x9D7E, 0x0000, 0x0000, 0x9098, 0x0000,
+	0x0000, 0x0000, 0x8C9E, 0x0000, 0x0000, 0x0000, 0x9D78, 0x8FB7, 0x0000, 0x0000, 0x93E6, 0x9450, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9D76, 0x0000, 0x0000, 0x917C, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EF6, 0x9D7B, 0x0000, 0x0000, 0x8FB6, 0x0000, 0x9D75, 0x9D7A,
+	0x0000, 0x0000, 0x9472, 0x0000, 0x0000, 0x0000, 0x9D74, 0x0000, 0x8C40, 0x0000, 0x0000, 0x8A7C, 0x0000, 0x0000, 0x0000, 0x9D7C,
+	0x97A9, 0x8DCC, 0x9254, 0x9D79, 0x0000, 0x90DA, 0x0000, 0x8D54, 0x9084, 0x8986, 0x915B, 0x9D77, 0x8B64, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8C66, 0x0000, 0x92CD, 0x9D7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x917E, 0x0000, 0x0000, 0x9D81, 0x0000,
+	0x9D83, 0x0000, 0x0000, 0x91B5, 0x9D89, 0x0000, 0x9D84, 0x0000, 0x0000, 0x9D86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9560,
+	0x92F1, 0x0000, 0x9D87, 0x0000, 0x0000, 0x0000, 0x974B, 0x0000, 0x0000, 0x0000, 0x9767, 0x8AB7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x88AC, 0x0000, 0x9D85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D82, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AF6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8987, 0xFAC9, 0x9D88, 0x0000, 0x0000, 0x0000, 0x9768, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D8C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91B9, 0x0000, 0x9D93,
+	0x0000, 0x0000, 0x0000, 0x9D8D, 0x0000, 0x0000, 0x9D8A, 0x9D91, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D72, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D8E, 0x0000, 0x9D92, 0x0000, 0x0000, 0x0000, 0x94C0, 0x938B, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9D8B, 0x0000, 0x9D8F, 0x0000, 0x0000, 0x0000, 0x8C67, 0x0000, 0x0000, 0x0000, 0x8DEF, 0x0000,
+	0x0000, 0x0000, 0x90DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D97, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9345, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFACA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D94, 0x0000, 0x9680, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D95,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D96, 0x0000, 0x96CC, 0x0000, 0x90A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8C82, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D9D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8E54, 0x9D9A, 0x0000, 0x9D99, 0x0000, 0x0000, 0x0000, 0x0000, 0x9451, 0x0000, 0x0000, 0xFACB, 0x93B3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9350, 0x9D9B, 0x0000, 0x0000, 0x0000, 0x9D9C, 0x0000, 0x958F, 0x0000, 0x9464, 0x8E42, 0x0000,
+	0x90EF, 0x0000, 0x966F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A68, 0x0000, 0x9DA3, 0x9D9E, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9769, 0x9DA5, 0x0000, 0x0000, 0x9DA1, 0x0000, 0x9DA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9180, 0xFACC, 0x0000,
+	0x0000, 0x0000, 0x9DA0, 0x0000, 0x9D5E, 0x0000, 0x0000, 0x0000, 0x9DA4, 0x0000, 0x9D9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9DA9, 0x9DAA, 0x9346, 0x9DAC, 0x0000, 0x0000, 0x8E43, 0x9DA7, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B5B, 0x0000, 0x0000, 0x9DAD,
+	0x0000, 0x9DA6, 0x9DB1, 0x0000, 0x9DB0, 0x0000, 0x9DAF, 0x0000, 0x0000, 0x0000, 0x9DB2, 0x0000, 0x0000, 0x9DB4, 0x8FEF, 0x0000,
+	0x9DB3, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DB5, 0x0000, 0x0000, 0x0000, 0x9DB6, 0x9D90, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9DB9, 0x9DB8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9D98, 0x9DBA, 0x9DAE, 0x0000, 0x0000, 0x8E78,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9DBB, 0x9DBC, 0x9DBE, 0x9DBD, 0x9DBF, 0x89FC, 0x0000, 0x8D55, 0x0000, 0x0000, 0x95FA, 0x90AD,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CCC, 0x0000, 0x0000, 0x9DC1, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DC4, 0xFACD, 0x9571,
+	0x0000, 0x8B7E, 0x0000, 0x0000, 0x0000, 0x9DC3, 0x9DC2, 0x9473, 0x9DC5, 0x8BB3, 0x0000, 0x0000, 0x0000, 0x9DC7, 0x9DC6, 0x0000,
+	0x0000, 0x0000, 0x8AB8, 0x8E55, 0x0000, 0x0000, 0x93D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C68, 0x0000, 0x0000, 0x0000,
+	0x9094, 0x0000, 0x9DC8, 0x0000, 0x90AE, 0x9347, 0x0000, 0x957E, 0x9DC9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9DCA, 0x9DCB, 0x0000, 0x0000, 0x0000, 0x95B6, 0x9B7C, 0x90C4, 0x0000, 0x0000, 0x956B, 0x0000, 0x8DD6, 0x0000,
+	0x94E3, 0x94C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x936C, 0x0000, 0x97BF, 0x0000, 0x9DCD, 0x8ECE, 0x0000, 0x0000, 0x9DCE,
+	0x0000, 0x88B4, 0x0000, 0x0000, 0x8BD2, 0x90CB, 0x0000, 0x9580, 0x0000, 0x0000, 0x0000, 0x9DCF, 0x8E61, 0x9266, 0x0000, 0x8E7A,
+	0x9056, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DD0, 0x0000, 0x95FB, 0x0000, 0x0000, 0x8997, 0x8E7B, 0x0000, 0x0000,
+	0x0000, 0x9DD3, 0x0000, 0x9DD1, 0x9DD4, 0x97B7, 0x9DD2, 0x0000, 0x0000, 0x0000, 0x0000, 0x90F9, 0x9DD5, 0x0000, 0x0000, 0x91B0,
+	0x0000, 0x0000, 0x9DD6, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AF8, 0x0000, 0x9DD8, 0x0000, 0x9DD7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9DD9, 0x9DDA, 0x8AF9, 0x0000, 0x0000, 0x93FA, 0x9255, 0x8B8C, 0x8E7C, 0x9181, 0x0000, 0x0000, 0x8F7B, 0x88AE, 0x0000, 0x0000,
+	0x0000, 0x9DDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89A0, 0x9DDF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFACE, 0x0000, 0x8D56, 0x9DDE, 0x0000, 0x0000, 0x8DA9, 0x8FB8, 0x0000, 0xFAD1, 0x9DDD, 0x0000, 0x8FB9, 0x0000, 0x96BE, 0x8DA8,
+	0x0000, 0x0000, 0x0000, 0x88D5, 0x90CC, 0xFACF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DE4, 0x0000, 0xFAD3, 0x90AF,
+	0x8966, 0x0000, 0x0000, 0x0000, 0xFAD4, 0x8F74, 0x0000, 0x9686, 0x8DF0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FBA, 0xFAD2, 0x90A5,
+	0x0000, 0xFA63, 0x0000, 0x0000, 0x9DE3, 0x9DE1, 0x9DE2, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAD0, 0x928B, 0x0000, 0x0000, 0x9E45,
+	0x0000, 0x9DE8, 0x8E9E, 0x8D57, 0x9DE6, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DE7, 0x0000, 0x9057, 0x0000, 0x0000, 0x0000, 0x9DE5,
+	0x0000, 0x0000, 0x8E4E, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAD6, 0x0000, 0xFAD7, 0x0000, 0x0000, 0x0000, 0x9DEA, 0x9DE9, 0x9DEE,
+	0x0000, 0x0000, 0x9DEF, 0x0000, 0x9DEB, 0xFAD5, 0x8A41, 0x9DEC, 0x9DED, 0x94D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x9581, 0x8C69,
+	0x9DF0, 0x0000, 0x0000, 0xFAD9, 0x90B0, 0x0000, 0x8FBB, 0x0000, 0x0000, 0x0000, 0x9271, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8BC5, 0x0000, 0x9DF1, 0x9DF5, 0x0000, 0x0000, 0x89C9, 0x9DF2, 0x9DF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DF3, 0x0000,
+	0x0000, 0x8F8B, 0x0000, 0x0000, 0x0000, 0x0000, 0x9267, 0x88C3, 0x9DF6, 0xFADA, 0x0000, 0x0000, 0x0000, 0x9DF7, 0x0000, 0x0000,
+	0xFADB, 0x0000, 0x92A8, 0x0000, 0x0000, 0x0000, 0x97EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E62, 0x0000, 0x0000, 0x95E9, 0x0000,
+	0x0000, 0x0000, 0xFADC, 0x0000, 0x965C, 0x0000, 0x0000, 0x0000, 0x9E41, 0x9DF9, 0x0000, 0x0000, 0x9DFC, 0x0000, 0x9DFB, 0xFADD,
+	0x0000, 0x9DF8, 0x0000, 0x0000, 0x9E40, 0x0000, 0x0000, 0x93DC, 0x0000, 0x9DFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E42, 0x0000, 0x0000, 0x8F8C, 0x9E43, 0x0000, 0x976A, 0x9498, 0x0000, 0x0000,
+	0x9E44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E46, 0x0000, 0x0000, 0x9E47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9E48, 0x0000, 0x8BC8, 0x8967, 0x8D58, 0x9E49, 0x0000, 0x9E4A, 0x8F91, 0x9182, 0xFADE, 0xFA66, 0x99D6, 0x915D, 0x915C, 0x91D6,
+	0x8DC5, 0x0000, 0x0000, 0x98F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C8E, 0x974C, 0x0000, 0x95FC, 0x0000, 0x959E, 0xFADF, 0x9E4B,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8DF1, 0x92BD, 0x9E4C, 0x984E, 0x0000, 0x0000, 0x0000, 0x965D, 0x0000, 0x92A9, 0x9E4D, 0x8AFA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E4E, 0x9E4F, 0x96D8, 0x0000, 0x96A2, 0x9696, 0x967B, 0x8E44, 0x9E51, 0x0000,
+	0x0000, 0x8EE9, 0x0000, 0x0000, 0x9670, 0x0000, 0x9E53, 0x9E56, 0x9E55, 0x0000, 0x8AF7, 0x0000, 0x0000, 0x8B80, 0x0000, 0x9E52,
+	0x0000, 0x9E54, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E57, 0x0000, 0x0000, 0x9099, 0x0000, 0x0000, 0x0000, 0x0000, 0x979B, 0x88C7,
+	0x8DDE, 0x91BA, 0x0000, 0x8EDB, 0x0000, 0x0000, 0x8FF1, 0x0000, 0x0000, 0x9E5A, 0x0000, 0x0000, 0x936D, 0x0000, 0x9E58, 0x91A9,
+	0x9E59, 0x8FF0, 0x96DB, 0x9E5B, 0x9E5C, 0x9788, 0xFAE1, 0x0000, 0x0000, 0x0000, 0x9E61, 0x0000, 0x0000, 0x8D59, 0x0000, 0x9474,
+	0x9E5E, 0x938C, 0x9DDC, 0x9DE0, 0x0000, 0x8B6E, 0x0000, 0x9466, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E60, 0x0000, 0x8FBC, 0x94C2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E66, 0x0000, 0x94F8, 0x0000, 0x9E5D, 0x0000, 0x9E63, 0x9E62, 0x0000, 0x0000, 0x0000,
+	0x90CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x968D, 0x0000, 0x97D1, 0x0000, 0x0000, 0x9687, 0x0000, 0x89CA, 0x8E7D, 0x0000, 0x0000,
+	0x9867, 0x9E65, 0x9095, 0x0000, 0x0000, 0x0000, 0x9E64, 0x0000, 0x0000, 0x9E5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CCD,
+	0x0000, 0x0000, 0x0000, 0x9E6B, 0x9E69, 0x0000, 0x89CB, 0x9E67, 0x9E6D, 0x9E73, 0x0000, 0xFAE2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFAE4, 0x91C6, 0x0000, 0x0000, 0x95BF, 0x0000, 0x9E75, 0x0000, 0x0000, 0x0000, 0x9541, 0x0000, 0x0000, 0x0000, 0x9E74, 0x9490,
+	0x965E, 0x8AB9, 0x0000, 0x90F5, 0x8F5F, 0x0000, 0x0000, 0x0000, 0x92D1, 0x0000, 0x974D, 0x0000, 0x0000, 0x9E70, 0x9E6F, 0x0000,
+	0x0000, 0x0000, 0x9E71, 0x0000, 0x9E6E, 0x0000, 0x0000, 0x9E76, 0x0000, 0x9E6C, 0x0000, 0x0000, 0x9E6A, 0x0000, 0x9E72, 0x9E68,
+	0x0000, 0x928C, 0x0000, 0x96F6, 0x8EC4, 0x8DF2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8DB8, 0x0000, 0x0000, 0x968F, 0x8A60,
+	0x0000, 0xFAE5, 0x92CC, 0x93C8, 0x8968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x90F0, 0x0000, 0x0000, 0x90B2, 0x8C49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E78, 0x0000,
+	0x0000, 0x8D5A, 0x8A9C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E7A, 0x8A94, 0x9E81, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9E7D, 0x0000, 0x90F1, 0x0000, 0x0000, 0x0000, 0x8A6A, 0x8DAA, 0x0000, 0x0000, 0x8A69, 0x8DCD, 0x0000, 0x0000,
+	0x9E7B, 0x8C85, 0x8C6A, 0x938D, 0xFAE6, 0x0000, 0x9E79, 0x0000, 0x88C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E7C, 0x9E7E, 0x0000,
+	0x8BCB, 0x8C4B, 0xFAE3, 0x8ABA, 0x8B6A, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E82, 0x0000, 0x0000, 0x8DF7, 0x9691, 0x0000, 0x8E56,
+	0x0000, 0x0000, 0x0000, 0x9E83, 0x0000, 0x0000, 0x0000, 0x954F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9E8F, 0x0000, 0x89B1, 0x9E84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E95, 0x9E85,
+	0x0000, 0x97C0, 0x0000, 0x9E8C, 0x0000, 0x947E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E94, 0x0000, 0x9E87,
+	0x0000, 0x0000, 0x0000, 0x88B2, 0x9E89, 0x0000, 0x0000, 0x8D5B, 0x0000, 0x0000, 0x0000, 0x9E8B, 0x0000, 0x9E8A, 0x0000, 0x9E86,
+	0x9E91, 0x0000, 0x8FBD, 0x0000, 0x0000, 0x0000, 0x9AEB, 0x8CE6, 0x979C, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E88, 0x0000, 0x92F2,
+	0x8A42, 0x8DAB, 0x0000, 0x9E80, 0x0000, 0x9E90, 0x8A81, 0x0000, 0x0000, 0x9E8E, 0x9E92, 0x0000, 0x938E, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8AFC, 0x0000, 0x9EB0, 0x0000, 0xFA64, 0x96C7, 0x9E97, 0x8AFB, 0x0000, 0x9E9E, 0x0000, 0xFAE7,
+	0x0000, 0x0000, 0x965F, 0x0000, 0x9E9F, 0x9EA1, 0x0000, 0x9EA5, 0x9E99, 0x0000, 0x9249, 0x0000, 0x0000, 0x0000, 0x0000, 0x938F,
+	0x9EA9, 0x9E9C, 0x0000, 0x9EA6, 0x0000, 0x0000, 0x0000, 0x9EA0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9058, 0x9EAA,
+	0x0000, 0x0000, 0x90B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EA8, 0x8ABB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x986F, 0x9E96, 0x0000, 0x0000, 0x9EA4, 0x88D6, 0x0000, 0x0000, 0x9E98, 0x0000, 0x0000, 0x96B8, 0x9E9D, 0x9041, 0x92C5, 0x9E93,
+	0x0000, 0x0000, 0x9EA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x909A, 0x9EAD, 0x8A91, 0x8C9F, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9EAF, 0x9E9A, 0x9EAE, 0x0000, 0x9EA7, 0x9E9B, 0x0000, 0x9EAB, 0x0000, 0x9EAC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9EBD, 0x0000, 0x0000, 0x0000, 0x93CC, 0x0000, 0x9EA2, 0x0000, 0x0000, 0x9EB9, 0x0000, 0x0000, 0x0000, 0x9EBB, 0x0000, 0x92D6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x976B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9596, 0x9EB6, 0x91C8, 0x0000, 0x0000, 0x0000, 0x9EBC, 0x915E, 0x0000, 0x9EB3, 0x9EC0, 0x9EBF, 0x0000,
+	0x93ED, 0x9EBE, 0x93E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAE9, 0x0000, 0x9EC2, 0x9EB5, 0x0000, 0x8BC6, 0x9EB8, 0x8F7C,
+	0x0000, 0x0000, 0x0000, 0x9480, 0x9EBA, 0x8BC9, 0x0000, 0x9EB2, 0x9EB4, 0x9EB1, 0x0000, 0x0000, 0x984F, 0x8A79, 0x9EB7, 0x0000,
+	0x0000, 0x9EC1, 0x8A54, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8DE5, 0x0000, 0x0000, 0x0000, 0x897C, 0x0000,
+	0x0000, 0x9ED2, 0x0000, 0x0000, 0x9850, 0x9ED5, 0x0000, 0x0000, 0xFAEB, 0x0000, 0x0000, 0x9059, 0x9ED4, 0x0000, 0x0000, 0x0000,
+	0x9ED3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9ED0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EC4, 0x0000,
+	0x0000, 0x9EE1, 0x9EC3, 0x0000, 0x9ED6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9ECE, 0x0000, 0x0000, 0x9EC9, 0x9EC6,
+	0x0000, 0x9EC7, 0x0000, 0x9ECF, 0x0000, 0x0000, 0x0000, 0xEAA0, 0x0000, 0x0000, 0x9ECC, 0x8D5C, 0x92C6, 0x9184, 0x9ECA, 0x0000,
+	0x9EC5, 0x0000, 0x0000, 0x9EC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x976C, 0x968A, 0x0000, 0x0000, 0x0000, 0x9ECD, 0x9ED7, 0x0000,
+	0x0000, 0x0000, 0xFAEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EDF, 0x9ED8, 0x0000, 0x0000, 0x9EE5, 0x0000, 0x9EE3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9EDE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EDD, 0x0000, 0x92CE, 0x0000, 0x9185, 0x0000, 0x9EDB,
+	0x0000, 0x0000, 0x9ED9, 0x0000, 0x0000, 0x9EE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EE6, 0x94F3, 0x9EEC, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9EE7, 0x9EEA, 0x9EE4, 0x0000, 0x0000, 0x9294, 0x0000, 0x9557, 0x0000, 0x9EDA, 0x0000, 0x0000, 0x9EE2, 0x8FBE,
+	0x0000, 0x96CD, 0x9EF6, 0x9EE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CA0, 0x89A1, 0x8A7E, 0x0000, 0x0000, 0x9ED1, 0x0000,
+	0xFAED, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FBF, 0x9EEE, 0x0000, 0x9EF5, 0x8EF7, 0x8A92, 0x0000, 0x0000, 0x924D, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9EEB, 0x0000, 0xFAEF, 0x9EF0, 0x9EF4, 0x0000, 0x0000, 0x8BB4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B6B, 0x9EF2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B40,
+	0x0000, 0x93C9, 0x9EF1, 0x0000, 0x0000, 0x0000, 0x9EF3, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAEE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9EED, 0xFAF0, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAF1, 0x8A80,
+	0x9268, 0x0000, 0x0000, 0x0000, 0x9EFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EF8, 0x8CE7, 0x0000,
+	0x9EF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F40, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E77, 0x0000, 0x0000, 0x0000,
+	0x9EF9, 0x0000, 0x9EFB, 0x9EFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F4B, 0x0000, 0x9F47, 0x0000, 0x9E8D, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9F46, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F45, 0x0000, 0x0000, 0x9F42, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9EE8, 0x9F44, 0x9F43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9F49, 0x0000, 0x9845, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F4C, 0x8BF9, 0x0000, 0x0000, 0x9F48, 0x9F4A,
+	0x0000, 0x0000, 0xFAF2, 0x0000, 0xFAF3, 0x0000, 0x0000, 0x0000, 0x94A5, 0x0000, 0x9F4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F51, 0x9F4E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9793, 0x9F4F, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EDC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9F52, 0x0000, 0x0000, 0x0000, 0x9F53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8954, 0x0000, 0x9F55,
+	0x8C87, 0x8E9F, 0x0000, 0x8BD3, 0x0000, 0x0000, 0x0000, 0x89A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x977E, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F57, 0x9F56, 0x9F59, 0x8B5C, 0x0000, 0x0000, 0x8BD4, 0x8ABC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9F5C, 0x0000, 0x0000, 0x0000, 0x9F5B, 0x0000, 0x9F5D, 0x0000, 0x0000, 0x89CC, 0x0000, 0x9256, 0x0000,
+	0x9F5E, 0x0000, 0x0000, 0x8ABD, 0x9F60, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F5F, 0x0000, 0x9F61, 0x0000, 0x0000, 0x0000, 0x9F62,
+	0x0000, 0x9F63, 0x8E7E, 0x90B3, 0x8D9F, 0x0000, 0x9590, 0x0000, 0x0000, 0x95E0, 0x9863, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E95,
+	0x0000, 0x0000, 0x0000, 0x8DCE, 0x97F0, 0x0000, 0x0000, 0x0000, 0x9F64, 0x9F65, 0x0000, 0x8E80, 0x0000, 0x0000, 0x0000, 0x9F66,
+	0x9F67, 0x0000, 0x0000, 0x9F69, 0x9F68, 0x0000, 0x9677, 0x0000, 0x0000, 0x8F7D, 0x8EEA, 0x8E63, 0x0000, 0x9F6A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F6C, 0x9042, 0x0000, 0x9F6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F6D, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9F6E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F6F, 0x9F70, 0x0000, 0x0000, 0x0000, 0x9F71,
+	0x0000, 0x9F73, 0x9F72, 0x9F74, 0x89A3, 0x9269, 0x0000, 0x9F75, 0x0000, 0x0000, 0x8E45, 0x8A6B, 0x9F76, 0x0000, 0x0000, 0x9361,
+	0x9ACA, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B42, 0x9F77, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F78, 0x0000, 0x95EA, 0x9688, 0x0000,
+	0x0000, 0x0000, 0x93C5, 0x9F79, 0x94E4, 0x0000, 0xFAF4, 0x0000, 0x94F9, 0x0000, 0x0000, 0x96D1, 0x0000, 0x0000, 0x0000, 0x9F7A,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F7C, 0x9F7B, 0x0000, 0x0000, 0x9F7E,
+	0x0000, 0x0000, 0x0000, 0x9F7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E81,
+	0x0000, 0x96AF, 0x0000, 0x9F82, 0x9F83, 0x0000, 0x0000, 0x8B43, 0x0000, 0x0000, 0x0000, 0x9F84, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9F86, 0x9F85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9085, 0x0000, 0x0000, 0x9558, 0x8969, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94C3, 0xFAF5,
+	0x92F3, 0x8F60, 0x8B81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94C4, 0x0000,
+	0x8EAC, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F88, 0x0000, 0x8ABE, 0x0000, 0x0000, 0x8998, 0x0000, 0xFAF6, 0x93F0, 0x9F87, 0x8D5D,
+	0x9272, 0x0000, 0x9F89, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F91, 0x0000, 0x9F8A, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAF8,
+	0x91BF, 0x0000, 0x8B82, 0x9F92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C88, 0x0000, 0x0000, 0x8B44, 0x9F90, 0x0000,
+	0x0000, 0x9F8E, 0x9F8B, 0x9780, 0x0000, 0x0000, 0xFAF7, 0x0000, 0x92BE, 0x0000, 0x0000, 0x0000, 0x93D7, 0x9F8C, 0x0000, 0x0000,
+	0x9F94, 0x0000, 0x9F93, 0x8C42, 0x0000, 0x0000, 0x89AB, 0x0000, 0x0000, 0x8DB9, 0x9F8D, 0x9F8F, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9676, 0x91F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9697, 0x0000, 0x0000, 0x9F9C, 0x0000,
+	0x0000, 0x9F9D, 0x0000, 0x89CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x95A6, 0x96FB, 0x9F9F, 0x8EA1, 0x8FC0, 0x9F98, 0x9F9E, 0x8988,
+	0x0000, 0x8BB5, 0x0000, 0x0000, 0x9F95, 0x9F9A, 0x0000, 0x0000, 0x0000, 0x90F2, 0x9491, 0x0000, 0x94E5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9F97, 0x0000, 0x9640, 0x0000, 0x9F99, 0x0000, 0x9FA2, 0xFAF9, 0x9FA0, 0x0000, 0x9F9B, 0x0000, 0x0000,
+	0x0000, 0x9641, 0x9467, 0x8B83, 0x0000, 0x9344, 0x0000, 0x0000, 0x928D, 0x0000, 0x9FA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FA1,
+	0x91D7, 0x9F96, 0x0000, 0x896A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFAFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x976D, 0x9FAE, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9FAD, 0x0000, 0x0000, 0x0000, 0x0000, 0x90F4, 0x0000, 0x9FAA, 0x0000, 0x978C, 0x0000, 0x0000, 0x93B4, 0x9FA4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92C3, 0x0000, 0x0000, 0x0000, 0x896B, 0x8D5E, 0x9FA7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8F46, 0x9FAC, 0x0000, 0x9FAB, 0x9FA6, 0x0000, 0x9FA9, 0x0000, 0x0000, 0x8A88, 0x0000, 0x9FA8, 0x9468, 0x0000,
+	0x0000, 0x97AC, 0x0000, 0x0000, 0x8FF2, 0x90F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FB4, 0x9FB2, 0x0000, 0x956C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9FAF, 0x9FB1, 0x0000, 0x8959, 0x0000, 0x0000, 0x8D5F, 0x9851, 0x0000, 0x8A5C, 0x0000, 0x9582, 0xFAFC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x9781, 0x0000, 0x0000, 0x8A43, 0x905A, 0x9FB3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FB8, 0x0000, 0xFAFB, 0x8FC1, 0x0000, 0x0000, 0x0000, 0x974F, 0x0000, 0x9FB5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9FB0, 0x0000, 0x9FB6, 0xFB40, 0x0000, 0x0000, 0x97DC, 0x0000, 0x9393, 0x93C0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB41, 0x0000, 0x0000, 0x8A55,
+	0x0000, 0x0000, 0x8974, 0x0000, 0x0000, 0x9FBC, 0x0000, 0x0000, 0x9FBF, 0x0000, 0x0000, 0x0000, 0x97C1, 0x0000, 0x0000, 0x0000,
+	0x9784, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FC6, 0x9FC0, 0x9FBD, 0x0000, 0x0000, 0x0000, 0x97D2, 0x9FC3, 0x0000, 0x0000, 0xFB42,
+	0x0000, 0x8F69, 0x9FC5, 0x0000, 0x0000, 0x9FCA, 0x0000, 0x0000, 0x9391, 0x9FC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FC2, 0x0000,
+	0x0000, 0x9257, 0x0000, 0x0000, 0x9FC9, 0x0000, 0x9FBE, 0x0000, 0x9FC4, 0x0000, 0x9FCB, 0x88FA, 0x9FC1, 0x0000, 0x9FCC, 0x0000,
+	0x0000, 0x905B, 0xFB44, 0x8F7E, 0x0000, 0x95A3, 0x0000, 0x8DAC, 0xFB43, 0x9FB9, 0x9FC7, 0x9359, 0xFB45, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90B4, 0x0000, 0x8A89, 0x8DCF, 0x8FC2, 0x9FBB, 0x8F61, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8C6B, 0x0000, 0x9FBA, 0x0000, 0x0000, 0x0000, 0x9FD0, 0x8F8D, 0x8CB8, 0x0000, 0x9FDF, 0x0000, 0x9FD9,
+	0x8B94, 0x936E, 0x0000, 0x9FD4, 0x9FDD, 0x88AD, 0x8951, 0xFB48, 0x0000, 0x89B7, 0x0000, 0x9FD6, 0x91AA, 0x9FCD, 0x9FCF, 0x8D60,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FE0, 0xFB46, 0x9FDB, 0x0000, 0xFB49, 0x0000, 0x9FD3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9FDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96A9, 0x0000, 0x0000, 0x9FD8, 0x9FDC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CCE, 0x0000, 0x8FC3, 0x0000, 0x0000, 0x9258, 0xFB47, 0x0000, 0x0000, 0x9FD2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x974E, 0x0000, 0x0000, 0x0000, 0x9FD5, 0x0000, 0x0000, 0x9FCE, 0x9392,
+	0x0000, 0x0000, 0x9FD1, 0x0000, 0x0000, 0x0000, 0x9FD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9870, 0x8EBC,
+	0x969E, 0x0000, 0x9FE1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94AC, 0x0000, 0x0000, 0x9FED,
+	0x8CB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F80, 0x0000, 0x9FE3, 0x0000, 0x0000, 0x0000, 0x97AD, 0x8D61, 0x0000, 0x9FF0,
+	0x0000, 0x0000, 0x88EC, 0x0000, 0x0000, 0x9FEE, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FE8,
+	0x0000, 0x0000, 0x9FEA, 0x0000, 0x0000, 0x0000, 0x976E, 0x9FE5, 0x0000, 0x0000, 0x934D, 0x0000, 0x0000, 0x9FE7, 0x0000, 0xFB4A,
+	0x0000, 0x0000, 0x9FEF, 0x0000, 0x9FE9, 0x96C5, 0x0000, 0x0000, 0x0000, 0x9FE4, 0x0000, 0x8EA0, 0x9FFC, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8A8A, 0x0000, 0x9FE6, 0x9FEB, 0x9FEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91EA, 0x91D8, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FF4, 0x0000, 0x0000, 0x9FFA,
+	0x0000, 0x0000, 0x9FF8, 0x0000, 0x9348, 0x0000, 0x0000, 0xE042, 0x9FF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FF6, 0x9FDE,
+	0x0000, 0x8B99, 0x9559, 0x0000, 0x0000, 0x0000, 0x8EBD, 0x0000, 0x0000, 0x8D97, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9852,
+	0x0000, 0x9FF2, 0x0000, 0xE041, 0x8989, 0x9186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9499, 0x0000, 0x8ABF, 0x97F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x969F, 0x92D0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9FF9, 0x9FFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9151, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE040, 0x9FF7,
+	0x0000, 0x9FF1, 0x0000, 0x0000, 0x0000, 0x8AC1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8C89, 0x0000, 0x0000, 0x0000, 0xE04E, 0x0000, 0x0000, 0xE049, 0x90F6, 0x0000, 0x0000, 0x8A83,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8F81, 0x0000, 0xE052, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE04B, 0x92AA, 0xE048,
+	0x92D7, 0x0000, 0x0000, 0x0000, 0xE06B, 0x0000, 0x0000, 0x0000, 0xE045, 0x0000, 0xE044, 0x0000, 0xE04D, 0x0000, 0x0000, 0x0000,
+	0xE047, 0xE046, 0xE04C, 0x0000, 0x909F, 0x0000, 0xE043, 0x0000, 0xFB4B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE04F, 0x0000,
+	0x0000, 0xE050, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE055, 0x0000, 0xE054, 0xE056, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE059, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9362, 0x0000, 0xE053, 0x0000, 0xFB4C, 0x0000, 0x0000, 0x0000, 0xE057, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8C83, 0x91F7, 0xE051, 0x945A, 0x0000, 0x0000, 0xE058, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE05D, 0xE05B, 0x0000, 0x0000, 0xE05E, 0x0000, 0x0000, 0xE061, 0x0000, 0x0000, 0x0000, 0xE05A,
+	0x8D8A, 0x9447, 0x0000, 0x0000, 0x9FB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9794, 0xE05C, 0x0000, 0xE060, 0x91F3,
+	0x0000, 0xE05F, 0x0000, 0xE04A, 0x0000, 0xFB4D, 0xE889, 0x0000, 0x0000, 0x0000, 0xE064, 0x0000, 0x0000, 0x0000, 0xE068, 0x0000,
+	0x0000, 0xE066, 0x0000, 0x0000, 0x0000, 0xFB4E, 0x0000, 0xFB4F, 0x0000, 0xE062, 0x0000, 0xE063, 0x0000, 0x0000, 0x0000, 0xE067,
+	0x0000, 0xE065, 0x0000, 0x0000, 0x0000, 0x956D, 0x0000, 0x0000, 0xE06D, 0x0000, 0xE06A, 0xE069, 0x0000, 0xE06C, 0x93D2, 0xE06E,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9295, 0x91EB, 0xFB50, 0x0000, 0x0000, 0x0000, 0x90A3, 0x0000, 0x0000, 0x0000,
+	0xE06F, 0x0000, 0xE071, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE070, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9FF3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x93E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE073, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89CE, 0x0000, 0x0000, 0x0000, 0x9394,
+	0x8A44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B84, 0x0000, 0x0000, 0x0000, 0x8EDC, 0x8DD0, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB51, 0x0000, 0x0000, 0x0000, 0x9846, 0x9086, 0x0000, 0x0000, 0x0000, 0x898A, 0x0000,
+	0x0000, 0x0000, 0xE075, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE074, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB52, 0xE078, 0x9259, 0xE07B, 0xE076,
+	0x0000, 0x0000, 0x0000, 0xE07A, 0x0000, 0x0000, 0x0000, 0x0000, 0xE079, 0x935F, 0x88D7, 0xFA62, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x97F3, 0x0000, 0x0000, 0xE07D, 0x0000, 0x0000, 0x0000, 0x8947,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE080, 0x0000, 0x0000, 0x0000, 0xE07E, 0x0000, 0xE07C,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE077, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9642, 0x0000, 0x0000, 0x0000, 0xE082, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFB54, 0x0000, 0x0000, 0x0000, 0x0000, 0xE081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB53,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x898B, 0x0000, 0x0000, 0x0000, 0x0000, 0xE084, 0x95B0, 0x0000, 0xE083, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x96B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FC5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9152, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FC4, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB56, 0xFB57, 0x0000, 0x97F9, 0x0000, 0x0000, 0xE08A, 0x0000, 0x90F7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE086, 0xE08B, 0x0000, 0x0000, 0x898C, 0x0000, 0x0000, 0xFB55, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE089, 0x0000, 0x9481, 0xE085, 0xE088, 0x8FC6, 0x0000, 0x94CF, 0x0000, 0x0000, 0xE08C, 0x0000, 0x8ECF, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90F8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE08F, 0x0000, 0x0000, 0x0000, 0xE087, 0x0000, 0x8C46, 0x0000, 0x0000, 0x0000, 0x0000, 0xE08D,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x976F, 0xE090, 0x0000, 0x0000, 0x0000, 0xEAA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F6E,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE091, 0x0000, 0x0000, 0x0000, 0xE092, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x944D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE094, 0x0000, 0x0000, 0x0000, 0x0000, 0xE095, 0x0000,
+	0x0000, 0xFB59, 0x0000, 0x9452, 0x0000, 0x0000, 0x0000, 0x0000, 0x9395, 0xE097, 0x0000, 0x0000, 0x0000, 0x0000, 0xE099, 0x0000,
+	0x97D3, 0x0000, 0xE096, 0x0000, 0xE098, 0x898D, 0x0000, 0xE093, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9A7A,
+	0xE09A, 0x0000, 0x0000, 0x0000, 0x0000, 0x9187, 0x8E57, 0xE09C, 0x0000, 0x0000, 0x0000, 0x0000, 0xE09B, 0x9043, 0x99D7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE09D, 0x0000, 0x0000, 0x0000, 0xE09F, 0x0000, 0xE08E, 0xE09E, 0x0000, 0xFB5A, 0xE0A0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x949A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0A1, 0x0000, 0x0000,
+	0xE0A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0A3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0A4, 0x0000, 0x92DC, 0x0000, 0xE0A6, 0xE0A5, 0x0000, 0x0000,
+	0xE0A7, 0x0000, 0xE0A8, 0x0000, 0x0000, 0x8EDD, 0x9583, 0x0000, 0x0000, 0x0000, 0x96EA, 0xE0A9, 0xE0AA, 0x9175, 0x8EA2, 0xE0AB,
+	0xE0AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AD, 0x95D0, 0x94C5, 0x0000, 0x0000, 0xE0AE, 0x9476, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x92AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0AF, 0x89E5, 0x0000, 0x8B8D, 0x0000, 0x96C4, 0x0000, 0x96B4,
+	0x0000, 0x89B2, 0x9853, 0x0000, 0x0000, 0x0000, 0x0000, 0x9671, 0x0000, 0x95A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x90B5, 0x0000, 0xE0B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x93C1, 0x0000, 0x0000, 0x0000, 0x8CA1, 0xE0B1, 0x0000,
+	0x8DD2, 0xE0B3, 0xE0B2, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE0B5, 0x0000, 0x0000, 0x0000, 0xE0B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8B5D, 0x0000, 0xE0B7, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CA2, 0x0000, 0x0000, 0x94C6,
+	0x0000, 0xFB5B, 0xE0BA, 0x0000, 0x0000, 0x0000, 0x8FF3, 0x0000, 0x0000, 0xE0B9, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB5C, 0x0000,
+	0x0000, 0x0000, 0x8BB6, 0xE0BB, 0xE0BD, 0x0000, 0xE0BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0BE, 0x0000,
+	0x8CCF, 0x0000, 0xE0BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BE7, 0x0000, 0x915F, 0x0000, 0x8D9D, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE0C1, 0xE0C2, 0xE0C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EEB, 0x0000, 0x0000, 0x93C6, 0x8BB7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0C4, 0x924B, 0xE0C3, 0x0000, 0x0000, 0x9854, 0x9482, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0C9, 0xE0C6, 0x0000, 0x0000, 0x0000, 0x96D2, 0xE0C8, 0xE0CA, 0x0000, 0x97C2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFB5D, 0xE0CE, 0x0000, 0x0000, 0x0000, 0xE0CD, 0x9296, 0x944C, 0x0000, 0x0000, 0x8CA3, 0xE0CC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE0CB, 0x0000, 0x9750, 0x9751, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0CF, 0x898E,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8D96, 0x8E82, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0D0, 0xE0D1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8F62, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0D5, 0x0000, 0xE0D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE0D6, 0x0000, 0x8A6C, 0x0000, 0x0000, 0xE0D8, 0x0000, 0xFB5F, 0xE0D7, 0x0000, 0xE0DA, 0xE0D9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8CBA, 0x0000, 0x0000, 0x97A6, 0x0000, 0x8BCA, 0x0000, 0x89A4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8ADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x97E6, 0xE0DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0DE, 0x0000, 0xFB60, 0x0000, 0x0000,
+	0xE0DF, 0x0000, 0x89CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0DB, 0xFB61, 0x8E58, 0x0000, 0x0000, 0x92BF, 0xE0DD, 0x0000,
+	0x0000, 0x0000, 0xFB64, 0x0000, 0x0000, 0x0000, 0xFB62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0E2, 0x0000,
+	0x8EEC, 0x0000, 0x0000, 0xFB63, 0x0000, 0xE0E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C5D, 0x0000, 0x0000, 0x94C7, 0xE0E1, 0x0000,
+	0x0000, 0xE0FC, 0x0000, 0x0000, 0x0000, 0xFB66, 0x0000, 0x0000, 0xE0E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CBB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8B85, 0x0000, 0xE0E4, 0x979D, 0xFB65, 0x0000, 0x97AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x91F4, 0x0000, 0x0000, 0xE0E6, 0xFB67, 0x0000, 0x0000, 0xFB69, 0xFB68, 0x0000, 0x0000, 0x0000, 0xFB6A, 0x0000,
+	0x0000, 0x0000, 0xE0E8, 0x97D4, 0x8BD5, 0x94FA, 0x9469, 0x0000, 0x0000, 0x0000, 0xE0E9, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0EB,
+	0x0000, 0xE0EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0EA, 0x0000, 0x0000, 0x0000, 0xE0ED, 0x8CE8, 0x896C, 0xE0EF, 0x0000, 0x9090, 0xE0EC,
+	0x97DA, 0x0000, 0xFB6B, 0xE0F2, 0xEAA2, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0F0, 0xE0F3, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0E5,
+	0xE0F1, 0x0000, 0x0000, 0x8DBA, 0x0000, 0x0000, 0xE0F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0F5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x979E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB6C, 0x0000, 0xE0F6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0F7, 0xFB6D,
+	0x0000, 0x0000, 0xE0E3, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8AC2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EA3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0F9, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0FA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE0FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x895A, 0x0000, 0x0000, 0x0000,
+	0xE140, 0x0000, 0x955A, 0xE141, 0x0000, 0x0000, 0x8AA2, 0xE142, 0x0000, 0xE143, 0x0000, 0x0000, 0x0000, 0x0000, 0xE144, 0x0000,
+	0xE146, 0xE147, 0xE145, 0x0000, 0x0000, 0x0000, 0x9572, 0xE149, 0xE148, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xFB6E, 0x0000, 0xE14B, 0xE14A, 0xE14C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE14D, 0xE14F, 0xE14E, 0x0000,
+	0x0000, 0x8D99, 0x0000, 0xE151, 0x0000, 0xE150, 0x0000, 0x0000, 0x8AC3, 0x0000, 0x9072, 0x0000, 0x935B, 0x0000, 0xE152, 0x90B6,
+	0x0000, 0x0000, 0x0000, 0x8E59, 0x0000, 0x8999, 0xE153, 0x0000, 0x9770, 0x0000, 0x0000, 0x95E1, 0xE154, 0x0000, 0x0000, 0xFAA8,
+	0x9363, 0x9752, 0x8D62, 0x905C, 0x0000, 0x0000, 0x0000, 0x926A, 0x99B2, 0x0000, 0x92AC, 0x89E6, 0xE155, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE156, 0x0000, 0xE15B, 0x0000, 0x0000, 0xE159, 0xE158, 0x9DC0, 0x8A45, 0xE157, 0x0000, 0x88D8,
+	0x0000, 0x94A8, 0x0000, 0x0000, 0x94C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x97AF, 0xE15C, 0xE15A, 0x927B, 0x90A4, 0x0000, 0x0000,
+	0x94A9, 0x0000, 0x954C, 0x0000, 0xE15E, 0x97AA, 0x8C6C, 0xE15F, 0x0000, 0xE15D, 0x94D4, 0xE160, 0x0000, 0xE161, 0x0000, 0xFB6F,
+	0x88D9, 0x0000, 0x0000, 0x8FF4, 0xE166, 0x0000, 0xE163, 0x93EB, 0xE162, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B45,
+	0x0000, 0x0000, 0xE169, 0x0000, 0x0000, 0x0000, 0xE164, 0xE165, 0x0000, 0xE168, 0xE167, 0x9544, 0x0000, 0x0000, 0x9161, 0x9160,
+	0x0000, 0x8B5E, 0x0000, 0x0000, 0xE16A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE16B, 0x0000, 0x0000, 0xE16C, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE16E, 0x0000, 0xE16D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8975, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE176, 0x94E6, 0xE170, 0x0000, 0xE172, 0x0000, 0x0000, 0xE174, 0x905D, 0x0000, 0x0000, 0xE175, 0xE173, 0x8EBE, 0x0000,
+	0x0000, 0x0000, 0xE16F, 0xE171, 0x0000, 0x9561, 0x0000, 0x8FC7, 0x0000, 0x0000, 0xE178, 0x0000, 0x0000, 0xE177, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE179, 0x0000, 0x8EA4, 0x8DAD, 0x0000, 0x0000, 0x9397, 0xE17A, 0x0000, 0x92C9, 0x0000, 0x0000, 0xE17C, 0x0000,
+	0x0000, 0x0000, 0x979F, 0xE17B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9189, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE182, 0x0000, 0xE184, 0xE185, 0x9273, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE183, 0x0000, 0xE180, 0x0000, 0xE17D, 0xE17E,
+	0x0000, 0xE181, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE188, 0x0000, 0xE186, 0x0000, 0xE187, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE189,
+	0xE18B, 0xE18C, 0xE18D, 0x0000, 0xE18E, 0x0000, 0x0000, 0xE18A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE190, 0x0000, 0x0000, 0x0000, 0xE18F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE191, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x97C3, 0x0000, 0x0000, 0x0000, 0xE194, 0xE192, 0xE193, 0x0000, 0x0000, 0x0000, 0x8AE0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x96FC, 0x0000, 0x0000, 0x0000, 0x95C8, 0x0000, 0xE196, 0x0000, 0x0000, 0x0000, 0xE195, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE197, 0xE198, 0x0000, 0x0000, 0x0000, 0x0000, 0xE19C, 0xE199, 0xE19A, 0xE19B, 0x0000, 0xE19D, 0x0000, 0x0000, 0x0000,
+	0xE19E, 0x0000, 0xE19F, 0x0000, 0x0000, 0x0000, 0xE1A0, 0x0000, 0xE1A1, 0x0000, 0x94AD, 0x936F, 0xE1A2, 0x9492, 0x9553, 0x0000,
+	0xE1A3, 0x0000, 0xFB70, 0xE1A4, 0x9349, 0x0000, 0x8A46, 0x8D63, 0xE1A5, 0x0000, 0x0000, 0xE1A6, 0x0000, 0x0000, 0xE1A7, 0x0000,
+	0x8E48, 0x0000, 0x0000, 0xE1A9, 0x0000, 0x0000, 0xE1A8, 0x0000, 0x0000, 0xE1AA, 0xE1AB, 0xFB73, 0xFB71, 0x0000, 0xFB72, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94E7, 0x0000,
+	0xE1AC, 0x0000, 0x0000, 0x0000, 0xE1AD, 0x0000, 0x0000, 0xEA89, 0xE1AE, 0xE1AF, 0xE1B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E4D,
+	0x0000, 0x0000, 0xE1B1, 0x9475, 0x0000, 0x0000, 0x967E, 0x0000, 0x896D, 0x0000, 0x8976, 0x0000, 0x0000, 0xE1B2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE1B4, 0x0000, 0x0000, 0x0000, 0xE1B3, 0x9390, 0x0000, 0x0000, 0x0000, 0x90B7, 0x9F58, 0x0000, 0xE1B5, 0x96BF,
+	0x0000, 0xE1B6, 0x0000, 0x8AC4, 0x94D5, 0xE1B7, 0x0000, 0xE1B8, 0x0000, 0x0000, 0xE1B9, 0x0000, 0x0000, 0x0000, 0x96DA, 0x0000,
+	0x0000, 0x0000, 0x96D3, 0x0000, 0x92BC, 0x0000, 0x0000, 0x0000, 0x918A, 0x0000, 0x0000, 0xE1BB, 0x0000, 0x0000, 0x8F82, 0x0000,
+	0x0000, 0x8FC8, 0x0000, 0x0000, 0xE1BE, 0x0000, 0x0000, 0xE1BD, 0xE1BC, 0x94FB, 0x0000, 0x8AC5, 0x8CA7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1C4, 0x0000, 0x0000, 0xE1C1, 0x905E,
+	0x96B0, 0x0000, 0x0000, 0x0000, 0xE1C0, 0xE1C2, 0xE1C3, 0x0000, 0x0000, 0xE1BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1C5, 0xE1C6, 0x0000, 0x92AD, 0x0000, 0x8AE1, 0x0000, 0x0000, 0x0000,
+	0x9285, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB76, 0xE1C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1C8, 0xE1CB, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9087, 0x0000, 0x93C2, 0x0000, 0xE1CC, 0x9672, 0x0000, 0xE1C9, 0x0000, 0x0000, 0xE1CA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1CF, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1CE, 0xE1CD,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1D1, 0x0000, 0x0000, 0xE1D0, 0x0000,
+	0x0000, 0xE1D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1D4, 0x0000,
+	0xE1D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x95CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F75, 0x97C4, 0x0000, 0x0000,
+	0xE1D5, 0x0000, 0x0000, 0x93B5, 0x0000, 0x0000, 0xE1D6, 0x0000, 0x0000, 0xE1D7, 0x0000, 0xE1DB, 0xE1D9, 0xE1DA, 0x0000, 0xE1D8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1DD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1DE, 0x0000, 0x0000, 0xE1DF, 0x96B5, 0xE1E0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x96EE, 0xE1E1, 0x0000, 0x926D, 0x0000, 0x948A, 0x0000, 0x8BE9, 0x0000, 0x0000, 0x0000, 0x925A, 0xE1E2, 0x8BB8,
+	0x0000, 0x0000, 0x0000, 0x90CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1E3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8DBB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1E4, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE1E5, 0x0000, 0x8CA4, 0x8DD3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE1E7, 0xFB78, 0x0000, 0x0000, 0x0000, 0x9375, 0x8DD4, 0x8B6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9643, 0x0000, 0x946A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9376, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D7B,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB79, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FC9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFB7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x97B0, 0x8D64, 0x0000, 0x0000, 0x8CA5,
+	0x0000, 0x0000, 0x94A1, 0x0000, 0xE1EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB7B, 0x0000, 0xE1ED, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8CE9, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1EC, 0x92F4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1EF, 0x8A56, 0xE1EA, 0x0000,
+	0x0000, 0x94E8, 0x0000, 0x894F, 0x0000, 0x8DEA, 0x0000, 0x9871, 0x0000, 0x0000, 0xE1EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE1F0, 0x0000, 0x0000, 0x0000, 0x95C9, 0x0000, 0x90D7, 0xE1F2, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1F3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A6D, 0x0000, 0xE1F9, 0x0000, 0xE1F8, 0x0000,
+	0x0000, 0x8EA5, 0x0000, 0x0000, 0x0000, 0xE1FA, 0xE1F5, 0x0000, 0x0000, 0x0000, 0xE1FB, 0xE1F6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x94D6, 0xE1F4, 0x0000, 0x0000, 0xE1F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE240, 0x9681, 0x0000, 0x0000, 0x0000, 0xE1FC, 0x0000, 0x0000, 0x88E9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE243, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE242, 0x0000, 0x0000,
+	0x0000, 0x8FCA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE244, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9162, 0x0000,
+	0x0000, 0xE246, 0xE245, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE247, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1E6, 0x0000, 0x0000, 0x0000, 0xE1E8, 0xE249, 0xE248, 0x0000, 0x0000, 0x0000,
+	0xFB7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EA6, 0x0000, 0x97E7, 0x0000, 0x8ED0, 0x0000,
+	0xE24A, 0x8C56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B5F, 0x8B46, 0x8E83, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9753, 0x0000, 0x0000, 0xE250, 0x0000, 0xE24F, 0x9163, 0xE24C, 0x0000, 0x0000, 0xE24E, 0x0000, 0x0000, 0x8F6A, 0x905F, 0xE24D,
+	0xE24B, 0x0000, 0x9449, 0x0000, 0x0000, 0x8FCB, 0x0000, 0x0000, 0x955B, 0x0000, 0x0000, 0x0000, 0x0000, 0x8DD5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9398, 0x0000, 0x0000, 0xE251, 0x0000, 0x0000, 0x0000, 0x0000, 0xE252,
+	0xE268, 0x8BD6, 0x0000, 0x0000, 0x985C, 0x9154, 0x0000, 0x0000, 0x0000, 0x0000, 0xE253, 0x0000, 0x0000, 0x89D0, 0x92F5, 0x959F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFB81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB83, 0x0000, 0xE254, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B9A, 0xE255, 0x0000, 0x0000, 0xE257, 0x0000, 0x0000, 0x0000, 0xE258, 0x0000,
+	0x9448, 0x0000, 0x0000, 0xE259, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE25A, 0xE25B, 0x0000, 0x0000, 0x8BD7, 0x89D1, 0x93C3,
+	0x8F47, 0x8E84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE25C, 0x0000, 0x8F48, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x89C8, 0x9562, 0x0000, 0x0000, 0xE25D, 0x0000, 0x0000, 0x94E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9164,
+	0x0000, 0xE260, 0x0000, 0xE261, 0x9489, 0x0000, 0x9060, 0xE25E, 0x0000, 0x9281, 0x0000, 0x0000, 0xE25F, 0x0000, 0x0000, 0x0000,
+	0x8FCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x88DA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8B48, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE262, 0x0000, 0x0000, 0x92F6, 0x0000, 0xE263, 0x90C5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x96AB, 0x0000, 0x0000, 0x9542, 0xE264, 0xE265, 0x9274, 0x0000, 0x97C5, 0x0000, 0x0000, 0xE267,
+	0xE266, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EED, 0x0000,
+	0x0000, 0xE269, 0x88EE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE26C, 0x0000, 0x0000, 0x0000, 0xE26A, 0x89D2, 0x8C6D, 0xE26B, 0x8D65,
+	0x8D92, 0x0000, 0x95E4, 0xE26D, 0x0000, 0x0000, 0x9673, 0x0000, 0x0000, 0xE26F, 0x0000, 0x0000, 0x0000, 0x90CF, 0x896E, 0x89B8,
+	0x88AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE26E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE270, 0xE271, 0x8FF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE272, 0x0000, 0x8A6E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE274, 0x0000, 0x0000, 0x0000, 0x8C8A, 0x0000, 0x8B86, 0x0000, 0x0000, 0xE275, 0x8BF3, 0x0000, 0x0000, 0xE276, 0x0000, 0x90FA,
+	0x0000, 0x93CB, 0x0000, 0x90DE, 0x8DF3, 0x0000, 0x0000, 0x0000, 0xE277, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9282, 0x918B, 0x0000, 0xE279, 0xE27B, 0xE278, 0xE27A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C41,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE27C, 0x8C45, 0x0000, 0x0000, 0x0000, 0x8B87, 0x9771,
+	0xE27E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE280, 0x0000, 0x0000, 0x0000, 0x894D, 0x0000, 0x0000, 0x0000, 0x0000, 0xE283,
+	0x0000, 0x0000, 0x0000, 0x8A96, 0xE282, 0xE281, 0x0000, 0xE285, 0xE27D, 0x0000, 0xE286, 0x97A7, 0x0000, 0xE287, 0x0000, 0xE288,
+	0x0000, 0xFB84, 0x9AF2, 0xE28A, 0x0000, 0xE289, 0x0000, 0x0000, 0x0000, 0xE28B, 0xE28C, 0x0000, 0x97B3, 0xE28D, 0x0000, 0xE8ED,
+	0x8FCD, 0xE28E, 0xE28F, 0x8F76, 0x0000, 0x93B6, 0xE290, 0xFB85, 0x0000, 0x0000, 0x9247, 0xFB87, 0x0000, 0xE291, 0x0000, 0x925B,
+	0xE292, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BA3, 0x0000, 0x995E, 0x927C, 0x8EB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AC6,
+	0x0000, 0x0000, 0xE293, 0x0000, 0xE2A0, 0x0000, 0xE296, 0x0000, 0x8B88, 0x0000, 0xE295, 0xE2A2, 0x0000, 0x0000, 0x0000, 0xE294,
+	0x0000, 0x8FCE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE298, 0xE299, 0x0000, 0x934A, 0x0000, 0x0000, 0xE29A, 0x0000,
+	0x8A7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x9079, 0x9584, 0x0000, 0xE29C, 0x0000, 0x0000, 0x0000, 0x91E6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE297, 0x0000, 0xE29B, 0xE29D, 0x0000, 0x0000, 0x8DF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2A4, 0x954D, 0x0000, 0x94A4, 0x9399, 0x0000, 0x8BD8, 0xE2A3, 0xE2A1, 0x0000, 0x94B3,
+	0xE29E, 0x927D, 0x939B, 0x0000, 0x939A, 0x0000, 0x8DF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2B6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2A6, 0x0000, 0xE2A8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2AB, 0x0000, 0xE2AC, 0x0000,
+	0xE2A9, 0xE2AA, 0x0000, 0x0000, 0xE2A7, 0xE2A5, 0x0000, 0x0000, 0x0000, 0x0000, 0xE29F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95CD, 0x89D3, 0x0000, 0x0000, 0x0000, 0xE2B3, 0x0000, 0xE2B0, 0x0000, 0xE2B5,
+	0x0000, 0x0000, 0xE2B4, 0x0000, 0x9493, 0x96A5, 0x0000, 0x8E5A, 0xE2AE, 0xE2B7, 0xE2B2, 0x0000, 0xE2B1, 0xE2AD, 0xFB88, 0xE2AF,
+	0x0000, 0x8AC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x925C, 0x0000, 0x0000, 0x90FB, 0x0000, 0x0000,
+	0x0000, 0x94A0, 0x0000, 0x0000, 0xE2BC, 0x0000, 0x0000, 0x0000, 0x94A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x90DF, 0xE2B9, 0x0000, 0x0000, 0x94CD, 0x0000, 0xE2BD, 0x95D1, 0x0000, 0x927A, 0x0000, 0xE2B8, 0xE2BA, 0x0000, 0x0000, 0xE2BB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2BE, 0x0000, 0x0000,
+	0x8EC2, 0x0000, 0x0000, 0x0000, 0x93C4, 0xE2C3, 0xE2C2, 0x0000, 0x0000, 0xE2BF, 0x0000, 0x0000, 0x0000, 0x9855, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE2C8, 0x0000, 0x0000, 0xE2CC, 0xE2C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE2C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2CB, 0x0000, 0x0000,
+	0x0000, 0xE2C0, 0x99D3, 0xE2C7, 0xE2C1, 0x0000, 0x0000, 0xE2CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2D0,
+	0x0000, 0x8AC8, 0x0000, 0xE2CD, 0x0000, 0x0000, 0x0000, 0xE2CE, 0x0000, 0x0000, 0xE2CF, 0xE2D2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2D1, 0x94F4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2D3, 0x97FA, 0x95EB,
+	0xE2D8, 0x0000, 0x0000, 0xE2D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2D4, 0x90D0, 0x0000, 0xE2D7,
+	0xE2D9, 0x0000, 0x0000, 0x0000, 0xE2D6, 0x0000, 0xE2DD, 0x0000, 0xE2DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2DB,
+	0xE2C4, 0x0000, 0x0000, 0x0000, 0xE2DC, 0xE2DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2DF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x95C4, 0x0000, 0xE2E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96E0, 0x0000,
+	0x0000, 0x8BCC, 0x8C48, 0xE2E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95B2, 0x0000, 0x9088, 0x0000, 0x96AE, 0x0000, 0x0000,
+	0xE2E2, 0x0000, 0x97B1, 0x0000, 0x0000, 0x9494, 0x0000, 0x9165, 0x9453, 0x0000, 0x0000, 0x8F6C, 0x0000, 0x0000, 0x0000, 0x88BE,
+	0x0000, 0xE2E7, 0xE2E5, 0x0000, 0xE2E3, 0x8A9F, 0x0000, 0x8FCF, 0xE2E8, 0x0000, 0x0000, 0xE2E6, 0x0000, 0xE2E4, 0xE2EC, 0x0000,
+	0x0000, 0xE2EB, 0xE2EA, 0xE2E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2ED, 0x0000, 0x0000, 0x0000, 0xE2EE, 0x90B8, 0x0000,
+	0xE2EF, 0x0000, 0xE2F1, 0x0000, 0x0000, 0xE2F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CD0, 0x0000, 0x0000, 0x0000, 0x9157, 0x0000,
+	0x0000, 0x0000, 0xE2F3, 0x0000, 0x0000, 0x0000, 0x939C, 0x0000, 0xE2F2, 0x0000, 0x0000, 0x0000, 0xE2F4, 0x0000, 0x95B3, 0x918C,
+	0x8D66, 0x0000, 0xE2F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x97C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2F7,
+	0x0000, 0x0000, 0xE2F8, 0x0000, 0xE2F9, 0x0000, 0xE2FA, 0x0000, 0x8E85, 0x0000, 0xE2FB, 0x8C6E, 0x0000, 0x0000, 0x8B8A, 0x0000,
+	0x8B49, 0x0000, 0xE340, 0x0000, 0x96F1, 0x8D67, 0xE2FC, 0x0000, 0x0000, 0x0000, 0xE343, 0x96E4, 0x0000, 0x945B, 0x0000, 0x0000,
+	0x9552, 0x0000, 0x0000, 0x0000, 0x8F83, 0xE342, 0x0000, 0x8ED1, 0x8D68, 0x8E86, 0x8B89, 0x95B4, 0xE341, 0x0000, 0x0000, 0x0000,
+	0x9166, 0x9661, 0x8DF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E87, 0x92DB, 0x0000, 0xE346, 0x97DD,
+	0x8DD7, 0x0000, 0xE347, 0x9061, 0x0000, 0xE349, 0x0000, 0x0000, 0x0000, 0x8FD0, 0x8DAE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE348,
+	0x0000, 0x0000, 0x8F49, 0x8CBC, 0x9167, 0xE344, 0xE34A, 0x0000, 0xFB8A, 0x0000, 0x0000, 0xE345, 0x8C6F, 0x0000, 0xE34D, 0xE351,
+	0x8C8B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE34C, 0x0000, 0x0000, 0x0000, 0x0000, 0xE355, 0xFB8B, 0x0000, 0x8D69, 0x0000,
+	0x0000, 0x978D, 0x88BA, 0xE352, 0x0000, 0x0000, 0x8B8B, 0x0000, 0xE34F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE350, 0x0000,
+	0x0000, 0x939D, 0xE34E, 0xE34B, 0x0000, 0x8A47, 0x90E2, 0x0000, 0x0000, 0x8CA6, 0x0000, 0x0000, 0x0000, 0xE357, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE354, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE356,
+	0x0000, 0x0000, 0x0000, 0xE353, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C70, 0x91B1, 0xE358, 0x918E, 0x0000, 0x0000, 0xE365,
+	0xFB8D, 0x0000, 0xE361, 0xE35B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE35F, 0x8EF8, 0x88DB, 0xE35A, 0xE362,
+	0xE366, 0x8D6A, 0x96D4, 0x0000, 0x92D4, 0xE35C, 0x0000, 0xFB8C, 0xE364, 0x0000, 0xE359, 0x925D, 0x0000, 0xE35E, 0x88BB, 0x96C8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE35D, 0x0000, 0x0000, 0x8BD9, 0x94EA, 0x0000, 0x0000, 0x0000, 0x918D,
+	0x0000, 0x97CE, 0x8F8F, 0x0000, 0x0000, 0xE38E, 0xFB8E, 0x0000, 0xE367, 0x0000, 0x90FC, 0x0000, 0xE363, 0xE368, 0xE36A, 0x0000,
+	0x92F7, 0xE36D, 0x0000, 0x0000, 0xE369, 0x0000, 0x0000, 0x0000, 0x95D2, 0x8AC9, 0x0000, 0x0000, 0x96C9, 0x0000, 0x0000, 0x88DC,
+	0x0000, 0x0000, 0xE36C, 0x0000, 0x97FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE36B, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x898F, 0x0000, 0x0000, 0x93EA, 0xE36E, 0x0000, 0x0000, 0x0000, 0xE375, 0xE36F, 0xE376, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE372, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x949B, 0x0000, 0x0000, 0x8EC8, 0xE374,
+	0x0000, 0xE371, 0xE377, 0xE370, 0x0000, 0x0000, 0x8F63, 0x0000, 0x0000, 0x0000, 0x0000, 0x9644, 0x0000, 0x0000, 0x8F6B, 0x0000,
+	0x0000, 0xE373, 0xE380, 0x0000, 0x0000, 0xE37B, 0x0000, 0xE37E, 0x0000, 0xE37C, 0xE381, 0xE37A, 0x0000, 0xE360, 0x90D1, 0x0000,
+	0x0000, 0x94C9, 0x0000, 0xE37D, 0x0000, 0x0000, 0xE378, 0x0000, 0x0000, 0x0000, 0x9140, 0x8C71, 0x0000, 0x8F4A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFB8F, 0x0000, 0x9044, 0x9155, 0xE384, 0x0000, 0x0000, 0xE386, 0xE387, 0x0000, 0x0000, 0xE383, 0xE385, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE379, 0xE382, 0x0000, 0xE38A, 0xE389, 0x0000, 0x0000, 0x969A, 0x0000, 0x0000,
+	0x8C4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE388, 0x0000, 0xE38C, 0xE38B, 0xE38F, 0x0000, 0xE391,
+	0x0000, 0x0000, 0x8E5B, 0xE38D, 0x0000, 0x0000, 0x0000, 0x0000, 0xE392, 0xE393, 0xFA5C, 0x0000, 0xE394, 0x0000, 0xE39A, 0x935A,
+	0xE396, 0x0000, 0xE395, 0xE397, 0xE398, 0x0000, 0xE399, 0x0000, 0x0000, 0x0000, 0x0000, 0xE39B, 0xE39C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8ACA, 0x0000, 0xE39D, 0x0000, 0xE39E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE39F, 0x0000, 0xFB90, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3A0, 0xE3A1, 0xE3A2, 0x0000,
+	0xE3A3, 0xE3A4, 0x0000, 0x0000, 0xE3A6, 0xE3A5, 0x0000, 0x0000, 0xE3A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3A8,
+	0xE3A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3AC, 0xE3AA, 0xE3AB, 0x8DDF, 0x8C72, 0x0000, 0x0000, 0x9275, 0x0000,
+	0x94B1, 0x0000, 0x8F90, 0x0000, 0x0000, 0x946C, 0x0000, 0x94EB, 0xE3AD, 0x9CEB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE3AE, 0xE3B0, 0x0000, 0x9785, 0xE3AF, 0xE3B2, 0xE3B1, 0x0000, 0x9772, 0x0000, 0xE3B3, 0x0000, 0x94FC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE3B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3B7, 0x0000, 0x0000, 0xE3B6, 0xE3B5, 0x0000,
+	0x0000, 0xFB91, 0x0000, 0xE3B8, 0x8C51, 0x0000, 0x0000, 0x0000, 0x9141, 0x8B60, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3BC, 0xE3B9,
+	0x0000, 0x0000, 0xE3BA, 0x0000, 0x0000, 0x0000, 0xE3BD, 0x0000, 0xE3BE, 0xE3BB, 0x0000, 0x0000, 0x0000, 0x8948, 0x0000, 0x0000,
+	0x0000, 0x89A5, 0x0000, 0x0000, 0x0000, 0xE3C0, 0xE3C1, 0x0000, 0x0000, 0x0000, 0xE3C2, 0x0000, 0x9782, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8F4B, 0x0000, 0xE3C4, 0xE3C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9089, 0xE3C5, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3C6, 0x0000, 0x0000, 0xE3C7, 0x0000, 0x8AE3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8ACB, 0x0000, 0x0000, 0xE3C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3C9, 0x0000, 0x967C, 0x9783, 0x0000, 0x0000, 0x0000,
+	0x9773, 0x9856, 0x0000, 0x8D6C, 0xE3CC, 0x8ED2, 0xE3CB, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3CD, 0x8EA7, 0x0000, 0x0000, 0x0000,
+	0x91CF, 0x0000, 0xE3CE, 0x0000, 0x0000, 0x8D6B, 0x0000, 0x96D5, 0xE3CF, 0xE3D0, 0x0000, 0x0000, 0xE3D1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE3D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8EA8, 0x0000, 0x0000, 0x96EB, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3D5, 0x0000, 0x925E, 0x0000, 0xE3D4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3D7, 0x0000, 0x0000, 0x0000, 0xE3D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE3D8, 0x0000, 0x0000, 0x0000, 0x90B9, 0x0000, 0xE3D9, 0x0000, 0xE3DA, 0x0000, 0x0000, 0x0000, 0x95B7, 0xE3DB,
+	0x0000, 0x918F, 0xE3DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x97FC,
+	0xE3E0, 0x0000, 0xE3DF, 0xE3DE, 0x92AE, 0x0000, 0xE3E1, 0x9045, 0x0000, 0xE3E2, 0x0000, 0x0000, 0x0000, 0xE3E3, 0x9857, 0xE3E4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE3E5, 0xE3E7, 0xE3E6, 0x94A3, 0x0000, 0x93F7, 0x0000, 0x985D, 0x94A7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE3E9, 0x0000, 0x0000, 0x8FD1, 0x0000, 0x9549, 0x0000, 0xE3EA, 0xE3E8, 0x0000, 0x8ACC, 0x0000, 0x0000,
+	0x0000, 0x8CD2, 0x8E88, 0x0000, 0x0000, 0x94EC, 0x0000, 0x0000, 0x0000, 0x8CA8, 0x9662, 0x0000, 0xE3ED, 0xE3EB, 0x0000, 0x8D6D,
+	0x0000, 0x8D6E, 0x88E7, 0x0000, 0x8DE6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9478, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x88DD, 0xE3F2, 0x0000, 0x925F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9477, 0x0000, 0x91D9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3F4, 0x0000, 0x0000, 0xE3F0, 0xE3F3, 0xE3EE, 0x0000, 0xE3F1, 0x9645, 0x0000,
+	0x0000, 0x8CD3, 0x0000, 0x0000, 0x88FB, 0xE3EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3F6,
+	0x0000, 0xE3F7, 0x0000, 0x0000, 0x93B7, 0x0000, 0x0000, 0x0000, 0x8BB9, 0x0000, 0x0000, 0x0000, 0xE445, 0x945C, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8E89, 0x0000, 0x0000, 0x8BBA, 0x90C6, 0x9865, 0x96AC, 0xE3F5, 0x90D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B72, 0xE3F8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE3FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3FB,
+	0x0000, 0x9245, 0x0000, 0x945D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92AF, 0x0000, 0x0000, 0x0000, 0x0000, 0xE442, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE441, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3FC, 0x0000, 0x0000, 0x9074, 0x0000,
+	0x9585, 0xE444, 0x0000, 0xE443, 0x8D6F, 0x9872, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE454,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE448, 0xE449, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EEE, 0x0000, 0x0000, 0xE447, 0x0000,
+	0x8D98, 0xE446, 0x0000, 0x0000, 0xE44A, 0x0000, 0x0000, 0x0000, 0x92B0, 0x95A0, 0x9142, 0x0000, 0x0000, 0x0000, 0x0000, 0x91DA,
+	0xE44E, 0x0000, 0xE44F, 0xE44B, 0x0000, 0x0000, 0x0000, 0x0000, 0xE44C, 0x0000, 0xE44D, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D70,
+	0x0000, 0x0000, 0x0000, 0xE455, 0x0000, 0xE451, 0x0000, 0x0000, 0x0000, 0x0000, 0x9586, 0x0000, 0x968C, 0x9547, 0x0000, 0x0000,
+	0xE450, 0x0000, 0x0000, 0xE453, 0xE452, 0x0000, 0x0000, 0x0000, 0x9663, 0xE456, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE457, 0x0000, 0x0000, 0x9156, 0x0000, 0xE458, 0x0000, 0x0000, 0xE45A, 0x0000, 0xE45E, 0x0000, 0x0000, 0xE45B, 0xE459, 0x945E,
+	0xE45C, 0x0000, 0xE45D, 0x0000, 0x0000, 0x0000, 0x89B0, 0x0000, 0xE464, 0xE45F, 0x0000, 0x0000, 0x0000, 0xE460, 0x0000, 0x0000,
+	0x0000, 0xE461, 0x0000, 0x919F, 0x0000, 0x0000, 0x0000, 0x0000, 0xE463, 0xE462, 0xE465, 0x0000, 0x0000, 0x0000, 0x0000, 0xE466,
+	0xE467, 0x0000, 0x0000, 0x9062, 0x0000, 0x89E7, 0x0000, 0xE468, 0x97D5, 0x0000, 0x8EA9, 0x0000, 0x0000, 0x8F4C, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8E8A, 0x9276, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE469, 0xE46A, 0x8950, 0x0000, 0xE46B, 0x0000,
+	0x0000, 0xE46C, 0xE46D, 0x0000, 0x0000, 0xE46E, 0x0000, 0xE46F, 0x8BBB, 0x9DA8, 0xE470, 0x0000, 0x90E3, 0xE471, 0x8EC9, 0x0000,
+	0xE472, 0x0000, 0x98AE, 0x0000, 0x0000, 0x0000, 0xE473, 0x95DC, 0x8ADA, 0x0000, 0x0000, 0x9143, 0x8F77, 0x0000, 0x9591, 0x8F4D,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE474, 0x8D71, 0xE475, 0x94CA, 0x0000, 0xE484, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE477, 0x0000, 0x91C7, 0x9495, 0x8CBD, 0xE476, 0x9144, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE478, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE47A, 0xE479, 0xE47C, 0x0000, 0x0000, 0xE47B, 0x0000, 0xE47D,
+	0x0000, 0x0000, 0xE480, 0x0000, 0xE47E, 0x0000, 0x8ACD, 0x0000, 0xE481, 0x0000, 0xE482, 0xE483, 0x0000, 0x0000, 0x8DAF, 0x97C7,
+	0x0000, 0xE485, 0x9046, 0x0000, 0x0000, 0x0000, 0x8990, 0xE486, 0xE487, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE488, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x88F0, 0x0000, 0xE489, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE48A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9587, 0x0000, 0x0000, 0x0000, 0x8EC5, 0x0000, 0xE48C,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A48, 0x88B0, 0x0000, 0x0000, 0x0000, 0x0000, 0xE48B, 0xE48E, 0x946D, 0x0000, 0x9063,
+	0x0000, 0x89D4, 0x0000, 0x9646, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C7C, 0x8BDA, 0x0000, 0xE48D, 0x0000, 0x89E8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8AA1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8991, 0xE492, 0x97E8, 0x91DB, 0x0000, 0x0000, 0x9563, 0x0000, 0xE49E, 0x0000, 0x89D5, 0xE49C, 0x0000, 0xE49A, 0xE491,
+	0x0000, 0xE48F, 0x0000, 0xE490, 0x0000, 0x8EE1, 0x8BEA, 0x9297, 0x0000, 0x0000, 0x0000, 0x93CF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8970, 0x0000, 0xE494, 0xE493, 0x0000, 0x0000, 0x0000, 0x0000, 0xE499, 0xE495, 0xE498, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xFB93, 0x96CE, 0xE497, 0x89D6, 0x8A9D, 0xE49B, 0x0000, 0x0000, 0xE49D, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C73, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4A1, 0xE4AA, 0xE4AB, 0x0000, 0x0000, 0x0000, 0x88A9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE4B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x88EF, 0x0000, 0x0000, 0xE4A9, 0x0000, 0x0000, 0x0000, 0xE4A8,
+	0x0000, 0xE4A3, 0xE4A2, 0x0000, 0xE4A0, 0xE49F, 0x9283, 0x0000, 0x91F9, 0xE4A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE4A4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4A7, 0x0000, 0x0000, 0x0000, 0x9190, 0x8C74, 0x0000, 0x0000, 0x0000, 0x0000, 0x8960,
+	0xE4A6, 0x0000, 0x8D72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9191, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFB94, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE4B8, 0x0000, 0xE4B9, 0x0000, 0x89D7, 0x0000, 0x0000, 0x0000, 0x89AC, 0xE4B6, 0x0000, 0x0000, 0xFB95,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4AC, 0x0000, 0xE4B4, 0x0000, 0xE4BB, 0xE4B5, 0x0000, 0x0000, 0x0000, 0xE4B3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE496, 0x0000, 0x0000, 0xE4B1, 0x0000, 0x0000, 0x0000, 0xE4AD, 0x0000, 0x0000, 0x0000, 0x8ACE, 0xE4AF,
+	0xE4BA, 0x0000, 0xE4B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4BC, 0x0000, 0xE4AE, 0x949C, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9789, 0x0000, 0x0000, 0x0000, 0xE4B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4CD, 0x0000, 0x0000,
+	0x0000, 0xE4C5, 0x0000, 0x0000, 0x0000, 0x909B, 0x0000, 0xFB96, 0x0000, 0x0000, 0x8B65, 0x0000, 0x8BDB, 0x0000, 0xE4C0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x89D9, 0x0000, 0x0000, 0x8FD2, 0x0000, 0xE4C3, 0x0000, 0x0000, 0x0000, 0x8DD8, 0x0000, 0x0000, 0x9370,
+	0xE4C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95EC, 0x0000, 0xE4BF, 0x0000, 0x0000, 0x0000, 0x89D8,
+	0x8CD4, 0x9548, 0xE4C9, 0x0000, 0xE4BD, 0x0000, 0xFB97, 0xE4C6, 0x0000, 0x0000, 0x0000, 0xE4D0, 0x0000, 0xE4C1, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE4C2, 0x93B8, 0x0000, 0x0000, 0xE4C7, 0x0000, 0x0000, 0x0000, 0xE4C4, 0x9647, 0xE4CA, 0x88DE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE4BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE4CC, 0x0000, 0xE4CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x948B, 0xE4D2, 0x0000, 0xE4DD, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8A9E, 0x0000, 0x0000, 0x0000, 0xE4E0, 0x0000, 0x0000, 0xE4CE, 0x0000, 0x0000, 0x0000, 0xE4D3, 0x978E, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4DC, 0x0000, 0xFB98, 0x9774, 0x0000, 0x0000, 0x0000, 0x0000, 0x97A8, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9298, 0x0000, 0x0000, 0x0000, 0x8A8B, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x9592, 0xE4E2, 0x939F, 0x0000, 0x0000, 0x88AF, 0x0000, 0x0000, 0xE4DB, 0x0000, 0xE4D7, 0x9192, 0xE4D1, 0xE4D9, 0xE4DE,
+	0x0000, 0x944B, 0x0000, 0x0000, 0x0000, 0x88A8, 0x0000, 0xE4D6, 0x0000, 0xE4DF, 0x9598, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE4DA, 0x0000, 0xE4D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FD3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8F4E, 0x0000, 0x0000, 0x0000, 0x8EAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x96D6, 0x0000, 0x0000, 0x9566, 0x0000, 0x0000, 0xE4E5,
+	0x0000, 0xE4EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4D8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8A97, 0x0000, 0xFB99, 0x0000, 0x0000, 0x0000, 0x8FF6, 0xE4E3, 0x0000, 0xE4E8, 0x9193, 0x0000, 0x0000, 0xE4E4,
+	0x0000, 0xE4EB, 0x0000, 0x0000, 0x927E, 0x0000, 0xE4EC, 0x0000, 0x0000, 0x9775, 0xE4E1, 0x8A57, 0x0000, 0xE4E7, 0x0000, 0x0000,
+	0xE4EA, 0x96AA, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4ED, 0x0000, 0x0000, 0xE4E6, 0xE4E9, 0x0000, 0xFA60, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9648, 0x0000, 0x9840, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE4F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4F8, 0x0000, 0x0000, 0xE4F0,
+	0x8EC1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x95CC, 0x0000, 0x96A0, 0xE4F7, 0xE4F6, 0x0000, 0xE4F2, 0xE4F3, 0x0000, 0x8955, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4F5,
+	0x0000, 0xE4EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x92D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4F4, 0x88FC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95C1, 0x0000, 0x0000,
+	0xE4F9, 0xE540, 0x0000, 0x94D7, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4FC, 0x8FD4, 0x8EC7, 0xE542, 0x0000, 0x0000, 0x8BBC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFB9A, 0x0000, 0xE543, 0x0000, 0x9599, 0xE4FB, 0xFB9B, 0xE4D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE4FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x986E, 0x93A0, 0x9593, 0xFB9C, 0x0000, 0xE54A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE550, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE551, 0x0000,
+	0xE544, 0x0000, 0x0000, 0x0000, 0x9496, 0x0000, 0x0000, 0xE54E, 0xE546, 0x0000, 0xE548, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE552, 0xE547, 0x0000, 0x0000, 0xE54B, 0x0000, 0x0000, 0x8992, 0x0000, 0x93E3, 0x0000, 0xE54C, 0xE54F, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE545, 0x0000, 0x9145, 0x0000, 0xE549, 0x8E46, 0x9064, 0x8C4F, 0x96F2, 0x0000, 0x96F7, 0x8F92,
+	0xFB9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE556, 0xE554, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x986D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE553, 0x0000, 0x0000, 0x0000, 0x9795, 0x0000, 0xE555,
+	0xE557, 0x0000, 0x0000, 0x0000, 0x0000, 0xE558, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE55B, 0xE559, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x93A1, 0xE55A, 0x0000, 0x0000, 0x0000, 0x94CB, 0xE54D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F93, 0x0000, 0xE55C, 0xE561, 0x9194, 0x0000, 0x0000, 0xE560, 0x0000,
+	0x0000, 0x0000, 0xE541, 0x0000, 0x0000, 0x0000, 0xE562, 0x9168, 0x0000, 0x0000, 0xE55D, 0xE55F, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE55E, 0x0000, 0x0000, 0x9F50, 0x9F41, 0x0000, 0x0000, 0xE564, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE563, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9796, 0x0000, 0xE1BA,
+	0xE565, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE566,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE567, 0x8CD5, 0x0000,
+	0x8B73, 0x0000, 0x0000, 0x0000, 0xE569, 0x997C, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B95, 0x0000, 0x97B8, 0x0000, 0x8BF1, 0xE56A,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE56B, 0x0000, 0x0000, 0x0000, 0x928E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE56C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x93F8, 0x0000, 0x88B8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89E1, 0xE571, 0xE572, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE56D, 0x0000, 0x8E5C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE56E, 0x9461, 0x0000, 0x0000, 0x0000, 0x0000, 0xE56F, 0xE570, 0xE57A, 0x0000, 0x0000, 0x0000, 0xE574,
+	0xE577, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE573, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE575, 0x0000, 0xE576, 0x8ED6, 0x0000, 0xE578, 0x0000, 0x9260, 0x0000, 0x8C75, 0x8A61, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE57B, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A5E, 0x0000, 0xE581, 0x0000, 0x0000, 0xE57C, 0xE580,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x94B8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE57D, 0x0000, 0x0000, 0xE57E, 0x9567, 0x94D8, 0xE582,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91FB, 0xE58C, 0x0000, 0xE588, 0x0000, 0x0000, 0x89E9, 0x0000,
+	0xE586, 0x0000, 0x9649, 0xE587, 0x0000, 0x0000, 0xE584, 0x0000, 0xE585, 0xE58A, 0xE58D, 0x0000, 0x0000, 0xE58B, 0x0000, 0x0000,
+	0x0000, 0xE589, 0xE583, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9277, 0x0000, 0xE594, 0x0000, 0x96A8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE592, 0x0000, 0x0000, 0x0000, 0xE593, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE58E, 0x0000, 0x0000, 0xE590, 0x0000, 0x0000, 0x0000, 0xE591, 0x0000, 0x0000, 0x0000, 0xE58F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90E4, 0x0000, 0x9858, 0xE598, 0x0000, 0xE599, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE59F, 0x0000, 0x9049, 0x0000, 0xE59B, 0x0000, 0xE59E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE596,
+	0xE595, 0x0000, 0x0000, 0xE5A0, 0x0000, 0x0000, 0x89DA, 0x0000, 0xE59C, 0x0000, 0xE5A1, 0x0000, 0x0000, 0x0000, 0xE59D, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE59A, 0x0000, 0x92B1, 0x0000, 0xE597, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9488,
+	0x0000, 0x0000, 0xE5A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x975A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A4,
+	0x0000, 0x0000, 0xE5A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5AC, 0x0000, 0x0000, 0x0000, 0xE5A6,
+	0x0000, 0x0000, 0x0000, 0xE5AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9786, 0xE5B1, 0x0000, 0xE5A8, 0x0000, 0x0000,
+	0xE5A9, 0x0000, 0x0000, 0x0000, 0xE5AD, 0x0000, 0xE5B0, 0xE5AF, 0x0000, 0x0000, 0x0000, 0xE5A7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE5AA, 0x0000, 0xE5BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE5B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5B2,
+	0x0000, 0x0000, 0xE5B3, 0x0000, 0x0000, 0x0000, 0xE5B8, 0xE5B9, 0x0000, 0x8A49, 0x0000, 0x8B61, 0x0000, 0x0000, 0xE5B7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A2, 0x0000, 0xFBA1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5B6, 0xE5BA, 0xE5B5,
+	0x0000, 0xE5BC, 0x0000, 0x0000, 0x0000, 0xE5BE, 0xE5BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE5C0, 0xE5BF, 0xE579, 0x0000, 0x0000, 0x0000, 0xE5C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE5C1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5C2, 0x0000, 0x0000, 0xE5C3, 0x0000, 0xE5C5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8C8C, 0x0000, 0xE5C7, 0x0000, 0xE5C6, 0x0000, 0x8F4F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D73, 0x9FA5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE5C8, 0x8F70, 0x0000, 0x0000, 0x0000, 0x8A58, 0x0000, 0xE5C9, 0x0000, 0x8971, 0x0000, 0x8FD5, 0xE5CA, 0x0000,
+	0x0000, 0x8D74, 0xE5CB, 0x88DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x955C, 0x0000, 0x0000, 0xE5CC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x908A, 0x0000, 0xE5D3, 0x0000, 0x0000, 0xE5D0, 0x0000, 0x928F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5D1, 0xE5CE, 0x8BDC,
+	0x0000, 0xE5CD, 0xE5D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C55, 0x0000, 0x0000, 0x91DC, 0x0000, 0xE5DA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE5D6, 0x0000, 0x0000, 0x0000, 0x91B3, 0xE5D5, 0x0000, 0xE5D8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5CF, 0x0000,
+	0x0000, 0x0000, 0xE5D9, 0x0000, 0xE5DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94ED, 0x0000, 0x0000, 0xE5D7, 0x0000,
+	0xE5DC, 0xE5DE, 0x0000, 0x0000, 0x8CD1, 0xE5D2, 0x0000, 0x88BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5DD,
+	0x0000, 0x8DD9, 0x97F4, 0xE5DF, 0xE5E0, 0x9195, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x97A0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE5E1, 0x9754, 0x0000, 0x0000, 0xE5E2, 0xE5E3, 0x0000, 0x0000, 0x95E2, 0xE5E4, 0x0000, 0x8DBE,
+	0x0000, 0x97A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE5EA, 0x8FD6, 0xE5E8, 0xFBA2, 0x0000, 0x0000, 0x9787, 0xE5E5, 0x0000, 0x0000, 0xE5E7, 0x90BB, 0x909E, 0x0000,
+	0x0000, 0x0000, 0xE5E6, 0x0000, 0xE5EB, 0x0000, 0x0000, 0x95A1, 0x0000, 0x0000, 0xE5ED, 0x0000, 0xE5EC, 0x0000, 0x0000, 0x0000,
+	0x8A8C, 0x0000, 0x964A, 0xE5EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFA5D, 0xE5FA, 0xE5F0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5F1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5F2, 0xE5F3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5F7, 0x0000, 0xE5F8, 0x0000, 0x0000, 0xE5F6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE5F4, 0x0000, 0xE5EF, 0xE5F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5F9, 0xE8B5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5FC, 0x8BDD,
+	0xE5FB, 0x0000, 0x0000, 0x0000, 0xE641, 0x0000, 0xE640, 0x0000, 0x0000, 0x0000, 0xE643, 0x0000, 0x0000, 0xE642, 0x0000, 0xE644,
+	0x0000, 0x0000, 0x8F50, 0x0000, 0xE645, 0x0000, 0x0000, 0xE646, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE647, 0x90BC,
+	0x0000, 0x9776, 0x0000, 0xE648, 0x0000, 0x0000, 0x95A2, 0x9465, 0xE649, 0x0000, 0xE64A, 0x8CA9, 0x0000, 0x0000, 0x0000, 0x8B4B,
+	0x0000, 0x0000, 0x0000, 0xE64B, 0x0000, 0x0000, 0x8E8B, 0x9460, 0xE64C, 0x0000, 0x8A6F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE64D, 0x0000, 0x0000, 0x0000, 0x0000, 0xE64F, 0x9797, 0x0000, 0xE64E, 0x9065, 0x0000, 0xE650, 0x0000, 0x0000, 0xE651,
+	0x0000, 0x0000, 0xE652, 0x8ACF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE653, 0x0000, 0x0000, 0xE654, 0x0000, 0xE655,
+	0xE656, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x8A70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE657, 0x0000, 0xE658, 0xE659, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x89F0, 0x0000, 0x0000, 0x9047, 0xE65A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE65B, 0x0000, 0x0000, 0x0000, 0xE65C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8CBE, 0x0000, 0x92F9, 0xE65D, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C76, 0x0000, 0x9075, 0x0000, 0xE660, 0x0000, 0x93A2, 0x0000,
+	0xE65F, 0x0000, 0xFBA3, 0x8C50, 0x0000, 0x0000, 0xE65E, 0x91F5, 0x8B4C, 0x0000, 0x0000, 0xE661, 0x0000, 0xE662, 0x0000, 0x8FD7,
+	0x0000, 0x0000, 0x0000, 0x8C8D, 0x0000, 0xE663, 0x0000, 0x0000, 0x0000, 0x0000, 0x964B, 0x0000, 0x0000, 0x90DD, 0x0000, 0x0000,
+	0x0000, 0x8B96, 0x0000, 0x96F3, 0x9169, 0x0000, 0xE664, 0xFBA4, 0x0000, 0x0000, 0x9066, 0x9290, 0x8FD8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE665, 0x0000, 0x0000, 0x0000, 0x0000, 0xE668, 0x0000, 0xE669, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8DBC, 0x91C0, 0xE667, 0x0000, 0x8FD9, 0x955D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE666, 0x0000, 0x0000, 0x8E8C, 0x0000,
+	0x8972, 0x0000, 0xE66D, 0x8C77, 0x0000, 0x0000, 0x8E8E, 0x0000, 0x0000, 0x8E8D, 0x0000, 0x986C, 0xE66C, 0xE66B, 0x9146, 0x0000,
+	0x8B6C, 0x9862, 0x8A59, 0x8FDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBA5, 0x0000, 0x0000, 0xE66A, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE66F, 0x0000, 0xE670, 0xE66E, 0x0000, 0x8CD6, 0x0000, 0x975F, 0x0000, 0x0000, 0x8E8F, 0x9446, 0x0000, 0x0000,
+	0x0000, 0xE673, 0x0000, 0x90BE, 0x0000, 0x9261, 0x0000, 0x0000, 0x9755, 0x0000, 0xE676, 0x0000, 0x0000, 0x0000, 0x8CEA, 0x0000,
+	0x90BD, 0xE672, 0x0000, 0xE677, 0x8CEB, 0xE674, 0xE675, 0xFBA6, 0xE671, 0x0000, 0x0000, 0x0000, 0x90E0, 0x93C7, 0x0000, 0x0000,
+	0x924E, 0x0000, 0x89DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94EE, 0x0000, 0x0000, 0x8B62, 0x0000, 0xFBA7, 0x92B2,
+	0x0000, 0x0000, 0xE67A, 0x0000, 0xE678, 0x0000, 0x0000, 0x926B, 0x0000, 0x0000, 0x0000, 0x90BF, 0x8AD0, 0xE679, 0x0000, 0x907A,
+	0x0000, 0x0000, 0x97C8, 0x0000, 0x0000, 0x0000, 0x985F, 0x0000, 0x0000, 0x0000, 0xE67B, 0xE687, 0x92B3, 0x0000, 0xE686, 0xFBA8,
+	0xE683, 0xE68B, 0xE684, 0x0000, 0xE680, 0x0000, 0x92FA, 0xE67E, 0x0000, 0x0000, 0x0000, 0xE67C, 0x0000, 0x9740, 0x8E90, 0x0000,
+	0x0000, 0xE681, 0x0000, 0xE67D, 0x0000, 0x0000, 0xFBAA, 0xE685, 0x8F94, 0x0000, 0x8CBF, 0x0000, 0x0000, 0x0000, 0x91F8, 0x0000,
+	0x9664, 0x8979, 0x88E0, 0x0000, 0x93A3, 0x0000, 0x0000, 0xE689, 0x0000, 0x0000, 0x0000, 0x0000, 0xE688, 0x0000, 0x93E4, 0x0000,
+	0xE68D, 0x0000, 0x0000, 0x0000, 0xE682, 0x0000, 0xE68C, 0xE68E, 0x0000, 0x8CAA, 0xE68A, 0x8D75, 0x0000, 0x8ED3, 0x0000, 0x0000,
+	0xE68F, 0x9777, 0x0000, 0x0000, 0x0000, 0x0000, 0xE692, 0x0000, 0xE695, 0x0000, 0x0000, 0xE693, 0x9554, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE690, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BDE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE694, 0x0000,
+	0x0000, 0xE696, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE69A, 0x0000, 0x0000, 0xE697, 0x0000, 0xE699, 0xE698,
+	0x0000, 0x0000, 0x0000, 0xFBAB, 0x0000, 0x0000, 0xE69B, 0x0000, 0x8EAF, 0x0000, 0xE69D, 0xE69C, 0x9588, 0x0000, 0x0000, 0xE69F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C78, 0x0000, 0x0000, 0x0000, 0x0000, 0xE69E, 0xE6A0, 0x0000, 0x0000, 0xE6A1,
+	0x8B63, 0xE3BF, 0x8FF7, 0x0000, 0xE6A2, 0x0000, 0x0000, 0x8CEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6A3, 0x0000, 0xFBAC,
+	0xE6A4, 0x0000, 0x0000, 0x8E5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9DCC, 0x0000, 0xE6A5, 0x0000, 0xE6A6, 0x0000,
+	0x8F51, 0x0000, 0xE6A7, 0xE6A8, 0x0000, 0x0000, 0xE6A9, 0x0000, 0x0000, 0xE6AA, 0xE6AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x924A, 0x0000, 0x0000, 0xE6AC, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6AE,
+	0x0000, 0xE6AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x93A4, 0x0000, 0xE6AF, 0x0000, 0x964C, 0x0000, 0xE6B0, 0x0000, 0xE6B1, 0x0000,
+	0xE6B2, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x93D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8FDB, 0xE6B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D8B, 0x98AC, 0xE6B5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6B6, 0x955E, 0xE6B7, 0x0000, 0xE6BF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE6B8, 0x0000, 0x0000, 0xE6BA, 0x0000, 0x0000, 0x0000, 0xE6B9, 0xE6BB, 0x0000, 0x9665, 0xE6BC, 0xE6BD, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE6BE, 0x0000, 0x0000, 0x0000, 0xE6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A4C, 0x92E5, 0x0000,
+	0x9589, 0x8DE0, 0x8D76, 0x0000, 0x0000, 0x0000, 0x0000, 0x956E, 0x89DD, 0x94CC, 0xE6C3, 0x8AD1, 0x90D3, 0xE6C2, 0xE6C7, 0x9299,
+	0x96E1, 0x0000, 0xE6C5, 0xE6C6, 0x8B4D, 0x0000, 0xE6C8, 0x9483, 0x91DD, 0x0000, 0x0000, 0x94EF, 0x935C, 0xE6C4, 0x0000, 0x9666,
+	0x89EA, 0xE6CA, 0x9847, 0x92C0, 0x9864, 0x0000, 0x0000, 0x8E91, 0xE6C9, 0x0000, 0x91AF, 0x0000, 0x0000, 0xE6DA, 0x9147, 0x0000,
+	0x0000, 0x93F6, 0x0000, 0x956F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6CD, 0x8E5E, 0x8E92, 0x0000, 0x8FDC, 0x0000,
+	0x9485, 0x0000, 0x8CAB, 0xE6CC, 0xE6CB, 0x0000, 0x958A, 0x0000, 0x0000, 0x0000, 0x8EBF, 0x0000, 0x0000, 0x9371, 0x0000, 0x0000,
+	0xFBAD, 0x0000, 0x0000, 0x0000, 0xFBAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6CF, 0xE6D0, 0x8D77, 0xE6CE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE6D1, 0xE6D2, 0x0000, 0xE6D4, 0x91A1, 0x0000, 0xE6D3, 0x8AE4, 0x0000, 0xE6D6, 0x0000, 0xE6D5,
+	0xE6D7, 0x0000, 0xFBAF, 0xE6D9, 0xE6DB, 0x0000, 0xE6DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x90D4, 0x0000, 0x8ECD, 0xE6DD, 0x0000, 0x0000, 0x0000, 0x8A71, 0x0000, 0xE6DE, 0x0000, 0x0000,
+	0x9196, 0xE6DF, 0x0000, 0xE6E0, 0x958B, 0x0000, 0xFBB0, 0x8B4E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE6E1, 0x0000, 0x0000, 0x0000, 0x92B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x897A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8EEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x9096, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x91AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6E5, 0x0000, 0x0000, 0x0000, 0xE6E4, 0x0000,
+	0x0000, 0x0000, 0xE6E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6EB, 0xE6E9, 0x0000, 0x0000, 0xE6E6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6E8, 0x0000, 0x0000, 0x0000, 0xE6E7, 0xE6EA, 0x0000, 0x8B97, 0x0000, 0xE6EE,
+	0x0000, 0x90D5, 0x0000, 0xE6EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CD7, 0x0000, 0xE6EC, 0xE6ED, 0x0000, 0x0000, 0x0000, 0x9848,
+	0x0000, 0x0000, 0x0000, 0x92B5, 0x0000, 0x9148, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6F0, 0x0000, 0x0000, 0xE6F3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6F1, 0xE6F2, 0x9778, 0x0000, 0x0000, 0x0000, 0x0000, 0x93A5,
+	0xE6F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6F4, 0xE6F5, 0xE6F7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE748, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE6FA, 0x0000, 0x0000, 0x0000, 0xE6FB, 0xE6F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE6F8, 0x0000, 0x92FB, 0x0000, 0x0000, 0xE740, 0xE744, 0xE741, 0xE6FC, 0x0000, 0xE742, 0x0000, 0x0000, 0x0000,
+	0xE743, 0x0000, 0x0000, 0x0000, 0x0000, 0xE74A, 0x0000, 0x0000, 0x0000, 0xE745, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90D6,
+	0xE747, 0x0000, 0x0000, 0xE749, 0xE746, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE74C, 0x0000, 0x8F52, 0x0000, 0xE74B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE74D, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE74E, 0x0000, 0x0000, 0xE751, 0xE750, 0x0000, 0xE74F, 0x0000, 0x0000, 0xE753, 0xE752, 0x0000, 0x96F4, 0x0000, 0x0000,
+	0x0000, 0xE755, 0x0000, 0xE754, 0xE756, 0x0000, 0x0000, 0x0000, 0x0000, 0xE757, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE759, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE758, 0x9067, 0xE75A, 0x0000, 0x0000, 0x8BEB,
+	0xE75B, 0xE75D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE75E, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE75F, 0xE75C, 0x0000, 0xE760, 0x0000, 0x8ED4, 0xE761, 0x8B4F, 0x8C52, 0x0000, 0xFBB2,
+	0x0000, 0x0000, 0x8CAC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE762, 0x0000, 0x0000, 0x0000, 0x93EE,
+	0x0000, 0x0000, 0x935D, 0xE763, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE766, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EB2, 0x0000, 0x0000, 0xE765, 0xE764, 0x8C79, 0xE767, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8A72, 0x0000, 0xE769, 0x0000, 0x0000, 0x0000, 0x8DDA, 0xE768, 0x0000, 0xE771, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE76B, 0xE76D, 0x95E3, 0xE76A, 0x0000, 0x0000, 0x0000, 0xE76C, 0x0000, 0xE770, 0xE76E, 0x8B50, 0x0000, 0xE76F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE772, 0x0000, 0x0000, 0x9479, 0x97D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F53,
+	0x0000, 0x0000, 0x0000, 0xE773, 0x0000, 0x0000, 0x0000, 0x0000, 0x9741, 0xE775, 0x0000, 0xE774, 0x0000, 0x0000, 0xE778, 0x9760,
+	0x0000, 0x0000, 0xE777, 0x0000, 0x8A8D, 0xE776, 0xE77B, 0x0000, 0x0000, 0xE77A, 0x0000, 0x0000, 0xE779, 0x9351, 0xE77C, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE77D, 0x0000, 0x0000, 0x0000, 0x0000, 0xE77E, 0x0000, 0x0000, 0x8D8C,
+	0x0000, 0x8C44, 0xE780, 0xE781, 0xE782, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9068, 0xE783, 0x0000, 0x8EAB, 0xE784,
+	0x0000, 0x0000, 0x0000, 0xE785, 0x0000, 0x0000, 0x0000, 0x999F, 0x999E, 0x0000, 0x0000, 0x0000, 0x0000, 0xE786, 0xE390, 0xE787,
+	0x9243, 0x904A, 0x945F, 0x0000, 0x0000, 0x0000, 0x0000, 0xE788, 0x0000, 0x0000, 0x95D3, 0x92D2, 0x8D9E, 0x0000, 0x0000, 0x9248,
+	0x0000, 0x0000, 0x8949, 0x0000, 0x9698, 0x9076, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C7D, 0x0000,
+	0x0000, 0x8BDF, 0x0000, 0x0000, 0x95D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE789, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE78B, 0x0000, 0x0000, 0xE78A, 0x89DE, 0x0000, 0x0000, 0x93F4, 0xE78C, 0x9497, 0x0000, 0x9352, 0x0000, 0xE78D,
+	0x8F71, 0x0000, 0x0000, 0x0000, 0xE78F, 0x0000, 0x0000, 0x96C0, 0xE79E, 0xE791, 0xE792, 0x0000, 0x0000, 0x92C7, 0x0000, 0x0000,
+	0x91DE, 0x9197, 0x0000, 0x93A6, 0x0000, 0xE790, 0x8B74, 0x0000, 0x0000, 0x0000, 0x0000, 0xE799, 0x0000, 0xE796, 0xE7A3, 0x93A7,
+	0x9280, 0xE793, 0x0000, 0x92FC, 0x9372, 0xE794, 0xE798, 0x9080, 0x0000, 0x9487, 0x92CA, 0x0000, 0x0000, 0x90C0, 0xE797, 0x91AC,
+	0x91A2, 0xE795, 0x88A7, 0x9841, 0x0000, 0x0000, 0x0000, 0xE79A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91DF, 0x0000,
+	0x0000, 0x8F54, 0x9069, 0x0000, 0x0000, 0xE79C, 0xE79B, 0x0000, 0x88ED, 0xE79D, 0x0000, 0x0000, 0x954E, 0x0000, 0xE7A5, 0x0000,
+	0x0000, 0x93D9, 0x908B, 0x0000, 0x0000, 0x9278, 0x0000, 0x8BF6, 0x0000, 0xE7A4, 0x9756, 0x895E, 0x0000, 0x95D5, 0x89DF, 0xE79F,
+	0xE7A0, 0xE7A1, 0xE7A2, 0x93B9, 0x9242, 0x88E1, 0xE7A6, 0x0000, 0xE7A7, 0xEAA1, 0x0000, 0x0000, 0x91BB, 0x0000, 0xE7A8, 0x0000,
+	0x8993, 0x916B, 0x0000, 0x8CAD, 0x0000, 0x9779, 0x0000, 0xFBB5, 0xE7A9, 0x934B, 0x0000, 0x0000, 0x0000, 0x9198, 0x8ED5, 0xE7AA,
+	0x0000, 0x0000, 0xE7AD, 0x0000, 0x0000, 0x8F85, 0xE7AB, 0x914A, 0x9149, 0x0000, 0x88E2, 0x0000, 0x97C9, 0xE7AF, 0x0000, 0x94F0,
+	0xE7B1, 0xE7B0, 0xE7AE, 0xE284, 0x8AD2, 0x0000, 0x0000, 0xE78E, 0x0000, 0xE7B3, 0xE7B2, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7B4,
+	0x0000, 0x9757, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x93DF, 0x0000, 0x0000, 0x964D, 0x0000, 0xE7B5, 0x0000, 0x8ED7, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7B6,
+	0x0000, 0xE7B7, 0x0000, 0x0000, 0x0000, 0xE7B8, 0x0000, 0x0000, 0x9340, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x88E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D78, 0x0000, 0x0000, 0x0000, 0x9859, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7BC, 0x0000, 0x0000, 0xFBB6, 0x0000,
+	0x0000, 0x8C53, 0xE7B9, 0x0000, 0xE7BA, 0x0000, 0x0000, 0x0000, 0x9594, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A73, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9758, 0x0000, 0x8BBD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9373, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE7BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE7BE, 0x0000, 0x0000, 0xFBB8, 0x0000, 0x0000, 0x0000, 0xE7BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9341, 0x0000, 0x0000,
+	0xE7C1, 0x0000, 0xE7C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x93D1, 0xE7C2, 0x8F55, 0x8EDE, 0x947A, 0x9291, 0x0000,
+	0x0000, 0x0000, 0x8EF0, 0x0000, 0x908C, 0x0000, 0xE7C3, 0x0000, 0xE7C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x907C, 0xE7C5, 0x0000, 0xE7C6, 0x0000, 0x0000, 0x0000, 0xE7C7, 0x978F, 0x0000, 0x8F56, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE7C9, 0xE7C8, 0x0000, 0x8D79, 0x0000, 0x8D93, 0x8E5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE7CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F86, 0x0000, 0xE7CB, 0x0000, 0xE7CA, 0x0000, 0x91E7, 0x0000, 0x0000,
+	0x8CED, 0x0000, 0x90C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x94AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x8F58, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE7CD, 0x0000, 0x8FDD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7D0, 0xE7CE, 0x0000, 0x0000, 0x0000, 0xE7CF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE7D2, 0xE7D1, 0x0000, 0x0000, 0x8FF8, 0x0000, 0xE7D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE7D4, 0xE7D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x94CE, 0x8DD1, 0x8EDF, 0xE7D6, 0x0000, 0xE7D7, 0x97A2, 0x8F64, 0x96EC, 0x97CA,
+	0xE7D8, 0x8BE0, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7D9, 0xFBBB, 0x9342, 0x0000, 0xFBBA, 0xE7DC, 0x8A98, 0x906A, 0xFBBC, 0xE7DA,
+	0x0000, 0xE7DB, 0x0000, 0x92DE, 0xFBBF, 0xFBC0, 0x9674, 0x8BFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBBD, 0xFBBE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7DE, 0xE7DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7DD, 0x0000, 0x0000, 0xE7E1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBC1, 0x0000, 0x0000, 0x0000, 0xFBC3, 0x0000, 0x0000, 0x93DD, 0x8A62, 0x0000,
+	0xFBC2, 0xE7E5, 0x0000, 0x0000, 0xE7E2, 0xE7E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7E0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE86E, 0x0000, 0x0000, 0xE7E3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x97E9, 0x0000, 0x0000, 0x8CD8, 0x0000, 0xFBCA, 0xFBC4, 0x0000, 0xFBC6, 0x0000, 0x0000, 0xE7ED,
+	0xFBC5, 0x0000, 0x0000, 0x0000, 0x9353, 0xE7E8, 0x0000, 0x0000, 0xE7EB, 0xE7E9, 0x0000, 0xE7EE, 0x0000, 0x0000, 0xFBC7, 0x0000,
+	0xE7EF, 0xFBC9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7E7, 0x0000, 0xFBC8, 0xE7F4, 0x8994, 0x0000, 0x0000, 0xE7E6, 0x0000,
+	0x0000, 0x0000, 0x94AB, 0x0000, 0xE7EA, 0x0000, 0x8FDE, 0xFBCB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8D7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBCD, 0xFBCE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9667, 0x0000,
+	0x8BE2, 0x0000, 0x0000, 0x8F65, 0x0000, 0x93BA, 0x0000, 0x0000, 0xFA5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x914C, 0x0000, 0xE7F2, 0x0000, 0xE7EC, 0xE7F1, 0x0000, 0x96C1, 0x0000, 0x92B6, 0xE7F3, 0xE7F0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x914B, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7F7, 0x0000, 0xE7F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7F5,
+	0xFBD2, 0x0000, 0x964E, 0xFBD6, 0x0000, 0xFBD4, 0x0000, 0xFBD0, 0x0000, 0xFBD1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFBD5, 0x0000, 0x0000, 0x0000, 0x8F9B, 0x0000, 0x0000, 0xFBCF, 0x0000, 0xE7F8, 0x95DD, 0x0000, 0x0000, 0x8973, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9565, 0x9292, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B98, 0xFA65, 0xE7FA, 0xFBD9, 0x8D7C, 0x0000, 0x0000, 0xFBDC,
+	0x0000, 0x0000, 0xFBDE, 0x0000, 0x0000, 0x0000, 0x8E4B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7F9,
+	0x908D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x908E, 0xE840, 0xE842, 0x0000, 0x0000, 0xFBDD, 0xFBDB, 0x0000,
+	0x8FF9, 0xFBD8, 0xE841, 0xE843, 0x0000, 0xFBD7, 0x8BD1, 0x0000, 0x9564, 0x0000, 0x0000, 0x8EE0, 0x9842, 0x0000, 0xE7FC, 0x8DF6,
+	0x0000, 0x0000, 0x985E, 0x0000, 0x0000, 0xE845, 0x0000, 0x0000, 0x0000, 0x0000, 0xE844, 0xE846, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE7FB, 0x0000, 0x0000, 0x0000, 0xFA5E, 0x0000, 0x0000, 0x93E7, 0x0000, 0x9374, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x92D5, 0x0000, 0xE84B, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x9262, 0xE847, 0x0000, 0x0000, 0x0000,
+	0xE848, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C4C, 0x0000, 0xE84A, 0x0000,
+	0xFBDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x8CAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE849, 0x0000, 0x8FDF, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A99, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE84F, 0x0000, 0x8DBD, 0x9199, 0x0000, 0x0000, 0x92C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFBE1, 0x0000, 0x0000, 0x8A5A, 0x0000, 0x0000, 0x0000, 0x0000, 0xE84D, 0xE84E, 0x92C1, 0x0000,
+	0xE84C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE850, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE856, 0x0000, 0x0000, 0xFBE2, 0x0000, 0xE859, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE858, 0x934C, 0x0000, 0x0000, 0x0000, 0x0000, 0xE851, 0xE852, 0xE855, 0x0000, 0x0000, 0x0000, 0x0000, 0xE857, 0xFBE3, 0x0000,
+	0x0000, 0x8BBE, 0x0000, 0x0000, 0xE85A, 0xE854, 0x0000, 0x0000, 0xE853, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE85E, 0x0000, 0x0000, 0x0000, 0xE85F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE860, 0x0000, 0x0000, 0xE85D, 0xE85C, 0x0000, 0x0000, 0x0000, 0x8FE0, 0x93A8, 0xE85B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE864, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE862, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xFBE5, 0x0000, 0x0000, 0x0000, 0xE863, 0xE861, 0x0000, 0x91F6, 0x0000, 0xE865, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE866, 0x0000, 0x0000, 0xE868, 0xFBE6, 0x0000, 0x0000, 0xFBE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8AD3, 0xE867, 0x96F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE873, 0xE869, 0x0000, 0x0000, 0xE86C, 0x0000,
+	0xE86A, 0x0000, 0xE86B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE86D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE86F, 0x0000, 0x0000, 0x0000, 0x0000, 0xE870, 0x0000, 0xE871, 0x0000, 0x0000, 0x0000, 0x0000, 0xE874, 0xE872, 0xE875, 0xE877,
+	0x0000, 0xE876, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x96E5, 0x0000, 0xE878, 0x914D, 0x0000, 0x0000, 0x0000, 0xE879, 0x0000, 0x95C2, 0xE87A, 0x8A4A, 0x0000, 0x0000, 0x0000, 0x895B,
+	0x0000, 0x8AD5, 0xFBE8, 0x8AD4, 0xE87B, 0x0000, 0xE87C, 0x0000, 0xE87D, 0xE87E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE880, 0x0000, 0x8AD6, 0x8A74, 0x8D7D, 0x94B4, 0x0000, 0xE882, 0xE881, 0x0000, 0x0000, 0x0000, 0x0000, 0xE883, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x897B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE886, 0x0000, 0xE885, 0xE884, 0x0000, 0xE887, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE88A, 0x0000, 0x0000, 0x0000, 0x88C5, 0x0000, 0x0000, 0xE888, 0x0000, 0xE88C, 0xE88B, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE88E, 0xE88D, 0xE88F, 0x0000, 0x93AC, 0x0000, 0x0000, 0x0000, 0xE890, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE891, 0xE893, 0x0000, 0x0000, 0xE892, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x958C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE894, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE895, 0x0000, 0x8DE3, 0x0000, 0x0000, 0x0000, 0xE896, 0xE897,
+	0x0000, 0x0000, 0x9668, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x916A, 0x0000, 0x0000, 0x0000, 0x88A2,
+	0x91C9, 0x0000, 0xE898, 0x0000, 0x958D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE89B, 0xE899, 0x8D7E, 0x0000, 0xE89A,
+	0x8CC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95C3, 0xE89D, 0xE89F, 0xE89E, 0xE8A0,
+	0x0000, 0x0000, 0x8940, 0x9077, 0x8F9C, 0x8AD7, 0xE8A1, 0x0000, 0x0000, 0x0000, 0x9486, 0x0000, 0xE8A3, 0x0000, 0x0000, 0x0000,
+	0x8941, 0x0000, 0xE8A2, 0x92C2, 0x0000, 0x97CB, 0x93A9, 0xE89C, 0x97A4, 0x0000, 0x8CAF, 0x0000, 0x0000, 0x977A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8BF7, 0x97B2, 0x0000, 0x8C47, 0x0000, 0x91E0, 0xE440, 0x0000, 0xE8A4, 0x8A4B, 0x908F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8A75, 0xE8A6, 0x0000, 0xE8A7, 0xE8A5, 0x8C84, 0x0000, 0x8DDB, 0x8FE1, 0xFBEB, 0x0000, 0x0000,
+	0x8942, 0x0000, 0x0000, 0x97D7, 0x0000, 0x0000, 0x0000, 0xE8A9, 0xE7AC, 0x0000, 0xE8A8, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEC,
+	0xE8AC, 0xE8AA, 0xE8AB, 0x0000, 0xE8AD, 0x0000, 0xE8AE, 0x97EA, 0xE8AF, 0xE8B0, 0x0000, 0x90C7, 0x94B9, 0x0000, 0x0000, 0x0000,
+	0x909D, 0x8AE5, 0x0000, 0x0000, 0x9759, 0x89EB, 0x8F57, 0x8CD9, 0x0000, 0xE8B3, 0x0000, 0xE8B2, 0x8E93, 0xE8B4, 0xE8B1, 0x0000,
+	0x0000, 0x8E47, 0x0000, 0x0000, 0x0000, 0xE8B8, 0xE5AB, 0x0000, 0x0000, 0x99D4, 0x0000, 0x9097, 0xE8B6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x97A3, 0x93EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x894A, 0x0000, 0x90E1, 0x8EB4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x95B5, 0x0000, 0x895F, 0x0000, 0x0000, 0x0000, 0x97EB, 0x978B, 0x0000, 0xE8B9, 0x0000, 0x9364, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8EF9, 0x0000, 0x0000, 0x0000, 0xE8BA, 0x0000, 0xE8BB, 0x906B, 0xE8BC, 0x0000, 0x97EC, 0x0000, 0x0000, 0xE8B7, 0xE8BE, 0xE8C0,
+	0x0000, 0xE8BF, 0x0000, 0xE8BD, 0x0000, 0x0000, 0xE8C1, 0x0000, 0x0000, 0xE8C2, 0x0000, 0x0000, 0x919A, 0x0000, 0x89E0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE8C3, 0x0000, 0x0000, 0x96B6, 0x0000, 0x0000, 0xE8C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE8C5, 0x0000, 0x9849, 0xFBED, 0x0000, 0x0000, 0x0000, 0x0000, 0x9E50, 0xE8C6, 0x0000, 0xFBEE, 0x0000, 0xE8C7, 0xE8C8, 0x0000,
+	0x0000, 0x0000, 0xE8CC, 0xFBEF, 0xE8C9, 0x0000, 0xE8CA, 0x0000, 0xE8CB, 0xE8CD, 0x0000, 0x0000, 0x0000, 0xFBF0, 0x0000, 0xFBF1,
+	0x0000, 0xFBF2, 0x90C2, 0x0000, 0x0000, 0xFBF3, 0x96F5, 0x0000, 0x0000, 0x90C3, 0x0000, 0x0000, 0xE8CE, 0x0000, 0x94F1, 0x0000,
+	0xE8CF, 0xEA72, 0x96CA, 0x0000, 0xE8D0, 0x0000, 0xE8D1, 0x0000, 0xE8D2, 0x8A76, 0x0000, 0xE8D4, 0x0000, 0x9078, 0x0000, 0x0000,
+	0x0000, 0xE8D5, 0x0000, 0x0000, 0x8C43, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8D6, 0xE8DA, 0x0000, 0xE8D8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE8D9, 0x0000, 0x0000, 0x8A93, 0xE8D7, 0xE8DB, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8DC, 0x0000, 0x88C6, 0x0000, 0xE8DD,
+	0xE8DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8FE2, 0x0000, 0x0000, 0x0000, 0xE8DF, 0x0000, 0x0000, 0x0000,
+	0x8B66, 0x0000, 0x0000, 0xE8E2, 0x0000, 0x0000, 0xE8E1, 0x0000, 0xE8E0, 0x0000, 0x0000, 0xE691, 0x0000, 0x95DA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE8E3, 0xE8E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE8E5, 0x0000, 0x0000, 0xE8E6, 0x0000, 0xE8E7, 0x0000, 0x0000, 0xE8E8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8AD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8EA, 0x9442, 0x0000,
+	0x0000, 0x0000, 0xE8EC, 0x89B9, 0x0000, 0xE8EF, 0xE8EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x8943, 0x0000, 0x0000, 0x0000, 0x8BBF,
+	0x0000, 0x95C5, 0x92B8, 0x8DA0, 0x0000, 0x8D80, 0x8F87, 0x0000, 0x907B, 0x0000, 0x0000, 0x0000, 0xE8F1, 0x0000, 0x0000, 0xE8F0,
+	0x9761, 0x8AE6, 0x94D0, 0x93DA, 0x0000, 0x0000, 0x0000, 0x909C, 0x97CC, 0x0000, 0x8C7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE8F4, 0x0000, 0x0000, 0xE8F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x966A, 0x93AA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x896F, 0x0000, 0x0000, 0xE8F5, 0xE8F2, 0x0000, 0x0000, 0x9570, 0x978A, 0xE8F6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8F7, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8F9, 0x91E8, 0x8A7A, 0x8A7B, 0xE8F8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8AE7, 0x8CB0, 0x0000, 0xFBF4, 0x8AE8, 0x0000, 0x0000, 0x935E, 0x0000, 0x0000, 0x97DE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBF5, 0x0000, 0x8CDA, 0x0000, 0x0000, 0x0000, 0xE8FA, 0x0000, 0x0000, 0x0000, 0xE8FB,
+	0xE8FC, 0xE940, 0x0000, 0xE942, 0xE941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9597, 0x0000, 0xE943, 0x0000, 0x0000, 0x0000, 0x0000, 0xE944,
+	0x0000, 0xE945, 0x0000, 0x0000, 0x0000, 0x0000, 0xE946, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE948, 0xE947, 0x0000, 0xE949, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94F2, 0xE3CA, 0x0000, 0x0000, 0x9048,
+	0x0000, 0x0000, 0x8B51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE94A, 0x0000, 0xE94B, 0x0000, 0x99AA, 0x9F5A, 0x94D1,
+	0x0000, 0x0000, 0x88F9, 0x0000, 0x88B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8E94, 0x964F, 0x8FFC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE94C, 0x0000, 0x96DD, 0x0000, 0x0000, 0x0000, 0xE94D, 0x977B, 0x0000, 0x8961, 0x0000, 0x0000, 0x0000,
+	0x8E60, 0x0000, 0xE94E, 0x89EC, 0xE94F, 0x0000, 0x0000, 0x0000, 0xE950, 0x0000, 0x0000, 0x0000, 0x0000, 0xE952, 0xE953, 0x0000,
+	0xE955, 0xE951, 0x0000, 0x0000, 0xE954, 0x0000, 0x0000, 0xFBF8, 0x8AD9, 0x0000, 0x0000, 0x0000, 0xE956, 0x0000, 0xE957, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE958, 0xE959, 0x0000,
+	0x0000, 0x0000, 0xE95A, 0x0000, 0x0000, 0xE95C, 0x0000, 0x0000, 0x0000, 0xE95B, 0x0000, 0xE95E, 0xE961, 0x0000, 0x0000, 0x0000,
+	0xE95D, 0xE95F, 0xE960, 0x0000, 0x0000, 0xE962, 0x0000, 0x8BC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EF1, 0xE963, 0xE964, 0x8D81, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBFA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE965, 0x0000, 0x0000, 0x8A5D, 0x0000, 0x0000, 0x0000, 0x946E, 0xE966, 0xE967, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x9279, 0x93E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE968, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x949D, 0x0000, 0x0000, 0x91CA, 0x8977, 0x8BEC, 0x0000, 0x8BED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x9293, 0xE96D, 0x8BEE, 0x0000, 0x0000, 0x89ED, 0x0000, 0x0000, 0xE96C, 0x0000, 0x0000, 0xE96A, 0x0000, 0xE96B, 0x0000, 0xE969,
+	0x0000, 0x0000, 0xE977, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE96E, 0xE96F, 0x0000,
+	0x0000, 0xE970, 0xE971, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE973, 0x0000, 0x0000, 0xE972, 0x0000, 0x0000, 0x0000, 0x8F78,
+	0x0000, 0xE974, 0x0000, 0x0000, 0x0000, 0xE976, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B52, 0xE975,
+	0x0000, 0x0000, 0x919B, 0x8CB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE978, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x91CB, 0x0000, 0x0000, 0xE979, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x93AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE97A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE980, 0x0000,
+	0xE97D, 0x0000, 0xE97C, 0xE97E, 0x0000, 0xE97B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE982, 0xFBFB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE981, 0x0000, 0xE984, 0x0000, 0x0000, 0x8BC1, 0xE983, 0x0000, 0x0000, 0x0000, 0xE985,
+	0x0000, 0x0000, 0xE986, 0x0000, 0xE988, 0xE987, 0x0000, 0x0000, 0x0000, 0xE989, 0xE98B, 0xE98A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D9C, 0x0000, 0x0000, 0x0000, 0x0000, 0xE98C, 0x0000, 0x0000,
+	0xE98D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A5B, 0x0000, 0x0000, 0x0000, 0xE98E, 0x0000, 0x0000, 0x0000,
+	0xE98F, 0x0000, 0x0000, 0x0000, 0x9091, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE990,
+	0x0000, 0xE991, 0x0000, 0xE992, 0xE993, 0x0000, 0x0000, 0x0000, 0x8D82, 0xFBFC, 0x0000, 0x0000, 0xFC40, 0x0000, 0xE994, 0xE995,
+	0x0000, 0x0000, 0xE996, 0xE997, 0x0000, 0x0000, 0xE998, 0x0000, 0x0000, 0x0000, 0x94AF, 0xE99A, 0x0000, 0x9545, 0xE99B, 0xE999,
+	0x0000, 0xE99D, 0x0000, 0x0000, 0xE99C, 0x0000, 0x0000, 0xE99E, 0x0000, 0x0000, 0x0000, 0xE99F, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9A1, 0x0000, 0xE9A2, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9A3,
+	0x0000, 0x0000, 0xE9A4, 0xE9A5, 0x0000, 0xE9A6, 0x0000, 0xE9A7, 0xE9A8, 0xE9A9, 0xE9AA, 0x0000, 0x0000, 0x0000, 0xE9AB, 0xE9AC,
+	0x0000, 0x9F54, 0xE9AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2F6, 0x8B53, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8A40, 0x8DB0, 0xE9AF, 0xE9AE, 0x96A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9B1, 0xE9B2, 0xE9B0,
+	0x0000, 0xE9B3, 0x0000, 0x0000, 0x9682, 0x0000, 0x0000, 0x0000, 0xE9B4, 0x0000, 0x8B9B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9844,
+	0x0000, 0x0000, 0xFC42, 0x0000, 0xE9B5, 0xFC41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE9B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x88BC, 0xFC43,
+	0x0000, 0xE9B8, 0x95A9, 0xE9B6, 0x0000, 0x0000, 0xE9B9, 0xE9BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9BB,
+	0xE9BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9BD, 0x0000, 0x968E, 0x8E4C, 0x0000, 0x8DF8, 0x914E, 0x0000,
+	0x0000, 0xFC44, 0x0000, 0x0000, 0xE9BE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C1, 0x0000, 0xFC45, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE9BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C2, 0x0000, 0x0000, 0x8CEF, 0xE9C0, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C3,
+	0x0000, 0xE9C4, 0xE9C5, 0x0000, 0xE9C9, 0x0000, 0x8E49, 0x0000, 0x0000, 0x0000, 0x0000, 0x91E2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE9CA, 0xE9C7, 0xE9C6, 0xE9C8, 0x0000, 0x0000, 0x0000, 0x8C7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE9CE, 0xE9CD, 0xE9CC, 0x0000, 0x0000, 0x88B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFC46, 0x0000, 0x0000, 0x0000, 0xE9D8, 0x0000, 0xE9D4, 0x0000, 0xE9D5, 0xE9D1, 0xE9D7, 0x0000, 0xE9D3, 0x8A82, 0x0000, 0x0000,
+	0x986B, 0x0000, 0xE9D6, 0xE9D2, 0xE9D0, 0xE9CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9DA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE9DD, 0x0000, 0x0000, 0xE9DC, 0xE9DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9568, 0xE9D9, 0x88F1,
+	0xE9DE, 0x0000, 0xE9E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A8F, 0xE9CB, 0x8956, 0x0000, 0x0000, 0xE9E2, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E1, 0xE9DF, 0x924C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x9690, 0x0000, 0x0000, 0x0000, 0x0000, 0x97D8, 0x0000, 0x0000, 0xE9E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE9E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E6, 0x0000, 0xE9E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x92B9, 0x0000, 0xE9E8, 0x0000, 0x94B5, 0x0000, 0xE9ED, 0xE9E9, 0x0000, 0x0000, 0x0000,
+	0xE9EA, 0x0000, 0x0000, 0x9650, 0x96C2, 0x0000, 0x93CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE9EE, 0x0000, 0x0000, 0xE9EF, 0x93BC, 0xE9EC, 0xE9EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x89A8, 0x0000,
+	0x0000, 0x0000, 0xE9F7, 0x0000, 0x0000, 0xE9F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8995, 0x0000, 0x0000, 0x0000, 0xE9F4,
+	0x0000, 0x0000, 0x0000, 0xE9F3, 0x0000, 0x0000, 0xE9F1, 0x0000, 0x8A9B, 0x0000, 0xE9F0, 0x8EB0, 0x89A7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D83, 0x0000, 0x0000, 0xE9FA, 0xE9F9,
+	0x0000, 0xE9F8, 0x0000, 0x0000, 0xE9F5, 0x0000, 0xE9FB, 0x0000, 0xE9FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEA44, 0xEA43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA45, 0x0000, 0x0000, 0x894C, 0xEA40, 0xEA41, 0x0000,
+	0x8D94, 0x96B7, 0x0000, 0x0000, 0xEA42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC48, 0x9651, 0x0000, 0x0000, 0xEA4A,
+	0xFC47, 0x0000, 0xEA46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA4B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA48, 0x0000, 0xEA47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C7B,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA4C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEA4D, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA4E, 0x0000, 0xEA49, 0x0000, 0x0000, 0x0000, 0xE9F2,
+	0x0000, 0x0000, 0xEA4F, 0x0000, 0x92DF, 0x0000, 0x0000, 0x0000, 0xEA53, 0x0000, 0xEA54, 0xEA52, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEA51, 0xEA57, 0x0000, 0xEA50, 0x0000, 0xEA55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA56,
+	0x0000, 0x0000, 0x0000, 0xEA59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA5C, 0x0000, 0xEA5D,
+	0x0000, 0x0000, 0x9868, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA5A, 0x91E9, 0x8DEB, 0x0000, 0x0000, 0xEA5E, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFC4A, 0xEA5F, 0xEA60, 0x0000, 0x0000, 0xEA61, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA62, 0x0000, 0x0000, 0x8CB2, 0xEA63, 0x0000, 0x0000, 0x0000, 0xEA64, 0x0000, 0x8EAD,
+	0x0000, 0xEA65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA66, 0x0000, 0x0000, 0xEA67, 0xEA68, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEA6B, 0xEA69, 0x985B, 0x0000, 0xEA6A, 0x0000, 0x97ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA6C, 0x0000, 0x97D9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA6D, 0x949E, 0x0000, 0x0000, 0xEA6E, 0xEA70, 0x0000, 0x0000, 0xEA71, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA6F, 0x8D8D, 0x96CB, 0x9683, 0x9BF5, 0x0000, 0x9F80, 0x969B,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x89A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA73, 0x8B6F, 0xEA74, 0xEA75,
+	0xEA76, 0xFC4B, 0x8D95, 0x0000, 0xEA77, 0x0000, 0x0000, 0x0000, 0xE0D2, 0x96D9, 0x0000, 0x91E1, 0xEA78, 0xEA7A, 0xEA79, 0x0000,
+	0xEA7B, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA7C, 0x0000, 0x0000, 0xEA7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA7E,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEA80, 0x0000, 0xEA81, 0xEA82, 0x0000, 0xEA83, 0x0000, 0xEA84, 0xEA85, 0xEA86, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA87, 0xEA88, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9343, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x8CDB, 0x0000, 0xEA8A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x916C, 0xEA8B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA8C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9540, 0x0000, 0x0000, 0xEA8D, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA8E, 0xE256, 0x0000, 0x0000, 0xE6D8, 0xE8EB,
+	0x0000, 0x0000, 0xEA8F, 0x0000, 0xEA90, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA92,
+	0xEA93, 0xEA94, 0x97EE, 0xEA91, 0x0000, 0x0000, 0xEA95, 0xEA96, 0x0000, 0x0000, 0xEA98, 0x0000, 0xEA97, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xEA9A, 0x0000, 0x0000, 0x0000, 0xEA9B, 0xEA99, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x97B4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA9C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEA9D, 0xE273, 0x0000, 0x0000,
+	0xEA9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFA90, 0xFA9B,
+	0xFA9C, 0xFAB1, 0xFAD8, 0xFAE8, 0xFAEA, 0xFB58, 0xFB5E, 0xFB75, 0xFB7D, 0xFB7E, 0xFB80, 0xFB82, 0xFB86, 0xFB89, 0xFB92, 0xFB9D,
+	0xFB9F, 0xFBA0, 0xFBA9, 0xFBB1, 0xFBB3, 0xFBB4, 0xFBB7, 0xFBD3, 0xFBDA, 0xFBEA, 0xFBF6, 0xFBF7, 0xFBF9, 0xFC49, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x8149, 0xFA57, 0x8194, 0x8190, 0x8193, 0x8195, 0xFA56, 0x8169, 0x816A, 0x8196, 0x817B, 0x8143, 0x817C, 0x8144, 0x815E,
+	0x824F, 0x8250, 0x8251, 0x8252, 0x8253, 0x8254, 0x8255, 0x8256, 0x8257, 0x8258, 0x8146, 0x8147, 0x8183, 0x8181, 0x8184, 0x8148,
+	0x8197, 0x8260, 0x8261, 0x8262, 0x8263, 0x8264, 0x8265, 0x8266, 0x8267, 0x8268, 0x8269, 0x826A, 0x826B, 0x826C, 0x826D, 0x826E,
+	0x826F, 0x8270, 0x8271, 0x8272, 0x8273, 0x8274, 0x8275, 0x8276, 0x8277, 0x8278, 0x8279, 0x816D, 0x815F, 0x816E, 0x814F, 0x8151,
+	0x814D, 0x8281, 0x8282, 0x8283, 0x8284, 0x8285, 0x8286, 0x8287, 0x8288, 0x8289, 0x828A, 0x828B, 0x828C, 0x828D, 0x828E, 0x828F,
+	0x8290, 0x8291, 0x8292, 0x8293, 0x8294, 0x8295, 0x8296, 0x8297, 0x8298, 0x8299, 0x829A, 0x816F, 0x8162, 0x8170, 0x8160, 0x0000,
+	0x0000, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x8191, 0x8192, 0x81CA, 0x8150, 0xFA55, 0x818F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+#endif
 
 static const WCHAR oem2uni932[] = {	/* Shift_JIS --> Unicode pairs */
 	0x00A1, 0xFF61, 0x00A2, 0xFF62, 0x00A3, 0xFF63, 0x00A4, 0xFF64,	0x00A5, 0xFF65, 0x00A6, 0xFF66, 0x00A7, 0xFF67, 0x00A8, 0xFF68,
@@ -1892,6 +3524,7 @@ static const WCHAR oem2uni932[] = {	/* Shift_JIS --> Unicode pairs */
 #endif
 
 #if FF_CODE_PAGE == 936 || FF_CODE_PAGE == 0	/* Simplified Chinese */
+#if FF_UNI2OEM_MAP < 2
 static const WCHAR uni2oem936[] = {	/* Unicode --> GBK pairs */
 	0x00A4, 0xA1E8, 0x00A7, 0xA1EC, 0x00A8, 0xA1A7, 0x00B0, 0xA1E3,	0x00B1, 0xA1C0, 0x00B7, 0xA1A4, 0x00D7, 0xA1C1, 0x00E0, 0xA8A4,
 	0x00E1, 0xA8A2, 0x00E8, 0xA8A8, 0x00E9, 0xA8A6, 0x00EA, 0xA8BA,	0x00EC, 0xA8AC, 0x00ED, 0xA8AA, 0x00F2, 0xA8B0, 0x00F3, 0xA8AE,
@@ -4619,6 +6252,1572 @@ static const WCHAR uni2oem936[] = {	/* Unicode --> GBK pairs */
 	0xFF5D, 0xA3FD, 0xFF5E, 0xA1AB, 0xFFE0, 0xA1E9, 0xFFE1, 0xA1EA,	0xFFE2, 0xA956, 0xFFE3, 0xA3FE, 0xFFE4, 0xA957, 0xFFE5, 0xA3A4,
 	0, 0
 };
+#else
+static const WORD u2oidx936[] = {	/* Unicode to OEM code map index (block number + 1 of each 64 code points, 0:no char) */
+	0, 0, 1, 2, 3, 4, 0, 5, 0, 6, 0, 7, 0, 0, 8, 9,
+	10, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	12, 0, 13, 0, 14, 15, 16, 0, 17, 18, 19, 0, 20, 0, 0, 0,
+	0, 21, 22, 0, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	29, 30, 31, 32, 33, 0, 0, 0, 34, 0, 35, 0, 0, 0, 36, 37,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 38, 39, 40, 41, 42, 43, 44, 45,
+	46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+	62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+	78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93,
+	94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+	110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+	126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+	142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+	158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+	174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+	190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+	206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+	222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237,
+	238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+	254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+	270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+	286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+	302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+	318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333,
+	334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+	350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 365, 366, 367, 368, 369, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 370, 371, 0, 0, 372, 373, 0, 374
+};
+static const WCHAR u2oblk936[] = {	/* Unicode to OEM code map blocks (64 code points each, 0:no char) */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA1E8, 0x0000, 0x0000, 0xA1EC, 0xA1A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1E3, 0xA1C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA8A4, 0xA8A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A8, 0xA8A6, 0xA8BA, 0x0000, 0xA8AC, 0xA8AA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA8B0, 0xA8AE, 0x0000, 0x0000, 0x0000, 0xA1C2, 0x0000, 0xA8B4, 0xA8B2, 0x0000, 0xA8B9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA8A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA8A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA8BD, 0x0000, 0x0000, 0x0000, 0xA8BE, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8AD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8B1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A3, 0x0000,
+	0xA8AB, 0x0000, 0xA8AF, 0x0000, 0xA8B3, 0x0000, 0xA8B5, 0x0000, 0xA8B6, 0x0000, 0xA8B7, 0x0000, 0xA8B8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA8BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA8C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1A6, 0x0000, 0xA1A5, 0xA840, 0xA841, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA6A1, 0xA6A2, 0xA6A3, 0xA6A4, 0xA6A5, 0xA6A6, 0xA6A7, 0xA6A8, 0xA6A9, 0xA6AA, 0xA6AB, 0xA6AC, 0xA6AD, 0xA6AE, 0xA6AF,
+	0xA6B0, 0xA6B1, 0x0000, 0xA6B2, 0xA6B3, 0xA6B4, 0xA6B5, 0xA6B6, 0xA6B7, 0xA6B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA6C1, 0xA6C2, 0xA6C3, 0xA6C4, 0xA6C5, 0xA6C6, 0xA6C7, 0xA6C8, 0xA6C9, 0xA6CA, 0xA6CB, 0xA6CC, 0xA6CD, 0xA6CE, 0xA6CF,
+	0xA6D0, 0xA6D1, 0x0000, 0xA6D2, 0xA6D3, 0xA6D4, 0xA6D5, 0xA6D6, 0xA6D7, 0xA6D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA7A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA7A1, 0xA7A2, 0xA7A3, 0xA7A4, 0xA7A5, 0xA7A6, 0xA7A8, 0xA7A9, 0xA7AA, 0xA7AB, 0xA7AC, 0xA7AD, 0xA7AE, 0xA7AF, 0xA7B0, 0xA7B1,
+	0xA7B2, 0xA7B3, 0xA7B4, 0xA7B5, 0xA7B6, 0xA7B7, 0xA7B8, 0xA7B9, 0xA7BA, 0xA7BB, 0xA7BC, 0xA7BD, 0xA7BE, 0xA7BF, 0xA7C0, 0xA7C1,
+	0xA7D1, 0xA7D2, 0xA7D3, 0xA7D4, 0xA7D5, 0xA7D6, 0xA7D8, 0xA7D9, 0xA7DA, 0xA7DB, 0xA7DC, 0xA7DD, 0xA7DE, 0xA7DF, 0xA7E0, 0xA7E1,
+	0xA7E2, 0xA7E3, 0xA7E4, 0xA7E5, 0xA7E6, 0xA7E7, 0xA7E8, 0xA7E9, 0xA7EA, 0xA7EB, 0xA7EC, 0xA7ED, 0xA7EE, 0xA7EF, 0xA7F0, 0xA7F1,
+	0x0000, 0xA7D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA95C, 0x0000, 0x0000, 0xA843, 0xA1AA, 0xA844, 0xA1AC, 0x0000, 0xA1AE, 0xA1AF, 0x0000, 0x0000, 0xA1B0, 0xA1B1, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA845, 0xA1AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1EB, 0x0000, 0xA1E4, 0xA1E5, 0x0000, 0xA846, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1F9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA1E6, 0x0000, 0xA847, 0x0000, 0x0000, 0x0000, 0xA848, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA959, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2F1, 0xA2F2, 0xA2F3, 0xA2F4, 0xA2F5, 0xA2F6, 0xA2F7, 0xA2F8, 0xA2F9, 0xA2FA, 0xA2FB, 0xA2FC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2A1, 0xA2A2, 0xA2A3, 0xA2A4, 0xA2A5, 0xA2A6, 0xA2A7, 0xA2A8, 0xA2A9, 0xA2AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1FB, 0xA1FC, 0xA1FA, 0xA1FD, 0x0000, 0x0000, 0xA849, 0xA84A, 0xA84B, 0xA84C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1C7,
+	0x0000, 0xA1C6, 0x0000, 0x0000, 0x0000, 0xA84D, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1CC, 0x0000, 0x0000, 0xA1D8, 0xA1DE, 0xA84E,
+	0xA1CF, 0x0000, 0x0000, 0xA84F, 0x0000, 0xA1CE, 0x0000, 0xA1C4, 0xA1C5, 0xA1C9, 0xA1C8, 0xA1D2, 0x0000, 0x0000, 0xA1D3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA1E0, 0xA1DF, 0xA1C3, 0xA1CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D6, 0x0000, 0x0000, 0x0000, 0xA1D5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA850, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1D9, 0xA1D4, 0x0000, 0x0000, 0xA1DC, 0xA1DD, 0xA851, 0xA852, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1DA, 0xA1DB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA892, 0x0000, 0x0000, 0x0000, 0xA1D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA853,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2D9, 0xA2DA, 0xA2DB, 0xA2DC, 0xA2DD, 0xA2DE, 0xA2DF, 0xA2E0, 0xA2E1, 0xA2E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA2C5, 0xA2C6, 0xA2C7, 0xA2C8, 0xA2C9, 0xA2CA, 0xA2CB, 0xA2CC, 0xA2CD, 0xA2CE, 0xA2CF, 0xA2D0,
+	0xA2D1, 0xA2D2, 0xA2D3, 0xA2D4, 0xA2D5, 0xA2D6, 0xA2D7, 0xA2D8, 0xA2B1, 0xA2B2, 0xA2B3, 0xA2B4, 0xA2B5, 0xA2B6, 0xA2B7, 0xA2B8,
+	0xA2B9, 0xA2BA, 0xA2BB, 0xA2BC, 0xA2BD, 0xA2BE, 0xA2BF, 0xA2C0, 0xA2C1, 0xA2C2, 0xA2C3, 0xA2C4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA9A4, 0xA9A5, 0xA9A6, 0xA9A7, 0xA9A8, 0xA9A9, 0xA9AA, 0xA9AB, 0xA9AC, 0xA9AD, 0xA9AE, 0xA9AF, 0xA9B0, 0xA9B1, 0xA9B2, 0xA9B3,
+	0xA9B4, 0xA9B5, 0xA9B6, 0xA9B7, 0xA9B8, 0xA9B9, 0xA9BA, 0xA9BB, 0xA9BC, 0xA9BD, 0xA9BE, 0xA9BF, 0xA9C0, 0xA9C1, 0xA9C2, 0xA9C3,
+	0xA9C4, 0xA9C5, 0xA9C6, 0xA9C7, 0xA9C8, 0xA9C9, 0xA9CA, 0xA9CB, 0xA9CC, 0xA9CD, 0xA9CE, 0xA9CF, 0xA9D0, 0xA9D1, 0xA9D2, 0xA9D3,
+	0xA9D4, 0xA9D5, 0xA9D6, 0xA9D7, 0xA9D8, 0xA9D9, 0xA9DA, 0xA9DB, 0xA9DC, 0xA9DD, 0xA9DE, 0xA9DF, 0xA9E0, 0xA9E1, 0xA9E2, 0xA9E3,
+	0xA9E4, 0xA9E5, 0xA9E6, 0xA9E7, 0xA9E8, 0xA9E9, 0xA9EA, 0xA9EB, 0xA9EC, 0xA9ED, 0xA9EE, 0xA9EF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA854, 0xA855, 0xA856, 0xA857, 0xA858, 0xA859, 0xA85A, 0xA85B, 0xA85C, 0xA85D, 0xA85E, 0xA85F, 0xA860, 0xA861, 0xA862, 0xA863,
+	0xA864, 0xA865, 0xA866, 0xA867, 0xA868, 0xA869, 0xA86A, 0xA86B, 0xA86C, 0xA86D, 0xA86E, 0xA86F, 0xA870, 0xA871, 0xA872, 0xA873,
+	0xA874, 0xA875, 0xA876, 0xA877, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA878, 0xA879, 0xA87A, 0xA87B, 0xA87C, 0xA87D, 0xA87E, 0xA880, 0xA881, 0xA882, 0xA883, 0xA884, 0xA885, 0xA886, 0xA887,
+	0x0000, 0x0000, 0x0000, 0xA888, 0xA889, 0xA88A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1F6, 0xA1F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1F8, 0xA1F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA88B, 0xA88C, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1F4, 0xA1F3, 0x0000, 0x0000, 0x0000, 0xA1F0, 0x0000, 0x0000, 0xA1F2, 0xA1F1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA88D, 0xA88E, 0xA88F, 0xA890, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1EF, 0xA1EE, 0x0000, 0x0000, 0xA891, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1E2, 0x0000, 0xA1E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1A1, 0xA1A2, 0xA1A3, 0xA1A8, 0x0000, 0xA1A9, 0xA965, 0xA996, 0xA1B4, 0xA1B5, 0xA1B6, 0xA1B7, 0xA1B8, 0xA1B9, 0xA1BA, 0xA1BB,
+	0xA1BE, 0xA1BF, 0xA893, 0xA1FE, 0xA1B2, 0xA1B3, 0xA1BC, 0xA1BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA894, 0xA895, 0x0000,
+	0x0000, 0xA940, 0xA941, 0xA942, 0xA943, 0xA944, 0xA945, 0xA946, 0xA947, 0xA948, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA4A1, 0xA4A2, 0xA4A3, 0xA4A4, 0xA4A5, 0xA4A6, 0xA4A7, 0xA4A8, 0xA4A9, 0xA4AA, 0xA4AB, 0xA4AC, 0xA4AD, 0xA4AE, 0xA4AF,
+	0xA4B0, 0xA4B1, 0xA4B2, 0xA4B3, 0xA4B4, 0xA4B5, 0xA4B6, 0xA4B7, 0xA4B8, 0xA4B9, 0xA4BA, 0xA4BB, 0xA4BC, 0xA4BD, 0xA4BE, 0xA4BF,
+	0xA4C0, 0xA4C1, 0xA4C2, 0xA4C3, 0xA4C4, 0xA4C5, 0xA4C6, 0xA4C7, 0xA4C8, 0xA4C9, 0xA4CA, 0xA4CB, 0xA4CC, 0xA4CD, 0xA4CE, 0xA4CF,
+	0xA4D0, 0xA4D1, 0xA4D2, 0xA4D3, 0xA4D4, 0xA4D5, 0xA4D6, 0xA4D7, 0xA4D8, 0xA4D9, 0xA4DA, 0xA4DB, 0xA4DC, 0xA4DD, 0xA4DE, 0xA4DF,
+	0xA4E0, 0xA4E1, 0xA4E2, 0xA4E3, 0xA4E4, 0xA4E5, 0xA4E6, 0xA4E7, 0xA4E8, 0xA4E9, 0xA4EA, 0xA4EB, 0xA4EC, 0xA4ED, 0xA4EE, 0xA4EF,
+	0xA4F0, 0xA4F1, 0xA4F2, 0xA4F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA961, 0xA962, 0xA966, 0xA967, 0x0000,
+	0x0000, 0xA5A1, 0xA5A2, 0xA5A3, 0xA5A4, 0xA5A5, 0xA5A6, 0xA5A7, 0xA5A8, 0xA5A9, 0xA5AA, 0xA5AB, 0xA5AC, 0xA5AD, 0xA5AE, 0xA5AF,
+	0xA5B0, 0xA5B1, 0xA5B2, 0xA5B3, 0xA5B4, 0xA5B5, 0xA5B6, 0xA5B7, 0xA5B8, 0xA5B9, 0xA5BA, 0xA5BB, 0xA5BC, 0xA5BD, 0xA5BE, 0xA5BF,
+	0xA5C0, 0xA5C1, 0xA5C2, 0xA5C3, 0xA5C4, 0xA5C5, 0xA5C6, 0xA5C7, 0xA5C8, 0xA5C9, 0xA5CA, 0xA5CB, 0xA5CC, 0xA5CD, 0xA5CE, 0xA5CF,
+	0xA5D0, 0xA5D1, 0xA5D2, 0xA5D3, 0xA5D4, 0xA5D5, 0xA5D6, 0xA5D7, 0xA5D8, 0xA5D9, 0xA5DA, 0xA5DB, 0xA5DC, 0xA5DD, 0xA5DE, 0xA5DF,
+	0xA5E0, 0xA5E1, 0xA5E2, 0xA5E3, 0xA5E4, 0xA5E5, 0xA5E6, 0xA5E7, 0xA5E8, 0xA5E9, 0xA5EA, 0xA5EB, 0xA5EC, 0xA5ED, 0xA5EE, 0xA5EF,
+	0xA5F0, 0xA5F1, 0xA5F2, 0xA5F3, 0xA5F4, 0xA5F5, 0xA5F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA960, 0xA963, 0xA964, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8C5, 0xA8C6, 0xA8C7, 0xA8C8, 0xA8C9, 0xA8CA, 0xA8CB, 0xA8CC, 0xA8CD, 0xA8CE, 0xA8CF,
+	0xA8D0, 0xA8D1, 0xA8D2, 0xA8D3, 0xA8D4, 0xA8D5, 0xA8D6, 0xA8D7, 0xA8D8, 0xA8D9, 0xA8DA, 0xA8DB, 0xA8DC, 0xA8DD, 0xA8DE, 0xA8DF,
+	0xA8E0, 0xA8E1, 0xA8E2, 0xA8E3, 0xA8E4, 0xA8E5, 0xA8E6, 0xA8E7, 0xA8E8, 0xA8E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2E5, 0xA2E6, 0xA2E7, 0xA2E8, 0xA2E9, 0xA2EA, 0xA2EB, 0xA2EC, 0xA2ED, 0xA2EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA95A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA949, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA94A, 0xA94B,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA94C, 0xA94D, 0xA94E, 0x0000,
+	0x0000, 0xA94F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA950, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA951, 0x0000,
+	0x0000, 0xA952, 0xA953, 0x0000, 0x0000, 0xA954, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD2BB, 0xB6A1, 0x8140, 0xC6DF, 0x8141, 0x8142, 0x8143, 0xCDF2, 0xD5C9, 0xC8FD, 0xC9CF, 0xCFC2, 0xD8A2, 0xB2BB, 0xD3EB, 0x8144,
+	0xD8A4, 0xB3F3, 0x8145, 0xD7A8, 0xC7D2, 0xD8A7, 0xCAC0, 0x8146, 0xC7F0, 0xB1FB, 0xD2B5, 0xB4D4, 0xB6AB, 0xCBBF, 0xD8A9, 0x8147,
+	0x8148, 0x8149, 0xB6AA, 0x814A, 0xC1BD, 0xD1CF, 0x814B, 0xC9A5, 0xD8AD, 0x814C, 0xB8F6, 0xD1BE, 0xE3DC, 0xD6D0, 0x814D, 0x814E,
+	0xB7E1, 0x814F, 0xB4AE, 0x8150, 0xC1D9, 0x8151, 0xD8BC, 0x8152, 0xCDE8, 0xB5A4, 0xCEAA, 0xD6F7, 0x8153, 0xC0F6, 0xBED9, 0xD8AF,
+	0x8154, 0x8155, 0x8156, 0xC4CB, 0x8157, 0xBEC3, 0x8158, 0xD8B1, 0xC3B4, 0xD2E5, 0x8159, 0xD6AE, 0xCEDA, 0xD5A7, 0xBAF5, 0xB7A6,
+	0xC0D6, 0x815A, 0xC6B9, 0xC5D2, 0xC7C7, 0x815B, 0xB9D4, 0x815C, 0xB3CB, 0xD2D2, 0x815D, 0x815E, 0xD8BF, 0xBEC5, 0xC6F2, 0xD2B2,
+	0xCFB0, 0xCFE7, 0x815F, 0x8160, 0x8161, 0x8162, 0xCAE9, 0x8163, 0x8164, 0xD8C0, 0x8165, 0x8166, 0x8167, 0x8168, 0x8169, 0x816A,
+	0xC2F2, 0xC2D2, 0x816B, 0xC8E9, 0x816C, 0x816D, 0x816E, 0x816F, 0x8170, 0x8171, 0x8172, 0x8173, 0x8174, 0x8175, 0xC7AC, 0x8176,
+	0x8177, 0x8178, 0x8179, 0x817A, 0x817B, 0x817C, 0xC1CB, 0x817D, 0xD3E8, 0xD5F9, 0x817E, 0xCAC2, 0xB6FE, 0xD8A1, 0xD3DA, 0xBFF7,
+	0x8180, 0xD4C6, 0xBBA5, 0xD8C1, 0xCEE5, 0xBEAE, 0x8181, 0x8182, 0xD8A8, 0x8183, 0xD1C7, 0xD0A9, 0x8184, 0x8185, 0x8186, 0xD8BD,
+	0xD9EF, 0xCDF6, 0xBFBA, 0x8187, 0xBDBB, 0xBAA5, 0xD2E0, 0xB2FA, 0xBAE0, 0xC4B6, 0x8188, 0xCFED, 0xBEA9, 0xCDA4, 0xC1C1, 0x8189,
+	0x818A, 0x818B, 0xC7D7, 0xD9F1, 0x818C, 0xD9F4, 0x818D, 0x818E, 0x818F, 0x8190, 0xC8CB, 0xD8E9, 0x8191, 0x8192, 0x8193, 0xD2DA,
+	0xCAB2, 0xC8CA, 0xD8EC, 0xD8EA, 0xD8C6, 0xBDF6, 0xC6CD, 0xB3F0, 0x8194, 0xD8EB, 0xBDF1, 0xBDE9, 0x8195, 0xC8D4, 0xB4D3, 0x8196,
+	0x8197, 0xC2D8, 0x8198, 0xB2D6, 0xD7D0, 0xCACB, 0xCBFB, 0xD5CC, 0xB8B6, 0xCFC9, 0x8199, 0x819A, 0x819B, 0xD9DA, 0xD8F0, 0xC7AA,
+	0x819C, 0xD8EE, 0x819D, 0xB4FA, 0xC1EE, 0xD2D4, 0x819E, 0x819F, 0xD8ED, 0x81A0, 0xD2C7, 0xD8EF, 0xC3C7, 0x81A1, 0x81A2, 0x81A3,
+	0xD1F6, 0x81A4, 0xD6D9, 0xD8F2, 0x81A5, 0xD8F5, 0xBCFE, 0xBCDB, 0x81A6, 0x81A7, 0x81A8, 0xC8CE, 0x81A9, 0xB7DD, 0x81AA, 0xB7C2,
+	0x81AB, 0xC6F3, 0x81AC, 0x81AD, 0x81AE, 0x81AF, 0x81B0, 0x81B1, 0x81B2, 0xD8F8, 0xD2C1, 0x81B3, 0x81B4, 0xCEE9, 0xBCBF, 0xB7FC,
+	0xB7A5, 0xD0DD, 0x81B5, 0x81B6, 0x81B7, 0x81B8, 0x81B9, 0xD6DA, 0xD3C5, 0xBBEF, 0xBBE1, 0xD8F1, 0x81BA, 0x81BB, 0xC9A1, 0xCEB0,
+	0xB4AB, 0x81BC, 0xD8F3, 0x81BD, 0xC9CB, 0xD8F6, 0xC2D7, 0xD8F7, 0x81BE, 0x81BF, 0xCEB1, 0xD8F9, 0x81C0, 0x81C1, 0x81C2, 0xB2AE,
+	0xB9C0, 0x81C3, 0xD9A3, 0x81C4, 0xB0E9, 0x81C5, 0xC1E6, 0x81C6, 0xC9EC, 0x81C7, 0xCBC5, 0x81C8, 0xCBC6, 0xD9A4, 0x81C9, 0x81CA,
+	0x81CB, 0x81CC, 0x81CD, 0xB5E8, 0x81CE, 0x81CF, 0xB5AB, 0x81D0, 0x81D1, 0x81D2, 0x81D3, 0x81D4, 0x81D5, 0xCEBB, 0xB5CD, 0xD7A1,
+	0xD7F4, 0xD3D3, 0x81D6, 0xCCE5, 0x81D7, 0xBACE, 0x81D8, 0xD9A2, 0xD9DC, 0xD3E0, 0xD8FD, 0xB7F0, 0xD7F7, 0xD8FE, 0xD8FA, 0xD9A1,
+	0xC4E3, 0x81D9, 0x81DA, 0xD3B6, 0xD8F4, 0xD9DD, 0x81DB, 0xD8FB, 0x81DC, 0xC5E5, 0x81DD, 0x81DE, 0xC0D0, 0x81DF, 0x81E0, 0xD1F0,
+	0xB0DB, 0x81E1, 0x81E2, 0xBCD1, 0xD9A6, 0x81E3, 0xD9A5, 0x81E4, 0x81E5, 0x81E6, 0x81E7, 0xD9AC, 0xD9AE, 0x81E8, 0xD9AB, 0xCAB9,
+	0x81E9, 0x81EA, 0x81EB, 0xD9A9, 0xD6B6, 0x81EC, 0x81ED, 0x81EE, 0xB3DE, 0xD9A8, 0x81EF, 0xC0FD, 0x81F0, 0xCACC, 0x81F1, 0xD9AA,
+	0x81F2, 0xD9A7, 0x81F3, 0x81F4, 0xD9B0, 0x81F5, 0x81F6, 0xB6B1, 0x81F7, 0x81F8, 0x81F9, 0xB9A9, 0x81FA, 0xD2C0, 0x81FB, 0x81FC,
+	0xCFC0, 0x81FD, 0x81FE, 0xC2C2, 0x8240, 0xBDC4, 0xD5EC, 0xB2E0, 0xC7C8, 0xBFEB, 0xD9AD, 0x8241, 0xD9AF, 0x8242, 0xCEEA, 0xBAEE,
+	0x8243, 0x8244, 0x8245, 0x8246, 0x8247, 0xC7D6, 0x8248, 0x8249, 0x824A, 0x824B, 0x824C, 0x824D, 0x824E, 0x824F, 0x8250, 0xB1E3,
+	0x8251, 0x8252, 0x8253, 0xB4D9, 0xB6ED, 0xD9B4, 0x8254, 0x8255, 0x8256, 0x8257, 0xBFA1, 0x8258, 0x8259, 0x825A, 0xD9DE, 0xC7CE,
+	0xC0FE, 0xD9B8, 0x825B, 0x825C, 0x825D, 0x825E, 0x825F, 0xCBD7, 0xB7FD, 0x8260, 0xD9B5, 0x8261, 0xD9B7, 0xB1A3, 0xD3E1, 0xD9B9,
+	0x8262, 0xD0C5, 0x8263, 0xD9B6, 0x8264, 0x8265, 0xD9B1, 0x8266, 0xD9B2, 0xC1A9, 0xD9B3, 0x8267, 0x8268, 0xBCF3, 0xD0DE, 0xB8A9,
+	0x8269, 0xBEE3, 0x826A, 0xD9BD, 0x826B, 0x826C, 0x826D, 0x826E, 0xD9BA, 0x826F, 0xB0B3, 0x8270, 0x8271, 0x8272, 0xD9C2, 0x8273,
+	0x8274, 0x8275, 0x8276, 0x8277, 0x8278, 0x8279, 0x827A, 0x827B, 0x827C, 0x827D, 0x827E, 0x8280, 0xD9C4, 0xB1B6, 0x8281, 0xD9BF,
+	0x8282, 0x8283, 0xB5B9, 0x8284, 0xBEF3, 0x8285, 0x8286, 0x8287, 0xCCC8, 0xBAF2, 0xD2D0, 0x8288, 0xD9C3, 0x8289, 0x828A, 0xBDE8,
+	0x828B, 0xB3AB, 0x828C, 0x828D, 0x828E, 0xD9C5, 0xBEEB, 0x828F, 0xD9C6, 0xD9BB, 0xC4DF, 0x8290, 0xD9BE, 0xD9C1, 0xD9C0, 0x8291,
+	0x8292, 0x8293, 0x8294, 0x8295, 0x8296, 0x8297, 0x8298, 0x8299, 0x829A, 0x829B, 0xD5AE, 0x829C, 0xD6B5, 0x829D, 0xC7E3, 0x829E,
+	0x829F, 0x82A0, 0x82A1, 0xD9C8, 0x82A2, 0x82A3, 0x82A4, 0xBCD9, 0xD9CA, 0x82A5, 0x82A6, 0x82A7, 0xD9BC, 0x82A8, 0xD9CB, 0xC6AB,
+	0x82A9, 0x82AA, 0x82AB, 0x82AC, 0x82AD, 0xD9C9, 0x82AE, 0x82AF, 0x82B0, 0x82B1, 0xD7F6, 0x82B2, 0xCDA3, 0x82B3, 0x82B4, 0x82B5,
+	0x82B6, 0x82B7, 0x82B8, 0x82B9, 0x82BA, 0xBDA1, 0x82BB, 0x82BC, 0x82BD, 0x82BE, 0x82BF, 0x82C0, 0xD9CC, 0x82C1, 0x82C2, 0x82C3,
+	0x82C4, 0x82C5, 0x82C6, 0x82C7, 0x82C8, 0x82C9, 0xC5BC, 0xCDB5, 0x82CA, 0x82CB, 0x82CC, 0xD9CD, 0x82CD, 0x82CE, 0xD9C7, 0xB3A5,
+	0xBFFE, 0x82CF, 0x82D0, 0x82D1, 0x82D2, 0xB8B5, 0x82D3, 0x82D4, 0xC0FC, 0x82D5, 0x82D6, 0x82D7, 0x82D8, 0xB0F8, 0x82D9, 0x82DA,
+	0x82DB, 0x82DC, 0x82DD, 0x82DE, 0x82DF, 0x82E0, 0x82E1, 0x82E2, 0x82E3, 0x82E4, 0x82E5, 0x82E6, 0x82E7, 0x82E8, 0x82E9, 0x82EA,
+	0x82EB, 0x82EC, 0x82ED, 0xB4F6, 0x82EE, 0xD9CE, 0x82EF, 0xD9CF, 0xB4A2, 0xD9D0, 0x82F0, 0x82F1, 0xB4DF, 0x82F2, 0x82F3, 0x82F4,
+	0x82F5, 0x82F6, 0xB0C1, 0x82F7, 0x82F8, 0x82F9, 0x82FA, 0x82FB, 0x82FC, 0x82FD, 0xD9D1, 0xC9B5, 0x82FE, 0x8340, 0x8341, 0x8342,
+	0x8343, 0x8344, 0x8345, 0x8346, 0x8347, 0x8348, 0x8349, 0x834A, 0x834B, 0x834C, 0x834D, 0x834E, 0x834F, 0x8350, 0x8351, 0xCFF1,
+	0x8352, 0x8353, 0x8354, 0x8355, 0x8356, 0x8357, 0xD9D2, 0x8358, 0x8359, 0x835A, 0xC1C5, 0x835B, 0x835C, 0x835D, 0x835E, 0x835F,
+	0x8360, 0x8361, 0x8362, 0x8363, 0x8364, 0x8365, 0xD9D6, 0xC9AE, 0x8366, 0x8367, 0x8368, 0x8369, 0xD9D5, 0xD9D4, 0xD9D7, 0x836A,
+	0x836B, 0x836C, 0x836D, 0xCBDB, 0x836E, 0xBDA9, 0x836F, 0x8370, 0x8371, 0x8372, 0x8373, 0xC6A7, 0x8374, 0x8375, 0x8376, 0x8377,
+	0x8378, 0x8379, 0x837A, 0x837B, 0x837C, 0x837D, 0xD9D3, 0xD9D8, 0x837E, 0x8380, 0x8381, 0xD9D9, 0x8382, 0x8383, 0x8384, 0x8385,
+	0x8386, 0x8387, 0xC8E5, 0x8388, 0x8389, 0x838A, 0x838B, 0x838C, 0x838D, 0x838E, 0x838F, 0x8390, 0x8391, 0x8392, 0x8393, 0x8394,
+	0x8395, 0xC0DC, 0x8396, 0x8397, 0x8398, 0x8399, 0x839A, 0x839B, 0x839C, 0x839D, 0x839E, 0x839F, 0x83A0, 0x83A1, 0x83A2, 0x83A3,
+	0x83A4, 0x83A5, 0x83A6, 0x83A7, 0x83A8, 0x83A9, 0x83AA, 0x83AB, 0x83AC, 0x83AD, 0x83AE, 0x83AF, 0x83B0, 0x83B1, 0x83B2, 0xB6F9,
+	0xD8A3, 0xD4CA, 0x83B3, 0xD4AA, 0xD0D6, 0xB3E4, 0xD5D7, 0x83B4, 0xCFC8, 0xB9E2, 0x83B5, 0xBFCB, 0x83B6, 0xC3E2, 0x83B7, 0x83B8,
+	0x83B9, 0xB6D2, 0x83BA, 0x83BB, 0xCDC3, 0xD9EE, 0xD9F0, 0x83BC, 0x83BD, 0x83BE, 0xB5B3, 0x83BF, 0xB6B5, 0x83C0, 0x83C1, 0x83C2,
+	0x83C3, 0x83C4, 0xBEA4, 0x83C5, 0x83C6, 0xC8EB, 0x83C7, 0x83C8, 0xC8AB, 0x83C9, 0x83CA, 0xB0CB, 0xB9AB, 0xC1F9, 0xD9E2, 0x83CB,
+	0xC0BC, 0xB9B2, 0x83CC, 0xB9D8, 0xD0CB, 0xB1F8, 0xC6E4, 0xBEDF, 0xB5E4, 0xD7C8, 0x83CD, 0xD1F8, 0xBCE6, 0xCADE, 0x83CE, 0x83CF,
+	0xBCBD, 0xD9E6, 0xD8E7, 0x83D0, 0x83D1, 0xC4DA, 0x83D2, 0x83D3, 0xB8D4, 0xC8BD, 0x83D4, 0x83D5, 0xB2E1, 0xD4D9, 0x83D6, 0x83D7,
+	0x83D8, 0x83D9, 0xC3B0, 0x83DA, 0x83DB, 0xC3E1, 0xDAA2, 0xC8DF, 0x83DC, 0xD0B4, 0x83DD, 0xBEFC, 0xC5A9, 0x83DE, 0x83DF, 0x83E0,
+	0xB9DA, 0x83E1, 0xDAA3, 0x83E2, 0xD4A9, 0xDAA4, 0x83E3, 0x83E4, 0x83E5, 0x83E6, 0x83E7, 0xD9FB, 0xB6AC, 0x83E8, 0x83E9, 0xB7EB,
+	0xB1F9, 0xD9FC, 0xB3E5, 0xBEF6, 0x83EA, 0xBFF6, 0xD2B1, 0xC0E4, 0x83EB, 0x83EC, 0x83ED, 0xB6B3, 0xD9FE, 0xD9FD, 0x83EE, 0x83EF,
+	0xBEBB, 0x83F0, 0x83F1, 0x83F2, 0xC6E0, 0x83F3, 0xD7BC, 0xDAA1, 0x83F4, 0xC1B9, 0x83F5, 0xB5F2, 0xC1E8, 0x83F6, 0x83F7, 0xBCF5,
+	0x83F8, 0xB4D5, 0x83F9, 0x83FA, 0x83FB, 0x83FC, 0x83FD, 0x83FE, 0x8440, 0x8441, 0x8442, 0xC1DD, 0x8443, 0xC4FD, 0x8444, 0x8445,
+	0xBCB8, 0xB7B2, 0x8446, 0x8447, 0xB7EF, 0x8448, 0x8449, 0x844A, 0x844B, 0x844C, 0x844D, 0xD9EC, 0x844E, 0xC6BE, 0x844F, 0xBFAD,
+	0xBBCB, 0x8450, 0x8451, 0xB5CA, 0x8452, 0xDBC9, 0xD0D7, 0x8453, 0xCDB9, 0xB0BC, 0xB3F6, 0xBBF7, 0xDBCA, 0xBAAF, 0x8454, 0xD4E4,
+	0xB5B6, 0xB5F3, 0xD8D6, 0xC8D0, 0x8455, 0x8456, 0xB7D6, 0xC7D0, 0xD8D7, 0x8457, 0xBFAF, 0x8458, 0x8459, 0xDBBB, 0xD8D8, 0x845A,
+	0x845B, 0xD0CC, 0xBBAE, 0x845C, 0x845D, 0x845E, 0xEBBE, 0xC1D0, 0xC1F5, 0xD4F2, 0xB8D5, 0xB4B4, 0x845F, 0xB3F5, 0x8460, 0x8461,
+	0xC9BE, 0x8462, 0x8463, 0x8464, 0xC5D0, 0x8465, 0x8466, 0x8467, 0xC5D9, 0xC0FB, 0x8468, 0xB1F0, 0x8469, 0xD8D9, 0xB9CE, 0x846A,
+	0xB5BD, 0x846B, 0x846C, 0xD8DA, 0x846D, 0x846E, 0xD6C6, 0xCBA2, 0xC8AF, 0xC9B2, 0xB4CC, 0xBFCC, 0x846F, 0xB9F4, 0x8470, 0xD8DB,
+	0xD8DC, 0xB6E7, 0xBCC1, 0xCCEA, 0x8471, 0x8472, 0x8473, 0x8474, 0x8475, 0x8476, 0xCFF7, 0x8477, 0xD8DD, 0xC7B0, 0x8478, 0x8479,
+	0xB9D0, 0xBDA3, 0x847A, 0x847B, 0xCCDE, 0x847C, 0xC6CA, 0x847D, 0x847E, 0x8480, 0x8481, 0x8482, 0xD8E0, 0x8483, 0xD8DE, 0x8484,
+	0x8485, 0xD8DF, 0x8486, 0x8487, 0x8488, 0xB0FE, 0x8489, 0xBEE7, 0x848A, 0xCAA3, 0xBCF4, 0x848B, 0x848C, 0x848D, 0x848E, 0xB8B1,
+	0x848F, 0x8490, 0xB8EE, 0x8491, 0x8492, 0x8493, 0x8494, 0x8495, 0x8496, 0x8497, 0x8498, 0x8499, 0x849A, 0xD8E2, 0x849B, 0xBDCB,
+	0x849C, 0xD8E4, 0xD8E3, 0x849D, 0x849E, 0x849F, 0x84A0, 0x84A1, 0xC5FC, 0x84A2, 0x84A3, 0x84A4, 0x84A5, 0x84A6, 0x84A7, 0x84A8,
+	0xD8E5, 0x84A9, 0x84AA, 0xD8E6, 0x84AB, 0x84AC, 0x84AD, 0x84AE, 0x84AF, 0x84B0, 0x84B1, 0xC1A6, 0x84B2, 0xC8B0, 0xB0EC, 0xB9A6,
+	0xBCD3, 0xCEF1, 0xDBBD, 0xC1D3, 0x84B3, 0x84B4, 0x84B5, 0x84B6, 0xB6AF, 0xD6FA, 0xC5AC, 0xBDD9, 0xDBBE, 0xDBBF, 0x84B7, 0x84B8,
+	0x84B9, 0xC0F8, 0xBEA2, 0xC0CD, 0x84BA, 0x84BB, 0x84BC, 0x84BD, 0x84BE, 0x84BF, 0x84C0, 0x84C1, 0x84C2, 0x84C3, 0xDBC0, 0xCAC6,
+	0x84C4, 0x84C5, 0x84C6, 0xB2AA, 0x84C7, 0x84C8, 0x84C9, 0xD3C2, 0x84CA, 0xC3E3, 0x84CB, 0xD1AB, 0x84CC, 0x84CD, 0x84CE, 0x84CF,
+	0xDBC2, 0x84D0, 0xC0D5, 0x84D1, 0x84D2, 0x84D3, 0xDBC3, 0x84D4, 0xBFB1, 0x84D5, 0x84D6, 0x84D7, 0x84D8, 0x84D9, 0x84DA, 0xC4BC,
+	0x84DB, 0x84DC, 0x84DD, 0x84DE, 0xC7DA, 0x84DF, 0x84E0, 0x84E1, 0x84E2, 0x84E3, 0x84E4, 0x84E5, 0x84E6, 0x84E7, 0x84E8, 0x84E9,
+	0xDBC4, 0x84EA, 0x84EB, 0x84EC, 0x84ED, 0x84EE, 0x84EF, 0x84F0, 0x84F1, 0xD9E8, 0xC9D7, 0x84F2, 0x84F3, 0x84F4, 0xB9B4, 0xCEF0,
+	0xD4C8, 0x84F5, 0x84F6, 0x84F7, 0x84F8, 0xB0FC, 0xB4D2, 0x84F9, 0xD0D9, 0x84FA, 0x84FB, 0x84FC, 0x84FD, 0xD9E9, 0x84FE, 0xDECB,
+	0xD9EB, 0x8540, 0x8541, 0x8542, 0x8543, 0xD8B0, 0xBBAF, 0xB1B1, 0x8544, 0xB3D7, 0xD8CE, 0x8545, 0x8546, 0xD4D1, 0x8547, 0x8548,
+	0xBDB3, 0xBFEF, 0x8549, 0xCFBB, 0x854A, 0x854B, 0xD8D0, 0x854C, 0x854D, 0x854E, 0xB7CB, 0x854F, 0x8550, 0x8551, 0xD8D1, 0x8552,
+	0x8553, 0x8554, 0x8555, 0x8556, 0x8557, 0x8558, 0x8559, 0x855A, 0x855B, 0xC6A5, 0xC7F8, 0xD2BD, 0x855C, 0x855D, 0xD8D2, 0xC4E4,
+	0x855E, 0xCAAE, 0x855F, 0xC7A7, 0x8560, 0xD8A6, 0x8561, 0xC9FD, 0xCEE7, 0xBBDC, 0xB0EB, 0x8562, 0x8563, 0x8564, 0xBBAA, 0xD0AD,
+	0x8565, 0xB1B0, 0xD7E4, 0xD7BF, 0x8566, 0xB5A5, 0xC2F4, 0xC4CF, 0x8567, 0x8568, 0xB2A9, 0x8569, 0xB2B7, 0x856A, 0xB1E5, 0xDFB2,
+	0xD5BC, 0xBFA8, 0xC2AC, 0xD8D5, 0xC2B1, 0x856B, 0xD8D4, 0xCED4, 0x856C, 0xDAE0, 0x856D, 0xCEC0, 0x856E, 0x856F, 0xD8B4, 0xC3AE,
+	0xD3A1, 0xCEA3, 0x8570, 0xBCB4, 0xC8B4, 0xC2D1, 0x8571, 0xBEED, 0xD0B6, 0x8572, 0xDAE1, 0x8573, 0x8574, 0x8575, 0x8576, 0xC7E4,
+	0x8577, 0x8578, 0xB3A7, 0x8579, 0xB6F2, 0xCCFC, 0xC0FA, 0x857A, 0x857B, 0xC0F7, 0x857C, 0xD1B9, 0xD1E1, 0xD8C7, 0x857D, 0x857E,
+	0x8580, 0x8581, 0x8582, 0x8583, 0x8584, 0xB2DE, 0x8585, 0x8586, 0xC0E5, 0x8587, 0xBAF1, 0x8588, 0x8589, 0xD8C8, 0x858A, 0xD4AD,
+	0x858B, 0x858C, 0xCFE1, 0xD8C9, 0x858D, 0xD8CA, 0xCFC3, 0x858E, 0xB3F8, 0xBEC7, 0x858F, 0x8590, 0x8591, 0x8592, 0xD8CB, 0x8593,
+	0x8594, 0x8595, 0x8596, 0x8597, 0x8598, 0x8599, 0xDBCC, 0x859A, 0x859B, 0x859C, 0x859D, 0xC8A5, 0x859E, 0x859F, 0x85A0, 0xCFD8,
+	0x85A1, 0xC8FE, 0xB2CE, 0x85A2, 0x85A3, 0x85A4, 0x85A5, 0x85A6, 0xD3D6, 0xB2E6, 0xBCB0, 0xD3D1, 0xCBAB, 0xB7B4, 0x85A7, 0x85A8,
+	0x85A9, 0xB7A2, 0x85AA, 0x85AB, 0xCAE5, 0x85AC, 0xC8A1, 0xCADC, 0xB1E4, 0xD0F0, 0x85AD, 0xC5D1, 0x85AE, 0x85AF, 0x85B0, 0xDBC5,
+	0xB5FE, 0x85B1, 0x85B2, 0xBFDA, 0xB9C5, 0xBEE4, 0xC1ED, 0x85B3, 0xDFB6, 0xDFB5, 0xD6BB, 0xBDD0, 0xD5D9, 0xB0C8, 0xB6A3, 0xBFC9,
+	0xCCA8, 0xDFB3, 0xCAB7, 0xD3D2, 0x85B4, 0xD8CF, 0xD2B6, 0xBAC5, 0xCBBE, 0xCCBE, 0x85B5, 0xDFB7, 0xB5F0, 0xDFB4, 0x85B6, 0x85B7,
+	0x85B8, 0xD3F5, 0x85B9, 0xB3D4, 0xB8F7, 0x85BA, 0xDFBA, 0x85BB, 0xBACF, 0xBCAA, 0xB5F5, 0x85BC, 0xCDAC, 0xC3FB, 0xBAF3, 0xC0F4,
+	0xCDC2, 0xCFF2, 0xDFB8, 0xCFC5, 0x85BD, 0xC2C0, 0xDFB9, 0xC2F0, 0x85BE, 0x85BF, 0x85C0, 0xBEFD, 0x85C1, 0xC1DF, 0xCDCC, 0xD2F7,
+	0xB7CD, 0xDFC1, 0x85C2, 0xDFC4, 0x85C3, 0x85C4, 0xB7F1, 0xB0C9, 0xB6D6, 0xB7D4, 0x85C5, 0xBAAC, 0xCCFD, 0xBFD4, 0xCBB1, 0xC6F4,
+	0x85C6, 0xD6A8, 0xDFC5, 0x85C7, 0xCEE2, 0xB3B3, 0x85C8, 0x85C9, 0xCEFC, 0xB4B5, 0x85CA, 0xCEC7, 0xBAF0, 0x85CB, 0xCEE1, 0x85CC,
+	0xD1BD, 0x85CD, 0x85CE, 0xDFC0, 0x85CF, 0x85D0, 0xB4F4, 0x85D1, 0xB3CA, 0x85D2, 0xB8E6, 0xDFBB, 0x85D3, 0x85D4, 0x85D5, 0x85D6,
+	0xC4C5, 0x85D7, 0xDFBC, 0xDFBD, 0xDFBE, 0xC5BB, 0xDFBF, 0xDFC2, 0xD4B1, 0xDFC3, 0x85D8, 0xC7BA, 0xCED8, 0x85D9, 0x85DA, 0x85DB,
+	0x85DC, 0x85DD, 0xC4D8, 0x85DE, 0xDFCA, 0x85DF, 0xDFCF, 0x85E0, 0xD6DC, 0x85E1, 0x85E2, 0x85E3, 0x85E4, 0x85E5, 0x85E6, 0x85E7,
+	0x85E8, 0xDFC9, 0xDFDA, 0xCEB6, 0x85E9, 0xBAC7, 0xDFCE, 0xDFC8, 0xC5DE, 0x85EA, 0x85EB, 0xC9EB, 0xBAF4, 0xC3FC, 0x85EC, 0x85ED,
+	0xBED7, 0x85EE, 0xDFC6, 0x85EF, 0xDFCD, 0x85F0, 0xC5D8, 0x85F1, 0x85F2, 0x85F3, 0x85F4, 0xD5A6, 0xBACD, 0x85F5, 0xBECC, 0xD3BD,
+	0xB8C0, 0x85F6, 0xD6E4, 0x85F7, 0xDFC7, 0xB9BE, 0xBFA7, 0x85F8, 0x85F9, 0xC1FC, 0xDFCB, 0xDFCC, 0x85FA, 0xDFD0, 0x85FB, 0x85FC,
+	0x85FD, 0x85FE, 0x8640, 0xDFDB, 0xDFE5, 0x8641, 0xDFD7, 0xDFD6, 0xD7C9, 0xDFE3, 0xDFE4, 0xE5EB, 0xD2A7, 0xDFD2, 0x8642, 0xBFA9,
+	0x8643, 0xD4DB, 0x8644, 0xBFC8, 0xDFD4, 0x8645, 0x8646, 0x8647, 0xCFCC, 0x8648, 0x8649, 0xDFDD, 0x864A, 0xD1CA, 0x864B, 0xDFDE,
+	0xB0A7, 0xC6B7, 0xDFD3, 0x864C, 0xBAE5, 0x864D, 0xB6DF, 0xCDDB, 0xB9FE, 0xD4D5, 0x864E, 0x864F, 0xDFDF, 0xCFEC, 0xB0A5, 0xDFE7,
+	0xDFD1, 0xD1C6, 0xDFD5, 0xDFD8, 0xDFD9, 0xDFDC, 0x8650, 0xBBA9, 0x8651, 0xDFE0, 0xDFE1, 0x8652, 0xDFE2, 0xDFE6, 0xDFE8, 0xD3B4,
+	0x8653, 0x8654, 0x8655, 0x8656, 0x8657, 0xB8E7, 0xC5B6, 0xDFEA, 0xC9DA, 0xC1A8, 0xC4C4, 0x8658, 0x8659, 0xBFDE, 0xCFF8, 0x865A,
+	0x865B, 0x865C, 0xD5DC, 0xDFEE, 0x865D, 0x865E, 0x865F, 0x8660, 0x8661, 0x8662, 0xB2B8, 0x8663, 0xBADF, 0xDFEC, 0x8664, 0xDBC1,
+	0x8665, 0xD1E4, 0x8666, 0x8667, 0x8668, 0x8669, 0xCBF4, 0xB4BD, 0x866A, 0xB0A6, 0x866B, 0x866C, 0x866D, 0x866E, 0x866F, 0xDFF1,
+	0xCCC6, 0xDFF2, 0x8670, 0x8671, 0xDFED, 0x8672, 0x8673, 0x8674, 0x8675, 0x8676, 0x8677, 0xDFE9, 0x8678, 0x8679, 0x867A, 0x867B,
+	0xDFEB, 0x867C, 0xDFEF, 0xDFF0, 0xBBBD, 0x867D, 0x867E, 0xDFF3, 0x8680, 0x8681, 0xDFF4, 0x8682, 0xBBA3, 0x8683, 0xCADB, 0xCEA8,
+	0xE0A7, 0xB3AA, 0x8684, 0xE0A6, 0x8685, 0x8686, 0x8687, 0xE0A1, 0x8688, 0x8689, 0x868A, 0x868B, 0xDFFE, 0x868C, 0xCDD9, 0xDFFC,
+	0x868D, 0xDFFA, 0x868E, 0xBFD0, 0xD7C4, 0x868F, 0xC9CC, 0x8690, 0x8691, 0xDFF8, 0xB0A1, 0x8692, 0x8693, 0x8694, 0x8695, 0x8696,
+	0xDFFD, 0x8697, 0x8698, 0x8699, 0x869A, 0xDFFB, 0xE0A2, 0x869B, 0x869C, 0x869D, 0x869E, 0x869F, 0xE0A8, 0x86A0, 0x86A1, 0x86A2,
+	0x86A3, 0xB7C8, 0x86A4, 0x86A5, 0xC6A1, 0xC9B6, 0xC0B2, 0xDFF5, 0x86A6, 0x86A7, 0xC5BE, 0x86A8, 0xD8C4, 0xDFF9, 0xC4F6, 0x86A9,
+	0x86AA, 0x86AB, 0x86AC, 0x86AD, 0x86AE, 0xE0A3, 0xE0A4, 0xE0A5, 0xD0A5, 0x86AF, 0x86B0, 0xE0B4, 0xCCE4, 0x86B1, 0xE0B1, 0x86B2,
+	0xBFA6, 0xE0AF, 0xCEB9, 0xE0AB, 0xC9C6, 0x86B3, 0x86B4, 0xC0AE, 0xE0AE, 0xBAED, 0xBAB0, 0xE0A9, 0x86B5, 0x86B6, 0x86B7, 0xDFF6,
+	0x86B8, 0xE0B3, 0x86B9, 0x86BA, 0xE0B8, 0x86BB, 0x86BC, 0x86BD, 0xB4AD, 0xE0B9, 0x86BE, 0x86BF, 0xCFB2, 0xBAC8, 0x86C0, 0xE0B0,
+	0x86C1, 0x86C2, 0x86C3, 0x86C4, 0x86C5, 0x86C6, 0x86C7, 0xD0FA, 0x86C8, 0x86C9, 0x86CA, 0x86CB, 0x86CC, 0x86CD, 0x86CE, 0x86CF,
+	0x86D0, 0xE0AC, 0x86D1, 0xD4FB, 0x86D2, 0xDFF7, 0x86D3, 0xC5E7, 0x86D4, 0xE0AD, 0x86D5, 0xD3F7, 0x86D6, 0xE0B6, 0xE0B7, 0x86D7,
+	0x86D8, 0x86D9, 0x86DA, 0x86DB, 0xE0C4, 0xD0E1, 0x86DC, 0x86DD, 0x86DE, 0xE0BC, 0x86DF, 0x86E0, 0xE0C9, 0xE0CA, 0x86E1, 0x86E2,
+	0x86E3, 0xE0BE, 0xE0AA, 0xC9A4, 0xE0C1, 0x86E4, 0xE0B2, 0x86E5, 0x86E6, 0x86E7, 0x86E8, 0x86E9, 0xCAC8, 0xE0C3, 0x86EA, 0xE0B5,
+	0x86EB, 0xCECB, 0x86EC, 0xCBC3, 0xE0CD, 0xE0C6, 0xE0C2, 0x86ED, 0xE0CB, 0x86EE, 0xE0BA, 0xE0BF, 0xE0C0, 0x86EF, 0x86F0, 0xE0C5,
+	0x86F1, 0x86F2, 0xE0C7, 0xE0C8, 0x86F3, 0xE0CC, 0x86F4, 0xE0BB, 0x86F5, 0x86F6, 0x86F7, 0x86F8, 0x86F9, 0xCBD4, 0xE0D5, 0x86FA,
+	0xE0D6, 0xE0D2, 0x86FB, 0x86FC, 0x86FD, 0x86FE, 0x8740, 0x8741, 0xE0D0, 0xBCCE, 0x8742, 0x8743, 0xE0D1, 0x8744, 0xB8C2, 0xD8C5,
+	0x8745, 0x8746, 0x8747, 0x8748, 0x8749, 0x874A, 0x874B, 0x874C, 0xD0EA, 0x874D, 0x874E, 0xC2EF, 0x874F, 0x8750, 0xE0CF, 0xE0BD,
+	0x8751, 0x8752, 0x8753, 0xE0D4, 0xE0D3, 0x8754, 0x8755, 0xE0D7, 0x8756, 0x8757, 0x8758, 0x8759, 0xE0DC, 0xE0D8, 0x875A, 0x875B,
+	0x875C, 0xD6F6, 0xB3B0, 0x875D, 0xD7EC, 0x875E, 0xCBBB, 0x875F, 0x8760, 0xE0DA, 0x8761, 0xCEFB, 0x8762, 0x8763, 0x8764, 0xBAD9,
+	0x8765, 0x8766, 0x8767, 0x8768, 0x8769, 0x876A, 0x876B, 0x876C, 0x876D, 0x876E, 0x876F, 0x8770, 0xE0E1, 0xE0DD, 0xD2AD, 0x8771,
+	0x8772, 0x8773, 0x8774, 0x8775, 0xE0E2, 0x8776, 0x8777, 0xE0DB, 0xE0D9, 0xE0DF, 0x8778, 0x8779, 0xE0E0, 0x877A, 0x877B, 0x877C,
+	0x877D, 0x877E, 0xE0DE, 0x8780, 0xE0E4, 0x8781, 0x8782, 0x8783, 0xC6F7, 0xD8AC, 0xD4EB, 0xE0E6, 0xCAC9, 0x8784, 0x8785, 0x8786,
+	0x8787, 0xE0E5, 0x8788, 0x8789, 0x878A, 0x878B, 0xB8C1, 0x878C, 0x878D, 0x878E, 0x878F, 0xE0E7, 0xE0E8, 0x8790, 0x8791, 0x8792,
+	0x8793, 0x8794, 0x8795, 0x8796, 0x8797, 0xE0E9, 0xE0E3, 0x8798, 0x8799, 0x879A, 0x879B, 0x879C, 0x879D, 0x879E, 0xBABF, 0xCCE7,
+	0x879F, 0x87A0, 0x87A1, 0xE0EA, 0x87A2, 0x87A3, 0x87A4, 0x87A5, 0x87A6, 0x87A7, 0x87A8, 0x87A9, 0x87AA, 0x87AB, 0x87AC, 0x87AD,
+	0x87AE, 0x87AF, 0x87B0, 0xCFF9, 0x87B1, 0x87B2, 0x87B3, 0x87B4, 0x87B5, 0x87B6, 0x87B7, 0x87B8, 0x87B9, 0x87BA, 0x87BB, 0xE0EB,
+	0x87BC, 0x87BD, 0x87BE, 0x87BF, 0x87C0, 0x87C1, 0x87C2, 0xC8C2, 0x87C3, 0x87C4, 0x87C5, 0x87C6, 0xBDC0, 0x87C7, 0x87C8, 0x87C9,
+	0x87CA, 0x87CB, 0x87CC, 0x87CD, 0x87CE, 0x87CF, 0x87D0, 0x87D1, 0x87D2, 0x87D3, 0xC4D2, 0x87D4, 0x87D5, 0x87D6, 0x87D7, 0x87D8,
+	0x87D9, 0x87DA, 0x87DB, 0x87DC, 0xE0EC, 0x87DD, 0x87DE, 0xE0ED, 0x87DF, 0x87E0, 0xC7F4, 0xCBC4, 0x87E1, 0xE0EE, 0xBBD8, 0xD8B6,
+	0xD2F2, 0xE0EF, 0xCDC5, 0x87E2, 0xB6DA, 0x87E3, 0x87E4, 0x87E5, 0x87E6, 0x87E7, 0x87E8, 0xE0F1, 0x87E9, 0xD4B0, 0x87EA, 0x87EB,
+	0xC0A7, 0xB4D1, 0x87EC, 0x87ED, 0xCEA7, 0xE0F0, 0x87EE, 0x87EF, 0x87F0, 0xE0F2, 0xB9CC, 0x87F1, 0x87F2, 0xB9FA, 0xCDBC, 0xE0F3,
+	0x87F3, 0x87F4, 0x87F5, 0xC6D4, 0xE0F4, 0x87F6, 0xD4B2, 0x87F7, 0xC8A6, 0xE0F6, 0xE0F5, 0x87F8, 0x87F9, 0x87FA, 0x87FB, 0x87FC,
+	0x87FD, 0x87FE, 0x8840, 0x8841, 0x8842, 0x8843, 0x8844, 0x8845, 0x8846, 0x8847, 0x8848, 0x8849, 0xE0F7, 0x884A, 0x884B, 0xCDC1,
+	0x884C, 0x884D, 0x884E, 0xCAA5, 0x884F, 0x8850, 0x8851, 0x8852, 0xD4DA, 0xDBD7, 0xDBD9, 0x8853, 0xDBD8, 0xB9E7, 0xDBDC, 0xDBDD,
+	0xB5D8, 0x8854, 0x8855, 0xDBDA, 0x8856, 0x8857, 0x8858, 0x8859, 0x885A, 0xDBDB, 0xB3A1, 0xDBDF, 0x885B, 0x885C, 0xBBF8, 0x885D,
+	0xD6B7, 0x885E, 0xDBE0, 0x885F, 0x8860, 0x8861, 0x8862, 0xBEF9, 0x8863, 0x8864, 0xB7BB, 0x8865, 0xDBD0, 0xCCAE, 0xBFB2, 0xBBB5,
+	0xD7F8, 0xBFD3, 0x8866, 0x8867, 0x8868, 0x8869, 0x886A, 0xBFE9, 0x886B, 0x886C, 0xBCE1, 0xCCB3, 0xDBDE, 0xB0D3, 0xCEEB, 0xB7D8,
+	0xD7B9, 0xC6C2, 0x886D, 0x886E, 0xC0A4, 0x886F, 0xCCB9, 0x8870, 0xDBE7, 0xDBE1, 0xC6BA, 0xDBE3, 0x8871, 0xDBE8, 0x8872, 0xC5F7,
+	0x8873, 0x8874, 0x8875, 0xDBEA, 0x8876, 0x8877, 0xDBE9, 0xBFC0, 0x8878, 0x8879, 0x887A, 0xDBE6, 0xDBE5, 0x887B, 0x887C, 0x887D,
+	0x887E, 0x8880, 0xB4B9, 0xC0AC, 0xC2A2, 0xDBE2, 0xDBE4, 0x8881, 0x8882, 0x8883, 0x8884, 0xD0CD, 0xDBED, 0x8885, 0x8886, 0x8887,
+	0x8888, 0x8889, 0xC0DD, 0xDBF2, 0x888A, 0x888B, 0x888C, 0x888D, 0x888E, 0x888F, 0x8890, 0xB6E2, 0x8891, 0x8892, 0x8893, 0x8894,
+	0xDBF3, 0xDBD2, 0xB9B8, 0xD4AB, 0xDBEC, 0x8895, 0xBFD1, 0xDBF0, 0x8896, 0xDBD1, 0x8897, 0xB5E6, 0x8898, 0xDBEB, 0xBFE5, 0x8899,
+	0x889A, 0x889B, 0xDBEE, 0x889C, 0xDBF1, 0x889D, 0x889E, 0x889F, 0xDBF9, 0x88A0, 0x88A1, 0x88A2, 0x88A3, 0x88A4, 0x88A5, 0x88A6,
+	0x88A7, 0x88A8, 0xB9A1, 0xB0A3, 0x88A9, 0x88AA, 0x88AB, 0x88AC, 0x88AD, 0x88AE, 0x88AF, 0xC2F1, 0x88B0, 0x88B1, 0xB3C7, 0xDBEF,
+	0x88B2, 0x88B3, 0xDBF8, 0x88B4, 0xC6D2, 0xDBF4, 0x88B5, 0x88B6, 0xDBF5, 0xDBF7, 0xDBF6, 0x88B7, 0x88B8, 0xDBFE, 0x88B9, 0xD3F2,
+	0xB2BA, 0x88BA, 0x88BB, 0x88BC, 0xDBFD, 0x88BD, 0x88BE, 0x88BF, 0x88C0, 0x88C1, 0x88C2, 0x88C3, 0x88C4, 0xDCA4, 0x88C5, 0xDBFB,
+	0x88C6, 0x88C7, 0x88C8, 0x88C9, 0xDBFA, 0x88CA, 0x88CB, 0x88CC, 0xDBFC, 0xC5E0, 0xBBF9, 0x88CD, 0x88CE, 0xDCA3, 0x88CF, 0x88D0,
+	0xDCA5, 0x88D1, 0xCCC3, 0x88D2, 0x88D3, 0x88D4, 0xB6D1, 0xDDC0, 0x88D5, 0x88D6, 0x88D7, 0xDCA1, 0x88D8, 0xDCA2, 0x88D9, 0x88DA,
+	0x88DB, 0xC7B5, 0x88DC, 0x88DD, 0x88DE, 0xB6E9, 0x88DF, 0x88E0, 0x88E1, 0xDCA7, 0x88E2, 0x88E3, 0x88E4, 0x88E5, 0xDCA6, 0x88E6,
+	0xDCA9, 0xB1A4, 0x88E7, 0x88E8, 0xB5CC, 0x88E9, 0x88EA, 0x88EB, 0x88EC, 0x88ED, 0xBFB0, 0x88EE, 0x88EF, 0x88F0, 0x88F1, 0x88F2,
+	0xD1DF, 0x88F3, 0x88F4, 0x88F5, 0x88F6, 0xB6C2, 0x88F7, 0x88F8, 0x88F9, 0x88FA, 0x88FB, 0x88FC, 0x88FD, 0x88FE, 0x8940, 0x8941,
+	0x8942, 0x8943, 0x8944, 0x8945, 0xDCA8, 0x8946, 0x8947, 0x8948, 0x8949, 0x894A, 0x894B, 0x894C, 0xCBFA, 0xEBF3, 0x894D, 0x894E,
+	0x894F, 0xCBDC, 0x8950, 0x8951, 0xCBFE, 0x8952, 0x8953, 0x8954, 0xCCC1, 0x8955, 0x8956, 0x8957, 0x8958, 0x8959, 0xC8FB, 0x895A,
+	0x895B, 0x895C, 0x895D, 0x895E, 0x895F, 0xDCAA, 0x8960, 0x8961, 0x8962, 0x8963, 0x8964, 0xCCEE, 0xDCAB, 0x8965, 0x8966, 0x8967,
+	0x8968, 0x8969, 0x896A, 0x896B, 0x896C, 0x896D, 0x896E, 0x896F, 0x8970, 0x8971, 0x8972, 0x8973, 0x8974, 0x8975, 0xDBD3, 0x8976,
+	0xDCAF, 0xDCAC, 0x8977, 0xBEB3, 0x8978, 0xCAFB, 0x8979, 0x897A, 0x897B, 0xDCAD, 0x897C, 0x897D, 0x897E, 0x8980, 0x8981, 0x8982,
+	0x8983, 0x8984, 0xC9CA, 0xC4B9, 0x8985, 0x8986, 0x8987, 0x8988, 0x8989, 0xC7BD, 0xDCAE, 0x898A, 0x898B, 0x898C, 0xD4F6, 0xD0E6,
+	0x898D, 0x898E, 0x898F, 0x8990, 0x8991, 0x8992, 0x8993, 0x8994, 0xC4AB, 0xB6D5, 0x8995, 0x8996, 0x8997, 0x8998, 0x8999, 0x899A,
+	0x899B, 0x899C, 0x899D, 0x899E, 0x899F, 0x89A0, 0x89A1, 0x89A2, 0x89A3, 0x89A4, 0x89A5, 0x89A6, 0xDBD4, 0x89A7, 0x89A8, 0x89A9,
+	0x89AA, 0xB1DA, 0x89AB, 0x89AC, 0x89AD, 0xDBD5, 0x89AE, 0x89AF, 0x89B0, 0x89B1, 0x89B2, 0x89B3, 0x89B4, 0x89B5, 0x89B6, 0x89B7,
+	0x89B8, 0xDBD6, 0x89B9, 0x89BA, 0x89BB, 0xBABE, 0x89BC, 0x89BD, 0x89BE, 0x89BF, 0x89C0, 0x89C1, 0x89C2, 0x89C3, 0x89C4, 0x89C5,
+	0x89C6, 0x89C7, 0x89C8, 0x89C9, 0xC8C0, 0x89CA, 0x89CB, 0x89CC, 0x89CD, 0x89CE, 0x89CF, 0xCABF, 0xC8C9, 0x89D0, 0xD7B3, 0x89D1,
+	0xC9F9, 0x89D2, 0x89D3, 0xBFC7, 0x89D4, 0x89D5, 0xBAF8, 0x89D6, 0x89D7, 0xD2BC, 0x89D8, 0x89D9, 0x89DA, 0x89DB, 0x89DC, 0x89DD,
+	0x89DE, 0x89DF, 0xE2BA, 0x89E0, 0xB4A6, 0x89E1, 0x89E2, 0xB1B8, 0x89E3, 0x89E4, 0x89E5, 0x89E6, 0x89E7, 0xB8B4, 0x89E8, 0xCFC4,
+	0x89E9, 0x89EA, 0x89EB, 0x89EC, 0xD9E7, 0xCFA6, 0xCDE2, 0x89ED, 0x89EE, 0xD9ED, 0xB6E0, 0x89EF, 0xD2B9, 0x89F0, 0x89F1, 0xB9BB,
+	0x89F2, 0x89F3, 0x89F4, 0x89F5, 0xE2B9, 0xE2B7, 0x89F6, 0xB4F3, 0x89F7, 0xCCEC, 0xCCAB, 0xB7F2, 0x89F8, 0xD8B2, 0xD1EB, 0xBABB,
+	0x89F9, 0xCAA7, 0x89FA, 0x89FB, 0xCDB7, 0x89FC, 0x89FD, 0xD2C4, 0xBFE4, 0xBCD0, 0xB6E1, 0x89FE, 0xDEC5, 0x8A40, 0x8A41, 0x8A42,
+	0x8A43, 0xDEC6, 0xDBBC, 0x8A44, 0xD1D9, 0x8A45, 0x8A46, 0xC6E6, 0xC4CE, 0xB7EE, 0x8A47, 0xB7DC, 0x8A48, 0x8A49, 0xBFFC, 0xD7E0,
+	0x8A4A, 0xC6F5, 0x8A4B, 0x8A4C, 0xB1BC, 0xDEC8, 0xBDB1, 0xCCD7, 0xDECA, 0x8A4D, 0xDEC9, 0x8A4E, 0x8A4F, 0x8A50, 0x8A51, 0x8A52,
+	0xB5EC, 0x8A53, 0xC9DD, 0x8A54, 0x8A55, 0xB0C2, 0x8A56, 0x8A57, 0x8A58, 0x8A59, 0x8A5A, 0x8A5B, 0x8A5C, 0x8A5D, 0x8A5E, 0x8A5F,
+	0x8A60, 0x8A61, 0x8A62, 0xC5AE, 0xC5AB, 0x8A63, 0xC4CC, 0x8A64, 0xBCE9, 0xCBFD, 0x8A65, 0x8A66, 0x8A67, 0xBAC3, 0x8A68, 0x8A69,
+	0x8A6A, 0xE5F9, 0xC8E7, 0xE5FA, 0xCDFD, 0x8A6B, 0xD7B1, 0xB8BE, 0xC2E8, 0x8A6C, 0xC8D1, 0x8A6D, 0x8A6E, 0xE5FB, 0x8A6F, 0x8A70,
+	0x8A71, 0x8A72, 0xB6CA, 0xBCCB, 0x8A73, 0x8A74, 0xD1FD, 0xE6A1, 0x8A75, 0xC3EE, 0x8A76, 0x8A77, 0x8A78, 0x8A79, 0xE6A4, 0x8A7A,
+	0x8A7B, 0x8A7C, 0x8A7D, 0xE5FE, 0xE6A5, 0xCDD7, 0x8A7E, 0x8A80, 0xB7C1, 0xE5FC, 0xE5FD, 0xE6A3, 0x8A81, 0x8A82, 0xC4DD, 0xE6A8,
+	0x8A83, 0x8A84, 0xE6A7, 0x8A85, 0x8A86, 0x8A87, 0x8A88, 0x8A89, 0x8A8A, 0xC3C3, 0x8A8B, 0xC6DE, 0x8A8C, 0x8A8D, 0xE6AA, 0x8A8E,
+	0x8A8F, 0x8A90, 0x8A91, 0x8A92, 0x8A93, 0x8A94, 0xC4B7, 0x8A95, 0x8A96, 0x8A97, 0xE6A2, 0xCABC, 0x8A98, 0x8A99, 0x8A9A, 0x8A9B,
+	0xBDE3, 0xB9C3, 0xE6A6, 0xD0D5, 0xCEAF, 0x8A9C, 0x8A9D, 0xE6A9, 0xE6B0, 0x8A9E, 0xD2A6, 0x8A9F, 0xBDAA, 0xE6AD, 0x8AA0, 0x8AA1,
+	0x8AA2, 0x8AA3, 0x8AA4, 0xE6AF, 0x8AA5, 0xC0D1, 0x8AA6, 0x8AA7, 0xD2CC, 0x8AA8, 0x8AA9, 0x8AAA, 0xBCA7, 0x8AAB, 0x8AAC, 0x8AAD,
+	0x8AAE, 0x8AAF, 0x8AB0, 0x8AB1, 0x8AB2, 0x8AB3, 0x8AB4, 0x8AB5, 0x8AB6, 0xE6B1, 0x8AB7, 0xD2F6, 0x8AB8, 0x8AB9, 0x8ABA, 0xD7CB,
+	0x8ABB, 0xCDFE, 0x8ABC, 0xCDDE, 0xC2A6, 0xE6AB, 0xE6AC, 0xBDBF, 0xE6AE, 0xE6B3, 0x8ABD, 0x8ABE, 0xE6B2, 0x8ABF, 0x8AC0, 0x8AC1,
+	0x8AC2, 0xE6B6, 0x8AC3, 0xE6B8, 0x8AC4, 0x8AC5, 0x8AC6, 0x8AC7, 0xC4EF, 0x8AC8, 0x8AC9, 0x8ACA, 0xC4C8, 0x8ACB, 0x8ACC, 0xBEEA,
+	0xC9EF, 0x8ACD, 0x8ACE, 0xE6B7, 0x8ACF, 0xB6F0, 0x8AD0, 0x8AD1, 0x8AD2, 0xC3E4, 0x8AD3, 0x8AD4, 0x8AD5, 0x8AD6, 0x8AD7, 0x8AD8,
+	0x8AD9, 0xD3E9, 0xE6B4, 0x8ADA, 0xE6B5, 0x8ADB, 0xC8A2, 0x8ADC, 0x8ADD, 0x8ADE, 0x8ADF, 0x8AE0, 0xE6BD, 0x8AE1, 0x8AE2, 0x8AE3,
+	0xE6B9, 0x8AE4, 0x8AE5, 0x8AE6, 0x8AE7, 0x8AE8, 0xC6C5, 0x8AE9, 0x8AEA, 0xCDF1, 0xE6BB, 0x8AEB, 0x8AEC, 0x8AED, 0x8AEE, 0x8AEF,
+	0x8AF0, 0x8AF1, 0x8AF2, 0x8AF3, 0x8AF4, 0xE6BC, 0x8AF5, 0x8AF6, 0x8AF7, 0x8AF8, 0xBBE9, 0x8AF9, 0x8AFA, 0x8AFB, 0x8AFC, 0x8AFD,
+	0x8AFE, 0x8B40, 0xE6BE, 0x8B41, 0x8B42, 0x8B43, 0x8B44, 0xE6BA, 0x8B45, 0x8B46, 0xC0B7, 0x8B47, 0x8B48, 0x8B49, 0x8B4A, 0x8B4B,
+	0x8B4C, 0x8B4D, 0x8B4E, 0x8B4F, 0xD3A4, 0xE6BF, 0xC9F4, 0xE6C3, 0x8B50, 0x8B51, 0xE6C4, 0x8B52, 0x8B53, 0x8B54, 0x8B55, 0xD0F6,
+	0x8B56, 0x8B57, 0x8B58, 0x8B59, 0x8B5A, 0x8B5B, 0x8B5C, 0x8B5D, 0x8B5E, 0x8B5F, 0x8B60, 0x8B61, 0x8B62, 0x8B63, 0x8B64, 0x8B65,
+	0x8B66, 0x8B67, 0xC3BD, 0x8B68, 0x8B69, 0x8B6A, 0x8B6B, 0x8B6C, 0x8B6D, 0x8B6E, 0xC3C4, 0xE6C2, 0x8B6F, 0x8B70, 0x8B71, 0x8B72,
+	0x8B73, 0x8B74, 0x8B75, 0x8B76, 0x8B77, 0x8B78, 0x8B79, 0x8B7A, 0x8B7B, 0x8B7C, 0xE6C1, 0x8B7D, 0x8B7E, 0x8B80, 0x8B81, 0x8B82,
+	0x8B83, 0x8B84, 0xE6C7, 0xCFB1, 0x8B85, 0xEBF4, 0x8B86, 0x8B87, 0xE6CA, 0x8B88, 0x8B89, 0x8B8A, 0x8B8B, 0x8B8C, 0xE6C5, 0x8B8D,
+	0x8B8E, 0xBCDE, 0xC9A9, 0x8B8F, 0x8B90, 0x8B91, 0x8B92, 0x8B93, 0x8B94, 0xBCB5, 0x8B95, 0x8B96, 0xCFD3, 0x8B97, 0x8B98, 0x8B99,
+	0x8B9A, 0x8B9B, 0xE6C8, 0x8B9C, 0xE6C9, 0x8B9D, 0xE6CE, 0x8B9E, 0xE6D0, 0x8B9F, 0x8BA0, 0x8BA1, 0xE6D1, 0x8BA2, 0x8BA3, 0x8BA4,
+	0xE6CB, 0xB5D5, 0x8BA5, 0xE6CC, 0x8BA6, 0x8BA7, 0xE6CF, 0x8BA8, 0x8BA9, 0xC4DB, 0x8BAA, 0xE6C6, 0x8BAB, 0x8BAC, 0x8BAD, 0x8BAE,
+	0x8BAF, 0xE6CD, 0x8BB0, 0x8BB1, 0x8BB2, 0x8BB3, 0x8BB4, 0x8BB5, 0x8BB6, 0x8BB7, 0x8BB8, 0x8BB9, 0x8BBA, 0x8BBB, 0x8BBC, 0x8BBD,
+	0x8BBE, 0x8BBF, 0x8BC0, 0x8BC1, 0x8BC2, 0x8BC3, 0x8BC4, 0x8BC5, 0x8BC6, 0xE6D2, 0x8BC7, 0x8BC8, 0x8BC9, 0x8BCA, 0x8BCB, 0x8BCC,
+	0x8BCD, 0x8BCE, 0x8BCF, 0x8BD0, 0x8BD1, 0x8BD2, 0xE6D4, 0xE6D3, 0x8BD3, 0x8BD4, 0x8BD5, 0x8BD6, 0x8BD7, 0x8BD8, 0x8BD9, 0x8BDA,
+	0x8BDB, 0x8BDC, 0x8BDD, 0x8BDE, 0x8BDF, 0x8BE0, 0x8BE1, 0x8BE2, 0x8BE3, 0x8BE4, 0x8BE5, 0x8BE6, 0x8BE7, 0x8BE8, 0x8BE9, 0x8BEA,
+	0x8BEB, 0x8BEC, 0xE6D5, 0x8BED, 0xD9F8, 0x8BEE, 0x8BEF, 0xE6D6, 0x8BF0, 0x8BF1, 0x8BF2, 0x8BF3, 0x8BF4, 0x8BF5, 0x8BF6, 0x8BF7,
+	0xE6D7, 0x8BF8, 0x8BF9, 0x8BFA, 0x8BFB, 0x8BFC, 0x8BFD, 0x8BFE, 0x8C40, 0x8C41, 0x8C42, 0x8C43, 0x8C44, 0x8C45, 0x8C46, 0x8C47,
+	0xD7D3, 0xE6DD, 0x8C48, 0xE6DE, 0xBFD7, 0xD4D0, 0x8C49, 0xD7D6, 0xB4E6, 0xCBEF, 0xE6DA, 0xD8C3, 0xD7CE, 0xD0A2, 0x8C4A, 0xC3CF,
+	0x8C4B, 0x8C4C, 0xE6DF, 0xBCBE, 0xB9C2, 0xE6DB, 0xD1A7, 0x8C4D, 0x8C4E, 0xBAA2, 0xC2CF, 0x8C4F, 0xD8AB, 0x8C50, 0x8C51, 0x8C52,
+	0xCAEB, 0xE5EE, 0x8C53, 0xE6DC, 0x8C54, 0xB7F5, 0x8C55, 0x8C56, 0x8C57, 0x8C58, 0xC8E6, 0x8C59, 0x8C5A, 0xC4F5, 0x8C5B, 0x8C5C,
+	0xE5B2, 0xC4FE, 0x8C5D, 0xCBFC, 0xE5B3, 0xD5AC, 0x8C5E, 0xD3EE, 0xCAD8, 0xB0B2, 0x8C5F, 0xCBCE, 0xCDEA, 0x8C60, 0x8C61, 0xBAEA,
+	0x8C62, 0x8C63, 0x8C64, 0xE5B5, 0x8C65, 0xE5B4, 0x8C66, 0xD7DA, 0xB9D9, 0xD6E6, 0xB6A8, 0xCDF0, 0xD2CB, 0xB1A6, 0xCAB5, 0x8C67,
+	0xB3E8, 0xC9F3, 0xBFCD, 0xD0FB, 0xCAD2, 0xE5B6, 0xBBC2, 0x8C68, 0x8C69, 0x8C6A, 0xCFDC, 0xB9AC, 0x8C6B, 0x8C6C, 0x8C6D, 0x8C6E,
+	0xD4D7, 0x8C6F, 0x8C70, 0xBAA6, 0xD1E7, 0xCFFC, 0xBCD2, 0x8C71, 0xE5B7, 0xC8DD, 0x8C72, 0x8C73, 0x8C74, 0xBFED, 0xB1F6, 0xCBDE,
+	0x8C75, 0x8C76, 0xBCC5, 0x8C77, 0xBCC4, 0xD2FA, 0xC3DC, 0xBFDC, 0x8C78, 0x8C79, 0x8C7A, 0x8C7B, 0xB8BB, 0x8C7C, 0x8C7D, 0x8C7E,
+	0xC3C2, 0x8C80, 0xBAAE, 0xD4A2, 0x8C81, 0x8C82, 0x8C83, 0x8C84, 0x8C85, 0x8C86, 0x8C87, 0x8C88, 0x8C89, 0xC7DE, 0xC4AF, 0xB2EC,
+	0x8C8A, 0xB9D1, 0x8C8B, 0x8C8C, 0xE5BB, 0xC1C8, 0x8C8D, 0x8C8E, 0xD5AF, 0x8C8F, 0x8C90, 0x8C91, 0x8C92, 0x8C93, 0xE5BC, 0x8C94,
+	0xE5BE, 0x8C95, 0x8C96, 0x8C97, 0x8C98, 0x8C99, 0x8C9A, 0x8C9B, 0xB4E7, 0xB6D4, 0xCBC2, 0xD1B0, 0xB5BC, 0x8C9C, 0x8C9D, 0xCAD9,
+	0x8C9E, 0xB7E2, 0x8C9F, 0x8CA0, 0xC9E4, 0x8CA1, 0xBDAB, 0x8CA2, 0x8CA3, 0xCEBE, 0xD7F0, 0x8CA4, 0x8CA5, 0x8CA6, 0x8CA7, 0xD0A1,
+	0x8CA8, 0xC9D9, 0x8CA9, 0x8CAA, 0xB6FB, 0xE6D8, 0xBCE2, 0x8CAB, 0xB3BE, 0x8CAC, 0xC9D0, 0x8CAD, 0xE6D9, 0xB3A2, 0x8CAE, 0x8CAF,
+	0x8CB0, 0x8CB1, 0xDECC, 0x8CB2, 0xD3C8, 0xDECD, 0x8CB3, 0xD2A2, 0x8CB4, 0x8CB5, 0x8CB6, 0x8CB7, 0xDECE, 0x8CB8, 0x8CB9, 0x8CBA,
+	0x8CBB, 0xBECD, 0x8CBC, 0x8CBD, 0xDECF, 0x8CBE, 0x8CBF, 0x8CC0, 0xCAAC, 0xD2FC, 0xB3DF, 0xE5EA, 0xC4E1, 0xBEA1, 0xCEB2, 0xC4F2,
+	0xBED6, 0xC6A8, 0xB2E3, 0x8CC1, 0x8CC2, 0xBED3, 0x8CC3, 0x8CC4, 0xC7FC, 0xCCEB, 0xBDEC, 0xCEDD, 0x8CC5, 0x8CC6, 0xCABA, 0xC6C1,
+	0xE5EC, 0xD0BC, 0x8CC7, 0x8CC8, 0x8CC9, 0xD5B9, 0x8CCA, 0x8CCB, 0x8CCC, 0xE5ED, 0x8CCD, 0x8CCE, 0x8CCF, 0x8CD0, 0xCAF4, 0x8CD1,
+	0xCDC0, 0xC2C5, 0x8CD2, 0xE5EF, 0x8CD3, 0xC2C4, 0xE5F0, 0x8CD4, 0x8CD5, 0x8CD6, 0x8CD7, 0x8CD8, 0x8CD9, 0x8CDA, 0xE5F8, 0xCDCD,
+	0x8CDB, 0xC9BD, 0x8CDC, 0x8CDD, 0x8CDE, 0x8CDF, 0x8CE0, 0x8CE1, 0x8CE2, 0xD2D9, 0xE1A8, 0x8CE3, 0x8CE4, 0x8CE5, 0x8CE6, 0xD3EC,
+	0x8CE7, 0xCBEA, 0xC6F1, 0x8CE8, 0x8CE9, 0x8CEA, 0x8CEB, 0x8CEC, 0xE1AC, 0x8CED, 0x8CEE, 0x8CEF, 0xE1A7, 0xE1A9, 0x8CF0, 0x8CF1,
+	0xE1AA, 0xE1AF, 0x8CF2, 0x8CF3, 0xB2ED, 0x8CF4, 0xE1AB, 0xB8DA, 0xE1AD, 0xE1AE, 0xE1B0, 0xB5BA, 0xE1B1, 0x8CF5, 0x8CF6, 0x8CF7,
+	0x8CF8, 0x8CF9, 0xE1B3, 0xE1B8, 0x8CFA, 0x8CFB, 0x8CFC, 0x8CFD, 0x8CFE, 0xD1D2, 0x8D40, 0xE1B6, 0xE1B5, 0xC1EB, 0x8D41, 0x8D42,
+	0x8D43, 0xE1B7, 0x8D44, 0xD4C0, 0x8D45, 0xE1B2, 0x8D46, 0xE1BA, 0xB0B6, 0x8D47, 0x8D48, 0x8D49, 0x8D4A, 0xE1B4, 0x8D4B, 0xBFF9,
+	0x8D4C, 0xE1B9, 0x8D4D, 0x8D4E, 0xE1BB, 0x8D4F, 0x8D50, 0x8D51, 0x8D52, 0x8D53, 0x8D54, 0xE1BE, 0x8D55, 0x8D56, 0x8D57, 0x8D58,
+	0x8D59, 0x8D5A, 0xE1BC, 0x8D5B, 0x8D5C, 0x8D5D, 0x8D5E, 0x8D5F, 0x8D60, 0xD6C5, 0x8D61, 0x8D62, 0x8D63, 0x8D64, 0x8D65, 0x8D66,
+	0x8D67, 0xCFBF, 0x8D68, 0x8D69, 0xE1BD, 0xE1BF, 0xC2CD, 0x8D6A, 0xB6EB, 0x8D6B, 0xD3F8, 0x8D6C, 0x8D6D, 0xC7CD, 0x8D6E, 0x8D6F,
+	0xB7E5, 0x8D70, 0x8D71, 0x8D72, 0x8D73, 0x8D74, 0x8D75, 0x8D76, 0x8D77, 0x8D78, 0x8D79, 0xBEFE, 0x8D7A, 0x8D7B, 0x8D7C, 0x8D7D,
+	0x8D7E, 0x8D80, 0xE1C0, 0xE1C1, 0x8D81, 0x8D82, 0xE1C7, 0xB3E7, 0x8D83, 0x8D84, 0x8D85, 0x8D86, 0x8D87, 0x8D88, 0xC6E9, 0x8D89,
+	0x8D8A, 0x8D8B, 0x8D8C, 0x8D8D, 0xB4DE, 0x8D8E, 0xD1C2, 0x8D8F, 0x8D90, 0x8D91, 0x8D92, 0xE1C8, 0x8D93, 0x8D94, 0xE1C6, 0x8D95,
+	0x8D96, 0x8D97, 0x8D98, 0x8D99, 0xE1C5, 0x8D9A, 0xE1C3, 0xE1C2, 0x8D9B, 0xB1C0, 0x8D9C, 0x8D9D, 0x8D9E, 0xD5B8, 0xE1C4, 0x8D9F,
+	0x8DA0, 0x8DA1, 0x8DA2, 0x8DA3, 0xE1CB, 0x8DA4, 0x8DA5, 0x8DA6, 0x8DA7, 0x8DA8, 0x8DA9, 0x8DAA, 0x8DAB, 0xE1CC, 0xE1CA, 0x8DAC,
+	0x8DAD, 0x8DAE, 0x8DAF, 0x8DB0, 0x8DB1, 0x8DB2, 0x8DB3, 0xEFFA, 0x8DB4, 0x8DB5, 0xE1D3, 0xE1D2, 0xC7B6, 0x8DB6, 0x8DB7, 0x8DB8,
+	0x8DB9, 0x8DBA, 0x8DBB, 0x8DBC, 0x8DBD, 0x8DBE, 0x8DBF, 0x8DC0, 0xE1C9, 0x8DC1, 0x8DC2, 0xE1CE, 0x8DC3, 0xE1D0, 0x8DC4, 0x8DC5,
+	0x8DC6, 0x8DC7, 0x8DC8, 0x8DC9, 0x8DCA, 0x8DCB, 0x8DCC, 0x8DCD, 0x8DCE, 0xE1D4, 0x8DCF, 0xE1D1, 0xE1CD, 0x8DD0, 0x8DD1, 0xE1CF,
+	0x8DD2, 0x8DD3, 0x8DD4, 0x8DD5, 0xE1D5, 0x8DD6, 0x8DD7, 0x8DD8, 0x8DD9, 0x8DDA, 0x8DDB, 0x8DDC, 0x8DDD, 0x8DDE, 0x8DDF, 0x8DE0,
+	0x8DE1, 0x8DE2, 0xE1D6, 0x8DE3, 0x8DE4, 0x8DE5, 0x8DE6, 0x8DE7, 0x8DE8, 0x8DE9, 0x8DEA, 0x8DEB, 0x8DEC, 0x8DED, 0x8DEE, 0x8DEF,
+	0x8DF0, 0x8DF1, 0x8DF2, 0x8DF3, 0x8DF4, 0x8DF5, 0x8DF6, 0x8DF7, 0x8DF8, 0xE1D7, 0x8DF9, 0x8DFA, 0x8DFB, 0xE1D8, 0x8DFC, 0x8DFD,
+	0x8DFE, 0x8E40, 0x8E41, 0x8E42, 0x8E43, 0x8E44, 0x8E45, 0x8E46, 0x8E47, 0x8E48, 0x8E49, 0x8E4A, 0x8E4B, 0x8E4C, 0x8E4D, 0x8E4E,
+	0x8E4F, 0x8E50, 0x8E51, 0x8E52, 0x8E53, 0x8E54, 0x8E55, 0xE1DA, 0x8E56, 0x8E57, 0x8E58, 0x8E59, 0x8E5A, 0x8E5B, 0x8E5C, 0x8E5D,
+	0x8E5E, 0x8E5F, 0x8E60, 0x8E61, 0x8E62, 0xE1DB, 0x8E63, 0x8E64, 0x8E65, 0x8E66, 0x8E67, 0x8E68, 0x8E69, 0xCEA1, 0x8E6A, 0x8E6B,
+	0x8E6C, 0x8E6D, 0x8E6E, 0x8E6F, 0x8E70, 0x8E71, 0x8E72, 0x8E73, 0x8E74, 0x8E75, 0x8E76, 0xE7DD, 0x8E77, 0xB4A8, 0xD6DD, 0x8E78,
+	0x8E79, 0xD1B2, 0xB3B2, 0x8E7A, 0x8E7B, 0xB9A4, 0xD7F3, 0xC7C9, 0xBEDE, 0xB9AE, 0x8E7C, 0xCED7, 0x8E7D, 0x8E7E, 0xB2EE, 0xDBCF,
+	0x8E80, 0xBCBA, 0xD2D1, 0xCBC8, 0xB0CD, 0x8E81, 0x8E82, 0xCFEF, 0x8E83, 0x8E84, 0x8E85, 0x8E86, 0x8E87, 0xD9E3, 0xBDED, 0x8E88,
+	0x8E89, 0xB1D2, 0xCAD0, 0xB2BC, 0x8E8A, 0xCBA7, 0xB7AB, 0x8E8B, 0xCAA6, 0x8E8C, 0x8E8D, 0x8E8E, 0xCFA3, 0x8E8F, 0x8E90, 0xE0F8,
+	0xD5CA, 0xE0FB, 0x8E91, 0x8E92, 0xE0FA, 0xC5C1, 0xCCFB, 0x8E93, 0xC1B1, 0xE0F9, 0xD6E3, 0xB2AF, 0xD6C4, 0xB5DB, 0x8E94, 0x8E95,
+	0x8E96, 0x8E97, 0x8E98, 0x8E99, 0x8E9A, 0x8E9B, 0xB4F8, 0xD6A1, 0x8E9C, 0x8E9D, 0x8E9E, 0x8E9F, 0x8EA0, 0xCFAF, 0xB0EF, 0x8EA1,
+	0x8EA2, 0xE0FC, 0x8EA3, 0x8EA4, 0x8EA5, 0x8EA6, 0x8EA7, 0xE1A1, 0xB3A3, 0x8EA8, 0x8EA9, 0xE0FD, 0xE0FE, 0xC3B1, 0x8EAA, 0x8EAB,
+	0x8EAC, 0x8EAD, 0xC3DD, 0x8EAE, 0xE1A2, 0xB7F9, 0x8EAF, 0x8EB0, 0x8EB1, 0x8EB2, 0x8EB3, 0x8EB4, 0xBBCF, 0x8EB5, 0x8EB6, 0x8EB7,
+	0x8EB8, 0x8EB9, 0x8EBA, 0x8EBB, 0xE1A3, 0xC4BB, 0x8EBC, 0x8EBD, 0x8EBE, 0x8EBF, 0x8EC0, 0xE1A4, 0x8EC1, 0x8EC2, 0xE1A5, 0x8EC3,
+	0x8EC4, 0xE1A6, 0xB4B1, 0x8EC5, 0x8EC6, 0x8EC7, 0x8EC8, 0x8EC9, 0x8ECA, 0x8ECB, 0x8ECC, 0x8ECD, 0x8ECE, 0x8ECF, 0x8ED0, 0x8ED1,
+	0x8ED2, 0x8ED3, 0xB8C9, 0xC6BD, 0xC4EA, 0x8ED4, 0xB2A2, 0x8ED5, 0xD0D2, 0x8ED6, 0xE7DB, 0xBBC3, 0xD3D7, 0xD3C4, 0x8ED7, 0xB9E3,
+	0xE2CF, 0x8ED8, 0x8ED9, 0x8EDA, 0xD7AF, 0x8EDB, 0xC7EC, 0xB1D3, 0x8EDC, 0x8EDD, 0xB4B2, 0xE2D1, 0x8EDE, 0x8EDF, 0x8EE0, 0xD0F2,
+	0xC2AE, 0xE2D0, 0x8EE1, 0xBFE2, 0xD3A6, 0xB5D7, 0xE2D2, 0xB5EA, 0x8EE2, 0xC3ED, 0xB8FD, 0x8EE3, 0xB8AE, 0x8EE4, 0xC5D3, 0xB7CF,
+	0xE2D4, 0x8EE5, 0x8EE6, 0x8EE7, 0x8EE8, 0xE2D3, 0xB6C8, 0xD7F9, 0x8EE9, 0x8EEA, 0x8EEB, 0x8EEC, 0x8EED, 0xCDA5, 0x8EEE, 0x8EEF,
+	0x8EF0, 0x8EF1, 0x8EF2, 0xE2D8, 0x8EF3, 0xE2D6, 0xCAFC, 0xBFB5, 0xD3B9, 0xE2D5, 0x8EF4, 0x8EF5, 0x8EF6, 0x8EF7, 0xE2D7, 0x8EF8,
+	0x8EF9, 0x8EFA, 0x8EFB, 0x8EFC, 0x8EFD, 0x8EFE, 0x8F40, 0x8F41, 0x8F42, 0xC1AE, 0xC0C8, 0x8F43, 0x8F44, 0x8F45, 0x8F46, 0x8F47,
+	0x8F48, 0xE2DB, 0xE2DA, 0xC0AA, 0x8F49, 0x8F4A, 0xC1CE, 0x8F4B, 0x8F4C, 0x8F4D, 0x8F4E, 0xE2DC, 0x8F4F, 0x8F50, 0x8F51, 0x8F52,
+	0x8F53, 0x8F54, 0x8F55, 0x8F56, 0x8F57, 0x8F58, 0x8F59, 0x8F5A, 0xE2DD, 0x8F5B, 0xE2DE, 0x8F5C, 0x8F5D, 0x8F5E, 0x8F5F, 0x8F60,
+	0x8F61, 0x8F62, 0x8F63, 0x8F64, 0xDBC8, 0x8F65, 0xD1D3, 0xCDA2, 0x8F66, 0x8F67, 0xBDA8, 0x8F68, 0x8F69, 0x8F6A, 0xDEC3, 0xD8A5,
+	0xBFAA, 0xDBCD, 0xD2EC, 0xC6FA, 0xC5AA, 0x8F6B, 0x8F6C, 0x8F6D, 0xDEC4, 0x8F6E, 0xB1D7, 0xDFAE, 0x8F6F, 0x8F70, 0x8F71, 0xCABD,
+	0x8F72, 0xDFB1, 0x8F73, 0xB9AD, 0x8F74, 0xD2FD, 0x8F75, 0xB8A5, 0xBAEB, 0x8F76, 0x8F77, 0xB3DA, 0x8F78, 0x8F79, 0x8F7A, 0xB5DC,
+	0xD5C5, 0x8F7B, 0x8F7C, 0x8F7D, 0x8F7E, 0xC3D6, 0xCFD2, 0xBBA1, 0x8F80, 0xE5F3, 0xE5F2, 0x8F81, 0x8F82, 0xE5F4, 0x8F83, 0xCDE4,
+	0x8F84, 0xC8F5, 0x8F85, 0x8F86, 0x8F87, 0x8F88, 0x8F89, 0x8F8A, 0x8F8B, 0xB5AF, 0xC7BF, 0x8F8C, 0xE5F6, 0x8F8D, 0x8F8E, 0x8F8F,
+	0xECB0, 0x8F90, 0x8F91, 0x8F92, 0x8F93, 0x8F94, 0x8F95, 0x8F96, 0x8F97, 0x8F98, 0x8F99, 0x8F9A, 0x8F9B, 0x8F9C, 0x8F9D, 0x8F9E,
+	0xE5E6, 0x8F9F, 0xB9E9, 0xB5B1, 0x8FA0, 0xC2BC, 0xE5E8, 0xE5E7, 0xE5E9, 0x8FA1, 0x8FA2, 0x8FA3, 0x8FA4, 0xD2CD, 0x8FA5, 0x8FA6,
+	0x8FA7, 0xE1EA, 0xD0CE, 0x8FA8, 0xCDAE, 0x8FA9, 0xD1E5, 0x8FAA, 0x8FAB, 0xB2CA, 0xB1EB, 0x8FAC, 0xB1F2, 0xC5ED, 0x8FAD, 0x8FAE,
+	0xD5C3, 0xD3B0, 0x8FAF, 0xE1DC, 0x8FB0, 0x8FB1, 0x8FB2, 0xE1DD, 0x8FB3, 0xD2DB, 0x8FB4, 0xB3B9, 0xB1CB, 0x8FB5, 0x8FB6, 0x8FB7,
+	0xCDF9, 0xD5F7, 0xE1DE, 0x8FB8, 0xBEB6, 0xB4FD, 0x8FB9, 0xE1DF, 0xBADC, 0xE1E0, 0xBBB2, 0xC2C9, 0xE1E1, 0x8FBA, 0x8FBB, 0x8FBC,
+	0xD0EC, 0x8FBD, 0xCDBD, 0x8FBE, 0x8FBF, 0xE1E2, 0x8FC0, 0xB5C3, 0xC5C7, 0xE1E3, 0x8FC1, 0x8FC2, 0xE1E4, 0x8FC3, 0x8FC4, 0x8FC5,
+	0x8FC6, 0xD3F9, 0x8FC7, 0x8FC8, 0x8FC9, 0x8FCA, 0x8FCB, 0x8FCC, 0xE1E5, 0x8FCD, 0xD1AD, 0x8FCE, 0x8FCF, 0xE1E6, 0xCEA2, 0x8FD0,
+	0x8FD1, 0x8FD2, 0x8FD3, 0x8FD4, 0x8FD5, 0xE1E7, 0x8FD6, 0xB5C2, 0x8FD7, 0x8FD8, 0x8FD9, 0x8FDA, 0xE1E8, 0xBBD5, 0x8FDB, 0x8FDC,
+	0x8FDD, 0x8FDE, 0x8FDF, 0xD0C4, 0xE2E0, 0xB1D8, 0xD2E4, 0x8FE0, 0x8FE1, 0xE2E1, 0x8FE2, 0x8FE3, 0xBCC9, 0xC8CC, 0x8FE4, 0xE2E3,
+	0xECFE, 0xECFD, 0xDFAF, 0x8FE5, 0x8FE6, 0x8FE7, 0xE2E2, 0xD6BE, 0xCDFC, 0xC3A6, 0x8FE8, 0x8FE9, 0x8FEA, 0xE3C3, 0x8FEB, 0x8FEC,
+	0xD6D2, 0xE2E7, 0x8FED, 0x8FEE, 0xE2E8, 0x8FEF, 0x8FF0, 0xD3C7, 0x8FF1, 0x8FF2, 0xE2EC, 0xBFEC, 0x8FF3, 0xE2ED, 0xE2E5, 0x8FF4,
+	0x8FF5, 0xB3C0, 0x8FF6, 0x8FF7, 0x8FF8, 0xC4EE, 0x8FF9, 0x8FFA, 0xE2EE, 0x8FFB, 0x8FFC, 0xD0C3, 0x8FFD, 0xBAF6, 0xE2E9, 0xB7DE,
+	0xBBB3, 0xCCAC, 0xCBCB, 0xE2E4, 0xE2E6, 0xE2EA, 0xE2EB, 0x8FFE, 0x9040, 0x9041, 0xE2F7, 0x9042, 0x9043, 0xE2F4, 0xD4F5, 0xE2F3,
+	0x9044, 0x9045, 0xC5AD, 0x9046, 0xD5FA, 0xC5C2, 0xB2C0, 0x9047, 0x9048, 0xE2EF, 0x9049, 0xE2F2, 0xC1AF, 0xCBBC, 0x904A, 0x904B,
+	0xB5A1, 0xE2F9, 0x904C, 0x904D, 0x904E, 0xBCB1, 0xE2F1, 0xD0D4, 0xD4B9, 0xE2F5, 0xB9D6, 0xE2F6, 0x904F, 0x9050, 0x9051, 0xC7D3,
+	0x9052, 0x9053, 0x9054, 0x9055, 0x9056, 0xE2F0, 0x9057, 0x9058, 0x9059, 0x905A, 0x905B, 0xD7DC, 0xEDA1, 0x905C, 0x905D, 0xE2F8,
+	0x905E, 0xEDA5, 0xE2FE, 0xCAD1, 0x905F, 0x9060, 0x9061, 0x9062, 0x9063, 0x9064, 0x9065, 0xC1B5, 0x9066, 0xBBD0, 0x9067, 0x9068,
+	0xBFD6, 0x9069, 0xBAE3, 0x906A, 0x906B, 0xCBA1, 0x906C, 0x906D, 0x906E, 0xEDA6, 0xEDA3, 0x906F, 0x9070, 0xEDA2, 0x9071, 0x9072,
+	0x9073, 0x9074, 0xBBD6, 0xEDA7, 0xD0F4, 0x9075, 0x9076, 0xEDA4, 0xBADE, 0xB6F7, 0xE3A1, 0xB6B2, 0xCCF1, 0xB9A7, 0x9077, 0xCFA2,
+	0xC7A1, 0x9078, 0x9079, 0xBFD2, 0x907A, 0x907B, 0xB6F1, 0x907C, 0xE2FA, 0xE2FB, 0xE2FD, 0xE2FC, 0xC4D5, 0xE3A2, 0x907D, 0xD3C1,
+	0x907E, 0x9080, 0x9081, 0xE3A7, 0xC7C4, 0x9082, 0x9083, 0x9084, 0x9085, 0xCFA4, 0x9086, 0x9087, 0xE3A9, 0xBAB7, 0x9088, 0x9089,
+	0x908A, 0x908B, 0xE3A8, 0x908C, 0xBBDA, 0x908D, 0xE3A3, 0x908E, 0x908F, 0x9090, 0xE3A4, 0xE3AA, 0x9091, 0xE3A6, 0x9092, 0xCEF2,
+	0xD3C6, 0x9093, 0x9094, 0xBBBC, 0x9095, 0x9096, 0xD4C3, 0x9097, 0xC4FA, 0x9098, 0x9099, 0xEDA8, 0xD0FC, 0xE3A5, 0x909A, 0xC3F5,
+	0x909B, 0xE3AD, 0xB1AF, 0x909C, 0xE3B2, 0x909D, 0x909E, 0x909F, 0xBCC2, 0x90A0, 0x90A1, 0xE3AC, 0xB5BF, 0x90A2, 0x90A3, 0x90A4,
+	0x90A5, 0x90A6, 0x90A7, 0x90A8, 0x90A9, 0xC7E9, 0xE3B0, 0x90AA, 0x90AB, 0x90AC, 0xBEAA, 0xCDEF, 0x90AD, 0x90AE, 0x90AF, 0x90B0,
+	0x90B1, 0xBBF3, 0x90B2, 0x90B3, 0x90B4, 0xCCE8, 0x90B5, 0x90B6, 0xE3AF, 0x90B7, 0xE3B1, 0x90B8, 0xCFA7, 0xE3AE, 0x90B9, 0xCEA9,
+	0xBBDD, 0x90BA, 0x90BB, 0x90BC, 0x90BD, 0x90BE, 0xB5EB, 0xBEE5, 0xB2D2, 0xB3CD, 0x90BF, 0xB1B9, 0xE3AB, 0xB2D1, 0xB5AC, 0xB9DF,
+	0xB6E8, 0x90C0, 0x90C1, 0xCFEB, 0xE3B7, 0x90C2, 0xBBCC, 0x90C3, 0x90C4, 0xC8C7, 0xD0CA, 0x90C5, 0x90C6, 0x90C7, 0x90C8, 0x90C9,
+	0xE3B8, 0xB3EE, 0x90CA, 0x90CB, 0x90CC, 0x90CD, 0xEDA9, 0x90CE, 0xD3FA, 0xD3E4, 0x90CF, 0x90D0, 0x90D1, 0xEDAA, 0xE3B9, 0xD2E2,
+	0x90D2, 0x90D3, 0x90D4, 0x90D5, 0x90D6, 0xE3B5, 0x90D7, 0x90D8, 0x90D9, 0x90DA, 0xD3DE, 0x90DB, 0x90DC, 0x90DD, 0x90DE, 0xB8D0,
+	0xE3B3, 0x90DF, 0x90E0, 0xE3B6, 0xB7DF, 0x90E1, 0xE3B4, 0xC0A2, 0x90E2, 0x90E3, 0x90E4, 0xE3BA, 0x90E5, 0x90E6, 0x90E7, 0x90E8,
+	0x90E9, 0x90EA, 0x90EB, 0x90EC, 0x90ED, 0x90EE, 0x90EF, 0x90F0, 0x90F1, 0x90F2, 0x90F3, 0x90F4, 0x90F5, 0x90F6, 0x90F7, 0xD4B8,
+	0x90F8, 0x90F9, 0x90FA, 0x90FB, 0x90FC, 0x90FD, 0x90FE, 0x9140, 0xB4C8, 0x9141, 0xE3BB, 0x9142, 0xBBC5, 0x9143, 0xC9F7, 0x9144,
+	0x9145, 0xC9E5, 0x9146, 0x9147, 0x9148, 0xC4BD, 0x9149, 0x914A, 0x914B, 0x914C, 0x914D, 0x914E, 0x914F, 0xEDAB, 0x9150, 0x9151,
+	0x9152, 0x9153, 0xC2FD, 0x9154, 0x9155, 0x9156, 0x9157, 0xBBDB, 0xBFAE, 0x9158, 0x9159, 0x915A, 0x915B, 0x915C, 0x915D, 0x915E,
+	0xCEBF, 0x915F, 0x9160, 0x9161, 0x9162, 0xE3BC, 0x9163, 0xBFB6, 0x9164, 0x9165, 0x9166, 0x9167, 0x9168, 0x9169, 0x916A, 0x916B,
+	0x916C, 0x916D, 0x916E, 0x916F, 0x9170, 0x9171, 0x9172, 0x9173, 0x9174, 0x9175, 0x9176, 0xB1EF, 0x9177, 0x9178, 0xD4F7, 0x9179,
+	0x917A, 0x917B, 0x917C, 0x917D, 0xE3BE, 0x917E, 0x9180, 0x9181, 0x9182, 0x9183, 0x9184, 0x9185, 0x9186, 0xEDAD, 0x9187, 0x9188,
+	0x9189, 0x918A, 0x918B, 0x918C, 0x918D, 0x918E, 0x918F, 0xE3BF, 0xBAA9, 0xEDAC, 0x9190, 0x9191, 0xE3BD, 0x9192, 0x9193, 0x9194,
+	0x9195, 0x9196, 0x9197, 0x9198, 0x9199, 0x919A, 0x919B, 0xE3C0, 0x919C, 0x919D, 0x919E, 0x919F, 0x91A0, 0x91A1, 0xBAB6, 0x91A2,
+	0x91A3, 0x91A4, 0xB6AE, 0x91A5, 0x91A6, 0x91A7, 0x91A8, 0x91A9, 0xD0B8, 0x91AA, 0xB0C3, 0xEDAE, 0x91AB, 0x91AC, 0x91AD, 0x91AE,
+	0x91AF, 0xEDAF, 0xC0C1, 0x91B0, 0xE3C1, 0x91B1, 0x91B2, 0x91B3, 0x91B4, 0x91B5, 0x91B6, 0x91B7, 0x91B8, 0x91B9, 0x91BA, 0x91BB,
+	0x91BC, 0x91BD, 0x91BE, 0x91BF, 0x91C0, 0x91C1, 0xC5B3, 0x91C2, 0x91C3, 0x91C4, 0x91C5, 0x91C6, 0x91C7, 0x91C8, 0x91C9, 0x91CA,
+	0x91CB, 0x91CC, 0x91CD, 0x91CE, 0x91CF, 0xE3C2, 0x91D0, 0x91D1, 0x91D2, 0x91D3, 0x91D4, 0x91D5, 0x91D6, 0x91D7, 0x91D8, 0xDCB2,
+	0x91D9, 0x91DA, 0x91DB, 0x91DC, 0x91DD, 0x91DE, 0xEDB0, 0x91DF, 0xB8EA, 0x91E0, 0xCEEC, 0xEAA7, 0xD0E7, 0xCAF9, 0xC8D6, 0xCFB7,
+	0xB3C9, 0xCED2, 0xBDE4, 0x91E1, 0x91E2, 0xE3DE, 0xBBF2, 0xEAA8, 0xD5BD, 0x91E3, 0xC6DD, 0xEAA9, 0x91E4, 0x91E5, 0x91E6, 0xEAAA,
+	0x91E7, 0xEAAC, 0xEAAB, 0x91E8, 0xEAAE, 0xEAAD, 0x91E9, 0x91EA, 0x91EB, 0x91EC, 0xBDD8, 0x91ED, 0xEAAF, 0x91EE, 0xC2BE, 0x91EF,
+	0x91F0, 0x91F1, 0x91F2, 0xB4C1, 0xB4F7, 0x91F3, 0x91F4, 0xBBA7, 0x91F5, 0x91F6, 0x91F7, 0x91F8, 0x91F9, 0xECE6, 0xECE5, 0xB7BF,
+	0xCBF9, 0xB1E2, 0x91FA, 0xECE7, 0x91FB, 0x91FC, 0x91FD, 0xC9C8, 0xECE8, 0xECE9, 0x91FE, 0xCAD6, 0xDED0, 0xB2C5, 0xD4FA, 0x9240,
+	0x9241, 0xC6CB, 0xB0C7, 0xB4F2, 0xC8D3, 0x9242, 0x9243, 0x9244, 0xCDD0, 0x9245, 0x9246, 0xBFB8, 0x9247, 0x9248, 0x9249, 0x924A,
+	0x924B, 0x924C, 0x924D, 0xBFDB, 0x924E, 0x924F, 0xC7A4, 0xD6B4, 0x9250, 0xC0A9, 0xDED1, 0xC9A8, 0xD1EF, 0xC5A4, 0xB0E7, 0xB3B6,
+	0xC8C5, 0x9251, 0x9252, 0xB0E2, 0x9253, 0x9254, 0xB7F6, 0x9255, 0x9256, 0xC5FA, 0x9257, 0x9258, 0xB6F3, 0x9259, 0xD5D2, 0xB3D0,
+	0xBCBC, 0x925A, 0x925B, 0x925C, 0xB3AD, 0x925D, 0x925E, 0x925F, 0x9260, 0xBEF1, 0xB0D1, 0x9261, 0x9262, 0x9263, 0x9264, 0x9265,
+	0x9266, 0xD2D6, 0xCAE3, 0xD7A5, 0x9267, 0xCDB6, 0xB6B6, 0xBFB9, 0xD5DB, 0x9268, 0xB8A7, 0xC5D7, 0x9269, 0x926A, 0x926B, 0xDED2,
+	0xBFD9, 0xC2D5, 0xC7C0, 0x926C, 0xBBA4, 0xB1A8, 0x926D, 0x926E, 0xC5EA, 0x926F, 0x9270, 0xC5FB, 0xCCA7, 0x9271, 0x9272, 0x9273,
+	0x9274, 0xB1A7, 0x9275, 0x9276, 0x9277, 0xB5D6, 0x9278, 0x9279, 0x927A, 0xC4A8, 0x927B, 0xDED3, 0xD1BA, 0xB3E9, 0x927C, 0xC3F2,
+	0x927D, 0x927E, 0xB7F7, 0x9280, 0xD6F4, 0xB5A3, 0xB2F0, 0xC4B4, 0xC4E9, 0xC0AD, 0xDED4, 0x9281, 0xB0E8, 0xC5C4, 0xC1E0, 0x9282,
+	0xB9D5, 0x9283, 0xBEDC, 0xCDD8, 0xB0CE, 0x9284, 0xCDCF, 0xDED6, 0xBED0, 0xD7BE, 0xDED5, 0xD5D0, 0xB0DD, 0x9285, 0x9286, 0xC4E2,
+	0x9287, 0x9288, 0xC2A3, 0xBCF0, 0x9289, 0xD3B5, 0xC0B9, 0xC5A1, 0xB2A6, 0xD4F1, 0x928A, 0x928B, 0xC0A8, 0xCAC3, 0xDED7, 0xD5FC,
+	0x928C, 0xB9B0, 0x928D, 0xC8AD, 0xCBA9, 0x928E, 0xDED9, 0xBFBD, 0x928F, 0x9290, 0x9291, 0x9292, 0xC6B4, 0xD7A7, 0xCAB0, 0xC4C3,
+	0x9293, 0xB3D6, 0xB9D2, 0x9294, 0x9295, 0x9296, 0x9297, 0xD6B8, 0xEAFC, 0xB0B4, 0x9298, 0x9299, 0x929A, 0x929B, 0xBFE6, 0x929C,
+	0x929D, 0xCCF4, 0x929E, 0x929F, 0x92A0, 0x92A1, 0xCDDA, 0x92A2, 0x92A3, 0x92A4, 0xD6BF, 0xC2CE, 0x92A5, 0xCECE, 0xCCA2, 0xD0AE,
+	0xC4D3, 0xB5B2, 0xDED8, 0xD5F5, 0xBCB7, 0xBBD3, 0x92A6, 0x92A7, 0xB0A4, 0x92A8, 0xC5B2, 0xB4EC, 0x92A9, 0x92AA, 0x92AB, 0xD5F1,
+	0x92AC, 0x92AD, 0xEAFD, 0x92AE, 0x92AF, 0x92B0, 0x92B1, 0x92B2, 0x92B3, 0xDEDA, 0xCDA6, 0x92B4, 0x92B5, 0xCDEC, 0x92B6, 0x92B7,
+	0x92B8, 0x92B9, 0xCEE6, 0xDEDC, 0x92BA, 0xCDB1, 0xC0A6, 0x92BB, 0x92BC, 0xD7BD, 0x92BD, 0xDEDB, 0xB0C6, 0xBAB4, 0xC9D3, 0xC4F3,
+	0xBEE8, 0x92BE, 0x92BF, 0x92C0, 0x92C1, 0xB2B6, 0x92C2, 0x92C3, 0x92C4, 0x92C5, 0x92C6, 0x92C7, 0x92C8, 0x92C9, 0xC0CC, 0xCBF0,
+	0x92CA, 0xBCF1, 0xBBBB, 0xB5B7, 0x92CB, 0x92CC, 0x92CD, 0xC5F5, 0x92CE, 0xDEE6, 0x92CF, 0x92D0, 0x92D1, 0xDEE3, 0xBEDD, 0x92D2,
+	0x92D3, 0xDEDF, 0x92D4, 0x92D5, 0x92D6, 0x92D7, 0xB4B7, 0xBDDD, 0x92D8, 0x92D9, 0xDEE0, 0xC4ED, 0x92DA, 0x92DB, 0x92DC, 0x92DD,
+	0xCFC6, 0x92DE, 0xB5E0, 0x92DF, 0x92E0, 0x92E1, 0x92E2, 0xB6DE, 0xCADA, 0xB5F4, 0xDEE5, 0x92E3, 0xD5C6, 0x92E4, 0xDEE1, 0xCCCD,
+	0xC6FE, 0x92E5, 0xC5C5, 0x92E6, 0x92E7, 0x92E8, 0xD2B4, 0x92E9, 0xBEF2, 0x92EA, 0x92EB, 0x92EC, 0x92ED, 0x92EE, 0x92EF, 0x92F0,
+	0xC2D3, 0x92F1, 0xCCBD, 0xB3B8, 0x92F2, 0xBDD3, 0x92F3, 0xBFD8, 0xCDC6, 0xD1DA, 0xB4EB, 0x92F4, 0xDEE4, 0xDEDD, 0xDEE7, 0x92F5,
+	0xEAFE, 0x92F6, 0x92F7, 0xC2B0, 0xDEE2, 0x92F8, 0x92F9, 0xD6C0, 0xB5A7, 0x92FA, 0xB2F4, 0x92FB, 0xDEE8, 0x92FC, 0xDEF2, 0x92FD,
+	0x92FE, 0x9340, 0x9341, 0x9342, 0xDEED, 0x9343, 0xDEF1, 0x9344, 0x9345, 0xC8E0, 0x9346, 0x9347, 0x9348, 0xD7E1, 0xDEEF, 0xC3E8,
+	0xCCE1, 0x9349, 0xB2E5, 0x934A, 0x934B, 0x934C, 0xD2BE, 0x934D, 0x934E, 0x934F, 0x9350, 0x9351, 0x9352, 0x9353, 0xDEEE, 0x9354,
+	0xDEEB, 0xCED5, 0x9355, 0xB4A7, 0x9356, 0x9357, 0x9358, 0x9359, 0x935A, 0xBFAB, 0xBEBE, 0x935B, 0x935C, 0xBDD2, 0x935D, 0x935E,
+	0x935F, 0x9360, 0xDEE9, 0x9361, 0xD4AE, 0x9362, 0xDEDE, 0x9363, 0xDEEA, 0x9364, 0x9365, 0x9366, 0x9367, 0xC0BF, 0x9368, 0xDEEC,
+	0xB2F3, 0xB8E9, 0xC2A7, 0x9369, 0x936A, 0xBDC1, 0x936B, 0x936C, 0x936D, 0x936E, 0x936F, 0xDEF5, 0xDEF8, 0x9370, 0x9371, 0xB2AB,
+	0xB4A4, 0x9372, 0x9373, 0xB4EA, 0xC9A6, 0x9374, 0x9375, 0x9376, 0x9377, 0x9378, 0x9379, 0xDEF6, 0xCBD1, 0x937A, 0xB8E3, 0x937B,
+	0xDEF7, 0xDEFA, 0x937C, 0x937D, 0x937E, 0x9380, 0xDEF9, 0x9381, 0x9382, 0x9383, 0xCCC2, 0x9384, 0xB0E1, 0xB4EE, 0x9385, 0x9386,
+	0x9387, 0x9388, 0x9389, 0x938A, 0xE5BA, 0x938B, 0x938C, 0x938D, 0x938E, 0x938F, 0xD0AF, 0x9390, 0x9391, 0xB2EB, 0x9392, 0xEBA1,
+	0x9393, 0xDEF4, 0x9394, 0x9395, 0xC9E3, 0xDEF3, 0xB0DA, 0xD2A1, 0xB1F7, 0x9396, 0xCCAF, 0x9397, 0x9398, 0x9399, 0x939A, 0x939B,
+	0x939C, 0x939D, 0xDEF0, 0x939E, 0xCBA4, 0x939F, 0x93A0, 0x93A1, 0xD5AA, 0x93A2, 0x93A3, 0x93A4, 0x93A5, 0x93A6, 0xDEFB, 0x93A7,
+	0x93A8, 0x93A9, 0x93AA, 0x93AB, 0x93AC, 0x93AD, 0x93AE, 0xB4DD, 0x93AF, 0xC4A6, 0x93B0, 0x93B1, 0x93B2, 0xDEFD, 0x93B3, 0x93B4,
+	0x93B5, 0x93B6, 0x93B7, 0x93B8, 0x93B9, 0x93BA, 0x93BB, 0x93BC, 0xC3FE, 0xC4A1, 0xDFA1, 0x93BD, 0x93BE, 0x93BF, 0x93C0, 0x93C1,
+	0x93C2, 0x93C3, 0xC1CC, 0x93C4, 0xDEFC, 0xBEEF, 0x93C5, 0xC6B2, 0x93C6, 0x93C7, 0x93C8, 0x93C9, 0x93CA, 0x93CB, 0x93CC, 0x93CD,
+	0x93CE, 0xB3C5, 0xC8F6, 0x93CF, 0x93D0, 0xCBBA, 0xDEFE, 0x93D1, 0x93D2, 0xDFA4, 0x93D3, 0x93D4, 0x93D5, 0x93D6, 0xD7B2, 0x93D7,
+	0x93D8, 0x93D9, 0x93DA, 0x93DB, 0xB3B7, 0x93DC, 0x93DD, 0x93DE, 0x93DF, 0xC1C3, 0x93E0, 0x93E1, 0xC7CB, 0xB2A5, 0xB4E9, 0x93E2,
+	0xD7AB, 0x93E3, 0x93E4, 0x93E5, 0x93E6, 0xC4EC, 0x93E7, 0xDFA2, 0xDFA3, 0x93E8, 0xDFA5, 0x93E9, 0xBAB3, 0x93EA, 0x93EB, 0x93EC,
+	0xDFA6, 0x93ED, 0xC0DE, 0x93EE, 0x93EF, 0xC9C3, 0x93F0, 0x93F1, 0x93F2, 0x93F3, 0x93F4, 0x93F5, 0x93F6, 0xB2D9, 0xC7E6, 0x93F7,
+	0xDFA7, 0x93F8, 0xC7DC, 0x93F9, 0x93FA, 0x93FB, 0x93FC, 0xDFA8, 0xEBA2, 0x93FD, 0x93FE, 0x9440, 0x9441, 0x9442, 0xCBD3, 0x9443,
+	0x9444, 0x9445, 0xDFAA, 0x9446, 0xDFA9, 0x9447, 0xB2C1, 0x9448, 0x9449, 0x944A, 0x944B, 0x944C, 0x944D, 0x944E, 0x944F, 0x9450,
+	0x9451, 0x9452, 0x9453, 0x9454, 0x9455, 0x9456, 0x9457, 0x9458, 0x9459, 0x945A, 0x945B, 0x945C, 0x945D, 0x945E, 0x945F, 0x9460,
+	0xC5CA, 0x9461, 0x9462, 0x9463, 0x9464, 0x9465, 0x9466, 0x9467, 0x9468, 0xDFAB, 0x9469, 0x946A, 0x946B, 0x946C, 0x946D, 0x946E,
+	0x946F, 0x9470, 0xD4DC, 0x9471, 0x9472, 0x9473, 0x9474, 0x9475, 0xC8C1, 0x9476, 0x9477, 0x9478, 0x9479, 0x947A, 0x947B, 0x947C,
+	0x947D, 0x947E, 0x9480, 0x9481, 0x9482, 0xDFAC, 0x9483, 0x9484, 0x9485, 0x9486, 0x9487, 0xBEF0, 0x9488, 0x9489, 0xDFAD, 0xD6A7,
+	0x948A, 0x948B, 0x948C, 0x948D, 0xEAB7, 0xEBB6, 0xCAD5, 0x948E, 0xD8FC, 0xB8C4, 0x948F, 0xB9A5, 0x9490, 0x9491, 0xB7C5, 0xD5FE,
+	0x9492, 0x9493, 0x9494, 0x9495, 0x9496, 0xB9CA, 0x9497, 0x9498, 0xD0A7, 0xF4CD, 0x9499, 0x949A, 0xB5D0, 0x949B, 0x949C, 0xC3F4,
+	0x949D, 0xBEC8, 0x949E, 0x949F, 0x94A0, 0xEBB7, 0xB0BD, 0x94A1, 0x94A2, 0xBDCC, 0x94A3, 0xC1B2, 0x94A4, 0xB1D6, 0xB3A8, 0x94A5,
+	0x94A6, 0x94A7, 0xB8D2, 0xC9A2, 0x94A8, 0x94A9, 0xB6D8, 0x94AA, 0x94AB, 0x94AC, 0x94AD, 0xEBB8, 0xBEB4, 0x94AE, 0x94AF, 0x94B0,
+	0xCAFD, 0x94B1, 0xC7C3, 0x94B2, 0xD5FB, 0x94B3, 0x94B4, 0xB7F3, 0x94B5, 0x94B6, 0x94B7, 0x94B8, 0x94B9, 0x94BA, 0x94BB, 0x94BC,
+	0x94BD, 0x94BE, 0x94BF, 0x94C0, 0x94C1, 0x94C2, 0x94C3, 0xCEC4, 0x94C4, 0x94C5, 0x94C6, 0xD5AB, 0xB1F3, 0x94C7, 0x94C8, 0x94C9,
+	0xECB3, 0xB0DF, 0x94CA, 0xECB5, 0x94CB, 0x94CC, 0x94CD, 0xB6B7, 0x94CE, 0xC1CF, 0x94CF, 0xF5FA, 0xD0B1, 0x94D0, 0x94D1, 0xD5E5,
+	0x94D2, 0xCED3, 0x94D3, 0x94D4, 0xBDEF, 0xB3E2, 0x94D5, 0xB8AB, 0x94D6, 0xD5B6, 0x94D7, 0xEDBD, 0x94D8, 0xB6CF, 0x94D9, 0xCBB9,
+	0xD0C2, 0x94DA, 0x94DB, 0x94DC, 0x94DD, 0x94DE, 0x94DF, 0x94E0, 0x94E1, 0xB7BD, 0x94E2, 0x94E3, 0xECB6, 0xCAA9, 0x94E4, 0x94E5,
+	0x94E6, 0xC5D4, 0x94E7, 0xECB9, 0xECB8, 0xC2C3, 0xECB7, 0x94E8, 0x94E9, 0x94EA, 0x94EB, 0xD0FD, 0xECBA, 0x94EC, 0xECBB, 0xD7E5,
+	0x94ED, 0x94EE, 0xECBC, 0x94EF, 0x94F0, 0x94F1, 0xECBD, 0xC6EC, 0x94F2, 0x94F3, 0x94F4, 0x94F5, 0x94F6, 0x94F7, 0x94F8, 0x94F9,
+	0xCEDE, 0x94FA, 0xBCC8, 0x94FB, 0x94FC, 0xC8D5, 0xB5A9, 0xBEC9, 0xD6BC, 0xD4E7, 0x94FD, 0x94FE, 0xD1AE, 0xD0F1, 0xEAB8, 0xEAB9,
+	0xEABA, 0xBAB5, 0x9540, 0x9541, 0x9542, 0x9543, 0xCAB1, 0xBFF5, 0x9544, 0x9545, 0xCDFA, 0x9546, 0x9547, 0x9548, 0x9549, 0x954A,
+	0xEAC0, 0x954B, 0xB0BA, 0xEABE, 0x954C, 0x954D, 0xC0A5, 0x954E, 0x954F, 0x9550, 0xEABB, 0x9551, 0xB2FD, 0x9552, 0xC3F7, 0xBBE8,
+	0x9553, 0x9554, 0x9555, 0xD2D7, 0xCEF4, 0xEABF, 0x9556, 0x9557, 0x9558, 0xEABC, 0x9559, 0x955A, 0x955B, 0xEAC3, 0x955C, 0xD0C7,
+	0xD3B3, 0x955D, 0x955E, 0x955F, 0x9560, 0xB4BA, 0x9561, 0xC3C1, 0xD7F2, 0x9562, 0x9563, 0x9564, 0x9565, 0xD5D1, 0x9566, 0xCAC7,
+	0x9567, 0xEAC5, 0x9568, 0x9569, 0xEAC4, 0xEAC7, 0xEAC6, 0x956A, 0x956B, 0x956C, 0x956D, 0x956E, 0xD6E7, 0x956F, 0xCFD4, 0x9570,
+	0x9571, 0xEACB, 0x9572, 0xBBCE, 0x9573, 0x9574, 0x9575, 0x9576, 0x9577, 0x9578, 0x9579, 0xBDFA, 0xC9CE, 0x957A, 0x957B, 0xEACC,
+	0x957C, 0x957D, 0xC9B9, 0xCFFE, 0xEACA, 0xD4CE, 0xEACD, 0xEACF, 0x957E, 0x9580, 0xCDED, 0x9581, 0x9582, 0x9583, 0x9584, 0xEAC9,
+	0x9585, 0xEACE, 0x9586, 0x9587, 0xCEEE, 0x9588, 0xBBDE, 0x9589, 0xB3BF, 0x958A, 0x958B, 0x958C, 0x958D, 0x958E, 0xC6D5, 0xBEB0,
+	0xCEFA, 0x958F, 0x9590, 0x9591, 0xC7E7, 0x9592, 0xBEA7, 0xEAD0, 0x9593, 0x9594, 0xD6C7, 0x9595, 0x9596, 0x9597, 0xC1C0, 0x9598,
+	0x9599, 0x959A, 0xD4DD, 0x959B, 0xEAD1, 0x959C, 0x959D, 0xCFBE, 0x959E, 0x959F, 0x95A0, 0x95A1, 0xEAD2, 0x95A2, 0x95A3, 0x95A4,
+	0x95A5, 0xCAEE, 0x95A6, 0x95A7, 0x95A8, 0x95A9, 0xC5AF, 0xB0B5, 0x95AA, 0x95AB, 0x95AC, 0x95AD, 0x95AE, 0xEAD4, 0x95AF, 0x95B0,
+	0x95B1, 0x95B2, 0x95B3, 0x95B4, 0x95B5, 0x95B6, 0x95B7, 0xEAD3, 0xF4DF, 0x95B8, 0x95B9, 0x95BA, 0x95BB, 0x95BC, 0xC4BA, 0x95BD,
+	0x95BE, 0x95BF, 0x95C0, 0x95C1, 0xB1A9, 0x95C2, 0x95C3, 0x95C4, 0x95C5, 0xE5DF, 0x95C6, 0x95C7, 0x95C8, 0x95C9, 0xEAD5, 0x95CA,
+	0x95CB, 0x95CC, 0x95CD, 0x95CE, 0x95CF, 0x95D0, 0x95D1, 0x95D2, 0x95D3, 0x95D4, 0x95D5, 0x95D6, 0x95D7, 0x95D8, 0x95D9, 0x95DA,
+	0x95DB, 0x95DC, 0x95DD, 0x95DE, 0x95DF, 0x95E0, 0x95E1, 0x95E2, 0x95E3, 0xCAEF, 0x95E4, 0xEAD6, 0xEAD7, 0xC6D8, 0x95E5, 0x95E6,
+	0x95E7, 0x95E8, 0x95E9, 0x95EA, 0x95EB, 0x95EC, 0xEAD8, 0x95ED, 0x95EE, 0xEAD9, 0x95EF, 0x95F0, 0x95F1, 0x95F2, 0x95F3, 0x95F4,
+	0xD4BB, 0x95F5, 0xC7FA, 0xD2B7, 0xB8FC, 0x95F6, 0x95F7, 0xEAC2, 0x95F8, 0xB2DC, 0x95F9, 0x95FA, 0xC2FC, 0x95FB, 0xD4F8, 0xCCE6,
+	0xD7EE, 0x95FC, 0x95FD, 0x95FE, 0x9640, 0x9641, 0x9642, 0x9643, 0xD4C2, 0xD3D0, 0xEBC3, 0xC5F3, 0x9644, 0xB7FE, 0x9645, 0x9646,
+	0xEBD4, 0x9647, 0x9648, 0x9649, 0xCBB7, 0xEBDE, 0x964A, 0xC0CA, 0x964B, 0x964C, 0x964D, 0xCDFB, 0x964E, 0xB3AF, 0x964F, 0xC6DA,
+	0x9650, 0x9651, 0x9652, 0x9653, 0x9654, 0x9655, 0xEBFC, 0x9656, 0xC4BE, 0x9657, 0xCEB4, 0xC4A9, 0xB1BE, 0xD4FD, 0x9658, 0xCAF5,
+	0x9659, 0xD6EC, 0x965A, 0x965B, 0xC6D3, 0xB6E4, 0x965C, 0x965D, 0x965E, 0x965F, 0xBBFA, 0x9660, 0x9661, 0xD0E0, 0x9662, 0x9663,
+	0xC9B1, 0x9664, 0xD4D3, 0xC8A8, 0x9665, 0x9666, 0xB8CB, 0x9667, 0xE8BE, 0xC9BC, 0x9668, 0x9669, 0xE8BB, 0x966A, 0xC0EE, 0xD0D3,
+	0xB2C4, 0xB4E5, 0x966B, 0xE8BC, 0x966C, 0x966D, 0xD5C8, 0x966E, 0x966F, 0x9670, 0x9671, 0x9672, 0xB6C5, 0x9673, 0xE8BD, 0xCAF8,
+	0xB8DC, 0xCCF5, 0x9674, 0x9675, 0x9676, 0xC0B4, 0x9677, 0x9678, 0xD1EE, 0xE8BF, 0xE8C2, 0x9679, 0x967A, 0xBABC, 0x967B, 0xB1AD,
+	0xBDDC, 0x967C, 0xEABD, 0xE8C3, 0x967D, 0xE8C6, 0x967E, 0xE8CB, 0x9680, 0x9681, 0x9682, 0x9683, 0xE8CC, 0x9684, 0xCBC9, 0xB0E5,
+	0x9685, 0xBCAB, 0x9686, 0x9687, 0xB9B9, 0x9688, 0x9689, 0xE8C1, 0x968A, 0xCDF7, 0x968B, 0xE8CA, 0x968C, 0x968D, 0x968E, 0x968F,
+	0xCEF6, 0x9690, 0x9691, 0x9692, 0x9693, 0xD5ED, 0x9694, 0xC1D6, 0xE8C4, 0x9695, 0xC3B6, 0x9696, 0xB9FB, 0xD6A6, 0xE8C8, 0x9697,
+	0x9698, 0x9699, 0xCAE0, 0xD4E6, 0x969A, 0xE8C0, 0x969B, 0xE8C5, 0xE8C7, 0x969C, 0xC7B9, 0xB7E3, 0x969D, 0xE8C9, 0x969E, 0xBFDD,
+	0xE8D2, 0x969F, 0x96A0, 0xE8D7, 0x96A1, 0xE8D5, 0xBCDC, 0xBCCF, 0xE8DB, 0x96A2, 0x96A3, 0x96A4, 0x96A5, 0x96A6, 0x96A7, 0x96A8,
+	0x96A9, 0xE8DE, 0x96AA, 0xE8DA, 0xB1FA, 0x96AB, 0x96AC, 0x96AD, 0x96AE, 0x96AF, 0x96B0, 0x96B1, 0x96B2, 0x96B3, 0x96B4, 0xB0D8,
+	0xC4B3, 0xB8CC, 0xC6E2, 0xC8BE, 0xC8E1, 0x96B5, 0x96B6, 0x96B7, 0xE8CF, 0xE8D4, 0xE8D6, 0x96B8, 0xB9F1, 0xE8D8, 0xD7F5, 0x96B9,
+	0xC4FB, 0x96BA, 0xE8DC, 0x96BB, 0x96BC, 0xB2E9, 0x96BD, 0x96BE, 0x96BF, 0xE8D1, 0x96C0, 0x96C1, 0xBCED, 0x96C2, 0x96C3, 0xBFC2,
+	0xE8CD, 0xD6F9, 0x96C4, 0xC1F8, 0xB2F1, 0x96C5, 0x96C6, 0x96C7, 0x96C8, 0x96C9, 0x96CA, 0x96CB, 0x96CC, 0xE8DF, 0x96CD, 0xCAC1,
+	0xE8D9, 0x96CE, 0x96CF, 0x96D0, 0x96D1, 0xD5A4, 0x96D2, 0xB1EA, 0xD5BB, 0xE8CE, 0xE8D0, 0xB6B0, 0xE8D3, 0x96D3, 0xE8DD, 0xC0B8,
+	0x96D4, 0xCAF7, 0x96D5, 0xCBA8, 0x96D6, 0x96D7, 0xC6DC, 0xC0F5, 0x96D8, 0x96D9, 0x96DA, 0x96DB, 0x96DC, 0xE8E9, 0x96DD, 0x96DE,
+	0x96DF, 0xD0A3, 0x96E0, 0x96E1, 0x96E2, 0x96E3, 0x96E4, 0x96E5, 0x96E6, 0xE8F2, 0xD6EA, 0x96E7, 0x96E8, 0x96E9, 0x96EA, 0x96EB,
+	0x96EC, 0x96ED, 0xE8E0, 0xE8E1, 0x96EE, 0x96EF, 0x96F0, 0xD1F9, 0xBACB, 0xB8F9, 0x96F1, 0x96F2, 0xB8F1, 0xD4D4, 0xE8EF, 0x96F3,
+	0xE8EE, 0xE8EC, 0xB9F0, 0xCCD2, 0xE8E6, 0xCEA6, 0xBFF2, 0x96F4, 0xB0B8, 0xE8F1, 0xE8F0, 0x96F5, 0xD7C0, 0x96F6, 0xE8E4, 0x96F7,
+	0xCDA9, 0xC9A3, 0x96F8, 0xBBB8, 0xBDDB, 0xE8EA, 0x96F9, 0x96FA, 0x96FB, 0x96FC, 0x96FD, 0x96FE, 0x9740, 0x9741, 0x9742, 0x9743,
+	0xE8E2, 0xE8E3, 0xE8E5, 0xB5B5, 0xE8E7, 0xC7C5, 0xE8EB, 0xE8ED, 0xBDB0, 0xD7AE, 0x9744, 0xE8F8, 0x9745, 0x9746, 0x9747, 0x9748,
+	0x9749, 0x974A, 0x974B, 0x974C, 0xE8F5, 0x974D, 0xCDB0, 0xE8F6, 0x974E, 0x974F, 0x9750, 0x9751, 0x9752, 0x9753, 0x9754, 0x9755,
+	0x9756, 0xC1BA, 0x9757, 0xE8E8, 0x9758, 0xC3B7, 0xB0F0, 0x9759, 0x975A, 0x975B, 0x975C, 0x975D, 0x975E, 0x975F, 0x9760, 0xE8F4,
+	0x9761, 0x9762, 0x9763, 0xE8F7, 0x9764, 0x9765, 0x9766, 0xB9A3, 0x9767, 0x9768, 0x9769, 0x976A, 0x976B, 0x976C, 0x976D, 0x976E,
+	0x976F, 0x9770, 0xC9D2, 0x9771, 0x9772, 0x9773, 0xC3CE, 0xCEE0, 0xC0E6, 0x9774, 0x9775, 0x9776, 0x9777, 0xCBF3, 0x9778, 0xCCDD,
+	0xD0B5, 0x9779, 0x977A, 0xCAE1, 0x977B, 0xE8F3, 0x977C, 0x977D, 0x977E, 0x9780, 0x9781, 0x9782, 0x9783, 0x9784, 0x9785, 0x9786,
+	0xBCEC, 0x9787, 0xE8F9, 0x9788, 0x9789, 0x978A, 0x978B, 0x978C, 0x978D, 0xC3DE, 0x978E, 0xC6E5, 0x978F, 0xB9F7, 0x9790, 0x9791,
+	0x9792, 0x9793, 0xB0F4, 0x9794, 0x9795, 0xD7D8, 0x9796, 0x9797, 0xBCAC, 0x9798, 0xC5EF, 0x9799, 0x979A, 0x979B, 0x979C, 0x979D,
+	0xCCC4, 0x979E, 0x979F, 0xE9A6, 0x97A0, 0x97A1, 0x97A2, 0x97A3, 0x97A4, 0x97A5, 0x97A6, 0x97A7, 0x97A8, 0x97A9, 0xC9AD, 0x97AA,
+	0xE9A2, 0xC0E2, 0x97AB, 0x97AC, 0x97AD, 0xBFC3, 0x97AE, 0x97AF, 0x97B0, 0xE8FE, 0xB9D7, 0x97B1, 0xE8FB, 0x97B2, 0x97B3, 0x97B4,
+	0x97B5, 0xE9A4, 0x97B6, 0x97B7, 0x97B8, 0xD2CE, 0x97B9, 0x97BA, 0x97BB, 0x97BC, 0x97BD, 0xE9A3, 0x97BE, 0xD6B2, 0xD7B5, 0x97BF,
+	0xE9A7, 0x97C0, 0xBDB7, 0x97C1, 0x97C2, 0x97C3, 0x97C4, 0x97C5, 0x97C6, 0x97C7, 0x97C8, 0x97C9, 0x97CA, 0x97CB, 0x97CC, 0xE8FC,
+	0xE8FD, 0x97CD, 0x97CE, 0x97CF, 0xE9A1, 0x97D0, 0x97D1, 0x97D2, 0x97D3, 0x97D4, 0x97D5, 0x97D6, 0x97D7, 0xCDD6, 0x97D8, 0x97D9,
+	0xD2AC, 0x97DA, 0x97DB, 0x97DC, 0xE9B2, 0x97DD, 0x97DE, 0x97DF, 0x97E0, 0xE9A9, 0x97E1, 0x97E2, 0x97E3, 0xB4AA, 0x97E4, 0xB4BB,
+	0x97E5, 0x97E6, 0xE9AB, 0x97E7, 0x97E8, 0x97E9, 0x97EA, 0x97EB, 0x97EC, 0x97ED, 0x97EE, 0x97EF, 0x97F0, 0x97F1, 0x97F2, 0x97F3,
+	0x97F4, 0x97F5, 0x97F6, 0x97F7, 0xD0A8, 0x97F8, 0x97F9, 0xE9A5, 0x97FA, 0x97FB, 0xB3FE, 0x97FC, 0x97FD, 0xE9AC, 0xC0E3, 0x97FE,
+	0xE9AA, 0x9840, 0x9841, 0xE9B9, 0x9842, 0x9843, 0xE9B8, 0x9844, 0x9845, 0x9846, 0x9847, 0xE9AE, 0x9848, 0x9849, 0xE8FA, 0x984A,
+	0x984B, 0xE9A8, 0x984C, 0x984D, 0x984E, 0x984F, 0x9850, 0xBFAC, 0xE9B1, 0xE9BA, 0x9851, 0x9852, 0xC2A5, 0x9853, 0x9854, 0x9855,
+	0xE9AF, 0x9856, 0xB8C5, 0x9857, 0xE9AD, 0x9858, 0xD3DC, 0xE9B4, 0xE9B5, 0xE9B7, 0x9859, 0x985A, 0x985B, 0xE9C7, 0x985C, 0x985D,
+	0x985E, 0x985F, 0x9860, 0x9861, 0xC0C6, 0xE9C5, 0x9862, 0x9863, 0xE9B0, 0x9864, 0x9865, 0xE9BB, 0xB0F1, 0x9866, 0x9867, 0x9868,
+	0x9869, 0x986A, 0x986B, 0x986C, 0x986D, 0x986E, 0x986F, 0xE9BC, 0xD5A5, 0x9870, 0x9871, 0xE9BE, 0x9872, 0xE9BF, 0x9873, 0x9874,
+	0x9875, 0xE9C1, 0x9876, 0x9877, 0xC1F1, 0x9878, 0x9879, 0xC8B6, 0x987A, 0x987B, 0x987C, 0xE9BD, 0x987D, 0x987E, 0x9880, 0x9881,
+	0x9882, 0xE9C2, 0x9883, 0x9884, 0x9885, 0x9886, 0x9887, 0x9888, 0x9889, 0x988A, 0xE9C3, 0x988B, 0xE9B3, 0x988C, 0xE9B6, 0x988D,
+	0xBBB1, 0x988E, 0x988F, 0x9890, 0xE9C0, 0x9891, 0x9892, 0x9893, 0x9894, 0x9895, 0x9896, 0xBCF7, 0x9897, 0x9898, 0x9899, 0xE9C4,
+	0xE9C6, 0x989A, 0x989B, 0x989C, 0x989D, 0x989E, 0x989F, 0x98A0, 0x98A1, 0x98A2, 0x98A3, 0x98A4, 0x98A5, 0xE9CA, 0x98A6, 0x98A7,
+	0x98A8, 0x98A9, 0xE9CE, 0x98AA, 0x98AB, 0x98AC, 0x98AD, 0x98AE, 0x98AF, 0x98B0, 0x98B1, 0x98B2, 0x98B3, 0xB2DB, 0x98B4, 0xE9C8,
+	0x98B5, 0x98B6, 0x98B7, 0x98B8, 0x98B9, 0x98BA, 0x98BB, 0x98BC, 0x98BD, 0x98BE, 0xB7AE, 0x98BF, 0x98C0, 0x98C1, 0x98C2, 0x98C3,
+	0x98C4, 0x98C5, 0x98C6, 0x98C7, 0x98C8, 0x98C9, 0x98CA, 0xE9CB, 0xE9CC, 0x98CB, 0x98CC, 0x98CD, 0x98CE, 0x98CF, 0x98D0, 0xD5C1,
+	0x98D1, 0xC4A3, 0x98D2, 0x98D3, 0x98D4, 0x98D5, 0x98D6, 0x98D7, 0xE9D8, 0x98D8, 0xBAE1, 0x98D9, 0x98DA, 0x98DB, 0x98DC, 0xE9C9,
+	0x98DD, 0xD3A3, 0x98DE, 0x98DF, 0x98E0, 0xE9D4, 0x98E1, 0x98E2, 0x98E3, 0x98E4, 0x98E5, 0x98E6, 0x98E7, 0xE9D7, 0xE9D0, 0x98E8,
+	0x98E9, 0x98EA, 0x98EB, 0x98EC, 0xE9CF, 0x98ED, 0x98EE, 0xC7C1, 0x98EF, 0x98F0, 0x98F1, 0x98F2, 0x98F3, 0x98F4, 0x98F5, 0x98F6,
+	0xE9D2, 0x98F7, 0x98F8, 0x98F9, 0x98FA, 0x98FB, 0x98FC, 0x98FD, 0xE9D9, 0xB3C8, 0x98FE, 0xE9D3, 0x9940, 0x9941, 0x9942, 0x9943,
+	0x9944, 0xCFF0, 0x9945, 0x9946, 0x9947, 0xE9CD, 0x9948, 0x9949, 0x994A, 0x994B, 0x994C, 0x994D, 0x994E, 0x994F, 0x9950, 0x9951,
+	0x9952, 0xB3F7, 0x9953, 0x9954, 0x9955, 0x9956, 0x9957, 0x9958, 0x9959, 0xE9D6, 0x995A, 0x995B, 0xE9DA, 0x995C, 0x995D, 0x995E,
+	0xCCB4, 0x995F, 0x9960, 0x9961, 0xCFAD, 0x9962, 0x9963, 0x9964, 0x9965, 0x9966, 0x9967, 0x9968, 0x9969, 0x996A, 0xE9D5, 0x996B,
+	0xE9DC, 0xE9DB, 0x996C, 0x996D, 0x996E, 0x996F, 0x9970, 0xE9DE, 0x9971, 0x9972, 0x9973, 0x9974, 0x9975, 0x9976, 0x9977, 0x9978,
+	0xE9D1, 0x9979, 0x997A, 0x997B, 0x997C, 0x997D, 0x997E, 0x9980, 0x9981, 0xE9DD, 0x9982, 0xE9DF, 0xC3CA, 0x9983, 0x9984, 0x9985,
+	0x9986, 0x9987, 0x9988, 0x9989, 0x998A, 0x998B, 0x998C, 0x998D, 0x998E, 0x998F, 0x9990, 0x9991, 0x9992, 0x9993, 0x9994, 0x9995,
+	0x9996, 0x9997, 0x9998, 0x9999, 0x999A, 0x999B, 0x999C, 0x999D, 0x999E, 0x999F, 0x99A0, 0x99A1, 0x99A2, 0x99A3, 0x99A4, 0x99A5,
+	0x99A6, 0x99A7, 0x99A8, 0x99A9, 0x99AA, 0x99AB, 0x99AC, 0x99AD, 0x99AE, 0x99AF, 0x99B0, 0x99B1, 0x99B2, 0x99B3, 0x99B4, 0x99B5,
+	0x99B6, 0x99B7, 0x99B8, 0x99B9, 0x99BA, 0x99BB, 0x99BC, 0x99BD, 0x99BE, 0x99BF, 0x99C0, 0x99C1, 0x99C2, 0x99C3, 0x99C4, 0x99C5,
+	0x99C6, 0x99C7, 0x99C8, 0x99C9, 0x99CA, 0x99CB, 0x99CC, 0x99CD, 0x99CE, 0x99CF, 0x99D0, 0x99D1, 0x99D2, 0x99D3, 0x99D4, 0x99D5,
+	0x99D6, 0x99D7, 0x99D8, 0x99D9, 0x99DA, 0x99DB, 0x99DC, 0x99DD, 0x99DE, 0x99DF, 0x99E0, 0x99E1, 0x99E2, 0x99E3, 0x99E4, 0x99E5,
+	0x99E6, 0x99E7, 0x99E8, 0x99E9, 0x99EA, 0x99EB, 0x99EC, 0x99ED, 0x99EE, 0x99EF, 0x99F0, 0x99F1, 0x99F2, 0x99F3, 0x99F4, 0x99F5,
+	0xC7B7, 0xB4CE, 0xBBB6, 0xD0C0, 0xECA3, 0x99F6, 0x99F7, 0xC5B7, 0x99F8, 0x99F9, 0x99FA, 0x99FB, 0x99FC, 0x99FD, 0x99FE, 0x9A40,
+	0x9A41, 0x9A42, 0xD3FB, 0x9A43, 0x9A44, 0x9A45, 0x9A46, 0xECA4, 0x9A47, 0xECA5, 0xC6DB, 0x9A48, 0x9A49, 0x9A4A, 0xBFEE, 0x9A4B,
+	0x9A4C, 0x9A4D, 0x9A4E, 0xECA6, 0x9A4F, 0x9A50, 0xECA7, 0xD0AA, 0x9A51, 0xC7B8, 0x9A52, 0x9A53, 0xB8E8, 0x9A54, 0x9A55, 0x9A56,
+	0x9A57, 0x9A58, 0x9A59, 0x9A5A, 0x9A5B, 0x9A5C, 0x9A5D, 0x9A5E, 0x9A5F, 0xECA8, 0x9A60, 0x9A61, 0x9A62, 0x9A63, 0x9A64, 0x9A65,
+	0x9A66, 0x9A67, 0xD6B9, 0xD5FD, 0xB4CB, 0xB2BD, 0xCEE4, 0xC6E7, 0x9A68, 0x9A69, 0xCDE1, 0x9A6A, 0x9A6B, 0x9A6C, 0x9A6D, 0x9A6E,
+	0x9A6F, 0x9A70, 0x9A71, 0x9A72, 0x9A73, 0x9A74, 0x9A75, 0x9A76, 0x9A77, 0xB4F5, 0x9A78, 0xCBC0, 0xBCDF, 0x9A79, 0x9A7A, 0x9A7B,
+	0x9A7C, 0xE9E2, 0xE9E3, 0xD1EA, 0xE9E5, 0x9A7D, 0xB4F9, 0xE9E4, 0x9A7E, 0xD1B3, 0xCAE2, 0xB2D0, 0x9A80, 0xE9E8, 0x9A81, 0x9A82,
+	0x9A83, 0x9A84, 0xE9E6, 0xE9E7, 0x9A85, 0x9A86, 0xD6B3, 0x9A87, 0x9A88, 0x9A89, 0xE9E9, 0xE9EA, 0x9A8A, 0x9A8B, 0x9A8C, 0x9A8D,
+	0x9A8E, 0xE9EB, 0x9A8F, 0x9A90, 0x9A91, 0x9A92, 0x9A93, 0x9A94, 0x9A95, 0x9A96, 0xE9EC, 0x9A97, 0x9A98, 0x9A99, 0x9A9A, 0x9A9B,
+	0x9A9C, 0x9A9D, 0x9A9E, 0xECAF, 0xC5B9, 0xB6CE, 0x9A9F, 0xD2F3, 0x9AA0, 0x9AA1, 0x9AA2, 0x9AA3, 0x9AA4, 0x9AA5, 0x9AA6, 0xB5EE,
+	0x9AA7, 0xBBD9, 0xECB1, 0x9AA8, 0x9AA9, 0xD2E3, 0x9AAA, 0x9AAB, 0x9AAC, 0x9AAD, 0x9AAE, 0xCEE3, 0x9AAF, 0xC4B8, 0x9AB0, 0xC3BF,
+	0x9AB1, 0x9AB2, 0xB6BE, 0xD8B9, 0xB1C8, 0xB1CF, 0xB1D1, 0xC5FE, 0x9AB3, 0xB1D0, 0x9AB4, 0xC3AB, 0x9AB5, 0x9AB6, 0x9AB7, 0x9AB8,
+	0x9AB9, 0xD5B1, 0x9ABA, 0x9ABB, 0x9ABC, 0x9ABD, 0x9ABE, 0x9ABF, 0x9AC0, 0x9AC1, 0xEBA4, 0xBAC1, 0x9AC2, 0x9AC3, 0x9AC4, 0xCCBA,
+	0x9AC5, 0x9AC6, 0x9AC7, 0xEBA5, 0x9AC8, 0xEBA7, 0x9AC9, 0x9ACA, 0x9ACB, 0xEBA8, 0x9ACC, 0x9ACD, 0x9ACE, 0xEBA6, 0x9ACF, 0x9AD0,
+	0x9AD1, 0x9AD2, 0x9AD3, 0x9AD4, 0x9AD5, 0xEBA9, 0xEBAB, 0xEBAA, 0x9AD6, 0x9AD7, 0x9AD8, 0x9AD9, 0x9ADA, 0xEBAC, 0x9ADB, 0xCACF,
+	0xD8B5, 0xC3F1, 0x9ADC, 0xC3A5, 0xC6F8, 0xEBAD, 0xC4CA, 0x9ADD, 0xEBAE, 0xEBAF, 0xEBB0, 0xB7D5, 0x9ADE, 0x9ADF, 0x9AE0, 0xB7FA,
+	0x9AE1, 0xEBB1, 0xC7E2, 0x9AE2, 0xEBB3, 0x9AE3, 0xBAA4, 0xD1F5, 0xB0B1, 0xEBB2, 0xEBB4, 0x9AE4, 0x9AE5, 0x9AE6, 0xB5AA, 0xC2C8,
+	0xC7E8, 0x9AE7, 0xEBB5, 0x9AE8, 0xCBAE, 0xE3DF, 0x9AE9, 0x9AEA, 0xD3C0, 0x9AEB, 0x9AEC, 0x9AED, 0x9AEE, 0xD9DB, 0x9AEF, 0x9AF0,
+	0xCDA1, 0xD6AD, 0xC7F3, 0x9AF1, 0x9AF2, 0x9AF3, 0xD9E0, 0xBBE3, 0x9AF4, 0xBABA, 0xE3E2, 0x9AF5, 0x9AF6, 0x9AF7, 0x9AF8, 0x9AF9,
+	0xCFAB, 0x9AFA, 0x9AFB, 0x9AFC, 0xE3E0, 0xC9C7, 0x9AFD, 0xBAB9, 0x9AFE, 0x9B40, 0x9B41, 0xD1B4, 0xE3E1, 0xC8EA, 0xB9AF, 0xBDAD,
+	0xB3D8, 0xCEDB, 0x9B42, 0x9B43, 0xCCC0, 0x9B44, 0x9B45, 0x9B46, 0xE3E8, 0xE3E9, 0xCDF4, 0x9B47, 0x9B48, 0x9B49, 0x9B4A, 0x9B4B,
+	0xCCAD, 0x9B4C, 0xBCB3, 0x9B4D, 0xE3EA, 0x9B4E, 0xE3EB, 0x9B4F, 0x9B50, 0xD0DA, 0x9B51, 0x9B52, 0x9B53, 0xC6FB, 0xB7DA, 0x9B54,
+	0x9B55, 0xC7DF, 0xD2CA, 0xCED6, 0x9B56, 0xE3E4, 0xE3EC, 0x9B57, 0xC9F2, 0xB3C1, 0x9B58, 0x9B59, 0xE3E7, 0x9B5A, 0x9B5B, 0xC6E3,
+	0xE3E5, 0x9B5C, 0x9B5D, 0xEDB3, 0xE3E6, 0x9B5E, 0x9B5F, 0x9B60, 0x9B61, 0xC9B3, 0x9B62, 0xC5E6, 0x9B63, 0x9B64, 0x9B65, 0xB9B5,
+	0x9B66, 0xC3BB, 0x9B67, 0xE3E3, 0xC5BD, 0xC1A4, 0xC2D9, 0xB2D7, 0x9B68, 0xE3ED, 0xBBA6, 0xC4AD, 0x9B69, 0xE3F0, 0xBEDA, 0x9B6A,
+	0x9B6B, 0xE3FB, 0xE3F5, 0xBAD3, 0x9B6C, 0x9B6D, 0x9B6E, 0x9B6F, 0xB7D0, 0xD3CD, 0x9B70, 0xD6CE, 0xD5D3, 0xB9C1, 0xD5B4, 0xD1D8,
+	0x9B71, 0x9B72, 0x9B73, 0x9B74, 0xD0B9, 0xC7F6, 0x9B75, 0x9B76, 0x9B77, 0xC8AA, 0xB2B4, 0x9B78, 0xC3DA, 0x9B79, 0x9B7A, 0x9B7B,
+	0xE3EE, 0x9B7C, 0x9B7D, 0xE3FC, 0xE3EF, 0xB7A8, 0xE3F7, 0xE3F4, 0x9B7E, 0x9B80, 0x9B81, 0xB7BA, 0x9B82, 0x9B83, 0xC5A2, 0x9B84,
+	0xE3F6, 0xC5DD, 0xB2A8, 0xC6FC, 0x9B85, 0xC4E0, 0x9B86, 0x9B87, 0xD7A2, 0x9B88, 0xC0E1, 0xE3F9, 0x9B89, 0x9B8A, 0xE3FA, 0xE3FD,
+	0xCCA9, 0xE3F3, 0x9B8B, 0xD3BE, 0x9B8C, 0xB1C3, 0xEDB4, 0xE3F1, 0xE3F2, 0x9B8D, 0xE3F8, 0xD0BA, 0xC6C3, 0xD4F3, 0xE3FE, 0x9B8E,
+	0x9B8F, 0xBDE0, 0x9B90, 0x9B91, 0xE4A7, 0x9B92, 0x9B93, 0xE4A6, 0x9B94, 0x9B95, 0x9B96, 0xD1F3, 0xE4A3, 0x9B97, 0xE4A9, 0x9B98,
+	0x9B99, 0x9B9A, 0xC8F7, 0x9B9B, 0x9B9C, 0x9B9D, 0x9B9E, 0xCFB4, 0x9B9F, 0xE4A8, 0xE4AE, 0xC2E5, 0x9BA0, 0x9BA1, 0xB6B4, 0x9BA2,
+	0x9BA3, 0x9BA4, 0x9BA5, 0x9BA6, 0x9BA7, 0xBDF2, 0x9BA8, 0xE4A2, 0x9BA9, 0x9BAA, 0xBAE9, 0xE4AA, 0x9BAB, 0x9BAC, 0xE4AC, 0x9BAD,
+	0x9BAE, 0xB6FD, 0xD6DE, 0xE4B2, 0x9BAF, 0xE4AD, 0x9BB0, 0x9BB1, 0x9BB2, 0xE4A1, 0x9BB3, 0xBBEE, 0xCDDD, 0xC7A2, 0xC5C9, 0x9BB4,
+	0x9BB5, 0xC1F7, 0x9BB6, 0xE4A4, 0x9BB7, 0xC7B3, 0xBDAC, 0xBDBD, 0xE4A5, 0x9BB8, 0xD7C7, 0xB2E2, 0x9BB9, 0xE4AB, 0xBCC3, 0xE4AF,
+	0x9BBA, 0xBBEB, 0xE4B0, 0xC5A8, 0xE4B1, 0x9BBB, 0x9BBC, 0x9BBD, 0x9BBE, 0xD5E3, 0xBFA3, 0x9BBF, 0xE4BA, 0x9BC0, 0xE4B7, 0x9BC1,
+	0xE4BB, 0x9BC2, 0x9BC3, 0xE4BD, 0x9BC4, 0x9BC5, 0xC6D6, 0x9BC6, 0x9BC7, 0xBAC6, 0xC0CB, 0x9BC8, 0x9BC9, 0x9BCA, 0xB8A1, 0xE4B4,
+	0x9BCB, 0x9BCC, 0x9BCD, 0x9BCE, 0xD4A1, 0x9BCF, 0x9BD0, 0xBAA3, 0xBDFE, 0x9BD1, 0x9BD2, 0x9BD3, 0xE4BC, 0x9BD4, 0x9BD5, 0x9BD6,
+	0x9BD7, 0x9BD8, 0xCDBF, 0x9BD9, 0x9BDA, 0xC4F9, 0x9BDB, 0x9BDC, 0xCFFB, 0xC9E6, 0x9BDD, 0x9BDE, 0xD3BF, 0x9BDF, 0xCFD1, 0x9BE0,
+	0x9BE1, 0xE4B3, 0x9BE2, 0xE4B8, 0xE4B9, 0xCCE9, 0x9BE3, 0x9BE4, 0x9BE5, 0x9BE6, 0x9BE7, 0xCCCE, 0x9BE8, 0xC0D4, 0xE4B5, 0xC1B0,
+	0xE4B6, 0xCED0, 0x9BE9, 0xBBC1, 0xB5D3, 0x9BEA, 0xC8F3, 0xBDA7, 0xD5C7, 0xC9AC, 0xB8A2, 0xE4CA, 0x9BEB, 0x9BEC, 0xE4CC, 0xD1C4,
+	0x9BED, 0x9BEE, 0xD2BA, 0x9BEF, 0x9BF0, 0xBAAD, 0x9BF1, 0x9BF2, 0xBAD4, 0x9BF3, 0x9BF4, 0x9BF5, 0x9BF6, 0x9BF7, 0x9BF8, 0xE4C3,
+	0xB5ED, 0x9BF9, 0x9BFA, 0x9BFB, 0xD7CD, 0xE4C0, 0xCFFD, 0xE4BF, 0x9BFC, 0x9BFD, 0x9BFE, 0xC1DC, 0xCCCA, 0x9C40, 0x9C41, 0x9C42,
+	0x9C43, 0xCAE7, 0x9C44, 0x9C45, 0x9C46, 0x9C47, 0xC4D7, 0x9C48, 0xCCD4, 0xE4C8, 0x9C49, 0x9C4A, 0x9C4B, 0xE4C7, 0xE4C1, 0x9C4C,
+	0xE4C4, 0xB5AD, 0x9C4D, 0x9C4E, 0xD3D9, 0x9C4F, 0xE4C6, 0x9C50, 0x9C51, 0x9C52, 0x9C53, 0xD2F9, 0xB4E3, 0x9C54, 0xBBB4, 0x9C55,
+	0x9C56, 0xC9EE, 0x9C57, 0xB4BE, 0x9C58, 0x9C59, 0x9C5A, 0xBBEC, 0x9C5B, 0xD1CD, 0x9C5C, 0xCCED, 0xEDB5, 0x9C5D, 0x9C5E, 0x9C5F,
+	0x9C60, 0x9C61, 0x9C62, 0x9C63, 0x9C64, 0xC7E5, 0x9C65, 0x9C66, 0x9C67, 0x9C68, 0xD4A8, 0x9C69, 0xE4CB, 0xD7D5, 0xE4C2, 0x9C6A,
+	0xBDA5, 0xE4C5, 0x9C6B, 0x9C6C, 0xD3E6, 0x9C6D, 0xE4C9, 0xC9F8, 0x9C6E, 0x9C6F, 0xE4BE, 0x9C70, 0x9C71, 0xD3E5, 0x9C72, 0x9C73,
+	0xC7FE, 0xB6C9, 0x9C74, 0xD4FC, 0xB2B3, 0xE4D7, 0x9C75, 0x9C76, 0x9C77, 0xCEC2, 0x9C78, 0xE4CD, 0x9C79, 0xCEBC, 0x9C7A, 0xB8DB,
+	0x9C7B, 0x9C7C, 0xE4D6, 0x9C7D, 0xBFCA, 0x9C7E, 0x9C80, 0x9C81, 0xD3CE, 0x9C82, 0xC3EC, 0x9C83, 0x9C84, 0x9C85, 0x9C86, 0x9C87,
+	0x9C88, 0x9C89, 0x9C8A, 0xC5C8, 0xE4D8, 0x9C8B, 0x9C8C, 0x9C8D, 0x9C8E, 0x9C8F, 0x9C90, 0x9C91, 0x9C92, 0xCDC4, 0xE4CF, 0x9C93,
+	0x9C94, 0x9C95, 0x9C96, 0xE4D4, 0xE4D5, 0x9C97, 0xBAFE, 0x9C98, 0xCFE6, 0x9C99, 0x9C9A, 0xD5BF, 0x9C9B, 0x9C9C, 0x9C9D, 0xE4D2,
+	0x9C9E, 0x9C9F, 0x9CA0, 0x9CA1, 0x9CA2, 0x9CA3, 0x9CA4, 0x9CA5, 0x9CA6, 0x9CA7, 0x9CA8, 0xE4D0, 0x9CA9, 0x9CAA, 0xE4CE, 0x9CAB,
+	0x9CAC, 0x9CAD, 0x9CAE, 0x9CAF, 0x9CB0, 0x9CB1, 0x9CB2, 0x9CB3, 0x9CB4, 0x9CB5, 0x9CB6, 0x9CB7, 0x9CB8, 0x9CB9, 0xCDE5, 0xCAAA,
+	0x9CBA, 0x9CBB, 0x9CBC, 0xC0A3, 0x9CBD, 0xBDA6, 0xE4D3, 0x9CBE, 0x9CBF, 0xB8C8, 0x9CC0, 0x9CC1, 0x9CC2, 0x9CC3, 0x9CC4, 0xE4E7,
+	0xD4B4, 0x9CC5, 0x9CC6, 0x9CC7, 0x9CC8, 0x9CC9, 0x9CCA, 0x9CCB, 0xE4DB, 0x9CCC, 0x9CCD, 0x9CCE, 0xC1EF, 0x9CCF, 0x9CD0, 0xE4E9,
+	0x9CD1, 0x9CD2, 0xD2E7, 0x9CD3, 0x9CD4, 0xE4DF, 0x9CD5, 0xE4E0, 0x9CD6, 0x9CD7, 0xCFAA, 0x9CD8, 0x9CD9, 0x9CDA, 0x9CDB, 0xCBDD,
+	0x9CDC, 0xE4DA, 0xE4D1, 0x9CDD, 0xE4E5, 0x9CDE, 0xC8DC, 0xE4E3, 0x9CDF, 0x9CE0, 0xC4E7, 0xE4E2, 0x9CE1, 0xE4E1, 0x9CE2, 0x9CE3,
+	0x9CE4, 0xB3FC, 0xE4E8, 0x9CE5, 0x9CE6, 0x9CE7, 0x9CE8, 0xB5E1, 0x9CE9, 0x9CEA, 0x9CEB, 0xD7CC, 0x9CEC, 0x9CED, 0x9CEE, 0xE4E6,
+	0x9CEF, 0xBBAC, 0x9CF0, 0xD7D2, 0xCCCF, 0xEBF8, 0x9CF1, 0xE4E4, 0x9CF2, 0x9CF3, 0xB9F6, 0x9CF4, 0x9CF5, 0x9CF6, 0xD6CD, 0xE4D9,
+	0xE4DC, 0xC2FA, 0xE4DE, 0x9CF7, 0xC2CB, 0xC0C4, 0xC2D0, 0x9CF8, 0xB1F5, 0xCCB2, 0x9CF9, 0x9CFA, 0x9CFB, 0x9CFC, 0x9CFD, 0x9CFE,
+	0x9D40, 0x9D41, 0x9D42, 0x9D43, 0xB5CE, 0x9D44, 0x9D45, 0x9D46, 0x9D47, 0xE4EF, 0x9D48, 0x9D49, 0x9D4A, 0x9D4B, 0x9D4C, 0x9D4D,
+	0x9D4E, 0x9D4F, 0xC6AF, 0x9D50, 0x9D51, 0x9D52, 0xC6E1, 0x9D53, 0x9D54, 0xE4F5, 0x9D55, 0x9D56, 0x9D57, 0x9D58, 0x9D59, 0xC2A9,
+	0x9D5A, 0x9D5B, 0x9D5C, 0xC0EC, 0xD1DD, 0xE4EE, 0x9D5D, 0x9D5E, 0x9D5F, 0x9D60, 0x9D61, 0x9D62, 0x9D63, 0x9D64, 0x9D65, 0x9D66,
+	0xC4AE, 0x9D67, 0x9D68, 0x9D69, 0xE4ED, 0x9D6A, 0x9D6B, 0x9D6C, 0x9D6D, 0xE4F6, 0xE4F4, 0xC2FE, 0x9D6E, 0xE4DD, 0x9D6F, 0xE4F0,
+	0x9D70, 0xCAFE, 0x9D71, 0xD5C4, 0x9D72, 0x9D73, 0xE4F1, 0x9D74, 0x9D75, 0x9D76, 0x9D77, 0x9D78, 0x9D79, 0x9D7A, 0xD1FA, 0x9D7B,
+	0x9D7C, 0x9D7D, 0x9D7E, 0x9D80, 0x9D81, 0x9D82, 0xE4EB, 0xE4EC, 0x9D83, 0x9D84, 0x9D85, 0xE4F2, 0x9D86, 0xCEAB, 0x9D87, 0x9D88,
+	0x9D89, 0x9D8A, 0x9D8B, 0x9D8C, 0x9D8D, 0x9D8E, 0x9D8F, 0x9D90, 0xC5CB, 0x9D91, 0x9D92, 0x9D93, 0xC7B1, 0x9D94, 0xC2BA, 0x9D95,
+	0x9D96, 0x9D97, 0xE4EA, 0x9D98, 0x9D99, 0x9D9A, 0xC1CA, 0x9D9B, 0x9D9C, 0x9D9D, 0x9D9E, 0x9D9F, 0x9DA0, 0xCCB6, 0xB3B1, 0x9DA1,
+	0x9DA2, 0x9DA3, 0xE4FB, 0x9DA4, 0xE4F3, 0x9DA5, 0x9DA6, 0x9DA7, 0xE4FA, 0x9DA8, 0xE4FD, 0x9DA9, 0xE4FC, 0x9DAA, 0x9DAB, 0x9DAC,
+	0x9DAD, 0x9DAE, 0x9DAF, 0x9DB0, 0xB3CE, 0x9DB1, 0x9DB2, 0x9DB3, 0xB3BA, 0xE4F7, 0x9DB4, 0x9DB5, 0xE4F9, 0xE4F8, 0xC5EC, 0x9DB6,
+	0x9DB7, 0x9DB8, 0x9DB9, 0x9DBA, 0x9DBB, 0x9DBC, 0x9DBD, 0x9DBE, 0x9DBF, 0x9DC0, 0x9DC1, 0x9DC2, 0xC0BD, 0x9DC3, 0x9DC4, 0x9DC5,
+	0x9DC6, 0xD4E8, 0x9DC7, 0x9DC8, 0x9DC9, 0x9DCA, 0x9DCB, 0xE5A2, 0x9DCC, 0x9DCD, 0x9DCE, 0x9DCF, 0x9DD0, 0x9DD1, 0x9DD2, 0x9DD3,
+	0x9DD4, 0x9DD5, 0x9DD6, 0xB0C4, 0x9DD7, 0x9DD8, 0xE5A4, 0x9DD9, 0x9DDA, 0xE5A3, 0x9DDB, 0x9DDC, 0x9DDD, 0x9DDE, 0x9DDF, 0x9DE0,
+	0xBCA4, 0x9DE1, 0xE5A5, 0x9DE2, 0x9DE3, 0x9DE4, 0x9DE5, 0x9DE6, 0x9DE7, 0xE5A1, 0x9DE8, 0x9DE9, 0x9DEA, 0x9DEB, 0x9DEC, 0x9DED,
+	0x9DEE, 0xE4FE, 0xB1F4, 0x9DEF, 0x9DF0, 0x9DF1, 0x9DF2, 0x9DF3, 0x9DF4, 0x9DF5, 0x9DF6, 0x9DF7, 0x9DF8, 0x9DF9, 0xE5A8, 0x9DFA,
+	0xE5A9, 0xE5A6, 0x9DFB, 0x9DFC, 0x9DFD, 0x9DFE, 0x9E40, 0x9E41, 0x9E42, 0x9E43, 0x9E44, 0x9E45, 0x9E46, 0x9E47, 0xE5A7, 0xE5AA,
+	0x9E48, 0x9E49, 0x9E4A, 0x9E4B, 0x9E4C, 0x9E4D, 0x9E4E, 0x9E4F, 0x9E50, 0x9E51, 0x9E52, 0x9E53, 0x9E54, 0x9E55, 0x9E56, 0x9E57,
+	0x9E58, 0x9E59, 0x9E5A, 0x9E5B, 0x9E5C, 0x9E5D, 0x9E5E, 0x9E5F, 0x9E60, 0x9E61, 0x9E62, 0x9E63, 0x9E64, 0x9E65, 0x9E66, 0x9E67,
+	0x9E68, 0xC6D9, 0x9E69, 0x9E6A, 0x9E6B, 0x9E6C, 0x9E6D, 0x9E6E, 0x9E6F, 0x9E70, 0xE5AB, 0xE5AD, 0x9E71, 0x9E72, 0x9E73, 0x9E74,
+	0x9E75, 0x9E76, 0x9E77, 0xE5AC, 0x9E78, 0x9E79, 0x9E7A, 0x9E7B, 0x9E7C, 0x9E7D, 0x9E7E, 0x9E80, 0x9E81, 0x9E82, 0x9E83, 0x9E84,
+	0x9E85, 0x9E86, 0x9E87, 0x9E88, 0x9E89, 0xE5AF, 0x9E8A, 0x9E8B, 0x9E8C, 0xE5AE, 0x9E8D, 0x9E8E, 0x9E8F, 0x9E90, 0x9E91, 0x9E92,
+	0x9E93, 0x9E94, 0x9E95, 0x9E96, 0x9E97, 0x9E98, 0x9E99, 0x9E9A, 0x9E9B, 0x9E9C, 0x9E9D, 0x9E9E, 0xB9E0, 0x9E9F, 0x9EA0, 0xE5B0,
+	0x9EA1, 0x9EA2, 0x9EA3, 0x9EA4, 0x9EA5, 0x9EA6, 0x9EA7, 0x9EA8, 0x9EA9, 0x9EAA, 0x9EAB, 0x9EAC, 0x9EAD, 0x9EAE, 0xE5B1, 0x9EAF,
+	0x9EB0, 0x9EB1, 0x9EB2, 0x9EB3, 0x9EB4, 0x9EB5, 0x9EB6, 0x9EB7, 0x9EB8, 0x9EB9, 0x9EBA, 0xBBF0, 0xECE1, 0xC3F0, 0x9EBB, 0xB5C6,
+	0xBBD2, 0x9EBC, 0x9EBD, 0x9EBE, 0x9EBF, 0xC1E9, 0xD4EE, 0x9EC0, 0xBEC4, 0x9EC1, 0x9EC2, 0x9EC3, 0xD7C6, 0x9EC4, 0xD4D6, 0xB2D3,
+	0xECBE, 0x9EC5, 0x9EC6, 0x9EC7, 0x9EC8, 0xEAC1, 0x9EC9, 0x9ECA, 0x9ECB, 0xC2AF, 0xB4B6, 0x9ECC, 0x9ECD, 0x9ECE, 0xD1D7, 0x9ECF,
+	0x9ED0, 0x9ED1, 0xB3B4, 0x9ED2, 0xC8B2, 0xBFBB, 0xECC0, 0x9ED3, 0x9ED4, 0xD6CB, 0x9ED5, 0x9ED6, 0xECBF, 0xECC1, 0x9ED7, 0x9ED8,
+	0x9ED9, 0x9EDA, 0x9EDB, 0x9EDC, 0x9EDD, 0x9EDE, 0x9EDF, 0x9EE0, 0x9EE1, 0x9EE2, 0x9EE3, 0xECC5, 0xBEE6, 0xCCBF, 0xC5DA, 0xBEBC,
+	0x9EE4, 0xECC6, 0x9EE5, 0xB1FE, 0x9EE6, 0x9EE7, 0x9EE8, 0xECC4, 0xD5A8, 0xB5E3, 0x9EE9, 0xECC2, 0xC1B6, 0xB3E3, 0x9EEA, 0x9EEB,
+	0xECC3, 0xCBB8, 0xC0C3, 0xCCFE, 0x9EEC, 0x9EED, 0x9EEE, 0x9EEF, 0xC1D2, 0x9EF0, 0xECC8, 0x9EF1, 0x9EF2, 0x9EF3, 0x9EF4, 0x9EF5,
+	0x9EF6, 0x9EF7, 0x9EF8, 0x9EF9, 0x9EFA, 0x9EFB, 0x9EFC, 0x9EFD, 0xBAE6, 0xC0D3, 0x9EFE, 0xD6F2, 0x9F40, 0x9F41, 0x9F42, 0xD1CC,
+	0x9F43, 0x9F44, 0x9F45, 0x9F46, 0xBFBE, 0x9F47, 0xB7B3, 0xC9D5, 0xECC7, 0xBBE2, 0x9F48, 0xCCCC, 0xBDFD, 0xC8C8, 0x9F49, 0xCFA9,
+	0x9F4A, 0x9F4B, 0x9F4C, 0x9F4D, 0x9F4E, 0x9F4F, 0x9F50, 0xCDE9, 0x9F51, 0xC5EB, 0x9F52, 0x9F53, 0x9F54, 0xB7E9, 0x9F55, 0x9F56,
+	0x9F57, 0x9F58, 0x9F59, 0x9F5A, 0x9F5B, 0x9F5C, 0x9F5D, 0x9F5E, 0x9F5F, 0xD1C9, 0xBAB8, 0x9F60, 0x9F61, 0x9F62, 0x9F63, 0x9F64,
+	0xECC9, 0x9F65, 0x9F66, 0xECCA, 0x9F67, 0xBBC0, 0xECCB, 0x9F68, 0xECE2, 0xB1BA, 0xB7D9, 0x9F69, 0x9F6A, 0x9F6B, 0x9F6C, 0x9F6D,
+	0x9F6E, 0x9F6F, 0x9F70, 0x9F71, 0x9F72, 0x9F73, 0xBDB9, 0x9F74, 0x9F75, 0x9F76, 0x9F77, 0x9F78, 0x9F79, 0x9F7A, 0x9F7B, 0xECCC,
+	0xD1E6, 0xECCD, 0x9F7C, 0x9F7D, 0x9F7E, 0x9F80, 0xC8BB, 0x9F81, 0x9F82, 0x9F83, 0x9F84, 0x9F85, 0x9F86, 0x9F87, 0x9F88, 0x9F89,
+	0x9F8A, 0x9F8B, 0x9F8C, 0x9F8D, 0x9F8E, 0xECD1, 0x9F8F, 0x9F90, 0x9F91, 0x9F92, 0xECD3, 0x9F93, 0xBBCD, 0x9F94, 0xBCE5, 0x9F95,
+	0x9F96, 0x9F97, 0x9F98, 0x9F99, 0x9F9A, 0x9F9B, 0x9F9C, 0x9F9D, 0x9F9E, 0x9F9F, 0x9FA0, 0x9FA1, 0xECCF, 0x9FA2, 0xC9B7, 0x9FA3,
+	0x9FA4, 0x9FA5, 0x9FA6, 0x9FA7, 0xC3BA, 0x9FA8, 0xECE3, 0xD5D5, 0xECD0, 0x9FA9, 0x9FAA, 0x9FAB, 0x9FAC, 0x9FAD, 0xD6F3, 0x9FAE,
+	0x9FAF, 0x9FB0, 0xECD2, 0xECCE, 0x9FB1, 0x9FB2, 0x9FB3, 0x9FB4, 0xECD4, 0x9FB5, 0xECD5, 0x9FB6, 0x9FB7, 0xC9BF, 0x9FB8, 0x9FB9,
+	0x9FBA, 0x9FBB, 0x9FBC, 0x9FBD, 0xCFA8, 0x9FBE, 0x9FBF, 0x9FC0, 0x9FC1, 0x9FC2, 0xD0DC, 0x9FC3, 0x9FC4, 0x9FC5, 0x9FC6, 0xD1AC,
+	0x9FC7, 0x9FC8, 0x9FC9, 0x9FCA, 0xC8DB, 0x9FCB, 0x9FCC, 0x9FCD, 0xECD6, 0xCEF5, 0x9FCE, 0x9FCF, 0x9FD0, 0x9FD1, 0x9FD2, 0xCAEC,
+	0xECDA, 0x9FD3, 0x9FD4, 0x9FD5, 0x9FD6, 0x9FD7, 0x9FD8, 0x9FD9, 0xECD9, 0x9FDA, 0x9FDB, 0x9FDC, 0xB0BE, 0x9FDD, 0x9FDE, 0x9FDF,
+	0x9FE0, 0x9FE1, 0x9FE2, 0xECD7, 0x9FE3, 0xECD8, 0x9FE4, 0x9FE5, 0x9FE6, 0xECE4, 0x9FE7, 0x9FE8, 0x9FE9, 0x9FEA, 0x9FEB, 0x9FEC,
+	0x9FED, 0x9FEE, 0x9FEF, 0xC8BC, 0x9FF0, 0x9FF1, 0x9FF2, 0x9FF3, 0x9FF4, 0x9FF5, 0x9FF6, 0x9FF7, 0x9FF8, 0x9FF9, 0xC1C7, 0x9FFA,
+	0x9FFB, 0x9FFC, 0x9FFD, 0x9FFE, 0xECDC, 0xD1E0, 0xA040, 0xA041, 0xA042, 0xA043, 0xA044, 0xA045, 0xA046, 0xA047, 0xA048, 0xA049,
+	0xECDB, 0xA04A, 0xA04B, 0xA04C, 0xA04D, 0xD4EF, 0xA04E, 0xECDD, 0xA04F, 0xA050, 0xA051, 0xA052, 0xA053, 0xA054, 0xDBC6, 0xA055,
+	0xA056, 0xA057, 0xA058, 0xA059, 0xA05A, 0xA05B, 0xA05C, 0xA05D, 0xA05E, 0xECDE, 0xA05F, 0xA060, 0xA061, 0xA062, 0xA063, 0xA064,
+	0xA065, 0xA066, 0xA067, 0xA068, 0xA069, 0xA06A, 0xB1AC, 0xA06B, 0xA06C, 0xA06D, 0xA06E, 0xA06F, 0xA070, 0xA071, 0xA072, 0xA073,
+	0xA074, 0xA075, 0xA076, 0xA077, 0xA078, 0xA079, 0xA07A, 0xA07B, 0xA07C, 0xA07D, 0xA07E, 0xA080, 0xA081, 0xECDF, 0xA082, 0xA083,
+	0xA084, 0xA085, 0xA086, 0xA087, 0xA088, 0xA089, 0xA08A, 0xA08B, 0xECE0, 0xA08C, 0xD7A6, 0xA08D, 0xC5C0, 0xA08E, 0xA08F, 0xA090,
+	0xEBBC, 0xB0AE, 0xA091, 0xA092, 0xA093, 0xBEF4, 0xB8B8, 0xD2AF, 0xB0D6, 0xB5F9, 0xA094, 0xD8B3, 0xA095, 0xCBAC, 0xA096, 0xE3DD,
+	0xA097, 0xA098, 0xA099, 0xA09A, 0xA09B, 0xA09C, 0xA09D, 0xC6AC, 0xB0E6, 0xA09E, 0xA09F, 0xA0A0, 0xC5C6, 0xEBB9, 0xA0A1, 0xA0A2,
+	0xA0A3, 0xA0A4, 0xEBBA, 0xA0A5, 0xA0A6, 0xA0A7, 0xEBBB, 0xA0A8, 0xA0A9, 0xD1C0, 0xA0AA, 0xC5A3, 0xA0AB, 0xEAF2, 0xA0AC, 0xC4B2,
+	0xA0AD, 0xC4B5, 0xC0CE, 0xA0AE, 0xA0AF, 0xA0B0, 0xEAF3, 0xC4C1, 0xA0B1, 0xCEEF, 0xA0B2, 0xA0B3, 0xA0B4, 0xA0B5, 0xEAF0, 0xEAF4,
+	0xA0B6, 0xA0B7, 0xC9FC, 0xA0B8, 0xA0B9, 0xC7A3, 0xA0BA, 0xA0BB, 0xA0BC, 0xCCD8, 0xCEFE, 0xA0BD, 0xA0BE, 0xA0BF, 0xEAF5, 0xEAF6,
+	0xCFAC, 0xC0E7, 0xA0C0, 0xA0C1, 0xEAF7, 0xA0C2, 0xA0C3, 0xA0C4, 0xA0C5, 0xA0C6, 0xB6BF, 0xEAF8, 0xA0C7, 0xEAF9, 0xA0C8, 0xEAFA,
+	0xA0C9, 0xA0CA, 0xEAFB, 0xA0CB, 0xA0CC, 0xA0CD, 0xA0CE, 0xA0CF, 0xA0D0, 0xA0D1, 0xA0D2, 0xA0D3, 0xA0D4, 0xA0D5, 0xA0D6, 0xEAF1,
+	0xA0D7, 0xA0D8, 0xA0D9, 0xA0DA, 0xA0DB, 0xA0DC, 0xA0DD, 0xA0DE, 0xA0DF, 0xA0E0, 0xA0E1, 0xA0E2, 0xC8AE, 0xE1EB, 0xA0E3, 0xB7B8,
+	0xE1EC, 0xA0E4, 0xA0E5, 0xA0E6, 0xE1ED, 0xA0E7, 0xD7B4, 0xE1EE, 0xE1EF, 0xD3CC, 0xA0E8, 0xA0E9, 0xA0EA, 0xA0EB, 0xA0EC, 0xA0ED,
+	0xA0EE, 0xE1F1, 0xBFF1, 0xE1F0, 0xB5D2, 0xA0EF, 0xA0F0, 0xA0F1, 0xB1B7, 0xA0F2, 0xA0F3, 0xA0F4, 0xA0F5, 0xE1F3, 0xE1F2, 0xA0F6,
+	0xBAFC, 0xA0F7, 0xE1F4, 0xA0F8, 0xA0F9, 0xA0FA, 0xA0FB, 0xB9B7, 0xA0FC, 0xBED1, 0xA0FD, 0xA0FE, 0xAA40, 0xAA41, 0xC4FC, 0xAA42,
+	0xBADD, 0xBDC6, 0xAA43, 0xAA44, 0xAA45, 0xAA46, 0xAA47, 0xAA48, 0xE1F5, 0xE1F7, 0xAA49, 0xAA4A, 0xB6C0, 0xCFC1, 0xCAA8, 0xE1F6,
+	0xD5F8, 0xD3FC, 0xE1F8, 0xE1FC, 0xE1F9, 0xAA4B, 0xAA4C, 0xE1FA, 0xC0EA, 0xAA4D, 0xE1FE, 0xE2A1, 0xC0C7, 0xAA4E, 0xAA4F, 0xAA50,
+	0xAA51, 0xE1FB, 0xAA52, 0xE1FD, 0xAA53, 0xAA54, 0xAA55, 0xAA56, 0xAA57, 0xAA58, 0xE2A5, 0xAA59, 0xAA5A, 0xAA5B, 0xC1D4, 0xAA5C,
+	0xAA5D, 0xAA5E, 0xAA5F, 0xE2A3, 0xAA60, 0xE2A8, 0xB2FE, 0xE2A2, 0xAA61, 0xAA62, 0xAA63, 0xC3CD, 0xB2C2, 0xE2A7, 0xE2A6, 0xAA64,
+	0xAA65, 0xE2A4, 0xE2A9, 0xAA66, 0xAA67, 0xE2AB, 0xAA68, 0xAA69, 0xAA6A, 0xD0C9, 0xD6ED, 0xC3A8, 0xE2AC, 0xAA6B, 0xCFD7, 0xAA6C,
+	0xAA6D, 0xE2AE, 0xAA6E, 0xAA6F, 0xBAEF, 0xAA70, 0xAA71, 0xE9E0, 0xE2AD, 0xE2AA, 0xAA72, 0xAA73, 0xAA74, 0xAA75, 0xBBAB, 0xD4B3,
+	0xAA76, 0xAA77, 0xAA78, 0xAA79, 0xAA7A, 0xAA7B, 0xAA7C, 0xAA7D, 0xAA7E, 0xAA80, 0xAA81, 0xAA82, 0xAA83, 0xE2B0, 0xAA84, 0xAA85,
+	0xE2AF, 0xAA86, 0xE9E1, 0xAA87, 0xAA88, 0xAA89, 0xAA8A, 0xE2B1, 0xAA8B, 0xAA8C, 0xAA8D, 0xAA8E, 0xAA8F, 0xAA90, 0xAA91, 0xAA92,
+	0xE2B2, 0xAA93, 0xAA94, 0xAA95, 0xAA96, 0xAA97, 0xAA98, 0xAA99, 0xAA9A, 0xAA9B, 0xAA9C, 0xAA9D, 0xE2B3, 0xCCA1, 0xAA9E, 0xE2B4,
+	0xAA9F, 0xAAA0, 0xAB40, 0xAB41, 0xAB42, 0xAB43, 0xAB44, 0xAB45, 0xAB46, 0xAB47, 0xAB48, 0xAB49, 0xAB4A, 0xAB4B, 0xE2B5, 0xAB4C,
+	0xAB4D, 0xAB4E, 0xAB4F, 0xAB50, 0xD0FE, 0xAB51, 0xAB52, 0xC2CA, 0xAB53, 0xD3F1, 0xAB54, 0xCDF5, 0xAB55, 0xAB56, 0xE7E0, 0xAB57,
+	0xAB58, 0xE7E1, 0xAB59, 0xAB5A, 0xAB5B, 0xAB5C, 0xBEC1, 0xAB5D, 0xAB5E, 0xAB5F, 0xAB60, 0xC2EA, 0xAB61, 0xAB62, 0xAB63, 0xE7E4,
+	0xAB64, 0xAB65, 0xE7E3, 0xAB66, 0xAB67, 0xAB68, 0xAB69, 0xAB6A, 0xAB6B, 0xCDE6, 0xAB6C, 0xC3B5, 0xAB6D, 0xAB6E, 0xE7E2, 0xBBB7,
+	0xCFD6, 0xAB6F, 0xC1E1, 0xE7E9, 0xAB70, 0xAB71, 0xAB72, 0xE7E8, 0xAB73, 0xAB74, 0xE7F4, 0xB2A3, 0xAB75, 0xAB76, 0xAB77, 0xAB78,
+	0xE7EA, 0xAB79, 0xE7E6, 0xAB7A, 0xAB7B, 0xAB7C, 0xAB7D, 0xAB7E, 0xE7EC, 0xE7EB, 0xC9BA, 0xAB80, 0xAB81, 0xD5E4, 0xAB82, 0xE7E5,
+	0xB7A9, 0xE7E7, 0xAB83, 0xAB84, 0xAB85, 0xAB86, 0xAB87, 0xAB88, 0xAB89, 0xE7EE, 0xAB8A, 0xAB8B, 0xAB8C, 0xAB8D, 0xE7F3, 0xAB8E,
+	0xD6E9, 0xAB8F, 0xAB90, 0xAB91, 0xAB92, 0xE7ED, 0xAB93, 0xE7F2, 0xAB94, 0xE7F1, 0xAB95, 0xAB96, 0xAB97, 0xB0E0, 0xAB98, 0xAB99,
+	0xAB9A, 0xAB9B, 0xE7F5, 0xAB9C, 0xAB9D, 0xAB9E, 0xAB9F, 0xABA0, 0xAC40, 0xAC41, 0xAC42, 0xAC43, 0xAC44, 0xAC45, 0xAC46, 0xAC47,
+	0xAC48, 0xAC49, 0xAC4A, 0xC7F2, 0xAC4B, 0xC0C5, 0xC0ED, 0xAC4C, 0xAC4D, 0xC1F0, 0xE7F0, 0xAC4E, 0xAC4F, 0xAC50, 0xAC51, 0xE7F6,
+	0xCBF6, 0xAC52, 0xAC53, 0xAC54, 0xAC55, 0xAC56, 0xAC57, 0xAC58, 0xAC59, 0xAC5A, 0xE8A2, 0xE8A1, 0xAC5B, 0xAC5C, 0xAC5D, 0xAC5E,
+	0xAC5F, 0xAC60, 0xD7C1, 0xAC61, 0xAC62, 0xE7FA, 0xE7F9, 0xAC63, 0xE7FB, 0xAC64, 0xE7F7, 0xAC65, 0xE7FE, 0xAC66, 0xE7FD, 0xAC67,
+	0xE7FC, 0xAC68, 0xAC69, 0xC1D5, 0xC7D9, 0xC5FD, 0xC5C3, 0xAC6A, 0xAC6B, 0xAC6C, 0xAC6D, 0xAC6E, 0xC7ED, 0xAC6F, 0xAC70, 0xAC71,
+	0xAC72, 0xE8A3, 0xAC73, 0xAC74, 0xAC75, 0xAC76, 0xAC77, 0xAC78, 0xAC79, 0xAC7A, 0xAC7B, 0xAC7C, 0xAC7D, 0xAC7E, 0xAC80, 0xAC81,
+	0xAC82, 0xAC83, 0xAC84, 0xAC85, 0xAC86, 0xE8A6, 0xAC87, 0xE8A5, 0xAC88, 0xE8A7, 0xBAF7, 0xE7F8, 0xE8A4, 0xAC89, 0xC8F0, 0xC9AA,
+	0xAC8A, 0xAC8B, 0xAC8C, 0xAC8D, 0xAC8E, 0xAC8F, 0xAC90, 0xAC91, 0xAC92, 0xAC93, 0xAC94, 0xAC95, 0xAC96, 0xE8A9, 0xAC97, 0xAC98,
+	0xB9E5, 0xAC99, 0xAC9A, 0xAC9B, 0xAC9C, 0xAC9D, 0xD1FE, 0xE8A8, 0xAC9E, 0xAC9F, 0xACA0, 0xAD40, 0xAD41, 0xAD42, 0xE8AA, 0xAD43,
+	0xE8AD, 0xE8AE, 0xAD44, 0xC1A7, 0xAD45, 0xAD46, 0xAD47, 0xE8AF, 0xAD48, 0xAD49, 0xAD4A, 0xE8B0, 0xAD4B, 0xAD4C, 0xE8AC, 0xAD4D,
+	0xE8B4, 0xAD4E, 0xAD4F, 0xAD50, 0xAD51, 0xAD52, 0xAD53, 0xAD54, 0xAD55, 0xAD56, 0xAD57, 0xAD58, 0xE8AB, 0xAD59, 0xE8B1, 0xAD5A,
+	0xAD5B, 0xAD5C, 0xAD5D, 0xAD5E, 0xAD5F, 0xAD60, 0xAD61, 0xE8B5, 0xE8B2, 0xE8B3, 0xAD62, 0xAD63, 0xAD64, 0xAD65, 0xAD66, 0xAD67,
+	0xAD68, 0xAD69, 0xAD6A, 0xAD6B, 0xAD6C, 0xAD6D, 0xAD6E, 0xAD6F, 0xAD70, 0xAD71, 0xE8B7, 0xAD72, 0xAD73, 0xAD74, 0xAD75, 0xAD76,
+	0xAD77, 0xAD78, 0xAD79, 0xAD7A, 0xAD7B, 0xAD7C, 0xAD7D, 0xAD7E, 0xAD80, 0xAD81, 0xAD82, 0xAD83, 0xAD84, 0xAD85, 0xAD86, 0xAD87,
+	0xAD88, 0xAD89, 0xE8B6, 0xAD8A, 0xAD8B, 0xAD8C, 0xAD8D, 0xAD8E, 0xAD8F, 0xAD90, 0xAD91, 0xAD92, 0xB9CF, 0xAD93, 0xF0AC, 0xAD94,
+	0xF0AD, 0xAD95, 0xC6B0, 0xB0EA, 0xC8BF, 0xAD96, 0xCDDF, 0xAD97, 0xAD98, 0xAD99, 0xAD9A, 0xAD9B, 0xAD9C, 0xAD9D, 0xCECD, 0xEAB1,
+	0xAD9E, 0xAD9F, 0xADA0, 0xAE40, 0xEAB2, 0xAE41, 0xC6BF, 0xB4C9, 0xAE42, 0xAE43, 0xAE44, 0xAE45, 0xAE46, 0xAE47, 0xAE48, 0xEAB3,
+	0xAE49, 0xAE4A, 0xAE4B, 0xAE4C, 0xD5E7, 0xAE4D, 0xAE4E, 0xAE4F, 0xAE50, 0xAE51, 0xAE52, 0xAE53, 0xAE54, 0xDDF9, 0xAE55, 0xEAB4,
+	0xAE56, 0xEAB5, 0xAE57, 0xEAB6, 0xAE58, 0xAE59, 0xAE5A, 0xAE5B, 0xB8CA, 0xDFB0, 0xC9F5, 0xAE5C, 0xCCF0, 0xAE5D, 0xAE5E, 0xC9FA,
+	0xAE5F, 0xAE60, 0xAE61, 0xAE62, 0xAE63, 0xC9FB, 0xAE64, 0xAE65, 0xD3C3, 0xCBA6, 0xAE66, 0xB8A6, 0xF0AE, 0xB1C2, 0xAE67, 0xE5B8,
+	0xCCEF, 0xD3C9, 0xBCD7, 0xC9EA, 0xAE68, 0xB5E7, 0xAE69, 0xC4D0, 0xB5E9, 0xAE6A, 0xEEAE, 0xBBAD, 0xAE6B, 0xAE6C, 0xE7DE, 0xAE6D,
+	0xEEAF, 0xAE6E, 0xAE6F, 0xAE70, 0xAE71, 0xB3A9, 0xAE72, 0xAE73, 0xEEB2, 0xAE74, 0xAE75, 0xEEB1, 0xBDE7, 0xAE76, 0xEEB0, 0xCEB7,
+	0xAE77, 0xAE78, 0xAE79, 0xAE7A, 0xC5CF, 0xAE7B, 0xAE7C, 0xAE7D, 0xAE7E, 0xC1F4, 0xDBCE, 0xEEB3, 0xD0F3, 0xAE80, 0xAE81, 0xAE82,
+	0xAE83, 0xAE84, 0xAE85, 0xAE86, 0xAE87, 0xC2D4, 0xC6E8, 0xAE88, 0xAE89, 0xAE8A, 0xB7AC, 0xAE8B, 0xAE8C, 0xAE8D, 0xAE8E, 0xAE8F,
+	0xAE90, 0xAE91, 0xEEB4, 0xAE92, 0xB3EB, 0xAE93, 0xAE94, 0xAE95, 0xBBFB, 0xEEB5, 0xAE96, 0xAE97, 0xAE98, 0xAE99, 0xAE9A, 0xE7DC,
+	0xAE9B, 0xAE9C, 0xAE9D, 0xEEB6, 0xAE9E, 0xAE9F, 0xBDAE, 0xAEA0, 0xAF40, 0xAF41, 0xAF42, 0xF1E2, 0xAF43, 0xAF44, 0xAF45, 0xCAE8,
+	0xAF46, 0xD2C9, 0xF0DA, 0xAF47, 0xF0DB, 0xAF48, 0xF0DC, 0xC1C6, 0xAF49, 0xB8ED, 0xBECE, 0xAF4A, 0xAF4B, 0xF0DE, 0xAF4C, 0xC5B1,
+	0xF0DD, 0xD1F1, 0xAF4D, 0xF0E0, 0xB0CC, 0xBDEA, 0xAF4E, 0xAF4F, 0xAF50, 0xAF51, 0xAF52, 0xD2DF, 0xF0DF, 0xAF53, 0xB4AF, 0xB7E8,
+	0xF0E6, 0xF0E5, 0xC6A3, 0xF0E1, 0xF0E2, 0xB4C3, 0xAF54, 0xAF55, 0xF0E3, 0xD5EE, 0xAF56, 0xAF57, 0xCCDB, 0xBED2, 0xBCB2, 0xAF58,
+	0xAF59, 0xAF5A, 0xF0E8, 0xF0E7, 0xF0E4, 0xB2A1, 0xAF5B, 0xD6A2, 0xD3B8, 0xBEB7, 0xC8AC, 0xAF5C, 0xAF5D, 0xF0EA, 0xAF5E, 0xAF5F,
+	0xAF60, 0xAF61, 0xD1F7, 0xAF62, 0xD6CC, 0xBADB, 0xF0E9, 0xAF63, 0xB6BB, 0xAF64, 0xAF65, 0xCDB4, 0xAF66, 0xAF67, 0xC6A6, 0xAF68,
+	0xAF69, 0xAF6A, 0xC1A1, 0xF0EB, 0xF0EE, 0xAF6B, 0xF0ED, 0xF0F0, 0xF0EC, 0xAF6C, 0xBBBE, 0xF0EF, 0xAF6D, 0xAF6E, 0xAF6F, 0xAF70,
+	0xCCB5, 0xF0F2, 0xAF71, 0xAF72, 0xB3D5, 0xAF73, 0xAF74, 0xAF75, 0xAF76, 0xB1D4, 0xAF77, 0xAF78, 0xF0F3, 0xAF79, 0xAF7A, 0xF0F4,
+	0xF0F6, 0xB4E1, 0xAF7B, 0xF0F1, 0xAF7C, 0xF0F7, 0xAF7D, 0xAF7E, 0xAF80, 0xAF81, 0xF0FA, 0xAF82, 0xF0F8, 0xAF83, 0xAF84, 0xAF85,
+	0xF0F5, 0xAF86, 0xAF87, 0xAF88, 0xAF89, 0xF0FD, 0xAF8A, 0xF0F9, 0xF0FC, 0xF0FE, 0xAF8B, 0xF1A1, 0xAF8C, 0xAF8D, 0xAF8E, 0xCEC1,
+	0xF1A4, 0xAF8F, 0xF1A3, 0xAF90, 0xC1F6, 0xF0FB, 0xCADD, 0xAF91, 0xAF92, 0xB4F1, 0xB1F1, 0xCCB1, 0xAF93, 0xF1A6, 0xAF94, 0xAF95,
+	0xF1A7, 0xAF96, 0xAF97, 0xF1AC, 0xD5CE, 0xF1A9, 0xAF98, 0xAF99, 0xC8B3, 0xAF9A, 0xAF9B, 0xAF9C, 0xF1A2, 0xAF9D, 0xF1AB, 0xF1A8,
+	0xF1A5, 0xAF9E, 0xAF9F, 0xF1AA, 0xAFA0, 0xB040, 0xB041, 0xB042, 0xB043, 0xB044, 0xB045, 0xB046, 0xB0A9, 0xF1AD, 0xB047, 0xB048,
+	0xB049, 0xB04A, 0xB04B, 0xB04C, 0xF1AF, 0xB04D, 0xF1B1, 0xB04E, 0xB04F, 0xB050, 0xB051, 0xB052, 0xF1B0, 0xB053, 0xF1AE, 0xB054,
+	0xB055, 0xB056, 0xB057, 0xD1A2, 0xB058, 0xB059, 0xB05A, 0xB05B, 0xB05C, 0xB05D, 0xB05E, 0xF1B2, 0xB05F, 0xB060, 0xB061, 0xF1B3,
+	0xB062, 0xB063, 0xB064, 0xB065, 0xB066, 0xB067, 0xB068, 0xB069, 0xB9EF, 0xB06A, 0xB06B, 0xB5C7, 0xB06C, 0xB0D7, 0xB0D9, 0xB06D,
+	0xB06E, 0xB06F, 0xD4ED, 0xB070, 0xB5C4, 0xB071, 0xBDD4, 0xBBCA, 0xF0A7, 0xB072, 0xB073, 0xB8DE, 0xB074, 0xB075, 0xF0A8, 0xB076,
+	0xB077, 0xB0A8, 0xB078, 0xF0A9, 0xB079, 0xB07A, 0xCDEE, 0xB07B, 0xB07C, 0xF0AA, 0xB07D, 0xB07E, 0xB080, 0xB081, 0xB082, 0xB083,
+	0xB084, 0xB085, 0xB086, 0xB087, 0xF0AB, 0xB088, 0xB089, 0xB08A, 0xB08B, 0xB08C, 0xB08D, 0xB08E, 0xB08F, 0xB090, 0xC6A4, 0xB091,
+	0xB092, 0xD6E5, 0xF1E4, 0xB093, 0xF1E5, 0xB094, 0xB095, 0xB096, 0xB097, 0xB098, 0xB099, 0xB09A, 0xB09B, 0xB09C, 0xB09D, 0xC3F3,
+	0xB09E, 0xB09F, 0xD3DB, 0xB0A0, 0xB140, 0xD6D1, 0xC5E8, 0xB141, 0xD3AF, 0xB142, 0xD2E6, 0xB143, 0xB144, 0xEEC1, 0xB0BB, 0xD5B5,
+	0xD1CE, 0xBCE0, 0xBAD0, 0xB145, 0xBFF8, 0xB146, 0xB8C7, 0xB5C1, 0xC5CC, 0xB147, 0xB148, 0xCAA2, 0xB149, 0xB14A, 0xB14B, 0xC3CB,
+	0xB14C, 0xB14D, 0xB14E, 0xB14F, 0xB150, 0xEEC2, 0xB151, 0xB152, 0xB153, 0xB154, 0xB155, 0xB156, 0xB157, 0xB158, 0xC4BF, 0xB6A2,
+	0xB159, 0xEDEC, 0xC3A4, 0xB15A, 0xD6B1, 0xB15B, 0xB15C, 0xB15D, 0xCFE0, 0xEDEF, 0xB15E, 0xB15F, 0xC5CE, 0xB160, 0xB6DC, 0xB161,
+	0xB162, 0xCAA1, 0xB163, 0xB164, 0xEDED, 0xB165, 0xB166, 0xEDF0, 0xEDF1, 0xC3BC, 0xB167, 0xBFB4, 0xB168, 0xEDEE, 0xB169, 0xB16A,
+	0xB16B, 0xB16C, 0xB16D, 0xB16E, 0xB16F, 0xB170, 0xB171, 0xB172, 0xB173, 0xEDF4, 0xEDF2, 0xB174, 0xB175, 0xB176, 0xB177, 0xD5E6,
+	0xC3DF, 0xB178, 0xEDF3, 0xB179, 0xB17A, 0xB17B, 0xEDF6, 0xB17C, 0xD5A3, 0xD1A3, 0xB17D, 0xB17E, 0xB180, 0xEDF5, 0xB181, 0xC3D0,
+	0xB182, 0xB183, 0xB184, 0xB185, 0xB186, 0xEDF7, 0xBFF4, 0xBEEC, 0xEDF8, 0xB187, 0xCCF7, 0xB188, 0xD1DB, 0xB189, 0xB18A, 0xB18B,
+	0xD7C5, 0xD5F6, 0xB18C, 0xEDFC, 0xB18D, 0xB18E, 0xB18F, 0xEDFB, 0xB190, 0xB191, 0xB192, 0xB193, 0xB194, 0xB195, 0xB196, 0xB197,
+	0xEDF9, 0xEDFA, 0xB198, 0xB199, 0xB19A, 0xB19B, 0xB19C, 0xB19D, 0xB19E, 0xB19F, 0xEDFD, 0xBEA6, 0xB1A0, 0xB240, 0xB241, 0xB242,
+	0xB243, 0xCBAF, 0xEEA1, 0xB6BD, 0xB244, 0xEEA2, 0xC4C0, 0xB245, 0xEDFE, 0xB246, 0xB247, 0xBDDE, 0xB2C7, 0xB248, 0xB249, 0xB24A,
+	0xB24B, 0xB24C, 0xB24D, 0xB24E, 0xB24F, 0xB250, 0xB251, 0xB252, 0xB253, 0xB6C3, 0xB254, 0xB255, 0xB256, 0xEEA5, 0xD8BA, 0xEEA3,
+	0xEEA6, 0xB257, 0xB258, 0xB259, 0xC3E9, 0xB3F2, 0xB25A, 0xB25B, 0xB25C, 0xB25D, 0xB25E, 0xB25F, 0xEEA7, 0xEEA4, 0xCFB9, 0xB260,
+	0xB261, 0xEEA8, 0xC2F7, 0xB262, 0xB263, 0xB264, 0xB265, 0xB266, 0xB267, 0xB268, 0xB269, 0xB26A, 0xB26B, 0xB26C, 0xB26D, 0xEEA9,
+	0xEEAA, 0xB26E, 0xDEAB, 0xB26F, 0xB270, 0xC6B3, 0xB271, 0xC7C6, 0xB272, 0xD6F5, 0xB5C9, 0xB273, 0xCBB2, 0xB274, 0xB275, 0xB276,
+	0xEEAB, 0xB277, 0xB278, 0xCDAB, 0xB279, 0xEEAC, 0xB27A, 0xB27B, 0xB27C, 0xB27D, 0xB27E, 0xD5B0, 0xB280, 0xEEAD, 0xB281, 0xF6C4,
+	0xB282, 0xB283, 0xB284, 0xB285, 0xB286, 0xB287, 0xB288, 0xB289, 0xB28A, 0xB28B, 0xB28C, 0xB28D, 0xB28E, 0xDBC7, 0xB28F, 0xB290,
+	0xB291, 0xB292, 0xB293, 0xB294, 0xB295, 0xB296, 0xB297, 0xB4A3, 0xB298, 0xB299, 0xB29A, 0xC3AC, 0xF1E6, 0xB29B, 0xB29C, 0xB29D,
+	0xB29E, 0xB29F, 0xCAB8, 0xD2D3, 0xB2A0, 0xD6AA, 0xB340, 0xEFF2, 0xB341, 0xBED8, 0xB342, 0xBDC3, 0xEFF3, 0xB6CC, 0xB0AB, 0xB343,
+	0xB344, 0xB345, 0xB346, 0xCAAF, 0xB347, 0xB348, 0xEDB6, 0xB349, 0xEDB7, 0xB34A, 0xB34B, 0xB34C, 0xB34D, 0xCEF9, 0xB7AF, 0xBFF3,
+	0xEDB8, 0xC2EB, 0xC9B0, 0xB34E, 0xB34F, 0xB350, 0xB351, 0xB352, 0xB353, 0xEDB9, 0xB354, 0xB355, 0xC6F6, 0xBFB3, 0xB356, 0xB357,
+	0xB358, 0xEDBC, 0xC5F8, 0xB359, 0xD1D0, 0xB35A, 0xD7A9, 0xEDBA, 0xEDBB, 0xB35B, 0xD1E2, 0xB35C, 0xEDBF, 0xEDC0, 0xB35D, 0xEDC4,
+	0xB35E, 0xB35F, 0xB360, 0xEDC8, 0xB361, 0xEDC6, 0xEDCE, 0xD5E8, 0xB362, 0xEDC9, 0xB363, 0xB364, 0xEDC7, 0xEDBE, 0xB365, 0xB366,
+	0xC5E9, 0xB367, 0xB368, 0xB369, 0xC6C6, 0xB36A, 0xB36B, 0xC9E9, 0xD4D2, 0xEDC1, 0xEDC2, 0xEDC3, 0xEDC5, 0xB36C, 0xC0F9, 0xB36D,
+	0xB4A1, 0xB36E, 0xB36F, 0xB370, 0xB371, 0xB9E8, 0xB372, 0xEDD0, 0xB373, 0xB374, 0xB375, 0xB376, 0xEDD1, 0xB377, 0xEDCA, 0xB378,
+	0xEDCF, 0xB379, 0xCEF8, 0xB37A, 0xB37B, 0xCBB6, 0xEDCC, 0xEDCD, 0xB37C, 0xB37D, 0xB37E, 0xB380, 0xB381, 0xCFF5, 0xB382, 0xB383,
+	0xB384, 0xB385, 0xB386, 0xB387, 0xB388, 0xB389, 0xB38A, 0xB38B, 0xB38C, 0xB38D, 0xEDD2, 0xC1F2, 0xD3B2, 0xEDCB, 0xC8B7, 0xB38E,
+	0xB38F, 0xB390, 0xB391, 0xB392, 0xB393, 0xB394, 0xB395, 0xBCEF, 0xB396, 0xB397, 0xB398, 0xB399, 0xC5F0, 0xB39A, 0xB39B, 0xB39C,
+	0xB39D, 0xB39E, 0xB39F, 0xB3A0, 0xB440, 0xB441, 0xB442, 0xEDD6, 0xB443, 0xB5EF, 0xB444, 0xB445, 0xC2B5, 0xB0AD, 0xCBE9, 0xB446,
+	0xB447, 0xB1AE, 0xB448, 0xEDD4, 0xB449, 0xB44A, 0xB44B, 0xCDEB, 0xB5E2, 0xB44C, 0xEDD5, 0xEDD3, 0xEDD7, 0xB44D, 0xB44E, 0xB5FA,
+	0xB44F, 0xEDD8, 0xB450, 0xEDD9, 0xB451, 0xEDDC, 0xB452, 0xB1CC, 0xB453, 0xB454, 0xB455, 0xB456, 0xB457, 0xB458, 0xB459, 0xB45A,
+	0xC5F6, 0xBCEE, 0xEDDA, 0xCCBC, 0xB2EA, 0xB45B, 0xB45C, 0xB45D, 0xB45E, 0xEDDB, 0xB45F, 0xB460, 0xB461, 0xB462, 0xC4EB, 0xB463,
+	0xB464, 0xB4C5, 0xB465, 0xB466, 0xB467, 0xB0F5, 0xB468, 0xB469, 0xB46A, 0xEDDF, 0xC0DA, 0xB4E8, 0xB46B, 0xB46C, 0xB46D, 0xB46E,
+	0xC5CD, 0xB46F, 0xB470, 0xB471, 0xEDDD, 0xBFC4, 0xB472, 0xB473, 0xB474, 0xEDDE, 0xB475, 0xB476, 0xB477, 0xB478, 0xB479, 0xB47A,
+	0xB47B, 0xB47C, 0xB47D, 0xB47E, 0xB480, 0xB481, 0xB482, 0xB483, 0xC4A5, 0xB484, 0xB485, 0xB486, 0xEDE0, 0xB487, 0xB488, 0xB489,
+	0xB48A, 0xB48B, 0xEDE1, 0xB48C, 0xEDE3, 0xB48D, 0xB48E, 0xC1D7, 0xB48F, 0xB490, 0xBBC7, 0xB491, 0xB492, 0xB493, 0xB494, 0xB495,
+	0xB496, 0xBDB8, 0xB497, 0xB498, 0xB499, 0xEDE2, 0xB49A, 0xB49B, 0xB49C, 0xB49D, 0xB49E, 0xB49F, 0xB4A0, 0xB540, 0xB541, 0xB542,
+	0xB543, 0xB544, 0xB545, 0xEDE4, 0xB546, 0xB547, 0xB548, 0xB549, 0xB54A, 0xB54B, 0xB54C, 0xB54D, 0xB54E, 0xB54F, 0xEDE6, 0xB550,
+	0xB551, 0xB552, 0xB553, 0xB554, 0xEDE5, 0xB555, 0xB556, 0xB557, 0xB558, 0xB559, 0xB55A, 0xB55B, 0xB55C, 0xB55D, 0xB55E, 0xB55F,
+	0xB560, 0xB561, 0xB562, 0xB563, 0xEDE7, 0xB564, 0xB565, 0xB566, 0xB567, 0xB568, 0xCABE, 0xECEA, 0xC0F1, 0xB569, 0xC9E7, 0xB56A,
+	0xECEB, 0xC6EE, 0xB56B, 0xB56C, 0xB56D, 0xB56E, 0xECEC, 0xB56F, 0xC6ED, 0xECED, 0xB570, 0xB571, 0xB572, 0xB573, 0xB574, 0xB575,
+	0xB576, 0xB577, 0xB578, 0xECF0, 0xB579, 0xB57A, 0xD7E6, 0xECF3, 0xB57B, 0xB57C, 0xECF1, 0xECEE, 0xECEF, 0xD7A3, 0xC9F1, 0xCBEE,
+	0xECF4, 0xB57D, 0xECF2, 0xB57E, 0xB580, 0xCFE9, 0xB581, 0xECF6, 0xC6B1, 0xB582, 0xB583, 0xB584, 0xB585, 0xBCC0, 0xB586, 0xECF5,
+	0xB587, 0xB588, 0xB589, 0xB58A, 0xB58B, 0xB58C, 0xB58D, 0xB5BB, 0xBBF6, 0xB58E, 0xECF7, 0xB58F, 0xB590, 0xB591, 0xB592, 0xB593,
+	0xD9F7, 0xBDFB, 0xB594, 0xB595, 0xC2BB, 0xECF8, 0xB596, 0xB597, 0xB598, 0xB599, 0xECF9, 0xB59A, 0xB59B, 0xB59C, 0xB59D, 0xB8A3,
+	0xB59E, 0xB59F, 0xB5A0, 0xB640, 0xB641, 0xB642, 0xB643, 0xB644, 0xB645, 0xB646, 0xECFA, 0xB647, 0xB648, 0xB649, 0xB64A, 0xB64B,
+	0xB64C, 0xB64D, 0xB64E, 0xB64F, 0xB650, 0xB651, 0xB652, 0xECFB, 0xB653, 0xB654, 0xB655, 0xB656, 0xB657, 0xB658, 0xB659, 0xB65A,
+	0xB65B, 0xB65C, 0xB65D, 0xECFC, 0xB65E, 0xB65F, 0xB660, 0xB661, 0xB662, 0xD3ED, 0xD8AE, 0xC0EB, 0xB663, 0xC7DD, 0xBACC, 0xB664,
+	0xD0E3, 0xCBBD, 0xB665, 0xCDBA, 0xB666, 0xB667, 0xB8D1, 0xB668, 0xB669, 0xB1FC, 0xB66A, 0xC7EF, 0xB66B, 0xD6D6, 0xB66C, 0xB66D,
+	0xB66E, 0xBFC6, 0xC3EB, 0xB66F, 0xB670, 0xEFF5, 0xB671, 0xB672, 0xC3D8, 0xB673, 0xB674, 0xB675, 0xB676, 0xB677, 0xB678, 0xD7E2,
+	0xB679, 0xB67A, 0xB67B, 0xEFF7, 0xB3D3, 0xB67C, 0xC7D8, 0xD1ED, 0xB67D, 0xD6C8, 0xB67E, 0xEFF8, 0xB680, 0xEFF6, 0xB681, 0xBBFD,
+	0xB3C6, 0xB682, 0xB683, 0xB684, 0xB685, 0xB686, 0xB687, 0xB688, 0xBDD5, 0xB689, 0xB68A, 0xD2C6, 0xB68B, 0xBBE0, 0xB68C, 0xB68D,
+	0xCFA1, 0xB68E, 0xEFFC, 0xEFFB, 0xB68F, 0xB690, 0xEFF9, 0xB691, 0xB692, 0xB693, 0xB694, 0xB3CC, 0xB695, 0xC9D4, 0xCBB0, 0xB696,
+	0xB697, 0xB698, 0xB699, 0xB69A, 0xEFFE, 0xB69B, 0xB69C, 0xB0DE, 0xB69D, 0xB69E, 0xD6C9, 0xB69F, 0xB6A0, 0xB740, 0xEFFD, 0xB741,
+	0xB3ED, 0xB742, 0xB743, 0xF6D5, 0xB744, 0xB745, 0xB746, 0xB747, 0xB748, 0xB749, 0xB74A, 0xB74B, 0xB74C, 0xB74D, 0xB74E, 0xB74F,
+	0xB750, 0xB751, 0xB752, 0xCEC8, 0xB753, 0xB754, 0xB755, 0xF0A2, 0xB756, 0xF0A1, 0xB757, 0xB5BE, 0xBCDA, 0xBBFC, 0xB758, 0xB8E5,
+	0xB759, 0xB75A, 0xB75B, 0xB75C, 0xB75D, 0xB75E, 0xC4C2, 0xB75F, 0xB760, 0xB761, 0xB762, 0xB763, 0xB764, 0xB765, 0xB766, 0xB767,
+	0xB768, 0xF0A3, 0xB769, 0xB76A, 0xB76B, 0xB76C, 0xB76D, 0xCBEB, 0xB76E, 0xB76F, 0xB770, 0xB771, 0xB772, 0xB773, 0xB774, 0xB775,
+	0xB776, 0xB777, 0xB778, 0xB779, 0xB77A, 0xB77B, 0xB77C, 0xB77D, 0xB77E, 0xB780, 0xB781, 0xB782, 0xB783, 0xB784, 0xB785, 0xB786,
+	0xF0A6, 0xB787, 0xB788, 0xB789, 0xD1A8, 0xB78A, 0xBEBF, 0xC7EE, 0xF1B6, 0xF1B7, 0xBFD5, 0xB78B, 0xB78C, 0xB78D, 0xB78E, 0xB4A9,
+	0xF1B8, 0xCDBB, 0xB78F, 0xC7D4, 0xD5AD, 0xB790, 0xF1B9, 0xB791, 0xF1BA, 0xB792, 0xB793, 0xB794, 0xB795, 0xC7CF, 0xB796, 0xB797,
+	0xB798, 0xD2A4, 0xD6CF, 0xB799, 0xB79A, 0xF1BB, 0xBDD1, 0xB4B0, 0xBEBD, 0xB79B, 0xB79C, 0xB79D, 0xB4DC, 0xCED1, 0xB79E, 0xBFDF,
+	0xF1BD, 0xB79F, 0xB7A0, 0xB840, 0xB841, 0xBFFA, 0xF1BC, 0xB842, 0xF1BF, 0xB843, 0xB844, 0xB845, 0xF1BE, 0xF1C0, 0xB846, 0xB847,
+	0xB848, 0xB849, 0xB84A, 0xF1C1, 0xB84B, 0xB84C, 0xB84D, 0xB84E, 0xB84F, 0xB850, 0xB851, 0xB852, 0xB853, 0xB854, 0xB855, 0xC1FE,
+	0xB856, 0xB857, 0xB858, 0xB859, 0xB85A, 0xB85B, 0xB85C, 0xB85D, 0xB85E, 0xB85F, 0xB860, 0xC1A2, 0xB861, 0xB862, 0xB863, 0xB864,
+	0xB865, 0xB866, 0xB867, 0xB868, 0xB869, 0xB86A, 0xCAFA, 0xB86B, 0xB86C, 0xD5BE, 0xB86D, 0xB86E, 0xB86F, 0xB870, 0xBEBA, 0xBEB9,
+	0xD5C2, 0xB871, 0xB872, 0xBFA2, 0xB873, 0xCDAF, 0xF1B5, 0xB874, 0xB875, 0xB876, 0xB877, 0xB878, 0xB879, 0xBDDF, 0xB87A, 0xB6CB,
+	0xB87B, 0xB87C, 0xB87D, 0xB87E, 0xB880, 0xB881, 0xB882, 0xB883, 0xB884, 0xD6F1, 0xF3C3, 0xB885, 0xB886, 0xF3C4, 0xB887, 0xB8CD,
+	0xB888, 0xB889, 0xB88A, 0xF3C6, 0xF3C7, 0xB88B, 0xB0CA, 0xB88C, 0xF3C5, 0xB88D, 0xF3C9, 0xCBF1, 0xB88E, 0xB88F, 0xB890, 0xF3CB,
+	0xB891, 0xD0A6, 0xB892, 0xB893, 0xB1CA, 0xF3C8, 0xB894, 0xB895, 0xB896, 0xF3CF, 0xB897, 0xB5D1, 0xB898, 0xB899, 0xF3D7, 0xB89A,
+	0xF3D2, 0xB89B, 0xB89C, 0xB89D, 0xF3D4, 0xF3D3, 0xB7FB, 0xB89E, 0xB1BF, 0xB89F, 0xF3CE, 0xF3CA, 0xB5DA, 0xB8A0, 0xF3D0, 0xB940,
+	0xB941, 0xF3D1, 0xB942, 0xF3D5, 0xB943, 0xB944, 0xB945, 0xB946, 0xF3CD, 0xB947, 0xBCE3, 0xB948, 0xC1FD, 0xB949, 0xF3D6, 0xB94A,
+	0xB94B, 0xB94C, 0xB94D, 0xB94E, 0xB94F, 0xF3DA, 0xB950, 0xF3CC, 0xB951, 0xB5C8, 0xB952, 0xBDEE, 0xF3DC, 0xB953, 0xB954, 0xB7A4,
+	0xBFF0, 0xD6FE, 0xCDB2, 0xB955, 0xB4F0, 0xB956, 0xB2DF, 0xB957, 0xF3D8, 0xB958, 0xF3D9, 0xC9B8, 0xB959, 0xF3DD, 0xB95A, 0xB95B,
+	0xF3DE, 0xB95C, 0xF3E1, 0xB95D, 0xB95E, 0xB95F, 0xB960, 0xB961, 0xB962, 0xB963, 0xB964, 0xB965, 0xB966, 0xB967, 0xF3DF, 0xB968,
+	0xB969, 0xF3E3, 0xF3E2, 0xB96A, 0xB96B, 0xF3DB, 0xB96C, 0xBFEA, 0xB96D, 0xB3EF, 0xB96E, 0xF3E0, 0xB96F, 0xB970, 0xC7A9, 0xB971,
+	0xBCF2, 0xB972, 0xB973, 0xB974, 0xB975, 0xF3EB, 0xB976, 0xB977, 0xB978, 0xB979, 0xB97A, 0xB97B, 0xB97C, 0xB9BF, 0xB97D, 0xB97E,
+	0xF3E4, 0xB980, 0xB981, 0xB982, 0xB2AD, 0xBBFE, 0xB983, 0xCBE3, 0xB984, 0xB985, 0xB986, 0xB987, 0xF3ED, 0xF3E9, 0xB988, 0xB989,
+	0xB98A, 0xB9DC, 0xF3EE, 0xB98B, 0xB98C, 0xB98D, 0xF3E5, 0xF3E6, 0xF3EA, 0xC2E1, 0xF3EC, 0xF3EF, 0xF3E8, 0xBCFD, 0xB98E, 0xB98F,
+	0xB990, 0xCFE4, 0xB991, 0xB992, 0xF3F0, 0xB993, 0xB994, 0xB995, 0xF3E7, 0xB996, 0xB997, 0xB998, 0xB999, 0xB99A, 0xB99B, 0xB99C,
+	0xB99D, 0xF3F2, 0xB99E, 0xB99F, 0xB9A0, 0xBA40, 0xD7AD, 0xC6AA, 0xBA41, 0xBA42, 0xBA43, 0xBA44, 0xF3F3, 0xBA45, 0xBA46, 0xBA47,
+	0xBA48, 0xF3F1, 0xBA49, 0xC2A8, 0xBA4A, 0xBA4B, 0xBA4C, 0xBA4D, 0xBA4E, 0xB8DD, 0xF3F5, 0xBA4F, 0xBA50, 0xF3F4, 0xBA51, 0xBA52,
+	0xBA53, 0xB4DB, 0xBA54, 0xBA55, 0xBA56, 0xF3F6, 0xF3F7, 0xBA57, 0xBA58, 0xBA59, 0xF3F8, 0xBA5A, 0xBA5B, 0xBA5C, 0xC0BA, 0xBA5D,
+	0xBA5E, 0xC0E9, 0xBA5F, 0xBA60, 0xBA61, 0xBA62, 0xBA63, 0xC5F1, 0xBA64, 0xBA65, 0xBA66, 0xBA67, 0xF3FB, 0xBA68, 0xF3FA, 0xBA69,
+	0xBA6A, 0xBA6B, 0xBA6C, 0xBA6D, 0xBA6E, 0xBA6F, 0xBA70, 0xB4D8, 0xBA71, 0xBA72, 0xBA73, 0xF3FE, 0xF3F9, 0xBA74, 0xBA75, 0xF3FC,
+	0xBA76, 0xBA77, 0xBA78, 0xBA79, 0xBA7A, 0xBA7B, 0xF3FD, 0xBA7C, 0xBA7D, 0xBA7E, 0xBA80, 0xBA81, 0xBA82, 0xBA83, 0xBA84, 0xF4A1,
+	0xBA85, 0xBA86, 0xBA87, 0xBA88, 0xBA89, 0xBA8A, 0xF4A3, 0xBBC9, 0xBA8B, 0xBA8C, 0xF4A2, 0xBA8D, 0xBA8E, 0xBA8F, 0xBA90, 0xBA91,
+	0xBA92, 0xBA93, 0xBA94, 0xBA95, 0xBA96, 0xBA97, 0xBA98, 0xBA99, 0xF4A4, 0xBA9A, 0xBA9B, 0xBA9C, 0xBA9D, 0xBA9E, 0xBA9F, 0xB2BE,
+	0xF4A6, 0xF4A5, 0xBAA0, 0xBB40, 0xBB41, 0xBB42, 0xBB43, 0xBB44, 0xBB45, 0xBB46, 0xBB47, 0xBB48, 0xBB49, 0xBCAE, 0xBB4A, 0xBB4B,
+	0xBB4C, 0xBB4D, 0xBB4E, 0xBB4F, 0xBB50, 0xBB51, 0xBB52, 0xBB53, 0xBB54, 0xBB55, 0xBB56, 0xBB57, 0xBB58, 0xBB59, 0xBB5A, 0xBB5B,
+	0xBB5C, 0xBB5D, 0xBB5E, 0xBB5F, 0xBB60, 0xBB61, 0xBB62, 0xBB63, 0xBB64, 0xBB65, 0xBB66, 0xBB67, 0xBB68, 0xBB69, 0xBB6A, 0xBB6B,
+	0xBB6C, 0xBB6D, 0xBB6E, 0xC3D7, 0xD9E1, 0xBB6F, 0xBB70, 0xBB71, 0xBB72, 0xBB73, 0xBB74, 0xC0E0, 0xF4CC, 0xD7D1, 0xBB75, 0xBB76,
+	0xBB77, 0xBB78, 0xBB79, 0xBB7A, 0xBB7B, 0xBB7C, 0xBB7D, 0xBB7E, 0xBB80, 0xB7DB, 0xBB81, 0xBB82, 0xBB83, 0xBB84, 0xBB85, 0xBB86,
+	0xBB87, 0xF4CE, 0xC1A3, 0xBB88, 0xBB89, 0xC6C9, 0xBB8A, 0xB4D6, 0xD5B3, 0xBB8B, 0xBB8C, 0xBB8D, 0xF4D0, 0xF4CF, 0xF4D1, 0xCBDA,
+	0xBB8E, 0xBB8F, 0xF4D2, 0xBB90, 0xD4C1, 0xD6E0, 0xBB91, 0xBB92, 0xBB93, 0xBB94, 0xB7E0, 0xBB95, 0xBB96, 0xBB97, 0xC1B8, 0xBB98,
+	0xBB99, 0xC1BB, 0xF4D3, 0xBEAC, 0xBB9A, 0xBB9B, 0xBB9C, 0xBB9D, 0xBB9E, 0xB4E2, 0xBB9F, 0xBBA0, 0xF4D4, 0xF4D5, 0xBEAB, 0xBC40,
+	0xBC41, 0xF4D6, 0xBC42, 0xBC43, 0xBC44, 0xF4DB, 0xBC45, 0xF4D7, 0xF4DA, 0xBC46, 0xBAFD, 0xBC47, 0xF4D8, 0xF4D9, 0xBC48, 0xBC49,
+	0xBC4A, 0xBC4B, 0xBC4C, 0xBC4D, 0xBC4E, 0xB8E2, 0xCCC7, 0xF4DC, 0xBC4F, 0xB2DA, 0xBC50, 0xBC51, 0xC3D3, 0xBC52, 0xBC53, 0xD4E3,
+	0xBFB7, 0xBC54, 0xBC55, 0xBC56, 0xBC57, 0xBC58, 0xBC59, 0xBC5A, 0xF4DD, 0xBC5B, 0xBC5C, 0xBC5D, 0xBC5E, 0xBC5F, 0xBC60, 0xC5B4,
+	0xBC61, 0xBC62, 0xBC63, 0xBC64, 0xBC65, 0xBC66, 0xBC67, 0xBC68, 0xF4E9, 0xBC69, 0xBC6A, 0xCFB5, 0xBC6B, 0xBC6C, 0xBC6D, 0xBC6E,
+	0xBC6F, 0xBC70, 0xBC71, 0xBC72, 0xBC73, 0xBC74, 0xBC75, 0xBC76, 0xBC77, 0xBC78, 0xCEC9, 0xBC79, 0xBC7A, 0xBC7B, 0xBC7C, 0xBC7D,
+	0xBC7E, 0xBC80, 0xBC81, 0xBC82, 0xBC83, 0xBC84, 0xBC85, 0xBC86, 0xBC87, 0xBC88, 0xBC89, 0xBC8A, 0xBC8B, 0xBC8C, 0xBC8D, 0xBC8E,
+	0xCBD8, 0xBC8F, 0xCBF7, 0xBC90, 0xBC91, 0xBC92, 0xBC93, 0xBDF4, 0xBC94, 0xBC95, 0xBC96, 0xD7CF, 0xBC97, 0xBC98, 0xBC99, 0xC0DB,
+	0xBC9A, 0xBC9B, 0xBC9C, 0xBC9D, 0xBC9E, 0xBC9F, 0xBCA0, 0xBD40, 0xBD41, 0xBD42, 0xBD43, 0xBD44, 0xBD45, 0xBD46, 0xBD47, 0xBD48,
+	0xBD49, 0xBD4A, 0xBD4B, 0xBD4C, 0xBD4D, 0xBD4E, 0xBD4F, 0xBD50, 0xBD51, 0xBD52, 0xBD53, 0xBD54, 0xBD55, 0xBD56, 0xBD57, 0xBD58,
+	0xBD59, 0xBD5A, 0xBD5B, 0xBD5C, 0xBD5D, 0xBD5E, 0xBD5F, 0xBD60, 0xBD61, 0xBD62, 0xBD63, 0xBD64, 0xBD65, 0xBD66, 0xBD67, 0xBD68,
+	0xBD69, 0xBD6A, 0xBD6B, 0xBD6C, 0xBD6D, 0xBD6E, 0xBD6F, 0xBD70, 0xBD71, 0xBD72, 0xBD73, 0xBD74, 0xBD75, 0xBD76, 0xD0F5, 0xBD77,
+	0xBD78, 0xBD79, 0xBD7A, 0xBD7B, 0xBD7C, 0xBD7D, 0xBD7E, 0xF4EA, 0xBD80, 0xBD81, 0xBD82, 0xBD83, 0xBD84, 0xBD85, 0xBD86, 0xBD87,
+	0xBD88, 0xBD89, 0xBD8A, 0xBD8B, 0xBD8C, 0xBD8D, 0xBD8E, 0xBD8F, 0xBD90, 0xBD91, 0xBD92, 0xBD93, 0xBD94, 0xBD95, 0xBD96, 0xBD97,
+	0xBD98, 0xBD99, 0xBD9A, 0xBD9B, 0xBD9C, 0xBD9D, 0xBD9E, 0xBD9F, 0xBDA0, 0xBE40, 0xBE41, 0xBE42, 0xBE43, 0xBE44, 0xBE45, 0xBE46,
+	0xBE47, 0xBE48, 0xBE49, 0xBE4A, 0xBE4B, 0xBE4C, 0xF4EB, 0xBE4D, 0xBE4E, 0xBE4F, 0xBE50, 0xBE51, 0xBE52, 0xBE53, 0xF4EC, 0xBE54,
+	0xBE55, 0xBE56, 0xBE57, 0xBE58, 0xBE59, 0xBE5A, 0xBE5B, 0xBE5C, 0xBE5D, 0xBE5E, 0xBE5F, 0xBE60, 0xBE61, 0xBE62, 0xBE63, 0xBE64,
+	0xBE65, 0xBE66, 0xBE67, 0xBE68, 0xBE69, 0xBE6A, 0xBE6B, 0xBE6C, 0xBE6D, 0xBE6E, 0xBE6F, 0xBE70, 0xBE71, 0xBE72, 0xBE73, 0xBE74,
+	0xBE75, 0xBE76, 0xBE77, 0xBE78, 0xBE79, 0xBE7A, 0xBE7B, 0xBE7C, 0xBE7D, 0xBE7E, 0xBE80, 0xBE81, 0xBE82, 0xBE83, 0xBE84, 0xBE85,
+	0xBE86, 0xBE87, 0xBE88, 0xBE89, 0xBE8A, 0xBE8B, 0xBE8C, 0xBE8D, 0xBE8E, 0xBE8F, 0xBE90, 0xBE91, 0xBE92, 0xBE93, 0xBE94, 0xBE95,
+	0xBE96, 0xBE97, 0xBE98, 0xBE99, 0xBE9A, 0xBE9B, 0xBE9C, 0xBE9D, 0xBE9E, 0xBE9F, 0xBEA0, 0xBF40, 0xBF41, 0xBF42, 0xBF43, 0xBF44,
+	0xBF45, 0xBF46, 0xBF47, 0xBF48, 0xBF49, 0xBF4A, 0xBF4B, 0xBF4C, 0xBF4D, 0xBF4E, 0xBF4F, 0xBF50, 0xBF51, 0xBF52, 0xBF53, 0xBF54,
+	0xBF55, 0xBF56, 0xBF57, 0xBF58, 0xBF59, 0xBF5A, 0xBF5B, 0xBF5C, 0xBF5D, 0xBF5E, 0xBF5F, 0xBF60, 0xBF61, 0xBF62, 0xBF63, 0xBF64,
+	0xBF65, 0xBF66, 0xBF67, 0xBF68, 0xBF69, 0xBF6A, 0xBF6B, 0xBF6C, 0xBF6D, 0xBF6E, 0xBF6F, 0xBF70, 0xBF71, 0xBF72, 0xBF73, 0xBF74,
+	0xBF75, 0xBF76, 0xBF77, 0xBF78, 0xBF79, 0xBF7A, 0xBF7B, 0xBF7C, 0xBF7D, 0xBF7E, 0xBF80, 0xF7E3, 0xBF81, 0xBF82, 0xBF83, 0xBF84,
+	0xBF85, 0xB7B1, 0xBF86, 0xBF87, 0xBF88, 0xBF89, 0xBF8A, 0xF4ED, 0xBF8B, 0xBF8C, 0xBF8D, 0xBF8E, 0xBF8F, 0xBF90, 0xBF91, 0xBF92,
+	0xBF93, 0xBF94, 0xBF95, 0xBF96, 0xBF97, 0xBF98, 0xBF99, 0xBF9A, 0xBF9B, 0xBF9C, 0xBF9D, 0xBF9E, 0xBF9F, 0xBFA0, 0xC040, 0xC041,
+	0xC042, 0xC043, 0xC044, 0xC045, 0xC046, 0xC047, 0xC048, 0xC049, 0xC04A, 0xC04B, 0xC04C, 0xC04D, 0xC04E, 0xC04F, 0xC050, 0xC051,
+	0xC052, 0xC053, 0xC054, 0xC055, 0xC056, 0xC057, 0xC058, 0xC059, 0xC05A, 0xC05B, 0xC05C, 0xC05D, 0xC05E, 0xC05F, 0xC060, 0xC061,
+	0xC062, 0xC063, 0xD7EB, 0xC064, 0xC065, 0xC066, 0xC067, 0xC068, 0xC069, 0xC06A, 0xC06B, 0xC06C, 0xC06D, 0xC06E, 0xC06F, 0xC070,
+	0xC071, 0xC072, 0xC073, 0xC074, 0xC075, 0xC076, 0xC077, 0xC078, 0xC079, 0xC07A, 0xC07B, 0xF4EE, 0xC07C, 0xC07D, 0xC07E, 0xE6F9,
+	0xBEC0, 0xE6FA, 0xBAEC, 0xE6FB, 0xCFCB, 0xE6FC, 0xD4BC, 0xBCB6, 0xE6FD, 0xE6FE, 0xBCCD, 0xC8D2, 0xCEB3, 0xE7A1, 0xC080, 0xB4BF,
+	0xE7A2, 0xC9B4, 0xB8D9, 0xC4C9, 0xC081, 0xD7DD, 0xC2DA, 0xB7D7, 0xD6BD, 0xCEC6, 0xB7C4, 0xC082, 0xC083, 0xC5A6, 0xE7A3, 0xCFDF,
+	0xE7A4, 0xE7A5, 0xE7A6, 0xC1B7, 0xD7E9, 0xC9F0, 0xCFB8, 0xD6AF, 0xD6D5, 0xE7A7, 0xB0ED, 0xE7A8, 0xE7A9, 0xC9DC, 0xD2EF, 0xBEAD,
+	0xE7AA, 0xB0F3, 0xC8DE, 0xBDE1, 0xE7AB, 0xC8C6, 0xC084, 0xE7AC, 0xBBE6, 0xB8F8, 0xD1A4, 0xE7AD, 0xC2E7, 0xBEF8, 0xBDCA, 0xCDB3,
+	0xE7AE, 0xE7AF, 0xBEEE, 0xD0E5, 0xC085, 0xCBE7, 0xCCD0, 0xBCCC, 0xE7B0, 0xBCA8, 0xD0F7, 0xE7B1, 0xC086, 0xD0F8, 0xE7B2, 0xE7B3,
+	0xB4C2, 0xE7B4, 0xE7B5, 0xC9FE, 0xCEAC, 0xC3E0, 0xE7B7, 0xB1C1, 0xB3F1, 0xC087, 0xE7B8, 0xE7B9, 0xD7DB, 0xD5C0, 0xE7BA, 0xC2CC,
+	0xD7BA, 0xE7BB, 0xE7BC, 0xE7BD, 0xBCEA, 0xC3E5, 0xC0C2, 0xE7BE, 0xE7BF, 0xBCA9, 0xC088, 0xE7C0, 0xE7C1, 0xE7B6, 0xB6D0, 0xE7C2,
+	0xC089, 0xE7C3, 0xE7C4, 0xBBBA, 0xB5DE, 0xC2C6, 0xB1E0, 0xE7C5, 0xD4B5, 0xE7C6, 0xB8BF, 0xE7C8, 0xE7C7, 0xB7EC, 0xC08A, 0xE7C9,
+	0xB2F8, 0xE7CA, 0xE7CB, 0xE7CC, 0xE7CD, 0xE7CE, 0xE7CF, 0xE7D0, 0xD3A7, 0xCBF5, 0xE7D1, 0xE7D2, 0xE7D3, 0xE7D4, 0xC9C9, 0xE7D5,
+	0xE7D6, 0xE7D7, 0xE7D8, 0xE7D9, 0xBDC9, 0xE7DA, 0xF3BE, 0xC08B, 0xB8D7, 0xC08C, 0xC8B1, 0xC08D, 0xC08E, 0xC08F, 0xC090, 0xC091,
+	0xC092, 0xC093, 0xF3BF, 0xC094, 0xF3C0, 0xF3C1, 0xC095, 0xC096, 0xC097, 0xC098, 0xC099, 0xC09A, 0xC09B, 0xC09C, 0xC09D, 0xC09E,
+	0xB9DE, 0xCDF8, 0xC09F, 0xC0A0, 0xD8E8, 0xBAB1, 0xC140, 0xC2DE, 0xEEB7, 0xC141, 0xB7A3, 0xC142, 0xC143, 0xC144, 0xC145, 0xEEB9,
+	0xC146, 0xEEB8, 0xB0D5, 0xC147, 0xC148, 0xC149, 0xC14A, 0xC14B, 0xEEBB, 0xD5D6, 0xD7EF, 0xC14C, 0xC14D, 0xC14E, 0xD6C3, 0xC14F,
+	0xC150, 0xEEBD, 0xCAF0, 0xC151, 0xEEBC, 0xC152, 0xC153, 0xC154, 0xC155, 0xEEBE, 0xC156, 0xC157, 0xC158, 0xC159, 0xEEC0, 0xC15A,
+	0xC15B, 0xEEBF, 0xC15C, 0xC15D, 0xC15E, 0xC15F, 0xC160, 0xC161, 0xC162, 0xC163, 0xD1F2, 0xC164, 0xC7BC, 0xC165, 0xC3C0, 0xC166,
+	0xC167, 0xC168, 0xC169, 0xC16A, 0xB8E1, 0xC16B, 0xC16C, 0xC16D, 0xC16E, 0xC16F, 0xC1E7, 0xC170, 0xC171, 0xF4C6, 0xD0DF, 0xF4C7,
+	0xC172, 0xCFDB, 0xC173, 0xC174, 0xC8BA, 0xC175, 0xC176, 0xF4C8, 0xC177, 0xC178, 0xC179, 0xC17A, 0xC17B, 0xC17C, 0xC17D, 0xF4C9,
+	0xF4CA, 0xC17E, 0xF4CB, 0xC180, 0xC181, 0xC182, 0xC183, 0xC184, 0xD9FA, 0xB8FE, 0xC185, 0xC186, 0xE5F1, 0xD3F0, 0xC187, 0xF4E0,
+	0xC188, 0xCECC, 0xC189, 0xC18A, 0xC18B, 0xB3E1, 0xC18C, 0xC18D, 0xC18E, 0xC18F, 0xF1B4, 0xC190, 0xD2EE, 0xC191, 0xF4E1, 0xC192,
+	0xC193, 0xC194, 0xC195, 0xC196, 0xCFE8, 0xF4E2, 0xC197, 0xC198, 0xC7CC, 0xC199, 0xC19A, 0xC19B, 0xC19C, 0xC19D, 0xC19E, 0xB5D4,
+	0xB4E4, 0xF4E4, 0xC19F, 0xC1A0, 0xC240, 0xF4E3, 0xF4E5, 0xC241, 0xC242, 0xF4E6, 0xC243, 0xC244, 0xC245, 0xC246, 0xF4E7, 0xC247,
+	0xBAB2, 0xB0BF, 0xC248, 0xF4E8, 0xC249, 0xC24A, 0xC24B, 0xC24C, 0xC24D, 0xC24E, 0xC24F, 0xB7AD, 0xD2ED, 0xC250, 0xC251, 0xC252,
+	0xD2AB, 0xC0CF, 0xC253, 0xBFBC, 0xEBA3, 0xD5DF, 0xEAC8, 0xC254, 0xC255, 0xC256, 0xC257, 0xF1F3, 0xB6F8, 0xCBA3, 0xC258, 0xC259,
+	0xC4CD, 0xC25A, 0xF1E7, 0xC25B, 0xF1E8, 0xB8FB, 0xF1E9, 0xBAC4, 0xD4C5, 0xB0D2, 0xC25C, 0xC25D, 0xF1EA, 0xC25E, 0xC25F, 0xC260,
+	0xF1EB, 0xC261, 0xF1EC, 0xC262, 0xC263, 0xF1ED, 0xF1EE, 0xF1EF, 0xF1F1, 0xF1F0, 0xC5D5, 0xC264, 0xC265, 0xC266, 0xC267, 0xC268,
+	0xC269, 0xF1F2, 0xC26A, 0xB6FA, 0xC26B, 0xF1F4, 0xD2AE, 0xDEC7, 0xCBCA, 0xC26C, 0xC26D, 0xB3DC, 0xC26E, 0xB5A2, 0xC26F, 0xB9A2,
+	0xC270, 0xC271, 0xC4F4, 0xF1F5, 0xC272, 0xC273, 0xF1F6, 0xC274, 0xC275, 0xC276, 0xC1C4, 0xC1FB, 0xD6B0, 0xF1F7, 0xC277, 0xC278,
+	0xC279, 0xC27A, 0xF1F8, 0xC27B, 0xC1AA, 0xC27C, 0xC27D, 0xC27E, 0xC6B8, 0xC280, 0xBEDB, 0xC281, 0xC282, 0xC283, 0xC284, 0xC285,
+	0xC286, 0xC287, 0xC288, 0xC289, 0xC28A, 0xC28B, 0xC28C, 0xC28D, 0xC28E, 0xF1F9, 0xB4CF, 0xC28F, 0xC290, 0xC291, 0xC292, 0xC293,
+	0xC294, 0xF1FA, 0xC295, 0xC296, 0xC297, 0xC298, 0xC299, 0xC29A, 0xC29B, 0xC29C, 0xC29D, 0xC29E, 0xC29F, 0xC2A0, 0xC340, 0xEDB2,
+	0xEDB1, 0xC341, 0xC342, 0xCBE0, 0xD2DE, 0xC343, 0xCBC1, 0xD5D8, 0xC344, 0xC8E2, 0xC345, 0xC0DF, 0xBCA1, 0xC346, 0xC347, 0xC348,
+	0xC349, 0xC34A, 0xC34B, 0xEBC1, 0xC34C, 0xC34D, 0xD0A4, 0xC34E, 0xD6E2, 0xC34F, 0xB6C7, 0xB8D8, 0xEBC0, 0xB8CE, 0xC350, 0xEBBF,
+	0xB3A6, 0xB9C9, 0xD6AB, 0xC351, 0xB7F4, 0xB7CA, 0xC352, 0xC353, 0xC354, 0xBCE7, 0xB7BE, 0xEBC6, 0xC355, 0xEBC7, 0xB0B9, 0xBFCF,
+	0xC356, 0xEBC5, 0xD3FD, 0xC357, 0xEBC8, 0xC358, 0xC359, 0xEBC9, 0xC35A, 0xC35B, 0xB7CE, 0xC35C, 0xEBC2, 0xEBC4, 0xC9F6, 0xD6D7,
+	0xD5CD, 0xD0B2, 0xEBCF, 0xCEB8, 0xEBD0, 0xC35D, 0xB5A8, 0xC35E, 0xC35F, 0xC360, 0xC361, 0xC362, 0xB1B3, 0xEBD2, 0xCCA5, 0xC363,
+	0xC364, 0xC365, 0xC366, 0xC367, 0xC368, 0xC369, 0xC5D6, 0xEBD3, 0xC36A, 0xEBD1, 0xC5DF, 0xEBCE, 0xCAA4, 0xEBD5, 0xB0FB, 0xC36B,
+	0xC36C, 0xBAFA, 0xC36D, 0xC36E, 0xD8B7, 0xF1E3, 0xC36F, 0xEBCA, 0xEBCB, 0xEBCC, 0xEBCD, 0xEBD6, 0xE6C0, 0xEBD9, 0xC370, 0xBFE8,
+	0xD2C8, 0xEBD7, 0xEBDC, 0xB8EC, 0xEBD8, 0xC371, 0xBDBA, 0xC372, 0xD0D8, 0xC373, 0xB0B7, 0xC374, 0xEBDD, 0xC4DC, 0xC375, 0xC376,
+	0xC377, 0xC378, 0xD6AC, 0xC379, 0xC37A, 0xC37B, 0xB4E0, 0xC37C, 0xC37D, 0xC2F6, 0xBCB9, 0xC37E, 0xC380, 0xEBDA, 0xEBDB, 0xD4E0,
+	0xC6EA, 0xC4D4, 0xEBDF, 0xC5A7, 0xD9F5, 0xC381, 0xB2B1, 0xC382, 0xEBE4, 0xC383, 0xBDC5, 0xC384, 0xC385, 0xC386, 0xEBE2, 0xC387,
+	0xC388, 0xC389, 0xC38A, 0xC38B, 0xC38C, 0xC38D, 0xC38E, 0xC38F, 0xC390, 0xC391, 0xC392, 0xC393, 0xEBE3, 0xC394, 0xC395, 0xB8AC,
+	0xC396, 0xCDD1, 0xEBE5, 0xC397, 0xC398, 0xC399, 0xEBE1, 0xC39A, 0xC1B3, 0xC39B, 0xC39C, 0xC39D, 0xC39E, 0xC39F, 0xC6A2, 0xC3A0,
+	0xC440, 0xC441, 0xC442, 0xC443, 0xC444, 0xC445, 0xCCF3, 0xC446, 0xEBE6, 0xC447, 0xC0B0, 0xD2B8, 0xEBE7, 0xC448, 0xC449, 0xC44A,
+	0xB8AF, 0xB8AD, 0xC44B, 0xEBE8, 0xC7BB, 0xCDF3, 0xC44C, 0xC44D, 0xC44E, 0xEBEA, 0xEBEB, 0xC44F, 0xC450, 0xC451, 0xC452, 0xC453,
+	0xEBED, 0xC454, 0xC455, 0xC456, 0xC457, 0xD0C8, 0xC458, 0xEBF2, 0xC459, 0xEBEE, 0xC45A, 0xC45B, 0xC45C, 0xEBF1, 0xC8F9, 0xC45D,
+	0xD1FC, 0xEBEC, 0xC45E, 0xC45F, 0xEBE9, 0xC460, 0xC461, 0xC462, 0xC463, 0xB8B9, 0xCFD9, 0xC4E5, 0xEBEF, 0xEBF0, 0xCCDA, 0xCDC8,
+	0xB0F2, 0xC464, 0xEBF6, 0xC465, 0xC466, 0xC467, 0xC468, 0xC469, 0xEBF5, 0xC46A, 0xB2B2, 0xC46B, 0xC46C, 0xC46D, 0xC46E, 0xB8E0,
+	0xC46F, 0xEBF7, 0xC470, 0xC471, 0xC472, 0xC473, 0xC474, 0xC475, 0xB1EC, 0xC476, 0xC477, 0xCCC5, 0xC4A4, 0xCFA5, 0xC478, 0xC479,
+	0xC47A, 0xC47B, 0xC47C, 0xEBF9, 0xC47D, 0xC47E, 0xECA2, 0xC480, 0xC5F2, 0xC481, 0xEBFA, 0xC482, 0xC483, 0xC484, 0xC485, 0xC486,
+	0xC487, 0xC488, 0xC489, 0xC9C5, 0xC48A, 0xC48B, 0xC48C, 0xC48D, 0xC48E, 0xC48F, 0xE2DF, 0xEBFE, 0xC490, 0xC491, 0xC492, 0xC493,
+	0xCDCE, 0xECA1, 0xB1DB, 0xD3B7, 0xC494, 0xC495, 0xD2DC, 0xC496, 0xC497, 0xC498, 0xEBFD, 0xC499, 0xEBFB, 0xC49A, 0xC49B, 0xC49C,
+	0xC49D, 0xC49E, 0xC49F, 0xC4A0, 0xC540, 0xC541, 0xC542, 0xC543, 0xC544, 0xC545, 0xC546, 0xC547, 0xC548, 0xC549, 0xC54A, 0xC54B,
+	0xC54C, 0xC54D, 0xC54E, 0xB3BC, 0xC54F, 0xC550, 0xC551, 0xEAB0, 0xC552, 0xC553, 0xD7D4, 0xC554, 0xF4AB, 0xB3F4, 0xC555, 0xC556,
+	0xC557, 0xC558, 0xC559, 0xD6C1, 0xD6C2, 0xC55A, 0xC55B, 0xC55C, 0xC55D, 0xC55E, 0xC55F, 0xD5E9, 0xBECA, 0xC560, 0xF4A7, 0xC561,
+	0xD2A8, 0xF4A8, 0xF4A9, 0xC562, 0xF4AA, 0xBECB, 0xD3DF, 0xC563, 0xC564, 0xC565, 0xC566, 0xC567, 0xC9E0, 0xC9E1, 0xC568, 0xC569,
+	0xF3C2, 0xC56A, 0xCAE6, 0xC56B, 0xCCF2, 0xC56C, 0xC56D, 0xC56E, 0xC56F, 0xC570, 0xC571, 0xE2B6, 0xCBB4, 0xC572, 0xCEE8, 0xD6DB,
+	0xC573, 0xF4AD, 0xF4AE, 0xF4AF, 0xC574, 0xC575, 0xC576, 0xC577, 0xF4B2, 0xC578, 0xBABD, 0xF4B3, 0xB0E3, 0xF4B0, 0xC579, 0xF4B1,
+	0xBDA2, 0xB2D5, 0xC57A, 0xF4B6, 0xF4B7, 0xB6E6, 0xB2B0, 0xCFCF, 0xF4B4, 0xB4AC, 0xC57B, 0xF4B5, 0xC57C, 0xC57D, 0xF4B8, 0xC57E,
+	0xC580, 0xC581, 0xC582, 0xC583, 0xF4B9, 0xC584, 0xC585, 0xCDA7, 0xC586, 0xF4BA, 0xC587, 0xF4BB, 0xC588, 0xC589, 0xC58A, 0xF4BC,
+	0xC58B, 0xC58C, 0xC58D, 0xC58E, 0xC58F, 0xC590, 0xC591, 0xC592, 0xCBD2, 0xC593, 0xF4BD, 0xC594, 0xC595, 0xC596, 0xC597, 0xF4BE,
+	0xC598, 0xC599, 0xC59A, 0xC59B, 0xC59C, 0xC59D, 0xC59E, 0xC59F, 0xF4BF, 0xC5A0, 0xC640, 0xC641, 0xC642, 0xC643, 0xF4DE, 0xC1BC,
+	0xBCE8, 0xC644, 0xC9AB, 0xD1DE, 0xE5F5, 0xC645, 0xC646, 0xC647, 0xC648, 0xDCB3, 0xD2D5, 0xC649, 0xC64A, 0xDCB4, 0xB0AC, 0xDCB5,
+	0xC64B, 0xC64C, 0xBDDA, 0xC64D, 0xDCB9, 0xC64E, 0xC64F, 0xC650, 0xD8C2, 0xC651, 0xDCB7, 0xD3F3, 0xC652, 0xC9D6, 0xDCBA, 0xDCB6,
+	0xC653, 0xDCBB, 0xC3A2, 0xC654, 0xC655, 0xC656, 0xC657, 0xDCBC, 0xDCC5, 0xDCBD, 0xC658, 0xC659, 0xCEDF, 0xD6A5, 0xC65A, 0xDCCF,
+	0xC65B, 0xDCCD, 0xC65C, 0xC65D, 0xDCD2, 0xBDE6, 0xC2AB, 0xC65E, 0xDCB8, 0xDCCB, 0xDCCE, 0xDCBE, 0xB7D2, 0xB0C5, 0xDCC7, 0xD0BE,
+	0xDCC1, 0xBBA8, 0xC65F, 0xB7BC, 0xDCCC, 0xC660, 0xC661, 0xDCC6, 0xDCBF, 0xC7DB, 0xC662, 0xC663, 0xC664, 0xD1BF, 0xDCC0, 0xC665,
+	0xC666, 0xDCCA, 0xC667, 0xC668, 0xDCD0, 0xC669, 0xC66A, 0xCEAD, 0xDCC2, 0xC66B, 0xDCC3, 0xDCC8, 0xDCC9, 0xB2D4, 0xDCD1, 0xCBD5,
+	0xC66C, 0xD4B7, 0xDCDB, 0xDCDF, 0xCCA6, 0xDCE6, 0xC66D, 0xC3E7, 0xDCDC, 0xC66E, 0xC66F, 0xBFC1, 0xDCD9, 0xC670, 0xB0FA, 0xB9B6,
+	0xDCE5, 0xDCD3, 0xC671, 0xDCC4, 0xDCD6, 0xC8F4, 0xBFE0, 0xC672, 0xC673, 0xC674, 0xC675, 0xC9BB, 0xC676, 0xC677, 0xC678, 0xB1BD,
+	0xC679, 0xD3A2, 0xC67A, 0xC67B, 0xDCDA, 0xC67C, 0xC67D, 0xDCD5, 0xC67E, 0xC6BB, 0xC680, 0xDCDE, 0xC681, 0xC682, 0xC683, 0xC684,
+	0xC685, 0xD7C2, 0xC3AF, 0xB7B6, 0xC7D1, 0xC3A9, 0xDCE2, 0xDCD8, 0xDCEB, 0xDCD4, 0xC686, 0xC687, 0xDCDD, 0xC688, 0xBEA5, 0xDCD7,
+	0xC689, 0xDCE0, 0xC68A, 0xC68B, 0xDCE3, 0xDCE4, 0xC68C, 0xDCF8, 0xC68D, 0xC68E, 0xDCE1, 0xDDA2, 0xDCE7, 0xC68F, 0xC690, 0xC691,
+	0xC692, 0xC693, 0xC694, 0xC695, 0xC696, 0xC697, 0xC698, 0xBCEB, 0xB4C4, 0xC699, 0xC69A, 0xC3A3, 0xB2E7, 0xDCFA, 0xC69B, 0xDCF2,
+	0xC69C, 0xDCEF, 0xC69D, 0xDCFC, 0xDCEE, 0xD2F0, 0xB2E8, 0xC69E, 0xC8D7, 0xC8E3, 0xDCFB, 0xC69F, 0xDCED, 0xC6A0, 0xC740, 0xC741,
+	0xDCF7, 0xC742, 0xC743, 0xDCF5, 0xC744, 0xC745, 0xBEA3, 0xDCF4, 0xC746, 0xB2DD, 0xC747, 0xC748, 0xC749, 0xC74A, 0xC74B, 0xDCF3,
+	0xBCF6, 0xDCE8, 0xBBC4, 0xC74C, 0xC0F3, 0xC74D, 0xC74E, 0xC74F, 0xC750, 0xC751, 0xBCD4, 0xDCE9, 0xDCEA, 0xC752, 0xDCF1, 0xDCF6,
+	0xDCF9, 0xB5B4, 0xC753, 0xC8D9, 0xBBE7, 0xDCFE, 0xDCFD, 0xD3AB, 0xDDA1, 0xDDA3, 0xDDA5, 0xD2F1, 0xDDA4, 0xDDA6, 0xDDA7, 0xD2A9,
+	0xC754, 0xC755, 0xC756, 0xC757, 0xC758, 0xC759, 0xC75A, 0xBAC9, 0xDDA9, 0xC75B, 0xC75C, 0xDDB6, 0xDDB1, 0xDDB4, 0xC75D, 0xC75E,
+	0xC75F, 0xC760, 0xC761, 0xC762, 0xC763, 0xDDB0, 0xC6CE, 0xC764, 0xC765, 0xC0F2, 0xC766, 0xC767, 0xC768, 0xC769, 0xC9AF, 0xC76A,
+	0xC76B, 0xC76C, 0xDCEC, 0xDDAE, 0xC76D, 0xC76E, 0xC76F, 0xC770, 0xDDB7, 0xC771, 0xC772, 0xDCF0, 0xDDAF, 0xC773, 0xDDB8, 0xC774,
+	0xDDAC, 0xC775, 0xC776, 0xC777, 0xC778, 0xC779, 0xC77A, 0xC77B, 0xDDB9, 0xDDB3, 0xDDAD, 0xC4AA, 0xC77C, 0xC77D, 0xC77E, 0xC780,
+	0xDDA8, 0xC0B3, 0xC1AB, 0xDDAA, 0xDDAB, 0xC781, 0xDDB2, 0xBBF1, 0xDDB5, 0xD3A8, 0xDDBA, 0xC782, 0xDDBB, 0xC3A7, 0xC783, 0xC784,
+	0xDDD2, 0xDDBC, 0xC785, 0xC786, 0xC787, 0xDDD1, 0xC788, 0xB9BD, 0xC789, 0xC78A, 0xBED5, 0xC78B, 0xBEFA, 0xC78C, 0xC78D, 0xBACA,
+	0xC78E, 0xC78F, 0xC790, 0xC791, 0xDDCA, 0xC792, 0xDDC5, 0xC793, 0xDDBF, 0xC794, 0xC795, 0xC796, 0xB2CB, 0xDDC3, 0xC797, 0xDDCB,
+	0xB2A4, 0xDDD5, 0xC798, 0xC799, 0xC79A, 0xDDBE, 0xC79B, 0xC79C, 0xC79D, 0xC6D0, 0xDDD0, 0xC79E, 0xC79F, 0xC7A0, 0xC840, 0xC841,
+	0xDDD4, 0xC1E2, 0xB7C6, 0xC842, 0xC843, 0xC844, 0xC845, 0xC846, 0xDDCE, 0xDDCF, 0xC847, 0xC848, 0xC849, 0xDDC4, 0xC84A, 0xC84B,
+	0xC84C, 0xDDBD, 0xC84D, 0xDDCD, 0xCCD1, 0xC84E, 0xDDC9, 0xC84F, 0xC850, 0xC851, 0xC852, 0xDDC2, 0xC3C8, 0xC6BC, 0xCEAE, 0xDDCC,
+	0xC853, 0xDDC8, 0xC854, 0xC855, 0xC856, 0xC857, 0xC858, 0xC859, 0xDDC1, 0xC85A, 0xC85B, 0xC85C, 0xDDC6, 0xC2DC, 0xC85D, 0xC85E,
+	0xC85F, 0xC860, 0xC861, 0xC862, 0xD3A9, 0xD3AA, 0xDDD3, 0xCFF4, 0xC8F8, 0xC863, 0xC864, 0xC865, 0xC866, 0xC867, 0xC868, 0xC869,
+	0xC86A, 0xDDE6, 0xC86B, 0xC86C, 0xC86D, 0xC86E, 0xC86F, 0xC870, 0xDDC7, 0xC871, 0xC872, 0xC873, 0xDDE0, 0xC2E4, 0xC874, 0xC875,
+	0xC876, 0xC877, 0xC878, 0xC879, 0xC87A, 0xC87B, 0xDDE1, 0xC87C, 0xC87D, 0xC87E, 0xC880, 0xC881, 0xC882, 0xC883, 0xC884, 0xC885,
+	0xC886, 0xDDD7, 0xC887, 0xC888, 0xC889, 0xC88A, 0xC88B, 0xD6F8, 0xC88C, 0xDDD9, 0xDDD8, 0xB8F0, 0xDDD6, 0xC88D, 0xC88E, 0xC88F,
+	0xC890, 0xC6CF, 0xC891, 0xB6AD, 0xC892, 0xC893, 0xC894, 0xC895, 0xC896, 0xDDE2, 0xC897, 0xBAF9, 0xD4E1, 0xDDE7, 0xC898, 0xC899,
+	0xC89A, 0xB4D0, 0xC89B, 0xDDDA, 0xC89C, 0xBFFB, 0xDDE3, 0xC89D, 0xDDDF, 0xC89E, 0xDDDD, 0xC89F, 0xC8A0, 0xC940, 0xC941, 0xC942,
+	0xC943, 0xC944, 0xB5D9, 0xC945, 0xC946, 0xC947, 0xC948, 0xDDDB, 0xDDDC, 0xDDDE, 0xC949, 0xBDAF, 0xDDE4, 0xC94A, 0xDDE5, 0xC94B,
+	0xC94C, 0xC94D, 0xC94E, 0xC94F, 0xC950, 0xC951, 0xC952, 0xDDF5, 0xC953, 0xC3C9, 0xC954, 0xC955, 0xCBE2, 0xC956, 0xC957, 0xC958,
+	0xC959, 0xDDF2, 0xC95A, 0xC95B, 0xC95C, 0xC95D, 0xC95E, 0xC95F, 0xC960, 0xC961, 0xC962, 0xC963, 0xC964, 0xC965, 0xC966, 0xD8E1,
+	0xC967, 0xC968, 0xC6D1, 0xC969, 0xDDF4, 0xC96A, 0xC96B, 0xC96C, 0xD5F4, 0xDDF3, 0xDDF0, 0xC96D, 0xC96E, 0xDDEC, 0xC96F, 0xDDEF,
+	0xC970, 0xDDE8, 0xC971, 0xC972, 0xD0EE, 0xC973, 0xC974, 0xC975, 0xC976, 0xC8D8, 0xDDEE, 0xC977, 0xC978, 0xDDE9, 0xC979, 0xC97A,
+	0xDDEA, 0xCBF2, 0xC97B, 0xDDED, 0xC97C, 0xC97D, 0xB1CD, 0xC97E, 0xC980, 0xC981, 0xC982, 0xC983, 0xC984, 0xC0B6, 0xC985, 0xBCBB,
+	0xDDF1, 0xC986, 0xC987, 0xDDF7, 0xC988, 0xDDF6, 0xDDEB, 0xC989, 0xC98A, 0xC98B, 0xC98C, 0xC98D, 0xC5EE, 0xC98E, 0xC98F, 0xC990,
+	0xDDFB, 0xC991, 0xC992, 0xC993, 0xC994, 0xC995, 0xC996, 0xC997, 0xC998, 0xC999, 0xC99A, 0xC99B, 0xDEA4, 0xC99C, 0xC99D, 0xDEA3,
+	0xC99E, 0xC99F, 0xC9A0, 0xCA40, 0xCA41, 0xCA42, 0xCA43, 0xCA44, 0xCA45, 0xCA46, 0xCA47, 0xCA48, 0xDDF8, 0xCA49, 0xCA4A, 0xCA4B,
+	0xCA4C, 0xC3EF, 0xCA4D, 0xC2FB, 0xCA4E, 0xCA4F, 0xCA50, 0xD5E1, 0xCA51, 0xCA52, 0xCEB5, 0xCA53, 0xCA54, 0xCA55, 0xCA56, 0xDDFD,
+	0xCA57, 0xB2CC, 0xCA58, 0xCA59, 0xCA5A, 0xCA5B, 0xCA5C, 0xCA5D, 0xCA5E, 0xCA5F, 0xCA60, 0xC4E8, 0xCADF, 0xCA61, 0xCA62, 0xCA63,
+	0xCA64, 0xCA65, 0xCA66, 0xCA67, 0xCA68, 0xCA69, 0xCA6A, 0xC7BE, 0xDDFA, 0xDDFC, 0xDDFE, 0xDEA2, 0xB0AA, 0xB1CE, 0xCA6B, 0xCA6C,
+	0xCA6D, 0xCA6E, 0xCA6F, 0xDEAC, 0xCA70, 0xCA71, 0xCA72, 0xCA73, 0xDEA6, 0xBDB6, 0xC8EF, 0xCA74, 0xCA75, 0xCA76, 0xCA77, 0xCA78,
+	0xCA79, 0xCA7A, 0xCA7B, 0xCA7C, 0xCA7D, 0xCA7E, 0xDEA1, 0xCA80, 0xCA81, 0xDEA5, 0xCA82, 0xCA83, 0xCA84, 0xCA85, 0xDEA9, 0xCA86,
+	0xCA87, 0xCA88, 0xCA89, 0xCA8A, 0xDEA8, 0xCA8B, 0xCA8C, 0xCA8D, 0xDEA7, 0xCA8E, 0xCA8F, 0xCA90, 0xCA91, 0xCA92, 0xCA93, 0xCA94,
+	0xCA95, 0xCA96, 0xDEAD, 0xCA97, 0xD4CC, 0xCA98, 0xCA99, 0xCA9A, 0xCA9B, 0xDEB3, 0xDEAA, 0xDEAE, 0xCA9C, 0xCA9D, 0xC0D9, 0xCA9E,
+	0xCA9F, 0xCAA0, 0xCB40, 0xCB41, 0xB1A1, 0xDEB6, 0xCB42, 0xDEB1, 0xCB43, 0xCB44, 0xCB45, 0xCB46, 0xCB47, 0xCB48, 0xCB49, 0xDEB2,
+	0xCB4A, 0xCB4B, 0xCB4C, 0xCB4D, 0xCB4E, 0xCB4F, 0xCB50, 0xCB51, 0xCB52, 0xCB53, 0xCB54, 0xD1A6, 0xDEB5, 0xCB55, 0xCB56, 0xCB57,
+	0xCB58, 0xCB59, 0xCB5A, 0xCB5B, 0xDEAF, 0xCB5C, 0xCB5D, 0xCB5E, 0xDEB0, 0xCB5F, 0xD0BD, 0xCB60, 0xCB61, 0xCB62, 0xDEB4, 0xCAED,
+	0xDEB9, 0xCB63, 0xCB64, 0xCB65, 0xCB66, 0xCB67, 0xCB68, 0xDEB8, 0xCB69, 0xDEB7, 0xCB6A, 0xCB6B, 0xCB6C, 0xCB6D, 0xCB6E, 0xCB6F,
+	0xCB70, 0xDEBB, 0xCB71, 0xCB72, 0xCB73, 0xCB74, 0xCB75, 0xCB76, 0xCB77, 0xBDE5, 0xCB78, 0xCB79, 0xCB7A, 0xCB7B, 0xCB7C, 0xB2D8,
+	0xC3EA, 0xCB7D, 0xCB7E, 0xDEBA, 0xCB80, 0xC5BA, 0xCB81, 0xCB82, 0xCB83, 0xCB84, 0xCB85, 0xCB86, 0xDEBC, 0xCB87, 0xCB88, 0xCB89,
+	0xCB8A, 0xCB8B, 0xCB8C, 0xCB8D, 0xCCD9, 0xCB8E, 0xCB8F, 0xCB90, 0xCB91, 0xB7AA, 0xCB92, 0xCB93, 0xCB94, 0xCB95, 0xCB96, 0xCB97,
+	0xCB98, 0xCB99, 0xCB9A, 0xCB9B, 0xCB9C, 0xCB9D, 0xCB9E, 0xCB9F, 0xCBA0, 0xCC40, 0xCC41, 0xD4E5, 0xCC42, 0xCC43, 0xCC44, 0xDEBD,
+	0xCC45, 0xCC46, 0xCC47, 0xCC48, 0xCC49, 0xDEBF, 0xCC4A, 0xCC4B, 0xCC4C, 0xCC4D, 0xCC4E, 0xCC4F, 0xCC50, 0xCC51, 0xCC52, 0xCC53,
+	0xCC54, 0xC4A2, 0xCC55, 0xCC56, 0xCC57, 0xCC58, 0xDEC1, 0xCC59, 0xCC5A, 0xCC5B, 0xCC5C, 0xCC5D, 0xCC5E, 0xCC5F, 0xCC60, 0xCC61,
+	0xCC62, 0xCC63, 0xCC64, 0xCC65, 0xCC66, 0xCC67, 0xCC68, 0xDEBE, 0xCC69, 0xDEC0, 0xCC6A, 0xCC6B, 0xCC6C, 0xCC6D, 0xCC6E, 0xCC6F,
+	0xCC70, 0xCC71, 0xCC72, 0xCC73, 0xCC74, 0xCC75, 0xCC76, 0xCC77, 0xD5BA, 0xCC78, 0xCC79, 0xCC7A, 0xDEC2, 0xCC7B, 0xCC7C, 0xCC7D,
+	0xCC7E, 0xCC80, 0xCC81, 0xCC82, 0xCC83, 0xCC84, 0xCC85, 0xCC86, 0xCC87, 0xCC88, 0xCC89, 0xCC8A, 0xCC8B, 0xF2AE, 0xBBA2, 0xC2B2,
+	0xC5B0, 0xC2C7, 0xCC8C, 0xCC8D, 0xF2AF, 0xCC8E, 0xCC8F, 0xCC90, 0xCC91, 0xCC92, 0xD0E9, 0xCC93, 0xCC94, 0xCC95, 0xD3DD, 0xCC96,
+	0xCC97, 0xCC98, 0xEBBD, 0xCC99, 0xCC9A, 0xCC9B, 0xCC9C, 0xCC9D, 0xCC9E, 0xCC9F, 0xCCA0, 0xB3E6, 0xF2B0, 0xCD40, 0xF2B1, 0xCD41,
+	0xCD42, 0xCAAD, 0xCD43, 0xCD44, 0xCD45, 0xCD46, 0xCD47, 0xCD48, 0xCD49, 0xBAE7, 0xF2B3, 0xF2B5, 0xF2B4, 0xCBE4, 0xCFBA, 0xF2B2,
+	0xCAB4, 0xD2CF, 0xC2EC, 0xCD4A, 0xCD4B, 0xCD4C, 0xCD4D, 0xCD4E, 0xCD4F, 0xCD50, 0xCEC3, 0xF2B8, 0xB0F6, 0xF2B7, 0xCD51, 0xCD52,
+	0xCD53, 0xCD54, 0xCD55, 0xF2BE, 0xCD56, 0xB2CF, 0xCD57, 0xCD58, 0xCD59, 0xCD5A, 0xCD5B, 0xCD5C, 0xD1C1, 0xF2BA, 0xCD5D, 0xCD5E,
+	0xCD5F, 0xCD60, 0xCD61, 0xF2BC, 0xD4E9, 0xCD62, 0xCD63, 0xF2BB, 0xF2B6, 0xF2BF, 0xF2BD, 0xCD64, 0xF2B9, 0xCD65, 0xCD66, 0xF2C7,
+	0xF2C4, 0xF2C6, 0xCD67, 0xCD68, 0xF2CA, 0xF2C2, 0xF2C0, 0xCD69, 0xCD6A, 0xCD6B, 0xF2C5, 0xCD6C, 0xCD6D, 0xCD6E, 0xCD6F, 0xCD70,
+	0xD6FB, 0xCD71, 0xCD72, 0xCD73, 0xF2C1, 0xCD74, 0xC7F9, 0xC9DF, 0xCD75, 0xF2C8, 0xB9C6, 0xB5B0, 0xCD76, 0xCD77, 0xF2C3, 0xF2C9,
+	0xF2D0, 0xF2D6, 0xCD78, 0xCD79, 0xBBD7, 0xCD7A, 0xCD7B, 0xCD7C, 0xF2D5, 0xCDDC, 0xCD7D, 0xD6EB, 0xCD7E, 0xCD80, 0xF2D2, 0xF2D4,
+	0xCD81, 0xCD82, 0xCD83, 0xCD84, 0xB8F2, 0xCD85, 0xCD86, 0xCD87, 0xCD88, 0xF2CB, 0xCD89, 0xCD8A, 0xCD8B, 0xF2CE, 0xC2F9, 0xCD8C,
+	0xD5DD, 0xF2CC, 0xF2CD, 0xF2CF, 0xF2D3, 0xCD8D, 0xCD8E, 0xCD8F, 0xF2D9, 0xD3BC, 0xCD90, 0xCD91, 0xCD92, 0xCD93, 0xB6EA, 0xCD94,
+	0xCAF1, 0xCD95, 0xB7E4, 0xF2D7, 0xCD96, 0xCD97, 0xCD98, 0xF2D8, 0xF2DA, 0xF2DD, 0xF2DB, 0xCD99, 0xCD9A, 0xF2DC, 0xCD9B, 0xCD9C,
+	0xCD9D, 0xCD9E, 0xD1D1, 0xF2D1, 0xCD9F, 0xCDC9, 0xCDA0, 0xCECF, 0xD6A9, 0xCE40, 0xF2E3, 0xCE41, 0xC3DB, 0xCE42, 0xF2E0, 0xCE43,
+	0xCE44, 0xC0AF, 0xF2EC, 0xF2DE, 0xCE45, 0xF2E1, 0xCE46, 0xCE47, 0xCE48, 0xF2E8, 0xCE49, 0xCE4A, 0xCE4B, 0xCE4C, 0xF2E2, 0xCE4D,
+	0xCE4E, 0xF2E7, 0xCE4F, 0xCE50, 0xF2E6, 0xCE51, 0xCE52, 0xF2E9, 0xCE53, 0xCE54, 0xCE55, 0xF2DF, 0xCE56, 0xCE57, 0xF2E4, 0xF2EA,
+	0xCE58, 0xCE59, 0xCE5A, 0xCE5B, 0xCE5C, 0xCE5D, 0xCE5E, 0xD3AC, 0xF2E5, 0xB2F5, 0xCE5F, 0xCE60, 0xF2F2, 0xCE61, 0xD0AB, 0xCE62,
+	0xCE63, 0xCE64, 0xCE65, 0xF2F5, 0xCE66, 0xCE67, 0xCE68, 0xBBC8, 0xCE69, 0xF2F9, 0xCE6A, 0xCE6B, 0xCE6C, 0xCE6D, 0xCE6E, 0xCE6F,
+	0xF2F0, 0xCE70, 0xCE71, 0xF2F6, 0xF2F8, 0xF2FA, 0xCE72, 0xCE73, 0xCE74, 0xCE75, 0xCE76, 0xCE77, 0xCE78, 0xCE79, 0xF2F3, 0xCE7A,
+	0xF2F1, 0xCE7B, 0xCE7C, 0xCE7D, 0xBAFB, 0xCE7E, 0xB5FB, 0xCE80, 0xCE81, 0xCE82, 0xCE83, 0xF2EF, 0xF2F7, 0xF2ED, 0xF2EE, 0xCE84,
+	0xCE85, 0xCE86, 0xF2EB, 0xF3A6, 0xCE87, 0xF3A3, 0xCE88, 0xCE89, 0xF3A2, 0xCE8A, 0xCE8B, 0xF2F4, 0xCE8C, 0xC8DA, 0xCE8D, 0xCE8E,
+	0xCE8F, 0xCE90, 0xCE91, 0xF2FB, 0xCE92, 0xCE93, 0xCE94, 0xF3A5, 0xCE95, 0xCE96, 0xCE97, 0xCE98, 0xCE99, 0xCE9A, 0xCE9B, 0xC3F8,
+	0xCE9C, 0xCE9D, 0xCE9E, 0xCE9F, 0xCEA0, 0xCF40, 0xCF41, 0xCF42, 0xF2FD, 0xCF43, 0xCF44, 0xF3A7, 0xF3A9, 0xF3A4, 0xCF45, 0xF2FC,
+	0xCF46, 0xCF47, 0xCF48, 0xF3AB, 0xCF49, 0xF3AA, 0xCF4A, 0xCF4B, 0xCF4C, 0xCF4D, 0xC2DD, 0xCF4E, 0xCF4F, 0xF3AE, 0xCF50, 0xCF51,
+	0xF3B0, 0xCF52, 0xCF53, 0xCF54, 0xCF55, 0xCF56, 0xF3A1, 0xCF57, 0xCF58, 0xCF59, 0xF3B1, 0xF3AC, 0xCF5A, 0xCF5B, 0xCF5C, 0xCF5D,
+	0xCF5E, 0xF3AF, 0xF2FE, 0xF3AD, 0xCF5F, 0xCF60, 0xCF61, 0xCF62, 0xCF63, 0xCF64, 0xCF65, 0xF3B2, 0xCF66, 0xCF67, 0xCF68, 0xCF69,
+	0xF3B4, 0xCF6A, 0xCF6B, 0xCF6C, 0xCF6D, 0xF3A8, 0xCF6E, 0xCF6F, 0xCF70, 0xCF71, 0xF3B3, 0xCF72, 0xCF73, 0xCF74, 0xF3B5, 0xCF75,
+	0xCF76, 0xCF77, 0xCF78, 0xCF79, 0xCF7A, 0xCF7B, 0xCF7C, 0xCF7D, 0xCF7E, 0xD0B7, 0xCF80, 0xCF81, 0xCF82, 0xCF83, 0xF3B8, 0xCF84,
+	0xCF85, 0xCF86, 0xCF87, 0xD9F9, 0xCF88, 0xCF89, 0xCF8A, 0xCF8B, 0xCF8C, 0xCF8D, 0xF3B9, 0xCF8E, 0xCF8F, 0xCF90, 0xCF91, 0xCF92,
+	0xCF93, 0xCF94, 0xCF95, 0xF3B7, 0xCF96, 0xC8E4, 0xF3B6, 0xCF97, 0xCF98, 0xCF99, 0xCF9A, 0xF3BA, 0xCF9B, 0xCF9C, 0xCF9D, 0xCF9E,
+	0xCF9F, 0xF3BB, 0xB4C0, 0xCFA0, 0xD040, 0xD041, 0xD042, 0xD043, 0xD044, 0xD045, 0xD046, 0xD047, 0xD048, 0xD049, 0xD04A, 0xD04B,
+	0xD04C, 0xD04D, 0xEEC3, 0xD04E, 0xD04F, 0xD050, 0xD051, 0xD052, 0xD053, 0xF3BC, 0xD054, 0xD055, 0xF3BD, 0xD056, 0xD057, 0xD058,
+	0xD1AA, 0xD059, 0xD05A, 0xD05B, 0xF4AC, 0xD0C6, 0xD05C, 0xD05D, 0xD05E, 0xD05F, 0xD060, 0xD061, 0xD0D0, 0xD1DC, 0xD062, 0xD063,
+	0xD064, 0xD065, 0xD066, 0xD067, 0xCFCE, 0xD068, 0xD069, 0xBDD6, 0xD06A, 0xD1C3, 0xD06B, 0xD06C, 0xD06D, 0xD06E, 0xD06F, 0xD070,
+	0xD071, 0xBAE2, 0xE1E9, 0xD2C2, 0xF1C2, 0xB2B9, 0xD072, 0xD073, 0xB1ED, 0xF1C3, 0xD074, 0xC9C0, 0xB3C4, 0xD075, 0xD9F2, 0xD076,
+	0xCBA5, 0xD077, 0xF1C4, 0xD078, 0xD079, 0xD07A, 0xD07B, 0xD6D4, 0xD07C, 0xD07D, 0xD07E, 0xD080, 0xD081, 0xF1C5, 0xF4C0, 0xF1C6,
+	0xD082, 0xD4AC, 0xF1C7, 0xD083, 0xB0C0, 0xF4C1, 0xD084, 0xD085, 0xF4C2, 0xD086, 0xD087, 0xB4FC, 0xD088, 0xC5DB, 0xD089, 0xD08A,
+	0xD08B, 0xD08C, 0xCCBB, 0xD08D, 0xD08E, 0xD08F, 0xD0E4, 0xD090, 0xD091, 0xD092, 0xD093, 0xD094, 0xCDE0, 0xD095, 0xD096, 0xD097,
+	0xD098, 0xD099, 0xF1C8, 0xD09A, 0xD9F3, 0xD09B, 0xD09C, 0xD09D, 0xD09E, 0xD09F, 0xD0A0, 0xB1BB, 0xD140, 0xCFAE, 0xD141, 0xD142,
+	0xD143, 0xB8A4, 0xD144, 0xD145, 0xD146, 0xD147, 0xD148, 0xF1CA, 0xD149, 0xD14A, 0xD14B, 0xD14C, 0xF1CB, 0xD14D, 0xD14E, 0xD14F,
+	0xD150, 0xB2C3, 0xC1D1, 0xD151, 0xD152, 0xD7B0, 0xF1C9, 0xD153, 0xD154, 0xF1CC, 0xD155, 0xD156, 0xD157, 0xD158, 0xF1CE, 0xD159,
+	0xD15A, 0xD15B, 0xD9F6, 0xD15C, 0xD2E1, 0xD4A3, 0xD15D, 0xD15E, 0xF4C3, 0xC8B9, 0xD15F, 0xD160, 0xD161, 0xD162, 0xD163, 0xF4C4,
+	0xD164, 0xD165, 0xF1CD, 0xF1CF, 0xBFE3, 0xF1D0, 0xD166, 0xD167, 0xF1D4, 0xD168, 0xD169, 0xD16A, 0xD16B, 0xD16C, 0xD16D, 0xD16E,
+	0xF1D6, 0xF1D1, 0xD16F, 0xC9D1, 0xC5E1, 0xD170, 0xD171, 0xD172, 0xC2E3, 0xB9FC, 0xD173, 0xD174, 0xF1D3, 0xD175, 0xF1D5, 0xD176,
+	0xD177, 0xD178, 0xB9D3, 0xD179, 0xD17A, 0xD17B, 0xD17C, 0xD17D, 0xD17E, 0xD180, 0xF1DB, 0xD181, 0xD182, 0xD183, 0xD184, 0xD185,
+	0xBAD6, 0xD186, 0xB0FD, 0xF1D9, 0xD187, 0xD188, 0xD189, 0xD18A, 0xD18B, 0xF1D8, 0xF1D2, 0xF1DA, 0xD18C, 0xD18D, 0xD18E, 0xD18F,
+	0xD190, 0xF1D7, 0xD191, 0xD192, 0xD193, 0xC8EC, 0xD194, 0xD195, 0xD196, 0xD197, 0xCDCA, 0xF1DD, 0xD198, 0xD199, 0xD19A, 0xD19B,
+	0xE5BD, 0xD19C, 0xD19D, 0xD19E, 0xF1DC, 0xD19F, 0xF1DE, 0xD1A0, 0xD240, 0xD241, 0xD242, 0xD243, 0xD244, 0xD245, 0xD246, 0xD247,
+	0xD248, 0xF1DF, 0xD249, 0xD24A, 0xCFE5, 0xD24B, 0xD24C, 0xD24D, 0xD24E, 0xD24F, 0xD250, 0xD251, 0xD252, 0xD253, 0xD254, 0xD255,
+	0xD256, 0xD257, 0xD258, 0xD259, 0xD25A, 0xD25B, 0xD25C, 0xD25D, 0xD25E, 0xD25F, 0xD260, 0xD261, 0xD262, 0xD263, 0xF4C5, 0xBDF3,
+	0xD264, 0xD265, 0xD266, 0xD267, 0xD268, 0xD269, 0xF1E0, 0xD26A, 0xD26B, 0xD26C, 0xD26D, 0xD26E, 0xD26F, 0xD270, 0xD271, 0xD272,
+	0xD273, 0xD274, 0xD275, 0xD276, 0xD277, 0xD278, 0xD279, 0xD27A, 0xD27B, 0xD27C, 0xD27D, 0xF1E1, 0xD27E, 0xD280, 0xD281, 0xCEF7,
+	0xD282, 0xD2AA, 0xD283, 0xF1FB, 0xD284, 0xD285, 0xB8B2, 0xD286, 0xD287, 0xD288, 0xD289, 0xD28A, 0xD28B, 0xD28C, 0xD28D, 0xD28E,
+	0xD28F, 0xD290, 0xD291, 0xD292, 0xD293, 0xD294, 0xD295, 0xD296, 0xD297, 0xD298, 0xD299, 0xD29A, 0xD29B, 0xD29C, 0xD29D, 0xD29E,
+	0xD29F, 0xD2A0, 0xD340, 0xD341, 0xD342, 0xD343, 0xD344, 0xD345, 0xD346, 0xD347, 0xD348, 0xD349, 0xD34A, 0xD34B, 0xD34C, 0xD34D,
+	0xD34E, 0xD34F, 0xD350, 0xD351, 0xD352, 0xD353, 0xD354, 0xD355, 0xD356, 0xD357, 0xD358, 0xD359, 0xD35A, 0xD35B, 0xD35C, 0xD35D,
+	0xD35E, 0xBCFB, 0xB9DB, 0xD35F, 0xB9E6, 0xC3D9, 0xCAD3, 0xEAE8, 0xC0C0, 0xBEF5, 0xEAE9, 0xEAEA, 0xEAEB, 0xD360, 0xEAEC, 0xEAED,
+	0xEAEE, 0xEAEF, 0xBDC7, 0xD361, 0xD362, 0xD363, 0xF5FB, 0xD364, 0xD365, 0xD366, 0xF5FD, 0xD367, 0xF5FE, 0xD368, 0xF5FC, 0xD369,
+	0xD36A, 0xD36B, 0xD36C, 0xBDE2, 0xD36D, 0xF6A1, 0xB4A5, 0xD36E, 0xD36F, 0xD370, 0xD371, 0xF6A2, 0xD372, 0xD373, 0xD374, 0xF6A3,
+	0xD375, 0xD376, 0xD377, 0xECB2, 0xD378, 0xD379, 0xD37A, 0xD37B, 0xD37C, 0xD37D, 0xD37E, 0xD380, 0xD381, 0xD382, 0xD383, 0xD384,
+	0xD1D4, 0xD385, 0xD386, 0xD387, 0xD388, 0xD389, 0xD38A, 0xD9EA, 0xD38B, 0xD38C, 0xD38D, 0xD38E, 0xD38F, 0xD390, 0xD391, 0xD392,
+	0xD393, 0xD394, 0xD395, 0xD396, 0xD397, 0xD398, 0xD399, 0xD39A, 0xD39B, 0xD39C, 0xD39D, 0xD39E, 0xD39F, 0xD3A0, 0xD440, 0xD441,
+	0xD442, 0xD443, 0xD444, 0xD445, 0xD446, 0xD447, 0xD448, 0xD449, 0xD44A, 0xD44B, 0xD44C, 0xD44D, 0xD44E, 0xD44F, 0xD450, 0xD451,
+	0xD452, 0xD453, 0xD454, 0xD455, 0xD456, 0xD457, 0xD458, 0xD459, 0xD45A, 0xD45B, 0xD45C, 0xD45D, 0xD45E, 0xD45F, 0xF6A4, 0xD460,
+	0xD461, 0xD462, 0xD463, 0xD464, 0xD465, 0xD466, 0xD467, 0xD468, 0xEEBA, 0xD469, 0xD46A, 0xD46B, 0xD46C, 0xD46D, 0xD46E, 0xD46F,
+	0xD470, 0xD471, 0xD472, 0xD473, 0xD474, 0xD475, 0xD476, 0xD477, 0xD478, 0xD479, 0xD47A, 0xD47B, 0xD47C, 0xD47D, 0xD47E, 0xD480,
+	0xD481, 0xD482, 0xD483, 0xD484, 0xD485, 0xD486, 0xD487, 0xD488, 0xD489, 0xD48A, 0xD48B, 0xD48C, 0xD48D, 0xD48E, 0xD48F, 0xD490,
+	0xD491, 0xD492, 0xD493, 0xD494, 0xD495, 0xD496, 0xD497, 0xD498, 0xD499, 0xD5B2, 0xD49A, 0xD49B, 0xD49C, 0xD49D, 0xD49E, 0xD49F,
+	0xD4A0, 0xD540, 0xD541, 0xD542, 0xD543, 0xD544, 0xD545, 0xD546, 0xD547, 0xD3FE, 0xCCDC, 0xD548, 0xD549, 0xD54A, 0xD54B, 0xD54C,
+	0xD54D, 0xD54E, 0xD54F, 0xCAC4, 0xD550, 0xD551, 0xD552, 0xD553, 0xD554, 0xD555, 0xD556, 0xD557, 0xD558, 0xD559, 0xD55A, 0xD55B,
+	0xD55C, 0xD55D, 0xD55E, 0xD55F, 0xD560, 0xD561, 0xD562, 0xD563, 0xD564, 0xD565, 0xD566, 0xD567, 0xD568, 0xD569, 0xD56A, 0xD56B,
+	0xD56C, 0xD56D, 0xD56E, 0xD56F, 0xD570, 0xD571, 0xD572, 0xD573, 0xD574, 0xD575, 0xD576, 0xD577, 0xD578, 0xD579, 0xD57A, 0xD57B,
+	0xD57C, 0xD57D, 0xD57E, 0xD580, 0xD581, 0xD582, 0xD583, 0xD584, 0xD585, 0xD586, 0xD587, 0xD588, 0xD589, 0xD58A, 0xD58B, 0xD58C,
+	0xD58D, 0xD58E, 0xD58F, 0xD590, 0xD591, 0xD592, 0xD593, 0xD594, 0xD595, 0xD596, 0xD597, 0xD598, 0xD599, 0xD59A, 0xD59B, 0xD59C,
+	0xD59D, 0xD59E, 0xD59F, 0xD5A0, 0xD640, 0xD641, 0xD642, 0xD643, 0xD644, 0xD645, 0xD646, 0xD647, 0xD648, 0xD649, 0xD64A, 0xD64B,
+	0xD64C, 0xD64D, 0xD64E, 0xD64F, 0xD650, 0xD651, 0xD652, 0xD653, 0xD654, 0xD655, 0xD656, 0xD657, 0xD658, 0xD659, 0xD65A, 0xD65B,
+	0xD65C, 0xD65D, 0xD65E, 0xD65F, 0xD660, 0xD661, 0xD662, 0xE5C0, 0xD663, 0xD664, 0xD665, 0xD666, 0xD667, 0xD668, 0xD669, 0xD66A,
+	0xD66B, 0xD66C, 0xD66D, 0xD66E, 0xD66F, 0xD670, 0xD671, 0xD672, 0xD673, 0xD674, 0xD675, 0xD676, 0xD677, 0xD678, 0xD679, 0xD67A,
+	0xD67B, 0xD67C, 0xD67D, 0xD67E, 0xD680, 0xD681, 0xF6A5, 0xD682, 0xD683, 0xD684, 0xD685, 0xD686, 0xD687, 0xD688, 0xD689, 0xD68A,
+	0xD68B, 0xD68C, 0xD68D, 0xD68E, 0xD68F, 0xD690, 0xD691, 0xD692, 0xD693, 0xD694, 0xD695, 0xD696, 0xD697, 0xD698, 0xD699, 0xD69A,
+	0xD69B, 0xD69C, 0xD69D, 0xD69E, 0xD69F, 0xD6A0, 0xD740, 0xD741, 0xD742, 0xD743, 0xD744, 0xD745, 0xD746, 0xD747, 0xD748, 0xD749,
+	0xD74A, 0xD74B, 0xD74C, 0xD74D, 0xD74E, 0xD74F, 0xD750, 0xD751, 0xD752, 0xD753, 0xD754, 0xD755, 0xD756, 0xD757, 0xD758, 0xD759,
+	0xD75A, 0xD75B, 0xD75C, 0xD75D, 0xD75E, 0xD75F, 0xBEAF, 0xD760, 0xD761, 0xD762, 0xD763, 0xD764, 0xC6A9, 0xD765, 0xD766, 0xD767,
+	0xD768, 0xD769, 0xD76A, 0xD76B, 0xD76C, 0xD76D, 0xD76E, 0xD76F, 0xD770, 0xD771, 0xD772, 0xD773, 0xD774, 0xD775, 0xD776, 0xD777,
+	0xD778, 0xD779, 0xD77A, 0xD77B, 0xD77C, 0xD77D, 0xD77E, 0xD780, 0xD781, 0xD782, 0xD783, 0xD784, 0xD785, 0xD786, 0xD787, 0xD788,
+	0xD789, 0xD78A, 0xD78B, 0xD78C, 0xD78D, 0xD78E, 0xD78F, 0xD790, 0xD791, 0xD792, 0xD793, 0xD794, 0xD795, 0xD796, 0xD797, 0xD798,
+	0xDAA5, 0xBCC6, 0xB6A9, 0xB8BC, 0xC8CF, 0xBCA5, 0xDAA6, 0xDAA7, 0xCCD6, 0xC8C3, 0xDAA8, 0xC6FD, 0xD799, 0xD1B5, 0xD2E9, 0xD1B6,
+	0xBCC7, 0xD79A, 0xBDB2, 0xBBE4, 0xDAA9, 0xDAAA, 0xD1C8, 0xDAAB, 0xD0ED, 0xB6EF, 0xC2DB, 0xD79B, 0xCBCF, 0xB7ED, 0xC9E8, 0xB7C3,
+	0xBEF7, 0xD6A4, 0xDAAC, 0xDAAD, 0xC6C0, 0xD7E7, 0xCAB6, 0xD79C, 0xD5A9, 0xCBDF, 0xD5EF, 0xDAAE, 0xD6DF, 0xB4CA, 0xDAB0, 0xDAAF,
+	0xD79D, 0xD2EB, 0xDAB1, 0xDAB2, 0xDAB3, 0xCAD4, 0xDAB4, 0xCAAB, 0xDAB5, 0xDAB6, 0xB3CF, 0xD6EF, 0xDAB7, 0xBBB0, 0xB5AE, 0xDAB8,
+	0xDAB9, 0xB9EE, 0xD1AF, 0xD2E8, 0xDABA, 0xB8C3, 0xCFEA, 0xB2EF, 0xDABB, 0xDABC, 0xD79E, 0xBDEB, 0xCEDC, 0xD3EF, 0xDABD, 0xCEF3,
+	0xDABE, 0xD3D5, 0xBBE5, 0xDABF, 0xCBB5, 0xCBD0, 0xDAC0, 0xC7EB, 0xD6EE, 0xDAC1, 0xC5B5, 0xB6C1, 0xDAC2, 0xB7CC, 0xBFCE, 0xDAC3,
+	0xDAC4, 0xCBAD, 0xDAC5, 0xB5F7, 0xDAC6, 0xC1C2, 0xD7BB, 0xDAC7, 0xCCB8, 0xD79F, 0xD2EA, 0xC4B1, 0xDAC8, 0xB5FD, 0xBBD1, 0xDAC9,
+	0xD0B3, 0xDACA, 0xDACB, 0xCEBD, 0xDACC, 0xDACD, 0xDACE, 0xB2F7, 0xDAD1, 0xDACF, 0xD1E8, 0xDAD0, 0xC3D5, 0xDAD2, 0xD7A0, 0xDAD3,
+	0xDAD4, 0xDAD5, 0xD0BB, 0xD2A5, 0xB0F9, 0xDAD6, 0xC7AB, 0xDAD7, 0xBDF7, 0xC3A1, 0xDAD8, 0xDAD9, 0xC3FD, 0xCCB7, 0xDADA, 0xDADB,
+	0xC0BE, 0xC6D7, 0xDADC, 0xDADD, 0xC7B4, 0xDADE, 0xDADF, 0xB9C8, 0xD840, 0xD841, 0xD842, 0xD843, 0xD844, 0xD845, 0xD846, 0xD847,
+	0xD848, 0xBBED, 0xD849, 0xD84A, 0xD84B, 0xD84C, 0xB6B9, 0xF4F8, 0xD84D, 0xF4F9, 0xD84E, 0xD84F, 0xCDE3, 0xD850, 0xD851, 0xD852,
+	0xD853, 0xD854, 0xD855, 0xD856, 0xD857, 0xF5B9, 0xD858, 0xD859, 0xD85A, 0xD85B, 0xEBE0, 0xD85C, 0xD85D, 0xD85E, 0xD85F, 0xD860,
+	0xD861, 0xCFF3, 0xBBBF, 0xD862, 0xD863, 0xD864, 0xD865, 0xD866, 0xD867, 0xD868, 0xBAC0, 0xD4A5, 0xD869, 0xD86A, 0xD86B, 0xD86C,
+	0xD86D, 0xD86E, 0xD86F, 0xE1D9, 0xD870, 0xD871, 0xD872, 0xD873, 0xF5F4, 0xB1AA, 0xB2F2, 0xD874, 0xD875, 0xD876, 0xD877, 0xD878,
+	0xD879, 0xD87A, 0xF5F5, 0xD87B, 0xD87C, 0xF5F7, 0xD87D, 0xD87E, 0xD880, 0xBAD1, 0xF5F6, 0xD881, 0xC3B2, 0xD882, 0xD883, 0xD884,
+	0xD885, 0xD886, 0xD887, 0xD888, 0xF5F9, 0xD889, 0xD88A, 0xD88B, 0xF5F8, 0xD88C, 0xD88D, 0xD88E, 0xD88F, 0xD890, 0xD891, 0xD892,
+	0xD893, 0xD894, 0xD895, 0xD896, 0xD897, 0xD898, 0xD899, 0xD89A, 0xD89B, 0xD89C, 0xD89D, 0xD89E, 0xD89F, 0xD8A0, 0xD940, 0xD941,
+	0xD942, 0xD943, 0xD944, 0xD945, 0xD946, 0xD947, 0xD948, 0xD949, 0xD94A, 0xD94B, 0xD94C, 0xD94D, 0xD94E, 0xD94F, 0xD950, 0xD951,
+	0xD952, 0xD953, 0xD954, 0xD955, 0xD956, 0xD957, 0xD958, 0xD959, 0xD95A, 0xD95B, 0xD95C, 0xD95D, 0xD95E, 0xD95F, 0xD960, 0xD961,
+	0xD962, 0xD963, 0xD964, 0xD965, 0xD966, 0xD967, 0xD968, 0xD969, 0xD96A, 0xD96B, 0xD96C, 0xD96D, 0xD96E, 0xD96F, 0xD970, 0xD971,
+	0xD972, 0xD973, 0xD974, 0xD975, 0xD976, 0xD977, 0xD978, 0xD979, 0xD97A, 0xD97B, 0xD97C, 0xD97D, 0xD97E, 0xD980, 0xD981, 0xD982,
+	0xD983, 0xD984, 0xD985, 0xD986, 0xD987, 0xD988, 0xD989, 0xD98A, 0xD98B, 0xD98C, 0xD98D, 0xD98E, 0xD98F, 0xD990, 0xD991, 0xD992,
+	0xD993, 0xD994, 0xD995, 0xD996, 0xD997, 0xD998, 0xD999, 0xD99A, 0xD99B, 0xD99C, 0xD99D, 0xD99E, 0xD99F, 0xD9A0, 0xDA40, 0xDA41,
+	0xDA42, 0xDA43, 0xDA44, 0xDA45, 0xDA46, 0xDA47, 0xDA48, 0xDA49, 0xDA4A, 0xDA4B, 0xDA4C, 0xDA4D, 0xDA4E, 0xB1B4, 0xD5EA, 0xB8BA,
+	0xDA4F, 0xB9B1, 0xB2C6, 0xD4F0, 0xCFCD, 0xB0DC, 0xD5CB, 0xBBF5, 0xD6CA, 0xB7B7, 0xCCB0, 0xC6B6, 0xB1E1, 0xB9BA, 0xD6FC, 0xB9E1,
+	0xB7A1, 0xBCFA, 0xEADA, 0xEADB, 0xCCF9, 0xB9F3, 0xEADC, 0xB4FB, 0xC3B3, 0xB7D1, 0xBAD8, 0xEADD, 0xD4F4, 0xEADE, 0xBCD6, 0xBBDF,
+	0xEADF, 0xC1DE, 0xC2B8, 0xD4DF, 0xD7CA, 0xEAE0, 0xEAE1, 0xEAE4, 0xEAE2, 0xEAE3, 0xC9DE, 0xB8B3, 0xB6C4, 0xEAE5, 0xCAEA, 0xC9CD,
+	0xB4CD, 0xDA50, 0xDA51, 0xE2D9, 0xC5E2, 0xEAE6, 0xC0B5, 0xDA52, 0xD7B8, 0xEAE7, 0xD7AC, 0xC8FC, 0xD8D3, 0xD8CD, 0xD4DE, 0xDA53,
+	0xD4F9, 0xC9C4, 0xD3AE, 0xB8D3, 0xB3E0, 0xDA54, 0xC9E2, 0xF4F6, 0xDA55, 0xDA56, 0xDA57, 0xBAD5, 0xDA58, 0xF4F7, 0xDA59, 0xDA5A,
+	0xD7DF, 0xDA5B, 0xDA5C, 0xF4F1, 0xB8B0, 0xD5D4, 0xB8CF, 0xC6F0, 0xDA5D, 0xDA5E, 0xDA5F, 0xDA60, 0xDA61, 0xDA62, 0xDA63, 0xDA64,
+	0xDA65, 0xB3C3, 0xDA66, 0xDA67, 0xF4F2, 0xB3AC, 0xDA68, 0xDA69, 0xDA6A, 0xDA6B, 0xD4BD, 0xC7F7, 0xDA6C, 0xDA6D, 0xDA6E, 0xDA6F,
+	0xDA70, 0xF4F4, 0xDA71, 0xDA72, 0xF4F3, 0xDA73, 0xDA74, 0xDA75, 0xDA76, 0xDA77, 0xDA78, 0xDA79, 0xDA7A, 0xDA7B, 0xDA7C, 0xCCCB,
+	0xDA7D, 0xDA7E, 0xDA80, 0xC8A4, 0xDA81, 0xDA82, 0xDA83, 0xDA84, 0xDA85, 0xDA86, 0xDA87, 0xDA88, 0xDA89, 0xDA8A, 0xDA8B, 0xDA8C,
+	0xDA8D, 0xF4F5, 0xDA8E, 0xD7E3, 0xC5BF, 0xF5C0, 0xDA8F, 0xDA90, 0xF5BB, 0xDA91, 0xF5C3, 0xDA92, 0xF5C2, 0xDA93, 0xD6BA, 0xF5C1,
+	0xDA94, 0xDA95, 0xDA96, 0xD4BE, 0xF5C4, 0xDA97, 0xF5CC, 0xDA98, 0xDA99, 0xDA9A, 0xDA9B, 0xB0CF, 0xB5F8, 0xDA9C, 0xF5C9, 0xF5CA,
+	0xDA9D, 0xC5DC, 0xDA9E, 0xDA9F, 0xDAA0, 0xDB40, 0xF5C5, 0xF5C6, 0xDB41, 0xDB42, 0xF5C7, 0xF5CB, 0xDB43, 0xBEE0, 0xF5C8, 0xB8FA,
+	0xDB44, 0xDB45, 0xDB46, 0xF5D0, 0xF5D3, 0xDB47, 0xDB48, 0xDB49, 0xBFE7, 0xDB4A, 0xB9F2, 0xF5BC, 0xF5CD, 0xDB4B, 0xDB4C, 0xC2B7,
+	0xDB4D, 0xDB4E, 0xDB4F, 0xCCF8, 0xDB50, 0xBCF9, 0xDB51, 0xF5CE, 0xF5CF, 0xF5D1, 0xB6E5, 0xF5D2, 0xDB52, 0xF5D5, 0xDB53, 0xDB54,
+	0xDB55, 0xDB56, 0xDB57, 0xDB58, 0xDB59, 0xF5BD, 0xDB5A, 0xDB5B, 0xDB5C, 0xF5D4, 0xD3BB, 0xDB5D, 0xB3EC, 0xDB5E, 0xDB5F, 0xCCA4,
+	0xDB60, 0xDB61, 0xDB62, 0xDB63, 0xF5D6, 0xDB64, 0xDB65, 0xDB66, 0xDB67, 0xDB68, 0xDB69, 0xDB6A, 0xDB6B, 0xF5D7, 0xBEE1, 0xF5D8,
+	0xDB6C, 0xDB6D, 0xCCDF, 0xF5DB, 0xDB6E, 0xDB6F, 0xDB70, 0xDB71, 0xDB72, 0xB2C8, 0xD7D9, 0xDB73, 0xF5D9, 0xDB74, 0xF5DA, 0xF5DC,
+	0xDB75, 0xF5E2, 0xDB76, 0xDB77, 0xDB78, 0xF5E0, 0xDB79, 0xDB7A, 0xDB7B, 0xF5DF, 0xF5DD, 0xDB7C, 0xDB7D, 0xF5E1, 0xDB7E, 0xDB80,
+	0xF5DE, 0xF5E4, 0xF5E5, 0xDB81, 0xCCE3, 0xDB82, 0xDB83, 0xE5BF, 0xB5B8, 0xF5E3, 0xF5E8, 0xCCA3, 0xDB84, 0xDB85, 0xDB86, 0xDB87,
+	0xDB88, 0xF5E6, 0xF5E7, 0xDB89, 0xDB8A, 0xDB8B, 0xDB8C, 0xDB8D, 0xDB8E, 0xF5BE, 0xDB8F, 0xDB90, 0xDB91, 0xDB92, 0xDB93, 0xDB94,
+	0xDB95, 0xDB96, 0xDB97, 0xDB98, 0xDB99, 0xDB9A, 0xB1C4, 0xDB9B, 0xDB9C, 0xF5BF, 0xDB9D, 0xDB9E, 0xB5C5, 0xB2E4, 0xDB9F, 0xF5EC,
+	0xF5E9, 0xDBA0, 0xB6D7, 0xDC40, 0xF5ED, 0xDC41, 0xF5EA, 0xDC42, 0xDC43, 0xDC44, 0xDC45, 0xDC46, 0xF5EB, 0xDC47, 0xDC48, 0xB4DA,
+	0xDC49, 0xD4EA, 0xDC4A, 0xDC4B, 0xDC4C, 0xF5EE, 0xDC4D, 0xB3F9, 0xDC4E, 0xDC4F, 0xDC50, 0xDC51, 0xDC52, 0xDC53, 0xDC54, 0xF5EF,
+	0xF5F1, 0xDC55, 0xDC56, 0xDC57, 0xF5F0, 0xDC58, 0xDC59, 0xDC5A, 0xDC5B, 0xDC5C, 0xDC5D, 0xDC5E, 0xF5F2, 0xDC5F, 0xF5F3, 0xDC60,
+	0xDC61, 0xDC62, 0xDC63, 0xDC64, 0xDC65, 0xDC66, 0xDC67, 0xDC68, 0xDC69, 0xDC6A, 0xDC6B, 0xC9ED, 0xB9AA, 0xDC6C, 0xDC6D, 0xC7FB,
+	0xDC6E, 0xDC6F, 0xB6E3, 0xDC70, 0xDC71, 0xDC72, 0xDC73, 0xDC74, 0xDC75, 0xDC76, 0xCCC9, 0xDC77, 0xDC78, 0xDC79, 0xDC7A, 0xDC7B,
+	0xDC7C, 0xDC7D, 0xDC7E, 0xDC80, 0xDC81, 0xDC82, 0xDC83, 0xDC84, 0xDC85, 0xDC86, 0xDC87, 0xDC88, 0xDC89, 0xDC8A, 0xEAA6, 0xDC8B,
+	0xDC8C, 0xDC8D, 0xDC8E, 0xDC8F, 0xDC90, 0xDC91, 0xDC92, 0xDC93, 0xDC94, 0xDC95, 0xDC96, 0xDC97, 0xDC98, 0xDC99, 0xDC9A, 0xDC9B,
+	0xDC9C, 0xDC9D, 0xDC9E, 0xDC9F, 0xDCA0, 0xDD40, 0xDD41, 0xDD42, 0xDD43, 0xDD44, 0xDD45, 0xDD46, 0xDD47, 0xDD48, 0xDD49, 0xDD4A,
+	0xDD4B, 0xDD4C, 0xDD4D, 0xDD4E, 0xDD4F, 0xDD50, 0xDD51, 0xDD52, 0xDD53, 0xDD54, 0xDD55, 0xDD56, 0xDD57, 0xDD58, 0xDD59, 0xDD5A,
+	0xDD5B, 0xDD5C, 0xDD5D, 0xDD5E, 0xDD5F, 0xDD60, 0xDD61, 0xDD62, 0xDD63, 0xDD64, 0xDD65, 0xDD66, 0xDD67, 0xDD68, 0xDD69, 0xDD6A,
+	0xDD6B, 0xDD6C, 0xDD6D, 0xDD6E, 0xDD6F, 0xDD70, 0xDD71, 0xDD72, 0xDD73, 0xDD74, 0xDD75, 0xDD76, 0xDD77, 0xDD78, 0xDD79, 0xDD7A,
+	0xDD7B, 0xDD7C, 0xDD7D, 0xDD7E, 0xDD80, 0xDD81, 0xDD82, 0xDD83, 0xDD84, 0xDD85, 0xDD86, 0xDD87, 0xDD88, 0xDD89, 0xDD8A, 0xDD8B,
+	0xDD8C, 0xDD8D, 0xDD8E, 0xDD8F, 0xDD90, 0xDD91, 0xDD92, 0xDD93, 0xDD94, 0xDD95, 0xDD96, 0xDD97, 0xDD98, 0xDD99, 0xDD9A, 0xDD9B,
+	0xDD9C, 0xDD9D, 0xDD9E, 0xDD9F, 0xDDA0, 0xDE40, 0xDE41, 0xDE42, 0xDE43, 0xDE44, 0xDE45, 0xDE46, 0xDE47, 0xDE48, 0xDE49, 0xDE4A,
+	0xDE4B, 0xDE4C, 0xDE4D, 0xDE4E, 0xDE4F, 0xDE50, 0xDE51, 0xDE52, 0xDE53, 0xDE54, 0xDE55, 0xDE56, 0xDE57, 0xDE58, 0xDE59, 0xDE5A,
+	0xDE5B, 0xDE5C, 0xDE5D, 0xDE5E, 0xDE5F, 0xDE60, 0xB3B5, 0xD4FE, 0xB9EC, 0xD0F9, 0xDE61, 0xE9ED, 0xD7AA, 0xE9EE, 0xC2D6, 0xC8ED,
+	0xBAE4, 0xE9EF, 0xE9F0, 0xE9F1, 0xD6E1, 0xE9F2, 0xE9F3, 0xE9F5, 0xE9F4, 0xE9F6, 0xE9F7, 0xC7E1, 0xE9F8, 0xD4D8, 0xE9F9, 0xBDCE,
+	0xDE62, 0xE9FA, 0xE9FB, 0xBDCF, 0xE9FC, 0xB8A8, 0xC1BE, 0xE9FD, 0xB1B2, 0xBBD4, 0xB9F5, 0xE9FE, 0xDE63, 0xEAA1, 0xEAA2, 0xEAA3,
+	0xB7F8, 0xBCAD, 0xDE64, 0xCAE4, 0xE0CE, 0xD4AF, 0xCFBD, 0xD5B7, 0xEAA4, 0xD5DE, 0xEAA5, 0xD0C1, 0xB9BC, 0xDE65, 0xB4C7, 0xB1D9,
+	0xDE66, 0xDE67, 0xDE68, 0xC0B1, 0xDE69, 0xDE6A, 0xDE6B, 0xDE6C, 0xB1E6, 0xB1E7, 0xDE6D, 0xB1E8, 0xDE6E, 0xDE6F, 0xDE70, 0xDE71,
+	0xB3BD, 0xC8E8, 0xDE72, 0xDE73, 0xDE74, 0xDE75, 0xE5C1, 0xDE76, 0xDE77, 0xB1DF, 0xDE78, 0xDE79, 0xDE7A, 0xC1C9, 0xB4EF, 0xDE7B,
+	0xDE7C, 0xC7A8, 0xD3D8, 0xDE7D, 0xC6F9, 0xD1B8, 0xDE7E, 0xB9FD, 0xC2F5, 0xDE80, 0xDE81, 0xDE82, 0xDE83, 0xDE84, 0xD3AD, 0xDE85,
+	0xD4CB, 0xBDFC, 0xDE86, 0xE5C2, 0xB7B5, 0xE5C3, 0xDE87, 0xDE88, 0xBBB9, 0xD5E2, 0xDE89, 0xBDF8, 0xD4B6, 0xCEA5, 0xC1AC, 0xB3D9,
+	0xDE8A, 0xDE8B, 0xCCF6, 0xDE8C, 0xE5C6, 0xE5C4, 0xE5C8, 0xDE8D, 0xE5CA, 0xE5C7, 0xB5CF, 0xC6C8, 0xDE8E, 0xB5FC, 0xE5C5, 0xDE8F,
+	0xCAF6, 0xDE90, 0xDE91, 0xE5C9, 0xDE92, 0xDE93, 0xDE94, 0xC3D4, 0xB1C5, 0xBCA3, 0xDE95, 0xDE96, 0xDE97, 0xD7B7, 0xDE98, 0xDE99,
+	0xCDCB, 0xCBCD, 0xCACA, 0xCCD3, 0xE5CC, 0xE5CB, 0xC4E6, 0xDE9A, 0xDE9B, 0xD1A1, 0xD1B7, 0xE5CD, 0xDE9C, 0xE5D0, 0xDE9D, 0xCDB8,
+	0xD6F0, 0xE5CF, 0xB5DD, 0xDE9E, 0xCDBE, 0xDE9F, 0xE5D1, 0xB6BA, 0xDEA0, 0xDF40, 0xCDA8, 0xB9E4, 0xDF41, 0xCAC5, 0xB3D1, 0xCBD9,
+	0xD4EC, 0xE5D2, 0xB7EA, 0xDF42, 0xDF43, 0xDF44, 0xE5CE, 0xDF45, 0xDF46, 0xDF47, 0xDF48, 0xDF49, 0xDF4A, 0xE5D5, 0xB4FE, 0xE5D6,
+	0xDF4B, 0xDF4C, 0xDF4D, 0xDF4E, 0xDF4F, 0xE5D3, 0xE5D4, 0xDF50, 0xD2DD, 0xDF51, 0xDF52, 0xC2DF, 0xB1C6, 0xDF53, 0xD3E2, 0xDF54,
+	0xDF55, 0xB6DD, 0xCBEC, 0xDF56, 0xE5D7, 0xDF57, 0xDF58, 0xD3F6, 0xDF59, 0xDF5A, 0xDF5B, 0xDF5C, 0xDF5D, 0xB1E9, 0xDF5E, 0xB6F4,
+	0xE5DA, 0xE5D8, 0xE5D9, 0xB5C0, 0xDF5F, 0xDF60, 0xDF61, 0xD2C5, 0xE5DC, 0xDF62, 0xDF63, 0xE5DE, 0xDF64, 0xDF65, 0xDF66, 0xDF67,
+	0xDF68, 0xDF69, 0xE5DD, 0xC7B2, 0xDF6A, 0xD2A3, 0xDF6B, 0xDF6C, 0xE5DB, 0xDF6D, 0xDF6E, 0xDF6F, 0xDF70, 0xD4E2, 0xD5DA, 0xDF71,
+	0xDF72, 0xDF73, 0xDF74, 0xDF75, 0xE5E0, 0xD7F1, 0xDF76, 0xDF77, 0xDF78, 0xDF79, 0xDF7A, 0xDF7B, 0xDF7C, 0xE5E1, 0xDF7D, 0xB1DC,
+	0xD1FB, 0xDF7E, 0xE5E2, 0xE5E4, 0xDF80, 0xDF81, 0xDF82, 0xDF83, 0xE5E3, 0xDF84, 0xDF85, 0xE5E5, 0xDF86, 0xDF87, 0xDF88, 0xDF89,
+	0xDF8A, 0xD2D8, 0xDF8B, 0xB5CB, 0xDF8C, 0xE7DF, 0xDF8D, 0xDAF5, 0xDF8E, 0xDAF8, 0xDF8F, 0xDAF6, 0xDF90, 0xDAF7, 0xDF91, 0xDF92,
+	0xDF93, 0xDAFA, 0xD0CF, 0xC4C7, 0xDF94, 0xDF95, 0xB0EE, 0xDF96, 0xDF97, 0xDF98, 0xD0B0, 0xDF99, 0xDAF9, 0xDF9A, 0xD3CA, 0xBAAA,
+	0xDBA2, 0xC7F1, 0xDF9B, 0xDAFC, 0xDAFB, 0xC9DB, 0xDAFD, 0xDF9C, 0xDBA1, 0xD7DE, 0xDAFE, 0xC1DA, 0xDF9D, 0xDF9E, 0xDBA5, 0xDF9F,
+	0xDFA0, 0xD3F4, 0xE040, 0xE041, 0xDBA7, 0xDBA4, 0xE042, 0xDBA8, 0xE043, 0xE044, 0xBDBC, 0xE045, 0xE046, 0xE047, 0xC0C9, 0xDBA3,
+	0xDBA6, 0xD6A3, 0xE048, 0xDBA9, 0xE049, 0xE04A, 0xE04B, 0xDBAD, 0xE04C, 0xE04D, 0xE04E, 0xDBAE, 0xDBAC, 0xBAC2, 0xE04F, 0xE050,
+	0xE051, 0xBFA4, 0xDBAB, 0xE052, 0xE053, 0xE054, 0xDBAA, 0xD4C7, 0xB2BF, 0xE055, 0xE056, 0xDBAF, 0xE057, 0xB9F9, 0xE058, 0xDBB0,
+	0xE059, 0xE05A, 0xE05B, 0xE05C, 0xB3BB, 0xE05D, 0xE05E, 0xE05F, 0xB5A6, 0xE060, 0xE061, 0xE062, 0xE063, 0xB6BC, 0xDBB1, 0xE064,
+	0xE065, 0xE066, 0xB6F5, 0xE067, 0xDBB2, 0xE068, 0xE069, 0xE06A, 0xE06B, 0xE06C, 0xE06D, 0xE06E, 0xE06F, 0xE070, 0xE071, 0xE072,
+	0xE073, 0xE074, 0xE075, 0xE076, 0xE077, 0xE078, 0xE079, 0xE07A, 0xE07B, 0xB1C9, 0xE07C, 0xE07D, 0xE07E, 0xE080, 0xDBB4, 0xE081,
+	0xE082, 0xE083, 0xDBB3, 0xDBB5, 0xE084, 0xE085, 0xE086, 0xE087, 0xE088, 0xE089, 0xE08A, 0xE08B, 0xE08C, 0xE08D, 0xE08E, 0xDBB7,
+	0xE08F, 0xDBB6, 0xE090, 0xE091, 0xE092, 0xE093, 0xE094, 0xE095, 0xE096, 0xDBB8, 0xE097, 0xE098, 0xE099, 0xE09A, 0xE09B, 0xE09C,
+	0xE09D, 0xE09E, 0xE09F, 0xDBB9, 0xE0A0, 0xE140, 0xDBBA, 0xE141, 0xE142, 0xD3CF, 0xF4FA, 0xC7F5, 0xD7C3, 0xC5E4, 0xF4FC, 0xF4FD,
+	0xF4FB, 0xE143, 0xBEC6, 0xE144, 0xE145, 0xE146, 0xE147, 0xD0EF, 0xE148, 0xE149, 0xB7D3, 0xE14A, 0xE14B, 0xD4CD, 0xCCAA, 0xE14C,
+	0xE14D, 0xF5A2, 0xF5A1, 0xBAA8, 0xF4FE, 0xCBD6, 0xE14E, 0xE14F, 0xE150, 0xF5A4, 0xC0D2, 0xE151, 0xB3EA, 0xE152, 0xCDAA, 0xF5A5,
+	0xF5A3, 0xBDB4, 0xF5A8, 0xE153, 0xF5A9, 0xBDCD, 0xC3B8, 0xBFE1, 0xCBE1, 0xF5AA, 0xE154, 0xE155, 0xE156, 0xF5A6, 0xF5A7, 0xC4F0,
+	0xE157, 0xE158, 0xE159, 0xE15A, 0xE15B, 0xF5AC, 0xE15C, 0xB4BC, 0xE15D, 0xD7ED, 0xE15E, 0xB4D7, 0xF5AB, 0xF5AE, 0xE15F, 0xE160,
+	0xF5AD, 0xF5AF, 0xD0D1, 0xE161, 0xE162, 0xE163, 0xE164, 0xE165, 0xE166, 0xE167, 0xC3D1, 0xC8A9, 0xE168, 0xE169, 0xE16A, 0xE16B,
+	0xE16C, 0xE16D, 0xF5B0, 0xF5B1, 0xE16E, 0xE16F, 0xE170, 0xE171, 0xE172, 0xE173, 0xF5B2, 0xE174, 0xE175, 0xF5B3, 0xF5B4, 0xF5B5,
+	0xE176, 0xE177, 0xE178, 0xE179, 0xF5B7, 0xF5B6, 0xE17A, 0xE17B, 0xE17C, 0xE17D, 0xF5B8, 0xE17E, 0xE180, 0xE181, 0xE182, 0xE183,
+	0xE184, 0xE185, 0xE186, 0xE187, 0xE188, 0xE189, 0xE18A, 0xB2C9, 0xE18B, 0xD3D4, 0xCACD, 0xE18C, 0xC0EF, 0xD6D8, 0xD2B0, 0xC1BF,
+	0xE18D, 0xBDF0, 0xE18E, 0xE18F, 0xE190, 0xE191, 0xE192, 0xE193, 0xE194, 0xE195, 0xE196, 0xE197, 0xB8AA, 0xE198, 0xE199, 0xE19A,
+	0xE19B, 0xE19C, 0xE19D, 0xE19E, 0xE19F, 0xE1A0, 0xE240, 0xE241, 0xE242, 0xE243, 0xE244, 0xE245, 0xE246, 0xE247, 0xE248, 0xE249,
+	0xE24A, 0xE24B, 0xE24C, 0xE24D, 0xE24E, 0xE24F, 0xE250, 0xE251, 0xE252, 0xE253, 0xE254, 0xE255, 0xE256, 0xE257, 0xE258, 0xE259,
+	0xE25A, 0xE25B, 0xE25C, 0xE25D, 0xE25E, 0xE25F, 0xE260, 0xE261, 0xE262, 0xE263, 0xE264, 0xE265, 0xE266, 0xE267, 0xE268, 0xE269,
+	0xE26A, 0xE26B, 0xE26C, 0xE26D, 0xE26E, 0xE26F, 0xE270, 0xE271, 0xE272, 0xE273, 0xE274, 0xE275, 0xE276, 0xE277, 0xE278, 0xE279,
+	0xE27A, 0xE27B, 0xE27C, 0xE27D, 0xE27E, 0xE280, 0xE281, 0xE282, 0xE283, 0xE284, 0xE285, 0xE286, 0xE287, 0xE288, 0xE289, 0xE28A,
+	0xE28B, 0xE28C, 0xE28D, 0xE28E, 0xE28F, 0xE290, 0xE291, 0xE292, 0xE293, 0xE294, 0xE295, 0xE296, 0xE297, 0xE298, 0xE299, 0xE29A,
+	0xE29B, 0xE29C, 0xE29D, 0xE29E, 0xE29F, 0xE2A0, 0xE340, 0xE341, 0xE342, 0xE343, 0xE344, 0xE345, 0xE346, 0xE347, 0xE348, 0xE349,
+	0xE34A, 0xE34B, 0xE34C, 0xE34D, 0xE34E, 0xE34F, 0xE350, 0xE351, 0xE352, 0xE353, 0xE354, 0xE355, 0xE356, 0xE357, 0xE358, 0xE359,
+	0xE35A, 0xE35B, 0xE35C, 0xE35D, 0xE35E, 0xE35F, 0xE360, 0xE361, 0xE362, 0xE363, 0xE364, 0xE365, 0xE366, 0xE367, 0xE368, 0xE369,
+	0xE36A, 0xE36B, 0xE36C, 0xE36D, 0xBCF8, 0xE36E, 0xE36F, 0xE370, 0xE371, 0xE372, 0xE373, 0xE374, 0xE375, 0xE376, 0xE377, 0xE378,
+	0xE379, 0xE37A, 0xE37B, 0xE37C, 0xE37D, 0xE37E, 0xE380, 0xE381, 0xE382, 0xE383, 0xE384, 0xE385, 0xE386, 0xE387, 0xF6C6, 0xE388,
+	0xE389, 0xE38A, 0xE38B, 0xE38C, 0xE38D, 0xE38E, 0xE38F, 0xE390, 0xE391, 0xE392, 0xE393, 0xE394, 0xE395, 0xE396, 0xE397, 0xE398,
+	0xE399, 0xE39A, 0xE39B, 0xE39C, 0xE39D, 0xE39E, 0xE39F, 0xE3A0, 0xE440, 0xE441, 0xE442, 0xE443, 0xE444, 0xE445, 0xF6C7, 0xE446,
+	0xE447, 0xE448, 0xE449, 0xE44A, 0xE44B, 0xE44C, 0xE44D, 0xE44E, 0xE44F, 0xE450, 0xE451, 0xE452, 0xE453, 0xE454, 0xE455, 0xE456,
+	0xE457, 0xE458, 0xE459, 0xE45A, 0xE45B, 0xE45C, 0xE45D, 0xE45E, 0xF6C8, 0xE45F, 0xE460, 0xE461, 0xE462, 0xE463, 0xE464, 0xE465,
+	0xE466, 0xE467, 0xE468, 0xE469, 0xE46A, 0xE46B, 0xE46C, 0xE46D, 0xE46E, 0xE46F, 0xE470, 0xE471, 0xE472, 0xE473, 0xE474, 0xE475,
+	0xE476, 0xE477, 0xE478, 0xE479, 0xE47A, 0xE47B, 0xE47C, 0xE47D, 0xE47E, 0xE480, 0xE481, 0xE482, 0xE483, 0xE484, 0xE485, 0xE486,
+	0xE487, 0xE488, 0xE489, 0xE48A, 0xE48B, 0xE48C, 0xE48D, 0xE48E, 0xE48F, 0xE490, 0xE491, 0xE492, 0xE493, 0xE494, 0xE495, 0xE496,
+	0xE497, 0xE498, 0xE499, 0xE49A, 0xE49B, 0xE49C, 0xE49D, 0xE49E, 0xE49F, 0xE4A0, 0xE540, 0xE541, 0xE542, 0xE543, 0xE544, 0xE545,
+	0xE546, 0xE547, 0xE548, 0xE549, 0xE54A, 0xE54B, 0xE54C, 0xE54D, 0xE54E, 0xE54F, 0xE550, 0xE551, 0xE552, 0xE553, 0xE554, 0xE555,
+	0xE556, 0xE557, 0xE558, 0xE559, 0xE55A, 0xE55B, 0xE55C, 0xE55D, 0xE55E, 0xE55F, 0xE560, 0xE561, 0xE562, 0xE563, 0xE564, 0xE565,
+	0xE566, 0xE567, 0xE568, 0xE569, 0xE56A, 0xE56B, 0xE56C, 0xE56D, 0xE56E, 0xE56F, 0xE570, 0xE571, 0xE572, 0xE573, 0xF6C9, 0xE574,
+	0xE575, 0xE576, 0xE577, 0xE578, 0xE579, 0xE57A, 0xE57B, 0xE57C, 0xE57D, 0xE57E, 0xE580, 0xE581, 0xE582, 0xE583, 0xE584, 0xE585,
+	0xE586, 0xE587, 0xE588, 0xE589, 0xE58A, 0xE58B, 0xE58C, 0xE58D, 0xE58E, 0xE58F, 0xE590, 0xE591, 0xE592, 0xE593, 0xE594, 0xE595,
+	0xE596, 0xE597, 0xE598, 0xE599, 0xE59A, 0xE59B, 0xE59C, 0xE59D, 0xE59E, 0xE59F, 0xF6CA, 0xE5A0, 0xE640, 0xE641, 0xE642, 0xE643,
+	0xE644, 0xE645, 0xE646, 0xE647, 0xE648, 0xE649, 0xE64A, 0xE64B, 0xE64C, 0xE64D, 0xE64E, 0xE64F, 0xE650, 0xE651, 0xE652, 0xE653,
+	0xE654, 0xE655, 0xE656, 0xE657, 0xE658, 0xE659, 0xE65A, 0xE65B, 0xE65C, 0xE65D, 0xE65E, 0xE65F, 0xE660, 0xE661, 0xE662, 0xF6CC,
+	0xE663, 0xE664, 0xE665, 0xE666, 0xE667, 0xE668, 0xE669, 0xE66A, 0xE66B, 0xE66C, 0xE66D, 0xE66E, 0xE66F, 0xE670, 0xE671, 0xE672,
+	0xE673, 0xE674, 0xE675, 0xE676, 0xE677, 0xE678, 0xE679, 0xE67A, 0xE67B, 0xE67C, 0xE67D, 0xE67E, 0xE680, 0xE681, 0xE682, 0xE683,
+	0xE684, 0xE685, 0xE686, 0xE687, 0xE688, 0xE689, 0xE68A, 0xE68B, 0xE68C, 0xE68D, 0xE68E, 0xE68F, 0xE690, 0xE691, 0xE692, 0xE693,
+	0xE694, 0xE695, 0xE696, 0xE697, 0xE698, 0xE699, 0xE69A, 0xE69B, 0xE69C, 0xE69D, 0xF6CB, 0xE69E, 0xE69F, 0xE6A0, 0xE740, 0xE741,
+	0xE742, 0xE743, 0xE744, 0xE745, 0xE746, 0xE747, 0xF7E9, 0xE748, 0xE749, 0xE74A, 0xE74B, 0xE74C, 0xE74D, 0xE74E, 0xE74F, 0xE750,
+	0xE751, 0xE752, 0xE753, 0xE754, 0xE755, 0xE756, 0xE757, 0xE758, 0xE759, 0xE75A, 0xE75B, 0xE75C, 0xE75D, 0xE75E, 0xE75F, 0xE760,
+	0xE761, 0xE762, 0xE763, 0xE764, 0xE765, 0xE766, 0xE767, 0xE768, 0xE769, 0xE76A, 0xE76B, 0xE76C, 0xE76D, 0xE76E, 0xE76F, 0xE770,
+	0xE771, 0xE772, 0xE773, 0xE774, 0xE775, 0xE776, 0xE777, 0xE778, 0xE779, 0xE77A, 0xE77B, 0xE77C, 0xE77D, 0xE77E, 0xE780, 0xE781,
+	0xE782, 0xE783, 0xE784, 0xE785, 0xE786, 0xE787, 0xE788, 0xE789, 0xE78A, 0xE78B, 0xE78C, 0xE78D, 0xE78E, 0xE78F, 0xE790, 0xE791,
+	0xE792, 0xE793, 0xE794, 0xE795, 0xE796, 0xE797, 0xE798, 0xE799, 0xE79A, 0xE79B, 0xE79C, 0xE79D, 0xE79E, 0xE79F, 0xE7A0, 0xE840,
+	0xE841, 0xE842, 0xE843, 0xE844, 0xE845, 0xE846, 0xE847, 0xE848, 0xE849, 0xE84A, 0xE84B, 0xE84C, 0xE84D, 0xE84E, 0xF6CD, 0xE84F,
+	0xE850, 0xE851, 0xE852, 0xE853, 0xE854, 0xE855, 0xE856, 0xE857, 0xE858, 0xE859, 0xE85A, 0xE85B, 0xE85C, 0xE85D, 0xE85E, 0xE85F,
+	0xE860, 0xE861, 0xE862, 0xE863, 0xE864, 0xE865, 0xE866, 0xE867, 0xE868, 0xE869, 0xE86A, 0xE86B, 0xE86C, 0xE86D, 0xE86E, 0xE86F,
+	0xE870, 0xE871, 0xE872, 0xE873, 0xE874, 0xE875, 0xE876, 0xE877, 0xE878, 0xE879, 0xE87A, 0xF6CE, 0xE87B, 0xE87C, 0xE87D, 0xE87E,
+	0xE880, 0xE881, 0xE882, 0xE883, 0xE884, 0xE885, 0xE886, 0xE887, 0xE888, 0xE889, 0xE88A, 0xE88B, 0xE88C, 0xE88D, 0xE88E, 0xE88F,
+	0xE890, 0xE891, 0xE892, 0xE893, 0xE894, 0xEEC4, 0xEEC5, 0xEEC6, 0xD5EB, 0xB6A4, 0xEEC8, 0xEEC7, 0xEEC9, 0xEECA, 0xC7A5, 0xEECB,
+	0xEECC, 0xE895, 0xB7B0, 0xB5F6, 0xEECD, 0xEECF, 0xE896, 0xEECE, 0xE897, 0xB8C6, 0xEED0, 0xEED1, 0xEED2, 0xB6DB, 0xB3AE, 0xD6D3,
+	0xC4C6, 0xB1B5, 0xB8D6, 0xEED3, 0xEED4, 0xD4BF, 0xC7D5, 0xBEFB, 0xCED9, 0xB9B3, 0xEED6, 0xEED5, 0xEED8, 0xEED7, 0xC5A5, 0xEED9,
+	0xEEDA, 0xC7AE, 0xEEDB, 0xC7AF, 0xEEDC, 0xB2A7, 0xEEDD, 0xEEDE, 0xEEDF, 0xEEE0, 0xEEE1, 0xD7EA, 0xEEE2, 0xEEE3, 0xBCD8, 0xEEE4,
+	0xD3CB, 0xCCFA, 0xB2AC, 0xC1E5, 0xEEE5, 0xC7A6, 0xC3AD, 0xE898, 0xEEE6, 0xEEE7, 0xEEE8, 0xEEE9, 0xEEEA, 0xEEEB, 0xEEEC, 0xE899,
+	0xEEED, 0xEEEE, 0xEEEF, 0xE89A, 0xE89B, 0xEEF0, 0xEEF1, 0xEEF2, 0xEEF4, 0xEEF3, 0xE89C, 0xEEF5, 0xCDAD, 0xC2C1, 0xEEF6, 0xEEF7,
+	0xEEF8, 0xD5A1, 0xEEF9, 0xCFB3, 0xEEFA, 0xEEFB, 0xE89D, 0xEEFC, 0xEEFD, 0xEFA1, 0xEEFE, 0xEFA2, 0xB8F5, 0xC3FA, 0xEFA3, 0xEFA4,
+	0xBDC2, 0xD2BF, 0xB2F9, 0xEFA5, 0xEFA6, 0xEFA7, 0xD2F8, 0xEFA8, 0xD6FD, 0xEFA9, 0xC6CC, 0xE89E, 0xEFAA, 0xEFAB, 0xC1B4, 0xEFAC,
+	0xCFFA, 0xCBF8, 0xEFAE, 0xEFAD, 0xB3FA, 0xB9F8, 0xEFAF, 0xEFB0, 0xD0E2, 0xEFB1, 0xEFB2, 0xB7E6, 0xD0BF, 0xEFB3, 0xEFB4, 0xEFB5,
+	0xC8F1, 0xCCE0, 0xEFB6, 0xEFB7, 0xEFB8, 0xEFB9, 0xEFBA, 0xD5E0, 0xEFBB, 0xB4ED, 0xC3AA, 0xEFBC, 0xE89F, 0xEFBD, 0xEFBE, 0xEFBF,
+	0xE8A0, 0xCEFD, 0xEFC0, 0xC2E0, 0xB4B8, 0xD7B6, 0xBDF5, 0xE940, 0xCFC7, 0xEFC3, 0xEFC1, 0xEFC2, 0xEFC4, 0xB6A7, 0xBCFC, 0xBEE2,
+	0xC3CC, 0xEFC5, 0xEFC6, 0xE941, 0xEFC7, 0xEFCF, 0xEFC8, 0xEFC9, 0xEFCA, 0xC7C2, 0xEFF1, 0xB6CD, 0xEFCB, 0xE942, 0xEFCC, 0xEFCD,
+	0xB6C6, 0xC3BE, 0xEFCE, 0xE943, 0xEFD0, 0xEFD1, 0xEFD2, 0xD5F2, 0xE944, 0xEFD3, 0xC4F7, 0xE945, 0xEFD4, 0xC4F8, 0xEFD5, 0xEFD6,
+	0xB8E4, 0xB0F7, 0xEFD7, 0xEFD8, 0xEFD9, 0xE946, 0xEFDA, 0xEFDB, 0xEFDC, 0xEFDD, 0xE947, 0xEFDE, 0xBEB5, 0xEFE1, 0xEFDF, 0xEFE0,
+	0xE948, 0xEFE2, 0xEFE3, 0xC1CD, 0xEFE4, 0xEFE5, 0xEFE6, 0xEFE7, 0xEFE8, 0xEFE9, 0xEFEA, 0xEFEB, 0xEFEC, 0xC0D8, 0xE949, 0xEFED,
+	0xC1AD, 0xEFEE, 0xEFEF, 0xEFF0, 0xE94A, 0xE94B, 0xCFE2, 0xE94C, 0xE94D, 0xE94E, 0xE94F, 0xE950, 0xE951, 0xE952, 0xE953, 0xB3A4,
+	0xE954, 0xE955, 0xE956, 0xE957, 0xE958, 0xE959, 0xE95A, 0xE95B, 0xE95C, 0xE95D, 0xE95E, 0xE95F, 0xE960, 0xE961, 0xE962, 0xE963,
+	0xE964, 0xE965, 0xE966, 0xE967, 0xE968, 0xE969, 0xE96A, 0xE96B, 0xE96C, 0xE96D, 0xE96E, 0xE96F, 0xE970, 0xE971, 0xE972, 0xE973,
+	0xE974, 0xE975, 0xE976, 0xE977, 0xE978, 0xE979, 0xE97A, 0xE97B, 0xE97C, 0xE97D, 0xE97E, 0xE980, 0xE981, 0xE982, 0xE983, 0xE984,
+	0xE985, 0xE986, 0xE987, 0xE988, 0xE989, 0xE98A, 0xE98B, 0xE98C, 0xE98D, 0xE98E, 0xE98F, 0xE990, 0xE991, 0xE992, 0xE993, 0xE994,
+	0xE995, 0xE996, 0xE997, 0xE998, 0xE999, 0xE99A, 0xE99B, 0xE99C, 0xE99D, 0xE99E, 0xE99F, 0xE9A0, 0xEA40, 0xEA41, 0xEA42, 0xEA43,
+	0xEA44, 0xEA45, 0xEA46, 0xEA47, 0xEA48, 0xEA49, 0xEA4A, 0xEA4B, 0xEA4C, 0xEA4D, 0xEA4E, 0xEA4F, 0xEA50, 0xEA51, 0xEA52, 0xEA53,
+	0xEA54, 0xEA55, 0xEA56, 0xEA57, 0xEA58, 0xEA59, 0xEA5A, 0xEA5B, 0xC3C5, 0xE3C5, 0xC9C1, 0xE3C6, 0xEA5C, 0xB1D5, 0xCECA, 0xB4B3,
+	0xC8F2, 0xE3C7, 0xCFD0, 0xE3C8, 0xBCE4, 0xE3C9, 0xE3CA, 0xC3C6, 0xD5A2, 0xC4D6, 0xB9EB, 0xCEC5, 0xE3CB, 0xC3F6, 0xE3CC, 0xEA5D,
+	0xB7A7, 0xB8F3, 0xBAD2, 0xE3CD, 0xE3CE, 0xD4C4, 0xE3CF, 0xEA5E, 0xE3D0, 0xD1CB, 0xE3D1, 0xE3D2, 0xE3D3, 0xE3D4, 0xD1D6, 0xE3D5,
+	0xB2FB, 0xC0BB, 0xE3D6, 0xEA5F, 0xC0AB, 0xE3D7, 0xE3D8, 0xE3D9, 0xEA60, 0xE3DA, 0xE3DB, 0xEA61, 0xB8B7, 0xDAE2, 0xEA62, 0xB6D3,
+	0xEA63, 0xDAE4, 0xDAE3, 0xEA64, 0xEA65, 0xEA66, 0xEA67, 0xEA68, 0xEA69, 0xEA6A, 0xDAE6, 0xEA6B, 0xEA6C, 0xEA6D, 0xC8EE, 0xEA6E,
+	0xEA6F, 0xDAE5, 0xB7C0, 0xD1F4, 0xD2F5, 0xD5F3, 0xBDD7, 0xEA70, 0xEA71, 0xEA72, 0xEA73, 0xD7E8, 0xDAE8, 0xDAE7, 0xEA74, 0xB0A2,
+	0xCDD3, 0xEA75, 0xDAE9, 0xEA76, 0xB8BD, 0xBCCA, 0xC2BD, 0xC2A4, 0xB3C2, 0xDAEA, 0xEA77, 0xC2AA, 0xC4B0, 0xBDB5, 0xEA78, 0xEA79,
+	0xCFDE, 0xEA7A, 0xEA7B, 0xEA7C, 0xDAEB, 0xC9C2, 0xEA7D, 0xEA7E, 0xEA80, 0xEA81, 0xEA82, 0xB1DD, 0xEA83, 0xEA84, 0xEA85, 0xDAEC,
+	0xEA86, 0xB6B8, 0xD4BA, 0xEA87, 0xB3FD, 0xEA88, 0xEA89, 0xDAED, 0xD4C9, 0xCFD5, 0xC5E3, 0xEA8A, 0xDAEE, 0xEA8B, 0xEA8C, 0xEA8D,
+	0xEA8E, 0xEA8F, 0xDAEF, 0xEA90, 0xDAF0, 0xC1EA, 0xCCD5, 0xCFDD, 0xEA91, 0xEA92, 0xEA93, 0xEA94, 0xEA95, 0xEA96, 0xEA97, 0xEA98,
+	0xEA99, 0xEA9A, 0xEA9B, 0xEA9C, 0xEA9D, 0xD3E7, 0xC2A1, 0xEA9E, 0xDAF1, 0xEA9F, 0xEAA0, 0xCBE5, 0xEB40, 0xDAF2, 0xEB41, 0xCBE6,
+	0xD2FE, 0xEB42, 0xEB43, 0xEB44, 0xB8F4, 0xEB45, 0xEB46, 0xDAF3, 0xB0AF, 0xCFB6, 0xEB47, 0xEB48, 0xD5CF, 0xEB49, 0xEB4A, 0xEB4B,
+	0xEB4C, 0xEB4D, 0xEB4E, 0xEB4F, 0xEB50, 0xEB51, 0xEB52, 0xCBED, 0xEB53, 0xEB54, 0xEB55, 0xEB56, 0xEB57, 0xEB58, 0xEB59, 0xEB5A,
+	0xDAF4, 0xEB5B, 0xEB5C, 0xE3C4, 0xEB5D, 0xEB5E, 0xC1A5, 0xEB5F, 0xEB60, 0xF6BF, 0xEB61, 0xEB62, 0xF6C0, 0xF6C1, 0xC4D1, 0xEB63,
+	0xC8B8, 0xD1E3, 0xEB64, 0xEB65, 0xD0DB, 0xD1C5, 0xBCAF, 0xB9CD, 0xEB66, 0xEFF4, 0xEB67, 0xEB68, 0xB4C6, 0xD3BA, 0xF6C2, 0xB3FB,
+	0xEB69, 0xEB6A, 0xF6C3, 0xEB6B, 0xEB6C, 0xB5F1, 0xEB6D, 0xEB6E, 0xEB6F, 0xEB70, 0xEB71, 0xEB72, 0xEB73, 0xEB74, 0xEB75, 0xEB76,
+	0xF6C5, 0xEB77, 0xEB78, 0xEB79, 0xEB7A, 0xEB7B, 0xEB7C, 0xEB7D, 0xD3EA, 0xF6A7, 0xD1A9, 0xEB7E, 0xEB80, 0xEB81, 0xEB82, 0xF6A9,
+	0xEB83, 0xEB84, 0xEB85, 0xF6A8, 0xEB86, 0xEB87, 0xC1E3, 0xC0D7, 0xEB88, 0xB1A2, 0xEB89, 0xEB8A, 0xEB8B, 0xEB8C, 0xCEED, 0xEB8D,
+	0xD0E8, 0xF6AB, 0xEB8E, 0xEB8F, 0xCFF6, 0xEB90, 0xF6AA, 0xD5F0, 0xF6AC, 0xC3B9, 0xEB91, 0xEB92, 0xEB93, 0xBBF4, 0xF6AE, 0xF6AD,
+	0xEB94, 0xEB95, 0xEB96, 0xC4DE, 0xEB97, 0xEB98, 0xC1D8, 0xEB99, 0xEB9A, 0xEB9B, 0xEB9C, 0xEB9D, 0xCBAA, 0xEB9E, 0xCFBC, 0xEB9F,
+	0xEBA0, 0xEC40, 0xEC41, 0xEC42, 0xEC43, 0xEC44, 0xEC45, 0xEC46, 0xEC47, 0xEC48, 0xF6AF, 0xEC49, 0xEC4A, 0xF6B0, 0xEC4B, 0xEC4C,
+	0xF6B1, 0xEC4D, 0xC2B6, 0xEC4E, 0xEC4F, 0xEC50, 0xEC51, 0xEC52, 0xB0D4, 0xC5F9, 0xEC53, 0xEC54, 0xEC55, 0xEC56, 0xF6B2, 0xEC57,
+	0xEC58, 0xEC59, 0xEC5A, 0xEC5B, 0xEC5C, 0xEC5D, 0xEC5E, 0xEC5F, 0xEC60, 0xEC61, 0xEC62, 0xEC63, 0xEC64, 0xEC65, 0xEC66, 0xEC67,
+	0xEC68, 0xEC69, 0xC7E0, 0xF6A6, 0xEC6A, 0xEC6B, 0xBEB8, 0xEC6C, 0xEC6D, 0xBEB2, 0xEC6E, 0xB5E5, 0xEC6F, 0xEC70, 0xB7C7, 0xEC71,
+	0xBFBF, 0xC3D2, 0xC3E6, 0xEC72, 0xEC73, 0xD8CC, 0xEC74, 0xEC75, 0xEC76, 0xB8EF, 0xEC77, 0xEC78, 0xEC79, 0xEC7A, 0xEC7B, 0xEC7C,
+	0xEC7D, 0xEC7E, 0xEC80, 0xBDF9, 0xD1A5, 0xEC81, 0xB0D0, 0xEC82, 0xEC83, 0xEC84, 0xEC85, 0xEC86, 0xF7B0, 0xEC87, 0xEC88, 0xEC89,
+	0xEC8A, 0xEC8B, 0xEC8C, 0xEC8D, 0xEC8E, 0xF7B1, 0xEC8F, 0xEC90, 0xEC91, 0xEC92, 0xEC93, 0xD0AC, 0xEC94, 0xB0B0, 0xEC95, 0xEC96,
+	0xEC97, 0xF7B2, 0xF7B3, 0xEC98, 0xF7B4, 0xEC99, 0xEC9A, 0xEC9B, 0xC7CA, 0xEC9C, 0xEC9D, 0xEC9E, 0xEC9F, 0xECA0, 0xED40, 0xED41,
+	0xBECF, 0xED42, 0xED43, 0xF7B7, 0xED44, 0xED45, 0xED46, 0xED47, 0xED48, 0xED49, 0xED4A, 0xF7B6, 0xED4B, 0xB1DE, 0xED4C, 0xF7B5,
+	0xED4D, 0xED4E, 0xF7B8, 0xED4F, 0xF7B9, 0xED50, 0xED51, 0xED52, 0xED53, 0xED54, 0xED55, 0xED56, 0xED57, 0xED58, 0xED59, 0xED5A,
+	0xED5B, 0xED5C, 0xED5D, 0xED5E, 0xED5F, 0xED60, 0xED61, 0xED62, 0xED63, 0xED64, 0xED65, 0xED66, 0xED67, 0xED68, 0xED69, 0xED6A,
+	0xED6B, 0xED6C, 0xED6D, 0xED6E, 0xED6F, 0xED70, 0xED71, 0xED72, 0xED73, 0xED74, 0xED75, 0xED76, 0xED77, 0xED78, 0xED79, 0xED7A,
+	0xED7B, 0xED7C, 0xED7D, 0xED7E, 0xED80, 0xED81, 0xCEA4, 0xC8CD, 0xED82, 0xBAAB, 0xE8B8, 0xE8B9, 0xE8BA, 0xBEC2, 0xED83, 0xED84,
+	0xED85, 0xED86, 0xED87, 0xD2F4, 0xED88, 0xD4CF, 0xC9D8, 0xED89, 0xED8A, 0xED8B, 0xED8C, 0xED8D, 0xED8E, 0xED8F, 0xED90, 0xED91,
+	0xED92, 0xED93, 0xED94, 0xED95, 0xED96, 0xED97, 0xED98, 0xED99, 0xED9A, 0xED9B, 0xED9C, 0xED9D, 0xED9E, 0xED9F, 0xEDA0, 0xEE40,
+	0xEE41, 0xEE42, 0xEE43, 0xEE44, 0xEE45, 0xEE46, 0xEE47, 0xEE48, 0xEE49, 0xEE4A, 0xEE4B, 0xEE4C, 0xEE4D, 0xEE4E, 0xEE4F, 0xEE50,
+	0xEE51, 0xEE52, 0xEE53, 0xEE54, 0xEE55, 0xEE56, 0xEE57, 0xEE58, 0xEE59, 0xEE5A, 0xEE5B, 0xEE5C, 0xEE5D, 0xEE5E, 0xEE5F, 0xEE60,
+	0xEE61, 0xEE62, 0xEE63, 0xEE64, 0xEE65, 0xEE66, 0xEE67, 0xEE68, 0xEE69, 0xEE6A, 0xEE6B, 0xEE6C, 0xEE6D, 0xEE6E, 0xEE6F, 0xEE70,
+	0xEE71, 0xEE72, 0xEE73, 0xEE74, 0xEE75, 0xEE76, 0xEE77, 0xEE78, 0xEE79, 0xEE7A, 0xEE7B, 0xEE7C, 0xEE7D, 0xEE7E, 0xEE80, 0xEE81,
+	0xEE82, 0xEE83, 0xEE84, 0xEE85, 0xEE86, 0xEE87, 0xEE88, 0xEE89, 0xEE8A, 0xEE8B, 0xEE8C, 0xEE8D, 0xEE8E, 0xEE8F, 0xEE90, 0xEE91,
+	0xEE92, 0xEE93, 0xEE94, 0xEE95, 0xEE96, 0xEE97, 0xEE98, 0xEE99, 0xEE9A, 0xEE9B, 0xEE9C, 0xEE9D, 0xEE9E, 0xEE9F, 0xEEA0, 0xEF40,
+	0xEF41, 0xEF42, 0xEF43, 0xEF44, 0xEF45, 0xD2B3, 0xB6A5, 0xC7EA, 0xF1FC, 0xCFEE, 0xCBB3, 0xD0EB, 0xE7EF, 0xCDE7, 0xB9CB, 0xB6D9,
+	0xF1FD, 0xB0E4, 0xCBCC, 0xF1FE, 0xD4A4, 0xC2AD, 0xC1EC, 0xC6C4, 0xBEB1, 0xF2A1, 0xBCD5, 0xEF46, 0xF2A2, 0xF2A3, 0xEF47, 0xF2A4,
+	0xD2C3, 0xC6B5, 0xEF48, 0xCDC7, 0xF2A5, 0xEF49, 0xD3B1, 0xBFC5, 0xCCE2, 0xEF4A, 0xF2A6, 0xF2A7, 0xD1D5, 0xB6EE, 0xF2A8, 0xF2A9,
+	0xB5DF, 0xF2AA, 0xF2AB, 0xEF4B, 0xB2FC, 0xF2AC, 0xF2AD, 0xC8A7, 0xEF4C, 0xEF4D, 0xEF4E, 0xEF4F, 0xEF50, 0xEF51, 0xEF52, 0xEF53,
+	0xEF54, 0xEF55, 0xEF56, 0xEF57, 0xEF58, 0xEF59, 0xEF5A, 0xEF5B, 0xEF5C, 0xEF5D, 0xEF5E, 0xEF5F, 0xEF60, 0xEF61, 0xEF62, 0xEF63,
+	0xEF64, 0xEF65, 0xEF66, 0xEF67, 0xEF68, 0xEF69, 0xEF6A, 0xEF6B, 0xEF6C, 0xEF6D, 0xEF6E, 0xEF6F, 0xEF70, 0xEF71, 0xB7E7, 0xEF72,
+	0xEF73, 0xECA9, 0xECAA, 0xECAB, 0xEF74, 0xECAC, 0xEF75, 0xEF76, 0xC6AE, 0xECAD, 0xECAE, 0xEF77, 0xEF78, 0xEF79, 0xB7C9, 0xCAB3,
+	0xEF7A, 0xEF7B, 0xEF7C, 0xEF7D, 0xEF7E, 0xEF80, 0xEF81, 0xE2B8, 0xF7CF, 0xEF82, 0xEF83, 0xEF84, 0xEF85, 0xEF86, 0xEF87, 0xEF88,
+	0xEF89, 0xEF8A, 0xEF8B, 0xEF8C, 0xEF8D, 0xEF8E, 0xEF8F, 0xEF90, 0xEF91, 0xEF92, 0xEF93, 0xEF94, 0xEF95, 0xEF96, 0xEF97, 0xEF98,
+	0xEF99, 0xEF9A, 0xEF9B, 0xEF9C, 0xEF9D, 0xEF9E, 0xEF9F, 0xEFA0, 0xF040, 0xF041, 0xF042, 0xF043, 0xF044, 0xF7D0, 0xF045, 0xF046,
+	0xB2CD, 0xF047, 0xF048, 0xF049, 0xF04A, 0xF04B, 0xF04C, 0xF04D, 0xF04E, 0xF04F, 0xF050, 0xF051, 0xF052, 0xF053, 0xF054, 0xF055,
+	0xF056, 0xF057, 0xF058, 0xF059, 0xF05A, 0xF05B, 0xF05C, 0xF05D, 0xF05E, 0xF05F, 0xF060, 0xF061, 0xF062, 0xF063, 0xF7D1, 0xF064,
+	0xF065, 0xF066, 0xF067, 0xF068, 0xF069, 0xF06A, 0xF06B, 0xF06C, 0xF06D, 0xF06E, 0xF06F, 0xF070, 0xF071, 0xF072, 0xF073, 0xF074,
+	0xF075, 0xF076, 0xF077, 0xF078, 0xF079, 0xF07A, 0xF07B, 0xF07C, 0xF07D, 0xF07E, 0xF080, 0xF081, 0xF082, 0xF083, 0xF084, 0xF085,
+	0xF086, 0xF087, 0xF088, 0xF089, 0xF7D3, 0xF7D2, 0xF08A, 0xF08B, 0xF08C, 0xF08D, 0xF08E, 0xF08F, 0xF090, 0xF091, 0xF092, 0xF093,
+	0xF094, 0xF095, 0xF096, 0xE2BB, 0xF097, 0xBCA2, 0xF098, 0xE2BC, 0xE2BD, 0xE2BE, 0xE2BF, 0xE2C0, 0xE2C1, 0xB7B9, 0xD2FB, 0xBDA4,
+	0xCACE, 0xB1A5, 0xCBC7, 0xF099, 0xE2C2, 0xB6FC, 0xC8C4, 0xE2C3, 0xF09A, 0xF09B, 0xBDC8, 0xF09C, 0xB1FD, 0xE2C4, 0xF09D, 0xB6F6,
+	0xE2C5, 0xC4D9, 0xF09E, 0xF09F, 0xE2C6, 0xCFDA, 0xB9DD, 0xE2C7, 0xC0A1, 0xF0A0, 0xE2C8, 0xB2F6, 0xF140, 0xE2C9, 0xF141, 0xC1F3,
+	0xE2CA, 0xE2CB, 0xC2F8, 0xE2CC, 0xE2CD, 0xE2CE, 0xCAD7, 0xD8B8, 0xD9E5, 0xCFE3, 0xF142, 0xF143, 0xF144, 0xF145, 0xF146, 0xF147,
+	0xF148, 0xF149, 0xF14A, 0xF14B, 0xF14C, 0xF0A5, 0xF14D, 0xF14E, 0xDCB0, 0xF14F, 0xF150, 0xF151, 0xF152, 0xF153, 0xF154, 0xF155,
+	0xF156, 0xF157, 0xF158, 0xF159, 0xF15A, 0xF15B, 0xF15C, 0xF15D, 0xF15E, 0xF15F, 0xF160, 0xF161, 0xF162, 0xF163, 0xF164, 0xF165,
+	0xF166, 0xF167, 0xF168, 0xF169, 0xF16A, 0xF16B, 0xF16C, 0xF16D, 0xF16E, 0xF16F, 0xF170, 0xF171, 0xF172, 0xF173, 0xF174, 0xF175,
+	0xF176, 0xF177, 0xF178, 0xF179, 0xF17A, 0xF17B, 0xF17C, 0xF17D, 0xF17E, 0xF180, 0xF181, 0xF182, 0xF183, 0xF184, 0xF185, 0xF186,
+	0xF187, 0xF188, 0xF189, 0xF18A, 0xF18B, 0xF18C, 0xF18D, 0xF18E, 0xF18F, 0xF190, 0xF191, 0xF192, 0xF193, 0xF194, 0xF195, 0xF196,
+	0xF197, 0xF198, 0xF199, 0xF19A, 0xF19B, 0xF19C, 0xF19D, 0xF19E, 0xF19F, 0xF1A0, 0xF240, 0xF241, 0xF242, 0xF243, 0xF244, 0xF245,
+	0xF246, 0xF247, 0xF248, 0xF249, 0xF24A, 0xF24B, 0xF24C, 0xF24D, 0xF24E, 0xF24F, 0xF250, 0xF251, 0xF252, 0xF253, 0xF254, 0xF255,
+	0xF256, 0xF257, 0xF258, 0xF259, 0xF25A, 0xF25B, 0xF25C, 0xF25D, 0xF25E, 0xF25F, 0xF260, 0xF261, 0xF262, 0xF263, 0xF264, 0xF265,
+	0xF266, 0xF267, 0xF268, 0xF269, 0xF26A, 0xF26B, 0xF26C, 0xF26D, 0xF26E, 0xF26F, 0xF270, 0xF271, 0xF272, 0xF273, 0xF274, 0xF275,
+	0xF276, 0xF277, 0xF278, 0xF279, 0xF27A, 0xF27B, 0xF27C, 0xF27D, 0xF27E, 0xF280, 0xF281, 0xF282, 0xF283, 0xF284, 0xF285, 0xF286,
+	0xF287, 0xF288, 0xF289, 0xF28A, 0xF28B, 0xF28C, 0xF28D, 0xF28E, 0xF28F, 0xF290, 0xF291, 0xF292, 0xF293, 0xF294, 0xF295, 0xF296,
+	0xF297, 0xF298, 0xF299, 0xF29A, 0xF29B, 0xF29C, 0xF29D, 0xF29E, 0xF29F, 0xF2A0, 0xF340, 0xF341, 0xF342, 0xF343, 0xF344, 0xF345,
+	0xF346, 0xF347, 0xF348, 0xF349, 0xF34A, 0xF34B, 0xF34C, 0xF34D, 0xF34E, 0xF34F, 0xF350, 0xF351, 0xC2ED, 0xD4A6, 0xCDD4, 0xD1B1,
+	0xB3DB, 0xC7FD, 0xF352, 0xB2B5, 0xC2BF, 0xE6E0, 0xCABB, 0xE6E1, 0xE6E2, 0xBED4, 0xE6E3, 0xD7A4, 0xCDD5, 0xE6E5, 0xBCDD, 0xE6E4,
+	0xE6E6, 0xE6E7, 0xC2EE, 0xF353, 0xBDBE, 0xE6E8, 0xC2E6, 0xBAA7, 0xE6E9, 0xF354, 0xE6EA, 0xB3D2, 0xD1E9, 0xF355, 0xF356, 0xBFA5,
+	0xE6EB, 0xC6EF, 0xE6EC, 0xE6ED, 0xF357, 0xF358, 0xE6EE, 0xC6AD, 0xE6EF, 0xF359, 0xC9A7, 0xE6F0, 0xE6F1, 0xE6F2, 0xE5B9, 0xE6F3,
+	0xE6F4, 0xC2E2, 0xE6F5, 0xE6F6, 0xD6E8, 0xE6F7, 0xF35A, 0xE6F8, 0xB9C7, 0xF35B, 0xF35C, 0xF35D, 0xF35E, 0xF35F, 0xF360, 0xF361,
+	0xF7BB, 0xF7BA, 0xF362, 0xF363, 0xF364, 0xF365, 0xF7BE, 0xF7BC, 0xBAA1, 0xF366, 0xF7BF, 0xF367, 0xF7C0, 0xF368, 0xF369, 0xF36A,
+	0xF7C2, 0xF7C1, 0xF7C4, 0xF36B, 0xF36C, 0xF7C3, 0xF36D, 0xF36E, 0xF36F, 0xF370, 0xF371, 0xF7C5, 0xF7C6, 0xF372, 0xF373, 0xF374,
+	0xF375, 0xF7C7, 0xF376, 0xCBE8, 0xF377, 0xF378, 0xF379, 0xF37A, 0xB8DF, 0xF37B, 0xF37C, 0xF37D, 0xF37E, 0xF380, 0xF381, 0xF7D4,
+	0xF382, 0xF7D5, 0xF383, 0xF384, 0xF385, 0xF386, 0xF7D6, 0xF387, 0xF388, 0xF389, 0xF38A, 0xF7D8, 0xF38B, 0xF7DA, 0xF38C, 0xF7D7,
+	0xF38D, 0xF38E, 0xF38F, 0xF390, 0xF391, 0xF392, 0xF393, 0xF394, 0xF395, 0xF7DB, 0xF396, 0xF7D9, 0xF397, 0xF398, 0xF399, 0xF39A,
+	0xF39B, 0xF39C, 0xF39D, 0xD7D7, 0xF39E, 0xF39F, 0xF3A0, 0xF440, 0xF7DC, 0xF441, 0xF442, 0xF443, 0xF444, 0xF445, 0xF446, 0xF7DD,
+	0xF447, 0xF448, 0xF449, 0xF7DE, 0xF44A, 0xF44B, 0xF44C, 0xF44D, 0xF44E, 0xF44F, 0xF450, 0xF451, 0xF452, 0xF453, 0xF454, 0xF7DF,
+	0xF455, 0xF456, 0xF457, 0xF7E0, 0xF458, 0xF459, 0xF45A, 0xF45B, 0xF45C, 0xF45D, 0xF45E, 0xF45F, 0xF460, 0xF461, 0xF462, 0xDBCB,
+	0xF463, 0xF464, 0xD8AA, 0xF465, 0xF466, 0xF467, 0xF468, 0xF469, 0xF46A, 0xF46B, 0xF46C, 0xE5F7, 0xB9ED, 0xF46D, 0xF46E, 0xF46F,
+	0xF470, 0xBFFD, 0xBBEA, 0xF7C9, 0xC6C7, 0xF7C8, 0xF471, 0xF7CA, 0xF7CC, 0xF7CB, 0xF472, 0xF473, 0xF474, 0xF7CD, 0xF475, 0xCEBA,
+	0xF476, 0xF7CE, 0xF477, 0xF478, 0xC4A7, 0xF479, 0xF47A, 0xF47B, 0xF47C, 0xF47D, 0xF47E, 0xF480, 0xF481, 0xF482, 0xF483, 0xF484,
+	0xF485, 0xF486, 0xF487, 0xF488, 0xF489, 0xF48A, 0xF48B, 0xF48C, 0xF48D, 0xF48E, 0xF48F, 0xF490, 0xF491, 0xF492, 0xF493, 0xF494,
+	0xF495, 0xF496, 0xF497, 0xF498, 0xF499, 0xF49A, 0xF49B, 0xF49C, 0xF49D, 0xF49E, 0xF49F, 0xF4A0, 0xF540, 0xF541, 0xF542, 0xF543,
+	0xF544, 0xF545, 0xF546, 0xF547, 0xF548, 0xF549, 0xF54A, 0xF54B, 0xF54C, 0xF54D, 0xF54E, 0xF54F, 0xF550, 0xF551, 0xF552, 0xF553,
+	0xF554, 0xF555, 0xF556, 0xF557, 0xF558, 0xF559, 0xF55A, 0xF55B, 0xF55C, 0xF55D, 0xF55E, 0xF55F, 0xF560, 0xF561, 0xF562, 0xF563,
+	0xF564, 0xF565, 0xF566, 0xF567, 0xF568, 0xF569, 0xF56A, 0xF56B, 0xF56C, 0xF56D, 0xF56E, 0xF56F, 0xF570, 0xF571, 0xF572, 0xF573,
+	0xF574, 0xF575, 0xF576, 0xF577, 0xF578, 0xF579, 0xF57A, 0xF57B, 0xF57C, 0xF57D, 0xF57E, 0xF580, 0xF581, 0xF582, 0xF583, 0xF584,
+	0xF585, 0xF586, 0xF587, 0xF588, 0xF589, 0xF58A, 0xF58B, 0xF58C, 0xF58D, 0xF58E, 0xF58F, 0xF590, 0xF591, 0xF592, 0xF593, 0xF594,
+	0xF595, 0xF596, 0xF597, 0xF598, 0xF599, 0xF59A, 0xF59B, 0xF59C, 0xF59D, 0xF59E, 0xF59F, 0xF5A0, 0xF640, 0xF641, 0xF642, 0xF643,
+	0xF644, 0xF645, 0xF646, 0xF647, 0xF648, 0xF649, 0xF64A, 0xF64B, 0xF64C, 0xF64D, 0xF64E, 0xF64F, 0xF650, 0xF651, 0xF652, 0xF653,
+	0xF654, 0xF655, 0xF656, 0xF657, 0xF658, 0xF659, 0xF65A, 0xF65B, 0xF65C, 0xF65D, 0xF65E, 0xF65F, 0xF660, 0xF661, 0xF662, 0xF663,
+	0xF664, 0xF665, 0xF666, 0xF667, 0xF668, 0xF669, 0xF66A, 0xF66B, 0xF66C, 0xF66D, 0xF66E, 0xF66F, 0xF670, 0xF671, 0xF672, 0xF673,
+	0xF674, 0xF675, 0xF676, 0xF677, 0xF678, 0xF679, 0xF67A, 0xF67B, 0xF67C, 0xF67D, 0xF67E, 0xF680, 0xF681, 0xF682, 0xF683, 0xF684,
+	0xF685, 0xF686, 0xF687, 0xF688, 0xF689, 0xF68A, 0xF68B, 0xF68C, 0xF68D, 0xF68E, 0xF68F, 0xF690, 0xF691, 0xF692, 0xF693, 0xF694,
+	0xF695, 0xF696, 0xF697, 0xF698, 0xF699, 0xF69A, 0xF69B, 0xF69C, 0xF69D, 0xF69E, 0xF69F, 0xF6A0, 0xF740, 0xF741, 0xF742, 0xF743,
+	0xF744, 0xF745, 0xF746, 0xF747, 0xF748, 0xF749, 0xF74A, 0xF74B, 0xF74C, 0xF74D, 0xF74E, 0xF74F, 0xF750, 0xF751, 0xF752, 0xF753,
+	0xF754, 0xF755, 0xF756, 0xF757, 0xF758, 0xF759, 0xF75A, 0xF75B, 0xF75C, 0xF75D, 0xF75E, 0xF75F, 0xF760, 0xF761, 0xF762, 0xF763,
+	0xF764, 0xF765, 0xF766, 0xF767, 0xF768, 0xF769, 0xF76A, 0xF76B, 0xF76C, 0xF76D, 0xF76E, 0xF76F, 0xF770, 0xF771, 0xF772, 0xF773,
+	0xF774, 0xF775, 0xF776, 0xF777, 0xF778, 0xF779, 0xF77A, 0xF77B, 0xF77C, 0xF77D, 0xF77E, 0xF780, 0xD3E3, 0xF781, 0xF782, 0xF6CF,
+	0xF783, 0xC2B3, 0xF6D0, 0xF784, 0xF785, 0xF6D1, 0xF6D2, 0xF6D3, 0xF6D4, 0xF786, 0xF787, 0xF6D6, 0xF788, 0xB1AB, 0xF6D7, 0xF789,
+	0xF6D8, 0xF6D9, 0xF6DA, 0xF78A, 0xF6DB, 0xF6DC, 0xF78B, 0xF78C, 0xF78D, 0xF78E, 0xF6DD, 0xF6DE, 0xCFCA, 0xF78F, 0xF6DF, 0xF6E0,
+	0xF6E1, 0xF6E2, 0xF6E3, 0xF6E4, 0xC0F0, 0xF6E5, 0xF6E6, 0xF6E7, 0xF6E8, 0xF6E9, 0xF790, 0xF6EA, 0xF791, 0xF6EB, 0xF6EC, 0xF792,
+	0xF6ED, 0xF6EE, 0xF6EF, 0xF6F0, 0xF6F1, 0xF6F2, 0xF6F3, 0xF6F4, 0xBEA8, 0xF793, 0xF6F5, 0xF6F6, 0xF6F7, 0xF6F8, 0xF794, 0xF795,
+	0xF796, 0xF797, 0xF798, 0xC8FA, 0xF6F9, 0xF6FA, 0xF6FB, 0xF6FC, 0xF799, 0xF79A, 0xF6FD, 0xF6FE, 0xF7A1, 0xF7A2, 0xF7A3, 0xF7A4,
+	0xF7A5, 0xF79B, 0xF79C, 0xF7A6, 0xF7A7, 0xF7A8, 0xB1EE, 0xF7A9, 0xF7AA, 0xF7AB, 0xF79D, 0xF79E, 0xF7AC, 0xF7AD, 0xC1DB, 0xF7AE,
+	0xF79F, 0xF7A0, 0xF7AF, 0xF840, 0xF841, 0xF842, 0xF843, 0xF844, 0xF845, 0xF846, 0xF847, 0xF848, 0xF849, 0xF84A, 0xF84B, 0xF84C,
+	0xF84D, 0xF84E, 0xF84F, 0xF850, 0xF851, 0xF852, 0xF853, 0xF854, 0xF855, 0xF856, 0xF857, 0xF858, 0xF859, 0xF85A, 0xF85B, 0xF85C,
+	0xF85D, 0xF85E, 0xF85F, 0xF860, 0xF861, 0xF862, 0xF863, 0xF864, 0xF865, 0xF866, 0xF867, 0xF868, 0xF869, 0xF86A, 0xF86B, 0xF86C,
+	0xF86D, 0xF86E, 0xF86F, 0xF870, 0xF871, 0xF872, 0xF873, 0xF874, 0xF875, 0xF876, 0xF877, 0xF878, 0xF879, 0xF87A, 0xF87B, 0xF87C,
+	0xF87D, 0xF87E, 0xF880, 0xF881, 0xF882, 0xF883, 0xF884, 0xF885, 0xF886, 0xF887, 0xF888, 0xF889, 0xF88A, 0xF88B, 0xF88C, 0xF88D,
+	0xF88E, 0xF88F, 0xF890, 0xF891, 0xF892, 0xF893, 0xF894, 0xF895, 0xF896, 0xF897, 0xF898, 0xF899, 0xF89A, 0xF89B, 0xF89C, 0xF89D,
+	0xF89E, 0xF89F, 0xF8A0, 0xF940, 0xF941, 0xF942, 0xF943, 0xF944, 0xF945, 0xF946, 0xF947, 0xF948, 0xF949, 0xF94A, 0xF94B, 0xF94C,
+	0xF94D, 0xF94E, 0xF94F, 0xF950, 0xF951, 0xF952, 0xF953, 0xF954, 0xF955, 0xF956, 0xF957, 0xF958, 0xF959, 0xF95A, 0xF95B, 0xF95C,
+	0xF95D, 0xF95E, 0xF95F, 0xF960, 0xF961, 0xF962, 0xF963, 0xF964, 0xF965, 0xF966, 0xF967, 0xF968, 0xF969, 0xF96A, 0xF96B, 0xF96C,
+	0xF96D, 0xF96E, 0xF96F, 0xF970, 0xF971, 0xF972, 0xF973, 0xF974, 0xF975, 0xF976, 0xF977, 0xF978, 0xF979, 0xF97A, 0xF97B, 0xF97C,
+	0xF97D, 0xF97E, 0xF980, 0xF981, 0xF982, 0xF983, 0xF984, 0xF985, 0xF986, 0xF987, 0xF988, 0xF989, 0xF98A, 0xF98B, 0xF98C, 0xF98D,
+	0xF98E, 0xF98F, 0xF990, 0xF991, 0xF992, 0xF993, 0xF994, 0xF995, 0xF996, 0xF997, 0xF998, 0xF999, 0xF99A, 0xF99B, 0xF99C, 0xF99D,
+	0xF99E, 0xF99F, 0xF9A0, 0xFA40, 0xFA41, 0xFA42, 0xFA43, 0xFA44, 0xFA45, 0xFA46, 0xFA47, 0xFA48, 0xFA49, 0xFA4A, 0xFA4B, 0xFA4C,
+	0xFA4D, 0xFA4E, 0xFA4F, 0xFA50, 0xFA51, 0xFA52, 0xFA53, 0xFA54, 0xFA55, 0xFA56, 0xFA57, 0xFA58, 0xFA59, 0xFA5A, 0xFA5B, 0xFA5C,
+	0xFA5D, 0xFA5E, 0xFA5F, 0xFA60, 0xFA61, 0xFA62, 0xFA63, 0xFA64, 0xFA65, 0xFA66, 0xFA67, 0xFA68, 0xFA69, 0xFA6A, 0xFA6B, 0xFA6C,
+	0xFA6D, 0xFA6E, 0xFA6F, 0xFA70, 0xFA71, 0xFA72, 0xFA73, 0xFA74, 0xFA75, 0xFA76, 0xFA77, 0xFA78, 0xFA79, 0xFA7A, 0xFA7B, 0xFA7C,
+	0xFA7D, 0xFA7E, 0xFA80, 0xFA81, 0xFA82, 0xFA83, 0xFA84, 0xFA85, 0xFA86, 0xFA87, 0xFA88, 0xFA89, 0xFA8A, 0xFA8B, 0xFA8C, 0xFA8D,
+	0xFA8E, 0xFA8F, 0xFA90, 0xFA91, 0xFA92, 0xFA93, 0xFA94, 0xFA95, 0xFA96, 0xFA97, 0xFA98, 0xFA99, 0xFA9A, 0xFA9B, 0xFA9C, 0xFA9D,
+	0xFA9E, 0xFA9F, 0xFAA0, 0xFB40, 0xFB41, 0xFB42, 0xFB43, 0xFB44, 0xFB45, 0xFB46, 0xFB47, 0xFB48, 0xFB49, 0xFB4A, 0xFB4B, 0xFB4C,
+	0xFB4D, 0xFB4E, 0xFB4F, 0xFB50, 0xFB51, 0xFB52, 0xFB53, 0xFB54, 0xFB55, 0xFB56, 0xFB57, 0xFB58, 0xFB59, 0xFB5A, 0xFB5B, 0xC4F1,
+	0xF0AF, 0xBCA6, 0xF0B0, 0xC3F9, 0xFB5C, 0xC5B8, 0xD1BB, 0xFB5D, 0xF0B1, 0xF0B2, 0xF0B3, 0xF0B4, 0xF0B5, 0xD1BC, 0xFB5E, 0xD1EC,
+	0xFB5F, 0xF0B7, 0xF0B6, 0xD4A7, 0xFB60, 0xCDD2, 0xF0B8, 0xF0BA, 0xF0B9, 0xF0BB, 0xF0BC, 0xFB61, 0xFB62, 0xB8EB, 0xF0BD, 0xBAE8,
+	0xFB63, 0xF0BE, 0xF0BF, 0xBEE9, 0xF0C0, 0xB6EC, 0xF0C1, 0xF0C2, 0xF0C3, 0xF0C4, 0xC8B5, 0xF0C5, 0xF0C6, 0xFB64, 0xF0C7, 0xC5F4,
+	0xFB65, 0xF0C8, 0xFB66, 0xFB67, 0xFB68, 0xF0C9, 0xFB69, 0xF0CA, 0xF7BD, 0xFB6A, 0xF0CB, 0xF0CC, 0xF0CD, 0xFB6B, 0xF0CE, 0xFB6C,
+	0xFB6D, 0xFB6E, 0xFB6F, 0xF0CF, 0xBAD7, 0xFB70, 0xF0D0, 0xF0D1, 0xF0D2, 0xF0D3, 0xF0D4, 0xF0D5, 0xF0D6, 0xF0D8, 0xFB71, 0xFB72,
+	0xD3A5, 0xF0D7, 0xFB73, 0xF0D9, 0xFB74, 0xFB75, 0xFB76, 0xFB77, 0xFB78, 0xFB79, 0xFB7A, 0xFB7B, 0xFB7C, 0xFB7D, 0xF5BA, 0xC2B9,
+	0xFB7E, 0xFB80, 0xF7E4, 0xFB81, 0xFB82, 0xFB83, 0xFB84, 0xF7E5, 0xF7E6, 0xFB85, 0xFB86, 0xF7E7, 0xFB87, 0xFB88, 0xFB89, 0xFB8A,
+	0xFB8B, 0xFB8C, 0xF7E8, 0xC2B4, 0xFB8D, 0xFB8E, 0xFB8F, 0xFB90, 0xFB91, 0xFB92, 0xFB93, 0xFB94, 0xFB95, 0xF7EA, 0xFB96, 0xF7EB,
+	0xFB97, 0xFB98, 0xFB99, 0xFB9A, 0xFB9B, 0xFB9C, 0xC2F3, 0xFB9D, 0xFB9E, 0xFB9F, 0xFBA0, 0xFC40, 0xFC41, 0xFC42, 0xFC43, 0xFC44,
+	0xFC45, 0xFC46, 0xFC47, 0xFC48, 0xF4F0, 0xFC49, 0xFC4A, 0xFC4B, 0xF4EF, 0xFC4C, 0xFC4D, 0xC2E9, 0xFC4E, 0xF7E1, 0xF7E2, 0xFC4F,
+	0xFC50, 0xFC51, 0xFC52, 0xFC53, 0xBBC6, 0xFC54, 0xFC55, 0xFC56, 0xFC57, 0xD9E4, 0xFC58, 0xFC59, 0xFC5A, 0xCAF2, 0xC0E8, 0xF0A4,
+	0xFC5B, 0xBADA, 0xFC5C, 0xFC5D, 0xC7AD, 0xFC5E, 0xFC5F, 0xFC60, 0xC4AC, 0xFC61, 0xFC62, 0xF7EC, 0xF7ED, 0xF7EE, 0xFC63, 0xF7F0,
+	0xF7EF, 0xFC64, 0xF7F1, 0xFC65, 0xFC66, 0xF7F4, 0xFC67, 0xF7F3, 0xFC68, 0xF7F2, 0xF7F5, 0xFC69, 0xFC6A, 0xFC6B, 0xFC6C, 0xF7F6,
+	0xFC6D, 0xFC6E, 0xFC6F, 0xFC70, 0xFC71, 0xFC72, 0xFC73, 0xFC74, 0xFC75, 0xEDE9, 0xFC76, 0xEDEA, 0xEDEB, 0xFC77, 0xF6BC, 0xFC78,
+	0xFC79, 0xFC7A, 0xFC7B, 0xFC7C, 0xFC7D, 0xFC7E, 0xFC80, 0xFC81, 0xFC82, 0xFC83, 0xFC84, 0xF6BD, 0xFC85, 0xF6BE, 0xB6A6, 0xFC86,
+	0xD8BE, 0xFC87, 0xFC88, 0xB9C4, 0xFC89, 0xFC8A, 0xFC8B, 0xD8BB, 0xFC8C, 0xDCB1, 0xFC8D, 0xFC8E, 0xFC8F, 0xFC90, 0xFC91, 0xFC92,
+	0xCAF3, 0xFC93, 0xF7F7, 0xFC94, 0xFC95, 0xFC96, 0xFC97, 0xFC98, 0xFC99, 0xFC9A, 0xFC9B, 0xFC9C, 0xF7F8, 0xFC9D, 0xFC9E, 0xF7F9,
+	0xFC9F, 0xFCA0, 0xFD40, 0xFD41, 0xFD42, 0xFD43, 0xFD44, 0xF7FB, 0xFD45, 0xF7FA, 0xFD46, 0xB1C7, 0xFD47, 0xF7FC, 0xF7FD, 0xFD48,
+	0xFD49, 0xFD4A, 0xFD4B, 0xFD4C, 0xF7FE, 0xFD4D, 0xFD4E, 0xFD4F, 0xFD50, 0xFD51, 0xFD52, 0xFD53, 0xFD54, 0xFD55, 0xFD56, 0xFD57,
+	0xC6EB, 0xECB4, 0xFD58, 0xFD59, 0xFD5A, 0xFD5B, 0xFD5C, 0xFD5D, 0xFD5E, 0xFD5F, 0xFD60, 0xFD61, 0xFD62, 0xFD63, 0xFD64, 0xFD65,
+	0xFD66, 0xFD67, 0xFD68, 0xFD69, 0xFD6A, 0xFD6B, 0xFD6C, 0xFD6D, 0xFD6E, 0xFD6F, 0xFD70, 0xFD71, 0xFD72, 0xFD73, 0xFD74, 0xFD75,
+	0xFD76, 0xFD77, 0xFD78, 0xFD79, 0xFD7A, 0xFD7B, 0xFD7C, 0xFD7D, 0xFD7E, 0xFD80, 0xFD81, 0xFD82, 0xFD83, 0xFD84, 0xFD85, 0xB3DD,
+	0xF6B3, 0xFD86, 0xFD87, 0xF6B4, 0xC1E4, 0xF6B5, 0xF6B6, 0xF6B7, 0xF6B8, 0xF6B9, 0xF6BA, 0xC8A3, 0xF6BB, 0xFD88, 0xFD89, 0xFD8A,
+	0xFD8B, 0xFD8C, 0xFD8D, 0xFD8E, 0xFD8F, 0xFD90, 0xFD91, 0xFD92, 0xFD93, 0xC1FA, 0xB9A8, 0xEDE8, 0xFD94, 0xFD95, 0xFD96, 0xB9EA,
+	0xD9DF, 0xFD97, 0xFD98, 0xFD99, 0xFD9A, 0xFD9B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD9C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD9D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xFDA0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE40, 0xFE41, 0xFE42, 0xFE43,
+	0x0000, 0xFE44, 0x0000, 0xFE45, 0xFE46, 0x0000, 0x0000, 0x0000, 0xFE47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE48,
+	0xFE49, 0xFE4A, 0x0000, 0xFE4B, 0xFE4C, 0x0000, 0x0000, 0xFE4D, 0xFE4E, 0xFE4F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA955, 0xA6F2, 0x0000, 0xA6F4, 0xA6F5, 0xA6E0, 0xA6E1, 0xA6F0, 0xA6F1, 0xA6E2, 0xA6E3, 0xA6EE, 0xA6EF, 0xA6E6, 0xA6E7, 0xA6E4,
+	0xA6E5, 0xA6E8, 0xA6E9, 0xA6EA, 0xA6EB, 0x0000, 0x0000, 0x0000, 0x0000, 0xA968, 0xA969, 0xA96A, 0xA96B, 0xA96C, 0xA96D, 0xA96E,
+	0xA96F, 0xA970, 0xA971, 0x0000, 0xA972, 0xA973, 0xA974, 0xA975, 0x0000, 0xA976, 0xA977, 0xA978, 0xA979, 0xA97A, 0xA97B, 0xA97C,
+	0xA97D, 0xA97E, 0xA980, 0xA981, 0xA982, 0xA983, 0xA984, 0x0000, 0xA985, 0xA986, 0xA987, 0xA988, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA3A1, 0xA3A2, 0xA3A3, 0xA1E7, 0xA3A5, 0xA3A6, 0xA3A7, 0xA3A8, 0xA3A9, 0xA3AA, 0xA3AB, 0xA3AC, 0xA3AD, 0xA3AE, 0xA3AF,
+	0xA3B0, 0xA3B1, 0xA3B2, 0xA3B3, 0xA3B4, 0xA3B5, 0xA3B6, 0xA3B7, 0xA3B8, 0xA3B9, 0xA3BA, 0xA3BB, 0xA3BC, 0xA3BD, 0xA3BE, 0xA3BF,
+	0xA3C0, 0xA3C1, 0xA3C2, 0xA3C3, 0xA3C4, 0xA3C5, 0xA3C6, 0xA3C7, 0xA3C8, 0xA3C9, 0xA3CA, 0xA3CB, 0xA3CC, 0xA3CD, 0xA3CE, 0xA3CF,
+	0xA3D0, 0xA3D1, 0xA3D2, 0xA3D3, 0xA3D4, 0xA3D5, 0xA3D6, 0xA3D7, 0xA3D8, 0xA3D9, 0xA3DA, 0xA3DB, 0xA3DC, 0xA3DD, 0xA3DE, 0xA3DF,
+	0xA3E0, 0xA3E1, 0xA3E2, 0xA3E3, 0xA3E4, 0xA3E5, 0xA3E6, 0xA3E7, 0xA3E8, 0xA3E9, 0xA3EA, 0xA3EB, 0xA3EC, 0xA3ED, 0xA3EE, 0xA3EF,
+	0xA3F0, 0xA3F1, 0xA3F2, 0xA3F3, 0xA3F4, 0xA3F5, 0xA3F6, 0xA3F7, 0xA3F8, 0xA3F9, 0xA3FA, 0xA3FB, 0xA3FC, 0xA3FD, 0xA1AB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1E9, 0xA1EA, 0xA956, 0xA3FE, 0xA957, 0xA3A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+#endif
 
 static const WCHAR oem2uni936[] = {	/* GBK --> Unicode pairs */
 	0x0080, 0x20AC, 0x8140, 0x4E02, 0x8141, 0x4E04, 0x8142, 0x4E05,	0x8143, 0x4E06, 0x8144, 0x4E0F, 0x8145, 0x4E12, 0x8146, 0x4E17,
@@ -7350,6 +10549,7 @@ static const WCHAR oem2uni936[] = {	/* GBK --> Unicode pairs */
 #endif
 
 #if FF_CODE_PAGE == 949 || FF_CODE_PAGE == 0	/* Korean */
+#if FF_UNI2OEM_MAP < 2
 static const WCHAR uni2oem949[] = {	/* Unicode --> Korean pairs */
 	0x00A1, 0xA2AE, 0x00A4, 0xA2B4, 0x00A7, 0xA1D7, 0x00A8, 0xA1A7,	0x00AA, 0xA8A3, 0x00AD, 0xA1A9, 0x00AE, 0xA2E7, 0x00B0, 0xA1C6,
 	0x00B1, 0xA1BE, 0x00B2, 0xA9F7, 0x00B3, 0xA9F8, 0x00B4, 0xA2A5,	0x00B6, 0xA2D2, 0x00B7, 0xA1A4, 0x00B8, 0xA2AC, 0x00B9, 0xA9F6,
@@ -9484,6 +12684,2252 @@ static const WCHAR uni2oem949[] = {	/* Unicode --> Korean pairs */
 	0xFF5D, 0xA3FD, 0xFF5E, 0xA2A6, 0xFFE0, 0xA1CB, 0xFFE1, 0xA1CC,	0xFFE2, 0xA1FE, 0xFFE3, 0xA3FE, 0xFFE5, 0xA1CD, 0xFFE6, 0xA3DC,
 	0, 0
 };
+#else
+static const WORD u2oidx949[] = {	/* Unicode to OEM code map index (block number + 1 of each 64 code points, 0:no char) */
+	0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 5, 0, 0, 6, 7,
+	8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	10, 11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 0, 20, 0, 0, 0,
+	0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	30, 31, 32, 33, 34, 35, 36, 0, 37, 38, 0, 0, 0, 0, 39, 40,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+	145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+	161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+	193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+	225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 236, 237, 238, 239,
+	240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+	256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+	272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 0,
+	287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+	303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+	319, 320, 0, 0, 0, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+	332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347,
+	348, 349, 0, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+	378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393,
+	394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+	410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425,
+	426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
+	442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457,
+	458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473,
+	474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+	490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+	506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
+	522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 537, 538, 539, 540, 541, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 542, 543, 0, 544
+};
+static const WCHAR u2oblk949[] = {	/* Unicode to OEM code map blocks (64 code points each, 0:no char) */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA2AE, 0x0000, 0x0000, 0xA2B4, 0x0000, 0x0000, 0xA1D7, 0xA1A7, 0x0000, 0xA8A3, 0x0000, 0x0000, 0xA1A9, 0xA2E7, 0x0000,
+	0xA1C6, 0xA1BE, 0xA9F7, 0xA9F8, 0xA2A5, 0x0000, 0xA2D2, 0xA1A4, 0xA2AC, 0xA9F6, 0xA8AC, 0x0000, 0xA8F9, 0xA8F6, 0xA8FA, 0xA2AF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA8A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1BF, 0xA8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8AD, 0xA9AC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA9A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1C0, 0xA9AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9AD, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA9A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A4, 0xA9A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA9A5, 0xA8A6, 0xA9A6, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A8,
+	0xA9A8, 0xA8A9, 0xA9A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9B0, 0xA8AF, 0xA9AF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA8AB, 0xA9AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8AE, 0xA9AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2A8, 0xA2AB, 0xA2AA, 0xA2AD, 0x0000, 0xA2A9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA5C1, 0xA5C2, 0xA5C3, 0xA5C4, 0xA5C5, 0xA5C6, 0xA5C7, 0xA5C8, 0xA5C9, 0xA5CA, 0xA5CB, 0xA5CC, 0xA5CD, 0xA5CE, 0xA5CF,
+	0xA5D0, 0xA5D1, 0x0000, 0xA5D2, 0xA5D3, 0xA5D4, 0xA5D5, 0xA5D6, 0xA5D7, 0xA5D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA5E1, 0xA5E2, 0xA5E3, 0xA5E4, 0xA5E5, 0xA5E6, 0xA5E7, 0xA5E8, 0xA5E9, 0xA5EA, 0xA5EB, 0xA5EC, 0xA5ED, 0xA5EE, 0xA5EF,
+	0xA5F0, 0xA5F1, 0x0000, 0xA5F2, 0xA5F3, 0xA5F4, 0xA5F5, 0xA5F6, 0xA5F7, 0xA5F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xACA7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xACA1, 0xACA2, 0xACA3, 0xACA4, 0xACA5, 0xACA6, 0xACA8, 0xACA9, 0xACAA, 0xACAB, 0xACAC, 0xACAD, 0xACAE, 0xACAF, 0xACB0, 0xACB1,
+	0xACB2, 0xACB3, 0xACB4, 0xACB5, 0xACB6, 0xACB7, 0xACB8, 0xACB9, 0xACBA, 0xACBB, 0xACBC, 0xACBD, 0xACBE, 0xACBF, 0xACC0, 0xACC1,
+	0xACD1, 0xACD2, 0xACD3, 0xACD4, 0xACD5, 0xACD6, 0xACD8, 0xACD9, 0xACDA, 0xACDB, 0xACDC, 0xACDD, 0xACDE, 0xACDF, 0xACE0, 0xACE1,
+	0xACE2, 0xACE3, 0xACE4, 0xACE5, 0xACE6, 0xACE7, 0xACE8, 0xACE9, 0xACEA, 0xACEB, 0xACEC, 0xACED, 0xACEE, 0xACEF, 0xACF0, 0xACF1,
+	0x0000, 0xACD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1AA, 0x0000, 0x0000, 0xA1AE, 0xA1AF, 0x0000, 0x0000, 0xA1B0, 0xA1B1, 0x0000, 0x0000,
+	0xA2D3, 0xA2D4, 0x0000, 0x0000, 0x0000, 0xA1A5, 0xA1A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2B6, 0x0000, 0xA1C7, 0xA1C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA9F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9FA,
+	0x0000, 0xA9FB, 0xA9FC, 0xA9FD, 0xA9FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2E6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA1C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA7A4, 0x0000, 0x0000, 0xA2E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA2E5, 0xA2E2, 0x0000, 0x0000, 0x0000, 0xA7D9, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1CA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA8F7, 0xA8F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8FB, 0xA8FC, 0xA8FD, 0xA8FE, 0x0000,
+	0xA5B0, 0xA5B1, 0xA5B2, 0xA5B3, 0xA5B4, 0xA5B5, 0xA5B6, 0xA5B7, 0xA5B8, 0xA5B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA5A1, 0xA5A2, 0xA5A3, 0xA5A4, 0xA5A5, 0xA5A6, 0xA5A7, 0xA5A8, 0xA5A9, 0xA5AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1E7, 0xA1E8, 0xA1E6, 0xA1E9, 0xA1EA, 0xA2D5, 0xA2D8, 0xA2D6, 0xA2D9, 0xA2D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA2A1, 0x0000, 0xA2A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2A3, 0x0000, 0xA1D3, 0xA2A4, 0x0000, 0x0000, 0x0000, 0xA1D4, 0xA1F4, 0x0000, 0x0000, 0xA1F5, 0x0000, 0x0000, 0x0000, 0xA2B3,
+	0x0000, 0xA2B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1EE, 0x0000, 0x0000, 0xA1F0, 0xA1C4, 0x0000,
+	0xA1D0, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1AB, 0x0000, 0xA1FC, 0xA1FD, 0xA1FB, 0xA1FA, 0xA1F2, 0xA1F3, 0x0000, 0xA2B1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA1C5, 0xA1F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1AD, 0xA1EF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1C1, 0xA1D5, 0x0000, 0x0000, 0xA1C2, 0xA1C3, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1EC, 0xA1ED, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1F8, 0xA1F9, 0x0000, 0x0000, 0xA1F6, 0xA1F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA8E7, 0xA8E8, 0xA8E9, 0xA8EA, 0xA8EB, 0xA8EC, 0xA8ED, 0xA8EE, 0xA8EF, 0xA8F0, 0xA8F1, 0xA8F2, 0xA8F3, 0xA8F4, 0xA8F5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA9E7, 0xA9E8, 0xA9E9, 0xA9EA, 0xA9EB, 0xA9EC, 0xA9ED, 0xA9EE, 0xA9EF, 0xA9F0, 0xA9F1, 0xA9F2,
+	0xA9F3, 0xA9F4, 0xA9F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9CD, 0xA9CE, 0xA9CF, 0xA9D0,
+	0xA9D1, 0xA9D2, 0xA9D3, 0xA9D4, 0xA9D5, 0xA9D6, 0xA9D7, 0xA9D8, 0xA9D9, 0xA9DA, 0xA9DB, 0xA9DC, 0xA9DD, 0xA9DE, 0xA9DF, 0xA9E0,
+	0xA9E1, 0xA9E2, 0xA9E3, 0xA9E4, 0xA9E5, 0xA9E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA8CD, 0xA8CE, 0xA8CF, 0xA8D0, 0xA8D1, 0xA8D2, 0xA8D3, 0xA8D4, 0xA8D5, 0xA8D6, 0xA8D7, 0xA8D8, 0xA8D9, 0xA8DA, 0xA8DB, 0xA8DC,
+	0xA8DD, 0xA8DE, 0xA8DF, 0xA8E0, 0xA8E1, 0xA8E2, 0xA8E3, 0xA8E4, 0xA8E5, 0xA8E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA6A1, 0xA6AC, 0xA6A2, 0xA6AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6A3, 0xA6C8, 0xA6C7, 0xA6AE,
+	0xA6A4, 0xA6C2, 0xA6C1, 0xA6AF, 0xA6A6, 0xA6C6, 0xA6C5, 0xA6B1, 0xA6A5, 0xA6C4, 0xA6C3, 0xA6B0, 0xA6A7, 0xA6BC, 0xA6C9, 0xA6CA,
+	0xA6B7, 0xA6CB, 0xA6CC, 0xA6B2, 0xA6A9, 0xA6BE, 0xA6CD, 0xA6CE, 0xA6B9, 0xA6CF, 0xA6D0, 0xA6B4, 0xA6A8, 0xA6D1, 0xA6D2, 0xA6B8,
+	0xA6BD, 0xA6D3, 0xA6D4, 0xA6B3, 0xA6AA, 0xA6D5, 0xA6D6, 0xA6BA, 0xA6BF, 0xA6D7, 0xA6D8, 0xA6B5, 0xA6AB, 0xA6D9, 0xA6DA, 0xA6BB,
+	0xA6DB, 0xA6DC, 0xA6C0, 0xA6DD, 0xA6DE, 0xA6DF, 0xA6E0, 0xA6E1, 0xA6E2, 0xA6E3, 0xA6E4, 0xA6B6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA2C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1E1, 0xA1E0, 0x0000, 0xA2C3, 0xA2C7, 0xA2C8, 0xA2CB, 0xA2CA, 0xA2C9, 0xA2CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1E3, 0xA1E2, 0x0000, 0x0000, 0xA2BA, 0xA2B9, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1E5, 0xA1E4, 0x0000, 0x0000,
+	0xA2B8, 0xA2B7, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1DF, 0xA1DE, 0xA2C2, 0x0000, 0x0000, 0xA1DB, 0x0000, 0x0000, 0xA1DD, 0xA1DC,
+	0xA2C4, 0xA2C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1DA, 0xA1D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2CF, 0xA2CE,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2D0, 0x0000, 0xA2D1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1CF, 0x0000, 0xA1CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2BC, 0xA2BD, 0x0000, 0xA2C0, 0xA2BB, 0xA2BE, 0x0000, 0xA2BF, 0xA2CD, 0xA2DB, 0xA2DC, 0x0000, 0xA2DD, 0xA2DA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1A1, 0xA1A2, 0xA1A3, 0xA1A8, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1B4, 0xA1B5, 0xA1B6, 0xA1B7, 0xA1B8, 0xA1B9, 0xA1BA, 0xA1BB,
+	0xA1BC, 0xA1BD, 0x0000, 0xA1EB, 0xA1B2, 0xA1B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xAAA1, 0xAAA2, 0xAAA3, 0xAAA4, 0xAAA5, 0xAAA6, 0xAAA7, 0xAAA8, 0xAAA9, 0xAAAA, 0xAAAB, 0xAAAC, 0xAAAD, 0xAAAE, 0xAAAF,
+	0xAAB0, 0xAAB1, 0xAAB2, 0xAAB3, 0xAAB4, 0xAAB5, 0xAAB6, 0xAAB7, 0xAAB8, 0xAAB9, 0xAABA, 0xAABB, 0xAABC, 0xAABD, 0xAABE, 0xAABF,
+	0xAAC0, 0xAAC1, 0xAAC2, 0xAAC3, 0xAAC4, 0xAAC5, 0xAAC6, 0xAAC7, 0xAAC8, 0xAAC9, 0xAACA, 0xAACB, 0xAACC, 0xAACD, 0xAACE, 0xAACF,
+	0xAAD0, 0xAAD1, 0xAAD2, 0xAAD3, 0xAAD4, 0xAAD5, 0xAAD6, 0xAAD7, 0xAAD8, 0xAAD9, 0xAADA, 0xAADB, 0xAADC, 0xAADD, 0xAADE, 0xAADF,
+	0xAAE0, 0xAAE1, 0xAAE2, 0xAAE3, 0xAAE4, 0xAAE5, 0xAAE6, 0xAAE7, 0xAAE8, 0xAAE9, 0xAAEA, 0xAAEB, 0xAAEC, 0xAAED, 0xAAEE, 0xAAEF,
+	0xAAF0, 0xAAF1, 0xAAF2, 0xAAF3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xABA1, 0xABA2, 0xABA3, 0xABA4, 0xABA5, 0xABA6, 0xABA7, 0xABA8, 0xABA9, 0xABAA, 0xABAB, 0xABAC, 0xABAD, 0xABAE, 0xABAF,
+	0xABB0, 0xABB1, 0xABB2, 0xABB3, 0xABB4, 0xABB5, 0xABB6, 0xABB7, 0xABB8, 0xABB9, 0xABBA, 0xABBB, 0xABBC, 0xABBD, 0xABBE, 0xABBF,
+	0xABC0, 0xABC1, 0xABC2, 0xABC3, 0xABC4, 0xABC5, 0xABC6, 0xABC7, 0xABC8, 0xABC9, 0xABCA, 0xABCB, 0xABCC, 0xABCD, 0xABCE, 0xABCF,
+	0xABD0, 0xABD1, 0xABD2, 0xABD3, 0xABD4, 0xABD5, 0xABD6, 0xABD7, 0xABD8, 0xABD9, 0xABDA, 0xABDB, 0xABDC, 0xABDD, 0xABDE, 0xABDF,
+	0xABE0, 0xABE1, 0xABE2, 0xABE3, 0xABE4, 0xABE5, 0xABE6, 0xABE7, 0xABE8, 0xABE9, 0xABEA, 0xABEB, 0xABEC, 0xABED, 0xABEE, 0xABEF,
+	0xABF0, 0xABF1, 0xABF2, 0xABF3, 0xABF4, 0xABF5, 0xABF6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA4A1, 0xA4A2, 0xA4A3, 0xA4A4, 0xA4A5, 0xA4A6, 0xA4A7, 0xA4A8, 0xA4A9, 0xA4AA, 0xA4AB, 0xA4AC, 0xA4AD, 0xA4AE, 0xA4AF,
+	0xA4B0, 0xA4B1, 0xA4B2, 0xA4B3, 0xA4B4, 0xA4B5, 0xA4B6, 0xA4B7, 0xA4B8, 0xA4B9, 0xA4BA, 0xA4BB, 0xA4BC, 0xA4BD, 0xA4BE, 0xA4BF,
+	0xA4C0, 0xA4C1, 0xA4C2, 0xA4C3, 0xA4C4, 0xA4C5, 0xA4C6, 0xA4C7, 0xA4C8, 0xA4C9, 0xA4CA, 0xA4CB, 0xA4CC, 0xA4CD, 0xA4CE, 0xA4CF,
+	0xA4D0, 0xA4D1, 0xA4D2, 0xA4D3, 0xA4D4, 0xA4D5, 0xA4D6, 0xA4D7, 0xA4D8, 0xA4D9, 0xA4DA, 0xA4DB, 0xA4DC, 0xA4DD, 0xA4DE, 0xA4DF,
+	0xA4E0, 0xA4E1, 0xA4E2, 0xA4E3, 0xA4E4, 0xA4E5, 0xA4E6, 0xA4E7, 0xA4E8, 0xA4E9, 0xA4EA, 0xA4EB, 0xA4EC, 0xA4ED, 0xA4EE, 0xA4EF,
+	0xA4F0, 0xA4F1, 0xA4F2, 0xA4F3, 0xA4F4, 0xA4F5, 0xA4F6, 0xA4F7, 0xA4F8, 0xA4F9, 0xA4FA, 0xA4FB, 0xA4FC, 0xA4FD, 0xA4FE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA9B1, 0xA9B2, 0xA9B3, 0xA9B4, 0xA9B5, 0xA9B6, 0xA9B7, 0xA9B8, 0xA9B9, 0xA9BA, 0xA9BB, 0xA9BC, 0xA9BD, 0xA9BE, 0xA9BF, 0xA9C0,
+	0xA9C1, 0xA9C2, 0xA9C3, 0xA9C4, 0xA9C5, 0xA9C6, 0xA9C7, 0xA9C8, 0xA9C9, 0xA9CA, 0xA9CB, 0xA9CC, 0xA2DF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA8B1, 0xA8B2, 0xA8B3, 0xA8B4, 0xA8B5, 0xA8B6, 0xA8B7, 0xA8B8, 0xA8B9, 0xA8BA, 0xA8BB, 0xA8BC, 0xA8BD, 0xA8BE, 0xA8BF, 0xA8C0,
+	0xA8C1, 0xA8C2, 0xA8C3, 0xA8C4, 0xA8C5, 0xA8C6, 0xA8C7, 0xA8C8, 0xA8C9, 0xA8CA, 0xA8CB, 0xA8CC, 0x0000, 0x0000, 0x0000, 0xA2DE,
+	0xA7C9, 0xA7CA, 0xA7CB, 0xA7CC, 0xA7CD, 0x0000, 0x0000, 0x0000, 0xA7BA, 0xA7BB, 0xA7DC, 0xA7DD, 0xA7DE, 0xA7B6, 0xA7B7, 0xA7B8,
+	0xA7D4, 0xA7D5, 0xA7D6, 0xA7D7, 0xA7D8, 0xA7A1, 0xA7A2, 0xA7A3, 0xA7A5, 0xA7AB, 0xA7AC, 0xA7AD, 0xA7AE, 0xA7AF, 0xA7B0, 0xA7B1,
+	0xA7B2, 0xA7B3, 0xA7B4, 0xA7A7, 0xA7A8, 0xA7A9, 0xA7AA, 0xA7BD, 0xA7BE, 0xA7E5, 0xA7E6, 0xA7E7, 0xA7E8, 0xA7E1, 0xA7E2, 0xA7E3,
+	0xA7BF, 0xA7C0, 0xA7C1, 0xA7C2, 0xA7C3, 0xA7C4, 0xA7C5, 0xA7C6, 0xA7C7, 0xA7C8, 0xA7CE, 0xA7CF, 0xA7D0, 0xA7D1, 0xA7D2, 0xA7D3,
+	0xA7DA, 0xA7DB, 0xA2E3, 0xA7EC, 0xA7A6, 0xA7E0, 0xA7EF, 0xA2E1, 0xA7BC, 0xA7ED, 0xA7B5, 0x0000, 0x0000, 0x0000, 0x0000, 0xA7B9,
+	0xA7EA, 0x0000, 0x0000, 0xA7EB, 0x0000, 0x0000, 0xA7DF, 0x0000, 0xA2E4, 0x0000, 0x0000, 0xA7E4, 0xA7EE, 0xA7E9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xECE9, 0xEFCB, 0x0000, 0xF6D2, 0x0000, 0x0000, 0x0000, 0xD8B2, 0xEDDB, 0xDFB2, 0xDFBE, 0xF9BB, 0x0000, 0xDCF4, 0x0000, 0x0000,
+	0x0000, 0xF5E4, 0x0000, 0x0000, 0xF3A6, 0xDDE0, 0xE1A6, 0x0000, 0xCEF8, 0xDCB0, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3AA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1E9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xCDFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCAF, 0xD3A1, 0x0000, 0xF1AB, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE7D1, 0xD2AC, 0x0000, 0xCEF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1FD, 0x0000, 0xDEBF, 0xFBBA, 0xF9B9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCED2, 0x0000, 0xE3AB, 0xEBE0, 0x0000, 0x0000, 0x0000, 0xCEFA, 0xCBF7, 0xE5A5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAE1, 0x0000, 0xD4CC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xEAE1, 0x0000, 0x0000, 0xDCE3, 0xDFAD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBEB, 0x0000,
+	0x0000, 0x0000, 0xD5AF, 0x0000, 0x0000, 0x0000, 0xD6F5, 0x0000, 0xE5F8, 0x0000, 0x0000, 0xDEC0, 0xECA3, 0x0000, 0xE9CD, 0x0000,
+	0xEAA7, 0xE9F6, 0xFBBB, 0x0000, 0xE7E9, 0xEFCC, 0x0000, 0x0000, 0xD0E6, 0x0000, 0x0000, 0xDEC1, 0x0000, 0x0000, 0xE4AC, 0x0000,
+	0x0000, 0xD8CC, 0xF9F1, 0x0000, 0xCEDF, 0xFAA4, 0xE6B2, 0x0000, 0xFAFB, 0x0000, 0x0000, 0xFABD, 0xCCC8, 0xEFCD, 0xD5D5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3A2, 0x0000, 0x0000, 0x0000, 0xECD1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE4A7, 0xECD2, 0x0000, 0x0000, 0xF6B1, 0x0000, 0x0000, 0xCEFB, 0x0000, 0x0000, 0xD0D1, 0xCBBF, 0x0000, 0xEDA4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEDA8, 0xDEC2, 0xF6E2, 0xEDDC, 0xDCF5, 0xE0B9, 0x0000, 0x0000, 0x0000, 0xD4CE, 0x0000, 0xF4B5,
+	0x0000, 0x0000, 0x0000, 0xD3DB, 0xD6B5, 0xECA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE4E6, 0x0000, 0xF1EA, 0x0000, 0x0000, 0x0000, 0xCBEC, 0xCBC0, 0x0000, 0x0000, 0x0000, 0xECF2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD0EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9F2, 0xECA5, 0xD0DF, 0x0000, 0xE7EA, 0xD0EB, 0xDCD1,
+	0xDBE9, 0xFDCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBD7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDAE1, 0x0000, 0xD6B6, 0x0000, 0xE3DF, 0x0000, 0xDEC3, 0x0000, 0xDEC4, 0xCAA1, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xEEEC, 0x0000, 0x0000, 0xD3A3, 0xEEB7, 0xF8CF, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAC8, 0xEEB8, 0xF1AC,
+	0xF1A5, 0xE9CE, 0x0000, 0x0000, 0x0000, 0xF9BC, 0x0000, 0x0000, 0x0000, 0xE5F9, 0xECEA, 0xDDD6, 0xEDC2, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5BA,
+	0xDBD8, 0x0000, 0x0000, 0xCAA2, 0x0000, 0x0000, 0xD1CD, 0x0000, 0x0000, 0x0000, 0xEEED, 0x0000, 0x0000, 0x0000, 0xECEB, 0xDEC5,
+	0x0000, 0xE3E0, 0x0000, 0xCAC9, 0xF2E9, 0x0000, 0xD5CE, 0x0000, 0xF6B6, 0x0000, 0xCEC2, 0xD6C7, 0x0000, 0xE3B4, 0x0000, 0xF1AD,
+	0x0000, 0xEAE2, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7C2, 0x0000, 0xF3A7, 0x0000, 0x0000, 0xCDEA, 0x0000, 0xEBEE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9B2, 0xFDA5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6D5, 0xD5E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8B5,
+	0x0000, 0x0000, 0xCCF5, 0xF5B5, 0xE4AD, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7EB, 0xF1D5, 0x0000, 0x0000, 0x0000, 0xF0BB, 0x0000,
+	0x0000, 0xE9B5, 0x0000, 0xCCC9, 0xFAD5, 0x0000, 0x0000, 0xE1D4, 0x0000, 0x0000, 0xD7D6, 0x0000, 0x0000, 0xDCC1, 0x0000, 0xDEC6,
+	0xFAEF, 0xE3E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1F3, 0xDCF6,
+	0x0000, 0xCEFC, 0x0000, 0xDBC4, 0x0000, 0xF8F1, 0x0000, 0x0000, 0xDCE4, 0x0000, 0xE5EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDCB1, 0x0000, 0x0000, 0x0000, 0xD5D6, 0x0000, 0x0000, 0xF3DA, 0x0000, 0xCBC1, 0x0000, 0xDBC3, 0x0000, 0x0000,
+	0x0000, 0xD9FA, 0xD3EE, 0x0000, 0x0000, 0x0000, 0xFAB8, 0x0000, 0x0000, 0xFDA6, 0xEBEF, 0x0000, 0xF4A6, 0x0000, 0xCCCA, 0xF3A8,
+	0x0000, 0xF3DB, 0x0000, 0xDBA7, 0xF6B7, 0x0000, 0xCFE6, 0xF0F2, 0xCBDA, 0x0000, 0xE7D2, 0xD7C3, 0xF6F0, 0xE8DE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE5E7, 0x0000, 0x0000, 0x0000, 0xCAA3, 0xCCA7, 0xEAC9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8B6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAA5, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1AE, 0x0000, 0xEFCE, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF6B0, 0xEFCF, 0xE9CF, 0x0000, 0xF7DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCED3, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBA8, 0x0000, 0x0000,
+	0x0000, 0xCBF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFA1, 0xDDE1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5CA, 0xE9B6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE7EC, 0xEEEE, 0x0000, 0xF3F0, 0x0000, 0xDFBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCCB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0C1, 0x0000, 0x0000, 0x0000, 0xF4D2, 0xE0BA, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFC0,
+	0x0000, 0xCEE0, 0x0000, 0x0000, 0x0000, 0xDCD2, 0xFDEA, 0x0000, 0x0000, 0x0000, 0xD6F6, 0x0000, 0x0000, 0x0000, 0xEACA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E9, 0x0000, 0xE3AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3D0, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAA4, 0x0000, 0xDBF8, 0x0000, 0x0000, 0x0000, 0xDEC7,
+	0xEBF0, 0xF1D6, 0x0000, 0x0000, 0xE5E2, 0x0000, 0xCCCC, 0x0000, 0x0000, 0xCBFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xEAE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFC1,
+	0x0000, 0xD6ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xEEB9, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5E3, 0x0000, 0x0000, 0xD1D3, 0x0000, 0xE5F0, 0x0000, 0x0000, 0x0000,
+	0xE8B4, 0xEBC3, 0x0000, 0xEAAA, 0xFAFC, 0xF5F6, 0xF0BC, 0xFDD4, 0xE0BB, 0xCEC3, 0x0000, 0xD0BA, 0xF7BA, 0xD8F3, 0xF7CD, 0x0000,
+	0x0000, 0x0000, 0xE4AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4DF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD0E7, 0x0000, 0x0000, 0xECFD, 0x0000, 0xD2AE, 0xEEEF, 0xD5D7, 0xEAE4, 0xF8A2, 0xCDEB, 0xD7BF, 0xFBB1, 0x0000,
+	0x0000, 0xCDEC, 0x0000, 0x0000, 0x0000, 0xDCB2, 0xD0EC, 0xCEFD, 0xEEF0, 0x0000, 0x0000, 0x0000, 0xCCC2, 0x0000, 0x0000, 0x0000,
+	0xD0ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5F7, 0x0000, 0x0000, 0x0000, 0xF3FC, 0x0000, 0x0000, 0xEEA2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD9B3, 0x0000, 0x0000, 0xD8F4, 0x0000, 0xE9B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCEAE, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9A2, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8F1, 0x0000, 0xD4CF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A7, 0xD5D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6A9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF4A2, 0x0000, 0xF1D7, 0x0000, 0x0000, 0xD5D8, 0x0000, 0xF0BD, 0xD7D0, 0xD4D0, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7CF, 0xEBEA, 0xFDEB, 0x0000,
+	0x0000, 0xDBED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFCC5, 0xCBC2, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDD5, 0x0000, 0xF4C8, 0xE8EA, 0xF5F3, 0x0000, 0x0000, 0xF9DE, 0x0000, 0x0000,
+	0xD3EF, 0x0000, 0x0000, 0xECD3, 0x0000, 0x0000, 0xDDC2, 0xEFB7, 0xE7D4, 0x0000, 0xCACA, 0x0000, 0x0000, 0x0000, 0xD9FB, 0x0000,
+	0x0000, 0xFAFD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4F8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF7F7, 0xDCAC, 0x0000, 0x0000, 0x0000, 0xD7D7, 0xDFA2, 0x0000, 0x0000, 0x0000, 0xCEBE, 0x0000,
+	0xD3F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0A4, 0xE1EC, 0xCFE7, 0xF3CB, 0xEDA9, 0xCABE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF4EF, 0x0000, 0x0000, 0x0000, 0xF6CE, 0x0000, 0x0000, 0xDEFB, 0xD0BB, 0xD5B7, 0xEEF1, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF4A8, 0x0000, 0xDCF8, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBA7, 0x0000, 0xDACE, 0x0000, 0x0000,
+	0x0000, 0xE0E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDA5, 0xEEF2, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCF9,
+	0x0000, 0x0000, 0xF9DC, 0x0000, 0x0000, 0xF3DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8F2, 0x0000, 0xF4F9,
+	0x0000, 0x0000, 0x0000, 0xFCF1, 0x0000, 0x0000, 0x0000, 0xD0BC, 0xDBF9, 0xD7B1, 0x0000, 0x0000, 0x0000, 0xCBFC, 0x0000, 0x0000,
+	0x0000, 0xF0A5, 0xCBFD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5F4, 0x0000, 0x0000, 0x0000, 0xCDED,
+	0xCAA5, 0x0000, 0x0000, 0xD6AB, 0xD0C2, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0BE, 0xD2BD, 0xCCA4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAB6, 0x0000,
+	0x0000, 0xCCCD, 0x0000, 0xDAFA, 0x0000, 0xF6CF, 0x0000, 0xE9B8, 0x0000, 0xD8F5, 0x0000, 0x0000, 0x0000, 0xCCCE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD7CD, 0x0000, 0x0000, 0xD4D1, 0xE9ED, 0x0000, 0xCAEB, 0xD9E2, 0x0000, 0xFDB2, 0x0000, 0xE3AD, 0xD6CC, 0xD9B4,
+	0x0000, 0x0000, 0xE1A7, 0xEED3, 0xD0C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFDB3, 0x0000, 0xD5E4, 0x0000, 0x0000, 0xCFE8, 0x0000, 0xEDC3, 0xD0B2, 0x0000, 0x0000, 0xCEFE, 0xDAA8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8D0, 0x0000, 0x0000, 0xFDD6, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8D1, 0x0000, 0xF8D2,
+	0xDCD3, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDE2, 0xFBF9, 0xDDC1, 0x0000, 0xE3B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEDDD, 0xCEC4, 0x0000, 0xCBA1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDE3, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCDD,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD2FB,
+	0xCFA1, 0xE4A8, 0x0000, 0xF4B6, 0xECFE, 0x0000, 0x0000, 0xE3AE, 0xE7ED, 0xFDC1, 0xDAE2, 0x0000, 0x0000, 0xD8B3, 0x0000, 0x0000,
+	0x0000, 0xDDE4, 0xF0EF, 0xF6F1, 0xFAF0, 0x0000, 0x0000, 0xD1F5, 0x0000, 0x0000, 0xDACF, 0x0000, 0xDCD4, 0x0000, 0xDCA6, 0x0000,
+	0xEFBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCECF, 0x0000, 0xE0D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9D6,
+	0xECD4, 0xEACB, 0x0000, 0x0000, 0xCABF, 0xD5B0, 0x0000, 0xCFE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1ED, 0x0000, 0xCCCF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE4F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE4ED, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7D8, 0x0000, 0xFDA7, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAAB,
+	0xF6B2, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFF0, 0xF9BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6F4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBDB, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF3D1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9D1, 0xF3A9, 0xD0E0, 0xE9D2, 0x0000, 0xDAE3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE2D2, 0x0000, 0xF6A2, 0xE1F4, 0x0000, 0x0000, 0x0000, 0xDAE4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE7D5, 0xF5BF, 0xCFA2, 0xCDAF, 0xCFA3, 0x0000, 0x0000, 0x0000, 0xCDB0, 0xF1FE, 0xD0A3, 0xE1AF, 0xF8A3, 0x0000, 0xCAA6,
+	0xF7BB, 0xF2EA, 0xDEC8, 0xE9D3, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEC9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFDDE, 0xCAC0, 0x0000, 0x0000, 0x0000, 0xF9EA, 0xD1CE, 0xEED4, 0x0000, 0xD4D2, 0xD9A3, 0xFDA8, 0xD7D9,
+	0xF7CE, 0xFABE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFD6, 0x0000, 0xD7F0, 0x0000, 0xEBE1,
+	0xF8C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCFA, 0x0000, 0x0000, 0xDDC3, 0x0000, 0xF9DF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE7EF, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE5, 0xF6A3, 0x0000, 0xD9FC, 0xFDA9, 0x0000, 0xE7EE, 0x0000,
+	0x0000, 0x0000, 0xD5E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFD0, 0x0000, 0xCDB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF7A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1B2, 0x0000, 0xF1B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCDB2, 0x0000, 0xDAAB, 0x0000, 0xCAA7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3E2, 0xFBBC, 0xD9A4, 0x0000, 0x0000,
+	0xEEBA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBFA, 0x0000, 0xCFA4, 0x0000,
+	0xDCFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF6E3, 0x0000, 0x0000, 0x0000, 0xEDAA, 0x0000, 0x0000, 0xF2A1, 0xCEE1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFAA6, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9E0, 0x0000, 0x0000, 0x0000, 0x0000, 0xECD6, 0x0000, 0x0000,
+	0xE4EE, 0xF9A1, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0x0000, 0xF9EB, 0xEEA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEAAC, 0x0000, 0x0000, 0x0000, 0xCAA8, 0x0000, 0x0000, 0xF4FA, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDD6, 0xFCF6, 0x0000,
+	0x0000, 0x0000, 0xF4C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF8A6, 0x0000, 0xDECA, 0xF2C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7DA, 0x0000,
+	0xD3D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8C5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAE6,
+	0x0000, 0xF3DD, 0x0000, 0x0000, 0x0000, 0xE4DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6E4, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF6F2, 0x0000, 0xDFC2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9FD,
+	0x0000, 0x0000, 0x0000, 0xCCF6, 0x0000, 0x0000, 0xD3BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4AF, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF9E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0A6, 0x0000, 0x0000, 0x0000,
+	0xCBD3, 0x0000, 0x0000, 0x0000, 0xE0BC, 0x0000, 0xF4CA, 0xD4FA, 0x0000, 0xFDAA, 0xF9E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4B7, 0xFDC2, 0xFCB0, 0x0000, 0xFDEC, 0xCAE2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDBD, 0x0000, 0xEAE7, 0xDFC3, 0xD1D2, 0xCEE2, 0x0000, 0xD3A4, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDAB, 0x0000, 0xDFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF2C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7F0, 0x0000, 0xD0EE, 0x0000, 0x0000, 0xF3AA,
+	0x0000, 0x0000, 0x0000, 0xDECB, 0xF6B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1F5, 0xF1B3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7A3, 0x0000, 0x0000, 0xCAA9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCFA5, 0x0000, 0x0000, 0xDFC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1B0,
+	0x0000, 0x0000, 0xF0BF, 0x0000, 0xF6A4, 0x0000, 0xE3B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFAC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0EF, 0x0000, 0x0000, 0xFDED, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDDC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEAD, 0x0000, 0xFABF, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE5F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDC4, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD2A5, 0x0000, 0x0000, 0xFDEE, 0x0000, 0x0000,
+	0x0000, 0xF5B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1F6, 0xDECC, 0x0000, 0x0000, 0xFCDE, 0x0000,
+	0xECD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCDDD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6B7, 0xCDB3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF8D5, 0xE5D8, 0x0000, 0x0000, 0x0000, 0xCFEA, 0x0000, 0x0000, 0xCFD0, 0x0000, 0xEACC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xEAAE, 0xEAAD, 0x0000, 0x0000, 0xD3F1, 0x0000, 0xD3A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7CF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEA4, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0A4, 0x0000, 0x0000,
+	0xF2A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0F0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF2A3, 0x0000, 0xF7F8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B3, 0x0000, 0x0000, 0xDBA9, 0x0000, 0x0000, 0xD3BB, 0xCAEC, 0x0000,
+	0xF1A6, 0xCBD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF7E7, 0x0000, 0x0000, 0xCDDE, 0x0000, 0xF7A4, 0x0000, 0x0000, 0x0000, 0xF8C0, 0x0000, 0x0000, 0x0000, 0xD3DD, 0x0000,
+	0xCCD0, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6F3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE1F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3DC, 0x0000, 0x0000, 0xFAFE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFAA7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEBD9, 0x0000, 0xCFA7, 0xEAAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE4EF, 0x0000, 0x0000, 0x0000, 0xE9B9, 0xF1D8, 0x0000, 0x0000, 0xD8D8, 0x0000, 0x0000, 0xE0F2, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6B4,
+	0xDCFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF3F1, 0x0000, 0x0000, 0x0000, 0xE3D0, 0x0000, 0x0000, 0xF2FB, 0x0000, 0xDBC6, 0xD0F1, 0x0000, 0xD0F2, 0x0000, 0x0000, 0x0000,
+	0xCFDC, 0x0000, 0xD3D1, 0x0000, 0x0000, 0xCCB1, 0xF7D8, 0x0000, 0xCBA8, 0xEBBC, 0xE4BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4DC, 0x0000,
+	0x0000, 0xDCC2, 0x0000, 0x0000, 0xF0A7, 0x0000, 0x0000, 0xE6C0, 0x0000, 0x0000, 0xCAED, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8EB,
+	0xE5E8, 0xDCC3, 0x0000, 0x0000, 0xEDDE, 0xD3F2, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCED4, 0xE7AB, 0x0000, 0x0000, 0x0000, 0xCBC3,
+	0x0000, 0xE1B1, 0x0000, 0x0000, 0xF7B2, 0x0000, 0x0000, 0xD3F3, 0xD3D2, 0x0000, 0xF5C0, 0x0000, 0x0000, 0x0000, 0xDFDD, 0x0000,
+	0x0000, 0xEEF3, 0xE7F1, 0x0000, 0xFDB4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2C8, 0x0000, 0x0000, 0x0000, 0xF3D2, 0x0000, 0x0000, 0xEEF4, 0x0000, 0xE2D3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCCD1, 0x0000, 0xDFEA, 0x0000, 0x0000, 0x0000, 0xE9BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD9D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5CD, 0x0000, 0xF1F2, 0xFAC7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9F8, 0xD4C2, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6E5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDDC5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7F2, 0xEDDF, 0x0000, 0x0000, 0xCACB, 0x0000,
+	0x0000, 0xDBFA, 0x0000, 0x0000, 0x0000, 0xE8B5, 0x0000, 0xD3A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDB5, 0x0000,
+	0x0000, 0xF9C9, 0x0000, 0xE4E2, 0x0000, 0xFBBD, 0x0000, 0x0000, 0xD7A4, 0xCEC5, 0x0000, 0x0000, 0x0000, 0x0000, 0xCED5, 0xD6E6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE5BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDECD, 0xECF3, 0x0000, 0x0000, 0xEDE0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECEC, 0xFBBE, 0xDFEB, 0x0000, 0xE1F8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9BE,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD0F3, 0xE0AA, 0xE8E2, 0x0000, 0x0000, 0xE2D4, 0xD2FD, 0x0000, 0xE5A8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD9D3, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3DE, 0x0000, 0xF4B8, 0xF7BC, 0xDCFD, 0x0000, 0xE8EC, 0xE4E7, 0x0000,
+	0x0000, 0xE3F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECA8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAF1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE5F2, 0x0000, 0x0000, 0xD0F4, 0xD2AF, 0xDCE5, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0A5, 0xF1B4,
+	0xFCB1, 0xCCF8, 0x0000, 0x0000, 0xDDC6, 0xFAD1, 0x0000, 0xF7DF, 0x0000, 0x0000, 0xFAA8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEEF5, 0x0000, 0xDECE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7F3, 0x0000, 0x0000, 0xF7AC, 0xEBC4, 0xEDE1, 0xE0AB, 0xDDC7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD2B3, 0xD2BF, 0x0000, 0x0000, 0x0000, 0xCACC, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBBF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE5FD, 0xDDE5, 0xD8CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD0F5, 0x0000, 0x0000, 0xE8ED, 0xD0D2, 0x0000, 0xD9D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6E6, 0x0000, 0x0000, 0xDBAA, 0x0000, 0x0000, 0x0000, 0xF7E0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8D9, 0x0000, 0xF4A3, 0x0000, 0x0000, 0xF4DD, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xEFD1, 0x0000, 0x0000, 0xD9B5, 0x0000, 0x0000, 0xEDAB, 0x0000, 0xE3B7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEEBB, 0xCDB4, 0x0000, 0xE0F3, 0xEACD, 0x0000, 0x0000, 0x0000, 0x0000, 0xECF5, 0xE8EE, 0x0000, 0xCBA9, 0xF1AF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCACD, 0x0000, 0xECA9, 0x0000, 0xF2EB, 0x0000, 0xFDEF, 0x0000, 0xF9F3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6C1, 0x0000, 0x0000, 0xECD8, 0x0000, 0x0000, 0x0000, 0xEDAC,
+	0x0000, 0xEACE, 0x0000, 0xE8DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDECF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD2A6, 0x0000, 0x0000, 0xE7F4, 0xD1D6, 0x0000, 0x0000, 0xE6C2,
+	0xE3E3, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4B0, 0x0000, 0x0000, 0x0000, 0xD8B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3DE, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD7A5, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7E8, 0x0000, 0x0000, 0xE8C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDDE6, 0x0000, 0x0000, 0x0000, 0xDCFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD8DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAAC, 0xEAB0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE3B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCAAA, 0xE1F9, 0x0000, 0xEAB1, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2EC, 0x0000, 0x0000, 0xFAEE, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEED5, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9F4, 0x0000, 0x0000, 0xD2EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBFB, 0x0000, 0x0000, 0x0000, 0xFDF0, 0x0000, 0xE0BD, 0xCEE3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDFC5, 0x0000, 0x0000, 0xE5BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEDAD, 0xFAEA, 0x0000, 0x0000, 0xCDEE, 0xEDA6, 0x0000, 0xEDAE, 0xF0ED, 0x0000, 0xDDA1, 0x0000, 0xEDAF, 0xFCF8, 0x0000, 0xD8EB,
+	0x0000, 0x0000, 0x0000, 0xCCF9, 0xCDB5, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAA9, 0x0000, 0xE1DD, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE2D5, 0xEDCF, 0x0000, 0x0000, 0x0000, 0xDDA2, 0x0000, 0x0000, 0xF9CA, 0x0000, 0xEAE8, 0x0000, 0xE5ED, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3EB, 0x0000, 0xE9D4, 0xE1FA, 0xE4CC, 0x0000, 0xE1E4, 0xE8C7, 0x0000, 0x0000, 0xCEDB,
+	0x0000, 0x0000, 0x0000, 0xDCD5, 0x0000, 0xF7B5, 0xFCF3, 0xF0F3, 0xCEAF, 0xF1B5, 0xEFD2, 0xE8C8, 0xEBF1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xCBD4, 0xE0BE, 0xE3F8, 0xEAE9, 0xFCB2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0F4, 0x0000, 0xCFE0, 0x0000,
+	0xEEA5, 0x0000, 0x0000, 0xFAAA, 0xE6C3, 0xE1B2, 0xCAAB, 0x0000, 0xE3E4, 0xE9BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2D6,
+	0xF3F2, 0x0000, 0xEED6, 0xEAB2, 0xD0F6, 0xECD9, 0xDACB, 0xCFA8, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDA3, 0x0000, 0x0000, 0x0000,
+	0xD8DB, 0x0000, 0xF9CE, 0xE9D5, 0xE3D1, 0x0000, 0x0000, 0xD2BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8AC, 0xF3CC,
+	0x0000, 0xCDFB, 0xF6D6, 0x0000, 0xE7F5, 0xE8EF, 0xE3F9, 0xD2BB, 0xF3F3, 0xE3FB, 0x0000, 0xDED0, 0xCEB0, 0x0000, 0xD6F7, 0xF1D9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5C1, 0xDCC4, 0x0000, 0xF5BB, 0x0000, 0xDED1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDCE6, 0x0000, 0x0000, 0xDED2, 0x0000, 0x0000, 0xEDE2, 0xEEF6, 0xEACF, 0xF0EE, 0xE3FC, 0x0000, 0xD3DF, 0xD3F4, 0xE1B3,
+	0x0000, 0xE1B4, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4D3, 0x0000, 0x0000, 0xDFC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE9D6, 0x0000, 0x0000, 0x0000, 0xDBAB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF6A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3B9, 0xEBC5, 0xF4A9, 0xCDB6, 0xD2F9, 0x0000, 0xDAAD, 0xD2E3,
+	0xCFD1, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBDC, 0xCCFA, 0x0000, 0xCFDD, 0x0000, 0x0000, 0xE8A9, 0x0000, 0xE3BB, 0xE3BA, 0x0000,
+	0x0000, 0xE0DA, 0x0000, 0x0000, 0x0000, 0xEEF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCB3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD3F5, 0x0000, 0xD7A6, 0x0000, 0xF6B5, 0xD7DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1D5, 0x0000, 0x0000, 0xD4EA,
+	0x0000, 0xDFA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD0F7, 0xEDD4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCBAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4DB, 0x0000, 0xE1FB, 0xCBA2, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD3E0, 0x0000, 0xE4BF, 0x0000, 0xFBC0, 0x0000, 0xDABE, 0xE4CD, 0x0000, 0xD6B9, 0x0000, 0x0000, 0x0000, 0xEFC0, 0x0000,
+	0xE1FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDFC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCE7,
+	0xDCE8, 0x0000, 0x0000, 0x0000, 0xFAD6, 0x0000, 0xD3F6, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1DA, 0x0000, 0xFAF2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5CF, 0xD0F8, 0x0000,
+	0x0000, 0xCDDF, 0x0000, 0x0000, 0xF5CB, 0x0000, 0xE4F0, 0xCBAB, 0x0000, 0xD7C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2FE, 0x0000, 0xDDDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAAE, 0xCAEE, 0x0000, 0x0000, 0x0000,
+	0xD5B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3A1, 0x0000, 0x0000, 0xE8E3, 0x0000, 0x0000, 0xF3AB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFA9, 0x0000, 0x0000, 0x0000, 0xD3F7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4F1, 0x0000, 0x0000,
+	0xCEE4, 0x0000, 0xE8F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7AE, 0x0000, 0xD6BA, 0x0000, 0xDFEC, 0xE4C0, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD8B5, 0x0000, 0x0000, 0x0000, 0xE4DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4B9, 0xF1B6, 0x0000,
+	0x0000, 0xE2DE, 0xE1B5, 0x0000, 0x0000, 0xCDEF, 0xF1A7, 0xCEE5, 0xCBDD, 0x0000, 0x0000, 0xD9E3, 0x0000, 0x0000, 0xF3AC, 0x0000,
+	0x0000, 0xD0F9, 0xECAB, 0xDED3, 0xF7E9, 0x0000, 0x0000, 0xF9F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1DE, 0xCBEE, 0x0000,
+	0x0000, 0x0000, 0xE3BC, 0xF8D6, 0x0000, 0x0000, 0xDBEE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDF1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF7B6, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4DE, 0x0000, 0x0000, 0xF2ED, 0x0000, 0xDBD9, 0x0000, 0xF0A8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDED4, 0x0000, 0xE0AC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xEDE3, 0x0000, 0x0000, 0xD3E1, 0x0000, 0xDFC8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9B6, 0x0000, 0xFDAC,
+	0xEFD3, 0x0000, 0x0000, 0x0000, 0xE4C1, 0xF8EB, 0x0000, 0xDBAC, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCC6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6BA,
+	0x0000, 0xDBDF, 0xD3D3, 0xF8C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xCACE, 0xF8C1, 0xD2B4, 0x0000, 0x0000, 0xDCB4, 0xFAB9, 0xCACF, 0x0000, 0xFCB3, 0xEAEA, 0xEAEB, 0xD0FA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEDE4, 0x0000, 0x0000, 0xDDE7, 0x0000, 0x0000, 0xDFC9, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFED,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEBC, 0x0000, 0xEFC1, 0x0000, 0x0000, 0xCCD2, 0x0000, 0xDDA4, 0x0000, 0x0000, 0x0000,
+	0xDFCA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3F8, 0xF1A8, 0x0000, 0x0000, 0x0000, 0xCDB7, 0x0000, 0xEFD4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4DD, 0xDFEE, 0xCBAC, 0xE9BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAEC, 0x0000,
+	0x0000, 0x0000, 0xDFCB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9BF, 0xD6AF, 0xD5C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCFAA, 0x0000, 0x0000, 0xCEA9, 0x0000, 0x0000, 0xD6F8, 0x0000, 0x0000, 0x0000, 0xF1B7, 0xEEF8, 0x0000, 0x0000, 0x0000, 0xD9D9,
+	0xF3DF, 0x0000, 0xF8C8, 0xCEC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5E6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF4E6, 0x0000, 0x0000, 0xE6C5, 0xEFD5, 0x0000, 0x0000, 0xCBEF, 0xFCDF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDCA7, 0x0000, 0x0000, 0xD6E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8C9, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3D2,
+	0x0000, 0xE3BD, 0x0000, 0xCFE1, 0xF0C0, 0xECDA, 0x0000, 0xDDD7, 0xFBF0, 0x0000, 0x0000, 0xECAC, 0x0000, 0x0000, 0x0000, 0xF0A9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAD7, 0xFBC1, 0x0000, 0xD2C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE5B0, 0x0000, 0x0000, 0x0000, 0xEDE5, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBAD, 0x0000, 0xF9B0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7A5, 0x0000, 0xCBAE, 0x0000, 0xDAAF, 0x0000, 0xD8B6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3A7, 0xFBB2, 0x0000, 0xFDC4, 0x0000, 0xECAD, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFBA1, 0x0000, 0x0000, 0x0000, 0xE5E9, 0xE9EE, 0x0000, 0xF3F4, 0xF8F3, 0xF0C1, 0xDEAF, 0xF8B0, 0x0000, 0x0000,
+	0xF3E0, 0xE7AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBAD, 0x0000, 0xE6B5, 0x0000, 0x0000, 0xF9A8, 0x0000, 0x0000, 0xDDD8,
+	0xE8D9, 0xEFD6, 0x0000, 0x0000, 0x0000, 0xD3E2, 0x0000, 0xE2DF, 0x0000, 0x0000, 0xFCE0, 0xD7C8, 0xFDAD, 0x0000, 0x0000, 0x0000,
+	0xDFEF, 0xCCD3, 0xD3F9, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4F0, 0xDBC7, 0xDED5, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0F4, 0x0000,
+	0xD5D0, 0xE5D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCC7, 0xDCD6, 0xE2E0, 0x0000, 0x0000, 0x0000, 0xDAB0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3A3, 0x0000, 0xD3EC, 0x0000, 0xF4CB, 0x0000, 0x0000, 0x0000, 0xFDC5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE3FD, 0x0000, 0xF9B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0FB, 0xECDB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5BC, 0xF2A4, 0xD8CE, 0xD8CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF5F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6E1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD2B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEC, 0x0000, 0xDDC8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4E8,
+	0x0000, 0x0000, 0xD2C1, 0x0000, 0x0000, 0x0000, 0xF8D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BB, 0xDED6, 0x0000, 0x0000,
+	0xF7BD, 0xECAE, 0x0000, 0x0000, 0x0000, 0xD0E1, 0x0000, 0xE0F5, 0xEAB3, 0x0000, 0xCED6, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCA5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xECF6, 0xE2E1, 0xE3BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCC8, 0x0000, 0x0000,
+	0xCDF0, 0x0000, 0xF9F6, 0x0000, 0x0000, 0xDFF0, 0x0000, 0x0000, 0x0000, 0xE5BF, 0x0000, 0x0000, 0x0000, 0xCEBF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFCE1, 0xEDB0, 0xFDD1, 0xF6BB, 0x0000, 0x0000, 0xF9CF, 0xEBDA, 0xCAC1, 0x0000, 0xD2B8, 0xCDF1, 0x0000, 0xE3D3,
+	0xFDE6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6ED, 0x0000, 0x0000, 0x0000, 0xE3FA, 0x0000, 0x0000, 0xF0AA, 0xF9D0, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFCE2, 0x0000, 0xF8A7, 0x0000, 0x0000, 0x0000, 0xE1E5, 0xEEF9, 0x0000, 0x0000, 0x0000, 0xE7F6,
+	0xEAED, 0x0000, 0x0000, 0xFCB4, 0xF5C2, 0x0000, 0x0000, 0xD7DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF0F5, 0x0000, 0xDDE8, 0xD3ED, 0xF5FC, 0x0000, 0xDABF, 0x0000, 0xCCFB, 0x0000, 0x0000, 0x0000, 0xD3FA, 0xF4A4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFD7, 0x0000, 0xD4C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xFBE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBED, 0x0000, 0xE0AD, 0x0000, 0x0000, 0xEAEE,
+	0xFBB3, 0xE4C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF6E7, 0xD2DD, 0x0000, 0xDFCC, 0x0000, 0x0000, 0xFCC9, 0x0000, 0x0000, 0xE5A9, 0xE0F6, 0xF6B3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE1FE, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBF0, 0x0000, 0xEAEF, 0xEAF0, 0x0000, 0x0000, 0x0000, 0xDAC0, 0xF8B4, 0xEBF2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4C3, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9D7, 0xE4F1, 0x0000, 0x0000, 0x0000, 0xCAEF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCED7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFCCA, 0x0000, 0x0000, 0x0000, 0xF3E1, 0x0000, 0x0000, 0xCBC4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3E5, 0x0000, 0xCBC5, 0xEAB4,
+	0x0000, 0x0000, 0xE9BD, 0x0000, 0xD7C9, 0x0000, 0x0000, 0xEBDB, 0xEDB1, 0x0000, 0xCCC3, 0xF7BE, 0xFCCB, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF8F4, 0x0000, 0xD9B7, 0x0000, 0x0000, 0xF3D3, 0xF3D4, 0x0000, 0x0000, 0x0000, 0xF7E4, 0x0000, 0xF7D1,
+	0x0000, 0x0000, 0xD8B7, 0xCEB1, 0xCAC2, 0x0000, 0x0000, 0xFBB4, 0xCBC6, 0x0000, 0x0000, 0xF0F6, 0x0000, 0x0000, 0xD5E7, 0x0000,
+	0xEAD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCD4, 0xCBAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4AA, 0xE9AF, 0x0000,
+	0x0000, 0xF5C3, 0xE9D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDE9, 0x0000, 0x0000, 0x0000, 0xF1F3, 0x0000,
+	0xD5FB, 0xDEBB, 0x0000, 0x0000, 0xF4FB, 0x0000, 0x0000, 0x0000, 0xFDF3, 0xFDF2, 0xF7A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDDC9, 0x0000, 0x0000, 0xD4D3, 0x0000, 0xCCA8, 0x0000, 0xDAC1, 0xCCD5, 0x0000, 0xD9E4, 0x0000,
+	0x0000, 0x0000, 0xFACA, 0x0000, 0x0000, 0x0000, 0xE5E3, 0x0000, 0x0000, 0x0000, 0xD3BC, 0x0000, 0x0000, 0x0000, 0xCAF0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD0C4, 0x0000, 0x0000, 0x0000, 0xCAD0, 0xFAAB, 0xEBEB, 0xE7F8, 0xD9E5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF3A4, 0x0000, 0x0000, 0x0000, 0xD4FB, 0xFCE3, 0xFAD8, 0x0000, 0xF3D5, 0x0000, 0xCFAB, 0x0000, 0x0000, 0xEBF3,
+	0xD5FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3D4, 0xCDFC, 0x0000, 0xD9E6, 0x0000, 0xE2F9, 0xE2A1, 0xEBD4, 0x0000,
+	0xE0F7, 0xE4B2, 0xCCFC, 0x0000, 0x0000, 0x0000, 0xFBE4, 0x0000, 0x0000, 0x0000, 0xF4AB, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0BD,
+	0x0000, 0xCAF1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFB8, 0x0000, 0x0000, 0x0000, 0xD7C0, 0x0000,
+	0xEEFA, 0xFDF4, 0x0000, 0x0000, 0xD3E3, 0x0000, 0xFBC2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5E8, 0xDBAE,
+	0xE1B6, 0xF8B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0BF, 0xFBC3, 0xDDEA, 0x0000, 0xE2A2, 0x0000, 0xEEA6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF6E8, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDCA, 0x0000,
+	0x0000, 0xD0E2, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDA6, 0x0000, 0x0000, 0xDDEB, 0x0000, 0x0000, 0xE4F9, 0x0000, 0x0000, 0xE3AF,
+	0xD0FC, 0x0000, 0x0000, 0x0000, 0xF4FC, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCBC, 0xF7EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE5E4, 0xDFF1, 0x0000, 0x0000, 0xF7E1, 0x0000, 0xF9F7, 0xEFB9, 0x0000, 0x0000, 0xF8D8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9A9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF8D9, 0x0000, 0x0000, 0x0000, 0xEEBD, 0x0000, 0x0000, 0x0000, 0xD8C6, 0x0000, 0x0000, 0xE4E3, 0xF5CE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDDD9, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9E7, 0xD2B9, 0xD5C3, 0x0000, 0x0000, 0xDAE5, 0xDAD0, 0x0000, 0xD1D9,
+	0xCED8, 0x0000, 0xCBDE, 0xF4AC, 0xDAFB, 0x0000, 0xF6E9, 0xE8F3, 0xCFAC, 0xF0F0, 0x0000, 0xF4FD, 0xDBC8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEC0, 0xE3D4, 0xD1CF, 0xF1F5,
+	0x0000, 0xCDF2, 0x0000, 0xCFEB, 0x0000, 0x0000, 0x0000, 0xCDB8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3A6, 0xD1DA,
+	0x0000, 0xF2A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2A6, 0x0000, 0xE4CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD3FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1A9, 0x0000, 0x0000, 0x0000, 0xF2C9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFD8, 0xE6C9, 0x0000, 0xD8B8, 0xFAF3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3B5, 0x0000, 0x0000, 0xF8A4, 0x0000, 0x0000, 0xD1F3,
+	0xE6C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCE9, 0xDED7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBDF, 0x0000,
+	0x0000, 0x0000, 0xCFEC, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4DF, 0x0000, 0x0000, 0xD1F4, 0xD2BA, 0x0000, 0x0000, 0x0000, 0xDFF2,
+	0x0000, 0x0000, 0x0000, 0xE1B7, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2A3, 0xD3FC, 0x0000, 0x0000, 0xEDE6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDBC9, 0x0000, 0x0000, 0x0000, 0xE4FA, 0x0000, 0xCFDE, 0x0000, 0x0000, 0xCED0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD5D3, 0xF3F5, 0xF7AE, 0x0000, 0x0000, 0xEFC8, 0x0000, 0xCDF3, 0xF5CF, 0xE5F3, 0xF0C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCAD1, 0x0000, 0x0000, 0x0000, 0xEAF1, 0x0000, 0xD0A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9DA,
+	0xF0AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBE7, 0x0000, 0x0000, 0x0000, 0xE5C0, 0xFCB5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE4C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCA9, 0xFDC6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEAB5, 0x0000, 0xE5AA, 0xDFBA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1DF, 0x0000, 0xDAD1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE1B8, 0x0000, 0xE8F4, 0xD3FD, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2A4, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF2CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAE6, 0xF7B3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDCD, 0x0000, 0x0000, 0x0000, 0xF3B6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEED7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF5C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2A7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9B8, 0xD9B9, 0xEFC9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF7CB, 0xDFAE, 0xE8F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD2B5, 0x0000, 0x0000, 0x0000, 0xD3D5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF4CC, 0xDAFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9E8, 0x0000, 0xF7EB, 0xF5C9, 0x0000,
+	0xF3BC, 0x0000, 0xDAD2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3B5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE8B6, 0x0000, 0x0000, 0xD6CF, 0xF4BA, 0x0000, 0xF7C9, 0x0000, 0x0000, 0xCCAA, 0x0000, 0x0000, 0xF0C3, 0xCCD6, 0x0000,
+	0x0000, 0x0000, 0xD0D3, 0x0000, 0xD3BD, 0x0000, 0x0000, 0x0000, 0xDBFB, 0x0000, 0xCBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD3E4, 0xF6F7, 0x0000, 0x0000, 0xD5BA, 0xF3CD, 0xCBE1, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBF4, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF4AD, 0x0000, 0xFCAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7EC, 0x0000, 0x0000, 0x0000, 0xE8F6, 0x0000,
+	0xDAE7, 0x0000, 0x0000, 0x0000, 0xF7CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5C1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0EE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD5FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEE6, 0xFCAB, 0xD5BB, 0x0000, 0x0000, 0xF2A8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2A5, 0xCDB9, 0xEAF2, 0xCBC7, 0x0000, 0xCDF4, 0x0000, 0x0000, 0xDBAF, 0xEFD9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDBA, 0x0000, 0x0000, 0xFCF9, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFF3, 0xCEE7, 0xDAC2,
+	0x0000, 0xCFAD, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7F9, 0xF8A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3E2, 0x0000,
+	0x0000, 0x0000, 0xCAF2, 0xDFA4, 0x0000, 0x0000, 0xD4C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCD7, 0xE5C2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xCDBB, 0x0000, 0xEFDA, 0xEED8, 0x0000, 0xDDA7, 0xE2A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0C0, 0x0000,
+	0x0000, 0x0000, 0xD6B0, 0xF8CA, 0x0000, 0xFCFA, 0x0000, 0xD9FE, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEB0, 0x0000, 0x0000, 0x0000,
+	0xDDEC, 0xDAE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4E0, 0x0000, 0xD6F9, 0x0000, 0xCDD7, 0xDED8, 0x0000, 0x0000, 0xF2F8,
+	0x0000, 0xE4D6, 0x0000, 0x0000, 0xD0C5, 0xF4AE, 0x0000, 0xDDA8, 0x0000, 0x0000, 0x0000, 0xEDC5, 0xF3D6, 0x0000, 0x0000, 0xDED9,
+	0xE3E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3A8, 0x0000, 0xDBB0, 0x0000, 0x0000, 0xE5DA, 0xE3BF, 0x0000, 0x0000,
+	0x0000, 0xDBB1, 0x0000, 0x0000, 0x0000, 0xD5E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0C1, 0xEFDB, 0x0000, 0x0000, 0xF0E9,
+	0x0000, 0x0000, 0xD7B2, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD9E9, 0x0000, 0x0000, 0xD0FE, 0x0000, 0xECED, 0xD3A9, 0x0000, 0xF2A9, 0xF0C4, 0x0000, 0x0000, 0xE2E2, 0xE9EF, 0x0000, 0x0000,
+	0x0000, 0xF9D1, 0x0000, 0x0000, 0xE9D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8DA, 0xDAC3, 0xDAC4, 0xD4C5, 0x0000, 0xE7FA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDE0, 0xE3B0, 0x0000, 0xDBB2, 0xFBC4, 0x0000, 0xF3E3, 0x0000, 0xD9A5, 0xFBE7,
+	0xDDCB, 0xD0D4, 0x0000, 0xE6B6, 0xE0AE, 0xFDDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCB5, 0xE0F8,
+	0xE7B1, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5F0, 0x0000, 0xD8DC, 0xEDC6, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1B9, 0x0000, 0xE3C0,
+	0xF9C0, 0xE9F0, 0x0000, 0x0000, 0xD9DB, 0x0000, 0xF3E4, 0x0000, 0x0000, 0x0000, 0xDCB6, 0xE4E9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF0C5, 0xE3C1, 0xFCCC, 0xFCCD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2CB, 0x0000, 0xF2CC, 0x0000, 0x0000, 0x0000, 0xE4CF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1DB, 0x0000, 0xFAD9, 0x0000, 0xF1B8, 0xFDF5, 0xE0F9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE7FB, 0xFCB7, 0xFCE4, 0xFBC5, 0xE3E7, 0xD8B9, 0x0000, 0xF6F8, 0x0000, 0x0000, 0xDCC5, 0xCCD8,
+	0x0000, 0x0000, 0x0000, 0xE0AF, 0xF4E7, 0x0000, 0xEFDC, 0xCFFC, 0xEFDD, 0x0000, 0xF2AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFDBE, 0x0000, 0x0000, 0xCAAC, 0xFDBB, 0xFDC7, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7B2, 0x0000,
+	0xEAD1, 0xDFF4, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1EC, 0xE4DE, 0xE5C3, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9A6, 0x0000, 0x0000,
+	0xCDBC, 0x0000, 0xF3E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDD5, 0x0000, 0x0000, 0xD9BA, 0x0000,
+	0x0000, 0x0000, 0xEDE7, 0xFBB5, 0xF8EC, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0E7, 0x0000, 0xCCD9, 0x0000, 0x0000, 0xD4C6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE7A5, 0x0000, 0xD5F5, 0xD3BE, 0x0000, 0xFCFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4F2, 0x0000, 0x0000, 0xDFF5, 0x0000, 0x0000, 0xE8F8, 0xF8ED, 0x0000, 0x0000,
+	0xCEC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDF6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE8D8, 0x0000, 0xCDD8, 0xE7D6, 0xCCDA, 0x0000, 0x0000, 0xCAE3, 0xDFF6, 0xF0C7, 0xF0C6, 0x0000, 0xD8BA, 0x0000, 0xF1F4, 0xF4F0,
+	0xF5CC, 0x0000, 0x0000, 0xFCE5, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAC5, 0xEAF3, 0x0000, 0xDDDB, 0x0000, 0xDCD7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDEFD, 0xF2F9, 0x0000, 0xD5C7, 0x0000, 0x0000, 0x0000, 0xD8D0, 0x0000, 0xF0C8, 0xD1A1, 0xD1A2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9D4, 0xD6E8, 0xD9CA, 0x0000, 0xDAB1, 0xD8C7, 0xDCE2, 0xF3CE, 0xF5F4, 0x0000,
+	0x0000, 0xF1B9, 0x0000, 0x0000, 0xDAD3, 0x0000, 0xF6EA, 0x0000, 0x0000, 0x0000, 0xCFF5, 0x0000, 0x0000, 0xFDAE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAD2, 0x0000, 0x0000, 0xDFB4, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7DD, 0xFABA,
+	0xEEA7, 0xF5BD, 0x0000, 0xF8F5, 0x0000, 0x0000, 0xEDE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4E1, 0x0000, 0xD1A3, 0xE1D6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9F8, 0x0000, 0xDBCA,
+	0xCBF9, 0xD4D4, 0x0000, 0xD9DC, 0x0000, 0xEEBE, 0x0000, 0xF7ED, 0x0000, 0x0000, 0x0000, 0xD2EE, 0x0000, 0x0000, 0xE1E6, 0xF7F9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDED, 0x0000, 0xE8DB, 0x0000, 0xDBB3, 0x0000, 0x0000, 0x0000, 0xD1F7,
+	0xE0B0, 0x0000, 0x0000, 0xD4E2, 0x0000, 0xF6D7, 0x0000, 0xD7F9, 0x0000, 0x0000, 0xD8DD, 0x0000, 0xCDFD, 0xF2AB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDBD,
+	0xF8C2, 0x0000, 0x0000, 0xF2AC, 0x0000, 0x0000, 0xCAAD, 0xCAAE, 0xCFAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3C2, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDCB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBDA,
+	0xD9BB, 0xCAF3, 0xF6D3, 0xE6F8, 0xEAF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAF6, 0x0000, 0x0000, 0xF6F9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFAF, 0x0000, 0x0000, 0xCAD3, 0x0000, 0x0000, 0xCAAF,
+	0xD2B0, 0xF1BA, 0x0000, 0xD7B3, 0xE3C3, 0xF3FD, 0xDEDA, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDB, 0x0000, 0x0000, 0xEFDE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE2E3, 0xEEFB, 0x0000, 0x0000, 0xDFF7, 0xD7CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCEE8, 0xDBDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1BB, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9F1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAB7, 0xD0C6, 0x0000, 0x0000, 0xCCAB, 0xEEA8, 0x0000, 0x0000,
+	0xCBFA, 0xF9F9, 0xCCFD, 0xD3FE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2EE, 0x0000,
+	0xD4D5, 0xDFCD, 0x0000, 0xFCB8, 0xD1D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2CD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAD4,
+	0x0000, 0xD5D9, 0x0000, 0x0000, 0x0000, 0xD8DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDD9,
+	0x0000, 0x0000, 0x0000, 0xEEA9, 0xF6BC, 0x0000, 0x0000, 0xCCDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0C9, 0x0000, 0xFCFC,
+	0x0000, 0xE8C9, 0xF4FE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7FC, 0xD7DE, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDC, 0x0000, 0xF0AC,
+	0xCCFE, 0xCDE1, 0x0000, 0xE1BA, 0x0000, 0xDBEF, 0xDAB2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD1A5, 0xDCB8, 0x0000, 0x0000, 0x0000, 0xD8F6, 0x0000, 0xD1A4, 0x0000, 0xCDE2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDCEA, 0x0000, 0x0000, 0xF0F7, 0x0000, 0xF0CA, 0xD0BE, 0x0000, 0xDDDC, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4D6,
+	0xD3D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDD0, 0xCDA1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFB5, 0x0000,
+	0x0000, 0x0000, 0xDFF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4A1, 0xCEB2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE8CA, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3D5, 0xF5D0, 0x0000,
+	0x0000, 0x0000, 0xF5A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE5AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6CB, 0x0000, 0xF5F1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF9A3, 0xE0DB, 0xF6EB, 0x0000, 0xCBF1, 0x0000, 0xD9EA, 0xF5A2, 0x0000, 0x0000, 0x0000, 0xD7D1, 0x0000,
+	0xD1F8, 0xEAF8, 0xEAF9, 0xDAB3, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFDF, 0x0000, 0x0000, 0xF1EF, 0x0000, 0xE5F6, 0xEEBF, 0xE2E4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0BF, 0x0000, 0xFAAC, 0xF5D1, 0xE7B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2CE, 0xDBB4, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCCE, 0x0000, 0xDDEE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7B4, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD7B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7B4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCDBE, 0x0000, 0xDAE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFB0, 0xF7D9, 0xF3E6, 0x0000, 0x0000,
+	0xCED9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEAA, 0x0000, 0xCBC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0A7, 0x0000, 0xF0CB, 0x0000, 0xD0C7,
+	0x0000, 0x0000, 0xE4C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD5DA, 0x0000, 0xD7A7, 0x0000, 0x0000, 0x0000, 0xEEC0, 0x0000, 0xF8F6, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5D2, 0xEDE9,
+	0x0000, 0xD9BC, 0x0000, 0xE5C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5A3, 0x0000, 0x0000, 0xDAD4, 0xE2A7, 0xFBFC, 0x0000, 0x0000, 0xF1DC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCAF4, 0x0000, 0x0000, 0x0000, 0xE8FA, 0x0000, 0x0000, 0xCEE9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE9F8, 0xE2E5, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B9, 0xD4F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1A6,
+	0x0000, 0xDFCE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCF4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD3AA, 0x0000, 0x0000, 0x0000, 0xCCAC, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFE0, 0x0000, 0x0000, 0x0000, 0xE5E5, 0xD0D5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBFC, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCE6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xCBFE, 0xEDEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDEB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9E3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD4A2, 0xCFF6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD6D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5EA, 0xF1EE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFACB, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD5B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFED, 0x0000, 0xEDEB, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD5B2, 0x0000, 0x0000, 0x0000, 0xD5BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFDE2, 0xF3AD, 0x0000, 0xFDDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE9B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1A7, 0x0000, 0x0000, 0xFDE3, 0xCEB3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE4, 0xFACE, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAB0, 0x0000, 0xF7A7, 0x0000,
+	0xCFB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6A2,
+	0x0000, 0xFCB6, 0xF2AD, 0xEFE1, 0xF3AE, 0xDCC6, 0xD9EB, 0x0000, 0x0000, 0x0000, 0xE8E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE1A8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5F6, 0xCFFD, 0x0000, 0x0000, 0xDEDD, 0x0000, 0x0000, 0x0000, 0xD9D1,
+	0x0000, 0x0000, 0x0000, 0xE4EA, 0xF2CF, 0x0000, 0xF7BF, 0x0000, 0x0000, 0xE2E6, 0xE2A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3D6, 0x0000, 0xEDD1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9F9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6B1, 0xDEB2,
+	0x0000, 0x0000, 0xE0E8, 0x0000, 0x0000, 0xD3AB, 0x0000, 0xEBDC, 0x0000, 0x0000, 0xDFAF, 0x0000, 0xCAC3, 0x0000, 0x0000, 0xEEFC,
+	0x0000, 0xFDC3, 0x0000, 0x0000, 0x0000, 0xEBF6, 0xCFB2, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9EC, 0x0000, 0xD9BD, 0x0000, 0xD8DF,
+	0x0000, 0x0000, 0xD4B8, 0xEBBE, 0xDDEF, 0x0000, 0xDDF0, 0xDDF1, 0xDDF2, 0x0000, 0x0000, 0xD9BE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBC6, 0xCFB3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEFD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4AB,
+	0x0000, 0xDAC5, 0x0000, 0xD8EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD1A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE2A9, 0x0000, 0x0000, 0xDEBC, 0xE7B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBF0, 0x0000,
+	0xEFE2, 0xF1F0, 0xCFB4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBF1, 0x0000,
+	0xE0B1, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFA5, 0x0000, 0xF9D2, 0x0000, 0x0000, 0xE7FD, 0x0000, 0x0000, 0xE6A3, 0xFBF1, 0xCBB0,
+	0xF2AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDE7, 0x0000, 0xE8DC, 0x0000, 0x0000, 0xE7D7, 0x0000, 0x0000,
+	0xF7C0, 0x0000, 0xD0E3, 0x0000, 0x0000, 0x0000, 0xDAA1, 0x0000, 0x0000, 0x0000, 0xCCBD, 0x0000, 0x0000, 0xD1A9, 0xDDCC, 0x0000,
+	0x0000, 0xE3FE, 0xD1AA, 0xE8AA, 0x0000, 0xEAB6, 0xF9FA, 0xE6CC, 0xF6D8, 0x0000, 0x0000, 0x0000, 0xD4C7, 0x0000, 0x0000, 0x0000,
+	0xD9CB, 0x0000, 0xD9D2, 0xD3CB, 0xD8F7, 0xDAA9, 0xF5F8, 0x0000, 0x0000, 0xDEDE, 0xF2AF, 0xF8A9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8C8, 0x0000, 0x0000, 0xEEC1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF9C1, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDF3, 0xEAFA, 0x0000, 0xF6BD, 0xE1BB, 0xCDBF, 0xF4D4, 0xE6CD,
+	0x0000, 0xFCCF, 0xFBA2, 0x0000, 0xE0DC, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4BB, 0xDAD5, 0x0000, 0xF9B2, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFBF2, 0x0000, 0xDBF6, 0x0000, 0xDEDF, 0x0000, 0x0000, 0x0000, 0xDBF2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF8DC, 0xF7EE, 0xEBE8, 0x0000, 0xD2FA, 0x0000, 0x0000, 0xF1BC, 0x0000, 0x0000, 0xFADA, 0x0000, 0x0000, 0xDAEA, 0xDAC6,
+	0xF7C1, 0x0000, 0x0000, 0xE7B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5C7, 0xD6AC, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDCC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A9, 0x0000, 0xE2AA, 0x0000, 0xD5A6, 0x0000, 0x0000, 0xD4D7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2D0, 0x0000, 0xEAFB, 0x0000, 0xE0DD, 0xFBF3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF1BD, 0x0000, 0x0000, 0xE2E7, 0xFDD7, 0x0000, 0xCEC8, 0xEAB7, 0x0000, 0xFCC0, 0x0000, 0xFDE7, 0xF7EF, 0x0000,
+	0x0000, 0xD7B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFBA, 0xF1DD, 0x0000, 0xDEB3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE8CB, 0x0000, 0x0000, 0xF8DD, 0x0000, 0x0000, 0xFBC7, 0xD5C8, 0x0000, 0xD7DF, 0x0000, 0xDDA9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE9B1, 0x0000, 0x0000, 0xFAAD, 0xF6D9, 0xFAF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8AA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6EE, 0x0000, 0xCCDC, 0xE1BC, 0xE0EF, 0x0000, 0x0000, 0xE9BF, 0xFCFD, 0xE6CE, 0x0000,
+	0x0000, 0xE1D7, 0x0000, 0xE6CF, 0x0000, 0xF4F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4F3,
+	0x0000, 0x0000, 0xE4FB, 0x0000, 0x0000, 0xF9E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEFE3, 0x0000, 0x0000, 0xCFEE, 0xF6BE, 0xE0B2, 0xFCFE, 0xD1AB, 0x0000, 0x0000, 0x0000, 0xD7FA, 0x0000, 0x0000, 0x0000, 0xFBC8,
+	0x0000, 0xE2D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4A3, 0xF0F8, 0xD7A8, 0x0000, 0x0000, 0x0000, 0xE1E7, 0x0000,
+	0x0000, 0xD3BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFE4, 0x0000, 0xD7C5, 0xEBE2, 0x0000, 0x0000, 0xFCE7, 0x0000,
+	0x0000, 0xE4A2, 0x0000, 0xE2E8, 0x0000, 0xE6D0, 0x0000, 0xFBE8, 0xF4E8, 0xE5F4, 0xF4BC, 0xF4D5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFB6, 0x0000, 0xFCB9, 0xEEC2, 0xCAF5, 0x0000, 0x0000, 0x0000, 0xEFE5,
+	0xCBE2, 0xD4A4, 0x0000, 0xDEE0, 0xDAFD, 0xE4C6, 0xE8BE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0DE, 0xF6B4, 0xEAD2, 0x0000, 0xF9FB,
+	0x0000, 0x0000, 0xE0C2, 0x0000, 0xCAE4, 0x0000, 0xE7B7, 0x0000, 0xEAFD, 0x0000, 0xD9DD, 0x0000, 0xDAB4, 0xEEAA, 0xFBE9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDBCB, 0xDAB5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1BE, 0x0000, 0x0000, 0xD3AC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBC9, 0x0000, 0xDFCF, 0x0000, 0x0000, 0xD3C0, 0xE3D7, 0x0000, 0xEFE6, 0xFCD0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C0, 0x0000, 0x0000, 0x0000, 0xF5D3, 0x0000, 0x0000, 0xECDC, 0xF7B7,
+	0x0000, 0x0000, 0xEAB8, 0xD1F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEAB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7B6, 0xCFB5, 0x0000, 0xD9A8,
+	0x0000, 0x0000, 0xECEE, 0x0000, 0x0000, 0xDDAA, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDA2, 0xE8AE, 0x0000, 0x0000, 0x0000, 0xE1BD,
+	0x0000, 0xF2D1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C1, 0x0000, 0x0000, 0x0000, 0xD2FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDBB5, 0x0000, 0xF3E7, 0xD8FE, 0x0000, 0x0000, 0x0000, 0xFCD1, 0x0000, 0xEDB2, 0xF4AF, 0x0000, 0xFBA3, 0x0000,
+	0x0000, 0xFCC1, 0x0000, 0xEEAB, 0xD4A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4F2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEED9, 0x0000, 0x0000, 0x0000, 0xFBCA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDE3, 0xD8BB,
+	0x0000, 0xE5DB, 0xF8F7, 0x0000, 0x0000, 0x0000, 0xF6D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7A9,
+	0x0000, 0xCBC9, 0x0000, 0x0000, 0xE6D1, 0xF0CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD8AE, 0x0000, 0xF9D3, 0xD5FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8BC, 0xF2B0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE2AB, 0xF3E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFC2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDEC,
+	0x0000, 0xE7B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDAFE, 0x0000, 0x0000, 0xCCBE, 0x0000, 0x0000, 0xF2FC, 0xDAEB, 0x0000, 0xE2D8, 0xEDD6, 0x0000, 0x0000, 0xD6D1, 0xE0B3,
+	0x0000, 0x0000, 0xFCD2, 0x0000, 0xEBC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3C1, 0xF0CD, 0x0000,
+	0xCFF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDD2, 0x0000, 0xD4D8, 0xDCC9, 0xD7F1, 0x0000,
+	0x0000, 0xDFBB, 0x0000, 0x0000, 0xF3A5, 0x0000, 0x0000, 0x0000, 0xF4CD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1BF, 0xF8B1, 0x0000,
+	0xE9FA, 0x0000, 0x0000, 0x0000, 0xFBCB, 0x0000, 0x0000, 0xCAD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF9D4, 0xF7CA, 0x0000, 0x0000, 0xD6C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCE8, 0xF3BD,
+	0x0000, 0xEEFE, 0x0000, 0xE7FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3C2, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3B6, 0x0000,
+	0xCCAD, 0xF6FA, 0xD6B2, 0xD2D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3A5, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7B9, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0AD,
+	0xFBCC, 0xEBA1, 0x0000, 0x0000, 0xD4A6, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBCD, 0x0000, 0xD5BD, 0xF1DF, 0x0000, 0x0000, 0xF6FB,
+	0x0000, 0xDEB4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5EB, 0x0000,
+	0x0000, 0xE5C8, 0x0000, 0x0000, 0x0000, 0xFBA4, 0xD4B9, 0x0000, 0x0000, 0xDEE1, 0x0000, 0xE4A3, 0x0000, 0x0000, 0x0000, 0xD7B7,
+	0x0000, 0xF8EE, 0x0000, 0x0000, 0x0000, 0xDEB5, 0x0000, 0x0000, 0xD6D2, 0x0000, 0xF9D5, 0xE7BA, 0xEBD5, 0xD5F7, 0xEFE7, 0xE1BE,
+	0x0000, 0x0000, 0x0000, 0xFAAE, 0x0000, 0x0000, 0x0000, 0xD6E9, 0xD6EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7BB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECCB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5B3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEB4, 0x0000, 0x0000, 0x0000,
+	0xFBA5, 0xE1EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7A8, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBCE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD8BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBFD, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFCE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFB6, 0x0000, 0x0000, 0x0000, 0xEDC7, 0xEEAC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCDD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6A7, 0x0000, 0x0000, 0x0000, 0xE6FA, 0x0000,
+	0x0000, 0x0000, 0xF5A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDDC, 0xEDB3, 0xCEC9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEFE8, 0x0000, 0x0000, 0xE1BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFADB, 0xCBE3, 0xF7A9, 0x0000, 0xFBA6,
+	0x0000, 0x0000, 0x0000, 0xDCB9, 0x0000, 0x0000, 0x0000, 0xF1C0, 0xEDC8, 0xEFC3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6AD, 0x0000, 0x0000, 0xFDCE, 0x0000, 0x0000, 0x0000, 0xE8A1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBF4, 0xD5A7, 0x0000, 0x0000, 0x0000, 0xF1F6, 0x0000, 0xE6D3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCCDE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8B2, 0x0000, 0x0000, 0x0000, 0xDCEB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFDB6, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5EA, 0x0000, 0x0000, 0xF1E0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBCC, 0xDDCD, 0x0000, 0x0000, 0x0000, 0xD4C8, 0x0000,
+	0x0000, 0xD9ED, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE6FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDC8, 0x0000, 0xD6A1, 0xFDBF, 0x0000, 0xFCD3, 0x0000, 0xEFA1, 0x0000,
+	0xE7BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1EE, 0x0000, 0x0000, 0xE6D5, 0x0000, 0x0000, 0xE9F2, 0x0000, 0xDFB0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD8E0, 0xFCBA, 0xFDAF, 0xF0CE, 0x0000, 0xDBE1, 0x0000, 0x0000, 0xE5C9, 0x0000, 0xEDB4, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0C3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE3D8, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9FB, 0xEAA8, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDB7,
+	0x0000, 0x0000, 0xFBA7, 0x0000, 0xE9C2, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2D9,
+	0x0000, 0x0000, 0xDCEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8A2, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE6F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDF8, 0xFDF9, 0x0000, 0x0000, 0x0000, 0xF6BF, 0x0000,
+	0x0000, 0xE7A7, 0x0000, 0xE6D7, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4F3, 0xD4C9, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6FA, 0x0000,
+	0xD7F2, 0x0000, 0xE1C0, 0x0000, 0xDBE2, 0xE6D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7BD,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0CF, 0xF3BE, 0xE2AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5B7, 0xE0F0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDB8, 0xE3E8, 0x0000, 0xD4A7, 0xE8FC,
+	0xFAD2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD6D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5B4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0D0, 0x0000, 0xF7F0, 0xEEB3, 0x0000, 0x0000,
+	0xEABA, 0x0000, 0xEAD3, 0x0000, 0x0000, 0xEDC9, 0xDDAB, 0x0000, 0x0000, 0x0000, 0xE5AC, 0xFDA1, 0x0000, 0xDFD0, 0xECB3, 0x0000,
+	0xDFD1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDED, 0xF8B8, 0xF7FA, 0x0000, 0x0000, 0x0000, 0xF8AB, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF4E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4BA, 0xE4B3, 0x0000, 0xE9DA, 0x0000, 0xDEB6, 0x0000, 0xD9BF,
+	0x0000, 0xD9C0, 0xD6EF, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9CC, 0x0000, 0xDAAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDFE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7E5, 0x0000, 0x0000, 0x0000, 0xCCB2, 0x0000, 0x0000,
+	0xDFF9, 0xD7E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD4BB, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDFA, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCB3, 0x0000, 0x0000, 0xDBF3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDFD2, 0x0000, 0xCECA, 0x0000, 0xEEDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4E4, 0x0000,
+	0xFBCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFB7, 0x0000, 0xEEC3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCEEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7E1, 0xFAF5, 0x0000, 0x0000, 0xD5C9, 0xF8AC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3E9, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8ED, 0xE3C4, 0xF0F1, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8E5, 0x0000, 0x0000, 0x0000, 0xE0FA, 0xEEC4, 0xD9DE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBA2, 0xEBA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCC2, 0xEABB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE8AB, 0xDEE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEDEF, 0x0000, 0xE8A3, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFF1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4BC, 0x0000, 0xFCEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE7BE, 0x0000, 0xFCF2, 0x0000, 0x0000, 0xD6B4, 0x0000, 0x0000, 0xE2AE, 0x0000, 0xD3B7, 0xFACC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFADC, 0x0000, 0xEDB5, 0xE1E3, 0x0000, 0xE8AC, 0x0000, 0xE8DD, 0x0000, 0x0000, 0xEFE9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF4BD, 0x0000, 0xCFB8, 0xE9DB, 0xD1AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAC7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBC9, 0x0000, 0xE8CC, 0x0000, 0x0000, 0x0000, 0xDEB7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD6BC, 0xD3E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFADD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDAD6, 0x0000, 0xCAB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAC8, 0xDFA6, 0x0000, 0xF9B3, 0xF2D2, 0x0000, 0xCAC4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCECB, 0x0000, 0x0000, 0xCDF5, 0x0000, 0x0000, 0x0000, 0xFDB0, 0xD5A8, 0x0000,
+	0xF1C1, 0x0000, 0x0000, 0xE2E9, 0xDCCA, 0xECB4, 0xFAC0, 0x0000, 0x0000, 0xFBA8, 0xD0A8, 0x0000, 0x0000, 0xDAEC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9EE, 0x0000, 0xE0FB, 0x0000, 0x0000, 0x0000, 0xEFEA, 0xFADE, 0x0000,
+	0x0000, 0xE0C4, 0x0000, 0xCFB9, 0x0000, 0xD5CA, 0xD7E2, 0xE2AF, 0x0000, 0xD7B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE8CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6DA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEFA2, 0xE2DA, 0xF6FC, 0x0000, 0x0000, 0xFBD0, 0xD1AD, 0x0000, 0xCDE4, 0x0000, 0xD1AE, 0xDCED, 0xE8CE, 0x0000, 0xF0F9, 0xCEB5,
+	0xE6FC, 0x0000, 0x0000, 0xD7FB, 0xD0D6, 0xDDF5, 0xF7F1, 0x0000, 0xF6FD, 0x0000, 0xDBF7, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEA,
+	0xE9DC, 0xD9C1, 0x0000, 0xF5F2, 0xE0C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAD4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9C2, 0x0000, 0xEABC, 0x0000, 0xD2C5, 0xFBD1, 0xE7C0, 0xEBA5, 0x0000, 0xDFFA, 0xE3A2,
+	0xD7B9, 0x0000, 0xE9C3, 0x0000, 0xE8FD, 0xE8AF, 0x0000, 0x0000, 0xF2D3, 0xFBA9, 0xD8A5, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5CB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0C8, 0x0000,
+	0x0000, 0x0000, 0xD1AF, 0xD7E3, 0x0000, 0x0000, 0x0000, 0xE0C6, 0x0000, 0xD6A2, 0x0000, 0xEDF0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7F3, 0x0000, 0x0000, 0x0000, 0xFCD4, 0x0000, 0xDAD7, 0xCCDF,
+	0x0000, 0xF2D4, 0x0000, 0xD1B0, 0x0000, 0xCCE0, 0x0000, 0xDBFD, 0xF3BF, 0x0000, 0xF0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFCBB, 0x0000, 0xE2B0, 0x0000, 0x0000, 0xE6A5, 0x0000, 0x0000, 0x0000, 0xE2DB, 0x0000, 0x0000, 0x0000, 0xDFDE, 0x0000, 0xE0C7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2EF, 0x0000, 0x0000, 0x0000, 0xCCE1, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6EA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE7C2, 0x0000, 0x0000, 0x0000, 0xCEB6, 0x0000, 0xF3C0, 0x0000, 0xCDFE, 0x0000, 0x0000, 0x0000,
+	0xFBD2, 0x0000, 0xF8F8, 0xF7FB, 0x0000, 0x0000, 0xE8BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8B7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDB6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDCBA, 0x0000, 0x0000, 0xCCB4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF1F7, 0x0000, 0x0000, 0x0000, 0xE8B8, 0x0000, 0x0000, 0xCAF6, 0x0000, 0xE4A4, 0xF4D6, 0x0000, 0x0000, 0x0000, 0xDFE6,
+	0x0000, 0x0000, 0x0000, 0xDFA7, 0x0000, 0xDFE7, 0xE1C1, 0x0000, 0xE9C4, 0x0000, 0x0000, 0xDCCB, 0xE9C5, 0x0000, 0x0000, 0x0000,
+	0xEFA3, 0xEBA6, 0xCBA3, 0xE3E9, 0x0000, 0x0000, 0x0000, 0xD1FB, 0xEFA4, 0x0000, 0xEFEB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B4, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDA3, 0x0000, 0x0000, 0xE8E6,
+	0x0000, 0xEFA5, 0x0000, 0xD3CC, 0xDAED, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7BA, 0x0000, 0xF2D5, 0xF5E5, 0xD9EF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF9B4, 0x0000, 0x0000, 0xD5D4, 0xFDCF, 0x0000, 0x0000, 0x0000, 0xDBE3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1E1,
+	0xECB6, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBFE, 0xD3D7, 0x0000, 0xD1B1, 0x0000, 0xCBB1, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1B2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBB2, 0xF1C2, 0x0000, 0x0000, 0xF4E1, 0xF9B5, 0x0000, 0x0000, 0xE1C3, 0xE1C2,
+	0x0000, 0xEBF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFA8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBCA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6B9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF8DE, 0xF9AA, 0xCAF7, 0x0000, 0xEDB7, 0x0000, 0x0000, 0xD3B8, 0xF2D6, 0x0000, 0x0000, 0xD4D9, 0xEEC5, 0xF2F0, 0x0000,
+	0x0000, 0x0000, 0xCAB2, 0x0000, 0x0000, 0xDCBB, 0x0000, 0xF1F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECB7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE5CA, 0x0000, 0xF6C0, 0xFDDD, 0x0000, 0x0000, 0xD4E3, 0xCCE2, 0x0000, 0xF7D4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD7E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD3C3, 0x0000, 0xD8A6, 0x0000, 0xF6C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDF6, 0x0000, 0xCDC0, 0x0000, 0x0000, 0x0000,
+	0xE5DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5CB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8B0,
+	0xF4B0, 0xF3EA, 0xDAEE, 0x0000, 0xD7BB, 0x0000, 0xE2B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7AA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD6FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4DF, 0x0000, 0xCAD6, 0x0000,
+	0x0000, 0x0000, 0xEBA8, 0x0000, 0x0000, 0x0000, 0xDBFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF6C2, 0x0000, 0x0000, 0xEFBB, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4FD, 0x0000, 0x0000, 0xE0C8, 0x0000, 0x0000, 0x0000,
+	0xE8B9, 0x0000, 0xEFA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDA4, 0x0000, 0x0000, 0xD4F4, 0xDBA1, 0xDBDC, 0xDBDD, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEEDC, 0x0000, 0xCBCB, 0xFCD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEEB, 0x0000,
+	0xCDC1, 0x0000, 0x0000, 0xFBD3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9AB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5D4, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9A9,
+	0x0000, 0x0000, 0xE9DD, 0xDBCD, 0x0000, 0x0000, 0xDDCE, 0x0000, 0xE7C3, 0x0000, 0xECCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF9EC, 0x0000, 0x0000, 0x0000, 0xCBCC, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0FC, 0xD4A8, 0x0000, 0xEDD3, 0xD8EF,
+	0x0000, 0xF2D7, 0x0000, 0xCAF8, 0xDAEF, 0x0000, 0x0000, 0xD6D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9CD, 0x0000,
+	0x0000, 0x0000, 0xD8EE, 0x0000, 0xF2C1, 0x0000, 0x0000, 0x0000, 0xDFD3, 0x0000, 0x0000, 0x0000, 0xDAF0, 0x0000, 0xE2EA, 0x0000,
+	0x0000, 0xE0FD, 0x0000, 0x0000, 0xD8F8, 0x0000, 0x0000, 0x0000, 0xF7AF, 0xDAB6, 0x0000, 0xCAD7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2D8, 0x0000,
+	0xD8F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFEF, 0xD9C2, 0x0000, 0xF0D2, 0x0000, 0xE4D1, 0x0000, 0x0000, 0x0000,
+	0xF3B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAE0, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFEC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE2B2, 0x0000, 0xD4BD, 0x0000, 0x0000, 0xD9CE, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4E2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4A9, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDC2, 0xE7DA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2D9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD9AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8BE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCAD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2EB, 0xD6FC, 0x0000, 0x0000,
+	0xCAF9, 0x0000, 0x0000, 0xD4DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4D7, 0xCCA1, 0x0000, 0x0000, 0xCFBA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5B8, 0x0000, 0x0000, 0x0000, 0xD9C3, 0xD0E8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE3C5, 0xEBF8, 0x0000, 0xF2B1, 0x0000, 0x0000, 0x0000, 0xCFBB, 0x0000, 0x0000, 0x0000, 0xD3AD, 0xE8E1, 0xCEEC,
+	0x0000, 0x0000, 0x0000, 0xE0B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDEE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xDDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2B2, 0xF3F6, 0xF6DB, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7FE, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF8DF, 0x0000, 0xF7F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6DA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5A6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7BC, 0xCCE3, 0x0000, 0x0000, 0xE6DB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDDD, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD1B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFED, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6DE, 0xE4F4, 0xE1EF, 0x0000,
+	0x0000, 0xDDF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCAE5, 0x0000, 0x0000, 0x0000, 0xDCA1, 0x0000, 0xE0B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCAC, 0xFCAD, 0xD8A7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEDB8, 0x0000, 0x0000, 0x0000, 0xDBB6, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6F0, 0xF3AF, 0x0000, 0x0000, 0xCDA5, 0x0000,
+	0xDAF1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8A8, 0x0000, 0x0000, 0x0000, 0xCCE4, 0x0000, 0x0000, 0xD1B4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAF2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF5A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5A8, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5EC, 0xD5F8, 0xDAF3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3C6, 0x0000, 0x0000, 0x0000, 0xDEE4, 0x0000,
+	0xDEE5, 0xD1B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1B6, 0xD1B7, 0xF2B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE9DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0D3, 0xF2B4, 0x0000, 0x0000, 0xF0D4, 0xCBE4, 0xFBD4, 0xF5E6, 0xE3EA, 0x0000,
+	0xDEE6, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFD4, 0x0000, 0x0000, 0xF8F9, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0AE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1B8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6DF,
+	0x0000, 0xD0D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCA1, 0xEFEE, 0xDCD8,
+	0x0000, 0xE9DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5DD, 0xFDFB, 0x0000, 0x0000, 0xE0C9, 0x0000, 0x0000, 0x0000, 0xD6C9, 0x0000,
+	0x0000, 0xD4AA, 0x0000, 0xE5CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E0, 0x0000, 0x0000, 0x0000, 0xD0D8, 0xFCA2, 0xD4BE,
+	0xE2B3, 0xDEE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCBC, 0xD2B6, 0xF5D5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCEA1, 0xF5A9, 0x0000, 0x0000, 0xDDF9, 0x0000, 0x0000, 0xDDFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0D5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF6DF, 0x0000, 0xF2DA, 0xE4EB, 0x0000, 0xF2F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECB9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFDFC, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1AA, 0x0000, 0x0000, 0xCAD9, 0x0000, 0x0000, 0xEFEF, 0x0000, 0xF5AA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xECF9, 0x0000, 0x0000, 0xF8AD, 0x0000, 0xF2C2, 0xF6C3, 0x0000, 0xD7D2, 0x0000, 0x0000, 0xF9A2,
+	0xF0D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0FA, 0x0000,
+	0x0000, 0xF6E0, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9F3, 0xF2C3, 0x0000, 0x0000, 0x0000, 0xD4AB, 0xCAB3, 0xCDA6, 0x0000, 0xCDC3,
+	0xCDDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9CF, 0x0000, 0x0000, 0xF6C4, 0x0000, 0x0000, 0x0000, 0xEEDD, 0xE7C4, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDFE2, 0xE7DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8B1, 0x0000, 0xFCAE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE5CD, 0x0000, 0x0000, 0x0000, 0xFAEB, 0x0000, 0xCFBC, 0x0000, 0x0000, 0xCFE2, 0xCDF6, 0x0000, 0x0000, 0xEFF0, 0x0000, 0xF4BE,
+	0x0000, 0xD4CD, 0x0000, 0x0000, 0xF3B8, 0x0000, 0x0000, 0x0000, 0xE9A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF2F2, 0xF3EB, 0x0000, 0xF0D7, 0x0000, 0x0000, 0xCFD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFDF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8C0, 0xE8C1, 0x0000, 0x0000, 0x0000, 0xCFE3, 0xE9A2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF3C1, 0xD0AB, 0x0000, 0xD4E4, 0x0000, 0x0000, 0xEFBC, 0xD8A1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9DF, 0x0000, 0xF3D7, 0x0000, 0x0000, 0x0000, 0xDCBD, 0x0000, 0xCCE5,
+	0xEDF1, 0x0000, 0x0000, 0xF1E2, 0x0000, 0xD4DB, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2B5, 0x0000, 0x0000, 0xCAE6, 0x0000, 0xD3AE,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCE6, 0x0000, 0x0000, 0xF1D3, 0xF5E7, 0x0000, 0x0000, 0x0000, 0x0000, 0xCADA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEE,
+	0x0000, 0xE1C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFE9, 0x0000, 0xEEDE, 0x0000, 0x0000, 0xF7C2, 0x0000,
+	0xD8A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDAC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0AF, 0xD6BD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9B6, 0x0000, 0x0000, 0xD4F5, 0x0000, 0xD0C9, 0xEFA7, 0xE2EC, 0x0000, 0xDBEA,
+	0xCECC, 0xF5E8, 0xF7D5, 0x0000, 0xD3CD, 0x0000, 0xF3FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD0B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0FE, 0x0000, 0xDFFB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8A4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBCD, 0x0000, 0x0000, 0x0000, 0xEFA8, 0x0000, 0x0000, 0x0000, 0xEEB4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDAD8, 0xD1B9, 0x0000, 0xDFA9, 0x0000, 0x0000, 0xF3B0, 0x0000, 0x0000, 0xCCC4, 0x0000, 0x0000,
+	0x0000, 0xCEB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFA9, 0x0000, 0x0000,
+	0x0000, 0xDFD5, 0x0000, 0x0000, 0xEDD7, 0x0000, 0x0000, 0x0000, 0xEEC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEFBD, 0xFCD6, 0x0000, 0x0000, 0xDBF4, 0x0000, 0xEFAA, 0xF8B9, 0x0000, 0xF5E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE3D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE1C6, 0x0000, 0x0000, 0x0000, 0xD4BF, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF3C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3AF, 0x0000,
+	0x0000, 0xCADB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCD7, 0x0000, 0x0000, 0xEDD8, 0xE1C7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4D8, 0xD6B3, 0xDDAD,
+	0x0000, 0x0000, 0x0000, 0xD5BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1C3, 0xEEDF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD6EB, 0x0000, 0x0000, 0x0000, 0xF4D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7E6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDAB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDDFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD8A3, 0x0000, 0x0000, 0xDAD9, 0x0000, 0xF0D8, 0xEFC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1D8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1D4, 0x0000, 0xEDF2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5DB, 0x0000,
+	0x0000, 0xD5DC, 0xF3C4, 0xCBD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2B6, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFF1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDD0, 0xF0D9,
+	0xCBB3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDA7, 0x0000, 0x0000, 0xD0AC, 0x0000,
+	0xD1BA, 0x0000, 0xF1C4, 0x0000, 0xE5B3, 0xFBF5, 0xE9E1, 0xFDE0, 0xFCBC, 0x0000, 0xDAA2, 0xDAA3, 0x0000, 0xD2A1, 0x0000, 0x0000,
+	0xD2EF, 0x0000, 0x0000, 0x0000, 0xE2ED, 0x0000, 0x0000, 0xDEE9, 0xCEDC, 0xF2B5, 0xD0E4, 0xDDD1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE1C8, 0xDBB7, 0xDFE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDB9, 0xF1C5, 0x0000, 0xF3CF, 0xD7AB,
+	0xE1AC, 0x0000, 0x0000, 0xE3EB, 0x0000, 0xEEC7, 0x0000, 0x0000, 0x0000, 0xE1C9, 0xCAFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF0FB, 0xFAE1, 0xF0DA, 0xCCE7, 0xDAF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCCBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEED, 0x0000,
+	0x0000, 0xD5A9, 0xFAE2, 0x0000, 0x0000, 0x0000, 0xD0E5, 0x0000, 0xEBD6, 0x0000, 0xECDF, 0x0000, 0x0000, 0x0000, 0xDFFC, 0x0000,
+	0x0000, 0xF7D6, 0xDEEA, 0xCBB4, 0x0000, 0x0000, 0xEFBE, 0x0000, 0x0000, 0xCCB5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFBD,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFF2, 0xE2B7,
+	0x0000, 0x0000, 0x0000, 0xCCE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0FC, 0x0000, 0x0000, 0x0000,
+	0xD6E0, 0x0000, 0xF1C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2B8, 0xEBAB, 0x0000, 0x0000,
+	0x0000, 0xCBB5, 0xD8D1, 0x0000, 0xF4CE, 0xF3F7, 0x0000, 0x0000, 0xD7C6, 0x0000, 0xD1BB, 0xF7AA, 0x0000, 0xEDCA, 0xD7D3, 0xD8FA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6C5, 0x0000, 0x0000, 0xD1CC, 0xDDFC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFFD, 0x0000, 0xF9E5, 0x0000, 0xE0CA, 0x0000, 0x0000, 0xF2FD, 0xD3B0, 0x0000,
+	0xF4F3, 0xDAC9, 0x0000, 0xE6DE, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8BA, 0xE8D0, 0x0000, 0x0000, 0xD8FB, 0x0000, 0x0000, 0xEAD5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD6A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6C6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2DB, 0xE4FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDADA, 0x0000, 0xF2DC, 0xFBD6, 0xE9B2,
+	0x0000, 0xEEAD, 0x0000, 0xFAE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCEE, 0x0000, 0x0000, 0xF5EA, 0xE6E0,
+	0x0000, 0xF0FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5C5, 0xEEE0, 0x0000,
+	0x0000, 0xDBE5, 0x0000, 0xDDDE, 0x0000, 0x0000, 0xD9F0, 0xE9A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF1F9, 0x0000, 0xF2C4, 0xE0CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9A4, 0x0000,
+	0x0000, 0xE2B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3B1, 0xFCEB, 0xCDA8, 0x0000, 0xCCB6, 0x0000, 0x0000,
+	0xF0DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6BA, 0x0000, 0x0000, 0xCDA9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF3C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1D9, 0x0000, 0x0000, 0xEFAB,
+	0x0000, 0x0000, 0x0000, 0xE7C5, 0x0000, 0x0000, 0xE0E9, 0x0000, 0xF3C5, 0x0000, 0x0000, 0xD4C0, 0xD5BF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDAE, 0x0000, 0xF9FC, 0x0000, 0xCCC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A2, 0x0000, 0x0000, 0x0000,
+	0xCEB8, 0x0000, 0x0000, 0x0000, 0xD8D2, 0xF9D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1AA, 0xCED1, 0x0000, 0x0000, 0xF6C7, 0x0000,
+	0xDBEB, 0x0000, 0xDFFE, 0x0000, 0x0000, 0xD8E1, 0x0000, 0xF7F3, 0x0000, 0xD7E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4FE, 0x0000, 0x0000, 0xD1BC, 0x0000, 0xE5CF, 0x0000, 0xCBB6, 0x0000, 0xDAB8, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCDC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BE, 0x0000, 0x0000, 0x0000, 0xE2BA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCFD8, 0x0000, 0x0000, 0x0000, 0xE0CC, 0xEBF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFDFD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7E8, 0xCBD8, 0x0000, 0x0000, 0x0000, 0xE9E2, 0x0000, 0x0000,
+	0x0000, 0xE8BA, 0x0000, 0x0000, 0x0000, 0xE3C7, 0x0000, 0x0000, 0x0000, 0x0000, 0xECCD, 0x0000, 0xECCE, 0x0000, 0xD6BF, 0x0000,
+	0x0000, 0x0000, 0xE3A7, 0x0000, 0xDFD6, 0xFDE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEE1,
+	0xF6A8, 0xDDFD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8BB, 0x0000, 0xE8D1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF9D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEEE, 0x0000, 0x0000, 0xECCF, 0x0000, 0x0000, 0x0000,
+	0xE9A5, 0xD6D5, 0x0000, 0xCDC5, 0x0000, 0xEDBA, 0xD1BD, 0x0000, 0x0000, 0xCFBE, 0x0000, 0x0000, 0xECBB, 0x0000, 0x0000, 0x0000,
+	0xD2B1, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCE9, 0x0000, 0xD9C4, 0xE9FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1BE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xECBC, 0x0000, 0x0000, 0xE5AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7B0, 0x0000, 0xCCEA,
+	0x0000, 0x0000, 0x0000, 0xD3C4, 0x0000, 0x0000, 0xD6C0, 0x0000, 0x0000, 0x0000, 0xD6FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A1, 0x0000, 0xDEBD, 0x0000, 0xF6A9, 0x0000, 0x0000, 0x0000, 0xDAA4, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6A4,
+	0xF5C6, 0x0000, 0xE1A2, 0xE9C6, 0x0000, 0x0000, 0x0000, 0xF2C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4E9, 0xD6EC, 0xEBD3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xECBD, 0xE2DC, 0xDEEB, 0xF0DC, 0x0000, 0xEBBF, 0x0000, 0xD7CE, 0xD1BF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5AB, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9FD, 0x0000, 0xCADC, 0x0000, 0x0000,
+	0x0000, 0xCDC6, 0xF2B6, 0x0000, 0x0000, 0xDDFE, 0x0000, 0x0000, 0x0000, 0xCCB7, 0xDBB8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0E9,
+	0x0000, 0xCEDD, 0xEBC0, 0x0000, 0xFDA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xEAD6, 0xF1B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBCE, 0x0000, 0xF7C3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBCF, 0xCBA4, 0x0000, 0x0000, 0xF8E0, 0x0000,
+	0x0000, 0xFBD7, 0x0000, 0x0000, 0xEBCA, 0xE0A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCECD, 0x0000, 0x0000, 0xD4DC, 0x0000, 0x0000, 0x0000, 0xFDD8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD2F6, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF2B7, 0x0000, 0x0000, 0xFAF6, 0xF6AA, 0xFAF7, 0xD8E6, 0x0000, 0xF4B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8D2, 0x0000, 0xCAC5, 0xCCEB, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE2EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2BB, 0x0000, 0xF7AD, 0x0000, 0x0000, 0x0000, 0xF8E1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3EC, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEA1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4FD, 0x0000, 0x0000, 0xE3EC, 0x0000,
+	0xDDAF, 0xDDB0, 0x0000, 0x0000, 0xCBB7, 0xE8D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A3, 0xD2E0, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0FE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE9A6, 0xCBF2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDF3, 0xDCD9, 0xE0CD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DA,
+	0xDBB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCAE, 0x0000, 0xDADB, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDC7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDB1, 0x0000, 0xD8AF, 0xE3A3, 0x0000, 0x0000,
+	0xCEEF, 0x0000, 0x0000, 0xF2F3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE0CE, 0x0000, 0xF5FD, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBEC, 0x0000, 0x0000, 0xD3C5, 0xFCEC, 0xD2DB,
+	0xD4EB, 0x0000, 0xDEA2, 0x0000, 0x0000, 0x0000, 0xE5E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0B0, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDF4,
+	0x0000, 0x0000, 0x0000, 0xE3ED, 0x0000, 0xE8C2, 0x0000, 0xEDF5, 0xD7FC, 0x0000, 0xEDBB, 0x0000, 0x0000, 0xF6AB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF2B8, 0xF6C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3E6, 0xF2DD, 0xCFBF, 0x0000, 0xEBAC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFC0, 0x0000, 0xE6A8, 0xFDE9, 0x0000, 0xCFC1, 0x0000, 0xE0DF, 0xDEEC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE0A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4BF, 0xE2EF, 0x0000, 0xD9F1, 0xF1C7,
+	0x0000, 0xCBB8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9FE, 0xDBBA, 0xDAF5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6EC, 0xDADC, 0xFAE4, 0x0000, 0xE0CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDDB2, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6A9, 0x0000, 0xEFF3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEBFA, 0x0000, 0xF9E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCADD, 0xD5DE,
+	0x0000, 0xCADE, 0xDFE4, 0x0000, 0x0000, 0x0000, 0xE6FD, 0x0000, 0xF5AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4F5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E3, 0x0000, 0xEDCB, 0xCFE4, 0x0000,
+	0x0000, 0x0000, 0xD8D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDB3, 0xD4EC, 0x0000, 0x0000, 0xF2B9, 0x0000, 0xDFB7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBCE, 0xFBD8, 0x0000, 0x0000, 0xD0D9, 0x0000, 0x0000, 0xDDD2, 0xF7F4, 0xE7DC, 0xE4A5,
+	0x0000, 0xFCA3, 0x0000, 0xDBBB, 0x0000, 0x0000, 0x0000, 0xF2BA, 0xE9FD, 0xD0CA, 0x0000, 0xF5D6, 0xD9C5, 0xE4B4, 0x0000, 0xEDA7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEABD, 0xE6FE, 0x0000, 0xF7C4, 0xF5AD, 0x0000, 0xD9E0, 0x0000, 0x0000, 0x0000, 0xCAB4, 0x0000, 0x0000, 0xF8E2, 0xCFC2,
+	0x0000, 0xECBE, 0x0000, 0x0000, 0x0000, 0xE5B4, 0xCDC8, 0xEEC8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE7C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDC9, 0xF9B7, 0x0000,
+	0x0000, 0xF1E8, 0xD9F2, 0xDBF5, 0xCAB5, 0xD9C6, 0x0000, 0x0000, 0x0000, 0xD8C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDBC, 0x0000, 0x0000, 0xD8D4, 0x0000, 0x0000, 0x0000, 0xDCDA,
+	0x0000, 0xE2BC, 0x0000, 0x0000, 0xFCED, 0xECE0, 0xD2FE, 0x0000, 0xE9C7, 0xE6AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE2F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFABB, 0x0000, 0xF5AE, 0xFBAA, 0x0000, 0x0000, 0x0000, 0x0000, 0xECFB,
+	0x0000, 0xECBF, 0xFCD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD4E5, 0x0000, 0x0000, 0x0000, 0xF9C3, 0x0000, 0x0000, 0x0000, 0xEEE2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7E9, 0xEDF6, 0x0000, 0x0000, 0x0000, 0xDEED, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCEC, 0x0000, 0xE3EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8D4, 0x0000,
+	0x0000, 0x0000, 0xFAF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDB4, 0xE4B5, 0xD8B0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8D5, 0x0000, 0x0000,
+	0x0000, 0xF4EA, 0x0000, 0x0000, 0x0000, 0xCEB9, 0x0000, 0x0000, 0x0000, 0xD6E1, 0xCFD2, 0x0000, 0xD0B6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCEA2, 0x0000, 0x0000, 0xF3EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3F8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCCC, 0x0000, 0xD0CB, 0x0000, 0x0000, 0x0000, 0xFCA4,
+	0xCDCA, 0xD7D4, 0xDEA3, 0x0000, 0xE4E0, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEC9, 0x0000, 0x0000, 0x0000, 0xE2DD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF5FE, 0xD4AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5D1, 0x0000, 0xD8F0, 0xF8C3, 0xEAD7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5D7, 0x0000, 0x0000, 0xD8BF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xFDC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBAD, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5AA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEECA, 0x0000, 0x0000, 0x0000, 0xCAE7, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF8E3, 0x0000, 0xD4DD, 0x0000, 0x0000, 0xEAD8, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBD9, 0xEDF7, 0x0000, 0x0000, 0xE5B5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0AD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE2BD, 0x0000, 0x0000, 0x0000, 0xE3C8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9D5, 0x0000, 0x0000, 0xDFAA, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDBBC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF8E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1FA, 0x0000, 0x0000, 0xE5B6, 0xF3EF, 0x0000, 0x0000, 0xFBDA,
+	0xE1E0, 0x0000, 0xD9AC, 0x0000, 0xF5EB, 0x0000, 0xE0B6, 0x0000, 0x0000, 0xE9C8, 0x0000, 0xCBCF, 0x0000, 0xE3C9, 0x0000, 0x0000,
+	0x0000, 0xDEEE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCEF, 0x0000, 0xD6A5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE2F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6FE, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD9A1, 0x0000, 0xD8C0, 0xDCDB, 0x0000, 0x0000, 0xEDBD, 0xDFB8, 0x0000, 0xEAA5, 0x0000, 0x0000, 0x0000, 0xD7AD, 0x0000,
+	0x0000, 0xF3F9, 0x0000, 0xEDF8, 0x0000, 0xF5C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1CA, 0xEBE3, 0x0000, 0xF2DE,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8CC, 0x0000, 0xEAD9,
+	0x0000, 0xD3C6, 0x0000, 0xDBE6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5AF, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEF0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE9FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBB6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE2F2, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFF2, 0xF7B9, 0xD9F3, 0x0000, 0x0000, 0xE1CB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDADD, 0x0000, 0x0000, 0xDAB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBFB,
+	0x0000, 0xCBB9, 0x0000, 0x0000, 0xEDF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0E0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4C0, 0x0000, 0xFDBC, 0xDFB1, 0xE3EF, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0A3,
+	0xFDB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCDCB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDBE, 0x0000, 0x0000, 0x0000, 0xD5C0, 0xE3F0, 0xEDFA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5ED, 0xE7DD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD4F6, 0xE5B7, 0x0000, 0x0000, 0x0000, 0xDBE7, 0xE2BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEECB, 0x0000, 0x0000, 0xD7F4, 0xF0DD, 0x0000, 0x0000, 0x0000, 0xCEAB,
+	0x0000, 0x0000, 0xE7DE, 0x0000, 0x0000, 0x0000, 0xD6D6, 0xE1CC, 0x0000, 0x0000, 0xE8B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5EE, 0xDCA2, 0x0000, 0x0000, 0xE0D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5B5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5A1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBDB, 0x0000,
+	0xF9CB, 0x0000, 0x0000, 0x0000, 0xCBF3, 0xF4A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAC8, 0xD6D7, 0x0000, 0xE9E5, 0xFBDC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBF6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAA5, 0x0000, 0xDBBD, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xECE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCDF7, 0xF0DE, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEEF, 0x0000, 0x0000, 0x0000, 0xD3B1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFCEE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8C3, 0x0000, 0xF1C8, 0x0000, 0x0000, 0x0000, 0xCEF1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF9ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2F4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4B6, 0x0000,
+	0xF5B9, 0x0000, 0xDCF0, 0xE3F1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2BB, 0x0000, 0xDEA4, 0x0000, 0xDACC, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAE9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3DA, 0x0000, 0xFCD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEADA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9C4, 0x0000, 0xE3A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFBDD, 0x0000, 0xEFCA, 0x0000, 0xE8C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD5CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBD7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9AD,
+	0x0000, 0x0000, 0xFBAB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD3D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF6DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDAF6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0D1, 0x0000, 0x0000, 0xE9A8,
+	0x0000, 0x0000, 0xF5F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAAF, 0x0000, 0xEBFC, 0x0000, 0x0000, 0xE0EA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5C5,
+	0x0000, 0x0000, 0xF1E3, 0xD5EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCDCC, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDD9, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8C1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xFAEC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFABC, 0xE6E2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFAE5, 0xE2FA, 0x0000, 0x0000, 0x0000, 0xCAB6, 0x0000, 0xE4B7, 0x0000, 0xEADB, 0x0000, 0xF5FA, 0x0000, 0x0000,
+	0x0000, 0xFBAC, 0xCFC3, 0xEBFD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8FA, 0x0000, 0x0000, 0xDFB9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE1F1, 0x0000, 0xD2A4, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0DA, 0xD0DB,
+	0x0000, 0xEABE, 0xD9B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAB7, 0x0000, 0x0000, 0xD3E7, 0x0000, 0xF8E5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD3B2, 0x0000, 0x0000, 0x0000, 0xE2C0, 0xF2DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDE5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9AC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCDCD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEEAE, 0xD6AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7EA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE7E0, 0xEBAE, 0x0000, 0x0000, 0x0000, 0xCFD9, 0x0000, 0x0000, 0xDCCD, 0xEDFB, 0x0000, 0xDEF0,
+	0x0000, 0xD7EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDFD7, 0xDBD0, 0xDBD1, 0x0000, 0x0000, 0xD5A3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0B2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCDC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCAE8, 0x0000, 0xF8E6, 0xDCCE, 0x0000, 0x0000, 0x0000, 0x0000, 0xEADC, 0xDBD2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9B3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3A8, 0x0000, 0xD7AE, 0x0000, 0x0000, 0xE0E1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCBBA, 0x0000, 0x0000, 0xE5D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0DC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD5C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE3A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0A4,
+	0x0000, 0xE9A9, 0x0000, 0xD3C7, 0x0000, 0x0000, 0xDCDD, 0xF8AE, 0x0000, 0x0000, 0x0000, 0xCCB8, 0x0000, 0x0000, 0x0000, 0xD0AE,
+	0x0000, 0x0000, 0x0000, 0xD8F2, 0x0000, 0x0000, 0xE3CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCCAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4AD, 0xF6D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD0CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAC6, 0x0000, 0x0000, 0xD5C2, 0x0000, 0x0000,
+	0xCEBA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xCAC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFAB0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDFD8, 0x0000, 0x0000, 0x0000, 0xF5BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE5EB, 0x0000, 0xEFF4, 0xDDB5, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDAA, 0x0000, 0xE3F2, 0x0000, 0xFBF7, 0x0000, 0xF7D0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFDBA, 0x0000, 0x0000, 0xFDE1, 0xF6FE, 0xD1C0, 0x0000, 0x0000, 0xE8C5, 0x0000, 0xE4B8, 0x0000, 0xE1E8,
+	0x0000, 0x0000, 0x0000, 0xCCC1, 0x0000, 0xD2ED, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBBE, 0x0000, 0x0000, 0xE0E2, 0x0000, 0x0000,
+	0x0000, 0xFAC9, 0x0000, 0x0000, 0xE1CD, 0x0000, 0xCAB8, 0x0000, 0x0000, 0x0000, 0xF2E0, 0xF1C9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDEF1, 0x0000, 0x0000, 0x0000, 0xF0DF, 0xF8C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEECC, 0x0000, 0x0000, 0xDEF2, 0x0000,
+	0xE7C9, 0x0000, 0xE2F3, 0xE7E1, 0x0000, 0x0000, 0xE3CB, 0x0000, 0x0000, 0xE3CC, 0x0000, 0x0000, 0x0000, 0xCFF8, 0xEFAC, 0x0000,
+	0xFDFE, 0xFCA5, 0xFAB1, 0xDFD9, 0x0000, 0xE0D2, 0x0000, 0x0000, 0x0000, 0xF4DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1CA, 0x0000, 0xCEA3, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2BC, 0xECE3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE0A5, 0x0000, 0xF7AB, 0x0000, 0x0000, 0xEBAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5DE, 0x0000,
+	0xE1A4, 0xCDAB, 0x0000, 0xD9F4, 0xE8A6, 0xCDCE, 0xE1E9, 0x0000, 0xFCEF, 0x0000, 0xE0E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE2C1, 0x0000, 0xCEA4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEA6, 0x0000, 0x0000, 0xEBFE, 0x0000, 0xEBDD, 0xF0E0,
+	0x0000, 0x0000, 0xF4DB, 0x0000, 0xE2F4, 0x0000, 0x0000, 0xD3C8, 0x0000, 0x0000, 0x0000, 0xF4EB, 0x0000, 0xEEB5, 0x0000, 0xF5D8,
+	0x0000, 0x0000, 0xD5DF, 0x0000, 0x0000, 0x0000, 0xD6E5, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBB0, 0xF4E3, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE3CD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4F4, 0xFAB2, 0x0000, 0x0000, 0xEFF5, 0xCADF, 0x0000, 0xEBB1, 0xEDBF, 0x0000,
+	0x0000, 0xFDC9, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4A6, 0xF9A4, 0xF0B3, 0x0000, 0xE5EC, 0x0000, 0x0000, 0x0000, 0xD1E7, 0x0000,
+	0xD9C7, 0xE4D7, 0xEADD, 0x0000, 0xD4F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDABA, 0x0000,
+	0xDACD, 0x0000, 0x0000, 0x0000, 0xF9CC, 0x0000, 0xE1DA, 0xDBBF, 0x0000, 0xCCC5, 0xECD0, 0xCBBB, 0x0000, 0xDEF3, 0x0000, 0x0000,
+	0xE9AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9C8, 0x0000, 0x0000, 0xEEE3, 0xD7BD, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCFC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xFCA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1FB, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDD2, 0xD1C1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3DB, 0x0000, 0xD3C9, 0x0000, 0xDCCF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEA7, 0x0000, 0x0000, 0xE6BB,
+	0xECA1, 0x0000, 0x0000, 0x0000, 0xCCB9, 0x0000, 0x0000, 0xFBDE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7E2, 0x0000, 0x0000,
+	0xD4C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCA8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE2C2, 0x0000, 0xF3D8, 0xE5D3, 0x0000, 0x0000, 0xF3D9, 0x0000, 0x0000, 0x0000, 0xF3C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDAC,
+	0x0000, 0xFCC3, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4E7, 0x0000, 0xD1C2, 0x0000, 0xF9A5, 0x0000, 0xE8D5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3CE, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDFDA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBDF, 0xE7E3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8FB, 0xE3CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF5B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8E7, 0x0000, 0xD9C9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8AF, 0xEFF6, 0x0000,
+	0xDDB6, 0xEEAF, 0xCDF8, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEB8, 0xFCA7, 0xF7FC, 0xF7B1, 0xCEBB, 0xF4A1, 0x0000, 0x0000, 0xEECD,
+	0xE1AE, 0x0000, 0x0000, 0xECC3, 0xCFFE, 0x0000, 0xF8BF, 0xD8E2, 0xD3E8, 0x0000, 0x0000, 0xDEA8, 0xF4E4, 0xECC2, 0x0000, 0xD9F5,
+	0xF9C5, 0xDDD3, 0xD6F1, 0xECFC, 0xFCF0, 0x0000, 0x0000, 0xEDC0, 0xCAB9, 0x0000, 0xEEE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF2E1, 0x0000, 0xDEB9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6F2, 0x0000, 0xDEF4, 0x0000, 0xDFDB, 0x0000,
+	0xDBD3, 0x0000, 0xFAE7, 0xD8E3, 0xF4C1, 0x0000, 0xDDB7, 0x0000, 0x0000, 0x0000, 0xF2F5, 0x0000, 0x0000, 0xD4AE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD6F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDB8, 0xCFC5, 0xDFDF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF2BE, 0xF6A1, 0x0000, 0xEBCB, 0xF1FC, 0x0000, 0xF3C7, 0x0000, 0x0000, 0xE0EB, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xEDFC, 0x0000, 0x0000, 0xE1DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEEE5, 0x0000, 0xDEF5, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAD3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF1CB, 0x0000, 0x0000, 0xD0AF, 0xDDB9, 0x0000, 0x0000, 0xD1C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5B1, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF6AC, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF0EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDBA, 0x0000, 0x0000, 0x0000, 0xF2BF, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7C5, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBA2, 0xF2F6, 0x0000, 0x0000, 0xCABA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7F5, 0x0000, 0xCBE5, 0x0000, 0x0000,
+	0x0000, 0xEEE6, 0x0000, 0xE0D3, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6D8,
+	0x0000, 0x0000, 0x0000, 0xD4AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C9, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3CE,
+	0xF4C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBE6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEBB2, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xEBB3, 0x0000, 0xF0B4, 0x0000, 0x0000, 0xCBF4, 0xD4B0, 0xF3B2, 0xFBB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEE7,
+	0xF4B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF5ED, 0x0000, 0xCFF3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF0E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEECE, 0x0000, 0x0000, 0xF1CC, 0x0000, 0x0000, 0xE5B8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7F5, 0xE3F3, 0xCFE5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCFC6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3B3, 0xE4D8, 0xCFF9, 0xCFDA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFACD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6E3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2E2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5EE, 0x0000, 0x0000, 0xCABB, 0x0000, 0x0000, 0xE3DC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCEF2, 0x0000, 0xD6D9, 0x0000, 0x0000, 0x0000, 0xEEB0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF4E5, 0xD8C2, 0xDCD0, 0xCCEE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5E0, 0xF6CA, 0xFDCA, 0xD8D6, 0xF4CF,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6A6, 0xDCBE, 0x0000, 0xDBD4, 0xD7C7, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2FE,
+	0x0000, 0x0000, 0x0000, 0xF1CD, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2C3, 0xDCDE, 0x0000, 0xDCDF, 0x0000, 0x0000, 0xEFAD, 0xE6AB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF9DD, 0xEABF, 0x0000, 0x0000, 0x0000, 0xEFAE, 0x0000, 0x0000, 0x0000, 0xF4D0, 0xCEF3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6AC, 0x0000, 0xCEDE,
+	0x0000, 0x0000, 0xD5F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3F4, 0xCDD0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD5B8, 0x0000, 0x0000, 0xF7FD, 0x0000, 0xDCA9, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEF6, 0x0000, 0xDCAA,
+	0xF2E3, 0xE9B4, 0xD2DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE9E6, 0x0000, 0x0000, 0xE3F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7CA, 0x0000,
+	0x0000, 0xD0CE, 0x0000, 0x0000, 0xDAF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCABC, 0x0000, 0x0000, 0x0000, 0xEEE8, 0xDADE, 0x0000, 0xF2F7, 0x0000, 0x0000,
+	0xE2FB, 0x0000, 0xCCA6, 0x0000, 0x0000, 0x0000, 0x0000, 0xDABB, 0x0000, 0xEEE9, 0x0000, 0x0000, 0x0000, 0xF5DA, 0x0000, 0x0000,
+	0xF7DC, 0xE1EA, 0xCEC1, 0xD4B1, 0x0000, 0xFDB1, 0xE6BD, 0x0000, 0xFBAD, 0x0000, 0x0000, 0xF8E7, 0x0000, 0xE1CE, 0x0000, 0xF7E2,
+	0xF5EF, 0xCFC7, 0x0000, 0x0000, 0xD4B2, 0xCCEF, 0x0000, 0xD4E8, 0x0000, 0xEECF, 0xF7D7, 0x0000, 0x0000, 0xE0A6, 0xD6C1, 0xE1DC,
+	0xF0E3, 0xF1E4, 0xDCF1, 0xD6A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4F5, 0x0000,
+	0x0000, 0xF1CE, 0xF2E4, 0x0000, 0x0000, 0xD0B0, 0x0000, 0x0000, 0xECEF, 0x0000, 0x0000, 0x0000, 0xF9BA, 0x0000, 0xEBB5, 0x0000,
+	0x0000, 0xD4ED, 0xE2C4, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E7, 0x0000, 0x0000, 0xEBB4, 0xEAA1, 0x0000, 0xF8BC, 0xCEA6, 0x0000,
+	0xF9C6, 0xFCDA, 0x0000, 0xD4B3, 0xD3B9, 0xEADE, 0x0000, 0x0000, 0x0000, 0xE9AB, 0x0000, 0x0000, 0xE1E1, 0xD3CF, 0xF4F6, 0x0000,
+	0xEAC0, 0xE1CF, 0x0000, 0xCCBA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEEA, 0x0000, 0x0000, 0x0000, 0xF0E4, 0xF3B4, 0xD4EE,
+	0x0000, 0x0000, 0xF2C0, 0x0000, 0x0000, 0xF1E5, 0x0000, 0xF4C3, 0xE0D4, 0x0000, 0xEBB6, 0x0000, 0xD7A1, 0xCBE8, 0x0000, 0xF9AD,
+	0xE9AD, 0xD8E4, 0xFAB3, 0xE2C5, 0xFCBD, 0x0000, 0x0000, 0xECC4, 0xD8B1, 0x0000, 0xDCAB, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5A4,
+	0x0000, 0xEBE9, 0x0000, 0x0000, 0x0000, 0xE8BB, 0x0000, 0x0000, 0x0000, 0xD8D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xFBAE, 0xD1E1, 0x0000, 0x0000, 0xDBC0, 0x0000, 0xF5BE, 0x0000, 0xDEF7, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAFB,
+	0xF7C6, 0xCFC8, 0x0000, 0x0000, 0x0000, 0xE1D0, 0x0000, 0x0000, 0xEED0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE9F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5CD, 0x0000,
+	0x0000, 0xCFDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDBB, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEAC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4B4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE4C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF5DB, 0x0000, 0x0000, 0xFAC1, 0x0000, 0x0000, 0x0000, 0xDEA9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4F8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFF7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD3B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBB7, 0xEFF8, 0xF5DC, 0xEDCC, 0xDBD5, 0xF1CF, 0x0000,
+	0x0000, 0x0000, 0xF1D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF5B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9AE, 0xD5AC, 0x0000, 0xE2C6, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDA3, 0x0000, 0xFBE5, 0xDFAB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2F5, 0x0000, 0xF6AD, 0x0000, 0xF5B3, 0x0000, 0xF0B5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE1A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5DD, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECA2, 0xEDFD, 0x0000, 0xF5B4, 0xFBB8,
+	0x0000, 0xDBA3, 0x0000, 0x0000, 0xD6CA, 0xCBD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE5D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3FA, 0x0000, 0xEBB8, 0x0000, 0xE0B7, 0xD7EC, 0xF1EC, 0xE5AF, 0xD5E1,
+	0xD7ED, 0xD1D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1F2, 0xEFF9, 0x0000, 0x0000, 0x0000, 0xDDBC, 0xF6DC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF0E5, 0x0000, 0x0000, 0x0000, 0xF4C4, 0x0000, 0x0000, 0xE9E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4EF, 0x0000, 0x0000,
+	0xCCA2, 0xF7FE, 0xDFBC, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBCD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD6C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8AD, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFAF,
+	0xCBA5, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBE9, 0x0000, 0x0000, 0x0000, 0xFAE8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCC6, 0x0000, 0x0000, 0x0000, 0xE6E7, 0x0000, 0x0000, 0xEAC7, 0x0000,
+	0x0000, 0x0000, 0xDBA4, 0x0000, 0xCFC9, 0xE2FC, 0xEFFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEBDE, 0x0000, 0x0000, 0xF5C8, 0x0000, 0xD4DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xE0D5, 0x0000, 0xEFB0, 0x0000, 0x0000, 0xE2C7, 0x0000, 0xD9AF, 0x0000, 0x0000, 0x0000, 0xF9E7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE7E5, 0x0000, 0x0000, 0xCFCA, 0xE1D1, 0x0000, 0xE2C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFFB, 0x0000, 0x0000, 0xFAF9,
+	0x0000, 0x0000, 0xDCF2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE0A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBEA, 0x0000, 0x0000, 0x0000, 0xCBBC, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD6E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF5DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5DF, 0x0000, 0xEEB6, 0x0000, 0x0000, 0x0000, 0xE2F6, 0xD3CA,
+	0xEFFC, 0xD1C4, 0xEFB1, 0x0000, 0xD1C5, 0x0000, 0xD0DE, 0x0000, 0xD9E1, 0x0000, 0x0000, 0xE0B8, 0x0000, 0x0000, 0xCDD1, 0xF3B9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7CC, 0x0000, 0xD6A8, 0xCEA7, 0x0000, 0xD4B5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE4C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3B4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBB9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6DD, 0x0000, 0xF1A3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCC7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE9CA, 0x0000, 0xE1F0, 0x0000, 0x0000, 0x0000, 0xF5E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFBAF, 0x0000, 0x0000, 0x0000, 0xCBD1, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xF2E5, 0x0000, 0x0000,
+	0xECF0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF0EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEEEB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9CB, 0x0000,
+	0x0000, 0xCCF0, 0x0000, 0x0000, 0xD7AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFCF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFB2, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4D1, 0x0000, 0x0000, 0xF7A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF1D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCAFC, 0xCAFD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCECE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF3C8, 0x0000, 0xF3BA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEDFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDAA6, 0x0000, 0x0000, 0xE0EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8CD, 0x0000, 0xCBD2, 0x0000, 0x0000, 0x0000, 0xEBCE,
+	0x0000, 0xF9D8, 0xF9D9, 0xCAE0, 0xDACA, 0x0000, 0x0000, 0x0000, 0xCBA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCAC8, 0xF9EE, 0xDBEC, 0x0000, 0x0000, 0xD0B1, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5EF, 0x0000, 0x0000,
+	0x0000, 0xE6F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7A2, 0xE4D9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4E1, 0x0000, 0x0000, 0xFCC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF9EF, 0xCFF4, 0xF7E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEBC, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF4C5, 0xDCA3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDBD, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF4C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8A1, 0x0000, 0x0000, 0x0000, 0xE8D6, 0x0000,
+	0x0000, 0x0000, 0xDBC1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0E6, 0x0000, 0x0000, 0x0000, 0xE4B9,
+	0xF6ED, 0x0000, 0xF9AE, 0x0000, 0xDDBE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7B0, 0xD8E8, 0xCBBD, 0x0000, 0x0000,
+	0xF9DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8CE, 0xF9F0, 0xE0ED, 0xE3B3, 0xF4B3,
+	0x0000, 0x0000, 0xEAC2, 0xF2E6, 0xF0B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBD6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEBE4, 0x0000, 0x0000, 0xF2E7, 0x0000, 0xD7D5, 0xD4B6, 0xF9E8, 0xD7C1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5D5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9EA, 0xD7CC, 0x0000, 0x0000, 0x0000, 0xD3E9, 0xE2C9, 0x0000, 0xFCDB, 0xCDAD, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCCB0, 0xEAA2, 0x0000, 0x0000, 0xE4F6, 0xD0C0, 0x0000, 0xF0B7, 0xEEA1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD7F6, 0x0000, 0x0000, 0x0000, 0xE2CA, 0xE2CB, 0x0000, 0xFACF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEBDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6CB, 0x0000, 0x0000, 0x0000, 0xF4B4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEDCD, 0xE4D2, 0x0000, 0x0000, 0xEAA9, 0xE4BA, 0xF3A2, 0xCDD2, 0x0000, 0xF6CB, 0x0000, 0xF1E6, 0xEDC1, 0xE8BC, 0xEED1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0E7, 0xE2CC, 0x0000, 0x0000, 0xE4AA, 0x0000, 0xF5E1, 0xEDDA, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD7EE, 0xD1F1, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9EB, 0xE9EC, 0xE0E4, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAA7,
+	0xDDD4, 0x0000, 0xEAA3, 0x0000, 0x0000, 0x0000, 0xD6C3, 0xD6F4, 0x0000, 0xDADF, 0x0000, 0xEFB3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE2CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFFD, 0xF2E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEFC5, 0x0000, 0xE7E7, 0x0000, 0x0000, 0xD7FD, 0x0000, 0x0000, 0xE7CE, 0x0000, 0x0000, 0xDFDC, 0x0000, 0xF9C7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDFAC, 0x0000, 0xD6DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCA4, 0x0000, 0x0000, 0x0000, 0xF0B8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD5FA, 0x0000, 0xE4F7, 0x0000, 0x0000, 0x0000, 0xD6C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xF4EC, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0A1, 0x0000, 0xDEAA, 0x0000,
+	0x0000, 0xDABC, 0xD8FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAD4, 0x0000, 0x0000, 0x0000, 0xECE5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFCA8, 0x0000, 0x0000, 0xECE6, 0x0000, 0x0000, 0xD8CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBB9, 0x0000, 0xE4D3, 0x0000, 0xCDF9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCFD3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAEA, 0x0000, 0x0000, 0xCFD4, 0x0000, 0xF8BD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4C7, 0x0000, 0x0000, 0x0000, 0x0000, 0xEADF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF9DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4B7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xEBE5, 0x0000, 0x0000, 0xE1D2, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAA4, 0x0000, 0x0000, 0x0000, 0xFAC2,
+	0xFBE1, 0xFAED, 0xF0A2, 0xCCF1, 0x0000, 0xFAA3, 0xE2F7, 0x0000, 0xE2CE, 0x0000, 0xE9F5, 0x0000, 0xE1EB, 0x0000, 0x0000, 0x0000,
+	0xE7E8, 0xE8D7, 0xDAF8, 0xD4CB, 0x0000, 0x0000, 0x0000, 0xF7F6, 0xD6C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4E9, 0x0000, 0x0000,
+	0xFAFA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCF2, 0xF7DD, 0x0000, 0xDEBA, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEA8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0B9, 0xE4FE, 0xE4C9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE4D4, 0x0000, 0x0000, 0x0000, 0xEAC3, 0x0000, 0xEFB4, 0x0000, 0x0000, 0x0000, 0xD7BE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE2, 0x0000, 0xCDD3, 0x0000, 0x0000, 0x0000, 0xEFB5, 0x0000, 0x0000, 0x0000, 0xFAE9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFBD,
+	0x0000, 0xF7C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF8FD, 0x0000, 0x0000, 0xF8FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEAB, 0xDBE8, 0x0000, 0x0000, 0xE3DD,
+	0x0000, 0xE1E2, 0xD1C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6D0, 0xEBE6, 0xDAF9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xECC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEF8, 0xF8E9, 0xE3DE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCEF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAC3, 0xE5D7, 0x0000, 0xECC8, 0x0000, 0x0000, 0x0000,
+	0xF3C9, 0x0000, 0x0000, 0xE4BB, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFB6, 0x0000,
+	0xDCBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEBD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8C3, 0x0000, 0x0000, 0x0000, 0xD0CF, 0x0000, 0xCFFA, 0xF3CA, 0xE0D7, 0x0000, 0x0000,
+	0x0000, 0xD1C7, 0xE9AE, 0x0000, 0xE8BD, 0x0000, 0x0000, 0xFAC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2CF, 0x0000, 0x0000, 0xFAC5, 0x0000, 0x0000, 0x0000, 0xF9B8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCE0, 0x0000, 0x0000, 0xFBB0, 0x0000, 0x0000, 0x0000, 0xD8A9, 0xE5DF, 0xF9A7, 0x0000,
+	0x0000, 0xF6EE, 0x0000, 0xF6CC, 0xE2F8, 0x0000, 0x0000, 0x0000, 0x0000, 0xECF1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDAE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF1D2, 0xD2CC, 0xCFCB, 0x0000, 0x0000, 0xCABD, 0x0000, 0x0000, 0x0000, 0xDDBF, 0x0000, 0x0000, 0x0000, 0xF6EF, 0x0000, 0xDEF9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAB4, 0x0000, 0x0000,
+	0x0000, 0xD5AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1E7,
+	0x0000, 0xDEBE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD1C8, 0xD1C9,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBF6, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD4F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5E2, 0xE1D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD8E9, 0x0000, 0x0000, 0xF8FE, 0x0000, 0xCFCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDA4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEF6, 0x0000, 0xFAD0, 0x0000, 0x0000, 0xCCF3, 0xE6BE, 0x0000, 0x0000, 0x0000, 0xF6AE,
+	0x0000, 0x0000, 0xD5F0, 0x0000, 0x0000, 0xD1CA, 0x0000, 0x0000, 0x0000, 0xFCBE, 0xD5F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAB5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE2D0, 0xF4F7, 0x0000, 0x0000, 0x0000, 0xCDD4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBA5, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7A2, 0x0000, 0x0000, 0xF7E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEAA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0A1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCEDA, 0xFBEB, 0xDBA6, 0xDBDE, 0xD8E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAE0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD8AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6DB,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFC6, 0x0000,
+	0x0000, 0xF8EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4D5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEF7, 0x0000, 0x0000, 0xE0D8, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCDE6, 0x0000, 0x0000, 0x0000, 0xCCF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5E3, 0x0000, 0x0000,
+	0xE4CA, 0x0000, 0xDCE1, 0x0000, 0x0000, 0xF9C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE8A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8C4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBBE, 0x0000, 0xDCAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0E8, 0x0000, 0xDDC0, 0x0000, 0xCFCD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDCF3, 0xD9B0, 0x0000, 0xE6E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAC4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4EC, 0x0000, 0xE4E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBF8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xCCBB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4BD, 0x0000, 0x0000,
+	0xCDDC, 0xD9F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDDF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xEDCE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xF9CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCDAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFCE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xF6AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDD3, 0xEBED, 0xD6DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE5A4, 0x0000, 0x0000, 0x0000, 0xD5B6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6DD, 0x0000, 0x0000, 0x0000, 0xF9E9, 0x0000, 0x0000, 0x0000, 0xE7A4, 0x0000, 0xD6E3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD1CB, 0xD6E4, 0x0000, 0x0000, 0x0000, 0xD5F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEFA, 0x0000, 0xD7F8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCFD5, 0xD8FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8AB, 0x0000, 0x0000, 0xFDCB, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xFCDC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0A8, 0xD5F3, 0x0000,
+	0x0000, 0xFDD9, 0x0000, 0x0000, 0xCCA3, 0x0000, 0x0000, 0x0000, 0xD9F9, 0x0000, 0x0000, 0xD3EA, 0xF5F5, 0x0000, 0xEFC7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3DA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDABD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE8A8, 0xDCAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0A3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xCDD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE0A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEAC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF0BA, 0xEEB1, 0x0000, 0x0000, 0xEEB2, 0x0000,
+	0x0000, 0x0000, 0xF6CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEED2,
+	0x0000, 0xD6C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0E5, 0x0000, 0x0000, 0xF3BB, 0x0000, 0xE5E1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7A3, 0x0000, 0x0000,
+	0xDBC2, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFCF, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xB0A1, 0xB0A2, 0x8141, 0x8142, 0xB0A3, 0x8143, 0x8144, 0xB0A4, 0xB0A5, 0xB0A6, 0xB0A7, 0x8145, 0x8146, 0x8147, 0x8148, 0x8149,
+	0xB0A8, 0xB0A9, 0xB0AA, 0xB0AB, 0xB0AC, 0xB0AD, 0xB0AE, 0xB0AF, 0x814A, 0xB0B0, 0xB0B1, 0xB0B2, 0xB0B3, 0xB0B4, 0x814B, 0x814C,
+	0xB0B5, 0x814D, 0x814E, 0x814F, 0xB0B6, 0x8150, 0x8151, 0x8152, 0x8153, 0x8154, 0x8155, 0x8156, 0xB0B7, 0xB0B8, 0x8157, 0xB0B9,
+	0xB0BA, 0xB0BB, 0x8158, 0x8159, 0x815A, 0x8161, 0x8162, 0x8163, 0xB0BC, 0xB0BD, 0x8164, 0x8165, 0xB0BE, 0x8166, 0x8167, 0x8168,
+	0xB0BF, 0x8169, 0x816A, 0x816B, 0x816C, 0x816D, 0x816E, 0x816F, 0x8170, 0x8171, 0x8172, 0xB0C0, 0x8173, 0xB0C1, 0x8174, 0x8175,
+	0x8176, 0x8177, 0x8178, 0x8179, 0xB0C2, 0x817A, 0x8181, 0x8182, 0xB0C3, 0x8183, 0x8184, 0x8185, 0xB0C4, 0x8186, 0x8187, 0x8188,
+	0x8189, 0x818A, 0x818B, 0x818C, 0x818D, 0x818E, 0x818F, 0x8190, 0x8191, 0x8192, 0x8193, 0x8194, 0x8195, 0x8196, 0x8197, 0x8198,
+	0xB0C5, 0xB0C6, 0x8199, 0x819A, 0xB0C7, 0x819B, 0x819C, 0xB0C8, 0xB0C9, 0x819D, 0xB0CA, 0x819E, 0x819F, 0x81A0, 0x81A1, 0x81A2,
+	0xB0CB, 0xB0CC, 0x81A3, 0xB0CD, 0xB0CE, 0xB0CF, 0xB0D0, 0x81A4, 0x81A5, 0xB0D1, 0xB0D2, 0xB0D3, 0xB0D4, 0x81A6, 0x81A7, 0x81A8,
+	0xB0D5, 0x81A9, 0x81AA, 0x81AB, 0xB0D6, 0x81AC, 0x81AD, 0x81AE, 0x81AF, 0x81B0, 0x81B1, 0x81B2, 0xB0D7, 0xB0D8, 0x81B3, 0xB0D9,
+	0xB0DA, 0xB0DB, 0x81B4, 0x81B5, 0x81B6, 0x81B7, 0x81B8, 0x81B9, 0xB0DC, 0xB0DD, 0xB0DE, 0x81BA, 0xB0DF, 0x81BB, 0x81BC, 0xB0E0,
+	0xB0E1, 0x81BD, 0x81BE, 0x81BF, 0x81C0, 0x81C1, 0x81C2, 0x81C3, 0xB0E2, 0xB0E3, 0x81C4, 0xB0E4, 0xB0E5, 0xB0E6, 0x81C5, 0x81C6,
+	0x81C7, 0xB0E7, 0x81C8, 0x81C9, 0xB0E8, 0x81CA, 0x81CB, 0x81CC, 0xB0E9, 0x81CD, 0x81CE, 0x81CF, 0xB0EA, 0x81D0, 0x81D1, 0x81D2,
+	0x81D3, 0x81D4, 0x81D5, 0x81D6, 0x81D7, 0xB0EB, 0x81D8, 0xB0EC, 0x81D9, 0x81DA, 0x81DB, 0x81DC, 0x81DD, 0x81DE, 0x81DF, 0x81E0,
+	0xB0ED, 0xB0EE, 0x81E1, 0x81E2, 0xB0EF, 0x81E3, 0x81E4, 0xB0F0, 0xB0F1, 0x81E5, 0xB0F2, 0x81E6, 0xB0F3, 0x81E7, 0x81E8, 0xB0F4,
+	0xB0F5, 0xB0F6, 0x81E9, 0xB0F7, 0x81EA, 0xB0F8, 0xB0F9, 0x81EB, 0x81EC, 0x81ED, 0x81EE, 0x81EF, 0xB0FA, 0xB0FB, 0x81F0, 0x81F1,
+	0xB0FC, 0x81F2, 0x81F3, 0x81F4, 0xB0FD, 0x81F5, 0xB0FE, 0x81F6, 0x81F7, 0x81F8, 0x81F9, 0x81FA, 0xB1A1, 0xB1A2, 0x81FB, 0xB1A3,
+	0x81FC, 0xB1A4, 0x81FD, 0x81FE, 0x8241, 0x8242, 0x8243, 0x8244, 0xB1A5, 0x8245, 0x8246, 0x8247, 0xB1A6, 0x8248, 0x8249, 0x824A,
+	0xB1A7, 0x824B, 0x824C, 0x824D, 0x824E, 0x824F, 0x8250, 0x8251, 0x8252, 0xB1A8, 0x8253, 0x8254, 0xB1A9, 0xB1AA, 0x8255, 0x8256,
+	0x8257, 0x8258, 0x8259, 0x825A, 0xB1AB, 0xB1AC, 0x8261, 0x8262, 0xB1AD, 0x8263, 0x8264, 0x8265, 0xB1AE, 0x8266, 0x8267, 0x8268,
+	0x8269, 0x826A, 0x826B, 0x826C, 0xB1AF, 0xB1B0, 0x826D, 0xB1B1, 0x826E, 0xB1B2, 0x826F, 0x8270, 0x8271, 0x8272, 0x8273, 0x8274,
+	0xB1B3, 0x8275, 0x8276, 0x8277, 0xB1B4, 0x8278, 0x8279, 0x827A, 0xB1B5, 0x8281, 0x8282, 0x8283, 0x8284, 0x8285, 0x8286, 0x8287,
+	0x8288, 0xB1B6, 0x8289, 0xB1B7, 0x828A, 0x828B, 0x828C, 0x828D, 0x828E, 0x828F, 0x8290, 0x8291, 0xB1B8, 0xB1B9, 0x8292, 0x8293,
+	0xB1BA, 0x8294, 0x8295, 0xB1BB, 0xB1BC, 0xB1BD, 0xB1BE, 0x8296, 0x8297, 0x8298, 0x8299, 0xB1BF, 0xB1C0, 0xB1C1, 0x829A, 0xB1C2,
+	0x829B, 0xB1C3, 0xB1C4, 0x829C, 0x829D, 0x829E, 0x829F, 0x82A0, 0xB1C5, 0xB1C6, 0x82A1, 0x82A2, 0xB1C7, 0x82A3, 0x82A4, 0x82A5,
+	0xB1C8, 0x82A6, 0x82A7, 0x82A8, 0x82A9, 0x82AA, 0x82AB, 0x82AC, 0x82AD, 0x82AE, 0x82AF, 0x82B0, 0xB1C9, 0xB1CA, 0x82B1, 0x82B2,
+	0x82B3, 0x82B4, 0x82B5, 0x82B6, 0xB1CB, 0x82B7, 0x82B8, 0x82B9, 0x82BA, 0x82BB, 0x82BC, 0x82BD, 0x82BE, 0x82BF, 0x82C0, 0x82C1,
+	0x82C2, 0x82C3, 0x82C4, 0x82C5, 0x82C6, 0x82C7, 0x82C8, 0xB1CC, 0x82C9, 0x82CA, 0x82CB, 0x82CC, 0x82CD, 0x82CE, 0x82CF, 0x82D0,
+	0xB1CD, 0xB1CE, 0x82D1, 0x82D2, 0xB1CF, 0x82D3, 0x82D4, 0x82D5, 0xB1D0, 0x82D6, 0x82D7, 0x82D8, 0x82D9, 0x82DA, 0x82DB, 0x82DC,
+	0xB1D1, 0xB1D2, 0x82DD, 0xB1D3, 0x82DE, 0x82DF, 0x82E0, 0x82E1, 0x82E2, 0x82E3, 0x82E4, 0x82E5, 0xB1D4, 0x82E6, 0x82E7, 0x82E8,
+	0xB1D5, 0x82E9, 0x82EA, 0x82EB, 0xB1D6, 0x82EC, 0x82ED, 0x82EE, 0x82EF, 0x82F0, 0x82F1, 0x82F2, 0x82F3, 0x82F4, 0x82F5, 0x82F6,
+	0x82F7, 0x82F8, 0x82F9, 0x82FA, 0x82FB, 0x82FC, 0x82FD, 0x82FE, 0xB1D7, 0xB1D8, 0x8341, 0x8342, 0xB1D9, 0x8343, 0x8344, 0xB1DA,
+	0xB1DB, 0xB1DC, 0x8345, 0x8346, 0x8347, 0x8348, 0x8349, 0x834A, 0xB1DD, 0xB1DE, 0x834B, 0xB1DF, 0x834C, 0xB1E0, 0x834D, 0x834E,
+	0x834F, 0x8350, 0x8351, 0x8352, 0xB1E1, 0x8353, 0x8354, 0x8355, 0x8356, 0x8357, 0x8358, 0x8359, 0x835A, 0x8361, 0x8362, 0x8363,
+	0x8364, 0x8365, 0x8366, 0x8367, 0x8368, 0x8369, 0x836A, 0x836B, 0x836C, 0x836D, 0x836E, 0x836F, 0x8370, 0x8371, 0x8372, 0x8373,
+	0xB1E2, 0xB1E3, 0x8374, 0x8375, 0xB1E4, 0x8376, 0x8377, 0xB1E5, 0xB1E6, 0x8378, 0xB1E7, 0x8379, 0x837A, 0x8381, 0x8382, 0x8383,
+	0xB1E8, 0xB1E9, 0x8384, 0xB1EA, 0x8385, 0xB1EB, 0xB1EC, 0x8386, 0x8387, 0x8388, 0xB1ED, 0x8389, 0xB1EE, 0xB1EF, 0xB1F0, 0x838A,
+	0xB1F1, 0x838B, 0x838C, 0x838D, 0xB1F2, 0x838E, 0xB1F3, 0x838F, 0x8390, 0x8391, 0x8392, 0x8393, 0xB1F4, 0xB1F5, 0x8394, 0xB1F6,
+	0xB1F7, 0xB1F8, 0x8395, 0x8396, 0x8397, 0xB1F9, 0x8398, 0x8399, 0xB1FA, 0xB1FB, 0x839A, 0x839B, 0xB1FC, 0x839C, 0x839D, 0x839E,
+	0xB1FD, 0x839F, 0x83A0, 0x83A1, 0x83A2, 0x83A3, 0x83A4, 0x83A5, 0xB1FE, 0xB2A1, 0x83A6, 0xB2A2, 0xB2A3, 0xB2A4, 0x83A7, 0x83A8,
+	0x83A9, 0x83AA, 0x83AB, 0x83AC, 0xB2A5, 0xB2A6, 0x83AD, 0x83AE, 0x83AF, 0x83B0, 0x83B1, 0x83B2, 0xB2A7, 0x83B3, 0x83B4, 0x83B5,
+	0x83B6, 0x83B7, 0x83B8, 0x83B9, 0x83BA, 0x83BB, 0x83BC, 0x83BD, 0x83BE, 0x83BF, 0x83C0, 0x83C1, 0x83C2, 0x83C3, 0x83C4, 0x83C5,
+	0x83C6, 0x83C7, 0x83C8, 0x83C9, 0x83CA, 0x83CB, 0x83CC, 0x83CD, 0x83CE, 0x83CF, 0x83D0, 0x83D1, 0x83D2, 0x83D3, 0x83D4, 0x83D5,
+	0x83D6, 0x83D7, 0x83D8, 0x83D9, 0x83DA, 0x83DB, 0x83DC, 0x83DD, 0x83DE, 0x83DF, 0x83E0, 0x83E1, 0xB2A8, 0xB2A9, 0xB2AA, 0x83E2,
+	0xB2AB, 0x83E3, 0x83E4, 0x83E5, 0xB2AC, 0x83E6, 0x83E7, 0x83E8, 0x83E9, 0x83EA, 0x83EB, 0x83EC, 0xB2AD, 0xB2AE, 0x83ED, 0xB2AF,
+	0xB2B0, 0xB2B1, 0x83EE, 0x83EF, 0x83F0, 0x83F1, 0x83F2, 0x83F3, 0xB2B2, 0xB2B3, 0x83F4, 0x83F5, 0xB2B4, 0x83F6, 0x83F7, 0x83F8,
+	0x83F9, 0x83FA, 0x83FB, 0x83FC, 0x83FD, 0x83FE, 0x8441, 0x8442, 0xB2B5, 0x8443, 0x8444, 0xB2B6, 0x8445, 0xB2B7, 0x8446, 0x8447,
+	0x8448, 0x8449, 0x844A, 0x844B, 0xB2B8, 0x844C, 0x844D, 0x844E, 0xB2B9, 0x844F, 0x8450, 0x8451, 0xB2BA, 0x8452, 0x8453, 0x8454,
+	0x8455, 0x8456, 0x8457, 0x8458, 0x8459, 0x845A, 0x8461, 0xB2BB, 0xB2BC, 0x8462, 0x8463, 0x8464, 0x8465, 0xB2BD, 0x8466, 0x8467,
+	0xB2BE, 0x8468, 0x8469, 0x846A, 0x846B, 0x846C, 0x846D, 0x846E, 0x846F, 0x8470, 0x8471, 0x8472, 0x8473, 0x8474, 0x8475, 0x8476,
+	0x8477, 0x8478, 0x8479, 0x847A, 0x8481, 0x8482, 0x8483, 0x8484, 0x8485, 0x8486, 0x8487, 0x8488, 0xB2BF, 0xB2C0, 0x8489, 0x848A,
+	0xB2C1, 0x848B, 0xB2C2, 0x848C, 0xB2C3, 0x848D, 0x848E, 0x848F, 0x8490, 0x8491, 0x8492, 0x8493, 0xB2C4, 0xB2C5, 0x8494, 0xB2C6,
+	0x8495, 0xB2C7, 0xB2C8, 0xB2C9, 0x8496, 0x8497, 0x8498, 0x8499, 0xB2CA, 0xB2CB, 0x849A, 0x849B, 0x849C, 0x849D, 0x849E, 0x849F,
+	0xB2CC, 0x84A0, 0x84A1, 0x84A2, 0x84A3, 0x84A4, 0x84A5, 0x84A6, 0x84A7, 0x84A8, 0x84A9, 0x84AA, 0xB2CD, 0xB2CE, 0x84AB, 0x84AC,
+	0x84AD, 0x84AE, 0x84AF, 0x84B0, 0xB2CF, 0xB2D0, 0x84B1, 0x84B2, 0x84B3, 0x84B4, 0x84B5, 0x84B6, 0x84B7, 0x84B8, 0x84B9, 0x84BA,
+	0x84BB, 0x84BC, 0x84BD, 0x84BE, 0x84BF, 0x84C0, 0x84C1, 0x84C2, 0x84C3, 0xB2D1, 0x84C4, 0x84C5, 0x84C6, 0x84C7, 0x84C8, 0x84C9,
+	0xB2D2, 0x84CA, 0x84CB, 0x84CC, 0xB2D3, 0x84CD, 0x84CE, 0x84CF, 0xB2D4, 0x84D0, 0x84D1, 0x84D2, 0x84D3, 0x84D4, 0x84D5, 0x84D6,
+	0xB2D5, 0xB2D6, 0x84D7, 0x84D8, 0x84D9, 0xB2D7, 0x84DA, 0x84DB, 0x84DC, 0x84DD, 0x84DE, 0x84DF, 0xB2D8, 0x84E0, 0x84E1, 0x84E2,
+	0x84E3, 0x84E4, 0x84E5, 0x84E6, 0x84E7, 0x84E8, 0x84E9, 0x84EA, 0x84EB, 0x84EC, 0x84ED, 0x84EE, 0x84EF, 0x84F0, 0x84F1, 0x84F2,
+	0x84F3, 0x84F4, 0x84F5, 0x84F6, 0x84F7, 0x84F8, 0x84F9, 0x84FA, 0xB2D9, 0xB2DA, 0x84FB, 0x84FC, 0xB2DB, 0x84FD, 0x84FE, 0x8541,
+	0xB2DC, 0x8542, 0x8543, 0x8544, 0x8545, 0x8546, 0x8547, 0xB2DD, 0xB2DE, 0xB2DF, 0x8548, 0xB2E0, 0x8549, 0xB2E1, 0xB2E2, 0x854A,
+	0x854B, 0x854C, 0x854D, 0x854E, 0xB2E3, 0x854F, 0x8550, 0x8551, 0x8552, 0x8553, 0x8554, 0x8555, 0xB2E4, 0x8556, 0x8557, 0x8558,
+	0x8559, 0x855A, 0x8561, 0x8562, 0x8563, 0x8564, 0x8565, 0x8566, 0xB2E5, 0xB2E6, 0x8567, 0x8568, 0x8569, 0x856A, 0x856B, 0x856C,
+	0xB2E7, 0xB2E8, 0x856D, 0x856E, 0xB2E9, 0x856F, 0x8570, 0x8571, 0xB2EA, 0x8572, 0x8573, 0x8574, 0x8575, 0x8576, 0x8577, 0x8578,
+	0xB2EB, 0xB2EC, 0x8579, 0x857A, 0xB2ED, 0x8581, 0x8582, 0x8583, 0x8584, 0x8585, 0x8586, 0x8587, 0xB2EE, 0x8588, 0x8589, 0x858A,
+	0xB2EF, 0x858B, 0x858C, 0x858D, 0xB2F0, 0x858E, 0x858F, 0x8590, 0x8591, 0x8592, 0x8593, 0x8594, 0xB2F1, 0xB2F2, 0x8595, 0x8596,
+	0x8597, 0x8598, 0x8599, 0x859A, 0x859B, 0x859C, 0x859D, 0x859E, 0xB2F3, 0x859F, 0x85A0, 0x85A1, 0x85A2, 0x85A3, 0x85A4, 0x85A5,
+	0x85A6, 0x85A7, 0x85A8, 0x85A9, 0x85AA, 0x85AB, 0x85AC, 0x85AD, 0x85AE, 0x85AF, 0x85B0, 0x85B1, 0x85B2, 0x85B3, 0x85B4, 0x85B5,
+	0x85B6, 0x85B7, 0x85B8, 0x85B9, 0xB2F4, 0xB2F5, 0x85BA, 0x85BB, 0xB2F6, 0x85BC, 0xB2F7, 0x85BD, 0xB2F8, 0x85BE, 0xB2F9, 0x85BF,
+	0x85C0, 0x85C1, 0x85C2, 0xB2FA, 0xB2FB, 0xB2FC, 0x85C3, 0xB2FD, 0x85C4, 0xB2FE, 0x85C5, 0x85C6, 0x85C7, 0xB3A1, 0x85C8, 0x85C9,
+	0x85CA, 0x85CB, 0x85CC, 0x85CD, 0x85CE, 0x85CF, 0x85D0, 0x85D1, 0x85D2, 0x85D3, 0x85D4, 0x85D5, 0x85D6, 0x85D7, 0x85D8, 0x85D9,
+	0x85DA, 0x85DB, 0x85DC, 0x85DD, 0x85DE, 0x85DF, 0x85E0, 0x85E1, 0x85E2, 0x85E3, 0x85E4, 0x85E5, 0xB3A2, 0xB3A3, 0x85E6, 0x85E7,
+	0xB3A4, 0x85E8, 0x85E9, 0x85EA, 0xB3A5, 0x85EB, 0x85EC, 0x85ED, 0x85EE, 0x85EF, 0x85F0, 0x85F1, 0xB3A6, 0xB3A7, 0x85F2, 0xB3A8,
+	0x85F3, 0xB3A9, 0x85F4, 0x85F5, 0x85F6, 0x85F7, 0x85F8, 0x85F9, 0xB3AA, 0xB3AB, 0xB3AC, 0x85FA, 0xB3AD, 0x85FB, 0x85FC, 0xB3AE,
+	0xB3AF, 0xB3B0, 0xB3B1, 0x85FD, 0x85FE, 0x8641, 0x8642, 0x8643, 0xB3B2, 0xB3B3, 0x8644, 0xB3B4, 0xB3B5, 0xB3B6, 0xB3B7, 0xB3B8,
+	0x8645, 0xB3B9, 0x8646, 0xB3BA, 0xB3BB, 0xB3BC, 0x8647, 0x8648, 0xB3BD, 0x8649, 0x864A, 0x864B, 0xB3BE, 0x864C, 0x864D, 0x864E,
+	0x864F, 0x8650, 0x8651, 0x8652, 0xB3BF, 0xB3C0, 0x8653, 0xB3C1, 0xB3C2, 0xB3C3, 0x8654, 0x8655, 0x8656, 0x8657, 0x8658, 0x8659,
+	0xB3C4, 0xB3C5, 0x865A, 0x8661, 0xB3C6, 0x8662, 0x8663, 0x8664, 0xB3C7, 0x8665, 0x8666, 0x8667, 0x8668, 0x8669, 0x866A, 0x866B,
+	0xB3C8, 0x866C, 0x866D, 0x866E, 0x866F, 0xB3C9, 0x8670, 0x8671, 0x8672, 0x8673, 0x8674, 0x8675, 0x8676, 0x8677, 0x8678, 0x8679,
+	0x867A, 0x8681, 0x8682, 0x8683, 0x8684, 0x8685, 0x8686, 0x8687, 0x8688, 0x8689, 0x868A, 0x868B, 0x868C, 0x868D, 0x868E, 0x868F,
+	0x8690, 0x8691, 0x8692, 0x8693, 0x8694, 0x8695, 0x8696, 0x8697, 0xB3CA, 0xB3CB, 0x8698, 0xB3CC, 0xB3CD, 0x8699, 0x869A, 0x869B,
+	0xB3CE, 0x869C, 0xB3CF, 0xB3D0, 0x869D, 0x869E, 0x869F, 0x86A0, 0xB3D1, 0xB3D2, 0x86A1, 0xB3D3, 0xB3D4, 0xB3D5, 0x86A2, 0x86A3,
+	0x86A4, 0x86A5, 0x86A6, 0xB3D6, 0xB3D7, 0xB3D8, 0x86A7, 0x86A8, 0xB3D9, 0x86A9, 0x86AA, 0x86AB, 0xB3DA, 0x86AC, 0x86AD, 0x86AE,
+	0x86AF, 0x86B0, 0x86B1, 0x86B2, 0xB3DB, 0xB3DC, 0x86B3, 0xB3DD, 0xB3DE, 0xB3DF, 0x86B4, 0x86B5, 0x86B6, 0x86B7, 0x86B8, 0x86B9,
+	0xB3E0, 0xB3E1, 0x86BA, 0x86BB, 0xB3E2, 0x86BC, 0x86BD, 0x86BE, 0xB3E3, 0x86BF, 0x86C0, 0x86C1, 0x86C2, 0x86C3, 0x86C4, 0x86C5,
+	0xB3E4, 0xB3E5, 0x86C6, 0x86C7, 0xB3E6, 0xB3E7, 0x86C8, 0x86C9, 0xB3E8, 0x86CA, 0x86CB, 0x86CC, 0xB3E9, 0x86CD, 0x86CE, 0x86CF,
+	0xB3EA, 0x86D0, 0x86D1, 0x86D2, 0x86D3, 0x86D4, 0x86D5, 0x86D6, 0x86D7, 0x86D8, 0x86D9, 0x86DA, 0x86DB, 0x86DC, 0x86DD, 0x86DE,
+	0x86DF, 0x86E0, 0x86E1, 0x86E2, 0x86E3, 0x86E4, 0x86E5, 0x86E6, 0xB3EB, 0xB3EC, 0x86E7, 0x86E8, 0xB3ED, 0x86E9, 0x86EA, 0x86EB,
+	0xB3EE, 0x86EC, 0xB3EF, 0x86ED, 0x86EE, 0x86EF, 0x86F0, 0x86F1, 0xB3F0, 0xB3F1, 0x86F2, 0xB3F2, 0x86F3, 0xB3F3, 0x86F4, 0x86F5,
+	0x86F6, 0x86F7, 0xB3F4, 0xB3F5, 0xB3F6, 0x86F8, 0x86F9, 0x86FA, 0xB3F7, 0x86FB, 0x86FC, 0x86FD, 0xB3F8, 0x86FE, 0x8741, 0x8742,
+	0x8743, 0x8744, 0x8745, 0x8746, 0x8747, 0x8748, 0x8749, 0x874A, 0xB3F9, 0x874B, 0x874C, 0x874D, 0x874E, 0x874F, 0x8750, 0x8751,
+	0x8752, 0x8753, 0x8754, 0x8755, 0x8756, 0x8757, 0x8758, 0x8759, 0x875A, 0x8761, 0x8762, 0x8763, 0x8764, 0x8765, 0x8766, 0x8767,
+	0x8768, 0x8769, 0x876A, 0x876B, 0x876C, 0x876D, 0x876E, 0x876F, 0x8770, 0x8771, 0x8772, 0x8773, 0xB3FA, 0x8774, 0x8775, 0x8776,
+	0xB3FB, 0x8777, 0x8778, 0x8779, 0xB3FC, 0x877A, 0x8781, 0x8782, 0x8783, 0x8784, 0x8785, 0x8786, 0xB3FD, 0xB3FE, 0x8787, 0xB4A1,
+	0x8788, 0x8789, 0x878A, 0x878B, 0x878C, 0x878D, 0x878E, 0x878F, 0xB4A2, 0xB4A3, 0x8790, 0x8791, 0xB4A4, 0x8792, 0x8793, 0x8794,
+	0xB4A5, 0x8795, 0x8796, 0x8797, 0x8798, 0x8799, 0x879A, 0x879B, 0x879C, 0xB4A6, 0x879D, 0xB4A7, 0x879E, 0xB4A8, 0x879F, 0x87A0,
+	0x87A1, 0x87A2, 0x87A3, 0x87A4, 0xB4A9, 0xB4AA, 0x87A5, 0x87A6, 0xB4AB, 0x87A7, 0x87A8, 0xB4AC, 0xB4AD, 0x87A9, 0x87AA, 0x87AB,
+	0x87AC, 0x87AD, 0x87AE, 0x87AF, 0xB4AE, 0xB4AF, 0x87B0, 0xB4B0, 0x87B1, 0xB4B1, 0x87B2, 0x87B3, 0x87B4, 0x87B5, 0x87B6, 0x87B7,
+	0xB4B2, 0x87B8, 0x87B9, 0x87BA, 0x87BB, 0x87BC, 0x87BD, 0x87BE, 0x87BF, 0x87C0, 0x87C1, 0x87C2, 0x87C3, 0x87C4, 0x87C5, 0x87C6,
+	0x87C7, 0x87C8, 0x87C9, 0x87CA, 0xB4B3, 0x87CB, 0x87CC, 0x87CD, 0x87CE, 0x87CF, 0x87D0, 0x87D1, 0xB4B4, 0x87D2, 0x87D3, 0x87D4,
+	0x87D5, 0x87D6, 0x87D7, 0x87D8, 0x87D9, 0x87DA, 0x87DB, 0x87DC, 0x87DD, 0x87DE, 0x87DF, 0x87E0, 0x87E1, 0x87E2, 0x87E3, 0x87E4,
+	0x87E5, 0x87E6, 0x87E7, 0x87E8, 0x87E9, 0x87EA, 0x87EB, 0x87EC, 0xB4B5, 0x87ED, 0x87EE, 0x87EF, 0xB4B6, 0x87F0, 0x87F1, 0x87F2,
+	0xB4B7, 0x87F3, 0x87F4, 0x87F5, 0x87F6, 0x87F7, 0x87F8, 0x87F9, 0xB4B8, 0xB4B9, 0x87FA, 0x87FB, 0x87FC, 0x87FD, 0x87FE, 0x8841,
+	0x8842, 0x8843, 0x8844, 0x8845, 0xB4BA, 0xB4BB, 0x8846, 0x8847, 0x8848, 0x8849, 0x884A, 0x884B, 0xB4BC, 0x884C, 0x884D, 0x884E,
+	0x884F, 0x8850, 0x8851, 0x8852, 0xB4BD, 0xB4BE, 0x8853, 0x8854, 0x8855, 0xB4BF, 0x8856, 0x8857, 0x8858, 0x8859, 0x885A, 0x8861,
+	0xB4C0, 0xB4C1, 0x8862, 0x8863, 0xB4C2, 0x8864, 0x8865, 0x8866, 0xB4C3, 0xB4C4, 0xB4C5, 0x8867, 0x8868, 0x8869, 0x886A, 0x886B,
+	0xB4C6, 0xB4C7, 0x886C, 0xB4C8, 0x886D, 0xB4C9, 0xB4CA, 0x886E, 0x886F, 0x8870, 0xB4CB, 0x8871, 0xB4CC, 0x8872, 0x8873, 0x8874,
+	0xB4CD, 0x8875, 0x8876, 0x8877, 0xB4CE, 0x8878, 0x8879, 0x887A, 0x8881, 0x8882, 0x8883, 0x8884, 0x8885, 0x8886, 0x8887, 0x8888,
+	0x8889, 0x888A, 0x888B, 0x888C, 0x888D, 0x888E, 0x888F, 0x8890, 0xB4CF, 0xB4D0, 0x8891, 0x8892, 0xB4D1, 0x8893, 0x8894, 0x8895,
+	0xB4D2, 0x8896, 0xB4D3, 0x8897, 0x8898, 0x8899, 0x889A, 0x889B, 0xB4D4, 0xB4D5, 0x889C, 0xB4D6, 0x889D, 0xB4D7, 0x889E, 0x889F,
+	0x88A0, 0x88A1, 0xB4D8, 0x88A2, 0xB4D9, 0xB4DA, 0xB4DB, 0x88A3, 0xB4DC, 0x88A4, 0x88A5, 0xB4DD, 0xB4DE, 0xB4DF, 0xB4E0, 0xB4E1,
+	0x88A6, 0x88A7, 0x88A8, 0xB4E2, 0xB4E3, 0xB4E4, 0x88A9, 0xB4E5, 0xB4E6, 0xB4E7, 0xB4E8, 0xB4E9, 0x88AA, 0x88AB, 0x88AC, 0xB4EA,
+	0xB4EB, 0xB4EC, 0x88AD, 0x88AE, 0xB4ED, 0x88AF, 0x88B0, 0x88B1, 0xB4EE, 0x88B2, 0x88B3, 0x88B4, 0x88B5, 0x88B6, 0x88B7, 0x88B8,
+	0xB4EF, 0xB4F0, 0x88B9, 0xB4F1, 0xB4F2, 0xB4F3, 0x88BA, 0x88BB, 0x88BC, 0x88BD, 0x88BE, 0x88BF, 0xB4F4, 0x88C0, 0x88C1, 0x88C2,
+	0x88C3, 0x88C4, 0x88C5, 0x88C6, 0x88C7, 0x88C8, 0x88C9, 0x88CA, 0x88CB, 0x88CC, 0x88CD, 0x88CE, 0x88CF, 0x88D0, 0x88D1, 0x88D2,
+	0x88D3, 0x88D4, 0x88D5, 0x88D6, 0x88D7, 0x88D8, 0x88D9, 0x88DA, 0x88DB, 0x88DC, 0x88DD, 0x88DE, 0x88DF, 0x88E0, 0x88E1, 0x88E2,
+	0x88E3, 0x88E4, 0x88E5, 0x88E6, 0x88E7, 0x88E8, 0x88E9, 0x88EA, 0x88EB, 0x88EC, 0x88ED, 0x88EE, 0x88EF, 0x88F0, 0x88F1, 0x88F2,
+	0x88F3, 0x88F4, 0x88F5, 0x88F6, 0xB4F5, 0xB4F6, 0xB4F7, 0x88F7, 0xB4F8, 0x88F8, 0x88F9, 0xB4F9, 0xB4FA, 0x88FA, 0xB4FB, 0xB4FC,
+	0x88FB, 0x88FC, 0x88FD, 0x88FE, 0xB4FD, 0xB4FE, 0x8941, 0xB5A1, 0x8942, 0xB5A2, 0x8943, 0xB5A3, 0x8944, 0x8945, 0xB5A4, 0x8946,
+	0xB5A5, 0xB5A6, 0x8947, 0x8948, 0xB5A7, 0x8949, 0x894A, 0x894B, 0xB5A8, 0x894C, 0x894D, 0x894E, 0x894F, 0x8950, 0x8951, 0x8952,
+	0xB5A9, 0xB5AA, 0x8953, 0xB5AB, 0xB5AC, 0xB5AD, 0x8954, 0x8955, 0x8956, 0x8957, 0x8958, 0x8959, 0xB5AE, 0x895A, 0x8961, 0x8962,
+	0xB5AF, 0x8963, 0x8964, 0x8965, 0xB5B0, 0x8966, 0x8967, 0x8968, 0x8969, 0x896A, 0x896B, 0x896C, 0x896D, 0x896E, 0x896F, 0x8970,
+	0xB5B1, 0xB5B2, 0x8971, 0x8972, 0x8973, 0x8974, 0x8975, 0x8976, 0xB5B3, 0x8977, 0x8978, 0x8979, 0xB5B4, 0x897A, 0x8981, 0x8982,
+	0x8983, 0x8984, 0x8985, 0x8986, 0x8987, 0x8988, 0x8989, 0x898A, 0x898B, 0x898C, 0x898D, 0x898E, 0x898F, 0x8990, 0x8991, 0x8992,
+	0x8993, 0x8994, 0x8995, 0x8996, 0xB5B5, 0xB5B6, 0x8997, 0x8998, 0xB5B7, 0x8999, 0x899A, 0xB5B8, 0xB5B9, 0x899B, 0xB5BA, 0x899C,
+	0xB5BB, 0x899D, 0x899E, 0x899F, 0xB5BC, 0xB5BD, 0x89A0, 0xB5BE, 0x89A1, 0xB5BF, 0x89A2, 0xB5C0, 0x89A3, 0xB5C1, 0x89A4, 0x89A5,
+	0xB5C2, 0x89A6, 0x89A7, 0x89A8, 0xB5C3, 0x89A9, 0x89AA, 0x89AB, 0xB5C4, 0x89AC, 0x89AD, 0x89AE, 0x89AF, 0x89B0, 0x89B1, 0x89B2,
+	0x89B3, 0x89B4, 0x89B5, 0x89B6, 0x89B7, 0x89B8, 0x89B9, 0x89BA, 0x89BB, 0x89BC, 0x89BD, 0x89BE, 0xB5C5, 0x89BF, 0x89C0, 0x89C1,
+	0x89C2, 0x89C3, 0x89C4, 0x89C5, 0x89C6, 0x89C7, 0x89C8, 0x89C9, 0x89CA, 0x89CB, 0x89CC, 0x89CD, 0x89CE, 0x89CF, 0x89D0, 0x89D1,
+	0xB5C6, 0x89D2, 0x89D3, 0x89D4, 0x89D5, 0x89D6, 0x89D7, 0x89D8, 0xB5C7, 0x89D9, 0x89DA, 0x89DB, 0xB5C8, 0x89DC, 0x89DD, 0x89DE,
+	0xB5C9, 0x89DF, 0x89E0, 0x89E1, 0x89E2, 0x89E3, 0x89E4, 0x89E5, 0xB5CA, 0xB5CB, 0x89E6, 0xB5CC, 0x89E7, 0x89E8, 0x89E9, 0x89EA,
+	0x89EB, 0x89EC, 0x89ED, 0x89EE, 0xB5CD, 0x89EF, 0x89F0, 0x89F1, 0x89F2, 0x89F3, 0x89F4, 0x89F5, 0x89F6, 0x89F7, 0x89F8, 0x89F9,
+	0x89FA, 0x89FB, 0x89FC, 0x89FD, 0x89FE, 0x8A41, 0x8A42, 0x8A43, 0x8A44, 0x8A45, 0x8A46, 0x8A47, 0x8A48, 0x8A49, 0x8A4A, 0x8A4B,
+	0xB5CE, 0xB5CF, 0x8A4C, 0x8A4D, 0xB5D0, 0x8A4E, 0x8A4F, 0x8A50, 0xB5D1, 0x8A51, 0x8A52, 0x8A53, 0x8A54, 0x8A55, 0x8A56, 0x8A57,
+	0xB5D2, 0xB5D3, 0x8A58, 0xB5D4, 0x8A59, 0xB5D5, 0x8A5A, 0x8A61, 0x8A62, 0x8A63, 0x8A64, 0x8A65, 0xB5D6, 0x8A66, 0x8A67, 0x8A68,
+	0x8A69, 0x8A6A, 0x8A6B, 0x8A6C, 0x8A6D, 0x8A6E, 0x8A6F, 0x8A70, 0x8A71, 0x8A72, 0x8A73, 0x8A74, 0x8A75, 0x8A76, 0x8A77, 0x8A78,
+	0xB5D7, 0x8A79, 0x8A7A, 0x8A81, 0x8A82, 0x8A83, 0x8A84, 0x8A85, 0xB5D8, 0x8A86, 0x8A87, 0x8A88, 0x8A89, 0x8A8A, 0x8A8B, 0x8A8C,
+	0x8A8D, 0x8A8E, 0x8A8F, 0x8A90, 0x8A91, 0x8A92, 0x8A93, 0x8A94, 0x8A95, 0x8A96, 0x8A97, 0x8A98, 0x8A99, 0xB5D9, 0x8A9A, 0x8A9B,
+	0x8A9C, 0x8A9D, 0x8A9E, 0x8A9F, 0xB5DA, 0x8AA0, 0x8AA1, 0x8AA2, 0xB5DB, 0x8AA3, 0x8AA4, 0x8AA5, 0xB5DC, 0x8AA6, 0x8AA7, 0x8AA8,
+	0x8AA9, 0x8AAA, 0x8AAB, 0x8AAC, 0x8AAD, 0xB5DD, 0x8AAE, 0xB5DE, 0x8AAF, 0xB5DF, 0x8AB0, 0x8AB1, 0x8AB2, 0x8AB3, 0x8AB4, 0x8AB5,
+	0xB5E0, 0x8AB6, 0x8AB7, 0x8AB8, 0xB5E1, 0x8AB9, 0x8ABA, 0x8ABB, 0xB5E2, 0x8ABC, 0x8ABD, 0x8ABE, 0x8ABF, 0x8AC0, 0x8AC1, 0x8AC2,
+	0xB5E3, 0x8AC3, 0x8AC4, 0x8AC5, 0x8AC6, 0xB5E4, 0x8AC7, 0x8AC8, 0x8AC9, 0x8ACA, 0x8ACB, 0x8ACC, 0xB5E5, 0xB5E6, 0x8ACD, 0x8ACE,
+	0xB5E7, 0x8ACF, 0x8AD0, 0xB5E8, 0xB5E9, 0x8AD1, 0xB5EA, 0x8AD2, 0x8AD3, 0x8AD4, 0x8AD5, 0x8AD6, 0xB5EB, 0xB5EC, 0x8AD7, 0xB5ED,
+	0x8AD8, 0xB5EE, 0x8AD9, 0x8ADA, 0x8ADB, 0x8ADC, 0x8ADD, 0x8ADE, 0xB5EF, 0x8ADF, 0x8AE0, 0x8AE1, 0x8AE2, 0x8AE3, 0x8AE4, 0x8AE5,
+	0x8AE6, 0x8AE7, 0x8AE8, 0x8AE9, 0x8AEA, 0x8AEB, 0x8AEC, 0x8AED, 0x8AEE, 0x8AEF, 0x8AF0, 0x8AF1, 0x8AF2, 0x8AF3, 0x8AF4, 0x8AF5,
+	0x8AF6, 0x8AF7, 0x8AF8, 0x8AF9, 0xB5F0, 0xB5F1, 0x8AFA, 0x8AFB, 0xB5F2, 0x8AFC, 0x8AFD, 0xB5F3, 0xB5F4, 0x8AFE, 0x8B41, 0x8B42,
+	0x8B43, 0x8B44, 0x8B45, 0x8B46, 0xB5F5, 0xB5F6, 0x8B47, 0xB5F7, 0xB5F8, 0xB5F9, 0xB5FA, 0x8B48, 0x8B49, 0x8B4A, 0x8B4B, 0x8B4C,
+	0xB5FB, 0xB5FC, 0x8B4D, 0x8B4E, 0xB5FD, 0x8B4F, 0x8B50, 0x8B51, 0xB5FE, 0x8B52, 0x8B53, 0x8B54, 0x8B55, 0x8B56, 0x8B57, 0x8B58,
+	0xB6A1, 0xB6A2, 0x8B59, 0xB6A3, 0xB6A4, 0xB6A5, 0x8B5A, 0x8B61, 0x8B62, 0x8B63, 0x8B64, 0xB6A6, 0xB6A7, 0xB6A8, 0x8B65, 0x8B66,
+	0xB6A9, 0x8B67, 0x8B68, 0x8B69, 0xB6AA, 0x8B6A, 0x8B6B, 0x8B6C, 0x8B6D, 0x8B6E, 0x8B6F, 0x8B70, 0xB6AB, 0xB6AC, 0x8B71, 0xB6AD,
+	0xB6AE, 0xB6AF, 0x8B72, 0x8B73, 0x8B74, 0x8B75, 0x8B76, 0x8B77, 0x8B78, 0x8B79, 0x8B7A, 0x8B81, 0x8B82, 0x8B83, 0x8B84, 0x8B85,
+	0x8B86, 0x8B87, 0x8B88, 0x8B89, 0x8B8A, 0x8B8B, 0x8B8C, 0x8B8D, 0x8B8E, 0x8B8F, 0x8B90, 0x8B91, 0x8B92, 0x8B93, 0x8B94, 0x8B95,
+	0x8B96, 0x8B97, 0x8B98, 0x8B99, 0x8B9A, 0x8B9B, 0x8B9C, 0x8B9D, 0x8B9E, 0x8B9F, 0x8BA0, 0x8BA1, 0x8BA2, 0x8BA3, 0x8BA4, 0x8BA5,
+	0x8BA6, 0x8BA7, 0x8BA8, 0x8BA9, 0x8BAA, 0x8BAB, 0x8BAC, 0x8BAD, 0x8BAE, 0x8BAF, 0x8BB0, 0x8BB1, 0x8BB2, 0x8BB3, 0x8BB4, 0x8BB5,
+	0xB6B0, 0xB6B1, 0x8BB6, 0x8BB7, 0xB6B2, 0x8BB8, 0x8BB9, 0x8BBA, 0xB6B3, 0x8BBB, 0xB6B4, 0xB6B5, 0x8BBC, 0x8BBD, 0x8BBE, 0x8BBF,
+	0xB6B6, 0xB6B7, 0x8BC0, 0xB6B8, 0xB6B9, 0xB6BA, 0x8BC1, 0x8BC2, 0x8BC3, 0x8BC4, 0x8BC5, 0xB6BB, 0xB6BC, 0xB6BD, 0x8BC6, 0x8BC7,
+	0xB6BE, 0x8BC8, 0x8BC9, 0x8BCA, 0xB6BF, 0x8BCB, 0x8BCC, 0x8BCD, 0x8BCE, 0x8BCF, 0x8BD0, 0x8BD1, 0xB6C0, 0xB6C1, 0x8BD2, 0xB6C2,
+	0xB6C3, 0xB6C4, 0x8BD3, 0x8BD4, 0x8BD5, 0x8BD6, 0x8BD7, 0x8BD8, 0xB6C5, 0x8BD9, 0x8BDA, 0x8BDB, 0x8BDC, 0x8BDD, 0x8BDE, 0x8BDF,
+	0x8BE0, 0x8BE1, 0x8BE2, 0x8BE3, 0x8BE4, 0x8BE5, 0x8BE6, 0x8BE7, 0x8BE8, 0x8BE9, 0x8BEA, 0x8BEB, 0xB6C6, 0x8BEC, 0x8BED, 0x8BEE,
+	0x8BEF, 0x8BF0, 0x8BF1, 0x8BF2, 0x8BF3, 0x8BF4, 0x8BF5, 0x8BF6, 0x8BF7, 0x8BF8, 0x8BF9, 0x8BFA, 0x8BFB, 0x8BFC, 0x8BFD, 0x8BFE,
+	0x8C41, 0x8C42, 0x8C43, 0x8C44, 0x8C45, 0x8C46, 0x8C47, 0x8C48, 0x8C49, 0x8C4A, 0x8C4B, 0x8C4C, 0x8C4D, 0x8C4E, 0x8C4F, 0x8C50,
+	0xB6C7, 0xB6C8, 0x8C51, 0x8C52, 0xB6C9, 0x8C53, 0x8C54, 0x8C55, 0xB6CA, 0x8C56, 0x8C57, 0x8C58, 0x8C59, 0x8C5A, 0x8C61, 0x8C62,
+	0x8C63, 0x8C64, 0x8C65, 0x8C66, 0x8C67, 0xB6CB, 0x8C68, 0x8C69, 0x8C6A, 0x8C6B, 0x8C6C, 0x8C6D, 0xB6CC, 0x8C6E, 0x8C6F, 0x8C70,
+	0x8C71, 0x8C72, 0x8C73, 0x8C74, 0xB6CD, 0x8C75, 0x8C76, 0x8C77, 0x8C78, 0x8C79, 0x8C7A, 0x8C81, 0x8C82, 0x8C83, 0x8C84, 0x8C85,
+	0x8C86, 0x8C87, 0x8C88, 0x8C89, 0x8C8A, 0x8C8B, 0x8C8C, 0x8C8D, 0xB6CE, 0x8C8E, 0x8C8F, 0x8C90, 0x8C91, 0x8C92, 0x8C93, 0x8C94,
+	0x8C95, 0x8C96, 0x8C97, 0x8C98, 0x8C99, 0x8C9A, 0x8C9B, 0x8C9C, 0x8C9D, 0x8C9E, 0x8C9F, 0x8CA0, 0x8CA1, 0x8CA2, 0x8CA3, 0x8CA4,
+	0x8CA5, 0x8CA6, 0x8CA7, 0x8CA8, 0xB6CF, 0x8CA9, 0x8CAA, 0x8CAB, 0xB6D0, 0x8CAC, 0x8CAD, 0x8CAE, 0x8CAF, 0x8CB0, 0x8CB1, 0x8CB2,
+	0x8CB3, 0x8CB4, 0x8CB5, 0x8CB6, 0x8CB7, 0x8CB8, 0x8CB9, 0x8CBA, 0x8CBB, 0x8CBC, 0x8CBD, 0x8CBE, 0x8CBF, 0x8CC0, 0x8CC1, 0x8CC2,
+	0x8CC3, 0x8CC4, 0x8CC5, 0x8CC6, 0x8CC7, 0x8CC8, 0x8CC9, 0x8CCA, 0x8CCB, 0x8CCC, 0x8CCD, 0x8CCE, 0x8CCF, 0x8CD0, 0x8CD1, 0x8CD2,
+	0x8CD3, 0x8CD4, 0x8CD5, 0x8CD6, 0x8CD7, 0x8CD8, 0x8CD9, 0x8CDA, 0x8CDB, 0x8CDC, 0x8CDD, 0x8CDE, 0xB6D1, 0xB6D2, 0x8CDF, 0x8CE0,
+	0xB6D3, 0x8CE1, 0x8CE2, 0x8CE3, 0xB6D4, 0x8CE4, 0x8CE5, 0x8CE6, 0x8CE7, 0x8CE8, 0x8CE9, 0xB6D5, 0xB6D6, 0x8CEA, 0x8CEB, 0x8CEC,
+	0x8CED, 0xB6D7, 0x8CEE, 0x8CEF, 0x8CF0, 0x8CF1, 0x8CF2, 0x8CF3, 0x8CF4, 0x8CF5, 0x8CF6, 0x8CF7, 0x8CF8, 0x8CF9, 0x8CFA, 0x8CFB,
+	0x8CFC, 0x8CFD, 0x8CFE, 0x8D41, 0x8D42, 0x8D43, 0x8D44, 0x8D45, 0x8D46, 0x8D47, 0x8D48, 0x8D49, 0x8D4A, 0x8D4B, 0x8D4C, 0x8D4D,
+	0x8D4E, 0x8D4F, 0x8D50, 0x8D51, 0xB6D8, 0x8D52, 0x8D53, 0x8D54, 0x8D55, 0x8D56, 0x8D57, 0x8D58, 0x8D59, 0x8D5A, 0x8D61, 0x8D62,
+	0x8D63, 0x8D64, 0x8D65, 0x8D66, 0x8D67, 0x8D68, 0x8D69, 0x8D6A, 0x8D6B, 0x8D6C, 0x8D6D, 0x8D6E, 0x8D6F, 0x8D70, 0x8D71, 0x8D72,
+	0xB6D9, 0x8D73, 0x8D74, 0x8D75, 0xB6DA, 0x8D76, 0x8D77, 0x8D78, 0xB6DB, 0x8D79, 0x8D7A, 0x8D81, 0x8D82, 0x8D83, 0x8D84, 0x8D85,
+	0xB6DC, 0xB6DD, 0x8D86, 0x8D87, 0x8D88, 0xB6DE, 0x8D89, 0x8D8A, 0x8D8B, 0x8D8C, 0x8D8D, 0x8D8E, 0x8D8F, 0x8D90, 0x8D91, 0x8D92,
+	0x8D93, 0x8D94, 0x8D95, 0x8D96, 0x8D97, 0x8D98, 0x8D99, 0x8D9A, 0x8D9B, 0x8D9C, 0x8D9D, 0x8D9E, 0x8D9F, 0x8DA0, 0x8DA1, 0x8DA2,
+	0x8DA3, 0x8DA4, 0x8DA5, 0x8DA6, 0x8DA7, 0x8DA8, 0x8DA9, 0x8DAA, 0xB6DF, 0xB6E0, 0x8DAB, 0x8DAC, 0xB6E1, 0x8DAD, 0x8DAE, 0xB6E2,
+	0xB6E3, 0x8DAF, 0x8DB0, 0x8DB1, 0x8DB2, 0x8DB3, 0x8DB4, 0x8DB5, 0xB6E4, 0xB6E5, 0x8DB6, 0xB6E6, 0x8DB7, 0x8DB8, 0x8DB9, 0x8DBA,
+	0x8DBB, 0x8DBC, 0x8DBD, 0x8DBE, 0xB6E7, 0x8DBF, 0x8DC0, 0x8DC1, 0xB6E8, 0x8DC2, 0x8DC3, 0x8DC4, 0xB6E9, 0x8DC5, 0x8DC6, 0x8DC7,
+	0x8DC8, 0x8DC9, 0x8DCA, 0x8DCB, 0xB6EA, 0xB6EB, 0x8DCC, 0x8DCD, 0x8DCE, 0x8DCF, 0x8DD0, 0x8DD1, 0x8DD2, 0x8DD3, 0x8DD4, 0x8DD5,
+	0xB6EC, 0x8DD6, 0x8DD7, 0x8DD8, 0xB6ED, 0x8DD9, 0x8DDA, 0x8DDB, 0xB6EE, 0x8DDC, 0x8DDD, 0x8DDE, 0x8DDF, 0x8DE0, 0x8DE1, 0x8DE2,
+	0xB6EF, 0xB6F0, 0x8DE3, 0xB6F1, 0x8DE4, 0xB6F2, 0x8DE5, 0x8DE6, 0x8DE7, 0x8DE8, 0x8DE9, 0x8DEA, 0xB6F3, 0xB6F4, 0x8DEB, 0x8DEC,
+	0xB6F5, 0x8DED, 0x8DEE, 0x8DEF, 0xB6F6, 0x8DF0, 0x8DF1, 0x8DF2, 0x8DF3, 0x8DF4, 0x8DF5, 0x8DF6, 0xB6F7, 0xB6F8, 0x8DF7, 0xB6F9,
+	0xB6FA, 0xB6FB, 0xB6FC, 0x8DF8, 0x8DF9, 0x8DFA, 0xB6FD, 0xB6FE, 0xB7A1, 0xB7A2, 0x8DFB, 0x8DFC, 0xB7A3, 0x8DFD, 0x8DFE, 0x8E41,
+	0xB7A4, 0x8E42, 0x8E43, 0x8E44, 0x8E45, 0x8E46, 0x8E47, 0x8E48, 0xB7A5, 0xB7A6, 0x8E49, 0xB7A7, 0xB7A8, 0xB7A9, 0x8E4A, 0x8E4B,
+	0x8E4C, 0x8E4D, 0x8E4E, 0x8E4F, 0xB7AA, 0xB7AB, 0x8E50, 0x8E51, 0xB7AC, 0x8E52, 0x8E53, 0x8E54, 0x8E55, 0x8E56, 0x8E57, 0x8E58,
+	0x8E59, 0x8E5A, 0x8E61, 0x8E62, 0x8E63, 0x8E64, 0x8E65, 0xB7AD, 0x8E66, 0xB7AE, 0x8E67, 0x8E68, 0x8E69, 0x8E6A, 0x8E6B, 0x8E6C,
+	0x8E6D, 0x8E6E, 0x8E6F, 0x8E70, 0x8E71, 0x8E72, 0x8E73, 0x8E74, 0x8E75, 0x8E76, 0x8E77, 0x8E78, 0x8E79, 0x8E7A, 0x8E81, 0x8E82,
+	0x8E83, 0x8E84, 0x8E85, 0x8E86, 0x8E87, 0x8E88, 0x8E89, 0x8E8A, 0x8E8B, 0x8E8C, 0x8E8D, 0x8E8E, 0xB7AF, 0xB7B0, 0x8E8F, 0x8E90,
+	0xB7B1, 0x8E91, 0x8E92, 0x8E93, 0xB7B2, 0x8E94, 0x8E95, 0x8E96, 0x8E97, 0x8E98, 0x8E99, 0x8E9A, 0xB7B3, 0xB7B4, 0x8E9B, 0xB7B5,
+	0xB7B6, 0xB7B7, 0x8E9C, 0x8E9D, 0x8E9E, 0x8E9F, 0x8EA0, 0xB7B8, 0xB7B9, 0xB7BA, 0x8EA1, 0x8EA2, 0xB7BB, 0x8EA3, 0x8EA4, 0x8EA5,
+	0xB7BC, 0x8EA6, 0x8EA7, 0x8EA8, 0x8EA9, 0x8EAA, 0x8EAB, 0x8EAC, 0xB7BD, 0xB7BE, 0x8EAD, 0xB7BF, 0x8EAE, 0xB7C0, 0x8EAF, 0x8EB0,
+	0x8EB1, 0x8EB2, 0x8EB3, 0x8EB4, 0xB7C1, 0xB7C2, 0x8EB5, 0x8EB6, 0xB7C3, 0x8EB7, 0x8EB8, 0x8EB9, 0xB7C4, 0x8EBA, 0x8EBB, 0x8EBC,
+	0x8EBD, 0x8EBE, 0x8EBF, 0x8EC0, 0xB7C5, 0xB7C6, 0x8EC1, 0xB7C7, 0xB7C8, 0xB7C9, 0x8EC2, 0x8EC3, 0x8EC4, 0x8EC5, 0x8EC6, 0x8EC7,
+	0xB7CA, 0x8EC8, 0x8EC9, 0x8ECA, 0xB7CB, 0x8ECB, 0x8ECC, 0x8ECD, 0x8ECE, 0x8ECF, 0x8ED0, 0x8ED1, 0x8ED2, 0x8ED3, 0x8ED4, 0x8ED5,
+	0x8ED6, 0xB7CC, 0x8ED7, 0xB7CD, 0x8ED8, 0x8ED9, 0x8EDA, 0x8EDB, 0x8EDC, 0x8EDD, 0x8EDE, 0x8EDF, 0xB7CE, 0xB7CF, 0x8EE0, 0x8EE1,
+	0xB7D0, 0x8EE2, 0x8EE3, 0x8EE4, 0xB7D1, 0x8EE5, 0x8EE6, 0x8EE7, 0x8EE8, 0x8EE9, 0x8EEA, 0x8EEB, 0xB7D2, 0xB7D3, 0x8EEC, 0xB7D4,
+	0x8EED, 0xB7D5, 0x8EEE, 0x8EEF, 0x8EF0, 0x8EF1, 0x8EF2, 0x8EF3, 0xB7D6, 0x8EF4, 0x8EF5, 0x8EF6, 0xB7D7, 0x8EF7, 0x8EF8, 0x8EF9,
+	0x8EFA, 0x8EFB, 0x8EFC, 0x8EFD, 0x8EFE, 0x8F41, 0x8F42, 0x8F43, 0x8F44, 0x8F45, 0x8F46, 0x8F47, 0x8F48, 0xB7D8, 0x8F49, 0x8F4A,
+	0x8F4B, 0x8F4C, 0x8F4D, 0x8F4E, 0x8F4F, 0x8F50, 0x8F51, 0x8F52, 0x8F53, 0x8F54, 0x8F55, 0x8F56, 0x8F57, 0x8F58, 0x8F59, 0x8F5A,
+	0x8F61, 0x8F62, 0x8F63, 0x8F64, 0x8F65, 0x8F66, 0x8F67, 0x8F68, 0xB7D9, 0x8F69, 0x8F6A, 0x8F6B, 0x8F6C, 0x8F6D, 0x8F6E, 0x8F6F,
+	0xB7DA, 0x8F70, 0x8F71, 0x8F72, 0xB7DB, 0x8F73, 0x8F74, 0x8F75, 0xB7DC, 0x8F76, 0x8F77, 0x8F78, 0x8F79, 0x8F7A, 0x8F81, 0x8F82,
+	0xB7DD, 0xB7DE, 0x8F83, 0xB7DF, 0x8F84, 0xB7E0, 0x8F85, 0x8F86, 0x8F87, 0x8F88, 0x8F89, 0x8F8A, 0xB7E1, 0x8F8B, 0x8F8C, 0x8F8D,
+	0xB7E2, 0x8F8E, 0x8F8F, 0x8F90, 0xB7E3, 0x8F91, 0x8F92, 0x8F93, 0x8F94, 0x8F95, 0x8F96, 0x8F97, 0x8F98, 0xB7E4, 0x8F99, 0xB7E5,
+	0x8F9A, 0xB7E6, 0x8F9B, 0x8F9C, 0x8F9D, 0x8F9E, 0x8F9F, 0x8FA0, 0xB7E7, 0xB7E8, 0x8FA1, 0x8FA2, 0xB7E9, 0x8FA3, 0x8FA4, 0x8FA5,
+	0xB7EA, 0x8FA6, 0x8FA7, 0x8FA8, 0x8FA9, 0x8FAA, 0x8FAB, 0x8FAC, 0xB7EB, 0xB7EC, 0x8FAD, 0xB7ED, 0x8FAE, 0xB7EE, 0x8FAF, 0x8FB0,
+	0x8FB1, 0x8FB2, 0x8FB3, 0x8FB4, 0xB7EF, 0x8FB5, 0x8FB6, 0x8FB7, 0x8FB8, 0x8FB9, 0x8FBA, 0x8FBB, 0x8FBC, 0x8FBD, 0x8FBE, 0x8FBF,
+	0x8FC0, 0x8FC1, 0x8FC2, 0x8FC3, 0x8FC4, 0x8FC5, 0x8FC6, 0x8FC7, 0xB7F0, 0x8FC8, 0x8FC9, 0x8FCA, 0x8FCB, 0x8FCC, 0x8FCD, 0x8FCE,
+	0xB7F1, 0x8FCF, 0x8FD0, 0x8FD1, 0x8FD2, 0x8FD3, 0x8FD4, 0x8FD5, 0x8FD6, 0x8FD7, 0x8FD8, 0x8FD9, 0x8FDA, 0x8FDB, 0x8FDC, 0x8FDD,
+	0x8FDE, 0x8FDF, 0x8FE0, 0x8FE1, 0x8FE2, 0x8FE3, 0x8FE4, 0x8FE5, 0x8FE6, 0x8FE7, 0x8FE8, 0x8FE9, 0xB7F2, 0xB7F3, 0x8FEA, 0x8FEB,
+	0xB7F4, 0x8FEC, 0x8FED, 0x8FEE, 0xB7F5, 0x8FEF, 0x8FF0, 0x8FF1, 0x8FF2, 0x8FF3, 0x8FF4, 0x8FF5, 0xB7F6, 0x8FF6, 0x8FF7, 0xB7F7,
+	0x8FF8, 0xB7F8, 0x8FF9, 0x8FFA, 0x8FFB, 0x8FFC, 0x8FFD, 0x8FFE, 0xB7F9, 0xB7FA, 0x9041, 0x9042, 0xB7FB, 0x9043, 0x9044, 0x9045,
+	0xB7FC, 0x9046, 0x9047, 0x9048, 0x9049, 0x904A, 0x904B, 0x904C, 0xB7FD, 0xB7FE, 0x904D, 0xB8A1, 0x904E, 0xB8A2, 0x904F, 0x9050,
+	0x9051, 0x9052, 0x9053, 0x9054, 0xB8A3, 0xB8A4, 0x9055, 0x9056, 0xB8A5, 0x9057, 0x9058, 0x9059, 0xB8A6, 0x905A, 0x9061, 0x9062,
+	0x9063, 0x9064, 0x9065, 0x9066, 0xB8A7, 0xB8A8, 0x9067, 0xB8A9, 0x9068, 0xB8AA, 0xB8AB, 0x9069, 0x906A, 0xB8AC, 0xB8AD, 0x906B,
+	0x906C, 0x906D, 0x906E, 0x906F, 0x9070, 0x9071, 0x9072, 0x9073, 0x9074, 0x9075, 0x9076, 0x9077, 0x9078, 0x9079, 0x907A, 0x9081,
+	0x9082, 0x9083, 0x9084, 0x9085, 0x9086, 0x9087, 0x9088, 0x9089, 0x908A, 0x908B, 0x908C, 0x908D, 0xB8AE, 0xB8AF, 0x908E, 0x908F,
+	0xB8B0, 0x9090, 0x9091, 0x9092, 0xB8B1, 0x9093, 0x9094, 0x9095, 0x9096, 0x9097, 0x9098, 0x9099, 0xB8B2, 0xB8B3, 0x909A, 0xB8B4,
+	0x909B, 0xB8B5, 0x909C, 0x909D, 0x909E, 0x909F, 0x90A0, 0x90A1, 0xB8B6, 0xB8B7, 0x90A2, 0x90A3, 0xB8B8, 0x90A4, 0xB8B9, 0xB8BA,
+	0xB8BB, 0xB8BC, 0xB8BD, 0x90A5, 0x90A6, 0x90A7, 0x90A8, 0x90A9, 0xB8BE, 0xB8BF, 0x90AA, 0xB8C0, 0x90AB, 0xB8C1, 0xB8C2, 0x90AC,
+	0x90AD, 0xB8C3, 0x90AE, 0xB8C4, 0xB8C5, 0xB8C6, 0x90AF, 0x90B0, 0xB8C7, 0x90B1, 0x90B2, 0x90B3, 0xB8C8, 0x90B4, 0x90B5, 0x90B6,
+	0x90B7, 0x90B8, 0x90B9, 0x90BA, 0xB8C9, 0xB8CA, 0x90BB, 0xB8CB, 0xB8CC, 0xB8CD, 0xB8CE, 0x90BC, 0x90BD, 0x90BE, 0x90BF, 0x90C0,
+	0xB8CF, 0xB8D0, 0x90C1, 0x90C2, 0x90C3, 0x90C4, 0x90C5, 0x90C6, 0xB8D1, 0x90C7, 0x90C8, 0x90C9, 0x90CA, 0x90CB, 0x90CC, 0x90CD,
+	0x90CE, 0x90CF, 0x90D0, 0x90D1, 0x90D2, 0xB8D2, 0x90D3, 0x90D4, 0x90D5, 0x90D6, 0x90D7, 0x90D8, 0x90D9, 0x90DA, 0x90DB, 0x90DC,
+	0x90DD, 0x90DE, 0x90DF, 0x90E0, 0x90E1, 0x90E2, 0x90E3, 0x90E4, 0x90E5, 0x90E6, 0x90E7, 0x90E8, 0x90E9, 0x90EA, 0x90EB, 0x90EC,
+	0x90ED, 0x90EE, 0x90EF, 0x90F0, 0x90F1, 0x90F2, 0x90F3, 0x90F4, 0xB8D3, 0xB8D4, 0x90F5, 0x90F6, 0xB8D5, 0x90F7, 0x90F8, 0x90F9,
+	0xB8D6, 0x90FA, 0xB8D7, 0x90FB, 0x90FC, 0x90FD, 0x90FE, 0x9141, 0xB8D8, 0xB8D9, 0x9142, 0xB8DA, 0x9143, 0xB8DB, 0xB8DC, 0x9144,
+	0x9145, 0x9146, 0x9147, 0xB8DD, 0xB8DE, 0xB8DF, 0x9148, 0x9149, 0xB8E0, 0x914A, 0x914B, 0x914C, 0xB8E1, 0x914D, 0x914E, 0x914F,
+	0x9150, 0x9151, 0x9152, 0x9153, 0xB8E2, 0xB8E3, 0x9154, 0xB8E4, 0xB8E5, 0xB8E6, 0x9155, 0x9156, 0x9157, 0x9158, 0x9159, 0x915A,
+	0xB8E7, 0xB8E8, 0x9161, 0x9162, 0xB8E9, 0x9163, 0x9164, 0x9165, 0xB8EA, 0x9166, 0x9167, 0x9168, 0x9169, 0x916A, 0x916B, 0x916C,
+	0x916D, 0x916E, 0x916F, 0xB8EB, 0xB8EC, 0xB8ED, 0x9170, 0xB8EE, 0x9171, 0x9172, 0x9173, 0x9174, 0xB8EF, 0x9175, 0x9176, 0x9177,
+	0x9178, 0x9179, 0x917A, 0x9181, 0x9182, 0x9183, 0x9184, 0x9185, 0x9186, 0x9187, 0x9188, 0x9189, 0x918A, 0x918B, 0x918C, 0x918D,
+	0x918E, 0x918F, 0x9190, 0x9191, 0x9192, 0x9193, 0x9194, 0x9195, 0xB8F0, 0xB8F1, 0x9196, 0xB8F2, 0xB8F3, 0x9197, 0x9198, 0x9199,
+	0xB8F4, 0x919A, 0xB8F5, 0x919B, 0x919C, 0x919D, 0x919E, 0x919F, 0xB8F6, 0xB8F7, 0x91A0, 0xB8F8, 0x91A1, 0xB8F9, 0x91A2, 0x91A3,
+	0x91A4, 0x91A5, 0x91A6, 0x91A7, 0xB8FA, 0x91A8, 0x91A9, 0x91AA, 0xB8FB, 0x91AB, 0x91AC, 0x91AD, 0x91AE, 0x91AF, 0x91B0, 0x91B1,
+	0x91B2, 0x91B3, 0x91B4, 0x91B5, 0x91B6, 0x91B7, 0x91B8, 0x91B9, 0xB8FC, 0xB8FD, 0x91BA, 0x91BB, 0x91BC, 0x91BD, 0x91BE, 0x91BF,
+	0x91C0, 0x91C1, 0x91C2, 0x91C3, 0x91C4, 0x91C5, 0x91C6, 0x91C7, 0x91C8, 0x91C9, 0x91CA, 0x91CB, 0x91CC, 0x91CD, 0x91CE, 0x91CF,
+	0x91D0, 0x91D1, 0x91D2, 0x91D3, 0x91D4, 0x91D5, 0x91D6, 0x91D7, 0x91D8, 0x91D9, 0x91DA, 0x91DB, 0xB8FE, 0x91DC, 0x91DD, 0x91DE,
+	0xB9A1, 0x91DF, 0x91E0, 0x91E1, 0xB9A2, 0x91E2, 0x91E3, 0x91E4, 0x91E5, 0x91E6, 0x91E7, 0x91E8, 0x91E9, 0xB9A3, 0x91EA, 0xB9A4,
+	0x91EB, 0xB9A5, 0x91EC, 0x91ED, 0x91EE, 0x91EF, 0x91F0, 0x91F1, 0xB9A6, 0x91F2, 0x91F3, 0x91F4, 0xB9A7, 0x91F5, 0x91F6, 0x91F7,
+	0xB9A8, 0x91F8, 0x91F9, 0x91FA, 0x91FB, 0x91FC, 0x91FD, 0x91FE, 0x9241, 0xB9A9, 0x9242, 0xB9AA, 0x9243, 0x9244, 0x9245, 0x9246,
+	0x9247, 0x9248, 0x9249, 0x924A, 0xB9AB, 0xB9AC, 0xB9AD, 0x924B, 0xB9AE, 0x924C, 0x924D, 0xB9AF, 0xB9B0, 0xB9B1, 0xB9B2, 0x924E,
+	0x924F, 0x9250, 0x9251, 0x9252, 0xB9B3, 0xB9B4, 0x9253, 0xB9B5, 0x9254, 0xB9B6, 0x9255, 0x9256, 0x9257, 0xB9B7, 0x9258, 0xB9B8,
+	0xB9B9, 0x9259, 0x925A, 0x9261, 0xB9BA, 0x9262, 0x9263, 0x9264, 0xB9BB, 0x9265, 0x9266, 0x9267, 0x9268, 0x9269, 0x926A, 0x926B,
+	0x926C, 0xB9BC, 0x926D, 0xB9BD, 0x926E, 0x926F, 0x9270, 0x9271, 0x9272, 0x9273, 0x9274, 0x9275, 0xB9BE, 0x9276, 0x9277, 0x9278,
+	0x9279, 0x927A, 0x9281, 0x9282, 0x9283, 0x9284, 0x9285, 0x9286, 0x9287, 0x9288, 0x9289, 0x928A, 0x928B, 0x928C, 0x928D, 0x928E,
+	0x928F, 0x9290, 0x9291, 0x9292, 0x9293, 0x9294, 0x9295, 0x9296, 0xB9BF, 0x9297, 0x9298, 0x9299, 0xB9C0, 0x929A, 0x929B, 0x929C,
+	0xB9C1, 0x929D, 0x929E, 0x929F, 0x92A0, 0x92A1, 0x92A2, 0x92A3, 0x92A4, 0x92A5, 0x92A6, 0x92A7, 0x92A8, 0x92A9, 0x92AA, 0x92AB,
+	0x92AC, 0x92AD, 0x92AE, 0x92AF, 0xB9C2, 0x92B0, 0x92B1, 0x92B2, 0xB9C3, 0x92B3, 0x92B4, 0x92B5, 0xB9C4, 0x92B6, 0x92B7, 0x92B8,
+	0x92B9, 0x92BA, 0x92BB, 0x92BC, 0xB9C5, 0x92BD, 0x92BE, 0xB9C6, 0x92BF, 0x92C0, 0x92C1, 0x92C2, 0x92C3, 0x92C4, 0x92C5, 0x92C6,
+	0xB9C7, 0x92C7, 0x92C8, 0x92C9, 0xB9C8, 0x92CA, 0x92CB, 0x92CC, 0xB9C9, 0x92CD, 0x92CE, 0x92CF, 0x92D0, 0x92D1, 0x92D2, 0x92D3,
+	0xB9CA, 0x92D4, 0x92D5, 0xB9CB, 0x92D6, 0x92D7, 0x92D8, 0x92D9, 0x92DA, 0x92DB, 0x92DC, 0x92DD, 0x92DE, 0x92DF, 0x92E0, 0x92E1,
+	0x92E2, 0x92E3, 0x92E4, 0x92E5, 0x92E6, 0x92E7, 0x92E8, 0x92E9, 0x92EA, 0x92EB, 0x92EC, 0x92ED, 0x92EE, 0x92EF, 0x92F0, 0x92F1,
+	0x92F2, 0x92F3, 0x92F4, 0x92F5, 0x92F6, 0x92F7, 0x92F8, 0x92F9, 0xB9CC, 0xB9CD, 0x92FA, 0x92FB, 0xB9CE, 0x92FC, 0x92FD, 0xB9CF,
+	0xB9D0, 0x92FE, 0xB9D1, 0x9341, 0x9342, 0x9343, 0x9344, 0x9345, 0xB9D2, 0xB9D3, 0x9346, 0xB9D4, 0xB9D5, 0xB9D6, 0x9347, 0xB9D7,
+	0x9348, 0xB9D8, 0x9349, 0x934A, 0xB9D9, 0xB9DA, 0xB9DB, 0xB9DC, 0xB9DD, 0x934B, 0x934C, 0xB9DE, 0xB9DF, 0xB9E0, 0xB9E1, 0xB9E2,
+	0x934D, 0x934E, 0x934F, 0x9350, 0xB9E3, 0xB9E4, 0x9351, 0xB9E5, 0x9352, 0xB9E6, 0x9353, 0x9354, 0x9355, 0xB9E7, 0x9356, 0x9357,
+	0xB9E8, 0xB9E9, 0x9358, 0x9359, 0xB9EA, 0x935A, 0x9361, 0x9362, 0xB9EB, 0x9363, 0x9364, 0x9365, 0x9366, 0x9367, 0x9368, 0x9369,
+	0xB9EC, 0xB9ED, 0x936A, 0xB9EE, 0xB9EF, 0xB9F0, 0x936B, 0x936C, 0x936D, 0xB9F1, 0x936E, 0x936F, 0xB9F2, 0xB9F3, 0x9370, 0x9371,
+	0xB9F4, 0x9372, 0x9373, 0x9374, 0x9375, 0x9376, 0x9377, 0x9378, 0x9379, 0x937A, 0x9381, 0x9382, 0x9383, 0xB9F5, 0x9384, 0x9385,
+	0x9386, 0x9387, 0x9388, 0x9389, 0x938A, 0x938B, 0x938C, 0x938D, 0x938E, 0x938F, 0x9390, 0x9391, 0x9392, 0x9393, 0x9394, 0x9395,
+	0x9396, 0x9397, 0x9398, 0x9399, 0x939A, 0x939B, 0x939C, 0x939D, 0x939E, 0x939F, 0x93A0, 0x93A1, 0x93A2, 0x93A3, 0x93A4, 0x93A5,
+	0x93A6, 0x93A7, 0x93A8, 0x93A9, 0xB9F6, 0xB9F7, 0x93AA, 0x93AB, 0xB9F8, 0x93AC, 0x93AD, 0xB9F9, 0xB9FA, 0x93AE, 0xB9FB, 0x93AF,
+	0x93B0, 0x93B1, 0x93B2, 0x93B3, 0xB9FC, 0xB9FD, 0x93B4, 0xB9FE, 0x93B5, 0xBAA1, 0xBAA2, 0x93B6, 0x93B7, 0x93B8, 0x93B9, 0x93BA,
+	0xBAA3, 0xBAA4, 0x93BB, 0x93BC, 0xBAA5, 0x93BD, 0x93BE, 0xBAA6, 0xBAA7, 0x93BF, 0x93C0, 0x93C1, 0x93C2, 0x93C3, 0x93C4, 0x93C5,
+	0xBAA8, 0xBAA9, 0x93C6, 0xBAAA, 0xBAAB, 0xBAAC, 0x93C7, 0x93C8, 0x93C9, 0x93CA, 0x93CB, 0x93CC, 0xBAAD, 0xBAAE, 0x93CD, 0x93CE,
+	0xBAAF, 0x93CF, 0x93D0, 0x93D1, 0xBAB0, 0x93D2, 0x93D3, 0x93D4, 0x93D5, 0x93D6, 0x93D7, 0x93D8, 0x93D9, 0xBAB1, 0x93DA, 0xBAB2,
+	0xBAB3, 0xBAB4, 0x93DB, 0x93DC, 0x93DD, 0xBAB5, 0x93DE, 0x93DF, 0xBAB6, 0x93E0, 0x93E1, 0x93E2, 0xBAB7, 0x93E3, 0x93E4, 0x93E5,
+	0x93E6, 0x93E7, 0x93E8, 0x93E9, 0x93EA, 0x93EB, 0x93EC, 0x93ED, 0x93EE, 0x93EF, 0x93F0, 0x93F1, 0x93F2, 0x93F3, 0x93F4, 0x93F5,
+	0x93F6, 0x93F7, 0x93F8, 0x93F9, 0xBAB8, 0xBAB9, 0xBABA, 0x93FA, 0xBABB, 0x93FB, 0x93FC, 0x93FD, 0xBABC, 0x93FE, 0x9441, 0x9442,
+	0x9443, 0x9444, 0x9445, 0x9446, 0xBABD, 0xBABE, 0x9447, 0xBABF, 0x9448, 0xBAC0, 0x9449, 0x944A, 0x944B, 0x944C, 0x944D, 0x944E,
+	0xBAC1, 0x944F, 0x9450, 0x9451, 0xBAC2, 0x9452, 0x9453, 0x9454, 0x9455, 0x9456, 0x9457, 0x9458, 0x9459, 0x945A, 0x9461, 0x9462,
+	0x9463, 0x9464, 0x9465, 0x9466, 0xBAC3, 0x9467, 0x9468, 0x9469, 0x946A, 0x946B, 0x946C, 0x946D, 0xBAC4, 0x946E, 0x946F, 0x9470,
+	0x9471, 0x9472, 0x9473, 0x9474, 0x9475, 0x9476, 0x9477, 0x9478, 0x9479, 0x947A, 0x9481, 0x9482, 0x9483, 0x9484, 0x9485, 0x9486,
+	0xBAC5, 0x9487, 0x9488, 0x9489, 0x948A, 0x948B, 0x948C, 0x948D, 0xBAC6, 0xBAC7, 0x948E, 0x948F, 0xBAC8, 0x9490, 0x9491, 0x9492,
+	0xBAC9, 0x9493, 0x9494, 0x9495, 0x9496, 0x9497, 0x9498, 0x9499, 0xBACA, 0xBACB, 0x949A, 0x949B, 0x949C, 0x949D, 0x949E, 0x949F,
+	0x94A0, 0x94A1, 0x94A2, 0x94A3, 0xBACC, 0x94A4, 0x94A5, 0x94A6, 0xBACD, 0x94A7, 0x94A8, 0x94A9, 0x94AA, 0x94AB, 0x94AC, 0x94AD,
+	0x94AE, 0x94AF, 0x94B0, 0x94B1, 0x94B2, 0x94B3, 0x94B4, 0x94B5, 0x94B6, 0x94B7, 0x94B8, 0x94B9, 0x94BA, 0x94BB, 0x94BC, 0x94BD,
+	0xBACE, 0xBACF, 0x94BE, 0x94BF, 0xBAD0, 0x94C0, 0x94C1, 0xBAD1, 0xBAD2, 0xBAD3, 0xBAD4, 0x94C2, 0x94C3, 0x94C4, 0x94C5, 0x94C6,
+	0xBAD5, 0xBAD6, 0x94C7, 0xBAD7, 0x94C8, 0xBAD8, 0x94C9, 0x94CA, 0x94CB, 0xBAD9, 0xBADA, 0x94CC, 0xBADB, 0x94CD, 0x94CE, 0x94CF,
+	0x94D0, 0x94D1, 0x94D2, 0x94D3, 0xBADC, 0x94D4, 0x94D5, 0x94D6, 0x94D7, 0x94D8, 0x94D9, 0x94DA, 0x94DB, 0x94DC, 0x94DD, 0x94DE,
+	0xBADD, 0x94DF, 0x94E0, 0x94E1, 0x94E2, 0x94E3, 0x94E4, 0x94E5, 0xBADE, 0x94E6, 0x94E7, 0x94E8, 0x94E9, 0x94EA, 0x94EB, 0x94EC,
+	0x94ED, 0x94EE, 0x94EF, 0x94F0, 0x94F1, 0x94F2, 0x94F3, 0x94F4, 0x94F5, 0x94F6, 0x94F7, 0x94F8, 0x94F9, 0x94FA, 0x94FB, 0x94FC,
+	0x94FD, 0x94FE, 0x9541, 0x9542, 0xBADF, 0xBAE0, 0x9543, 0x9544, 0xBAE1, 0x9545, 0x9546, 0x9547, 0xBAE2, 0x9548, 0x9549, 0x954A,
+	0x954B, 0x954C, 0x954D, 0x954E, 0x954F, 0x9550, 0x9551, 0x9552, 0x9553, 0xBAE3, 0x9554, 0x9555, 0x9556, 0x9557, 0x9558, 0x9559,
+	0xBAE4, 0x955A, 0x9561, 0x9562, 0xBAE5, 0x9563, 0x9564, 0x9565, 0xBAE6, 0x9566, 0x9567, 0x9568, 0x9569, 0x956A, 0x956B, 0x956C,
+	0xBAE7, 0x956D, 0x956E, 0xBAE8, 0x956F, 0xBAE9, 0x9570, 0x9571, 0x9572, 0x9573, 0x9574, 0x9575, 0xBAEA, 0xBAEB, 0x9576, 0x9577,
+	0xBAEC, 0x9578, 0x9579, 0x957A, 0xBAED, 0x9581, 0x9582, 0x9583, 0x9584, 0x9585, 0x9586, 0x9587, 0xBAEE, 0xBAEF, 0x9588, 0xBAF0,
+	0x9589, 0x958A, 0x958B, 0x958C, 0x958D, 0x958E, 0x958F, 0x9590, 0x9591, 0x9592, 0x9593, 0x9594, 0x9595, 0x9596, 0x9597, 0x9598,
+	0x9599, 0x959A, 0x959B, 0x959C, 0x959D, 0x959E, 0x959F, 0x95A0, 0x95A1, 0x95A2, 0x95A3, 0x95A4, 0x95A5, 0x95A6, 0x95A7, 0x95A8,
+	0x95A9, 0x95AA, 0x95AB, 0x95AC, 0xBAF1, 0xBAF2, 0x95AD, 0x95AE, 0xBAF3, 0x95AF, 0x95B0, 0x95B1, 0xBAF4, 0x95B2, 0xBAF5, 0x95B3,
+	0x95B4, 0x95B5, 0x95B6, 0x95B7, 0xBAF6, 0xBAF7, 0x95B8, 0xBAF8, 0x95B9, 0xBAF9, 0xBAFA, 0xBAFB, 0x95BA, 0x95BB, 0x95BC, 0x95BD,
+	0xBAFC, 0xBAFD, 0x95BE, 0x95BF, 0xBAFE, 0x95C0, 0x95C1, 0x95C2, 0xBBA1, 0x95C3, 0xBBA2, 0x95C4, 0x95C5, 0x95C6, 0x95C7, 0x95C8,
+	0xBBA3, 0xBBA4, 0x95C9, 0xBBA5, 0xBBA6, 0xBBA7, 0x95CA, 0x95CB, 0x95CC, 0x95CD, 0x95CE, 0xBBA8, 0xBBA9, 0xBBAA, 0x95CF, 0x95D0,
+	0xBBAB, 0x95D1, 0x95D2, 0x95D3, 0xBBAC, 0x95D4, 0x95D5, 0x95D6, 0x95D7, 0x95D8, 0x95D9, 0x95DA, 0xBBAD, 0xBBAE, 0x95DB, 0xBBAF,
+	0xBBB0, 0xBBB1, 0x95DC, 0x95DD, 0x95DE, 0x95DF, 0x95E0, 0x95E1, 0xBBB2, 0xBBB3, 0x95E2, 0x95E3, 0x95E4, 0x95E5, 0x95E6, 0x95E7,
+	0x95E8, 0x95E9, 0x95EA, 0x95EB, 0x95EC, 0x95ED, 0x95EE, 0x95EF, 0xBBB4, 0x95F0, 0x95F1, 0x95F2, 0x95F3, 0x95F4, 0x95F5, 0x95F6,
+	0x95F7, 0x95F8, 0x95F9, 0x95FA, 0x95FB, 0x95FC, 0x95FD, 0x95FE, 0x9641, 0x9642, 0x9643, 0x9644, 0x9645, 0x9646, 0x9647, 0x9648,
+	0x9649, 0x964A, 0x964B, 0x964C, 0x964D, 0x964E, 0x964F, 0x9650, 0x9651, 0x9652, 0x9653, 0x9654, 0x9655, 0x9656, 0x9657, 0x9658,
+	0xBBB5, 0xBBB6, 0x9659, 0x965A, 0xBBB7, 0x9661, 0x9662, 0xBBB8, 0xBBB9, 0x9663, 0x9664, 0x9665, 0x9666, 0x9667, 0x9668, 0x9669,
+	0xBBBA, 0x966A, 0x966B, 0xBBBB, 0xBBBC, 0xBBBD, 0x966C, 0x966D, 0x966E, 0x966F, 0x9670, 0x9671, 0xBBBE, 0x9672, 0x9673, 0x9674,
+	0x9675, 0x9676, 0x9677, 0x9678, 0x9679, 0x967A, 0x9681, 0x9682, 0x9683, 0x9684, 0x9685, 0x9686, 0x9687, 0x9688, 0x9689, 0x968A,
+	0x968B, 0xBBBF, 0x968C, 0x968D, 0x968E, 0x968F, 0x9690, 0x9691, 0xBBC0, 0xBBC1, 0x9692, 0x9693, 0x9694, 0x9695, 0x9696, 0x9697,
+	0x9698, 0x9699, 0x969A, 0x969B, 0x969C, 0x969D, 0x969E, 0x969F, 0xBBC2, 0xBBC3, 0x96A0, 0xBBC4, 0xBBC5, 0xBBC6, 0x96A1, 0x96A2,
+	0x96A3, 0x96A4, 0x96A5, 0x96A6, 0x96A7, 0x96A8, 0x96A9, 0x96AA, 0x96AB, 0x96AC, 0x96AD, 0x96AE, 0x96AF, 0x96B0, 0x96B1, 0x96B2,
+	0x96B3, 0x96B4, 0x96B5, 0x96B6, 0x96B7, 0x96B8, 0x96B9, 0x96BA, 0x96BB, 0x96BC, 0x96BD, 0x96BE, 0x96BF, 0x96C0, 0x96C1, 0x96C2,
+	0xBBC7, 0xBBC8, 0x96C3, 0x96C4, 0xBBC9, 0x96C5, 0x96C6, 0x96C7, 0xBBCA, 0x96C8, 0x96C9, 0x96CA, 0x96CB, 0x96CC, 0x96CD, 0x96CE,
+	0xBBCB, 0xBBCC, 0x96CF, 0x96D0, 0x96D1, 0xBBCD, 0x96D2, 0x96D3, 0x96D4, 0x96D5, 0x96D6, 0x96D7, 0x96D8, 0x96D9, 0x96DA, 0x96DB,
+	0x96DC, 0x96DD, 0x96DE, 0x96DF, 0x96E0, 0x96E1, 0x96E2, 0x96E3, 0x96E4, 0x96E5, 0x96E6, 0x96E7, 0x96E8, 0x96E9, 0x96EA, 0x96EB,
+	0x96EC, 0x96ED, 0x96EE, 0x96EF, 0x96F0, 0x96F1, 0x96F2, 0x96F3, 0x96F4, 0x96F5, 0x96F6, 0x96F7, 0x96F8, 0x96F9, 0x96FA, 0x96FB,
+	0x96FC, 0x96FD, 0x96FE, 0x9741, 0x9742, 0x9743, 0x9744, 0x9745, 0x9746, 0x9747, 0x9748, 0x9749, 0x974A, 0x974B, 0x974C, 0x974D,
+	0x974E, 0x974F, 0x9750, 0x9751, 0xBBCE, 0x9752, 0x9753, 0x9754, 0x9755, 0x9756, 0x9757, 0x9758, 0x9759, 0x975A, 0x9761, 0x9762,
+	0x9763, 0x9764, 0x9765, 0x9766, 0x9767, 0x9768, 0x9769, 0x976A, 0x976B, 0x976C, 0x976D, 0x976E, 0x976F, 0x9770, 0x9771, 0x9772,
+	0xBBCF, 0x9773, 0x9774, 0x9775, 0x9776, 0x9777, 0x9778, 0x9779, 0x977A, 0x9781, 0x9782, 0x9783, 0x9784, 0x9785, 0x9786, 0x9787,
+	0x9788, 0x9789, 0x978A, 0x978B, 0x978C, 0xBBD0, 0x978D, 0x978E, 0x978F, 0x9790, 0x9791, 0x9792, 0xBBD1, 0xBBD2, 0x9793, 0x9794,
+	0xBBD3, 0x9795, 0x9796, 0x9797, 0xBBD4, 0x9798, 0x9799, 0x979A, 0x979B, 0x979C, 0x979D, 0x979E, 0xBBD5, 0x979F, 0x97A0, 0xBBD6,
+	0x97A1, 0xBBD7, 0x97A2, 0x97A3, 0x97A4, 0x97A5, 0x97A6, 0x97A7, 0x97A8, 0x97A9, 0x97AA, 0x97AB, 0x97AC, 0x97AD, 0x97AE, 0x97AF,
+	0x97B0, 0x97B1, 0x97B2, 0x97B3, 0x97B4, 0x97B5, 0x97B6, 0x97B7, 0x97B8, 0x97B9, 0x97BA, 0x97BB, 0x97BC, 0x97BD, 0x97BE, 0x97BF,
+	0x97C0, 0x97C1, 0x97C2, 0x97C3, 0x97C4, 0x97C5, 0x97C6, 0x97C7, 0x97C8, 0x97C9, 0x97CA, 0x97CB, 0x97CC, 0x97CD, 0x97CE, 0x97CF,
+	0x97D0, 0x97D1, 0x97D2, 0x97D3, 0x97D4, 0x97D5, 0x97D6, 0x97D7, 0x97D8, 0x97D9, 0x97DA, 0x97DB, 0x97DC, 0x97DD, 0x97DE, 0x97DF,
+	0x97E0, 0x97E1, 0x97E2, 0x97E3, 0x97E4, 0x97E5, 0x97E6, 0x97E7, 0x97E8, 0x97E9, 0x97EA, 0x97EB, 0x97EC, 0x97ED, 0x97EE, 0x97EF,
+	0x97F0, 0x97F1, 0x97F2, 0x97F3, 0x97F4, 0x97F5, 0x97F6, 0x97F7, 0x97F8, 0x97F9, 0x97FA, 0x97FB, 0xBBD8, 0x97FC, 0x97FD, 0x97FE,
+	0x9841, 0x9842, 0x9843, 0x9844, 0x9845, 0x9846, 0x9847, 0x9848, 0x9849, 0x984A, 0x984B, 0x984C, 0x984D, 0x984E, 0x984F, 0x9850,
+	0x9851, 0xBBD9, 0x9852, 0x9853, 0x9854, 0x9855, 0x9856, 0x9857, 0xBBDA, 0x9858, 0x9859, 0x985A, 0xBBDB, 0x9861, 0x9862, 0x9863,
+	0xBBDC, 0x9864, 0x9865, 0x9866, 0x9867, 0x9868, 0x9869, 0x986A, 0xBBDD, 0xBBDE, 0x986B, 0x986C, 0x986D, 0x986E, 0x986F, 0x9870,
+	0x9871, 0x9872, 0x9873, 0x9874, 0x9875, 0x9876, 0x9877, 0x9878, 0x9879, 0x987A, 0x9881, 0x9882, 0x9883, 0x9884, 0x9885, 0x9886,
+	0x9887, 0x9888, 0x9889, 0x988A, 0x988B, 0x988C, 0x988D, 0x988E, 0x988F, 0x9890, 0x9891, 0x9892, 0x9893, 0x9894, 0x9895, 0x9896,
+	0xBBDF, 0xBBE0, 0x9897, 0x9898, 0xBBE1, 0x9899, 0x989A, 0x989B, 0xBBE2, 0x989C, 0x989D, 0x989E, 0x989F, 0x98A0, 0x98A1, 0x98A2,
+	0xBBE3, 0xBBE4, 0x98A3, 0xBBE5, 0x98A4, 0xBBE6, 0x98A5, 0x98A6, 0x98A7, 0x98A8, 0x98A9, 0x98AA, 0xBBE7, 0xBBE8, 0x98AB, 0xBBE9,
+	0xBBEA, 0x98AC, 0x98AD, 0xBBEB, 0xBBEC, 0xBBED, 0xBBEE, 0x98AE, 0x98AF, 0x98B0, 0x98B1, 0x98B2, 0xBBEF, 0xBBF0, 0x98B3, 0xBBF1,
+	0xBBF2, 0xBBF3, 0x98B4, 0x98B5, 0x98B6, 0xBBF4, 0x98B7, 0x98B8, 0xBBF5, 0xBBF6, 0x98B9, 0x98BA, 0xBBF7, 0x98BB, 0x98BC, 0x98BD,
+	0xBBF8, 0x98BE, 0x98BF, 0x98C0, 0x98C1, 0x98C2, 0x98C3, 0x98C4, 0xBBF9, 0xBBFA, 0x98C5, 0xBBFB, 0xBBFC, 0xBBFD, 0x98C6, 0x98C7,
+	0x98C8, 0x98C9, 0x98CA, 0x98CB, 0xBBFE, 0xBCA1, 0x98CC, 0x98CD, 0xBCA2, 0x98CE, 0x98CF, 0x98D0, 0xBCA3, 0x98D1, 0x98D2, 0x98D3,
+	0x98D4, 0x98D5, 0x98D6, 0x98D7, 0xBCA4, 0xBCA5, 0x98D8, 0xBCA6, 0x98D9, 0xBCA7, 0x98DA, 0x98DB, 0x98DC, 0x98DD, 0x98DE, 0x98DF,
+	0xBCA8, 0x98E0, 0x98E1, 0x98E2, 0xBCA9, 0x98E3, 0x98E4, 0x98E5, 0xBCAA, 0x98E6, 0x98E7, 0x98E8, 0x98E9, 0x98EA, 0x98EB, 0x98EC,
+	0xBCAB, 0x98ED, 0x98EE, 0x98EF, 0x98F0, 0xBCAC, 0x98F1, 0x98F2, 0x98F3, 0x98F4, 0x98F5, 0x98F6, 0xBCAD, 0xBCAE, 0xBCAF, 0xBCB0,
+	0xBCB1, 0x98F7, 0x98F8, 0xBCB2, 0xBCB3, 0x98F9, 0xBCB4, 0xBCB5, 0x98FA, 0x98FB, 0x98FC, 0x98FD, 0xBCB6, 0xBCB7, 0x98FE, 0xBCB8,
+	0xBCB9, 0xBCBA, 0x9941, 0x9942, 0x9943, 0x9944, 0xBCBB, 0x9945, 0xBCBC, 0xBCBD, 0x9946, 0x9947, 0xBCBE, 0x9948, 0x9949, 0x994A,
+	0xBCBF, 0x994B, 0x994C, 0x994D, 0x994E, 0x994F, 0x9950, 0x9951, 0xBCC0, 0xBCC1, 0x9952, 0xBCC2, 0xBCC3, 0xBCC4, 0x9953, 0x9954,
+	0x9955, 0x9956, 0x9957, 0x9958, 0xBCC5, 0xBCC6, 0x9959, 0x995A, 0xBCC7, 0x9961, 0x9962, 0x9963, 0xBCC8, 0x9964, 0x9965, 0x9966,
+	0x9967, 0x9968, 0x9969, 0x996A, 0xBCC9, 0xBCCA, 0x996B, 0xBCCB, 0xBCCC, 0xBCCD, 0x996C, 0x996D, 0x996E, 0x996F, 0x9970, 0x9971,
+	0xBCCE, 0x9972, 0x9973, 0x9974, 0xBCCF, 0x9975, 0x9976, 0x9977, 0xBCD0, 0x9978, 0x9979, 0x997A, 0x9981, 0x9982, 0x9983, 0x9984,
+	0x9985, 0x9986, 0x9987, 0x9988, 0x9989, 0xBCD1, 0x998A, 0x998B, 0x998C, 0x998D, 0x998E, 0x998F, 0xBCD2, 0xBCD3, 0xBCD4, 0x9990,
+	0xBCD5, 0x9991, 0x9992, 0x9993, 0xBCD6, 0x9994, 0xBCD7, 0x9995, 0x9996, 0x9997, 0x9998, 0x9999, 0xBCD8, 0xBCD9, 0x999A, 0xBCDA,
+	0x999B, 0xBCDB, 0x999C, 0x999D, 0x999E, 0xBCDC, 0x999F, 0x99A0, 0xBCDD, 0xBCDE, 0x99A1, 0x99A2, 0xBCDF, 0x99A3, 0x99A4, 0x99A5,
+	0xBCE0, 0x99A6, 0x99A7, 0x99A8, 0x99A9, 0x99AA, 0x99AB, 0x99AC, 0x99AD, 0x99AE, 0x99AF, 0x99B0, 0x99B1, 0xBCE1, 0x99B2, 0x99B3,
+	0x99B4, 0x99B5, 0x99B6, 0x99B7, 0xBCE2, 0x99B8, 0x99B9, 0x99BA, 0xBCE3, 0x99BB, 0x99BC, 0x99BD, 0xBCE4, 0x99BE, 0x99BF, 0x99C0,
+	0x99C1, 0x99C2, 0x99C3, 0x99C4, 0xBCE5, 0x99C5, 0x99C6, 0xBCE6, 0xBCE7, 0x99C7, 0x99C8, 0x99C9, 0x99CA, 0x99CB, 0x99CC, 0x99CD,
+	0xBCE8, 0x99CE, 0x99CF, 0x99D0, 0xBCE9, 0x99D1, 0x99D2, 0x99D3, 0xBCEA, 0x99D4, 0x99D5, 0x99D6, 0x99D7, 0x99D8, 0x99D9, 0x99DA,
+	0xBCEB, 0xBCEC, 0x99DB, 0xBCED, 0x99DC, 0x99DD, 0x99DE, 0x99DF, 0x99E0, 0x99E1, 0x99E2, 0x99E3, 0xBCEE, 0xBCEF, 0x99E4, 0x99E5,
+	0xBCF0, 0x99E6, 0x99E7, 0x99E8, 0xBCF1, 0x99E9, 0x99EA, 0x99EB, 0x99EC, 0x99ED, 0x99EE, 0x99EF, 0xBCF2, 0xBCF3, 0x99F0, 0xBCF4,
+	0x99F1, 0xBCF5, 0x99F2, 0x99F3, 0x99F4, 0x99F5, 0x99F6, 0x99F7, 0xBCF6, 0xBCF7, 0x99F8, 0x99F9, 0xBCF8, 0x99FA, 0x99FB, 0xBCF9,
+	0xBCFA, 0x99FC, 0x99FD, 0x99FE, 0x9A41, 0x9A42, 0x9A43, 0x9A44, 0xBCFB, 0xBCFC, 0x9A45, 0xBCFD, 0x9A46, 0xBCFE, 0x9A47, 0xBDA1,
+	0x9A48, 0xBDA2, 0xBDA3, 0x9A49, 0xBDA4, 0x9A4A, 0x9A4B, 0x9A4C, 0x9A4D, 0x9A4E, 0x9A4F, 0x9A50, 0x9A51, 0x9A52, 0x9A53, 0x9A54,
+	0x9A55, 0x9A56, 0x9A57, 0x9A58, 0x9A59, 0x9A5A, 0x9A61, 0x9A62, 0xBDA5, 0x9A63, 0x9A64, 0x9A65, 0x9A66, 0x9A67, 0x9A68, 0x9A69,
+	0xBDA6, 0xBDA7, 0x9A6A, 0x9A6B, 0xBDA8, 0x9A6C, 0x9A6D, 0x9A6E, 0xBDA9, 0x9A6F, 0x9A70, 0x9A71, 0x9A72, 0x9A73, 0x9A74, 0x9A75,
+	0xBDAA, 0x9A76, 0x9A77, 0x9A78, 0x9A79, 0xBDAB, 0x9A7A, 0x9A81, 0x9A82, 0x9A83, 0x9A84, 0x9A85, 0xBDAC, 0xBDAD, 0x9A86, 0x9A87,
+	0xBDAE, 0x9A88, 0x9A89, 0x9A8A, 0xBDAF, 0x9A8B, 0x9A8C, 0x9A8D, 0x9A8E, 0x9A8F, 0x9A90, 0x9A91, 0xBDB0, 0xBDB1, 0x9A92, 0xBDB2,
+	0x9A93, 0xBDB3, 0x9A94, 0x9A95, 0x9A96, 0x9A97, 0x9A98, 0x9A99, 0xBDB4, 0xBDB5, 0x9A9A, 0x9A9B, 0x9A9C, 0x9A9D, 0x9A9E, 0x9A9F,
+	0xBDB6, 0x9AA0, 0x9AA1, 0x9AA2, 0x9AA3, 0x9AA4, 0x9AA5, 0x9AA6, 0xBDB7, 0x9AA7, 0x9AA8, 0xBDB8, 0x9AA9, 0xBDB9, 0x9AAA, 0x9AAB,
+	0x9AAC, 0x9AAD, 0x9AAE, 0x9AAF, 0xBDBA, 0xBDBB, 0x9AB0, 0x9AB1, 0xBDBC, 0x9AB2, 0x9AB3, 0x9AB4, 0xBDBD, 0xBDBE, 0x9AB5, 0x9AB6,
+	0x9AB7, 0x9AB8, 0x9AB9, 0x9ABA, 0xBDBF, 0xBDC0, 0x9ABB, 0xBDC1, 0x9ABC, 0xBDC2, 0x9ABD, 0x9ABE, 0x9ABF, 0x9AC0, 0x9AC1, 0x9AC2,
+	0x9AC3, 0x9AC4, 0x9AC5, 0x9AC6, 0x9AC7, 0x9AC8, 0x9AC9, 0x9ACA, 0x9ACB, 0x9ACC, 0x9ACD, 0x9ACE, 0x9ACF, 0x9AD0, 0x9AD1, 0x9AD2,
+	0x9AD3, 0x9AD4, 0x9AD5, 0x9AD6, 0x9AD7, 0x9AD8, 0x9AD9, 0x9ADA, 0x9ADB, 0x9ADC, 0x9ADD, 0x9ADE, 0xBDC3, 0xBDC4, 0x9ADF, 0x9AE0,
+	0xBDC5, 0x9AE1, 0x9AE2, 0xBDC6, 0xBDC7, 0x9AE3, 0x9AE4, 0x9AE5, 0x9AE6, 0x9AE7, 0x9AE8, 0xBDC8, 0xBDC9, 0xBDCA, 0x9AE9, 0xBDCB,
+	0x9AEA, 0xBDCC, 0x9AEB, 0x9AEC, 0x9AED, 0x9AEE, 0xBDCD, 0x9AEF, 0xBDCE, 0xBDCF, 0x9AF0, 0xBDD0, 0xBDD1, 0x9AF1, 0x9AF2, 0x9AF3,
+	0xBDD2, 0x9AF4, 0x9AF5, 0x9AF6, 0x9AF7, 0x9AF8, 0x9AF9, 0x9AFA, 0xBDD3, 0xBDD4, 0x9AFB, 0x9AFC, 0xBDD5, 0xBDD6, 0x9AFD, 0x9AFE,
+	0x9B41, 0x9B42, 0x9B43, 0xBDD7, 0xBDD8, 0xBDD9, 0x9B44, 0x9B45, 0xBDDA, 0x9B46, 0x9B47, 0x9B48, 0xBDDB, 0x9B49, 0x9B4A, 0x9B4B,
+	0x9B4C, 0x9B4D, 0x9B4E, 0x9B4F, 0xBDDC, 0xBDDD, 0x9B50, 0x9B51, 0xBDDE, 0xBDDF, 0x9B52, 0x9B53, 0x9B54, 0x9B55, 0x9B56, 0x9B57,
+	0x9B58, 0x9B59, 0x9B5A, 0x9B61, 0x9B62, 0x9B63, 0x9B64, 0x9B65, 0x9B66, 0x9B67, 0x9B68, 0x9B69, 0x9B6A, 0x9B6B, 0x9B6C, 0x9B6D,
+	0x9B6E, 0x9B6F, 0x9B70, 0x9B71, 0x9B72, 0xBDE0, 0x9B73, 0x9B74, 0x9B75, 0x9B76, 0x9B77, 0x9B78, 0x9B79, 0x9B7A, 0x9B81, 0x9B82,
+	0x9B83, 0x9B84, 0x9B85, 0x9B86, 0x9B87, 0x9B88, 0x9B89, 0x9B8A, 0x9B8B, 0x9B8C, 0x9B8D, 0x9B8E, 0x9B8F, 0x9B90, 0x9B91, 0x9B92,
+	0x9B93, 0x9B94, 0x9B95, 0x9B96, 0x9B97, 0x9B98, 0x9B99, 0x9B9A, 0xBDE1, 0xBDE2, 0x9B9B, 0x9B9C, 0xBDE3, 0x9B9D, 0x9B9E, 0x9B9F,
+	0xBDE4, 0x9BA0, 0xBDE5, 0x9BA1, 0x9BA2, 0x9BA3, 0x9BA4, 0x9BA5, 0xBDE6, 0xBDE7, 0x9BA6, 0x9BA7, 0xBDE8, 0xBDE9, 0x9BA8, 0x9BA9,
+	0x9BAA, 0x9BAB, 0x9BAC, 0x9BAD, 0xBDEA, 0x9BAE, 0x9BAF, 0x9BB0, 0xBDEB, 0x9BB1, 0x9BB2, 0x9BB3, 0xBDEC, 0x9BB4, 0x9BB5, 0x9BB6,
+	0x9BB7, 0x9BB8, 0x9BB9, 0x9BBA, 0x9BBB, 0x9BBC, 0x9BBD, 0x9BBE, 0x9BBF, 0x9BC0, 0x9BC1, 0x9BC2, 0x9BC3, 0x9BC4, 0x9BC5, 0x9BC6,
+	0x9BC7, 0x9BC8, 0x9BC9, 0x9BCA, 0x9BCB, 0x9BCC, 0x9BCD, 0x9BCE, 0x9BCF, 0x9BD0, 0x9BD1, 0x9BD2, 0x9BD3, 0x9BD4, 0x9BD5, 0x9BD6,
+	0x9BD7, 0x9BD8, 0x9BD9, 0x9BDA, 0x9BDB, 0x9BDC, 0x9BDD, 0x9BDE, 0x9BDF, 0x9BE0, 0x9BE1, 0x9BE2, 0x9BE3, 0x9BE4, 0x9BE5, 0x9BE6,
+	0xBDED, 0x9BE7, 0x9BE8, 0x9BE9, 0x9BEA, 0x9BEB, 0x9BEC, 0x9BED, 0x9BEE, 0x9BEF, 0x9BF0, 0x9BF1, 0x9BF2, 0x9BF3, 0x9BF4, 0x9BF5,
+	0x9BF6, 0x9BF7, 0x9BF8, 0x9BF9, 0x9BFA, 0x9BFB, 0x9BFC, 0x9BFD, 0xBDEE, 0xBDEF, 0x9BFE, 0x9C41, 0xBDF0, 0x9C42, 0x9C43, 0xBDF1,
+	0xBDF2, 0x9C44, 0xBDF3, 0x9C45, 0x9C46, 0x9C47, 0x9C48, 0x9C49, 0xBDF4, 0xBDF5, 0x9C4A, 0x9C4B, 0x9C4C, 0xBDF6, 0x9C4D, 0x9C4E,
+	0x9C4F, 0x9C50, 0x9C51, 0x9C52, 0xBDF7, 0xBDF8, 0x9C53, 0x9C54, 0xBDF9, 0x9C55, 0x9C56, 0x9C57, 0x9C58, 0x9C59, 0x9C5A, 0x9C61,
+	0x9C62, 0x9C63, 0x9C64, 0x9C65, 0x9C66, 0x9C67, 0x9C68, 0x9C69, 0xBDFA, 0x9C6A, 0x9C6B, 0x9C6C, 0x9C6D, 0x9C6E, 0x9C6F, 0x9C70,
+	0xBDFB, 0x9C71, 0x9C72, 0x9C73, 0x9C74, 0x9C75, 0x9C76, 0x9C77, 0x9C78, 0x9C79, 0x9C7A, 0x9C81, 0x9C82, 0x9C83, 0x9C84, 0x9C85,
+	0x9C86, 0x9C87, 0x9C88, 0x9C89, 0xBDFC, 0x9C8A, 0x9C8B, 0x9C8C, 0x9C8D, 0x9C8E, 0x9C8F, 0x9C90, 0xBDFD, 0x9C91, 0x9C92, 0x9C93,
+	0xBDFE, 0x9C94, 0x9C95, 0x9C96, 0xBEA1, 0x9C97, 0x9C98, 0x9C99, 0x9C9A, 0x9C9B, 0x9C9C, 0x9C9D, 0xBEA2, 0xBEA3, 0x9C9E, 0x9C9F,
+	0x9CA0, 0x9CA1, 0x9CA2, 0x9CA3, 0x9CA4, 0x9CA5, 0x9CA6, 0x9CA7, 0xBEA4, 0x9CA8, 0x9CA9, 0x9CAA, 0x9CAB, 0x9CAC, 0x9CAD, 0x9CAE,
+	0x9CAF, 0x9CB0, 0x9CB1, 0x9CB2, 0x9CB3, 0x9CB4, 0x9CB5, 0x9CB6, 0x9CB7, 0x9CB8, 0x9CB9, 0x9CBA, 0x9CBB, 0x9CBC, 0x9CBD, 0x9CBE,
+	0x9CBF, 0x9CC0, 0x9CC1, 0x9CC2, 0xBEA5, 0xBEA6, 0x9CC3, 0x9CC4, 0xBEA7, 0x9CC5, 0x9CC6, 0x9CC7, 0xBEA8, 0x9CC8, 0x9CC9, 0x9CCA,
+	0x9CCB, 0x9CCC, 0x9CCD, 0x9CCE, 0xBEA9, 0xBEAA, 0x9CCF, 0x9CD0, 0x9CD1, 0xBEAB, 0x9CD2, 0x9CD3, 0x9CD4, 0x9CD5, 0x9CD6, 0x9CD7,
+	0xBEAC, 0x9CD8, 0x9CD9, 0x9CDA, 0x9CDB, 0x9CDC, 0x9CDD, 0x9CDE, 0x9CDF, 0x9CE0, 0x9CE1, 0x9CE2, 0x9CE3, 0x9CE4, 0x9CE5, 0x9CE6,
+	0x9CE7, 0x9CE8, 0x9CE9, 0x9CEA, 0xBEAD, 0x9CEB, 0x9CEC, 0x9CED, 0x9CEE, 0x9CEF, 0x9CF0, 0x9CF1, 0xBEAE, 0x9CF2, 0x9CF3, 0x9CF4,
+	0x9CF5, 0x9CF6, 0x9CF7, 0x9CF8, 0x9CF9, 0x9CFA, 0x9CFB, 0x9CFC, 0x9CFD, 0x9CFE, 0x9D41, 0x9D42, 0x9D43, 0x9D44, 0x9D45, 0x9D46,
+	0x9D47, 0x9D48, 0x9D49, 0x9D4A, 0x9D4B, 0x9D4C, 0x9D4D, 0x9D4E, 0xBEAF, 0x9D4F, 0x9D50, 0x9D51, 0xBEB0, 0x9D52, 0x9D53, 0x9D54,
+	0x9D55, 0x9D56, 0x9D57, 0x9D58, 0x9D59, 0x9D5A, 0x9D61, 0x9D62, 0x9D63, 0x9D64, 0x9D65, 0x9D66, 0x9D67, 0x9D68, 0x9D69, 0x9D6A,
+	0x9D6B, 0x9D6C, 0x9D6D, 0x9D6E, 0x9D6F, 0x9D70, 0x9D71, 0x9D72, 0x9D73, 0x9D74, 0x9D75, 0x9D76, 0x9D77, 0x9D78, 0x9D79, 0x9D7A,
+	0x9D81, 0x9D82, 0x9D83, 0x9D84, 0x9D85, 0x9D86, 0x9D87, 0x9D88, 0x9D89, 0xBEB1, 0x9D8A, 0x9D8B, 0x9D8C, 0x9D8D, 0x9D8E, 0x9D8F,
+	0xBEB2, 0xBEB3, 0x9D90, 0x9D91, 0xBEB4, 0x9D92, 0x9D93, 0x9D94, 0xBEB5, 0x9D95, 0xBEB6, 0x9D96, 0x9D97, 0x9D98, 0x9D99, 0xBEB7,
+	0xBEB8, 0xBEB9, 0x9D9A, 0x9D9B, 0x9D9C, 0x9D9D, 0x9D9E, 0x9D9F, 0x9DA0, 0x9DA1, 0x9DA2, 0x9DA3, 0xBEBA, 0x9DA4, 0x9DA5, 0x9DA6,
+	0xBEBB, 0x9DA7, 0x9DA8, 0x9DA9, 0xBEBC, 0x9DAA, 0x9DAB, 0x9DAC, 0x9DAD, 0x9DAE, 0x9DAF, 0x9DB0, 0xBEBD, 0x9DB1, 0x9DB2, 0x9DB3,
+	0x9DB4, 0x9DB5, 0x9DB6, 0x9DB7, 0x9DB8, 0x9DB9, 0x9DBA, 0x9DBB, 0xBEBE, 0xBEBF, 0x9DBC, 0x9DBD, 0xBEC0, 0x9DBE, 0x9DBF, 0x9DC0,
+	0xBEC1, 0x9DC1, 0x9DC2, 0x9DC3, 0x9DC4, 0x9DC5, 0x9DC6, 0x9DC7, 0xBEC2, 0xBEC3, 0x9DC8, 0xBEC4, 0x9DC9, 0xBEC5, 0x9DCA, 0x9DCB,
+	0x9DCC, 0x9DCD, 0x9DCE, 0x9DCF, 0xBEC6, 0xBEC7, 0x9DD0, 0x9DD1, 0xBEC8, 0xBEC9, 0xBECA, 0x9DD2, 0xBECB, 0xBECC, 0xBECD, 0x9DD3,
+	0x9DD4, 0x9DD5, 0x9DD6, 0xBECE, 0xBECF, 0xBED0, 0x9DD7, 0xBED1, 0xBED2, 0xBED3, 0x9DD8, 0x9DD9, 0x9DDA, 0xBED4, 0xBED5, 0x9DDB,
+	0xBED6, 0xBED7, 0x9DDC, 0x9DDD, 0xBED8, 0x9DDE, 0x9DDF, 0x9DE0, 0xBED9, 0x9DE1, 0x9DE2, 0x9DE3, 0x9DE4, 0x9DE5, 0x9DE6, 0x9DE7,
+	0xBEDA, 0xBEDB, 0x9DE8, 0xBEDC, 0xBEDD, 0xBEDE, 0x9DE9, 0x9DEA, 0x9DEB, 0x9DEC, 0x9DED, 0x9DEE, 0xBEDF, 0xBEE0, 0x9DEF, 0x9DF0,
+	0xBEE1, 0x9DF1, 0x9DF2, 0x9DF3, 0xBEE2, 0x9DF4, 0x9DF5, 0xBEE3, 0x9DF6, 0x9DF7, 0x9DF8, 0x9DF9, 0xBEE4, 0xBEE5, 0x9DFA, 0xBEE6,
+	0x9DFB, 0xBEE7, 0x9DFC, 0x9DFD, 0x9DFE, 0xBEE8, 0x9E41, 0xBEE9, 0xBEEA, 0x9E42, 0x9E43, 0x9E44, 0xBEEB, 0x9E45, 0x9E46, 0x9E47,
+	0xBEEC, 0x9E48, 0x9E49, 0x9E4A, 0x9E4B, 0x9E4C, 0x9E4D, 0x9E4E, 0x9E4F, 0xBEED, 0x9E50, 0x9E51, 0x9E52, 0x9E53, 0x9E54, 0x9E55,
+	0x9E56, 0x9E57, 0x9E58, 0x9E59, 0xBEEE, 0xBEEF, 0x9E5A, 0x9E61, 0xBEF0, 0xBEF1, 0x9E62, 0xBEF2, 0xBEF3, 0xBEF4, 0xBEF5, 0x9E63,
+	0x9E64, 0x9E65, 0x9E66, 0x9E67, 0xBEF6, 0xBEF7, 0xBEF8, 0xBEF9, 0xBEFA, 0xBEFB, 0xBEFC, 0x9E68, 0xBEFD, 0x9E69, 0xBEFE, 0x9E6A,
+	0xBFA1, 0xBFA2, 0x9E6B, 0x9E6C, 0xBFA3, 0x9E6D, 0x9E6E, 0x9E6F, 0xBFA4, 0x9E70, 0x9E71, 0x9E72, 0x9E73, 0x9E74, 0x9E75, 0x9E76,
+	0xBFA5, 0xBFA6, 0x9E77, 0xBFA7, 0x9E78, 0xBFA8, 0x9E79, 0x9E7A, 0x9E81, 0x9E82, 0x9E83, 0x9E84, 0xBFA9, 0xBFAA, 0xBFAB, 0x9E85,
+	0xBFAC, 0x9E86, 0x9E87, 0x9E88, 0xBFAD, 0x9E89, 0xBFAE, 0xBFAF, 0x9E8A, 0x9E8B, 0x9E8C, 0x9E8D, 0xBFB0, 0xBFB1, 0xBFB2, 0xBFB3,
+	0xBFB4, 0xBFB5, 0x9E8E, 0x9E8F, 0x9E90, 0xBFB6, 0xBFB7, 0xBFB8, 0xBFB9, 0x9E91, 0x9E92, 0x9E93, 0xBFBA, 0x9E94, 0x9E95, 0x9E96,
+	0xBFBB, 0x9E97, 0x9E98, 0x9E99, 0x9E9A, 0x9E9B, 0x9E9C, 0x9E9D, 0xBFBC, 0xBFBD, 0x9E9E, 0xBFBE, 0xBFBF, 0x9E9F, 0x9EA0, 0x9EA1,
+	0x9EA2, 0x9EA3, 0x9EA4, 0x9EA5, 0xBFC0, 0xBFC1, 0x9EA6, 0x9EA7, 0xBFC2, 0x9EA8, 0x9EA9, 0x9EAA, 0xBFC3, 0xBFC4, 0xBFC5, 0x9EAB,
+	0xBFC6, 0x9EAC, 0x9EAD, 0xBFC7, 0xBFC8, 0xBFC9, 0x9EAE, 0xBFCA, 0x9EAF, 0xBFCB, 0x9EB0, 0xBFCC, 0x9EB1, 0x9EB2, 0x9EB3, 0x9EB4,
+	0xBFCD, 0xBFCE, 0x9EB5, 0x9EB6, 0xBFCF, 0x9EB7, 0x9EB8, 0x9EB9, 0xBFD0, 0x9EBA, 0x9EBB, 0x9EBC, 0x9EBD, 0x9EBE, 0x9EBF, 0x9EC0,
+	0xBFD1, 0xBFD2, 0x9EC1, 0xBFD3, 0xBFD4, 0xBFD5, 0x9EC2, 0x9EC3, 0x9EC4, 0x9EC5, 0x9EC6, 0x9EC7, 0xBFD6, 0xBFD7, 0x9EC8, 0x9EC9,
+	0xBFD8, 0x9ECA, 0x9ECB, 0x9ECC, 0x9ECD, 0x9ECE, 0x9ECF, 0x9ED0, 0x9ED1, 0x9ED2, 0x9ED3, 0x9ED4, 0xBFD9, 0x9ED5, 0x9ED6, 0xBFDA,
+	0x9ED7, 0xBFDB, 0x9ED8, 0x9ED9, 0x9EDA, 0x9EDB, 0x9EDC, 0x9EDD, 0xBFDC, 0xBFDD, 0x9EDE, 0x9EDF, 0xBFDE, 0x9EE0, 0x9EE1, 0x9EE2,
+	0xBFDF, 0x9EE3, 0x9EE4, 0x9EE5, 0x9EE6, 0x9EE7, 0x9EE8, 0x9EE9, 0xBFE0, 0xBFE1, 0x9EEA, 0xBFE2, 0x9EEB, 0xBFE3, 0x9EEC, 0x9EED,
+	0x9EEE, 0x9EEF, 0x9EF0, 0x9EF1, 0xBFE4, 0xBFE5, 0x9EF2, 0x9EF3, 0xBFE6, 0x9EF4, 0x9EF5, 0x9EF6, 0xBFE7, 0x9EF7, 0x9EF8, 0x9EF9,
+	0x9EFA, 0x9EFB, 0x9EFC, 0x9EFD, 0xBFE8, 0xBFE9, 0x9EFE, 0xBFEA, 0x9F41, 0xBFEB, 0x9F42, 0x9F43, 0x9F44, 0x9F45, 0x9F46, 0x9F47,
+	0xBFEC, 0xBFED, 0x9F48, 0x9F49, 0xBFEE, 0x9F4A, 0x9F4B, 0x9F4C, 0xBFEF, 0xBFF0, 0xBFF1, 0x9F4D, 0x9F4E, 0x9F4F, 0x9F50, 0x9F51,
+	0xBFF2, 0xBFF3, 0x9F52, 0xBFF4, 0x9F53, 0xBFF5, 0x9F54, 0x9F55, 0x9F56, 0x9F57, 0x9F58, 0x9F59, 0xBFF6, 0xBFF7, 0x9F5A, 0x9F61,
+	0xBFF8, 0x9F62, 0x9F63, 0x9F64, 0xBFF9, 0x9F65, 0x9F66, 0x9F67, 0x9F68, 0x9F69, 0x9F6A, 0x9F6B, 0xBFFA, 0xBFFB, 0x9F6C, 0x9F6D,
+	0xBFFC, 0xBFFD, 0x9F6E, 0x9F6F, 0x9F70, 0x9F71, 0x9F72, 0x9F73, 0xBFFE, 0xC0A1, 0x9F74, 0x9F75, 0xC0A2, 0x9F76, 0x9F77, 0x9F78,
+	0xC0A3, 0x9F79, 0x9F7A, 0x9F81, 0x9F82, 0x9F83, 0x9F84, 0x9F85, 0xC0A4, 0xC0A5, 0x9F86, 0x9F87, 0x9F88, 0xC0A6, 0x9F89, 0x9F8A,
+	0x9F8B, 0x9F8C, 0x9F8D, 0x9F8E, 0xC0A7, 0xC0A8, 0x9F8F, 0x9F90, 0xC0A9, 0x9F91, 0x9F92, 0x9F93, 0xC0AA, 0x9F94, 0x9F95, 0x9F96,
+	0x9F97, 0x9F98, 0x9F99, 0x9F9A, 0xC0AB, 0xC0AC, 0x9F9B, 0xC0AD, 0x9F9C, 0xC0AE, 0x9F9D, 0x9F9E, 0x9F9F, 0x9FA0, 0x9FA1, 0x9FA2,
+	0xC0AF, 0xC0B0, 0x9FA3, 0x9FA4, 0xC0B1, 0x9FA5, 0x9FA6, 0x9FA7, 0xC0B2, 0x9FA8, 0x9FA9, 0x9FAA, 0x9FAB, 0x9FAC, 0x9FAD, 0x9FAE,
+	0xC0B3, 0xC0B4, 0x9FAF, 0xC0B5, 0x9FB0, 0xC0B6, 0x9FB1, 0xC0B7, 0x9FB2, 0x9FB3, 0x9FB4, 0x9FB5, 0xC0B8, 0xC0B9, 0x9FB6, 0x9FB7,
+	0xC0BA, 0x9FB8, 0x9FB9, 0x9FBA, 0xC0BB, 0x9FBB, 0x9FBC, 0x9FBD, 0x9FBE, 0x9FBF, 0xC0BC, 0x9FC0, 0xC0BD, 0xC0BE, 0x9FC1, 0xC0BF,
+	0x9FC2, 0xC0C0, 0xC0C1, 0xC0C2, 0xC0C3, 0xC0C4, 0xC0C5, 0xC0C6, 0xC0C7, 0x9FC3, 0x9FC4, 0x9FC5, 0xC0C8, 0x9FC6, 0x9FC7, 0x9FC8,
+	0xC0C9, 0x9FC9, 0x9FCA, 0x9FCB, 0x9FCC, 0x9FCD, 0x9FCE, 0x9FCF, 0xC0CA, 0x9FD0, 0x9FD1, 0xC0CB, 0x9FD2, 0x9FD3, 0x9FD4, 0x9FD5,
+	0x9FD6, 0x9FD7, 0x9FD8, 0x9FD9, 0xC0CC, 0xC0CD, 0x9FDA, 0x9FDB, 0xC0CE, 0x9FDC, 0x9FDD, 0x9FDE, 0xC0CF, 0xC0D0, 0xC0D1, 0x9FDF,
+	0x9FE0, 0x9FE1, 0x9FE2, 0xC0D2, 0xC0D3, 0xC0D4, 0x9FE3, 0xC0D5, 0xC0D6, 0xC0D7, 0xC0D8, 0x9FE4, 0x9FE5, 0x9FE6, 0xC0D9, 0x9FE7,
+	0xC0DA, 0xC0DB, 0x9FE8, 0x9FE9, 0xC0DC, 0x9FEA, 0xC0DD, 0xC0DE, 0xC0DF, 0x9FEB, 0xC0E0, 0x9FEC, 0x9FED, 0x9FEE, 0x9FEF, 0x9FF0,
+	0xC0E1, 0xC0E2, 0x9FF1, 0xC0E3, 0xC0E4, 0xC0E5, 0xC0E6, 0x9FF2, 0x9FF3, 0x9FF4, 0x9FF5, 0x9FF6, 0xC0E7, 0xC0E8, 0x9FF7, 0x9FF8,
+	0xC0E9, 0x9FF9, 0x9FFA, 0x9FFB, 0xC0EA, 0x9FFC, 0x9FFD, 0x9FFE, 0xA041, 0xA042, 0xA043, 0xA044, 0xC0EB, 0xC0EC, 0xA045, 0xC0ED,
+	0xC0EE, 0xC0EF, 0xA046, 0xA047, 0xA048, 0xA049, 0xA04A, 0xA04B, 0xC0F0, 0xC0F1, 0xA04C, 0xA04D, 0xC0F2, 0xA04E, 0xC0F3, 0xA04F,
+	0xC0F4, 0xA050, 0xA051, 0xA052, 0xA053, 0xA054, 0xA055, 0xA056, 0xC0F5, 0xA057, 0xA058, 0xA059, 0xA05A, 0xC0F6, 0xA061, 0xA062,
+	0xA063, 0xA064, 0xA065, 0xA066, 0xC0F7, 0xA067, 0xA068, 0xA069, 0xC0F8, 0xA06A, 0xA06B, 0xA06C, 0xC0F9, 0xA06D, 0xA06E, 0xA06F,
+	0xA070, 0xA071, 0xA072, 0xA073, 0xA074, 0xA075, 0xA076, 0xA077, 0xA078, 0xA079, 0xA07A, 0xA081, 0xA082, 0xA083, 0xA084, 0xA085,
+	0xC0FA, 0xC0FB, 0xA086, 0xA087, 0xC0FC, 0xA088, 0xA089, 0xA08A, 0xC0FD, 0xA08B, 0xC0FE, 0xA08C, 0xA08D, 0xA08E, 0xA08F, 0xA090,
+	0xC1A1, 0xC1A2, 0xA091, 0xC1A3, 0xA092, 0xC1A4, 0xC1A5, 0xA093, 0xA094, 0xA095, 0xA096, 0xA097, 0xC1A6, 0xC1A7, 0xA098, 0xA099,
+	0xC1A8, 0xA09A, 0xA09B, 0xA09C, 0xC1A9, 0xA09D, 0xA09E, 0xA09F, 0xA0A0, 0xA0A1, 0xA0A2, 0xA0A3, 0xC1AA, 0xC1AB, 0xA0A4, 0xC1AC,
+	0xA0A5, 0xC1AD, 0xA0A6, 0xA0A7, 0xA0A8, 0xA0A9, 0xA0AA, 0xA0AB, 0xC1AE, 0xA0AC, 0xA0AD, 0xA0AE, 0xC1AF, 0xA0AF, 0xA0B0, 0xA0B1,
+	0xC1B0, 0xA0B2, 0xA0B3, 0xA0B4, 0xA0B5, 0xA0B6, 0xA0B7, 0xA0B8, 0xC1B1, 0xC1B2, 0xA0B9, 0xA0BA, 0xC1B3, 0xC1B4, 0xA0BB, 0xA0BC,
+	0xA0BD, 0xA0BE, 0xA0BF, 0xA0C0, 0xC1B5, 0xA0C1, 0xA0C2, 0xA0C3, 0xA0C4, 0xA0C5, 0xA0C6, 0xA0C7, 0xA0C8, 0xA0C9, 0xA0CA, 0xA0CB,
+	0xA0CC, 0xA0CD, 0xA0CE, 0xA0CF, 0xA0D0, 0xA0D1, 0xA0D2, 0xA0D3, 0xA0D4, 0xA0D5, 0xA0D6, 0xA0D7, 0xA0D8, 0xA0D9, 0xA0DA, 0xA0DB,
+	0xC1B6, 0xC1B7, 0xA0DC, 0xA0DD, 0xC1B8, 0xA0DE, 0xA0DF, 0xA0E0, 0xC1B9, 0xA0E1, 0xC1BA, 0xA0E2, 0xA0E3, 0xA0E4, 0xA0E5, 0xA0E6,
+	0xC1BB, 0xC1BC, 0xA0E7, 0xC1BD, 0xA0E8, 0xC1BE, 0xC1BF, 0xC1C0, 0xA0E9, 0xA0EA, 0xA0EB, 0xC1C1, 0xC1C2, 0xC1C3, 0xA0EC, 0xA0ED,
+	0xA0EE, 0xA0EF, 0xA0F0, 0xA0F1, 0xC1C4, 0xA0F2, 0xA0F3, 0xA0F4, 0xA0F5, 0xA0F6, 0xA0F7, 0xA0F8, 0xA0F9, 0xC1C5, 0xA0FA, 0xC1C6,
+	0xA0FB, 0xC1C7, 0xA0FC, 0xA0FD, 0xA0FE, 0xA141, 0xA142, 0xA143, 0xC1C8, 0xA144, 0xA145, 0xA146, 0xA147, 0xA148, 0xA149, 0xA14A,
+	0xA14B, 0xA14C, 0xA14D, 0xA14E, 0xA14F, 0xA150, 0xA151, 0xA152, 0xA153, 0xA154, 0xA155, 0xA156, 0xC1C9, 0xC1CA, 0xA157, 0xA158,
+	0xA159, 0xA15A, 0xA161, 0xA162, 0xC1CB, 0xA163, 0xA164, 0xA165, 0xC1CC, 0xA166, 0xA167, 0xA168, 0xC1CD, 0xA169, 0xA16A, 0xA16B,
+	0xA16C, 0xA16D, 0xA16E, 0xA16F, 0xC1CE, 0xC1CF, 0xA170, 0xC1D0, 0xA171, 0xC1D1, 0xA172, 0xA173, 0xA174, 0xA175, 0xA176, 0xA177,
+	0xC1D2, 0xC1D3, 0xA178, 0xA179, 0xC1D4, 0xA17A, 0xA181, 0xA182, 0xA183, 0xA184, 0xA185, 0xA186, 0xA187, 0xA188, 0xA189, 0xA18A,
+	0xA18B, 0xA18C, 0xA18D, 0xA18E, 0xA18F, 0xC1D5, 0xA190, 0xA191, 0xA192, 0xA193, 0xA194, 0xA195, 0xC1D6, 0xC1D7, 0xA196, 0xA197,
+	0xC1D8, 0xA198, 0xA199, 0xA19A, 0xC1D9, 0xC1DA, 0xC1DB, 0xA19B, 0xA19C, 0xA19D, 0xA19E, 0xA19F, 0xC1DC, 0xC1DD, 0xA1A0, 0xC1DE,
+	0xA241, 0xC1DF, 0xA242, 0xA243, 0xA244, 0xA245, 0xA246, 0xA247, 0xC1E0, 0xA248, 0xA249, 0xA24A, 0xA24B, 0xA24C, 0xA24D, 0xA24E,
+	0xA24F, 0xA250, 0xA251, 0xA252, 0xA253, 0xA254, 0xA255, 0xA256, 0xA257, 0xA258, 0xA259, 0xA25A, 0xC1E1, 0xA261, 0xA262, 0xA263,
+	0xA264, 0xA265, 0xA266, 0xA267, 0xC1E2, 0xA268, 0xA269, 0xA26A, 0xA26B, 0xA26C, 0xA26D, 0xA26E, 0xA26F, 0xA270, 0xA271, 0xA272,
+	0xA273, 0xA274, 0xA275, 0xA276, 0xA277, 0xA278, 0xA279, 0xA27A, 0xA281, 0xA282, 0xA283, 0xA284, 0xA285, 0xA286, 0xA287, 0xA288,
+	0xC1E3, 0xC1E4, 0xA289, 0xA28A, 0xC1E5, 0xA28B, 0xA28C, 0xA28D, 0xC1E6, 0xA28E, 0xA28F, 0xA290, 0xA291, 0xA292, 0xA293, 0xA294,
+	0xC1E7, 0xC1E8, 0xA295, 0xC1E9, 0xA296, 0xA297, 0xA298, 0xA299, 0xA29A, 0xA29B, 0xA29C, 0xA29D, 0xC1EA, 0xA29E, 0xA29F, 0xA2A0,
+	0xC1EB, 0xA341, 0xA342, 0xA343, 0xC1EC, 0xA344, 0xA345, 0xA346, 0xA347, 0xA348, 0xA349, 0xA34A, 0xC1ED, 0xA34B, 0xA34C, 0xA34D,
+	0xA34E, 0xA34F, 0xA350, 0xA351, 0xA352, 0xA353, 0xA354, 0xA355, 0xC1EE, 0xC1EF, 0xA356, 0xA357, 0xC1F0, 0xA358, 0xA359, 0xA35A,
+	0xC1F1, 0xA361, 0xA362, 0xA363, 0xA364, 0xA365, 0xA366, 0xA367, 0xC1F2, 0xC1F3, 0xA368, 0xC1F4, 0xA369, 0xC1F5, 0xA36A, 0xA36B,
+	0xA36C, 0xA36D, 0xA36E, 0xA36F, 0xA370, 0xA371, 0xA372, 0xA373, 0xA374, 0xA375, 0xA376, 0xA377, 0xA378, 0xA379, 0xA37A, 0xA381,
+	0xA382, 0xA383, 0xA384, 0xA385, 0xA386, 0xA387, 0xA388, 0xA389, 0xA38A, 0xA38B, 0xA38C, 0xA38D, 0xA38E, 0xA38F, 0xA390, 0xA391,
+	0xC1F6, 0xC1F7, 0xA392, 0xA393, 0xC1F8, 0xA394, 0xA395, 0xC1F9, 0xC1FA, 0xA396, 0xC1FB, 0xA397, 0xA398, 0xA399, 0xA39A, 0xA39B,
+	0xC1FC, 0xC1FD, 0xA39C, 0xC1FE, 0xA39D, 0xC2A1, 0xC2A2, 0xA39E, 0xA39F, 0xC2A3, 0xC2A4, 0xA3A0, 0xC2A5, 0xC2A6, 0xA441, 0xA442,
+	0xC2A7, 0xA443, 0xC2A8, 0xA444, 0xC2A9, 0xA445, 0xA446, 0xC2AA, 0xA447, 0xA448, 0xA449, 0xA44A, 0xC2AB, 0xC2AC, 0xA44B, 0xC2AD,
+	0xC2AE, 0xC2AF, 0xA44C, 0xA44D, 0xA44E, 0xA44F, 0xA450, 0xA451, 0xC2B0, 0xC2B1, 0xA452, 0xA453, 0xC2B2, 0xA454, 0xA455, 0xA456,
+	0xC2B3, 0xA457, 0xA458, 0xA459, 0xA45A, 0xA461, 0xA462, 0xA463, 0xC2B4, 0xC2B5, 0xA464, 0xC2B6, 0xC2B7, 0xC2B8, 0xA465, 0xA466,
+	0xA467, 0xA468, 0xA469, 0xA46A, 0xC2B9, 0xA46B, 0xA46C, 0xA46D, 0xC2BA, 0xA46E, 0xA46F, 0xA470, 0xA471, 0xA472, 0xA473, 0xA474,
+	0xA475, 0xA476, 0xA477, 0xA478, 0xA479, 0xA47A, 0xA481, 0xA482, 0xA483, 0xC2BB, 0xA484, 0xA485, 0xA486, 0xA487, 0xA488, 0xA489,
+	0xA48A, 0xA48B, 0xA48C, 0xA48D, 0xA48E, 0xA48F, 0xA490, 0xA491, 0xA492, 0xA493, 0xA494, 0xA495, 0xA496, 0xA497, 0xA498, 0xA499,
+	0xA49A, 0xA49B, 0xA49C, 0xA49D, 0xA49E, 0xA49F, 0xA4A0, 0xA541, 0xA542, 0xA543, 0xA544, 0xA545, 0xC2BC, 0xC2BD, 0xA546, 0xA547,
+	0xC2BE, 0xA548, 0xA549, 0xA54A, 0xC2BF, 0xA54B, 0xA54C, 0xA54D, 0xA54E, 0xA54F, 0xA550, 0xA551, 0xC2C0, 0xC2C1, 0xA552, 0xC2C2,
+	0xC2C3, 0xC2C4, 0xA553, 0xA554, 0xA555, 0xA556, 0xA557, 0xA558, 0xC2C5, 0xA559, 0xA55A, 0xA561, 0xA562, 0xA563, 0xA564, 0xA565,
+	0xA566, 0xA567, 0xA568, 0xA569, 0xA56A, 0xA56B, 0xA56C, 0xA56D, 0xA56E, 0xA56F, 0xA570, 0xA571, 0xA572, 0xC2C6, 0xA573, 0xA574,
+	0xA575, 0xA576, 0xA577, 0xA578, 0xC2C7, 0xA579, 0xA57A, 0xA581, 0xA582, 0xA583, 0xA584, 0xA585, 0xA586, 0xA587, 0xA588, 0xA589,
+	0xA58A, 0xA58B, 0xA58C, 0xA58D, 0xA58E, 0xA58F, 0xA590, 0xA591, 0xC2C8, 0xA592, 0xA593, 0xA594, 0xA595, 0xA596, 0xA597, 0xA598,
+	0xA599, 0xA59A, 0xA59B, 0xA59C, 0xA59D, 0xA59E, 0xA59F, 0xA5A0, 0xA641, 0xA642, 0xA643, 0xA644, 0xA645, 0xA646, 0xA647, 0xA648,
+	0xA649, 0xA64A, 0xA64B, 0xA64C, 0xA64D, 0xA64E, 0xA64F, 0xA650, 0xA651, 0xA652, 0xA653, 0xA654, 0xC2C9, 0xC2CA, 0xA655, 0xA656,
+	0xC2CB, 0xA657, 0xA658, 0xA659, 0xC2CC, 0xA65A, 0xA661, 0xA662, 0xA663, 0xA664, 0xA665, 0xA666, 0xC2CD, 0xC2CE, 0xA667, 0xC2CF,
+	0xA668, 0xC2D0, 0xA669, 0xC2D1, 0xA66A, 0xA66B, 0xA66C, 0xA66D, 0xC2D2, 0xC2D3, 0xA66E, 0xA66F, 0xA670, 0xA671, 0xA672, 0xA673,
+	0xC2D4, 0xA674, 0xA675, 0xA676, 0xA677, 0xA678, 0xA679, 0xA67A, 0xA681, 0xA682, 0xA683, 0xA684, 0xC2D5, 0xA685, 0xA686, 0xA687,
+	0xA688, 0xA689, 0xA68A, 0xA68B, 0xC2D6, 0xA68C, 0xA68D, 0xA68E, 0xA68F, 0xA690, 0xA691, 0xA692, 0xA693, 0xA694, 0xA695, 0xA696,
+	0xA697, 0xA698, 0xA699, 0xA69A, 0xA69B, 0xA69C, 0xA69D, 0xA69E, 0xC2D7, 0xA69F, 0xA6A0, 0xA741, 0xA742, 0xA743, 0xA744, 0xA745,
+	0xC2D8, 0xA746, 0xA747, 0xA748, 0xC2D9, 0xA749, 0xA74A, 0xA74B, 0xC2DA, 0xA74C, 0xA74D, 0xA74E, 0xA74F, 0xA750, 0xA751, 0xA752,
+	0xC2DB, 0xC2DC, 0xA753, 0xA754, 0xA755, 0xA756, 0xA757, 0xA758, 0xA759, 0xA75A, 0xA761, 0xA762, 0xA763, 0xA764, 0xA765, 0xA766,
+	0xA767, 0xA768, 0xA769, 0xA76A, 0xA76B, 0xA76C, 0xA76D, 0xA76E, 0xA76F, 0xA770, 0xA771, 0xA772, 0xA773, 0xA774, 0xA775, 0xA776,
+	0xA777, 0xC2DD, 0xA778, 0xA779, 0xA77A, 0xA781, 0xA782, 0xA783, 0xC2DE, 0xC2DF, 0xA784, 0xA785, 0xC2E0, 0xA786, 0xA787, 0xA788,
+	0xC2E1, 0xA789, 0xA78A, 0xA78B, 0xA78C, 0xA78D, 0xA78E, 0xA78F, 0xC2E2, 0xC2E3, 0xA790, 0xA791, 0xA792, 0xC2E4, 0xA793, 0xA794,
+	0xA795, 0xA796, 0xA797, 0xA798, 0xC2E5, 0xA799, 0xA79A, 0xA79B, 0xA79C, 0xA79D, 0xA79E, 0xA79F, 0xA7A0, 0xA841, 0xA842, 0xA843,
+	0xA844, 0xA845, 0xA846, 0xA847, 0xA848, 0xA849, 0xA84A, 0xA84B, 0xC2E6, 0xC2E7, 0xA84C, 0xA84D, 0xA84E, 0xA84F, 0xA850, 0xA851,
+	0xA852, 0xA853, 0xA854, 0xA855, 0xA856, 0xA857, 0xA858, 0xA859, 0xA85A, 0xA861, 0xA862, 0xA863, 0xA864, 0xA865, 0xA866, 0xA867,
+	0xA868, 0xA869, 0xA86A, 0xA86B, 0xA86C, 0xA86D, 0xA86E, 0xA86F, 0xA870, 0xA871, 0xA872, 0xA873, 0xC2E8, 0xA874, 0xA875, 0xA876,
+	0xA877, 0xA878, 0xA879, 0xA87A, 0xA881, 0xA882, 0xA883, 0xA884, 0xA885, 0xA886, 0xA887, 0xA888, 0xA889, 0xA88A, 0xA88B, 0xA88C,
+	0xA88D, 0xA88E, 0xA88F, 0xA890, 0xA891, 0xA892, 0xA893, 0xA894, 0xC2E9, 0xA895, 0xA896, 0xA897, 0xA898, 0xA899, 0xA89A, 0xA89B,
+	0xA89C, 0xA89D, 0xA89E, 0xA89F, 0xA8A0, 0xA941, 0xA942, 0xA943, 0xA944, 0xA945, 0xA946, 0xA947, 0xA948, 0xA949, 0xA94A, 0xA94B,
+	0xA94C, 0xA94D, 0xA94E, 0xA94F, 0xC2EA, 0xA950, 0xA951, 0xA952, 0xA953, 0xA954, 0xA955, 0xA956, 0xA957, 0xA958, 0xA959, 0xA95A,
+	0xA961, 0xA962, 0xA963, 0xA964, 0xC2EB, 0xA965, 0xA966, 0xC2EC, 0xA967, 0xC2ED, 0xA968, 0xA969, 0xA96A, 0xA96B, 0xA96C, 0xA96D,
+	0xA96E, 0xA96F, 0xA970, 0xA971, 0xA972, 0xA973, 0xA974, 0xA975, 0xA976, 0xA977, 0xA978, 0xA979, 0xA97A, 0xA981, 0xA982, 0xA983,
+	0xA984, 0xA985, 0xA986, 0xA987, 0xA988, 0xA989, 0xA98A, 0xA98B, 0xA98C, 0xA98D, 0xA98E, 0xA98F, 0xC2EE, 0xC2EF, 0xA990, 0xA991,
+	0xC2F0, 0xA992, 0xA993, 0xA994, 0xC2F1, 0xA995, 0xA996, 0xA997, 0xA998, 0xA999, 0xA99A, 0xA99B, 0xC2F2, 0xC2F3, 0xA99C, 0xA99D,
+	0xA99E, 0xC2F4, 0xC2F5, 0xA99F, 0xA9A0, 0xAA41, 0xAA42, 0xC2F6, 0xC2F7, 0xC2F8, 0xAA43, 0xAA44, 0xC2F9, 0xAA45, 0xC2FA, 0xAA46,
+	0xC2FB, 0xAA47, 0xAA48, 0xAA49, 0xAA4A, 0xAA4B, 0xAA4C, 0xAA4D, 0xC2FC, 0xC2FD, 0xAA4E, 0xC2FE, 0xC3A1, 0xC3A2, 0xC3A3, 0xAA4F,
+	0xAA50, 0xAA51, 0xAA52, 0xAA53, 0xC3A4, 0xC3A5, 0xAA54, 0xAA55, 0xC3A6, 0xAA56, 0xAA57, 0xAA58, 0xC3A7, 0xAA59, 0xAA5A, 0xAA61,
+	0xAA62, 0xAA63, 0xAA64, 0xAA65, 0xC3A8, 0xC3A9, 0xAA66, 0xC3AA, 0xC3AB, 0xC3AC, 0xAA67, 0xAA68, 0xAA69, 0xAA6A, 0xAA6B, 0xAA6C,
+	0xC3AD, 0xAA6D, 0xAA6E, 0xAA6F, 0xC3AE, 0xAA70, 0xC3AF, 0xAA71, 0xC3B0, 0xAA72, 0xAA73, 0xAA74, 0xAA75, 0xAA76, 0xAA77, 0xAA78,
+	0xC3B1, 0xAA79, 0xAA7A, 0xAA81, 0xAA82, 0xC3B2, 0xAA83, 0xAA84, 0xAA85, 0xAA86, 0xAA87, 0xAA88, 0xAA89, 0xAA8A, 0xAA8B, 0xAA8C,
+	0xAA8D, 0xAA8E, 0xAA8F, 0xAA90, 0xAA91, 0xAA92, 0xAA93, 0xAA94, 0xAA95, 0xAA96, 0xAA97, 0xAA98, 0xAA99, 0xAA9A, 0xAA9B, 0xAA9C,
+	0xAA9D, 0xAA9E, 0xAA9F, 0xAAA0, 0xAB41, 0xAB42, 0xAB43, 0xAB44, 0xC3B3, 0xC3B4, 0xAB45, 0xAB46, 0xC3B5, 0xAB47, 0xAB48, 0xAB49,
+	0xC3B6, 0xAB4A, 0xAB4B, 0xAB4C, 0xAB4D, 0xAB4E, 0xAB4F, 0xAB50, 0xC3B7, 0xC3B8, 0xAB51, 0xC3B9, 0xC3BA, 0xC3BB, 0xAB52, 0xAB53,
+	0xAB54, 0xAB55, 0xAB56, 0xAB57, 0xC3BC, 0xC3BD, 0xAB58, 0xAB59, 0xC3BE, 0xAB5A, 0xAB61, 0xAB62, 0xC3BF, 0xAB63, 0xAB64, 0xAB65,
+	0xAB66, 0xAB67, 0xAB68, 0xAB69, 0xC3C0, 0xC3C1, 0xAB6A, 0xC3C2, 0xAB6B, 0xC3C3, 0xAB6C, 0xAB6D, 0xAB6E, 0xAB6F, 0xAB70, 0xAB71,
+	0xC3C4, 0xAB72, 0xAB73, 0xAB74, 0xC3C5, 0xAB75, 0xAB76, 0xAB77, 0xAB78, 0xAB79, 0xAB7A, 0xAB81, 0xAB82, 0xAB83, 0xAB84, 0xAB85,
+	0xAB86, 0xAB87, 0xAB88, 0xAB89, 0xC3C6, 0xAB8A, 0xAB8B, 0xAB8C, 0xAB8D, 0xAB8E, 0xAB8F, 0xAB90, 0xC3C7, 0xAB91, 0xAB92, 0xAB93,
+	0xC3C8, 0xAB94, 0xAB95, 0xAB96, 0xAB97, 0xAB98, 0xAB99, 0xAB9A, 0xAB9B, 0xAB9C, 0xAB9D, 0xAB9E, 0xAB9F, 0xABA0, 0xAC41, 0xAC42,
+	0xAC43, 0xC3C9, 0xAC44, 0xAC45, 0xAC46, 0xAC47, 0xAC48, 0xAC49, 0xC3CA, 0xC3CB, 0xAC4A, 0xAC4B, 0xC3CC, 0xAC4C, 0xAC4D, 0xAC4E,
+	0xC3CD, 0xAC4F, 0xAC50, 0xAC51, 0xAC52, 0xAC53, 0xAC54, 0xAC55, 0xC3CE, 0xC3CF, 0xAC56, 0xC3D0, 0xAC57, 0xC3D1, 0xAC58, 0xAC59,
+	0xAC5A, 0xAC61, 0xAC62, 0xAC63, 0xC3D2, 0xAC64, 0xAC65, 0xAC66, 0xC3D3, 0xAC67, 0xAC68, 0xAC69, 0xC3D4, 0xAC6A, 0xAC6B, 0xAC6C,
+	0xAC6D, 0xAC6E, 0xAC6F, 0xAC70, 0xAC71, 0xAC72, 0xAC73, 0xAC74, 0xAC75, 0xC3D5, 0xAC76, 0xAC77, 0xAC78, 0xAC79, 0xAC7A, 0xAC81,
+	0xAC82, 0xAC83, 0xAC84, 0xAC85, 0xAC86, 0xAC87, 0xAC88, 0xAC89, 0xAC8A, 0xAC8B, 0xAC8C, 0xAC8D, 0xAC8E, 0xAC8F, 0xAC90, 0xAC91,
+	0xAC92, 0xAC93, 0xAC94, 0xAC95, 0xAC96, 0xAC97, 0xAC98, 0xAC99, 0xAC9A, 0xAC9B, 0xAC9C, 0xAC9D, 0xC3D6, 0xAC9E, 0xAC9F, 0xACA0,
+	0xC3D7, 0xAD41, 0xAD42, 0xAD43, 0xC3D8, 0xAD44, 0xAD45, 0xAD46, 0xAD47, 0xAD48, 0xAD49, 0xAD4A, 0xC3D9, 0xC3DA, 0xAD4B, 0xC3DB,
+	0xAD4C, 0xC3DC, 0xAD4D, 0xAD4E, 0xAD4F, 0xAD50, 0xAD51, 0xAD52, 0xC3DD, 0xAD53, 0xAD54, 0xAD55, 0xAD56, 0xAD57, 0xAD58, 0xAD59,
+	0xAD5A, 0xAD61, 0xAD62, 0xAD63, 0xAD64, 0xAD65, 0xAD66, 0xAD67, 0xC3DE, 0xAD68, 0xAD69, 0xAD6A, 0xAD6B, 0xAD6C, 0xAD6D, 0xAD6E,
+	0xAD6F, 0xAD70, 0xAD71, 0xAD72, 0xC3DF, 0xC3E0, 0xAD73, 0xAD74, 0xC3E1, 0xAD75, 0xAD76, 0xAD77, 0xC3E2, 0xAD78, 0xAD79, 0xAD7A,
+	0xAD81, 0xAD82, 0xAD83, 0xAD84, 0xC3E3, 0xC3E4, 0xAD85, 0xC3E5, 0xAD86, 0xC3E6, 0xAD87, 0xAD88, 0xAD89, 0xAD8A, 0xAD8B, 0xAD8C,
+	0xC3E7, 0xAD8D, 0xAD8E, 0xAD8F, 0xAD90, 0xAD91, 0xAD92, 0xAD93, 0xAD94, 0xAD95, 0xAD96, 0xAD97, 0xAD98, 0xAD99, 0xAD9A, 0xAD9B,
+	0xAD9C, 0xAD9D, 0xAD9E, 0xAD9F, 0xC3E8, 0xADA0, 0xAE41, 0xAE42, 0xAE43, 0xAE44, 0xAE45, 0xAE46, 0xC3E9, 0xAE47, 0xAE48, 0xAE49,
+	0xC3EA, 0xAE4A, 0xAE4B, 0xAE4C, 0xAE4D, 0xAE4E, 0xAE4F, 0xAE50, 0xAE51, 0xAE52, 0xAE53, 0xAE54, 0xAE55, 0xAE56, 0xAE57, 0xAE58,
+	0xAE59, 0xAE5A, 0xAE61, 0xAE62, 0xAE63, 0xAE64, 0xAE65, 0xAE66, 0xC3EB, 0xAE67, 0xAE68, 0xAE69, 0xC3EC, 0xAE6A, 0xAE6B, 0xAE6C,
+	0xC3ED, 0xAE6D, 0xAE6E, 0xAE6F, 0xAE70, 0xAE71, 0xAE72, 0xAE73, 0xC3EE, 0xC3EF, 0xAE74, 0xC3F0, 0xAE75, 0xC3F1, 0xAE76, 0xAE77,
+	0xAE78, 0xAE79, 0xAE7A, 0xAE81, 0xC3F2, 0xAE82, 0xAE83, 0xAE84, 0xC3F3, 0xAE85, 0xAE86, 0xAE87, 0xC3F4, 0xAE88, 0xAE89, 0xAE8A,
+	0xAE8B, 0xAE8C, 0xAE8D, 0xAE8E, 0xC3F5, 0xAE8F, 0xAE90, 0xAE91, 0xAE92, 0xC3F6, 0xAE93, 0xAE94, 0xAE95, 0xAE96, 0xAE97, 0xAE98,
+	0xC3F7, 0xC3F8, 0xAE99, 0xAE9A, 0xC3F9, 0xAE9B, 0xAE9C, 0xAE9D, 0xC3FA, 0xAE9E, 0xAE9F, 0xAEA0, 0xAF41, 0xAF42, 0xAF43, 0xAF44,
+	0xC3FB, 0xC3FC, 0xAF45, 0xC3FD, 0xAF46, 0xC3FE, 0xAF47, 0xAF48, 0xAF49, 0xAF4A, 0xAF4B, 0xAF4C, 0xAF4D, 0xAF4E, 0xAF4F, 0xAF50,
+	0xAF51, 0xAF52, 0xAF53, 0xAF54, 0xAF55, 0xAF56, 0xAF57, 0xAF58, 0xAF59, 0xAF5A, 0xAF61, 0xAF62, 0xAF63, 0xAF64, 0xAF65, 0xAF66,
+	0xAF67, 0xAF68, 0xAF69, 0xAF6A, 0xAF6B, 0xAF6C, 0xAF6D, 0xAF6E, 0xC4A1, 0xC4A2, 0xAF6F, 0xAF70, 0xC4A3, 0xAF71, 0xAF72, 0xC4A4,
+	0xC4A5, 0xC4A6, 0xAF73, 0xAF74, 0xAF75, 0xAF76, 0xAF77, 0xAF78, 0xC4A7, 0xC4A8, 0xAF79, 0xC4A9, 0xAF7A, 0xC4AA, 0xAF81, 0xAF82,
+	0xAF83, 0xAF84, 0xAF85, 0xAF86, 0xC4AB, 0xC4AC, 0xAF87, 0xAF88, 0xC4AD, 0xAF89, 0xAF8A, 0xAF8B, 0xC4AE, 0xAF8C, 0xAF8D, 0xAF8E,
+	0xAF8F, 0xAF90, 0xAF91, 0xAF92, 0xC4AF, 0xC4B0, 0xAF93, 0xC4B1, 0xAF94, 0xC4B2, 0xAF95, 0xAF96, 0xAF97, 0xAF98, 0xAF99, 0xAF9A,
+	0xC4B3, 0xC4B4, 0xAF9B, 0xAF9C, 0xC4B5, 0xAF9D, 0xAF9E, 0xAF9F, 0xC4B6, 0xAFA0, 0xB041, 0xB042, 0xB043, 0xB044, 0xB045, 0xB046,
+	0xC4B7, 0xC4B8, 0xB047, 0xC4B9, 0xC4BA, 0xC4BB, 0xB048, 0xB049, 0xB04A, 0xB04B, 0xB04C, 0xB04D, 0xC4BC, 0xC4BD, 0xB04E, 0xB04F,
+	0xB050, 0xB051, 0xB052, 0xB053, 0xB054, 0xB055, 0xB056, 0xB057, 0xB058, 0xB059, 0xB05A, 0xB061, 0xB062, 0xB063, 0xB064, 0xB065,
+	0xB066, 0xC4BE, 0xB067, 0xB068, 0xB069, 0xB06A, 0xB06B, 0xB06C, 0xB06D, 0xB06E, 0xB06F, 0xB070, 0xB071, 0xB072, 0xB073, 0xB074,
+	0xB075, 0xB076, 0xB077, 0xB078, 0xB079, 0xB07A, 0xB081, 0xB082, 0xB083, 0xB084, 0xB085, 0xB086, 0xB087, 0xB088, 0xB089, 0xB08A,
+	0xB08B, 0xB08C, 0xB08D, 0xB08E, 0xC4BF, 0xC4C0, 0xB08F, 0xB090, 0xC4C1, 0xB091, 0xB092, 0xC4C2, 0xC4C3, 0xB093, 0xB094, 0xB095,
+	0xB096, 0xB097, 0xB098, 0xB099, 0xC4C4, 0xC4C5, 0xB09A, 0xC4C6, 0xC4C7, 0xC4C8, 0xB09B, 0xB09C, 0xB09D, 0xB09E, 0xB09F, 0xB0A0,
+	0xC4C9, 0xC4CA, 0xB141, 0xB142, 0xC4CB, 0xB143, 0xB144, 0xB145, 0xC4CC, 0xB146, 0xB147, 0xB148, 0xB149, 0xB14A, 0xB14B, 0xB14C,
+	0xC4CD, 0xC4CE, 0xB14D, 0xC4CF, 0xB14E, 0xC4D0, 0xB14F, 0xB150, 0xB151, 0xB152, 0xB153, 0xB154, 0xC4D1, 0xB155, 0xB156, 0xB157,
+	0xC4D2, 0xB158, 0xB159, 0xB15A, 0xC4D3, 0xB161, 0xB162, 0xB163, 0xB164, 0xB165, 0xB166, 0xB167, 0xC4D4, 0xC4D5, 0xB168, 0xC4D6,
+	0xC4D7, 0xC4D8, 0xB169, 0xB16A, 0xB16B, 0xB16C, 0xB16D, 0xB16E, 0xC4D9, 0xB16F, 0xB170, 0xB171, 0xB172, 0xB173, 0xB174, 0xB175,
+	0xB176, 0xB177, 0xB178, 0xB179, 0xB17A, 0xB181, 0xB182, 0xB183, 0xB184, 0xB185, 0xB186, 0xB187, 0xB188, 0xB189, 0xB18A, 0xB18B,
+	0xB18C, 0xB18D, 0xB18E, 0xB18F, 0xC4DA, 0xC4DB, 0xB190, 0xB191, 0xC4DC, 0xB192, 0xB193, 0xB194, 0xC4DD, 0xB195, 0xB196, 0xB197,
+	0xB198, 0xB199, 0xB19A, 0xB19B, 0xC4DE, 0xC4DF, 0xB19C, 0xC4E0, 0xB19D, 0xC4E1, 0xB19E, 0xB19F, 0xB1A0, 0xB241, 0xB242, 0xB243,
+	0xC4E2, 0xC4E3, 0xB244, 0xB245, 0xC4E4, 0xB246, 0xB247, 0xB248, 0xC4E5, 0xB249, 0xB24A, 0xB24B, 0xB24C, 0xB24D, 0xB24E, 0xB24F,
+	0xC4E6, 0xB250, 0xB251, 0xB252, 0xB253, 0xC4E7, 0xB254, 0xB255, 0xB256, 0xB257, 0xB258, 0xB259, 0xC4E8, 0xB25A, 0xB261, 0xB262,
+	0xB263, 0xB264, 0xB265, 0xB266, 0xB267, 0xB268, 0xB269, 0xB26A, 0xB26B, 0xB26C, 0xB26D, 0xB26E, 0xB26F, 0xB270, 0xB271, 0xB272,
+	0xB273, 0xC4E9, 0xB274, 0xB275, 0xB276, 0xB277, 0xB278, 0xB279, 0xC4EA, 0xB27A, 0xB281, 0xB282, 0xB283, 0xB284, 0xB285, 0xB286,
+	0xC4EB, 0xB287, 0xB288, 0xB289, 0xB28A, 0xB28B, 0xB28C, 0xB28D, 0xB28E, 0xB28F, 0xB290, 0xB291, 0xB292, 0xB293, 0xB294, 0xB295,
+	0xB296, 0xB297, 0xB298, 0xB299, 0xC4EC, 0xB29A, 0xB29B, 0xB29C, 0xB29D, 0xB29E, 0xB29F, 0xB2A0, 0xB341, 0xB342, 0xB343, 0xB344,
+	0xB345, 0xB346, 0xB347, 0xB348, 0xB349, 0xB34A, 0xB34B, 0xB34C, 0xB34D, 0xB34E, 0xB34F, 0xB350, 0xB351, 0xB352, 0xB353, 0xB354,
+	0xC4ED, 0xC4EE, 0xB355, 0xB356, 0xC4EF, 0xB357, 0xB358, 0xB359, 0xC4F0, 0xB35A, 0xB361, 0xB362, 0xB363, 0xB364, 0xB365, 0xB366,
+	0xC4F1, 0xC4F2, 0xB367, 0xC4F3, 0xB368, 0xC4F4, 0xB369, 0xB36A, 0xB36B, 0xB36C, 0xB36D, 0xB36E, 0xC4F5, 0xB36F, 0xB370, 0xB371,
+	0xC4F6, 0xB372, 0xB373, 0xB374, 0xC4F7, 0xB375, 0xB376, 0xB377, 0xB378, 0xB379, 0xB37A, 0xB381, 0xB382, 0xB383, 0xB384, 0xB385,
+	0xB386, 0xC4F8, 0xB387, 0xB388, 0xB389, 0xB38A, 0xB38B, 0xB38C, 0xC4F9, 0xB38D, 0xB38E, 0xB38F, 0xB390, 0xB391, 0xB392, 0xB393,
+	0xB394, 0xB395, 0xB396, 0xB397, 0xB398, 0xB399, 0xB39A, 0xB39B, 0xB39C, 0xB39D, 0xB39E, 0xB39F, 0xB3A0, 0xC4FA, 0xB441, 0xB442,
+	0xB443, 0xB444, 0xB445, 0xB446, 0xC4FB, 0xC4FC, 0xB447, 0xB448, 0xC4FD, 0xB449, 0xB44A, 0xB44B, 0xC4FE, 0xB44C, 0xB44D, 0xB44E,
+	0xB44F, 0xB450, 0xB451, 0xB452, 0xC5A1, 0xC5A2, 0xB453, 0xC5A3, 0xB454, 0xC5A4, 0xB455, 0xB456, 0xB457, 0xB458, 0xB459, 0xB45A,
+	0xC5A5, 0xB461, 0xB462, 0xB463, 0xC5A6, 0xB464, 0xB465, 0xB466, 0xC5A7, 0xB467, 0xB468, 0xB469, 0xB46A, 0xB46B, 0xB46C, 0xB46D,
+	0xC5A8, 0xB46E, 0xB46F, 0xB470, 0xB471, 0xB472, 0xB473, 0xB474, 0xB475, 0xB476, 0xB477, 0xB478, 0xC5A9, 0xC5AA, 0xB479, 0xB47A,
+	0xC5AB, 0xB481, 0xB482, 0xB483, 0xC5AC, 0xB484, 0xB485, 0xB486, 0xB487, 0xB488, 0xB489, 0xB48A, 0xC5AD, 0xC5AE, 0xB48B, 0xB48C,
+	0xB48D, 0xC5AF, 0xB48E, 0xB48F, 0xB490, 0xB491, 0xB492, 0xB493, 0xB494, 0xB495, 0xB496, 0xB497, 0xB498, 0xB499, 0xB49A, 0xB49B,
+	0xB49C, 0xB49D, 0xB49E, 0xB49F, 0xB4A0, 0xB541, 0xB542, 0xB543, 0xB544, 0xB545, 0xB546, 0xB547, 0xB548, 0xB549, 0xB54A, 0xB54B,
+	0xB54C, 0xB54D, 0xB54E, 0xB54F, 0xC5B0, 0xC5B1, 0xB550, 0xB551, 0xC5B2, 0xB552, 0xB553, 0xB554, 0xC5B3, 0xB555, 0xB556, 0xB557,
+	0xB558, 0xB559, 0xB55A, 0xB561, 0xC5B4, 0xC5B5, 0xB562, 0xC5B6, 0xB563, 0xC5B7, 0xB564, 0xB565, 0xB566, 0xB567, 0xB568, 0xB569,
+	0xC5B8, 0xC5B9, 0xB56A, 0xB56B, 0xC5BA, 0xB56C, 0xB56D, 0xB56E, 0xC5BB, 0xC5BC, 0xB56F, 0xB570, 0xB571, 0xB572, 0xB573, 0xB574,
+	0xC5BD, 0xC5BE, 0xB575, 0xC5BF, 0xC5C0, 0xC5C1, 0xB576, 0xB577, 0xB578, 0xB579, 0xB57A, 0xB581, 0xC5C2, 0xC5C3, 0xB582, 0xB583,
+	0xC5C4, 0xB584, 0xB585, 0xB586, 0xC5C5, 0xB587, 0xB588, 0xB589, 0xB58A, 0xB58B, 0xB58C, 0xB58D, 0xC5C6, 0xC5C7, 0xB58E, 0xC5C8,
+	0xC5C9, 0xC5CA, 0xB58F, 0xB590, 0xB591, 0xB592, 0xB593, 0xB594, 0xC5CB, 0xB595, 0xB596, 0xB597, 0xB598, 0xB599, 0xB59A, 0xB59B,
+	0xB59C, 0xB59D, 0xB59E, 0xB59F, 0xB5A0, 0xB641, 0xB642, 0xB643, 0xB644, 0xB645, 0xB646, 0xB647, 0xB648, 0xC5CC, 0xB649, 0xB64A,
+	0xB64B, 0xB64C, 0xB64D, 0xB64E, 0xB64F, 0xB650, 0xB651, 0xB652, 0xB653, 0xB654, 0xB655, 0xB656, 0xB657, 0xB658, 0xB659, 0xB65A,
+	0xB661, 0xB662, 0xB663, 0xB664, 0xB665, 0xB666, 0xB667, 0xB668, 0xB669, 0xB66A, 0xB66B, 0xB66C, 0xB66D, 0xB66E, 0xB66F, 0xB670,
+	0xC5CD, 0xC5CE, 0xB671, 0xB672, 0xC5CF, 0xB673, 0xB674, 0xB675, 0xC5D0, 0xB676, 0xC5D1, 0xB677, 0xB678, 0xB679, 0xB67A, 0xB681,
+	0xC5D2, 0xC5D3, 0xB682, 0xC5D4, 0xC5D5, 0xC5D6, 0xB683, 0xB684, 0xB685, 0xB686, 0xB687, 0xB688, 0xC5D7, 0xC5D8, 0xB689, 0xB68A,
+	0xC5D9, 0xB68B, 0xB68C, 0xB68D, 0xC5DA, 0xB68E, 0xB68F, 0xB690, 0xB691, 0xB692, 0xB693, 0xB694, 0xC5DB, 0xC5DC, 0xB695, 0xC5DD,
+	0xB696, 0xC5DE, 0xB697, 0xB698, 0xB699, 0xB69A, 0xB69B, 0xB69C, 0xC5DF, 0xB69D, 0xB69E, 0xB69F, 0xC5E0, 0xB6A0, 0xB741, 0xB742,
+	0xB743, 0xB744, 0xB745, 0xB746, 0xB747, 0xB748, 0xB749, 0xB74A, 0xB74B, 0xB74C, 0xB74D, 0xB74E, 0xC5E1, 0xB74F, 0xB750, 0xB751,
+	0xB752, 0xB753, 0xB754, 0xB755, 0xC5E2, 0xB756, 0xB757, 0xB758, 0xC5E3, 0xB759, 0xB75A, 0xB761, 0xB762, 0xB763, 0xB764, 0xB765,
+	0xB766, 0xB767, 0xB768, 0xB769, 0xB76A, 0xB76B, 0xB76C, 0xB76D, 0xB76E, 0xB76F, 0xB770, 0xB771, 0xB772, 0xB773, 0xB774, 0xB775,
+	0xC5E4, 0xC5E5, 0xB776, 0xB777, 0xC5E6, 0xB778, 0xB779, 0xB77A, 0xC5E7, 0xB781, 0xB782, 0xB783, 0xB784, 0xB785, 0xB786, 0xB787,
+	0xC5E8, 0xC5E9, 0xB788, 0xC5EA, 0xB789, 0xC5EB, 0xB78A, 0xB78B, 0xB78C, 0xB78D, 0xC5EC, 0xB78E, 0xC5ED, 0xB78F, 0xB790, 0xB791,
+	0xC5EE, 0xB792, 0xB793, 0xB794, 0xB795, 0xB796, 0xB797, 0xB798, 0xB799, 0xB79A, 0xB79B, 0xB79C, 0xB79D, 0xB79E, 0xB79F, 0xB7A0,
+	0xB841, 0xB842, 0xB843, 0xB844, 0xB845, 0xB846, 0xB847, 0xB848, 0xC5EF, 0xB849, 0xB84A, 0xB84B, 0xB84C, 0xB84D, 0xB84E, 0xB84F,
+	0xB850, 0xB851, 0xB852, 0xB853, 0xB854, 0xB855, 0xB856, 0xB857, 0xB858, 0xB859, 0xB85A, 0xB861, 0xB862, 0xB863, 0xB864, 0xB865,
+	0xB866, 0xB867, 0xB868, 0xB869, 0xC5F0, 0xB86A, 0xB86B, 0xB86C, 0xC5F1, 0xB86D, 0xB86E, 0xB86F, 0xB870, 0xB871, 0xB872, 0xB873,
+	0xB874, 0xB875, 0xB876, 0xB877, 0xB878, 0xB879, 0xB87A, 0xC5F2, 0xB881, 0xC5F3, 0xB882, 0xB883, 0xB884, 0xB885, 0xB886, 0xB887,
+	0xC5F4, 0xB888, 0xB889, 0xB88A, 0xB88B, 0xB88C, 0xB88D, 0xB88E, 0xB88F, 0xB890, 0xB891, 0xB892, 0xB893, 0xB894, 0xB895, 0xB896,
+	0xB897, 0xB898, 0xB899, 0xB89A, 0xB89B, 0xB89C, 0xB89D, 0xB89E, 0xB89F, 0xB8A0, 0xB941, 0xB942, 0xC5F5, 0xC5F6, 0xB943, 0xB944,
+	0xC5F7, 0xB945, 0xB946, 0xB947, 0xC5F8, 0xB948, 0xB949, 0xB94A, 0xB94B, 0xB94C, 0xB94D, 0xB94E, 0xC5F9, 0xC5FA, 0xB94F, 0xC5FB,
+	0xB950, 0xC5FC, 0xB951, 0xB952, 0xB953, 0xB954, 0xB955, 0xB956, 0xC5FD, 0xB957, 0xB958, 0xB959, 0xB95A, 0xB961, 0xB962, 0xB963,
+	0xB964, 0xB965, 0xB966, 0xB967, 0xB968, 0xB969, 0xB96A, 0xB96B, 0xB96C, 0xB96D, 0xB96E, 0xB96F, 0xC5FE, 0xB970, 0xB971, 0xB972,
+	0xB973, 0xB974, 0xB975, 0xB976, 0xC6A1, 0xB977, 0xB978, 0xB979, 0xB97A, 0xB981, 0xB982, 0xB983, 0xB984, 0xB985, 0xB986, 0xB987,
+	0xB988, 0xB989, 0xB98A, 0xB98B, 0xB98C, 0xB98D, 0xB98E, 0xB98F, 0xB990, 0xB991, 0xB992, 0xB993, 0xB994, 0xB995, 0xB996, 0xB997,
+	0xC6A2, 0xC6A3, 0xB998, 0xB999, 0xC6A4, 0xB99A, 0xB99B, 0xB99C, 0xC6A5, 0xB99D, 0xB99E, 0xB99F, 0xB9A0, 0xBA41, 0xBA42, 0xBA43,
+	0xC6A6, 0xC6A7, 0xBA44, 0xBA45, 0xBA46, 0xC6A8, 0xBA47, 0xBA48, 0xBA49, 0xBA4A, 0xBA4B, 0xBA4C, 0xC6A9, 0xBA4D, 0xBA4E, 0xBA4F,
+	0xC6AA, 0xBA50, 0xBA51, 0xBA52, 0xC6AB, 0xBA53, 0xBA54, 0xBA55, 0xBA56, 0xBA57, 0xBA58, 0xBA59, 0xC6AC, 0xBA5A, 0xBA61, 0xBA62,
+	0xBA63, 0xC6AD, 0xBA64, 0xBA65, 0xBA66, 0xBA67, 0xBA68, 0xBA69, 0xC6AE, 0xC6AF, 0xBA6A, 0xBA6B, 0xC6B0, 0xBA6C, 0xBA6D, 0xC6B1,
+	0xC6B2, 0xBA6E, 0xC6B3, 0xBA6F, 0xBA70, 0xBA71, 0xBA72, 0xBA73, 0xC6B4, 0xC6B5, 0xBA74, 0xC6B6, 0xBA75, 0xBA76, 0xBA77, 0xBA78,
+	0xBA79, 0xBA7A, 0xBA81, 0xBA82, 0xC6B7, 0xBA83, 0xBA84, 0xBA85, 0xC6B8, 0xBA86, 0xBA87, 0xBA88, 0xC6B9, 0xBA89, 0xBA8A, 0xBA8B,
+	0xBA8C, 0xBA8D, 0xBA8E, 0xBA8F, 0xC6BA, 0xC6BB, 0xBA90, 0xBA91, 0xBA92, 0xBA93, 0xBA94, 0xBA95, 0xBA96, 0xBA97, 0xBA98, 0xBA99,
+	0xC6BC, 0xC6BD, 0xBA9A, 0xBA9B, 0xC6BE, 0xBA9C, 0xBA9D, 0xBA9E, 0xC6BF, 0xBA9F, 0xBAA0, 0xBB41, 0xBB42, 0xBB43, 0xBB44, 0xBB45,
+	0xC6C0, 0xC6C1, 0xBB46, 0xC6C2, 0xBB47, 0xC6C3, 0xBB48, 0xBB49, 0xBB4A, 0xBB4B, 0xBB4C, 0xBB4D, 0xC6C4, 0xC6C5, 0xC6C6, 0xBB4E,
+	0xC6C7, 0xBB4F, 0xBB50, 0xBB51, 0xC6C8, 0xBB52, 0xC6C9, 0xBB53, 0xBB54, 0xBB55, 0xBB56, 0xBB57, 0xC6CA, 0xC6CB, 0xBB58, 0xC6CC,
+	0xC6CD, 0xC6CE, 0xBB59, 0xBB5A, 0xBB61, 0xC6CF, 0xBB62, 0xBB63, 0xC6D0, 0xC6D1, 0xBB64, 0xBB65, 0xC6D2, 0xBB66, 0xBB67, 0xBB68,
+	0xC6D3, 0xBB69, 0xBB6A, 0xBB6B, 0xBB6C, 0xBB6D, 0xBB6E, 0xBB6F, 0xC6D4, 0xC6D5, 0xBB70, 0xC6D6, 0xC6D7, 0xC6D8, 0xBB71, 0xBB72,
+	0xBB73, 0xBB74, 0xBB75, 0xBB76, 0xC6D9, 0xC6DA, 0xBB77, 0xBB78, 0xBB79, 0xBB7A, 0xBB81, 0xBB82, 0xBB83, 0xBB84, 0xBB85, 0xBB86,
+	0xBB87, 0xBB88, 0xBB89, 0xBB8A, 0xBB8B, 0xBB8C, 0xBB8D, 0xBB8E, 0xBB8F, 0xBB90, 0xBB91, 0xBB92, 0xBB93, 0xBB94, 0xBB95, 0xBB96,
+	0xBB97, 0xBB98, 0xBB99, 0xBB9A, 0xBB9B, 0xBB9C, 0xBB9D, 0xBB9E, 0xBB9F, 0xBBA0, 0xBC41, 0xBC42, 0xBC43, 0xBC44, 0xBC45, 0xBC46,
+	0xBC47, 0xBC48, 0xBC49, 0xBC4A, 0xBC4B, 0xBC4C, 0xBC4D, 0xBC4E, 0xBC4F, 0xBC50, 0xBC51, 0xBC52, 0xC6DB, 0xC6DC, 0xBC53, 0xBC54,
+	0xC6DD, 0xBC55, 0xBC56, 0xBC57, 0xC6DE, 0xBC58, 0xBC59, 0xBC5A, 0xBC61, 0xBC62, 0xBC63, 0xBC64, 0xC6DF, 0xC6E0, 0xBC65, 0xC6E1,
+	0xC6E2, 0xC6E3, 0xBC66, 0xBC67, 0xBC68, 0xBC69, 0xBC6A, 0xBC6B, 0xC6E4, 0xC6E5, 0xBC6C, 0xBC6D, 0xC6E6, 0xBC6E, 0xBC6F, 0xBC70,
+	0xC6E7, 0xBC71, 0xBC72, 0xBC73, 0xBC74, 0xBC75, 0xBC76, 0xBC77, 0xC6E8, 0xC6E9, 0xBC78, 0xC6EA, 0xBC79, 0xC6EB, 0xBC7A, 0xBC81,
+	0xBC82, 0xBC83, 0xBC84, 0xBC85, 0xC6EC, 0xBC86, 0xBC87, 0xBC88, 0xC6ED, 0xBC89, 0xBC8A, 0xBC8B, 0xC6EE, 0xBC8C, 0xBC8D, 0xBC8E,
+	0xBC8F, 0xBC90, 0xBC91, 0xBC92, 0xC6EF, 0xC6F0, 0xBC93, 0xBC94, 0xC6F1, 0xC6F2, 0xBC95, 0xBC96, 0xBC97, 0xBC98, 0xBC99, 0xBC9A,
+	0xC6F3, 0xBC9B, 0xBC9C, 0xBC9D, 0xBC9E, 0xBC9F, 0xBCA0, 0xBD41, 0xC6F4, 0xBD42, 0xBD43, 0xBD44, 0xBD45, 0xBD46, 0xBD47, 0xBD48,
+	0xBD49, 0xC6F5, 0xBD4A, 0xC6F6, 0xBD4B, 0xBD4C, 0xBD4D, 0xBD4E, 0xBD4F, 0xBD50, 0xBD51, 0xBD52, 0xC6F7, 0xC6F8, 0xBD53, 0xBD54,
+	0xC6F9, 0xBD55, 0xBD56, 0xBD57, 0xC6FA, 0xBD58, 0xBD59, 0xBD5A, 0xBD61, 0xBD62, 0xBD63, 0xBD64, 0xC6FB, 0xC6FC, 0xBD65, 0xC6FD,
+	0xBD66, 0xC6FE, 0xBD67, 0xBD68, 0xBD69, 0xBD6A, 0xBD6B, 0xBD6C, 0xC7A1, 0xBD6D, 0xBD6E, 0xBD6F, 0xBD70, 0xBD71, 0xBD72, 0xBD73,
+	0xBD74, 0xBD75, 0xBD76, 0xBD77, 0xBD78, 0xBD79, 0xBD7A, 0xBD81, 0xBD82, 0xBD83, 0xBD84, 0xBD85, 0xBD86, 0xC7A2, 0xBD87, 0xBD88,
+	0xBD89, 0xBD8A, 0xBD8B, 0xBD8C, 0xBD8D, 0xBD8E, 0xBD8F, 0xBD90, 0xBD91, 0xBD92, 0xBD93, 0xBD94, 0xBD95, 0xBD96, 0xBD97, 0xBD98,
+	0xBD99, 0xBD9A, 0xBD9B, 0xBD9C, 0xBD9D, 0xBD9E, 0xBD9F, 0xBDA0, 0xBE41, 0xBE42, 0xBE43, 0xBE44, 0xBE45, 0xBE46, 0xBE47, 0xBE48,
+	0xC7A3, 0xBE49, 0xBE4A, 0xBE4B, 0xC7A4, 0xBE4C, 0xBE4D, 0xBE4E, 0xBE4F, 0xBE50, 0xBE51, 0xBE52, 0xBE53, 0xBE54, 0xBE55, 0xBE56,
+	0xBE57, 0xBE58, 0xBE59, 0xBE5A, 0xBE61, 0xBE62, 0xBE63, 0xBE64, 0xBE65, 0xBE66, 0xBE67, 0xBE68, 0xC7A5, 0xBE69, 0xBE6A, 0xBE6B,
+	0xC7A6, 0xBE6C, 0xBE6D, 0xBE6E, 0xC7A7, 0xBE6F, 0xBE70, 0xBE71, 0xBE72, 0xBE73, 0xBE74, 0xBE75, 0xBE76, 0xC7A8, 0xBE77, 0xC7A9,
+	0xBE78, 0xBE79, 0xBE7A, 0xBE81, 0xBE82, 0xBE83, 0xBE84, 0xBE85, 0xC7AA, 0xC7AB, 0xBE86, 0xBE87, 0xC7AC, 0xBE88, 0xBE89, 0xC7AD,
+	0xC7AE, 0xBE8A, 0xC7AF, 0xBE8B, 0xBE8C, 0xBE8D, 0xBE8E, 0xBE8F, 0xC7B0, 0xC7B1, 0xBE90, 0xC7B2, 0xBE91, 0xC7B3, 0xBE92, 0xBE93,
+	0xBE94, 0xBE95, 0xBE96, 0xBE97, 0xC7B4, 0xBE98, 0xBE99, 0xBE9A, 0xBE9B, 0xBE9C, 0xBE9D, 0xBE9E, 0xBE9F, 0xBEA0, 0xBF41, 0xBF42,
+	0xBF43, 0xBF44, 0xBF45, 0xBF46, 0xBF47, 0xBF48, 0xBF49, 0xBF4A, 0xBF4B, 0xC7B5, 0xBF4C, 0xBF4D, 0xBF4E, 0xBF4F, 0xBF50, 0xBF51,
+	0xBF52, 0xBF53, 0xBF54, 0xBF55, 0xBF56, 0xBF57, 0xBF58, 0xBF59, 0xBF5A, 0xBF61, 0xBF62, 0xBF63, 0xBF64, 0xBF65, 0xBF66, 0xBF67,
+	0xBF68, 0xBF69, 0xBF6A, 0xBF6B, 0xBF6C, 0xBF6D, 0xBF6E, 0xBF6F, 0xBF70, 0xBF71, 0xBF72, 0xBF73, 0xC7B6, 0xBF74, 0xBF75, 0xBF76,
+	0xC7B7, 0xBF77, 0xBF78, 0xBF79, 0xC7B8, 0xBF7A, 0xBF81, 0xBF82, 0xBF83, 0xBF84, 0xBF85, 0xBF86, 0xC7B9, 0xBF87, 0xBF88, 0xC7BA,
+	0xBF89, 0xBF8A, 0xBF8B, 0xBF8C, 0xBF8D, 0xBF8E, 0xBF8F, 0xBF90, 0xC7BB, 0xBF91, 0xBF92, 0xBF93, 0xC7BC, 0xBF94, 0xBF95, 0xBF96,
+	0xC7BD, 0xBF97, 0xBF98, 0xBF99, 0xBF9A, 0xBF9B, 0xBF9C, 0xBF9D, 0xC7BE, 0xBF9E, 0xBF9F, 0xC7BF, 0xBFA0, 0xC7C0, 0xC041, 0xC042,
+	0xC043, 0xC044, 0xC045, 0xC046, 0xC7C1, 0xC047, 0xC048, 0xC049, 0xC7C2, 0xC04A, 0xC04B, 0xC04C, 0xC7C3, 0xC04D, 0xC04E, 0xC04F,
+	0xC050, 0xC051, 0xC052, 0xC053, 0xC7C4, 0xC7C5, 0xC054, 0xC7C6, 0xC055, 0xC056, 0xC057, 0xC058, 0xC059, 0xC05A, 0xC061, 0xC062,
+	0xC063, 0xC064, 0xC065, 0xC066, 0xC067, 0xC068, 0xC069, 0xC06A, 0xC06B, 0xC06C, 0xC06D, 0xC06E, 0xC06F, 0xC070, 0xC071, 0xC072,
+	0xC073, 0xC074, 0xC075, 0xC076, 0xC077, 0xC078, 0xC079, 0xC07A, 0xC081, 0xC082, 0xC083, 0xC084, 0xC7C7, 0xC7C8, 0xC085, 0xC086,
+	0xC7C9, 0xC087, 0xC088, 0xC089, 0xC7CA, 0xC08A, 0xC08B, 0xC08C, 0xC08D, 0xC08E, 0xC08F, 0xC090, 0xC7CB, 0xC7CC, 0xC091, 0xC7CD,
+	0xC092, 0xC7CE, 0xC093, 0xC094, 0xC095, 0xC096, 0xC097, 0xC098, 0xC7CF, 0xC7D0, 0xC099, 0xC09A, 0xC7D1, 0xC09B, 0xC09C, 0xC09D,
+	0xC7D2, 0xC09E, 0xC09F, 0xC0A0, 0xC141, 0xC7D3, 0xC142, 0xC143, 0xC7D4, 0xC7D5, 0xC144, 0xC7D6, 0xC145, 0xC7D7, 0xC146, 0xC147,
+	0xC148, 0xC149, 0xC14A, 0xC14B, 0xC7D8, 0xC7D9, 0xC14C, 0xC14D, 0xC7DA, 0xC14E, 0xC14F, 0xC150, 0xC7DB, 0xC151, 0xC152, 0xC153,
+	0xC154, 0xC155, 0xC156, 0xC157, 0xC7DC, 0xC7DD, 0xC158, 0xC7DE, 0xC7DF, 0xC7E0, 0xC159, 0xC15A, 0xC161, 0xC162, 0xC163, 0xC164,
+	0xC7E1, 0xC165, 0xC166, 0xC167, 0xC168, 0xC169, 0xC16A, 0xC16B, 0xC16C, 0xC16D, 0xC16E, 0xC16F, 0xC170, 0xC171, 0xC172, 0xC173,
+	0xC174, 0xC175, 0xC176, 0xC177, 0xC178, 0xC7E2, 0xC179, 0xC17A, 0xC181, 0xC182, 0xC183, 0xC184, 0xC185, 0xC186, 0xC187, 0xC188,
+	0xC189, 0xC18A, 0xC18B, 0xC18C, 0xC18D, 0xC18E, 0xC18F, 0xC190, 0xC191, 0xC192, 0xC193, 0xC194, 0xC195, 0xC196, 0xC197, 0xC198,
+	0xC199, 0xC19A, 0xC19B, 0xC19C, 0xC19D, 0xC19E, 0xC19F, 0xC1A0, 0xC7E3, 0xC7E4, 0xC241, 0xC242, 0xC7E5, 0xC243, 0xC244, 0xC245,
+	0xC7E6, 0xC246, 0xC7E7, 0xC247, 0xC248, 0xC249, 0xC24A, 0xC24B, 0xC7E8, 0xC7E9, 0xC24C, 0xC7EA, 0xC24D, 0xC7EB, 0xC24E, 0xC24F,
+	0xC250, 0xC251, 0xC252, 0xC253, 0xC7EC, 0xC7ED, 0xC254, 0xC255, 0xC7EE, 0xC256, 0xC257, 0xC258, 0xC7EF, 0xC259, 0xC25A, 0xC261,
+	0xC262, 0xC263, 0xC264, 0xC265, 0xC7F0, 0xC7F1, 0xC266, 0xC7F2, 0xC267, 0xC7F3, 0xC268, 0xC269, 0xC26A, 0xC26B, 0xC26C, 0xC26D,
+	0xC7F4, 0xC7F5, 0xC26E, 0xC26F, 0xC7F6, 0xC270, 0xC271, 0xC272, 0xC7F7, 0xC273, 0xC274, 0xC275, 0xC276, 0xC277, 0xC278, 0xC279,
+	0xC7F8, 0xC7F9, 0xC27A, 0xC7FA, 0xC7FB, 0xC7FC, 0xC281, 0xC282, 0xC283, 0xC284, 0xC285, 0xC286, 0xC7FD, 0xC287, 0xC288, 0xC289,
+	0xC7FE, 0xC28A, 0xC28B, 0xC28C, 0xC8A1, 0xC28D, 0xC28E, 0xC28F, 0xC290, 0xC291, 0xC292, 0xC293, 0xC294, 0xC8A2, 0xC295, 0xC296,
+	0xC297, 0xC298, 0xC299, 0xC29A, 0xC29B, 0xC29C, 0xC29D, 0xC29E, 0xC8A3, 0xC8A4, 0xC29F, 0xC2A0, 0xC8A5, 0xC341, 0xC342, 0xC343,
+	0xC8A6, 0xC344, 0xC345, 0xC346, 0xC347, 0xC8A7, 0xC348, 0xC349, 0xC8A8, 0xC8A9, 0xC34A, 0xC8AA, 0xC34B, 0xC8AB, 0xC34C, 0xC34D,
+	0xC34E, 0xC8AC, 0xC34F, 0xC350, 0xC8AD, 0xC8AE, 0xC351, 0xC352, 0xC8AF, 0xC353, 0xC354, 0xC355, 0xC8B0, 0xC356, 0xC357, 0xC358,
+	0xC359, 0xC35A, 0xC361, 0xC362, 0xC363, 0xC364, 0xC365, 0xC8B1, 0xC366, 0xC8B2, 0xC367, 0xC368, 0xC369, 0xC36A, 0xC36B, 0xC36C,
+	0xC8B3, 0xC8B4, 0xC36D, 0xC36E, 0xC8B5, 0xC36F, 0xC370, 0xC371, 0xC372, 0xC373, 0xC374, 0xC375, 0xC376, 0xC377, 0xC378, 0xC379,
+	0xC37A, 0xC381, 0xC382, 0xC8B6, 0xC383, 0xC8B7, 0xC384, 0xC385, 0xC386, 0xC387, 0xC388, 0xC389, 0xC8B8, 0xC8B9, 0xC38A, 0xC38B,
+	0xC8BA, 0xC38C, 0xC38D, 0xC38E, 0xC8BB, 0xC38F, 0xC390, 0xC391, 0xC392, 0xC393, 0xC394, 0xC395, 0xC396, 0xC8BC, 0xC397, 0xC8BD,
+	0xC398, 0xC8BE, 0xC399, 0xC39A, 0xC39B, 0xC39C, 0xC39D, 0xC39E, 0xC8BF, 0xC39F, 0xC3A0, 0xC441, 0xC8C0, 0xC442, 0xC443, 0xC444,
+	0xC8C1, 0xC445, 0xC446, 0xC447, 0xC448, 0xC449, 0xC44A, 0xC44B, 0xC44C, 0xC8C2, 0xC44D, 0xC8C3, 0xC44E, 0xC44F, 0xC450, 0xC451,
+	0xC452, 0xC453, 0xC454, 0xC455, 0xC8C4, 0xC8C5, 0xC456, 0xC457, 0xC8C6, 0xC458, 0xC459, 0xC45A, 0xC8C7, 0xC461, 0xC462, 0xC463,
+	0xC464, 0xC8C8, 0xC465, 0xC466, 0xC8C9, 0xC467, 0xC468, 0xC8CA, 0xC469, 0xC8CB, 0xC46A, 0xC46B, 0xC46C, 0xC46D, 0xC46E, 0xC46F,
+	0xC8CC, 0xC470, 0xC471, 0xC472, 0xC8CD, 0xC473, 0xC474, 0xC475, 0xC8CE, 0xC476, 0xC477, 0xC478, 0xC479, 0xC47A, 0xC481, 0xC482,
+	0xC8CF, 0xC483, 0xC484, 0xC485, 0xC486, 0xC8D0, 0xC487, 0xC488, 0xC489, 0xC48A, 0xC48B, 0xC48C, 0xC8D1, 0xC8D2, 0xC48D, 0xC48E,
+	0xC8D3, 0xC48F, 0xC490, 0xC491, 0xC8D4, 0xC492, 0xC493, 0xC494, 0xC495, 0xC496, 0xC497, 0xC498, 0xC499, 0xC49A, 0xC49B, 0xC49C,
+	0xC49D, 0xC8D5, 0xC49E, 0xC49F, 0xC4A0, 0xC541, 0xC542, 0xC543, 0xC8D6, 0xC8D7, 0xC544, 0xC545, 0xC8D8, 0xC546, 0xC547, 0xC548,
+	0xC8D9, 0xC549, 0xC54A, 0xC54B, 0xC54C, 0xC54D, 0xC54E, 0xC54F, 0xC8DA, 0xC8DB, 0xC550, 0xC8DC, 0xC551, 0xC8DD, 0xC552, 0xC553,
+	0xC554, 0xC555, 0xC556, 0xC557, 0xC8DE, 0xC8DF, 0xC558, 0xC559, 0xC8E0, 0xC55A, 0xC561, 0xC562, 0xC8E1, 0xC563, 0xC564, 0xC565,
+	0xC566, 0xC567, 0xC568, 0xC569, 0xC8E2, 0xC56A, 0xC56B, 0xC8E3, 0xC56C, 0xC8E4, 0xC56D, 0xC56E, 0xC56F, 0xC570, 0xC571, 0xC572,
+	0xC8E5, 0xC8E6, 0xC573, 0xC574, 0xC8E7, 0xC575, 0xC8E8, 0xC8E9, 0xC8EA, 0xC8EB, 0xC576, 0xC577, 0xC578, 0xC579, 0xC57A, 0xC581,
+	0xC8EC, 0xC8ED, 0xC582, 0xC8EE, 0xC583, 0xC8EF, 0xC584, 0xC585, 0xC586, 0xC8F0, 0xC587, 0xC588, 0xC8F1, 0xC589, 0xC58A, 0xC58B,
+	0xC8F2, 0xC58C, 0xC58D, 0xC58E, 0xC8F3, 0xC58F, 0xC590, 0xC591, 0xC592, 0xC593, 0xC594, 0xC595, 0xC8F4, 0xC8F5, 0xC596, 0xC597,
+	0xC598, 0xC8F6, 0xC599, 0xC59A, 0xC59B, 0xC59C, 0xC59D, 0xC59E, 0xC8F7, 0xC8F8, 0xC59F, 0xC5A0, 0xC8F9, 0xC641, 0xC642, 0xC643,
+	0xC8FA, 0xC644, 0xC645, 0xC646, 0xC647, 0xC648, 0xC649, 0xC64A, 0xC8FB, 0xC8FC, 0xC64B, 0xC8FD, 0xC64C, 0xC8FE, 0xC64D, 0xC64E,
+	0xC64F, 0xC650, 0xC651, 0xC652, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCBD0, 0xCBD6, 0xCBE7, 0xCDCF, 0xCDE8, 0xCEAD, 0xCFFB, 0xD0A2, 0xD0B8, 0xD0D0, 0xD0DD, 0xD1D4, 0xD1D5, 0xD1D8, 0xD1DB, 0xD1DC,
+	0xD1DD, 0xD1DE, 0xD1DF, 0xD1E0, 0xD1E2, 0xD1E3, 0xD1E4, 0xD1E5, 0xD1E6, 0xD1E8, 0xD1E9, 0xD1EA, 0xD1EB, 0xD1ED, 0xD1EF, 0xD1F0,
+	0xD1F2, 0xD1F6, 0xD1FA, 0xD1FC, 0xD1FD, 0xD1FE, 0xD2A2, 0xD2A3, 0xD2A7, 0xD2A8, 0xD2A9, 0xD2AA, 0xD2AB, 0xD2AD, 0xD2B2, 0xD2BE,
+	0xD2C2, 0xD2C3, 0xD2C4, 0xD2C6, 0xD2C7, 0xD2C8, 0xD2C9, 0xD2CA, 0xD2CB, 0xD2CD, 0xD2CE, 0xD2CF, 0xD2D0, 0xD2D1, 0xD2D2, 0xD2D3,
+	0xD2D4, 0xD2D5, 0xD2D6, 0xD2D7, 0xD2D9, 0xD2DA, 0xD2DE, 0xD2DF, 0xD2E1, 0xD2E2, 0xD2E4, 0xD2E5, 0xD2E6, 0xD2E7, 0xD2E8, 0xD2E9,
+	0xD2EA, 0xD2EB, 0xD2F0, 0xD2F1, 0xD2F2, 0xD2F3, 0xD2F4, 0xD2F5, 0xD2F7, 0xD2F8, 0xD4E6, 0xD4FC, 0xD5A5, 0xD5AB, 0xD5AE, 0xD6B8,
+	0xD6CD, 0xD7CB, 0xD7E4, 0xDBC5, 0xDBE4, 0xDCA5, 0xDDA5, 0xDDD5, 0xDDF4, 0xDEFC, 0xDEFE, 0xDFB3, 0xDFE1, 0xDFE8, 0xE0F1, 0xE1AD,
+	0xE1ED, 0xE3F5, 0xE4A1, 0xE4A9, 0xE5AE, 0xE5B1, 0xE5B2, 0xE5B9, 0xE5BB, 0xE5BC, 0xE5C4, 0xE5CE, 0xE5D0, 0xE5D2, 0xE5D6, 0xE5FA,
+	0xE5FB, 0xE5FC, 0xE5FE, 0xE6A1, 0xE6A4, 0xE6A7, 0xE6AD, 0xE6AF, 0xE6B0, 0xE6B1, 0xE6B3, 0xE6B7, 0xE6B8, 0xE6BC, 0xE6C4, 0xE6C6,
+	0xE6C7, 0xE6CA, 0xE6D2, 0xE6D6, 0xE6D9, 0xE6DC, 0xE6DF, 0xE6E1, 0xE6E4, 0xE6E5, 0xE6E6, 0xE6E8, 0xE6EA, 0xE6EB, 0xE6EC, 0xE6EF,
+	0xE6F1, 0xE6F2, 0xE6F5, 0xE6F6, 0xE6F7, 0xE6F9, 0xE7A1, 0xE7A6, 0xE7A9, 0xE7AA, 0xE7AC, 0xE7AD, 0xE7B0, 0xE7BF, 0xE7C1, 0xE7C6,
+	0xE7C7, 0xE7CB, 0xE7CD, 0xE7CF, 0xE7D0, 0xE7D3, 0xE7DF, 0xE7E4, 0xE7E6, 0xE7F7, 0xE8E7, 0xE8E8, 0xE8F0, 0xE8F1, 0xE8F7, 0xE8F9,
+	0xE8FB, 0xE8FE, 0xE9A7, 0xE9AC, 0xE9CC, 0xE9F7, 0xEAC1, 0xEAE5, 0xEAF4, 0xEAF7, 0xEAFC, 0xEAFE, 0xEBA4, 0xEBA7, 0xEBA9, 0xEBAA,
+	0xEBBA, 0xEBBB, 0xEBBD, 0xEBC1, 0xEBC2, 0xEBC6, 0xEBC7, 0xEBCC, 0xEBCF, 0xEBD0, 0xEBD1, 0xEBD2, 0xEBD8, 0xECA6, 0xECA7, 0xECAA,
+	0xECAF, 0xECB0, 0xECB1, 0xECB2, 0xECB5, 0xECB8, 0xECBA, 0xECC0, 0xECC1, 0xECC5, 0xECC6, 0xECC9, 0xECCA, 0xECD5, 0xECDD, 0xECDE,
+	0xECE1, 0xECE4, 0xECE7, 0xECE8, 0xECF7, 0xECF8, 0xECFA, 0xEDA1, 0xEDA2, 0xEDA3, 0xEDEE, 0xEEDB, 0xF2BD, 0xF2FA, 0xF3B1, 0xF4A7,
+	0xF4EE, 0xF6F4, 0xF6F6, 0xF7B8, 0xF7C8, 0xF7D3, 0xF8DB, 0xF8F0, 0xFAA1, 0xFAA2, 0xFAE6, 0xFCA9, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA3A1, 0xA3A2, 0xA3A3, 0xA3A4, 0xA3A5, 0xA3A6, 0xA3A7, 0xA3A8, 0xA3A9, 0xA3AA, 0xA3AB, 0xA3AC, 0xA3AD, 0xA3AE, 0xA3AF,
+	0xA3B0, 0xA3B1, 0xA3B2, 0xA3B3, 0xA3B4, 0xA3B5, 0xA3B6, 0xA3B7, 0xA3B8, 0xA3B9, 0xA3BA, 0xA3BB, 0xA3BC, 0xA3BD, 0xA3BE, 0xA3BF,
+	0xA3C0, 0xA3C1, 0xA3C2, 0xA3C3, 0xA3C4, 0xA3C5, 0xA3C6, 0xA3C7, 0xA3C8, 0xA3C9, 0xA3CA, 0xA3CB, 0xA3CC, 0xA3CD, 0xA3CE, 0xA3CF,
+	0xA3D0, 0xA3D1, 0xA3D2, 0xA3D3, 0xA3D4, 0xA3D5, 0xA3D6, 0xA3D7, 0xA3D8, 0xA3D9, 0xA3DA, 0xA3DB, 0xA1AC, 0xA3DD, 0xA3DE, 0xA3DF,
+	0xA3E0, 0xA3E1, 0xA3E2, 0xA3E3, 0xA3E4, 0xA3E5, 0xA3E6, 0xA3E7, 0xA3E8, 0xA3E9, 0xA3EA, 0xA3EB, 0xA3EC, 0xA3ED, 0xA3EE, 0xA3EF,
+	0xA3F0, 0xA3F1, 0xA3F2, 0xA3F3, 0xA3F4, 0xA3F5, 0xA3F6, 0xA3F7, 0xA3F8, 0xA3F9, 0xA3FA, 0xA3FB, 0xA3FC, 0xA3FD, 0xA2A6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1CB, 0xA1CC, 0xA1FE, 0xA3FE, 0x0000, 0xA1CD, 0xA3DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+#endif
 
 static const WCHAR oem2uni949[] = {	/* Korean --> Unicode pairs */
 	0x8141, 0xAC02, 0x8142, 0xAC03, 0x8143, 0xAC05, 0x8144, 0xAC06,	0x8145, 0xAC0B, 0x8146, 0xAC0C, 0x8147, 0xAC0D, 0x8148, 0xAC0E,
@@ -11622,6 +17068,7 @@ static const WCHAR oem2uni949[] = {	/* Korean --> Unicode pairs */
 #endif
 
 #if FF_CODE_PAGE == 950 || FF_CODE_PAGE == 0	/* Traditional Chinese */
+#if FF_UNI2OEM_MAP < 2
 static const WCHAR uni2oem950[] = {	/* Unicode --> Big5 pairs */
 	0x00A7, 0xA1B1, 0x00AF, 0xA1C2, 0x00B0, 0xA258, 0x00B1, 0xA1D3,	0x00B7, 0xA150, 0x00D7, 0xA1D1, 0x00F7, 0xA1D2, 0x02C7, 0xA3BE,
 	0x02C9, 0xA3BC, 0x02CA, 0xA3BD, 0x02CB, 0xA3BF, 0x02CD, 0xA1C5,	0x02D9, 0xA3BB, 0x0391, 0xA344, 0x0392, 0xA345, 0x0393, 0xA346,
@@ -13312,6 +18759,1484 @@ static const WCHAR uni2oem950[] = {	/* Unicode --> Big5 pairs */
 	0xFF54, 0xA2FC, 0xFF55, 0xA2FD, 0xFF56, 0xA2FE, 0xFF57, 0xA340,	0xFF58, 0xA341, 0xFF59, 0xA342, 0xFF5A, 0xA343, 0xFF5B, 0xA161,
 	0xFF5C, 0xA155, 0xFF5D, 0xA162, 0xFF5E, 0xA1E3, 0xFFE0, 0xA246,	0xFFE1, 0xA247, 0xFFE3, 0xA1C3, 0xFFE5, 0xA244, 0, 0
 };
+#else
+static const WORD u2oidx950[] = {	/* Unicode to OEM code map index (block number + 1 of each 64 code points, 0:no char) */
+	0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 4, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6, 0, 7, 0, 8, 9, 10, 0, 11, 12, 13, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	20, 0, 0, 0, 21, 0, 0, 0, 0, 0, 22, 0, 0, 0, 23, 24,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+	145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+	161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+	193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 0, 220, 221, 222, 223,
+	224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+	240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+	256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 0,
+	271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+	287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+	303, 304, 305, 0, 0, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+	317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332,
+	333, 334, 0, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 347, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 348, 349, 0, 0, 350, 351, 0, 352
+};
+static const WCHAR u2oblk950[] = {	/* Unicode to OEM code map blocks (64 code points each, 0:no char) */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1C2,
+	0xA258, 0xA1D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA150, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3BE, 0x0000, 0xA3BC, 0xA3BD, 0xA3BF, 0x0000, 0xA1C5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA344, 0xA345, 0xA346, 0xA347, 0xA348, 0xA349, 0xA34A, 0xA34B, 0xA34C, 0xA34D, 0xA34E, 0xA34F, 0xA350, 0xA351, 0xA352,
+	0xA353, 0xA354, 0x0000, 0xA355, 0xA356, 0xA357, 0xA358, 0xA359, 0xA35A, 0xA35B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA35C, 0xA35D, 0xA35E, 0xA35F, 0xA360, 0xA361, 0xA362, 0xA363, 0xA364, 0xA365, 0xA366, 0xA367, 0xA368, 0xA369, 0xA36A,
+	0xA36B, 0xA36C, 0x0000, 0xA36D, 0xA36E, 0xA36F, 0xA370, 0xA371, 0xA372, 0xA373, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA156, 0xA158, 0x0000, 0x0000, 0x0000, 0xA1A5, 0xA1A6, 0x0000, 0x0000, 0xA1A7, 0xA1A8, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA14C, 0xA14B, 0xA145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1AC, 0x0000, 0x0000, 0xA1AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1B0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3E1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA24A, 0x0000, 0xA1C1, 0x0000, 0x0000, 0x0000, 0xA24B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA2B9, 0xA2BA, 0xA2BB, 0xA2BC, 0xA2BD, 0xA2BE, 0xA2BF, 0xA2C0, 0xA2C1, 0xA2C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1F6, 0xA1F4, 0xA1F7, 0xA1F5, 0x0000, 0x0000, 0xA1F8, 0xA1F9, 0xA1FB, 0xA1FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA241, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D4, 0x0000, 0x0000, 0x0000, 0xA1DB, 0xA1E8,
+	0xA1E7, 0x0000, 0x0000, 0xA1FD, 0x0000, 0xA1FC, 0x0000, 0x0000, 0x0000, 0xA1E4, 0xA1E5, 0xA1EC, 0x0000, 0x0000, 0xA1ED, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA1EF, 0xA1EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1DC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1DA, 0xA1DD, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D8, 0xA1D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1F2, 0x0000, 0x0000, 0x0000, 0xA1F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1E9,
+	0xA277, 0x0000, 0xA278, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA27A, 0x0000, 0x0000, 0x0000,
+	0xA27B, 0x0000, 0x0000, 0x0000, 0xA27C, 0x0000, 0x0000, 0x0000, 0xA27D, 0x0000, 0x0000, 0x0000, 0xA275, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA274, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA273, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA272, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA271, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF9F9, 0xF9F8, 0xF9E6, 0xF9EF, 0xF9DD, 0xF9E8, 0xF9F1, 0xF9DF, 0xF9EC, 0xF9F5, 0xF9E3, 0xF9EE, 0xF9F7, 0xF9E5, 0xF9E9, 0xF9F2,
+	0xF9E0, 0xA2A7, 0xF9F4, 0xF9E2, 0xF9E7, 0xF9F0, 0xF9DE, 0xF9ED, 0xF9F6, 0xF9E4, 0xA2A6, 0xF9F3, 0xF9E1, 0xA27E, 0xA2A1, 0xF9FD,
+	0xF9FC, 0xA2AC, 0xA2AD, 0xA2AE, 0xA15A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA262, 0xA263, 0xA264, 0xA265, 0xA266, 0xA267, 0xA268, 0xA269, 0xA270, 0xA26F, 0xA26E, 0xA26D, 0xA26C, 0xA26B, 0xA26A,
+	0x0000, 0x0000, 0x0000, 0xF9FE, 0xA276, 0xA279, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1BD, 0xA1BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA1B6, 0xA1B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1BF, 0xA1BE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1BB, 0xA1BA, 0x0000, 0x0000, 0x0000, 0xA1B3, 0x0000, 0x0000, 0xA1B7, 0xA1B4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA2A8, 0xA2A9, 0xA2AB, 0xA2AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1B9, 0xA1B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA1F0, 0x0000, 0xA1F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA140, 0xA142, 0xA143, 0xA1B2, 0x0000, 0x0000, 0x0000, 0x0000, 0xA171, 0xA172, 0xA16D, 0xA16E, 0xA175, 0xA176, 0xA179, 0xA17A,
+	0xA169, 0xA16A, 0xA245, 0x0000, 0xA165, 0xA166, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1A9, 0xA1AA, 0x0000,
+	0x0000, 0xA2C3, 0xA2C4, 0xA2C5, 0xA2C6, 0xA2C7, 0xA2C8, 0xA2C9, 0xA2CA, 0xA2CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA374, 0xA375, 0xA376, 0xA377, 0xA378, 0xA379, 0xA37A, 0xA37B, 0xA37C, 0xA37D, 0xA37E,
+	0xA3A1, 0xA3A2, 0xA3A3, 0xA3A4, 0xA3A5, 0xA3A6, 0xA3A7, 0xA3A8, 0xA3A9, 0xA3AA, 0xA3AB, 0xA3AC, 0xA3AD, 0xA3AE, 0xA3AF, 0xA3B0,
+	0xA3B1, 0xA3B2, 0xA3B3, 0xA3B4, 0xA3B5, 0xA3B6, 0xA3B7, 0xA3B8, 0xA3B9, 0xA3BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA1C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA255, 0xA256,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA250, 0xA251, 0xA252, 0x0000,
+	0x0000, 0xA254, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA257, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA253, 0x0000,
+	0x0000, 0xA1EB, 0xA1EA, 0x0000, 0x0000, 0xA24F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA440, 0xA442, 0x0000, 0xA443, 0x0000, 0x0000, 0x0000, 0xC945, 0xA456, 0xA454, 0xA457, 0xA455, 0xC946, 0xA4A3, 0xC94F, 0xC94D,
+	0xA4A2, 0xA4A1, 0x0000, 0x0000, 0xA542, 0xA541, 0xA540, 0x0000, 0xA543, 0xA4FE, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5E0, 0xA5E1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8C3, 0x0000, 0x0000, 0x0000, 0x0000, 0xA458, 0x0000, 0xA4A4, 0xC950, 0x0000,
+	0xA4A5, 0xC963, 0xA6EA, 0xCBB1, 0x0000, 0x0000, 0x0000, 0x0000, 0xA459, 0xA4A6, 0x0000, 0xA544, 0xC964, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xC940, 0xA444, 0x0000, 0xA45B, 0x0000, 0xC947, 0xA45C, 0x0000, 0x0000, 0xA4A7, 0x0000, 0xA545, 0xA547, 0xA546,
+	0x0000, 0x0000, 0xA5E2, 0xA5E3, 0x0000, 0x0000, 0xA8C4, 0x0000, 0xADBC, 0xA441, 0x0000, 0x0000, 0xC941, 0xA445, 0xA45E, 0xA45D,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xA8C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0AE, 0xD44B,
+	0x0000, 0x0000, 0xB6C3, 0xDCB1, 0xDCB2, 0x0000, 0xA446, 0x0000, 0xA4A9, 0x0000, 0x0000, 0xA8C6, 0xA447, 0xC948, 0xA45F, 0x0000,
+	0x0000, 0xA4AA, 0xA4AC, 0xC951, 0xA4AD, 0xA4AB, 0x0000, 0x0000, 0x0000, 0xA5E5, 0x0000, 0xA8C7, 0x0000, 0x0000, 0xA8C8, 0xAB45,
+	0x0000, 0xA460, 0xA4AE, 0x0000, 0xA5E6, 0xA5E8, 0xA5E7, 0x0000, 0xA6EB, 0x0000, 0x0000, 0xA8C9, 0xA8CA, 0xAB46, 0xAB47, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xADBD, 0x0000, 0x0000, 0xDCB3, 0x0000, 0x0000, 0xF6D6, 0xA448, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA4B0, 0xA4AF, 0xC952, 0xA4B1, 0xA4B7, 0x0000, 0xA4B2, 0xA4B3, 0xC954, 0xC953, 0xA4B5, 0xA4B6, 0x0000, 0xA4B4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA54A, 0xA54B, 0xA54C, 0xA54D, 0xA549, 0xA550, 0xC96A, 0x0000, 0xC966, 0xC969, 0xA551, 0xA561,
+	0x0000, 0xC968, 0x0000, 0xA54E, 0xA54F, 0xA548, 0x0000, 0x0000, 0xC965, 0xC967, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA5F5, 0xC9B0, 0xA5F2, 0xA5F6, 0xC9BA, 0xC9AE, 0xA5F3, 0xC9B2, 0x0000, 0x0000, 0x0000, 0xA5F4, 0x0000, 0xA5F7, 0x0000, 0xA5E9,
+	0xC9B1, 0xA5F8, 0xC9B5, 0x0000, 0xC9B9, 0xC9B6, 0x0000, 0x0000, 0xC9B3, 0xA5EA, 0xA5EC, 0xA5F9, 0x0000, 0xA5EE, 0xC9AB, 0xA5F1,
+	0xA5EF, 0xA5F0, 0xC9BB, 0xC9B8, 0xC9AF, 0xA5ED, 0x0000, 0x0000, 0xC9AC, 0xA5EB, 0x0000, 0x0000, 0x0000, 0xC9B4, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xC9B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC9AD, 0xCA66, 0x0000, 0xA742,
+	0xA6F4, 0x0000, 0x0000, 0xCA67, 0xA6F1, 0x0000, 0xA744, 0x0000, 0xA6F9, 0x0000, 0xA6F8, 0xCA5B, 0xA6FC, 0xA6F7, 0xCA60, 0xCA68,
+	0x0000, 0xCA64, 0x0000, 0xA6FA, 0x0000, 0x0000, 0xA6FD, 0xA6EE, 0xA747, 0xCA5D, 0x0000, 0x0000, 0xCBBD, 0xA6EC, 0xA743, 0xA6ED,
+	0xA6F5, 0xA6F6, 0xCA62, 0xCA5E, 0xA6FB, 0xA6F3, 0xCA5A, 0xA6EF, 0xCA65, 0xA745, 0xA748, 0xA6F2, 0xA740, 0xA746, 0xA6F0, 0xCA63,
+	0xA741, 0xCA69, 0xCA5C, 0xA6FE, 0xCA5F, 0x0000, 0x0000, 0xCA61, 0x0000, 0xA8D8, 0xCBBF, 0xCBCB, 0xA8D0, 0x0000, 0xCBCC, 0xA8CB,
+	0xA8D5, 0x0000, 0x0000, 0xA8CE, 0xCBB9, 0xA8D6, 0xCBB8, 0xCBBC, 0xCBC3, 0xCBC1, 0xA8DE, 0xA8D9, 0xCBB3, 0xCBB5, 0xA8DB, 0xA8CF,
+	0xCBB6, 0xCBC2, 0xCBC9, 0xA8D4, 0xCBBB, 0xCBB4, 0xA8D3, 0xCBB7, 0xA8D7, 0xCBBA, 0x0000, 0xA8D2, 0x0000, 0xA8CD, 0x0000, 0xA8DC,
+	0xCBC4, 0xA8DD, 0xCBC8, 0x0000, 0xCBC6, 0xCBCA, 0xA8DA, 0xCBBE, 0xCBB2, 0x0000, 0xCBC0, 0xA8D1, 0xCBC5, 0xA8CC, 0xCBC7, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAB56, 0xAB4A,
+	0x0000, 0x0000, 0xCDE0, 0xCDE8, 0x0000, 0xAB49, 0xAB51, 0xAB5D, 0x0000, 0xCDEE, 0xCDEC, 0xCDE7, 0x0000, 0x0000, 0x0000, 0xAB4B,
+	0xCDED, 0xCDE3, 0xAB59, 0xAB50, 0xAB58, 0xCDDE, 0x0000, 0xCDEA, 0x0000, 0xCDE1, 0xAB54, 0xCDE2, 0x0000, 0xCDDD, 0xAB5B, 0xAB4E,
+	0xAB57, 0xAB4D, 0x0000, 0xCDDF, 0xCDE4, 0x0000, 0xCDEB, 0xAB55, 0xAB52, 0xCDE6, 0xAB5A, 0xCDE9, 0xCDE5, 0xAB4F, 0xAB5C, 0xAB53,
+	0xAB4C, 0xAB48, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDEF, 0x0000, 0xADD7, 0xADC1,
+	0x0000, 0xADD1, 0x0000, 0xADD6, 0xD0D0, 0xD0CF, 0xD0D4, 0xD0D5, 0xADC4, 0x0000, 0xADCD, 0x0000, 0x0000, 0x0000, 0xADDA, 0x0000,
+	0xADCE, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0C9, 0xADC7, 0xD0CA, 0x0000, 0xADDC, 0x0000, 0xADD3, 0xADBE, 0xADBF, 0xD0DD, 0xB0BF,
+	0x0000, 0xADCC, 0xADCB, 0xD0CB, 0xADCF, 0xD45B, 0xADC6, 0xD0D6, 0xADD5, 0xADD4, 0xADCA, 0xD0CE, 0xD0D7, 0x0000, 0xD0C8, 0xADC9,
+	0xD0D8, 0xADD2, 0xD0CC, 0xADC0, 0x0000, 0xADC3, 0xADC2, 0xD0D9, 0xADD0, 0xADC5, 0xADD9, 0xADDB, 0xD0D3, 0xADD8, 0x0000, 0xD0DB,
+	0xD0CD, 0xD0DC, 0x0000, 0xD0D1, 0x0000, 0xD0DA, 0x0000, 0xD0D2, 0x0000, 0x0000, 0x0000, 0x0000, 0xADC8, 0x0000, 0x0000, 0x0000,
+	0xD463, 0xD457, 0x0000, 0xB0B3, 0x0000, 0xD45C, 0xD462, 0xB0B2, 0xD455, 0xB0B6, 0xD459, 0xD452, 0xB0B4, 0xD456, 0xB0B9, 0xB0BE,
+	0x0000, 0xD467, 0x0000, 0xD451, 0x0000, 0xB0BA, 0x0000, 0xD466, 0x0000, 0x0000, 0xB0B5, 0xD458, 0xB0B1, 0xD453, 0xD44F, 0xD45D,
+	0xD450, 0xD44E, 0xD45A, 0xD460, 0xD461, 0xB0B7, 0x0000, 0x0000, 0xD85B, 0xD45E, 0xD44D, 0xD45F, 0x0000, 0xB0C1, 0xD464, 0xB0C0,
+	0xD44C, 0x0000, 0xD454, 0xD465, 0xB0BC, 0xB0BB, 0xB0B8, 0xB0BD, 0x0000, 0x0000, 0xB0AF, 0x0000, 0x0000, 0xB0B0, 0x0000, 0x0000,
+	0xB3C8, 0x0000, 0xD85E, 0xD857, 0x0000, 0xB3C5, 0x0000, 0xD85F, 0x0000, 0x0000, 0x0000, 0xD855, 0xD858, 0xB3C4, 0xD859, 0x0000,
+	0x0000, 0xB3C7, 0xD85D, 0x0000, 0xD853, 0xD852, 0xB3C9, 0x0000, 0xB3CA, 0xB3C6, 0xB3CB, 0xD851, 0xD85C, 0xD85A, 0xD854, 0x0000,
+	0x0000, 0x0000, 0xB3C3, 0xD856, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6CA, 0xB6C4, 0xDCB7, 0xB6CD,
+	0xDCBD, 0xDCC0, 0xB6C6, 0xB6C7, 0xDCBA, 0xB6C5, 0xDCC3, 0xB6CB, 0xDCC4, 0x0000, 0xDCBF, 0xB6CC, 0x0000, 0xDCB4, 0xB6C9, 0xDCB5,
+	0x0000, 0xDCBE, 0xDCBC, 0x0000, 0xDCB8, 0xB6C8, 0xDCB6, 0xB6CE, 0xDCBB, 0xDCC2, 0xDCB9, 0xDCC1, 0x0000, 0x0000, 0xB9B6, 0xB9B3,
+	0x0000, 0xB9B4, 0x0000, 0xE0F9, 0xE0F1, 0xB9B2, 0xB9AF, 0xE0F2, 0x0000, 0x0000, 0xB9B1, 0xE0F5, 0x0000, 0xE0F7, 0x0000, 0x0000,
+	0xE0FE, 0x0000, 0x0000, 0xE0FD, 0xE0F8, 0xB9AE, 0xE0F0, 0xB9AC, 0xE0F3, 0xB9B7, 0xE0F6, 0x0000, 0xE0FA, 0xB9B0, 0xB9AD, 0xE0FC,
+	0xE0FB, 0xB9B5, 0x0000, 0xE0F4, 0x0000, 0xBBF8, 0xE4EC, 0x0000, 0xE4E9, 0xBBF9, 0x0000, 0xBBF7, 0x0000, 0xE4F0, 0xE4ED, 0xE4E6,
+	0xBBF6, 0x0000, 0xBBFA, 0xE4E7, 0xBBF5, 0xBBFD, 0xE4EA, 0xE4EB, 0xBBFB, 0xBBFC, 0xE4F1, 0xE4EE, 0xE4EF, 0x0000, 0x0000, 0x0000,
+	0xBEAA, 0xE8F8, 0xBEA7, 0xE8F5, 0xBEA9, 0xBEAB, 0x0000, 0xE8F6, 0xBEA8, 0x0000, 0xE8F7, 0x0000, 0xE8F4, 0x0000, 0x0000, 0xC076,
+	0xECBD, 0xC077, 0xECBB, 0x0000, 0xECBC, 0xECBA, 0xECB9, 0x0000, 0x0000, 0xECBE, 0xC075, 0x0000, 0x0000, 0xEFB8, 0xEFB9, 0x0000,
+	0xE4E8, 0xEFB7, 0xC078, 0xC35F, 0xF1EB, 0xF1EC, 0x0000, 0xC4D7, 0xC4D8, 0xF5C1, 0xF5C0, 0xC56C, 0xC56B, 0xF7D0, 0x0000, 0xA449,
+	0xA461, 0xA4B9, 0x0000, 0xA4B8, 0xA553, 0xA552, 0xA5FC, 0xA5FB, 0xA5FD, 0xA5FA, 0x0000, 0xA74A, 0xA749, 0xA74B, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA8E0, 0x0000, 0xA8DF, 0xA8E1, 0x0000, 0xAB5E, 0x0000, 0xA259, 0xD0DE, 0xA25A, 0xB0C2, 0xA25C, 0xA25B, 0xD860,
+	0x0000, 0xA25D, 0xB9B8, 0xA25E, 0x0000, 0xA44A, 0x0000, 0xA4BA, 0xA5FE, 0xA8E2, 0x0000, 0xA44B, 0xA4BD, 0xA4BB, 0xA4BC, 0x0000,
+	0x0000, 0xA640, 0x0000, 0x0000, 0x0000, 0xA74C, 0xA8E4, 0xA8E3, 0xA8E5, 0x0000, 0x0000, 0x0000, 0xADDD, 0x0000, 0x0000, 0x0000,
+	0xBEAC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC94E, 0x0000, 0xA554, 0xA555, 0x0000, 0x0000, 0xA641, 0x0000, 0xCA6A,
+	0x0000, 0xAB60, 0xAB5F, 0xD0E0, 0xD0DF, 0xB0C3, 0x0000, 0xA4BE, 0xC955, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBCD, 0x0000,
+	0xAB61, 0x0000, 0xADE0, 0x0000, 0xADDE, 0xADDF, 0x0000, 0x0000, 0x0000, 0x0000, 0xBEAD, 0x0000, 0xA556, 0x0000, 0x0000, 0x0000,
+	0xA642, 0xC9BC, 0x0000, 0x0000, 0x0000, 0x0000, 0xA74D, 0xA74E, 0x0000, 0xCA6B, 0x0000, 0x0000, 0xCBCE, 0xA8E6, 0xCBCF, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD0E2, 0xD0E3, 0xADE3, 0x0000, 0xD0E4, 0x0000, 0xD0E1, 0xADE4, 0xADE2, 0xADE1, 0xD0E5, 0x0000,
+	0xD468, 0x0000, 0x0000, 0x0000, 0xD861, 0x0000, 0x0000, 0xDCC5, 0xE140, 0x0000, 0x0000, 0x0000, 0xBBFE, 0xBEAE, 0xE8F9, 0x0000,
+	0xA44C, 0xA45A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xB0C4, 0xB3CD, 0x0000, 0xB9B9, 0x0000, 0xC942, 0xA4BF, 0x0000, 0xA559, 0xA557, 0xA558, 0x0000, 0x0000, 0xA8E7, 0x0000, 0x0000,
+	0xA44D, 0xA44E, 0x0000, 0xA462, 0x0000, 0x0000, 0xA4C0, 0xA4C1, 0xA4C2, 0xC9BE, 0xA55A, 0x0000, 0xC96B, 0x0000, 0xA646, 0x0000,
+	0xC9BF, 0xA644, 0xA645, 0xC9BD, 0x0000, 0x0000, 0xA647, 0xA643, 0x0000, 0x0000, 0x0000, 0x0000, 0xCA6C, 0xAAEC, 0xCA6D, 0x0000,
+	0x0000, 0xCA6E, 0x0000, 0x0000, 0xA750, 0xA74F, 0x0000, 0x0000, 0xA753, 0xA751, 0xA752, 0x0000, 0x0000, 0x0000, 0xA8ED, 0x0000,
+	0xA8EC, 0xCBD4, 0xCBD1, 0xCBD2, 0x0000, 0xCBD0, 0xA8EE, 0xA8EA, 0xA8E9, 0x0000, 0xA8EB, 0xA8E8, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA8EF, 0x0000, 0xAB63, 0xCDF0, 0x0000, 0xCBD3, 0xAB68, 0x0000, 0xCDF1, 0xAB64, 0xAB67, 0xAB66, 0xAB65, 0xAB62, 0x0000,
+	0x0000, 0x0000, 0xD0E8, 0x0000, 0xADE7, 0xD0EB, 0xADE5, 0x0000, 0x0000, 0x0000, 0xD0E7, 0xADE8, 0xADE6, 0xADE9, 0xD0E9, 0xD0EA,
+	0x0000, 0xD0E6, 0xD0EC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3D1, 0xB0C5, 0xD469, 0xD46B, 0xD46A, 0xD46C, 0xB0C6,
+	0x0000, 0x0000, 0xB3CE, 0x0000, 0xB3CF, 0xB3D0, 0x0000, 0xB6D0, 0xDCC7, 0x0000, 0xDCC6, 0xDCC8, 0xDCC9, 0xB6D1, 0x0000, 0xB6CF,
+	0xE141, 0xE142, 0xB9BB, 0xB9BA, 0xE35A, 0x0000, 0x0000, 0xBC40, 0xBC41, 0xBC42, 0xBC44, 0xE4F2, 0xE4F3, 0xBC43, 0x0000, 0x0000,
+	0x0000, 0xBEAF, 0x0000, 0xBEB0, 0x0000, 0x0000, 0xF1ED, 0xF5C3, 0xF5C2, 0xF7D1, 0x0000, 0xA44F, 0x0000, 0x0000, 0x0000, 0xA55C,
+	0xA55B, 0x0000, 0x0000, 0xA648, 0x0000, 0x0000, 0xC9C0, 0x0000, 0x0000, 0xA755, 0xA756, 0xA754, 0xA757, 0xCA6F, 0xCA70, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8F1, 0xCBD5, 0x0000, 0xA8F0, 0x0000,
+	0xCDF2, 0xAB6C, 0xCDF3, 0xAB6B, 0x0000, 0x0000, 0x0000, 0xAB69, 0x0000, 0xAB6A, 0x0000, 0x0000, 0x0000, 0xD0ED, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xB0C7, 0xD46E, 0x0000, 0xB0CA, 0xD46D, 0xB1E5, 0xB0C9, 0xB0C8, 0x0000, 0xB3D4, 0x0000, 0xB3D3, 0xB3D2, 0xB6D2,
+	0x0000, 0x0000, 0xB6D5, 0xB6D6, 0xB6D4, 0x0000, 0xB6D3, 0x0000, 0x0000, 0xE143, 0x0000, 0xE144, 0x0000, 0x0000, 0x0000, 0xE4F5,
+	0xBC45, 0xE4F4, 0x0000, 0xBEB1, 0xECBF, 0xC079, 0x0000, 0xF1EE, 0xC455, 0x0000, 0xA463, 0xA4C3, 0xC956, 0x0000, 0xA4C4, 0xA4C5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA55D, 0xA55E, 0x0000, 0xA649, 0xCA71, 0xCBD6, 0xCBD7, 0x0000, 0xAB6D, 0xD0EE, 0xB0CC,
+	0xB0CB, 0xD863, 0xD862, 0x0000, 0x0000, 0xA450, 0xA4C6, 0xA55F, 0x0000, 0xB0CD, 0xC943, 0x0000, 0xC96C, 0xA560, 0x0000, 0xC9C2,
+	0xA64B, 0xA64A, 0xC9C1, 0xA758, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xADEA, 0x0000, 0x0000, 0xD46F, 0x0000, 0xB6D7,
+	0xE145, 0xB9BC, 0x0000, 0x0000, 0xE8FA, 0x0000, 0x0000, 0xF3FD, 0x0000, 0xA4C7, 0x0000, 0x0000, 0xCBD8, 0xCDF4, 0xB0D0, 0xB0CE,
+	0xB0CF, 0xA2CC, 0x0000, 0xA464, 0xA2CD, 0xA2CE, 0x0000, 0xA4C9, 0xA4C8, 0xA563, 0xA562, 0x0000, 0xC96D, 0xC9C3, 0x0000, 0x0000,
+	0x0000, 0xA8F5, 0xA8F2, 0xA8F4, 0xA8F3, 0x0000, 0x0000, 0xAB6E, 0x0000, 0x0000, 0xB3D5, 0x0000, 0xA452, 0x0000, 0xA4CB, 0x0000,
+	0xA565, 0xA564, 0x0000, 0xCA72, 0x0000, 0x0000, 0xA8F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC957, 0x0000, 0xA567, 0xA566,
+	0xA64C, 0xA64D, 0xCA73, 0xA759, 0x0000, 0xA75A, 0x0000, 0xA8F7, 0xA8F8, 0xA8F9, 0x0000, 0xAB6F, 0xCDF5, 0x0000, 0x0000, 0xADEB,
+	0x0000, 0x0000, 0xC944, 0x0000, 0xA4CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC9C4, 0x0000, 0x0000, 0x0000, 0xCA74, 0xCA75,
+	0x0000, 0x0000, 0xCBD9, 0x0000, 0xCBDA, 0x0000, 0xCDF7, 0xCDF6, 0xCDF9, 0xCDF8, 0xAB70, 0x0000, 0xD470, 0xADED, 0xD0EF, 0xADEC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD864, 0xB3D6, 0x0000, 0xD865, 0x0000, 0x0000, 0x0000, 0x0000, 0xE146, 0xB9BD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xBC46, 0x0000, 0xF1EF, 0x0000, 0x0000, 0x0000, 0x0000, 0xC958, 0x0000, 0xA568, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xB0D1, 0x0000, 0x0000, 0x0000, 0x0000, 0xA453, 0xA465, 0xA4CE, 0xA4CD, 0x0000, 0xA4CF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA8FB, 0x0000, 0xA8FA, 0xA8FC, 0x0000, 0x0000, 0x0000, 0xAB71, 0x0000, 0x0000, 0x0000, 0xADEE,
+	0x0000, 0xE8FB, 0xC24F, 0xA466, 0xA56A, 0xA579, 0xA574, 0x0000, 0xA56F, 0xA56E, 0xA575, 0xA573, 0xA56C, 0xA57A, 0xA56D, 0xA569,
+	0xA578, 0xA577, 0xA576, 0xA56B, 0x0000, 0xA572, 0x0000, 0x0000, 0xA571, 0x0000, 0x0000, 0xA57B, 0xA570, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA653, 0x0000, 0xA659, 0xA655, 0x0000, 0xA65B, 0xC9C5, 0xA658, 0xA64E, 0xA651, 0xA654, 0xA650, 0xA657, 0xA65A, 0xA64F,
+	0xA652, 0xA656, 0xA65C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCA7E, 0xCA7B, 0x0000, 0xA767, 0xCA7C, 0xA75B, 0xA75D, 0xA775,
+	0xA770, 0x0000, 0x0000, 0x0000, 0xCAA5, 0xCA7D, 0xA75F, 0xA761, 0xCAA4, 0xA768, 0xCA78, 0xA774, 0xA776, 0xA75C, 0xA76D, 0x0000,
+	0xCA76, 0xA773, 0x0000, 0xA764, 0x0000, 0xA76E, 0xA76F, 0xCA77, 0xA76C, 0xA76A, 0x0000, 0xA76B, 0xA771, 0xCAA1, 0xA75E, 0x0000,
+	0xA772, 0xCAA3, 0xA766, 0xA763, 0x0000, 0xCA7A, 0xA762, 0xCAA6, 0xA765, 0x0000, 0xA769, 0x0000, 0x0000, 0x0000, 0xA760, 0xCAA2,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCA79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCBEB, 0xCBEA, 0xA94F, 0xCBED, 0xCBEF, 0xCBE4, 0xCBE7, 0xCBEE, 0xA950, 0x0000, 0x0000, 0xCBE1, 0xCBE5, 0x0000, 0x0000, 0xCBE9,
+	0xCE49, 0xA94B, 0xCE4D, 0xA8FD, 0xCBE6, 0xA8FE, 0xA94C, 0xA945, 0xA941, 0x0000, 0xCBE2, 0xA944, 0xA949, 0xA952, 0xCBE3, 0xCBDC,
+	0xA943, 0xCBDD, 0xCBDF, 0x0000, 0xA946, 0x0000, 0xA948, 0xCBDB, 0xCBE0, 0x0000, 0x0000, 0xA951, 0xA94D, 0xCBE8, 0xA953, 0x0000,
+	0xA94A, 0xCBDE, 0xA947, 0x0000, 0x0000, 0xA942, 0xA940, 0x0000, 0xCBEC, 0x0000, 0xA94E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCE48, 0xCDFB, 0xCE4B, 0x0000, 0x0000, 0xCDFD, 0xAB78, 0xABA8, 0xAB74, 0xABA7, 0xAB7D, 0xABA4, 0xAB72, 0xCDFC, 0xCE43, 0xABA3,
+	0xCE4F, 0xABA5, 0x0000, 0xAB79, 0x0000, 0x0000, 0xCE45, 0xCE42, 0xAB77, 0x0000, 0xCDFA, 0xABA6, 0xCE4A, 0xAB7C, 0xCE4C, 0xABA9,
+	0xAB73, 0xAB7E, 0xAB7B, 0xCE40, 0xABA1, 0xCE46, 0xCE47, 0xAB7A, 0xABA2, 0xAB76, 0x0000, 0x0000, 0x0000, 0x0000, 0xAB75, 0xCDFE,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE4E, 0x0000,
+	0xD144, 0xADFB, 0xD0F1, 0x0000, 0xD0F6, 0xADF4, 0xAE40, 0xD0F4, 0xADEF, 0xADF9, 0xADFE, 0xD0FB, 0x0000, 0xADFA, 0xADFD, 0x0000,
+	0x0000, 0xD0FE, 0xADF5, 0xD0F5, 0x0000, 0x0000, 0x0000, 0xD142, 0xD143, 0x0000, 0xADF7, 0xD141, 0xADF3, 0xAE43, 0x0000, 0xD0F8,
+	0x0000, 0xADF1, 0x0000, 0xD146, 0xD0F9, 0xD0FD, 0xADF6, 0xAE42, 0xD0FA, 0xADFC, 0xD140, 0xD147, 0xD4A1, 0x0000, 0xD145, 0xAE44,
+	0xADF0, 0xD0FC, 0xD0F3, 0x0000, 0xADF8, 0x0000, 0x0000, 0xD0F2, 0x0000, 0x0000, 0xD0F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0F0, 0xAE41, 0x0000, 0x0000, 0xD477, 0x0000, 0xB0E4, 0xD4A7, 0xB0E2, 0xB0DF,
+	0xD47C, 0xB0DB, 0xD4A2, 0xB0E6, 0xD476, 0xD47B, 0xD47A, 0xADF2, 0xB0E1, 0xD4A5, 0x0000, 0xD4A8, 0xD473, 0x0000, 0xB3E8, 0x0000,
+	0xD4A9, 0xB0E7, 0x0000, 0xB0D9, 0xB0D6, 0xD47E, 0xB0D3, 0x0000, 0xD4A6, 0x0000, 0xB0DA, 0xD4AA, 0x0000, 0xD474, 0xD4A4, 0xB0DD,
+	0xD475, 0xD478, 0xD47D, 0x0000, 0x0000, 0xB0DE, 0xB0DC, 0xB0E8, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0E3, 0x0000, 0xB0D7, 0xB1D2,
+	0x0000, 0xB0D8, 0xD479, 0xB0E5, 0xB0E0, 0xD4A3, 0xB0D5, 0x0000, 0x0000, 0x0000, 0xB0D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD471, 0xD472, 0xD86A, 0x0000, 0x0000, 0x0000, 0xB3D7, 0xB3DA, 0xD875, 0xB3EE, 0xD878,
+	0xB3D8, 0xD871, 0xB3DE, 0xB3E4, 0xB5BD, 0x0000, 0x0000, 0xB3E2, 0xD86E, 0xB3EF, 0xB3DB, 0xB3E3, 0xD876, 0xDCD7, 0xD87B, 0xD86F,
+	0x0000, 0xD866, 0xD873, 0xD86D, 0xB3E1, 0xD879, 0x0000, 0x0000, 0xB3DD, 0xB3F1, 0xB3EA, 0x0000, 0xB3DF, 0xB3DC, 0x0000, 0xB3E7,
+	0x0000, 0xD87A, 0xD86C, 0xD872, 0xD874, 0xD868, 0xD877, 0xB3D9, 0xD867, 0x0000, 0xB3E0, 0xB3F0, 0xB3EC, 0xD869, 0xB3E6, 0x0000,
+	0x0000, 0xB3ED, 0xB3E9, 0xB3E5, 0x0000, 0xD870, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3EB, 0x0000, 0x0000, 0x0000, 0xDCD5,
+	0xDCD1, 0x0000, 0xDCE0, 0xDCCA, 0xDCD3, 0xB6E5, 0xB6E6, 0xB6DE, 0xDCDC, 0xB6E8, 0xDCCF, 0xDCCE, 0xDCCC, 0xDCDE, 0xB6DC, 0xDCD8,
+	0xDCCD, 0xB6DF, 0xDCD6, 0xB6DA, 0xDCD2, 0xDCD9, 0xDCDB, 0x0000, 0x0000, 0xDCDF, 0xB6E3, 0xDCCB, 0xB6DD, 0xDCD0, 0x0000, 0xB6D8,
+	0x0000, 0xB6E4, 0xDCDA, 0xB6E0, 0xB6E1, 0xB6E7, 0xB6DB, 0xA25F, 0xB6D9, 0xDCD4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6E2,
+	0x0000, 0x0000, 0xDCDD, 0x0000, 0x0000, 0x0000, 0xB9CD, 0xB9C8, 0x0000, 0xE155, 0xE151, 0x0000, 0xE14B, 0xB9C2, 0xB9BE, 0xE154,
+	0xB9BF, 0xE14E, 0xE150, 0x0000, 0xE153, 0x0000, 0xB9C4, 0x0000, 0xB9CB, 0xB9C5, 0x0000, 0x0000, 0xE149, 0xB9C6, 0xB9C7, 0xE14C,
+	0xB9CC, 0x0000, 0xE14A, 0xE14F, 0xB9C3, 0xE148, 0xB9C9, 0xB9C1, 0x0000, 0x0000, 0x0000, 0xB9C0, 0xE14D, 0xE152, 0x0000, 0xB9CA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE147, 0x0000, 0xBC4D, 0xE547, 0x0000, 0xE544, 0x0000, 0xBC47, 0xBC53,
+	0xBC54, 0x0000, 0xBC4A, 0xE542, 0xBC4C, 0xE4F9, 0xBC52, 0x0000, 0xE546, 0xBC49, 0xE548, 0xBC48, 0x0000, 0xE543, 0xE545, 0xBC4B,
+	0xE541, 0xE4FA, 0xE4F7, 0x0000, 0x0000, 0xD86B, 0xE4FD, 0x0000, 0xE4F6, 0xE4FC, 0xE4FB, 0x0000, 0xE4F8, 0x0000, 0xBC4F, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xBC4E, 0x0000, 0x0000, 0x0000, 0xBC50, 0xE4FE, 0xBEB2, 0xE540, 0x0000, 0x0000, 0x0000, 0xE945, 0x0000,
+	0xE8FD, 0x0000, 0xBEBE, 0xE942, 0xBEB6, 0xBEBA, 0xE941, 0x0000, 0xBEB9, 0xBEB5, 0xBEB8, 0xBEB3, 0xBEBD, 0xE943, 0xE8FE, 0xBEBC,
+	0xE8FC, 0xBEBB, 0xE944, 0xE940, 0xBC51, 0x0000, 0xBEBF, 0xE946, 0xBEB7, 0xBEB4, 0x0000, 0x0000, 0x0000, 0x0000, 0xECC6, 0xECC8,
+	0xC07B, 0xECC9, 0xECC7, 0xECC5, 0xECC4, 0xC07D, 0xECC3, 0xC07E, 0x0000, 0x0000, 0x0000, 0x0000, 0xECC1, 0xECC2, 0xC07A, 0xC0A1,
+	0xC07C, 0x0000, 0x0000, 0xECC0, 0x0000, 0xC250, 0x0000, 0xEFBC, 0xEFBA, 0xEFBF, 0xEFBD, 0x0000, 0xEFBB, 0xEFBE, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC360, 0xF1F2, 0xF1F3, 0xC456, 0x0000, 0xF1F4, 0xF1F0, 0xF1F5, 0xF1F1, 0xC251, 0x0000,
+	0x0000, 0x0000, 0xF3FE, 0xF441, 0xC459, 0xF440, 0xC458, 0xC457, 0x0000, 0x0000, 0x0000, 0x0000, 0xC45A, 0xF5C5, 0xF5C6, 0x0000,
+	0xC4DA, 0xC4D9, 0xC4DB, 0xF5C4, 0x0000, 0xF6D8, 0xF6D7, 0x0000, 0xC56D, 0xC56F, 0xC56E, 0xF6D9, 0xC5C8, 0xF8A6, 0x0000, 0x0000,
+	0x0000, 0xC5F1, 0x0000, 0xF8A5, 0xF8EE, 0x0000, 0x0000, 0xC949, 0x0000, 0x0000, 0xA57D, 0xA57C, 0x0000, 0xA65F, 0xA65E, 0xC9C7,
+	0xA65D, 0xC9C6, 0x0000, 0x0000, 0xA779, 0xCAA9, 0x0000, 0xCAA8, 0x0000, 0x0000, 0xA777, 0xA77A, 0x0000, 0x0000, 0xCAA7, 0x0000,
+	0xA778, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBF0, 0x0000, 0xCBF1, 0xA954, 0x0000, 0x0000, 0x0000, 0x0000, 0xABAA,
+	0x0000, 0xD148, 0xD149, 0xAE45, 0xAE46, 0x0000, 0x0000, 0xD4AC, 0xB0E9, 0xB0EB, 0xD4AB, 0xB0EA, 0xD87C, 0xB3F2, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xB6E9, 0xB6EA, 0xDCE1, 0x0000, 0xB9CF, 0x0000, 0xB9CE, 0x0000, 0xE549, 0xE948, 0xE947, 0x0000, 0xF96B, 0xA467,
+	0xC959, 0x0000, 0xC96E, 0xC96F, 0x0000, 0x0000, 0x0000, 0x0000, 0xA662, 0xA666, 0xC9C9, 0x0000, 0xA664, 0xA663, 0xC9C8, 0xA665,
+	0xA661, 0x0000, 0x0000, 0xA660, 0xC9CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA7A6, 0x0000, 0x0000, 0xA7A3, 0x0000,
+	0xA77D, 0xCAAA, 0x0000, 0x0000, 0x0000, 0xCAAB, 0x0000, 0xA7A1, 0x0000, 0xCAAD, 0xA77B, 0xCAAE, 0xCAAC, 0xA77E, 0xA7A2, 0xA7A5,
+	0xA7A4, 0xA77C, 0xCAAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA959, 0xCBFE, 0x0000, 0xA95B, 0x0000, 0xA95A, 0x0000, 0xCC40, 0xA958, 0xA957, 0xCBF5, 0x0000, 0xCBF4, 0x0000, 0xCBF2,
+	0xCBF7, 0xCBF6, 0xCBF3, 0xCBFC, 0xCBFD, 0xCBFA, 0xCBF8, 0xA956, 0x0000, 0x0000, 0x0000, 0xCBFB, 0xA95C, 0xCC41, 0x0000, 0x0000,
+	0xCBF9, 0x0000, 0xABAB, 0xA955, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xABAC, 0xCE54, 0x0000, 0x0000, 0xCE5A,
+	0x0000, 0x0000, 0x0000, 0xABB2, 0xCE58, 0xCE5E, 0x0000, 0xCE55, 0xCE59, 0xCE5B, 0xCE5D, 0xCE57, 0x0000, 0xCE56, 0xCE51, 0xCE52,
+	0xABAD, 0x0000, 0xABAF, 0xABAE, 0xCE53, 0xCE5C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xABB1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE50, 0xD153, 0x0000, 0xD152, 0xD157, 0xD14E, 0x0000, 0xD151, 0xD150, 0x0000, 0xD154,
+	0x0000, 0xD158, 0xAE47, 0xAE4A, 0x0000, 0x0000, 0xD14F, 0xD155, 0x0000, 0x0000, 0x0000, 0xAE49, 0xD14A, 0x0000, 0xABB0, 0xD4BA,
+	0xD156, 0x0000, 0xD14D, 0x0000, 0xAE48, 0xD14C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4B1, 0x0000, 0x0000, 0xB0EC,
+	0xB0F0, 0xD4C1, 0xD4AF, 0xD4BD, 0xB0F1, 0xD4BF, 0x0000, 0xD4C5, 0x0000, 0xD4C9, 0x0000, 0x0000, 0xD4C0, 0xD4B4, 0xD4BC, 0x0000,
+	0xD4CA, 0xD4C8, 0xD4BE, 0xD4B9, 0xD4B2, 0xD8A6, 0xD4B0, 0xB0F5, 0xD4B7, 0xB0F6, 0xB0F2, 0xD4AD, 0xD4C3, 0xD4B5, 0x0000, 0x0000,
+	0xD4B3, 0xD4C6, 0xB0F3, 0x0000, 0xD4CC, 0xB0ED, 0xB0EF, 0xD4BB, 0xD4B6, 0xAE4B, 0xB0EE, 0xD4B8, 0xD4C7, 0xD4CB, 0xD4C2, 0x0000,
+	0xD4C4, 0x0000, 0x0000, 0x0000, 0xD4AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8A1, 0x0000, 0xD8AA, 0xD8A9, 0xB3FA, 0xD8A2, 0x0000,
+	0xB3FB, 0xB3F9, 0x0000, 0xD8A4, 0xB3F6, 0xD8A8, 0x0000, 0xD8A3, 0xD8A5, 0xD87D, 0xB3F4, 0x0000, 0xD8B2, 0xD8B1, 0xD8AE, 0xB3F3,
+	0xB3F7, 0xB3F8, 0xD14B, 0xD8AB, 0xB3F5, 0xB0F4, 0xD8AD, 0xD87E, 0xD8B0, 0xD8AF, 0x0000, 0xD8B3, 0x0000, 0xDCEF, 0x0000, 0xD8AC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8A7, 0xDCE7, 0xB6F4, 0xB6F7, 0xB6F2, 0xDCE6, 0xDCEA, 0xDCE5,
+	0x0000, 0xB6EC, 0xB6F6, 0xDCE2, 0xB6F0, 0xDCE9, 0x0000, 0xB6EE, 0xB6ED, 0xDCEC, 0xB6EF, 0xDCEE, 0x0000, 0xDCEB, 0xB6EB, 0x0000,
+	0x0000, 0x0000, 0xB6F5, 0xDCF0, 0xDCE4, 0xDCED, 0x0000, 0x0000, 0xDCE3, 0x0000, 0x0000, 0xB6F1, 0x0000, 0xB6F3, 0x0000, 0xDCE8,
+	0x0000, 0xDCF1, 0x0000, 0x0000, 0xE15D, 0xB9D0, 0xE163, 0x0000, 0x0000, 0xB9D5, 0xE15F, 0xE166, 0xE157, 0xB9D7, 0xB9D1, 0xE15C,
+	0xBC55, 0xE15B, 0xE164, 0xB9D2, 0x0000, 0xB9D6, 0xE15A, 0xE160, 0xE165, 0xE156, 0xB9D4, 0xE15E, 0x0000, 0x0000, 0xE162, 0xE168,
+	0xE158, 0xE161, 0x0000, 0xB9D3, 0xE167, 0x0000, 0x0000, 0x0000, 0xE159, 0x0000, 0x0000, 0x0000, 0xBC59, 0xE54B, 0xBC57, 0xBC56,
+	0xE54D, 0xE552, 0x0000, 0xE54E, 0x0000, 0xE551, 0xBC5C, 0x0000, 0xBEA5, 0xBC5B, 0x0000, 0xE54A, 0xE550, 0x0000, 0xBC5A, 0xE54F,
+	0x0000, 0xE54C, 0x0000, 0xBC58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE94D, 0xF9D9, 0xE94F, 0xE94A, 0xBEC1, 0xE94C,
+	0x0000, 0xBEC0, 0xE94E, 0x0000, 0x0000, 0xBEC3, 0xE950, 0xBEC2, 0xE949, 0xE94B, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0A5, 0xECCC,
+	0x0000, 0xC0A4, 0xECCD, 0xC0A3, 0xECCB, 0xC0A2, 0xECCA, 0x0000, 0xC253, 0xC252, 0xF1F6, 0xF1F8, 0x0000, 0xF1F7, 0xC361, 0xC362,
+	0x0000, 0x0000, 0xC363, 0xF442, 0xC45B, 0x0000, 0x0000, 0xF7D3, 0xF7D2, 0xC5F2, 0x0000, 0xA468, 0xA4D0, 0x0000, 0x0000, 0xA7A7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCE5F, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3FC, 0xB3FD, 0x0000, 0xDCF2, 0xB9D8, 0xE169, 0xE553,
+	0x0000, 0x0000, 0x0000, 0xC95A, 0x0000, 0x0000, 0xCAB0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC42, 0xCE60, 0xD159, 0xAE4C,
+	0x0000, 0x0000, 0xF1F9, 0x0000, 0xC4DC, 0xA469, 0xA57E, 0xC970, 0x0000, 0xA667, 0xA668, 0x0000, 0xA95D, 0x0000, 0x0000, 0x0000,
+	0xB0F7, 0x0000, 0xB9DA, 0x0000, 0xB9DB, 0xB9D9, 0x0000, 0xA46A, 0x0000, 0xA4D1, 0xA4D3, 0xA4D2, 0xC95B, 0xA4D4, 0xA5A1, 0xC971,
+	0x0000, 0xA5A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA669, 0xA66A, 0x0000, 0x0000, 0x0000, 0xC9CB, 0x0000, 0xA7A8, 0x0000,
+	0xCAB1, 0x0000, 0x0000, 0x0000, 0xA961, 0xCC43, 0x0000, 0xA95F, 0xA960, 0xA95E, 0xD15A, 0x0000, 0x0000, 0x0000, 0xABB6, 0xABB5,
+	0xABB7, 0xABB4, 0x0000, 0xCE61, 0xA962, 0xABB3, 0x0000, 0xAE4D, 0xAE4E, 0x0000, 0xAE4F, 0x0000, 0xD4CD, 0x0000, 0x0000, 0x0000,
+	0xB3FE, 0xD8B4, 0xB0F8, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6F8, 0x0000, 0xB9DD, 0xB9DC, 0xE16A, 0x0000, 0xBC5D, 0xBEC4, 0x0000,
+	0xEFC0, 0xF6DA, 0xF7D4, 0xA46B, 0xA5A3, 0x0000, 0xA5A4, 0xC9D1, 0xA66C, 0xA66F, 0x0000, 0xC9CF, 0xC9CD, 0xA66E, 0xC9D0, 0xC9D2,
+	0xC9CC, 0xA671, 0xA670, 0xA66D, 0xA66B, 0xC9CE, 0x0000, 0x0000, 0x0000, 0x0000, 0xA7B3, 0x0000, 0x0000, 0xA7B0, 0xCAB6, 0xCAB9,
+	0xCAB8, 0x0000, 0xA7AA, 0xA7B2, 0x0000, 0x0000, 0xA7AF, 0xCAB5, 0xCAB3, 0xA7AE, 0x0000, 0x0000, 0x0000, 0xA7A9, 0xA7AC, 0x0000,
+	0xCAB4, 0xCABB, 0xCAB7, 0xA7AD, 0xA7B1, 0xA7B4, 0xCAB2, 0xCABA, 0xA7AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA967, 0xA96F,
+	0x0000, 0xCC4F, 0xCC48, 0xA970, 0xCC53, 0xCC44, 0xCC4B, 0x0000, 0x0000, 0xA966, 0xCC45, 0xA964, 0xCC4C, 0xCC50, 0xA963, 0x0000,
+	0xCC51, 0xCC4A, 0x0000, 0xCC4D, 0x0000, 0xA972, 0xA969, 0xCC54, 0xCC52, 0x0000, 0xA96E, 0xA96C, 0xCC49, 0xA96B, 0xCC47, 0xCC46,
+	0xA96A, 0xA968, 0xA971, 0xA96D, 0xA965, 0x0000, 0xCC4E, 0x0000, 0xABB9, 0x0000, 0xABC0, 0xCE6F, 0xABB8, 0xCE67, 0xCE63, 0x0000,
+	0xCE73, 0xCE62, 0x0000, 0xABBB, 0xCE6C, 0xABBE, 0xABC1, 0x0000, 0xABBC, 0xCE70, 0xABBF, 0x0000, 0xAE56, 0xCE76, 0xCE64, 0x0000,
+	0x0000, 0xCE66, 0xCE6D, 0xCE71, 0xCE75, 0xCE72, 0xCE6B, 0xCE6E, 0x0000, 0x0000, 0xCE68, 0xABC3, 0xCE6A, 0xCE69, 0xCE74, 0xABBA,
+	0xCE65, 0xABC2, 0x0000, 0xABBD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAE5C, 0xD162, 0x0000, 0xAE5B, 0x0000, 0x0000, 0xD160,
+	0x0000, 0xAE50, 0x0000, 0xAE55, 0x0000, 0xD15F, 0xD15C, 0xD161, 0xAE51, 0xD15B, 0x0000, 0xAE54, 0xAE52, 0x0000, 0xD163, 0xAE53,
+	0xAE57, 0x0000, 0x0000, 0xAE58, 0x0000, 0xAE5A, 0x0000, 0x0000, 0x0000, 0xAE59, 0x0000, 0x0000, 0x0000, 0xD15D, 0xD15E, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD164, 0x0000, 0xD4D4, 0xB0F9, 0xD8C2, 0xD4D3, 0xD4E6, 0x0000, 0x0000, 0xB140, 0x0000, 0xD4E4, 0x0000,
+	0xB0FE, 0xB0FA, 0xD4ED, 0xD4DD, 0xD4E0, 0x0000, 0xB143, 0xD4EA, 0xD4E2, 0xB0FB, 0xB144, 0x0000, 0xD4E7, 0xD4E5, 0x0000, 0x0000,
+	0xD4D6, 0xD4EB, 0xD4DF, 0xD4DA, 0x0000, 0xD4D0, 0xD4EC, 0xD4DC, 0xD4CF, 0x0000, 0xB142, 0xD4E1, 0xD4EE, 0xD4DE, 0xD4D2, 0xD4D7,
+	0xD4CE, 0x0000, 0xB141, 0x0000, 0xD4DB, 0xD4D8, 0xB0FC, 0xD4D1, 0x0000, 0xD4E9, 0xB0FD, 0x0000, 0xD4D9, 0xD4D5, 0x0000, 0x0000,
+	0xD4E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB440, 0xD8BB, 0x0000, 0xD8B8, 0xD8C9, 0xD8BD, 0xD8CA, 0x0000, 0xB442,
+	0x0000, 0x0000, 0x0000, 0xD8C6, 0xD8C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD8C4, 0xD8C7, 0xD8CB, 0x0000, 0xD4E3, 0xD8CD,
+	0xDD47, 0x0000, 0xB443, 0xD8CE, 0xD8B6, 0xD8C0, 0x0000, 0xD8C5, 0x0000, 0x0000, 0xB441, 0xB444, 0xD8CC, 0xD8CF, 0xD8BA, 0xD8B7,
+	0x0000, 0x0000, 0xD8B9, 0x0000, 0x0000, 0xD8BE, 0xD8BC, 0xB445, 0x0000, 0xD8C8, 0x0000, 0x0000, 0xD8BF, 0x0000, 0xD8C1, 0xD8B5,
+	0xDCFA, 0xDCF8, 0xB742, 0xB740, 0xDD43, 0xDCF9, 0xDD44, 0xDD40, 0xDCF7, 0xDD46, 0xDCF6, 0xDCFD, 0xB6FE, 0xB6FD, 0xB6FC, 0xDCFB,
+	0xDD41, 0xB6F9, 0xB741, 0x0000, 0xDCF4, 0x0000, 0xDCFE, 0xDCF3, 0xDCFC, 0xB6FA, 0xDD42, 0xDCF5, 0xB6FB, 0xDD45, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE16E, 0xB9E2, 0xB9E1, 0xB9E3, 0xE17A, 0xE170, 0xE176, 0xE16B, 0xE179, 0xE178, 0xE17C,
+	0xE175, 0xB9DE, 0xE174, 0xB9E4, 0x0000, 0xE16D, 0xB9DF, 0x0000, 0xE17B, 0xB9E0, 0xE16F, 0xE172, 0xE177, 0xE171, 0xE16C, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE173, 0xE555, 0xBC61, 0xE558, 0xE557, 0xE55A, 0xE55C, 0xF9DC, 0xBC5F, 0x0000, 0xE556, 0x0000, 0xE554,
+	0x0000, 0xE55D, 0xE55B, 0xE559, 0x0000, 0xE55F, 0x0000, 0xE55E, 0xBC63, 0xBC5E, 0x0000, 0xBC60, 0xBC62, 0x0000, 0x0000, 0xE560,
+	0xE957, 0x0000, 0x0000, 0xE956, 0xE955, 0x0000, 0xE958, 0xE951, 0x0000, 0xE952, 0xE95A, 0xE953, 0x0000, 0xBEC5, 0xE95C, 0x0000,
+	0xE95B, 0xE954, 0x0000, 0xECD1, 0xC0A8, 0xECCF, 0xECD4, 0xECD3, 0xE959, 0x0000, 0xC0A7, 0x0000, 0xECD2, 0xECCE, 0xECD6, 0xECD5,
+	0xC0A6, 0x0000, 0xECD0, 0x0000, 0xBEC6, 0x0000, 0x0000, 0x0000, 0xC254, 0x0000, 0x0000, 0x0000, 0xEFC1, 0xF1FA, 0xF1FB, 0xF1FC,
+	0xC45C, 0x0000, 0x0000, 0xC45D, 0x0000, 0xF443, 0x0000, 0xF5C8, 0xF5C7, 0x0000, 0x0000, 0xF6DB, 0xF6DC, 0xF7D5, 0xF8A7, 0x0000,
+	0xA46C, 0xA46D, 0x0000, 0xA46E, 0xA4D5, 0xA5A5, 0xC9D3, 0xA672, 0xA673, 0x0000, 0xA7B7, 0xA7B8, 0xA7B6, 0xA7B5, 0x0000, 0xA973,
+	0x0000, 0x0000, 0xCC55, 0xA975, 0xA974, 0xCC56, 0x0000, 0x0000, 0x0000, 0xABC4, 0x0000, 0xAE5D, 0xD165, 0x0000, 0xD4F0, 0x0000,
+	0xB145, 0xB447, 0xD4EF, 0xB446, 0x0000, 0xB9E5, 0x0000, 0xE17D, 0xBEC7, 0x0000, 0xC0A9, 0xECD7, 0x0000, 0xC45E, 0x0000, 0xC570,
+	0x0000, 0xC972, 0x0000, 0xA5A6, 0xC973, 0xA676, 0x0000, 0xA674, 0xA675, 0xA677, 0x0000, 0xA7BA, 0xA7B9, 0x0000, 0xCABC, 0xA7BB,
+	0x0000, 0x0000, 0xCABD, 0xCC57, 0x0000, 0xCC58, 0x0000, 0xA976, 0xA978, 0xA97A, 0xA977, 0xA97B, 0xA979, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xABC8, 0xABC5, 0xABC7, 0xABC9, 0xABC6, 0xD166, 0xCE77, 0x0000, 0x0000, 0x0000, 0xD168, 0xD167, 0xAE63, 0x0000,
+	0xAE5F, 0x0000, 0x0000, 0xAE60, 0xAE62, 0xAE64, 0xAE61, 0x0000, 0xAE66, 0xAE65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB14A,
+	0xD4F2, 0xD4F1, 0xB149, 0x0000, 0xB148, 0xB147, 0xB14B, 0xB146, 0x0000, 0x0000, 0xD8D5, 0xD8D2, 0xB449, 0xD8D1, 0xD8D6, 0x0000,
+	0xB44B, 0xD8D4, 0xB448, 0xB44A, 0xD8D3, 0x0000, 0xDD48, 0x0000, 0xDD49, 0xDD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0xB9E6, 0xB9EE,
+	0xE17E, 0xB9E8, 0xB9EC, 0xE1A1, 0xB9ED, 0xB9E9, 0xB9EA, 0xB9E7, 0xB9EB, 0xBC66, 0xD8D0, 0xBC67, 0xBC65, 0x0000, 0xBC64, 0xE95D,
+	0xBEC8, 0xECD8, 0xECD9, 0x0000, 0x0000, 0xC364, 0xC45F, 0x0000, 0xA46F, 0x0000, 0xA678, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xABCA, 0x0000, 0xD169, 0xAE67, 0x0000, 0x0000, 0xB14E, 0xB14D, 0xB14C, 0xB44C, 0xB44D, 0xD8D7, 0xB9EF, 0xBEC9, 0xA470,
+	0xC95C, 0xA4D6, 0xC974, 0x0000, 0x0000, 0xC9D4, 0xA679, 0x0000, 0x0000, 0x0000, 0xA97C, 0x0000, 0x0000, 0x0000, 0x0000, 0xDD4B,
+	0x0000, 0x0000, 0xA471, 0x0000, 0xA4D7, 0xC9D5, 0x0000, 0x0000, 0xCABE, 0x0000, 0xCABF, 0x0000, 0xA7BC, 0x0000, 0x0000, 0x0000,
+	0xD8D8, 0xB44E, 0x0000, 0xDD4C, 0x0000, 0x0000, 0x0000, 0xC0AA, 0xA472, 0xA4A8, 0xA4D8, 0xC975, 0xA5A7, 0x0000, 0xA7C0, 0xA7BF,
+	0xA7BD, 0xA7BE, 0x0000, 0x0000, 0xCC59, 0xA97E, 0xA9A1, 0xCC5A, 0xA97D, 0x0000, 0x0000, 0xABCE, 0xCE78, 0xABCD, 0xABCB, 0xABCC,
+	0xAE6A, 0xAE68, 0x0000, 0x0000, 0xD16B, 0xAE69, 0xD16A, 0x0000, 0xAE5E, 0xD4F3, 0x0000, 0x0000, 0xB150, 0xB151, 0x0000, 0x0000,
+	0xB14F, 0x0000, 0xB9F0, 0xE1A2, 0xBC68, 0xBC69, 0x0000, 0xE561, 0xC0AB, 0xEFC2, 0xEFC3, 0x0000, 0xC4DD, 0xF8A8, 0xC94B, 0xA4D9,
+	0x0000, 0xA473, 0x0000, 0xC977, 0xC976, 0x0000, 0x0000, 0x0000, 0x0000, 0xA67A, 0xC9D7, 0xC9D8, 0xC9D6, 0x0000, 0xC9D9, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAC7, 0x0000, 0xCAC2, 0xCAC4, 0xCAC6, 0xCAC3, 0xA7C4, 0xCAC0, 0x0000, 0xCAC1,
+	0xA7C1, 0xA7C2, 0xCAC5, 0xCAC8, 0xA7C3, 0xCAC9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC68, 0x0000, 0xCC62,
+	0xCC5D, 0xA9A3, 0xCC65, 0xCC63, 0xCC5C, 0xCC69, 0xCC6C, 0xCC67, 0xCC60, 0xA9A5, 0xCC66, 0xA9A6, 0xCC61, 0xCC64, 0xCC5B, 0xCC5F,
+	0xCC6B, 0xA9A7, 0x0000, 0xA9A8, 0x0000, 0xCC5E, 0xCC6A, 0xA9A2, 0xA9A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEAB, 0xCEA4, 0xCEAA, 0xCEA3, 0xCEA5, 0xCE7D, 0xCE7B, 0x0000, 0xCEAC, 0xCEA9,
+	0xCE79, 0x0000, 0xABD0, 0xCEA7, 0xCEA8, 0x0000, 0xCEA6, 0xCE7C, 0xCE7A, 0xABCF, 0xCEA2, 0xCE7E, 0x0000, 0x0000, 0xCEA1, 0xCEAD,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAE6F, 0x0000, 0xAE6E, 0x0000, 0xD16C, 0xAE6B, 0xD16E, 0x0000,
+	0xAE70, 0xD16F, 0x0000, 0x0000, 0xAE73, 0x0000, 0xAE71, 0xD170, 0xCEAE, 0xD172, 0x0000, 0xAE6D, 0x0000, 0xAE6C, 0x0000, 0xD16D,
+	0xD171, 0xAE72, 0x0000, 0x0000, 0x0000, 0x0000, 0xB153, 0xB152, 0x0000, 0x0000, 0x0000, 0xD4F5, 0xD4F9, 0xD4FB, 0xB154, 0xD4FE,
+	0x0000, 0xB158, 0xD541, 0x0000, 0xB15A, 0x0000, 0xB156, 0xB15E, 0x0000, 0xB15B, 0xD4F7, 0xB155, 0x0000, 0xD4F6, 0xD4F4, 0xD543,
+	0xD4F8, 0x0000, 0xB157, 0xD542, 0xB15C, 0xD4FD, 0xD4FC, 0xB15D, 0xD4FA, 0xB159, 0x0000, 0x0000, 0x0000, 0x0000, 0xD544, 0x0000,
+	0xD540, 0xD8E7, 0xD8EE, 0xD8E3, 0xB451, 0xD8DF, 0xD8EF, 0xD8D9, 0xD8EC, 0xD8EA, 0xD8E4, 0x0000, 0xD8ED, 0xD8E6, 0x0000, 0xD8DE,
+	0xD8F0, 0xD8DC, 0xD8E9, 0xD8DA, 0x0000, 0xD8F1, 0x0000, 0xB452, 0x0000, 0xD8EB, 0xDD4F, 0xD8DD, 0xB44F, 0x0000, 0xD8E1, 0x0000,
+	0xB450, 0xD8E0, 0xD8E5, 0x0000, 0x0000, 0xD8E2, 0x0000, 0x0000, 0x0000, 0xD8E8, 0x0000, 0x0000, 0x0000, 0x0000, 0xDD53, 0x0000,
+	0x0000, 0x0000, 0xDD56, 0xDD4E, 0x0000, 0xDD50, 0x0000, 0xDD55, 0xDD54, 0xB743, 0x0000, 0xD8DB, 0xDD52, 0x0000, 0x0000, 0xB744,
+	0x0000, 0xDD4D, 0xDD51, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1A9, 0x0000, 0xE1B0, 0xE1A7, 0x0000, 0xE1AE, 0xE1A5, 0xE1AD, 0xE1B1,
+	0xE1A4, 0xE1A8, 0xE1A3, 0x0000, 0xB9F1, 0x0000, 0xE1A6, 0xB9F2, 0xE1AC, 0xE1AB, 0xE1AA, 0x0000, 0x0000, 0xE1AF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE565, 0xE567, 0xBC6B, 0xE568, 0x0000, 0xE563, 0x0000, 0xE562, 0xE56C, 0x0000, 0xE56A, 0xBC6A, 0xE56D, 0xE564,
+	0xE569, 0xE56B, 0xE566, 0x0000, 0x0000, 0x0000, 0x0000, 0xE961, 0xE966, 0xE960, 0xE965, 0x0000, 0xE95E, 0xE968, 0xE964, 0xE969,
+	0xE963, 0xE95F, 0xE967, 0x0000, 0xE96A, 0xE962, 0x0000, 0xECDA, 0xC0AF, 0x0000, 0xC0AD, 0x0000, 0xC0AC, 0xC0AE, 0x0000, 0x0000,
+	0xEFC4, 0x0000, 0xF172, 0xF1FD, 0x0000, 0x0000, 0xF444, 0xF445, 0x0000, 0xC460, 0x0000, 0xF5C9, 0x0000, 0xC4DE, 0x0000, 0xF5CA,
+	0x0000, 0xF6DE, 0xC572, 0x0000, 0xC571, 0xF6DD, 0xC5C9, 0x0000, 0xF7D6, 0x0000, 0x0000, 0x0000, 0x0000, 0xA474, 0xA67B, 0xC9DA,
+	0xCACA, 0xA8B5, 0xB15F, 0x0000, 0x0000, 0xA475, 0xA5AA, 0xA5A9, 0xA5A8, 0x0000, 0x0000, 0xA7C5, 0x0000, 0x0000, 0xAE74, 0x0000,
+	0xDD57, 0xA476, 0xA477, 0xA478, 0xA4DA, 0x0000, 0x0000, 0xABD1, 0x0000, 0xCEAF, 0x0000, 0x0000, 0x0000, 0xB453, 0xA479, 0xC95D,
+	0x0000, 0x0000, 0xA5AB, 0xA5AC, 0xC978, 0x0000, 0xA67C, 0x0000, 0x0000, 0x0000, 0xCACB, 0x0000, 0xA7C6, 0x0000, 0xCACC, 0x0000,
+	0x0000, 0xA9AE, 0x0000, 0x0000, 0xCC6E, 0xA9AC, 0xA9AB, 0xCC6D, 0xA9A9, 0xCC6F, 0xA9AA, 0xA9AD, 0x0000, 0xABD2, 0x0000, 0xABD4,
+	0xCEB3, 0xCEB0, 0xCEB1, 0xCEB2, 0xCEB4, 0xABD3, 0x0000, 0x0000, 0xD174, 0xD173, 0x0000, 0xAE76, 0x0000, 0xAE75, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xB162, 0xD546, 0x0000, 0xB161, 0xB163, 0xB160, 0x0000, 0x0000, 0x0000, 0x0000, 0xB455, 0xD545, 0x0000,
+	0xB456, 0xD8F3, 0x0000, 0xB457, 0xD8F2, 0xB454, 0x0000, 0x0000, 0x0000, 0x0000, 0xDD5A, 0xDD5C, 0xB745, 0xDD5B, 0xDD59, 0xDD58,
+	0x0000, 0x0000, 0x0000, 0xE1B4, 0xB9F7, 0xB9F5, 0x0000, 0xB9F6, 0xE1B2, 0xE1B3, 0x0000, 0xB9F3, 0xE571, 0xE56F, 0x0000, 0xBC6D,
+	0xE570, 0xBC6E, 0xBC6C, 0xB9F4, 0x0000, 0x0000, 0xE96D, 0xE96B, 0xE96C, 0xE56E, 0xECDC, 0xC0B0, 0xECDB, 0xEFC5, 0xEFC6, 0xE96E,
+	0xF1FE, 0x0000, 0xA47A, 0xA5AD, 0xA67E, 0xC9DB, 0xA67D, 0x0000, 0xA9AF, 0xB746, 0x0000, 0xA4DB, 0xA5AE, 0xABD5, 0xB458, 0x0000,
+	0xC979, 0x0000, 0xC97A, 0x0000, 0xC9DC, 0x0000, 0x0000, 0xA7C8, 0xCAD0, 0xCACE, 0xA7C9, 0xCACD, 0xCACF, 0xCAD1, 0x0000, 0xA7C7,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9B3, 0xA9B4, 0xA9B1, 0x0000, 0x0000, 0xA9B0, 0xCEB8, 0xA9B2, 0x0000, 0x0000, 0x0000,
+	0xABD6, 0x0000, 0xCEB7, 0xCEB9, 0xCEB6, 0xCEBA, 0xABD7, 0xAE79, 0xD175, 0x0000, 0xD177, 0xAE77, 0xD178, 0xAE78, 0xD176, 0x0000,
+	0xCEB5, 0xD547, 0xD54A, 0xD54B, 0xD548, 0xB167, 0xB166, 0xB164, 0xB165, 0xD549, 0x0000, 0x0000, 0x0000, 0x0000, 0xB168, 0x0000,
+	0x0000, 0xB45A, 0xB45B, 0x0000, 0xB45C, 0xDD5D, 0xDD5F, 0xDD61, 0xB748, 0xB747, 0xB459, 0xDD60, 0xDD5E, 0x0000, 0xE1B8, 0x0000,
+	0x0000, 0xE1B6, 0xE1BC, 0xB9F8, 0xE1BD, 0xE1BA, 0xB9F9, 0xE1B7, 0xE1B5, 0xE1BB, 0xBC70, 0xE573, 0xE1B9, 0xBC72, 0xE574, 0xBC71,
+	0xBC74, 0xE575, 0xBC6F, 0xBC73, 0x0000, 0xE973, 0xE971, 0xE970, 0xE972, 0xE96F, 0x0000, 0x0000, 0xC366, 0x0000, 0xF446, 0xF447,
+	0x0000, 0xF5CB, 0xF6DF, 0xC655, 0x0000, 0x0000, 0xA9B5, 0xA7CA, 0x0000, 0x0000, 0xABD8, 0x0000, 0x0000, 0x0000, 0xA47B, 0xA4DC,
+	0x0000, 0xA5AF, 0xC9DD, 0x0000, 0xA7CB, 0xCAD2, 0x0000, 0xCEBB, 0xABD9, 0x0000, 0xB9FA, 0xA47C, 0x0000, 0x0000, 0x0000, 0xA6A1,
+	0x0000, 0x0000, 0xB749, 0xA47D, 0xA4DD, 0xA4DE, 0x0000, 0xA5B1, 0xA5B0, 0x0000, 0xC9DE, 0xA6A2, 0x0000, 0xCAD3, 0x0000, 0xA7CC,
+	0x0000, 0x0000, 0xCC71, 0xCC72, 0xCC73, 0x0000, 0xA9B6, 0xA9B7, 0xCC70, 0xA9B8, 0x0000, 0x0000, 0x0000, 0xABDA, 0xCEBC, 0x0000,
+	0xD17A, 0xAE7A, 0x0000, 0xD179, 0x0000, 0xB169, 0xD54C, 0xB16A, 0xD54D, 0x0000, 0x0000, 0x0000, 0xB45D, 0x0000, 0x0000, 0x0000,
+	0xDD62, 0x0000, 0x0000, 0xE1BF, 0xE1BE, 0x0000, 0xB9FB, 0x0000, 0xBC75, 0xE576, 0xBECA, 0xE974, 0xC0B1, 0x0000, 0xC573, 0xF7D8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xCC74, 0x0000, 0xCEBD, 0xB16B, 0xD8F4, 0xB74A, 0x0000, 0x0000, 0x0000, 0xC255, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA7CE, 0x0000, 0xA7CD, 0xABDB, 0x0000, 0xD17B, 0x0000, 0xB16D, 0xB343, 0xB16E, 0xB16C, 0xB45E, 0x0000, 0xE1C0,
+	0xB9FC, 0xBC76, 0x0000, 0xC94C, 0xC9DF, 0x0000, 0xCAD5, 0xA7CF, 0xCAD4, 0xA7D0, 0x0000, 0x0000, 0xA9BC, 0xCC77, 0xCC76, 0xA9BB,
+	0xA9B9, 0xA9BA, 0xCC75, 0x0000, 0x0000, 0xABDD, 0xCEBE, 0xABE0, 0xABDC, 0xABE2, 0xABDE, 0xABDF, 0xABE1, 0x0000, 0x0000, 0x0000,
+	0xAE7D, 0xAE7C, 0xAE7B, 0x0000, 0x0000, 0x0000, 0xD54F, 0xB16F, 0xB172, 0xB170, 0x0000, 0xD54E, 0xB175, 0x0000, 0xB171, 0xD550,
+	0xB174, 0xB173, 0x0000, 0x0000, 0x0000, 0xD8F6, 0xD8F5, 0x0000, 0xB461, 0xB45F, 0xB460, 0xD8F7, 0xB74B, 0xDD64, 0xB74C, 0xDD63,
+	0x0000, 0x0000, 0xE577, 0x0000, 0x0000, 0xBC78, 0xE1C1, 0xBC77, 0x0000, 0xB9FD, 0x0000, 0xECDE, 0xE975, 0xC0B2, 0xECDD, 0xF240,
+	0xF448, 0xF449, 0x0000, 0xA4DF, 0x0000, 0xA5B2, 0x0000, 0x0000, 0x0000, 0xC97B, 0x0000, 0x0000, 0xA7D2, 0xA7D4, 0x0000, 0xC9E2,
+	0xCAD8, 0xCAD7, 0xCAD6, 0x0000, 0xC9E1, 0xC9E0, 0xA6A4, 0xA7D3, 0xA7D1, 0xA6A3, 0x0000, 0x0000, 0x0000, 0xA9BD, 0xCC78, 0x0000,
+	0xA9BE, 0xCADD, 0x0000, 0xCADF, 0xCADE, 0xCC79, 0x0000, 0x0000, 0xCADA, 0x0000, 0xA7D8, 0xA7D6, 0x0000, 0xCAD9, 0xCADB, 0xCAE1,
+	0x0000, 0xA7D5, 0x0000, 0xCADC, 0xCAE5, 0xA9C0, 0x0000, 0xCAE2, 0xA7D7, 0x0000, 0xCAE0, 0xCAE3, 0x0000, 0xA9BF, 0x0000, 0xA9C1,
+	0xCAE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCCAF, 0xCCA2, 0xCC7E, 0xCCAE, 0xCCA9, 0xABE7, 0xA9C2,
+	0xCCAA, 0xCCAD, 0xABE3, 0xCCAC, 0xA9C3, 0xA9C8, 0xA9C6, 0xCCA3, 0x0000, 0xCC7C, 0xCCA5, 0xA9CD, 0xCCB0, 0xABE4, 0xCCA6, 0x0000,
+	0xABE5, 0xA9C9, 0xCCA8, 0x0000, 0xCECD, 0xABE6, 0xCC7B, 0xA9CA, 0xABE8, 0xA9CB, 0xA9C7, 0xA9CC, 0xCCA7, 0xCC7A, 0xCCAB, 0xA9C4,
+	0x0000, 0x0000, 0xCC7D, 0xCCA4, 0xCCA1, 0xA9C5, 0x0000, 0xCEBF, 0x0000, 0xCEC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCECA, 0xD1A1, 0xCECB, 0xABEE, 0xCECE, 0xCEC4, 0xABED, 0xCEC6, 0x0000, 0xCEC7, 0x0000, 0x0000, 0xCEC9, 0xABE9, 0x0000, 0x0000,
+	0xAEA3, 0x0000, 0xF9DA, 0xCEC5, 0xCEC1, 0xAEA4, 0x0000, 0x0000, 0xCECF, 0xAE7E, 0xD17D, 0xCEC8, 0x0000, 0xD17C, 0xCEC3, 0xCECC,
+	0x0000, 0x0000, 0xABEC, 0xAEA1, 0xABF2, 0xAEA2, 0xCED0, 0xD17E, 0xABEB, 0xAEA6, 0xABF1, 0xABF0, 0xABEF, 0xAEA5, 0xCED1, 0xAEA7,
+	0xABEA, 0x0000, 0xCEC2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB176,
+	0xD1A4, 0xD1A6, 0x0000, 0xD1A8, 0xAEA8, 0xAEAE, 0xD553, 0xD1AC, 0xD1A3, 0xB178, 0xD551, 0x0000, 0xAEAD, 0xAEAB, 0xD1AE, 0x0000,
+	0xD552, 0x0000, 0xD1A5, 0x0000, 0xAEAC, 0xD1A9, 0xAEAF, 0xD1AB, 0x0000, 0x0000, 0xAEAA, 0xD1AA, 0xD1AD, 0xD1A7, 0x0000, 0xAEA9,
+	0xB179, 0x0000, 0xD1A2, 0xB177, 0x0000, 0x0000, 0x0000, 0x0000, 0xB17A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD555, 0xD55E, 0xB464, 0x0000, 0xB17C, 0xB1A3, 0xB465, 0xD560, 0xB1AA, 0xD8F9, 0xD556, 0xB1A2, 0xB1A5, 0xB17E, 0xD554, 0xD562,
+	0xD565, 0xD949, 0x0000, 0xD563, 0xD8FD, 0xB1A1, 0xB1A8, 0xB1AC, 0xD55D, 0xD8F8, 0xD561, 0xB17B, 0xD8FA, 0xD564, 0xD8FC, 0xD559,
+	0x0000, 0xB462, 0x0000, 0xD557, 0xD558, 0xB1A7, 0x0000, 0x0000, 0xB1A6, 0xD55B, 0xB1AB, 0xD55F, 0xB1A4, 0xD55C, 0x0000, 0xB1A9,
+	0xB466, 0xB463, 0xD8FB, 0x0000, 0xD55A, 0x0000, 0xB17D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xB46B, 0xB46F, 0xD940, 0xB751, 0xB46D, 0xD944, 0xB471, 0xDD65, 0xD946, 0xB753, 0xB469, 0xB46C, 0xD947, 0x0000, 0xD948, 0xD94E,
+	0xB473, 0xB754, 0x0000, 0xD94A, 0xD94F, 0xD943, 0xB75E, 0x0000, 0xB755, 0xB472, 0xD941, 0xD950, 0x0000, 0xB75D, 0xB470, 0xB74E,
+	0xD94D, 0x0000, 0xB474, 0xD945, 0xD8FE, 0xB46A, 0xD942, 0x0000, 0xD94B, 0x0000, 0xB74D, 0xB752, 0xB467, 0xD94C, 0x0000, 0xB750,
+	0x0000, 0x0000, 0x0000, 0xB468, 0x0000, 0x0000, 0x0000, 0xB75C, 0xE1C3, 0xDD70, 0x0000, 0xDD68, 0xE1C2, 0x0000, 0xDD6C, 0xDD6E,
+	0x0000, 0x0000, 0xDD6B, 0x0000, 0xB75B, 0x0000, 0xDD6A, 0xB75F, 0x0000, 0x0000, 0x0000, 0xE1D2, 0x0000, 0x0000, 0xB75A, 0xBA40,
+	0xDD71, 0xE1C4, 0x0000, 0x0000, 0xB758, 0xDD69, 0xDD6D, 0xB9FE, 0xB74F, 0xDD66, 0xDD67, 0xBA41, 0xB757, 0xB759, 0xB756, 0xDD6F,
+	0x0000, 0x0000, 0xE1C8, 0xE1C9, 0xE1CE, 0xBC7D, 0xE1D5, 0x0000, 0xBA47, 0x0000, 0xBA46, 0xE1D0, 0x0000, 0xBC7C, 0xE1C5, 0xBA45,
+	0x0000, 0xE1D4, 0xBA43, 0xBA44, 0x0000, 0xE1D1, 0xE5AA, 0xBC7A, 0xB46E, 0x0000, 0xE1D3, 0xBCA3, 0xE1CB, 0x0000, 0xBC7B, 0x0000,
+	0xBCA2, 0xE1C6, 0xE1CA, 0xE1C7, 0xE1CD, 0xBA48, 0xBC79, 0xBA42, 0x0000, 0xE57A, 0xE1CF, 0x0000, 0xBCA1, 0x0000, 0xBCA4, 0x0000,
+	0xE1CC, 0x0000, 0xBC7E, 0xE579, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE57E, 0xBECE, 0xE578, 0xE9A3, 0xE5A9, 0xBCA8, 0x0000,
+	0xBCA6, 0xBECC, 0xE5A6, 0xE5A2, 0xBCAC, 0x0000, 0xE978, 0x0000, 0x0000, 0x0000, 0xBCAA, 0xE5A1, 0x0000, 0xE976, 0x0000, 0xE5A5,
+	0x0000, 0xE5A8, 0xE57D, 0x0000, 0xBCAB, 0x0000, 0x0000, 0xBCA5, 0xE977, 0xBECD, 0xE5A7, 0xBCA7, 0xBCA9, 0xE5A4, 0xBCAD, 0xE5A3,
+	0xE57C, 0xE57B, 0xBECB, 0xE5AB, 0xE97A, 0xECE0, 0xBED0, 0x0000, 0xE9A2, 0x0000, 0xE97E, 0x0000, 0xECE1, 0x0000, 0xBED1, 0xE9A1,
+	0x0000, 0xE97C, 0xC0B4, 0xECDF, 0x0000, 0xE979, 0xE97B, 0xC0B5, 0xBED3, 0xC0B3, 0xBED2, 0xC0B7, 0xE97D, 0xBECF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFCF, 0x0000, 0xEFC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xECE7, 0xEFC8,
+	0xECE3, 0x0000, 0x0000, 0xC256, 0xECE5, 0xECE4, 0xC0B6, 0xECE2, 0xECE6, 0xEFD0, 0xEFCC, 0xEFCE, 0x0000, 0xEFC9, 0xEFCA, 0x0000,
+	0xEFCD, 0xEFCB, 0xC367, 0x0000, 0x0000, 0xC36A, 0xC369, 0xC368, 0xC461, 0xF44A, 0xC462, 0xF241, 0xC4DF, 0xF5CC, 0xC4E0, 0xC574,
+	0xC5CA, 0xF7D9, 0x0000, 0xF7DA, 0xF7DB, 0x0000, 0x0000, 0xF9BA, 0xA4E0, 0xC97C, 0xA5B3, 0x0000, 0xA6A6, 0xA6A7, 0xA6A5, 0x0000,
+	0xA6A8, 0xA7DA, 0xA7D9, 0x0000, 0xCCB1, 0xA9CF, 0xA9CE, 0x0000, 0x0000, 0xD1AF, 0xB1AD, 0xB1AE, 0x0000, 0x0000, 0x0000, 0xB475,
+	0xDD72, 0xB760, 0xB761, 0xDD74, 0xDD76, 0xDD75, 0x0000, 0xE1D7, 0x0000, 0xE1D6, 0xBA49, 0xE1D8, 0x0000, 0xE5AC, 0xBCAE, 0x0000,
+	0xBED4, 0x0000, 0xC0B8, 0xC257, 0xC0B9, 0x0000, 0xA4E1, 0x0000, 0x0000, 0x0000, 0xCAE6, 0x0000, 0x0000, 0xCCB2, 0xA9D1, 0xA9D0,
+	0xA9D2, 0xABF3, 0xCED2, 0xCED3, 0x0000, 0x0000, 0xD1B0, 0xAEB0, 0xB1AF, 0xB476, 0xD951, 0xA4E2, 0x0000, 0xA47E, 0xA4E3, 0x0000,
+	0xC97D, 0xA5B7, 0xA5B6, 0xA5B4, 0xA5B5, 0x0000, 0x0000, 0x0000, 0xA6AB, 0xC9E9, 0xC9EB, 0xA6AA, 0xC9E3, 0x0000, 0xC9E4, 0x0000,
+	0xC9EA, 0xC9E6, 0xC9E8, 0xA6A9, 0xC9E5, 0xC9EC, 0xC9E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA7E1, 0xA7EA, 0xA7E8,
+	0xCAF0, 0xCAED, 0xCAF5, 0xA7E6, 0xCAF6, 0x0000, 0xA7DF, 0xCAF3, 0x0000, 0xA7E5, 0xCAEF, 0xCAEE, 0xA7E3, 0xCAF4, 0xA7E4, 0xA9D3,
+	0xA7DE, 0xCAF1, 0x0000, 0xCAE7, 0xA7DB, 0x0000, 0xA7EE, 0xCAEC, 0xCAF2, 0xA7E0, 0xA7E2, 0x0000, 0xCAE8, 0x0000, 0xCAE9, 0xCAEA,
+	0x0000, 0xA7ED, 0xA7E7, 0xA7EC, 0xCAEB, 0xA7EB, 0xA7DD, 0xA7DC, 0xA7E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9E1, 0xCCBE, 0xCCB7, 0xA9DC, 0xA9EF, 0xCCB3, 0xCCBA, 0xCCBC,
+	0xCCBF, 0xA9EA, 0x0000, 0xCCBB, 0xCCB4, 0xA9E8, 0xCCB8, 0x0000, 0xCCC0, 0xA9D9, 0x0000, 0xCCBD, 0xA9E3, 0xA9E2, 0xCCB6, 0xA9D7,
+	0x0000, 0x0000, 0xA9D8, 0x0000, 0xA9D6, 0x0000, 0xA9EE, 0xA9E6, 0xA9E0, 0xA9D4, 0xCCB9, 0xA9DF, 0xA9D5, 0xA9E7, 0xA9F0, 0xCED4,
+	0xA9E4, 0xCCB5, 0xA9DA, 0xA9DD, 0xA9DE, 0x0000, 0xA9EC, 0xA9ED, 0xA9EB, 0xA9E5, 0xA9E9, 0xA9DB, 0xABF4, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEDA, 0xAC41, 0xABF8, 0xABFA, 0xAC40,
+	0xCEE6, 0xABFD, 0xD1B1, 0xAEB1, 0xAC43, 0xCED7, 0xCEDF, 0xABFE, 0xCEDE, 0xCEDB, 0xCEE3, 0xCEE5, 0xABF7, 0xABFB, 0xAC42, 0xAEB3,
+	0xCEE0, 0xABF9, 0xAC45, 0xCED9, 0x0000, 0x0000, 0x0000, 0xABFC, 0xAEB2, 0xABF6, 0x0000, 0xCED6, 0xCEDD, 0xCED5, 0xCED8, 0xCEDC,
+	0xD1B2, 0xAC44, 0x0000, 0xCEE1, 0xCEE2, 0xCEE4, 0xABF5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAEC1, 0xD1BE, 0xAEBF, 0xAEC0, 0xD1B4, 0xD1C4, 0x0000, 0xAEB6,
+	0x0000, 0x0000, 0xD566, 0xD1C6, 0xD1C0, 0x0000, 0xD1B7, 0x0000, 0xD1C9, 0xD1BA, 0xAEBC, 0xD57D, 0xD1BD, 0xAEBE, 0xAEB5, 0x0000,
+	0xD1CB, 0xD1BF, 0xAEB8, 0xD1B8, 0xD1B5, 0xD1B6, 0xAEB9, 0xD1C5, 0xD1CC, 0xAEBB, 0xD1BC, 0xD1BB, 0xAEC3, 0xAEC2, 0xAEB4, 0xAEBA,
+	0xAEBD, 0xD1C8, 0x0000, 0x0000, 0xD1C2, 0xAEB7, 0xD1B3, 0xD1CA, 0xD1C1, 0xD1C3, 0xD1C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD567, 0x0000, 0xB1B7, 0xB1CB, 0xB1CA, 0x0000, 0xB1BF, 0x0000, 0xD579, 0xD575, 0xD572,
+	0xD5A6, 0xB1BA, 0xB1B2, 0x0000, 0x0000, 0xD577, 0xB4A8, 0xB1B6, 0xD5A1, 0x0000, 0xB1CC, 0xB1C9, 0xD57B, 0xD56A, 0x0000, 0x0000,
+	0xB1C8, 0xD5A3, 0xD569, 0xB1BD, 0xB1C1, 0xD5A2, 0x0000, 0xD573, 0xB1C2, 0xB1BC, 0xD568, 0x0000, 0xB478, 0xD5A5, 0xD571, 0xB1C7,
+	0xD574, 0xD5A4, 0xB1C6, 0x0000, 0xD952, 0x0000, 0xB1B3, 0xD56F, 0xB1B8, 0xB1C3, 0x0000, 0xB1BE, 0xD578, 0xD56E, 0xD56C, 0xD57E,
+	0xB1B0, 0xB1C4, 0xB1B4, 0xB477, 0xD57C, 0xB1B5, 0x0000, 0xB1B1, 0xB1C0, 0xB1BB, 0xB1B9, 0xD570, 0xB1C5, 0xD56D, 0xD57A, 0xD576,
+	0xD954, 0xD953, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD56B, 0xD964, 0x0000,
+	0xB47A, 0x0000, 0xD96A, 0xD959, 0xD967, 0xDD77, 0xB47D, 0xD96B, 0xD96E, 0xB47C, 0xD95C, 0xD96D, 0xD96C, 0xB47E, 0xD955, 0xB479,
+	0xB4A3, 0x0000, 0xB4A1, 0xD969, 0x0000, 0xD95F, 0xB4A5, 0xD970, 0xD968, 0xD971, 0xB4AD, 0xB4AB, 0xD966, 0xD965, 0x0000, 0xD963,
+	0xD95D, 0xB4A4, 0x0000, 0xB4A2, 0xD1B9, 0xD956, 0x0000, 0xDDB7, 0xD957, 0xB47B, 0xB4AA, 0xDD79, 0x0000, 0xB4A6, 0xB4A7, 0xD958,
+	0xD96F, 0xDD78, 0xD960, 0xD95B, 0xB4A9, 0xD961, 0xD95E, 0x0000, 0x0000, 0xB4AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB770, 0x0000, 0x0000, 0xDD7C, 0xDDB1, 0xDDB6, 0xDDAA, 0xB76C, 0xDDBB, 0xB769,
+	0xDD7A, 0x0000, 0xDD7B, 0xB762, 0xB76B, 0xDDA4, 0xB76E, 0xB76F, 0xDDA5, 0x0000, 0xDDB2, 0xDDB8, 0xB76A, 0x0000, 0xB764, 0xDDA3,
+	0xDD7D, 0xDDBA, 0xDDA8, 0xDDA9, 0xDD7E, 0xDDB4, 0xDDAB, 0xDDB5, 0xDDAD, 0x0000, 0xB765, 0xE1D9, 0xB768, 0xB766, 0xDDB9, 0xDDB0,
+	0xDDAC, 0x0000, 0x0000, 0xDDA1, 0xBA53, 0xDDAF, 0xB76D, 0xDDA7, 0x0000, 0xDDA6, 0x0000, 0x0000, 0x0000, 0xB767, 0xB763, 0xE1EE,
+	0xDDB3, 0xDDAE, 0x0000, 0xDDA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE1E9, 0x0000, 0xE1DA, 0xE1E5, 0x0000,
+	0xE1EC, 0xBA51, 0xB4AC, 0xE1EA, 0xBA4C, 0x0000, 0x0000, 0x0000, 0xBA4B, 0xE1F1, 0x0000, 0xE1DB, 0xE1E8, 0xE1DC, 0xE1E7, 0xBA4F,
+	0xE1EB, 0xD962, 0x0000, 0x0000, 0x0000, 0xE1F2, 0xE1E3, 0xBA52, 0xE5BA, 0xBCAF, 0x0000, 0xE1F0, 0xE1EF, 0xBA54, 0xE5AD, 0xBCB0,
+	0xE5AE, 0x0000, 0xE1DF, 0xE1E0, 0xE1DD, 0xE1E2, 0xE1DE, 0xE1F3, 0xBA4E, 0xBCB1, 0xBA50, 0xBA55, 0x0000, 0xE1E1, 0x0000, 0xE1ED,
+	0x0000, 0x0000, 0xE1E6, 0x0000, 0x0000, 0xE5B1, 0x0000, 0xBA4A, 0xBCB4, 0xE9AA, 0xE5B6, 0xE5B5, 0xE5B7, 0x0000, 0x0000, 0xE5B4,
+	0xBCB5, 0x0000, 0xBCBB, 0xBCB8, 0x0000, 0xBCB9, 0xE5AF, 0xE5B2, 0xE5BC, 0xBCC1, 0xBCBF, 0x0000, 0xE5B3, 0xD95A, 0xBCB2, 0xE5B9,
+	0xE5B0, 0x0000, 0xBCC2, 0xE5B8, 0xBA4D, 0xBCB7, 0xE1E4, 0x0000, 0x0000, 0xBCBA, 0x0000, 0xBCBE, 0xBCC0, 0xBCBD, 0xBCBC, 0x0000,
+	0xBCB6, 0xE5BB, 0xBCB3, 0xBCC3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBED8, 0xBED9, 0xE9A9, 0xBEE2, 0xBEDF,
+	0x0000, 0xBED6, 0xBEDD, 0xE9AB, 0xBEDB, 0xBED5, 0x0000, 0xBEDC, 0x0000, 0xE9A8, 0xC0BB, 0xBED7, 0x0000, 0xBEDE, 0xC0BA, 0xE9A7,
+	0xE9A6, 0x0000, 0xBEE0, 0x0000, 0xBEE1, 0x0000, 0xE9A5, 0xE9A4, 0xC0BC, 0xE9AE, 0xBEDA, 0xE9AC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xC0BD, 0x0000, 0xC0C2, 0xECEA, 0xECEC, 0x0000, 0xC0BF, 0x0000, 0xECED, 0xECE9, 0x0000, 0xECEB, 0xC0C0, 0xC0C3, 0x0000, 0xECE8,
+	0xC0BE, 0xC0C1, 0xC259, 0xE9AD, 0xC258, 0x0000, 0x0000, 0xC25E, 0xEFD4, 0x0000, 0xC25C, 0xC25D, 0xEFD7, 0xEFD3, 0xC25A, 0xEFD1,
+	0xC36B, 0xEFD5, 0x0000, 0xEFD6, 0xEFD2, 0x0000, 0xC25B, 0xF242, 0x0000, 0xF245, 0x0000, 0x0000, 0xF246, 0xF244, 0xF247, 0xC36C,
+	0xF243, 0x0000, 0x0000, 0xF44E, 0xC464, 0xF44D, 0xF44C, 0xF44B, 0xC463, 0xC465, 0x0000, 0xF5CD, 0xC4E2, 0xC4E1, 0x0000, 0x0000,
+	0xF6E1, 0xF6E0, 0xF6E3, 0xC5CB, 0xC575, 0xF7DD, 0xF6E2, 0x0000, 0x0000, 0xF7DC, 0xC5CD, 0xC5CC, 0xC5F3, 0xF8A9, 0xF8EF, 0xA4E4,
+	0x0000, 0x0000, 0xD972, 0xE9AF, 0x0000, 0x0000, 0xA6AC, 0xCAF7, 0xA7F1, 0xA7EF, 0x0000, 0xA7F0, 0x0000, 0xCCC1, 0xA9F1, 0xAC46,
+	0x0000, 0xCEE7, 0x0000, 0xCEE8, 0x0000, 0xAC47, 0xD1CE, 0x0000, 0xAEC4, 0xAEC5, 0xD1CD, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1D3,
+	0x0000, 0xB1CF, 0x0000, 0xD5A7, 0xB1D6, 0xB1D5, 0xB1CE, 0xB1D1, 0xB1D4, 0xB1D0, 0x0000, 0x0000, 0xD976, 0xB1CD, 0xB4AF, 0x0000,
+	0x0000, 0x0000, 0xB4B1, 0xB4B2, 0xD975, 0xD978, 0xB4B0, 0xD973, 0xD977, 0x0000, 0xD974, 0x0000, 0xB771, 0x0000, 0x0000, 0xDDBC,
+	0x0000, 0x0000, 0xBA56, 0xE1F4, 0xBEE3, 0xBCC4, 0xE5BD, 0xBCC5, 0xBCC6, 0xE5BF, 0xE5BE, 0xE5C0, 0xE9B1, 0x0000, 0x0000, 0xE9B0,
+	0xECEF, 0xECEE, 0xC0C4, 0xC0C5, 0xF248, 0x0000, 0x0000, 0xA4E5, 0x0000, 0x0000, 0x0000, 0x0000, 0xD979, 0x0000, 0x0000, 0x0000,
+	0xB4B4, 0xB4B3, 0xDDBD, 0x0000, 0xEFD8, 0xC4E3, 0xF7DE, 0xA4E6, 0x0000, 0xAEC6, 0x0000, 0xB1D8, 0xB1D7, 0xD97A, 0xD97B, 0xB772,
+	0xE1F5, 0xBA57, 0xE9B2, 0x0000, 0xA4E7, 0xA5B8, 0x0000, 0xA9F2, 0xCCC2, 0x0000, 0xCEE9, 0xAC48, 0xB1D9, 0x0000, 0xD97C, 0xB4B5,
+	0xB773, 0x0000, 0xE5C1, 0xE5C2, 0x0000, 0x0000, 0xECF0, 0xC25F, 0xF8F0, 0xA4E8, 0x0000, 0xCCC3, 0xA9F3, 0xAC49, 0x0000, 0xCEEA,
+	0x0000, 0xAEC7, 0xD1D2, 0xD1D0, 0xD1D1, 0xAEC8, 0xD1CF, 0x0000, 0x0000, 0x0000, 0x0000, 0xB1DB, 0xB1DC, 0xD5A8, 0xB1DD, 0xB1DA,
+	0xD97D, 0x0000, 0xD97E, 0xDDBE, 0x0000, 0x0000, 0xBA59, 0xBA58, 0x0000, 0x0000, 0xECF1, 0xEFD9, 0x0000, 0xF24A, 0xF249, 0xF44F,
+	0x0000, 0xC95E, 0xAC4A, 0x0000, 0x0000, 0xA4E9, 0xA5B9, 0x0000, 0xA6AE, 0xA6AD, 0x0000, 0x0000, 0xA6AF, 0xA6B0, 0xC9EE, 0xC9ED,
+	0xCAF8, 0xA7F2, 0xCAFB, 0xCAFA, 0xCAF9, 0xCAFC, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9F4, 0xCCC9, 0xCCC5, 0xCCCE, 0x0000, 0x0000,
+	0xA9FB, 0x0000, 0xA9F9, 0xCCCA, 0xCCC6, 0xCCCD, 0xA9F8, 0xAA40, 0xCCC8, 0xCCC4, 0xA9FE, 0xCCCB, 0xA9F7, 0xCCCC, 0xA9FA, 0xA9FC,
+	0xCCD0, 0xCCCF, 0xCCC7, 0xA9F6, 0xA9F5, 0xA9FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEEF, 0xCEF5, 0x0000, 0xAC50,
+	0xAC4D, 0xCEEC, 0xCEF1, 0x0000, 0xAC53, 0xAC4B, 0xCEF0, 0xAC4E, 0xAC51, 0x0000, 0x0000, 0xCEF3, 0x0000, 0xAC4C, 0xCEF8, 0xAC4F,
+	0x0000, 0xAC52, 0xCEED, 0xCEF2, 0xCEF6, 0xCEEE, 0xCEEB, 0x0000, 0x0000, 0xCEF7, 0xCEF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xAED0, 0xAEC9, 0xAECC, 0x0000, 0xAECF, 0x0000, 0xD1D5, 0x0000, 0xAECA, 0xD1D3, 0x0000, 0xAECE, 0x0000, 0x0000, 0xAECB,
+	0x0000, 0xD1D6, 0xAECD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5AC, 0xB1DF, 0xD5AB, 0xD5AD, 0xB1DE, 0xB1E3, 0xD1D4,
+	0x0000, 0xD5AA, 0xD5AE, 0x0000, 0xB1E0, 0xD5A9, 0xB1E2, 0x0000, 0xB1E1, 0x0000, 0xD9A7, 0x0000, 0xD9A2, 0x0000, 0xB4B6, 0xB4BA,
+	0xB4B7, 0xD9A5, 0xD9A8, 0x0000, 0xB4B8, 0x0000, 0xB4B9, 0xB4BE, 0xDDC7, 0xD9A6, 0xB4BC, 0xD9A3, 0xD9A1, 0x0000, 0xB4BD, 0x0000,
+	0xD9A4, 0x0000, 0x0000, 0x0000, 0xB779, 0x0000, 0xDDBF, 0xB776, 0xB777, 0xB775, 0xDDC4, 0xDDC3, 0xDDC0, 0xB77B, 0x0000, 0x0000,
+	0xDDC2, 0xB4BB, 0x0000, 0x0000, 0xDDC6, 0xDDC1, 0xB778, 0xB774, 0xB77A, 0xDDC5, 0x0000, 0x0000, 0x0000, 0xBA5C, 0x0000, 0xE1F8,
+	0xE1F7, 0xE1F6, 0xBA5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBA5B, 0xE5C5, 0xE5C8, 0xBCC8, 0x0000, 0x0000, 0xBCC7, 0xE5C9,
+	0xE5C4, 0xBCCA, 0xE5C6, 0x0000, 0xBCC9, 0xE5C3, 0x0000, 0xE5C7, 0xBEE9, 0xBEE6, 0xE9BB, 0xE9BA, 0x0000, 0xE9B9, 0xE9B4, 0x0000,
+	0xE9B5, 0x0000, 0x0000, 0x0000, 0xBEE7, 0x0000, 0xBEE4, 0xBEE8, 0xE9B3, 0xBEE5, 0xE9B6, 0xE9B7, 0xE9BC, 0x0000, 0x0000, 0xE9B8,
+	0x0000, 0x0000, 0xECF2, 0x0000, 0x0000, 0x0000, 0xC0C7, 0x0000, 0xEFDC, 0xC0C6, 0xEFDA, 0xEFDB, 0xC260, 0xC36E, 0xF24B, 0x0000,
+	0xC36D, 0x0000, 0x0000, 0xF451, 0xF452, 0x0000, 0xC466, 0x0000, 0xF450, 0xC4E4, 0x0000, 0xF7DF, 0xC5CE, 0xF8AA, 0xF8AB, 0x0000,
+	0xA4EA, 0x0000, 0xA6B1, 0xA6B2, 0xA7F3, 0x0000, 0xCCD1, 0xAC54, 0xAED1, 0xB1E4, 0x0000, 0x0000, 0xB0D2, 0x0000, 0xB4BF, 0xB4C0,
+	0xB3CC, 0xD9A9, 0x0000, 0xB77C, 0xE1FA, 0xE1F9, 0x0000, 0x0000, 0xA4EB, 0xA6B3, 0xCCD2, 0xAA42, 0x0000, 0xAA41, 0x0000, 0xCEF9,
+	0xCEFA, 0x0000, 0xD1D7, 0xD1D8, 0xAED2, 0xAED3, 0x0000, 0xAED4, 0xD5AF, 0x0000, 0x0000, 0xB1E6, 0x0000, 0xB4C2, 0x0000, 0xB4C1,
+	0xDDC8, 0xDF7A, 0xE1FB, 0xE9BD, 0x0000, 0x0000, 0xC261, 0xC467, 0xA4EC, 0x0000, 0xA5BC, 0xA5BD, 0xA5BB, 0xA5BE, 0xA5BA, 0x0000,
+	0x0000, 0xA6B6, 0x0000, 0xC9F6, 0xA6B5, 0xA6B7, 0x0000, 0x0000, 0xC9F1, 0xC9F0, 0xC9F3, 0xC9F2, 0xC9F5, 0xA6B4, 0xC9EF, 0xC9F4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCAFD, 0xA7FD, 0xCAFE, 0xCB43, 0xA7FC, 0x0000, 0xCB47, 0xCB42, 0xCB45, 0xA7F5, 0xA7F6,
+	0xA7F7, 0xA7F8, 0x0000, 0xA840, 0x0000, 0xCB41, 0xA7FA, 0xA841, 0x0000, 0xCB40, 0xCB46, 0x0000, 0xA7F9, 0xCB44, 0xA7FB, 0xA7F4,
+	0xA7FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA57, 0x0000, 0xCCD4, 0xAA43, 0x0000, 0xAA4D,
+	0xAA4E, 0xAA46, 0xAA58, 0xAA48, 0xCCDC, 0xAA53, 0xCCD7, 0xAA49, 0xCCE6, 0xCCE7, 0xCCDF, 0xCCD8, 0xAA56, 0xCCE4, 0xAA51, 0xAA4F,
+	0x0000, 0xCCE5, 0x0000, 0xCCE3, 0xCCDB, 0xCCD3, 0xCCDA, 0xAA4A, 0x0000, 0xAA50, 0x0000, 0xAA44, 0xCCDE, 0xCCDD, 0xCCD5, 0x0000,
+	0xAA52, 0xCCE1, 0xCCD6, 0xAA55, 0xCCE8, 0xAA45, 0x0000, 0xAA4C, 0xCCD9, 0xCCE2, 0xAA54, 0x0000, 0xAA47, 0xAA4B, 0x0000, 0xCCE0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF5B, 0xAC5C,
+	0xAC69, 0x0000, 0xCF56, 0xCF4C, 0xAC62, 0xCF4A, 0xAC5B, 0xCF45, 0xAC65, 0xCF52, 0xCEFE, 0xCF41, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCF44, 0xCEFB, 0xCF51, 0xCF61, 0xAC60, 0xCF46, 0xCF58, 0x0000, 0xCEFD, 0xCF5F, 0xCF60, 0xCF63, 0xCF5A, 0xCF4B, 0xCF53, 0xAC66,
+	0xAC59, 0xAC61, 0xAC6D, 0xAC56, 0xAC58, 0x0000, 0x0000, 0x0000, 0xCF43, 0xAC6A, 0xAC63, 0xCF5D, 0xCF40, 0xAC6C, 0xAC67, 0xCF49,
+	0x0000, 0x0000, 0xAC6B, 0xCF50, 0xCF48, 0xAC64, 0xCF5C, 0xCF54, 0x0000, 0xAC5E, 0xCF62, 0xCF47, 0xAC5A, 0xCF59, 0xCF4F, 0xAC5F,
+	0xCF55, 0xAC57, 0xCEFC, 0xAC68, 0xAEE3, 0xAC5D, 0xCF4E, 0xCF4D, 0xCF42, 0x0000, 0xCF5E, 0x0000, 0xCF57, 0x0000, 0x0000, 0xAC55,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD1EC, 0xAEEA, 0xD1ED, 0x0000, 0xD1E1, 0xAEDF, 0xAEEB, 0x0000, 0xD1DA, 0x0000, 0xD1E3, 0xD1EB, 0x0000, 0xD1D9,
+	0xD1F4, 0xAED5, 0x0000, 0x0000, 0x0000, 0xD1F3, 0xD1EE, 0x0000, 0xD1EF, 0xAEDD, 0xAEE8, 0xD1E5, 0x0000, 0xD1E6, 0xD1F0, 0xD1E7,
+	0x0000, 0xD1E2, 0xD1DC, 0xD1DD, 0xD1EA, 0xD1E4, 0x0000, 0x0000, 0xAED6, 0xAEDA, 0xD1F2, 0xD1DE, 0xAEE6, 0xAEE2, 0x0000, 0x0000,
+	0xAEE5, 0xAEEC, 0xAEDB, 0xAEE7, 0xD1E9, 0xAEE9, 0xAED8, 0x0000, 0xAED7, 0xD1DB, 0x0000, 0xD1DF, 0xAEE0, 0xD1F1, 0xD1E8, 0xD1E0,
+	0xAEE4, 0xAEE1, 0x0000, 0xAED9, 0xAEDC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD5C4, 0x0000, 0xD5B4, 0xD5B5, 0xD5B9,
+	0x0000, 0xD5C8, 0xD5C5, 0x0000, 0xD5BE, 0xD5BD, 0xB1ED, 0xD5C1, 0xD5D0, 0xD5B0, 0x0000, 0xD5D1, 0xD5C3, 0xD5D5, 0xD5C9, 0xB1EC,
+	0xD5C7, 0xB1E7, 0xB1FC, 0xB1F2, 0x0000, 0xB1F6, 0xB1F5, 0xD5B1, 0x0000, 0xD5CE, 0xD5D4, 0xD5CC, 0xD5D3, 0x0000, 0x0000, 0xD5C0,
+	0xD5B2, 0xD5D2, 0xD5C2, 0xB1EA, 0xB1F7, 0x0000, 0xD5CB, 0xB1F0, 0x0000, 0x0000, 0x0000, 0xD5CA, 0xD5B3, 0xB1F8, 0x0000, 0xB1FA,
+	0xD5CD, 0xB1FB, 0xB1E9, 0xD5BA, 0xD5CF, 0x0000, 0x0000, 0xB1EF, 0xB1F9, 0xD5BC, 0xD5C6, 0xD5B7, 0xD5BB, 0xB1F4, 0xD5B6, 0xB1E8,
+	0xB1F1, 0xB1EE, 0xD5BF, 0xAEDE, 0xD9C0, 0xB1EB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xB1F3, 0x0000, 0xD9C3, 0xD9D9, 0xD9CE, 0xB4D6, 0x0000, 0xB4D1, 0xD9BD, 0xB4D2, 0xD9CD, 0x0000,
+	0xD9C6, 0xD9D3, 0xB4CE, 0xD9AB, 0xD9D5, 0xB4C4, 0xD9B3, 0xB4C7, 0xB4C6, 0x0000, 0xB4D7, 0x0000, 0xD9AD, 0xD9CF, 0xD9D0, 0xB4C9,
+	0xB4C5, 0xD9BB, 0x0000, 0xB4D0, 0xD9B6, 0x0000, 0xD9D1, 0xB4CC, 0xD9C9, 0xD9D6, 0xD9B0, 0xD9B5, 0xD9AF, 0x0000, 0xB4CB, 0xD9C2,
+	0xDDDE, 0xD9B1, 0xB4CF, 0xD9BA, 0xD9D2, 0xB4CA, 0xD9B7, 0xD9B4, 0xD9C5, 0xB4CD, 0xB4C3, 0xB4D9, 0xD9C8, 0xD9C7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD9AC, 0xB4C8, 0xD9D4, 0xD9BC, 0xD9BE, 0x0000, 0xD9CB, 0xD9CA, 0xD9AA, 0xB4D3, 0xB4D5, 0xD9B2,
+	0xD9B9, 0xD9C1, 0xB4D4, 0xD9B8, 0xD9C4, 0xD9D7, 0x0000, 0xD9CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9D8, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9AE, 0x0000, 0x0000, 0x0000, 0x0000, 0xDDF2,
+	0xB7A6, 0x0000, 0xDDF0, 0xDDDB, 0xDDE0, 0xDDD9, 0x0000, 0xDDEC, 0xDDCB, 0xDDD2, 0x0000, 0xDDEA, 0xDDF4, 0xDDDC, 0x0000, 0xDDCF,
+	0xDDE2, 0xDDE7, 0xDDD3, 0x0000, 0xDDE4, 0xDDD0, 0x0000, 0x0000, 0xDDD7, 0xDDD8, 0xB7A8, 0xDDEB, 0xDDE9, 0x0000, 0xDDCC, 0xDDEE,
+	0x0000, 0xDDEF, 0xDDF1, 0xB7AC, 0xB7A4, 0x0000, 0xD5B8, 0xDDD4, 0xDDE6, 0xDDD5, 0xB7A1, 0xB7B1, 0xDDED, 0xB7AF, 0xB7AB, 0xDDCA,
+	0xB7A3, 0x0000, 0xDDCD, 0xB7B0, 0x0000, 0xDDDD, 0xDDC9, 0x0000, 0xB7A9, 0xDDE1, 0xDDD1, 0xB7AA, 0xDDDA, 0xB77E, 0xB4D8, 0xDDE3,
+	0xD9BF, 0xDDCE, 0x0000, 0x0000, 0xDDE8, 0xB7A5, 0xDDE5, 0xB7A2, 0xDDDF, 0xB7AD, 0xDDD6, 0xDDF3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xB7A7, 0xDEC6, 0x0000, 0x0000, 0xB7AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE24A, 0xE248, 0x0000,
+	0xE25E, 0xE246, 0x0000, 0xE258, 0xB77D, 0xBA5F, 0xE242, 0xE25D, 0x0000, 0xE247, 0xE255, 0xBA64, 0xBA5D, 0x0000, 0xE25B, 0x0000,
+	0xE240, 0xE25A, 0x0000, 0xBA6F, 0xE251, 0xE261, 0xBA6D, 0xE249, 0xBA5E, 0xE24B, 0xE259, 0xBA67, 0xE244, 0xBA6B, 0xBA61, 0xE24D,
+	0xE243, 0xE1FC, 0x0000, 0xE257, 0xBA68, 0xE260, 0xE1FD, 0xBA65, 0x0000, 0xE253, 0x0000, 0xBA66, 0xE245, 0xE250, 0xE24C, 0xE24E,
+	0x0000, 0xBA60, 0xE25F, 0xBA6E, 0xE24F, 0x0000, 0xE262, 0x0000, 0x0000, 0xE1FE, 0xE254, 0xBA63, 0xBA6C, 0xBA6A, 0xE241, 0xE256,
+	0xBA69, 0x0000, 0x0000, 0xBA62, 0xE252, 0x0000, 0x0000, 0x0000, 0x0000, 0xE25C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE5D5, 0x0000, 0xE5D1, 0xE5CD, 0xE5E1, 0xE5DE, 0xBCCD, 0x0000, 0x0000, 0xE5E5, 0xE5D4, 0xBCD8, 0xE5DB, 0x0000,
+	0x0000, 0xE5D0, 0xE5DA, 0xBCD5, 0xE5EE, 0x0000, 0xE5EB, 0xE5DD, 0xE5CE, 0x0000, 0x0000, 0xE5E2, 0xE5E4, 0xBCD1, 0xE5D8, 0xE5D3,
+	0xE5CA, 0xBCCE, 0xBCD6, 0x0000, 0xE5E7, 0xBCD7, 0xE5CB, 0xE5ED, 0xE5E0, 0xE5E6, 0xBCD4, 0x0000, 0x0000, 0xE5E3, 0x0000, 0xE5EA,
+	0x0000, 0xBCD9, 0x0000, 0xBCD3, 0xE5DC, 0xE5CF, 0xE5EF, 0xE5CC, 0xE5E8, 0xBCD0, 0x0000, 0xE5D6, 0x0000, 0xE5D7, 0xBCCF, 0xBCCC,
+	0xE5D2, 0xBCD2, 0x0000, 0xBCCB, 0x0000, 0xE5E9, 0xE5EC, 0xE5D9, 0xE9CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE9C2, 0x0000, 0xE9BE, 0xBEF6, 0x0000, 0x0000, 0xBEEB, 0xBEF0, 0xBEEC, 0xE9CC, 0xE9D7, 0xBEEA, 0xE9C4, 0xE9CD,
+	0xE5DF, 0xE9CE, 0x0000, 0x0000, 0xBEF1, 0x0000, 0xE9DD, 0xBEF5, 0xBEF8, 0xE9C0, 0x0000, 0xBEF4, 0x0000, 0xE9DB, 0xE9DC, 0xE9D2,
+	0xE9D1, 0xE9C9, 0x0000, 0x0000, 0xE9D3, 0xE9DA, 0xE9D9, 0x0000, 0xBEEF, 0xBEED, 0xE9CB, 0xE9C8, 0x0000, 0xE9C5, 0xE9D8, 0xBEF7,
+	0xE9D6, 0xBEF3, 0xBEF2, 0x0000, 0xE9D0, 0x0000, 0xE9BF, 0xE9C1, 0xE9C3, 0xE9D5, 0xE9CF, 0xBEEE, 0x0000, 0xE9C6, 0x0000, 0xE9D4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0CF, 0xED45,
+	0xC0C8, 0xECF5, 0x0000, 0xED41, 0xC0CA, 0xED48, 0x0000, 0xECFC, 0x0000, 0xECF7, 0x0000, 0x0000, 0xED49, 0xECF3, 0xECFE, 0x0000,
+	0xC0D1, 0xED44, 0xED4A, 0xECFD, 0xC0C9, 0xED40, 0xECF4, 0xC0D0, 0x0000, 0x0000, 0xED47, 0xECF9, 0xC0CC, 0x0000, 0xECFB, 0xECF8,
+	0xC0D2, 0xECFA, 0xC0CB, 0xC0CE, 0xED43, 0xECF6, 0xED46, 0x0000, 0xED42, 0x0000, 0x0000, 0x0000, 0xC263, 0xEFE7, 0xC268, 0xC269,
+	0x0000, 0x0000, 0x0000, 0xC262, 0xEFE6, 0x0000, 0xEFE3, 0xEFE4, 0xC266, 0xEFDE, 0xEFE2, 0xC265, 0x0000, 0xEFDF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xC267, 0xC264, 0x0000, 0xEFDD, 0xEFE1, 0xEFE5, 0x0000, 0x0000, 0x0000, 0xF251, 0xF24E, 0xF257, 0x0000, 0xF256,
+	0xF254, 0xF24F, 0x0000, 0xC372, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF250, 0xC371, 0xC0CD, 0xF253, 0xC370, 0xF258, 0xF252,
+	0xF24D, 0xEFE0, 0x0000, 0x0000, 0x0000, 0xC36F, 0x0000, 0xF24C, 0xF456, 0x0000, 0xF455, 0xF255, 0xC468, 0x0000, 0xF459, 0xF45A,
+	0xF454, 0xF458, 0x0000, 0xF453, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5D1, 0xF457, 0xC4E7, 0xC4E5, 0xF5CF, 0x0000, 0x0000, 0x0000,
+	0xF5D2, 0x0000, 0xF5CE, 0xF5D0, 0xC4E6, 0x0000, 0x0000, 0x0000, 0xF6E5, 0xF6E6, 0xC576, 0xF6E4, 0x0000, 0x0000, 0x0000, 0xF7E2,
+	0xC5CF, 0xF7E0, 0xF7E1, 0xF8AC, 0x0000, 0x0000, 0xC656, 0xF8F3, 0xF8F1, 0xF8F2, 0xF8F4, 0x0000, 0x0000, 0x0000, 0xF9BB, 0x0000,
+	0xA4ED, 0xA6B8, 0x0000, 0xAA59, 0x0000, 0xCCE9, 0x0000, 0x0000, 0xCF64, 0x0000, 0x0000, 0x0000, 0xD1F5, 0xD1F7, 0x0000, 0xD1F6,
+	0x0000, 0xD1F8, 0xB1FD, 0xD5D7, 0xD1F9, 0x0000, 0xD5D6, 0xD5D8, 0xD5D9, 0xD9DA, 0xB4DB, 0xD9DB, 0xD9DD, 0xB4DC, 0xB4DA, 0xD9DC,
+	0x0000, 0xDDFA, 0xDDF8, 0xDDF7, 0x0000, 0xDDF6, 0xDDF5, 0xB7B2, 0xDDF9, 0xBA70, 0xE263, 0xE265, 0xBA71, 0xE264, 0xBCDB, 0x0000,
+	0xBCDA, 0xE5F0, 0x0000, 0x0000, 0xE9DF, 0xE9DE, 0xE9E0, 0x0000, 0x0000, 0xBEF9, 0x0000, 0xED4B, 0xC0D3, 0x0000, 0xEFE8, 0xC26A,
+	0xF259, 0xC577, 0xA4EE, 0xA5BF, 0xA6B9, 0xA842, 0xAA5A, 0xAA5B, 0x0000, 0x0000, 0xAC6E, 0x0000, 0x0000, 0xD1FA, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xB7B3, 0x0000, 0x0000, 0x0000, 0xE6D1, 0xBEFA, 0xC26B, 0xA4EF, 0x0000, 0xA6BA, 0x0000, 0x0000, 0xCCEB, 0xAA5C,
+	0xCCEA, 0x0000, 0xCF65, 0xAC6F, 0xCF66, 0x0000, 0xAC70, 0x0000, 0xD1FC, 0xAEEE, 0xAEED, 0x0000, 0xD5DE, 0xD5DC, 0xD5DD, 0xD5DB,
+	0x0000, 0xD5DA, 0x0000, 0x0000, 0xD9DE, 0xD9E1, 0xB4DE, 0xD9DF, 0xB4DD, 0xD9E0, 0x0000, 0xDDFB, 0x0000, 0x0000, 0xE266, 0xE267,
+	0xE268, 0x0000, 0xE5F3, 0xE5F2, 0xBCDC, 0xE5F1, 0xE5F4, 0xE9E1, 0x0000, 0x0000, 0xE9E2, 0xE9E3, 0x0000, 0xED4C, 0xC0D4, 0xC26C,
+	0xF25A, 0x0000, 0xC4E8, 0xC95F, 0x0000, 0xAC71, 0xCF67, 0xAEEF, 0x0000, 0x0000, 0xB1FE, 0x0000, 0xB4DF, 0xD9E2, 0x0000, 0xB7B5,
+	0xB7B4, 0x0000, 0x0000, 0xE269, 0xE26A, 0xBCDD, 0xBCDE, 0xE9E5, 0xE9E4, 0xEFE9, 0xF7E3, 0xA4F0, 0xC960, 0xA5C0, 0x0000, 0xA843,
+	0xCB48, 0x0000, 0xAC72, 0xB7B6, 0xA4F1, 0x0000, 0xCF68, 0xAC73, 0xCF69, 0x0000, 0xC0D5, 0xA4F2, 0x0000, 0x0000, 0xCCEC, 0x0000,
+	0xCF6A, 0x0000, 0xD242, 0xD241, 0xD1FE, 0x0000, 0xD1FD, 0xD243, 0xD240, 0x0000, 0x0000, 0xB240, 0xB241, 0x0000, 0x0000, 0xB4E0,
+	0xD9E3, 0x0000, 0xD9E4, 0xD9E5, 0x0000, 0x0000, 0x0000, 0xDE41, 0xDE42, 0xDE40, 0x0000, 0xDDFD, 0xDDFE, 0xB7B7, 0xE26B, 0xE5F7,
+	0xE5F6, 0xE5F5, 0xE5F8, 0xE9E7, 0xE9E6, 0xBEFB, 0xE9E8, 0x0000, 0xC0D6, 0xED4D, 0x0000, 0xEFEA, 0xF25B, 0xF6E7, 0x0000, 0xA4F3,
+	0xA5C2, 0xA5C1, 0x0000, 0xAA5D, 0xC961, 0xC97E, 0xA6BB, 0x0000, 0xC9F7, 0xCB49, 0xCB4A, 0xAA5E, 0x0000, 0xCCED, 0x0000, 0xAC74,
+	0xCF6B, 0xCF6C, 0x0000, 0xAEF0, 0xAEF4, 0xD244, 0xAEF3, 0xAEF1, 0xAEF2, 0x0000, 0xD5DF, 0xB242, 0xB4E3, 0x0000, 0xB4E1, 0xB4E2,
+	0xD9E6, 0x0000, 0x0000, 0xBA72, 0xA4F4, 0x0000, 0xC9A1, 0x0000, 0xA5C3, 0x0000, 0x0000, 0xC9A4, 0x0000, 0x0000, 0xA5C6, 0xC9A3,
+	0xA5C5, 0xA5C4, 0xA844, 0xC9A2, 0x0000, 0x0000, 0xC9F8, 0x0000, 0x0000, 0x0000, 0xC9FC, 0xC9FE, 0xCA40, 0xA6C5, 0xA6C6, 0xC9FB,
+	0xA6C1, 0x0000, 0xC9F9, 0x0000, 0xC9FD, 0xA6C2, 0x0000, 0xA6BD, 0x0000, 0xA6BE, 0x0000, 0xA6C4, 0xC9FA, 0xA6BC, 0xA845, 0xA6BF,
+	0xA6C0, 0xA6C3, 0x0000, 0x0000, 0x0000, 0xCB5B, 0xCB59, 0xCB4C, 0xA851, 0xCB53, 0xA84C, 0xCB4D, 0x0000, 0xCB55, 0x0000, 0xCB52,
+	0xA84F, 0xCB51, 0xA856, 0xCB5A, 0xA858, 0x0000, 0xA85A, 0x0000, 0xCB4B, 0x0000, 0xA84D, 0xCB5C, 0x0000, 0xA854, 0xA857, 0x0000,
+	0xCD45, 0xA847, 0xA85E, 0xA855, 0xCB4E, 0xA84A, 0xA859, 0xCB56, 0xA848, 0xA849, 0xCD43, 0xCB4F, 0xA850, 0xA85B, 0xCB5D, 0xCB50,
+	0xA84E, 0x0000, 0xA853, 0xCCEE, 0xA85C, 0xCB57, 0xA852, 0x0000, 0xA85D, 0xA846, 0xCB54, 0xA84B, 0xCB58, 0xCD44, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAA6A, 0xAA7A, 0xCCF5, 0xAA71, 0x0000,
+	0xCD4B, 0xAA62, 0x0000, 0xAA65, 0xCD42, 0x0000, 0xCCF3, 0xCCF7, 0xAA6D, 0xAA6F, 0xCCFA, 0xAA76, 0xAA68, 0xAA66, 0xAA67, 0xAA75,
+	0xCD47, 0xAA70, 0xCCF9, 0xCCFB, 0xAA6E, 0xAA73, 0xCCFC, 0xCD4A, 0x0000, 0xAC75, 0xAA79, 0x0000, 0xAA63, 0xCD49, 0x0000, 0xCD4D,
+	0xCCF8, 0xCD4F, 0xCD40, 0xAA6C, 0xCCF4, 0xAA6B, 0xAA7D, 0xAA72, 0x0000, 0xCCF2, 0xCF75, 0xAA78, 0xAA7C, 0xCD41, 0xCD46, 0x0000,
+	0xAA7E, 0xAA77, 0xAA69, 0xAA5F, 0x0000, 0xAA64, 0x0000, 0xCCF6, 0xAA60, 0xCD4E, 0x0000, 0xCCF0, 0xCCEF, 0xCCFD, 0xCCF1, 0xAA7B,
+	0xAEF5, 0xAA74, 0xCCFE, 0xAA61, 0x0000, 0xACA6, 0x0000, 0x0000, 0x0000, 0xCD4C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xCF7C, 0xCFA1, 0x0000, 0xCFA4, 0xCF77, 0x0000, 0x0000, 0xCFA7, 0xCFAA, 0xCFAC, 0xCF74, 0xAC76, 0xAC7B, 0xD249, 0xACAD, 0xCFA5,
+	0xCFAD, 0xCF7B, 0xCF73, 0x0000, 0x0000, 0x0000, 0xD264, 0xAC7E, 0xCFA2, 0xCF78, 0xCF7A, 0xACA5, 0x0000, 0xCF7D, 0xAC7D, 0xCF70,
+	0xCFA8, 0x0000, 0xCFAB, 0x0000, 0x0000, 0xAC7A, 0x0000, 0xACA8, 0xCF6D, 0xACAA, 0xAC78, 0xACAE, 0xCFA9, 0xCF6F, 0xACAB, 0xD25E,
+	0xCD48, 0xAC7C, 0xAC77, 0xCF76, 0xCF6E, 0xACAC, 0xACA4, 0xCFA3, 0xACA9, 0xACA7, 0xCF79, 0xACA1, 0xCF71, 0xACA2, 0xACA3, 0xCF72,
+	0xCFA6, 0xAC79, 0xCF7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD24C, 0xAEFD, 0xAF43, 0x0000, 0x0000, 0x0000, 0xD255, 0xD25B,
+	0xD257, 0xD24A, 0xD24D, 0xD246, 0xD247, 0xAF4A, 0xAEFA, 0xD256, 0xD25F, 0xAF45, 0xAEF6, 0x0000, 0xAF40, 0xD24E, 0xAF42, 0xD24F,
+	0xD259, 0x0000, 0x0000, 0x0000, 0xAF44, 0xD268, 0xD248, 0xAEFC, 0xAEFB, 0xAF48, 0xD245, 0xD266, 0xD25A, 0xD267, 0xD261, 0xD253,
+	0xD262, 0x0000, 0xD25C, 0xD265, 0xD263, 0xAF49, 0xD254, 0xAEF9, 0xAEF8, 0xAF41, 0xAF47, 0xD260, 0xAF46, 0xD251, 0xB243, 0x0000,
+	0xD269, 0xD250, 0xD24B, 0xAEFE, 0xAF4B, 0xAEF7, 0x0000, 0xD258, 0xD25D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB265, 0xD5E1, 0xD5E5, 0x0000, 0xB252, 0xB250,
+	0x0000, 0x0000, 0xB247, 0xD5E3, 0xD5E2, 0xB25B, 0x0000, 0xD5E8, 0xB255, 0x0000, 0xD5FA, 0xD647, 0xB244, 0xD5F7, 0xD5F0, 0xB267,
+	0xD5E0, 0x0000, 0xD5FC, 0x0000, 0xB264, 0xB258, 0xB263, 0xB24E, 0xD5EC, 0xD5FE, 0xD5F6, 0xB24F, 0xB249, 0xD645, 0x0000, 0xD5FD,
+	0xD640, 0xB251, 0xB259, 0xD642, 0xD5EA, 0xD5FB, 0xD5EF, 0xD644, 0xB25E, 0xB246, 0xB25C, 0xD5F4, 0xD5F2, 0xD5F3, 0xB253, 0xD5EE,
+	0xD5ED, 0xB248, 0xD5E7, 0xD646, 0xB24A, 0xD5F1, 0xB268, 0x0000, 0xB262, 0xD5E6, 0xB25F, 0xB25D, 0xB266, 0xD5F8, 0xB261, 0xD252,
+	0xD5F9, 0xB260, 0xD641, 0xB245, 0xD5F5, 0xB257, 0xD5E9, 0xB256, 0x0000, 0xB254, 0xB24C, 0xB24B, 0xD9E7, 0xD643, 0x0000, 0x0000,
+	0xD5EB, 0x0000, 0x0000, 0xD9FC, 0x0000, 0xB24D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB541, 0xB25A, 0xB4EE, 0xD9F6, 0xB4FC, 0x0000, 0xD9EA,
+	0xB4EB, 0xB4E7, 0xDA49, 0xB4ED, 0xB4F1, 0xB4EC, 0xB4F5, 0xDA4D, 0xDA44, 0x0000, 0x0000, 0xD9F1, 0xB4FA, 0xB4F4, 0xD9FD, 0xB4E4,
+	0xDA4A, 0xDA43, 0xB4E8, 0xD9F7, 0xB4F7, 0xDA55, 0xDA56, 0x0000, 0xB4E5, 0xDA48, 0xB4F9, 0xD9FB, 0xD9ED, 0xD9EE, 0xB4FD, 0xD9F2,
+	0xD9F9, 0xD9F3, 0x0000, 0xB4FB, 0xB544, 0xD9EF, 0xD9E8, 0xD9E9, 0x0000, 0xD9EB, 0xB4EA, 0xD9F8, 0x0000, 0xB4F8, 0xB542, 0x0000,
+	0x0000, 0xD9FA, 0xDA53, 0xDA4B, 0xB4E6, 0xDA51, 0xB4F2, 0x0000, 0xB4F0, 0x0000, 0xDA57, 0xB4EF, 0xDA41, 0xD9F4, 0xD9FE, 0xB547,
+	0xDA45, 0xDA42, 0xD9F0, 0xB543, 0xDA4F, 0xDA4C, 0xDA54, 0xB4E9, 0xDA40, 0xB546, 0x0000, 0xDA47, 0x0000, 0x0000, 0xB4F3, 0xB4F6,
+	0x0000, 0xDA46, 0xB545, 0xD9F5, 0xD5E4, 0x0000, 0x0000, 0xDA50, 0xDA4E, 0xDA52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD9EC, 0xB540, 0x0000, 0x0000, 0x0000, 0xDE61, 0xDE60, 0xDE46,
+	0xB7BD, 0x0000, 0xDE5F, 0xDE49, 0xDE4A, 0x0000, 0xB7C7, 0xDE68, 0xB7C2, 0xDE5E, 0x0000, 0xDE43, 0xB7C8, 0xB7BE, 0xDE52, 0xDE48,
+	0xDE4B, 0xDE63, 0xB7B8, 0xDE6A, 0xDE62, 0xB7C1, 0xDE57, 0xB7CC, 0x0000, 0x0000, 0xB7CB, 0xB7C5, 0x0000, 0x0000, 0xDE69, 0xB7B9,
+	0xDE55, 0xDE4C, 0xDE59, 0xDE65, 0xB7CD, 0x0000, 0xB7BB, 0xDE54, 0x0000, 0xDE4D, 0xB7C4, 0x0000, 0xB7C3, 0xDE50, 0xDE5A, 0xDE64,
+	0xDE47, 0xDE51, 0xB7BC, 0xDE5B, 0xB7C9, 0xB7C0, 0xDE4E, 0xB7BF, 0xDE45, 0xDE53, 0xDE67, 0xB4FE, 0xBAB0, 0xDE56, 0xE26C, 0xDE58,
+	0xDE66, 0xB7C6, 0xDE4F, 0xB7BA, 0xB7CA, 0xBCF0, 0xDE44, 0x0000, 0xDE5D, 0x0000, 0x0000, 0x0000, 0xDE5C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2AA, 0xBAAD, 0xE27D, 0xE2A4, 0xBAA2,
+	0x0000, 0xE26E, 0xBAAF, 0x0000, 0xBA77, 0xE26D, 0xE2B0, 0xBAB1, 0xE271, 0xE2A3, 0x0000, 0xE273, 0xE2B3, 0xE2AF, 0xBA75, 0xBAA1,
+	0xE653, 0xBAAE, 0xBA7D, 0xE26F, 0x0000, 0xE2AE, 0xBAA3, 0xE2AB, 0xE2B8, 0xE275, 0xE27E, 0x0000, 0x0000, 0xE2B6, 0xE2AC, 0xBA7C,
+	0x0000, 0x0000, 0xE27C, 0xBA76, 0xBA74, 0xBAA8, 0x0000, 0x0000, 0xE27A, 0xE277, 0xE278, 0x0000, 0xE2B2, 0x0000, 0xE2B7, 0xE2B5,
+	0xBA7A, 0xE2B9, 0xBA7E, 0xBAA7, 0x0000, 0xE270, 0xE5FA, 0xE279, 0x0000, 0xBA78, 0xBAAC, 0xBAA9, 0xBA7B, 0xE2A5, 0xE274, 0xBAAA,
+	0xE2A7, 0xBAA4, 0xBAA6, 0xBA73, 0x0000, 0xE2A9, 0xE2A1, 0xE272, 0xBAA5, 0xE2B1, 0xE2B4, 0xE27B, 0xE2A8, 0x0000, 0xBA79, 0xBCDF,
+	0xE2A6, 0xE5F9, 0x0000, 0xE2AD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE276, 0xE644,
+	0xE64E, 0xBCE2, 0xE64D, 0xE659, 0xBCE4, 0xE64B, 0x0000, 0xE64F, 0xBCEF, 0x0000, 0xE646, 0xBCE7, 0x0000, 0xE652, 0xE9F0, 0xBCF3,
+	0xBCF2, 0xE654, 0xE643, 0xE65E, 0xBCED, 0x0000, 0xBCE3, 0xE657, 0x0000, 0xE65B, 0xE660, 0xE655, 0xE649, 0xBCE6, 0xBCE9, 0xBCF1,
+	0xBCEC, 0x0000, 0xE64C, 0xE2A2, 0x0000, 0x0000, 0xE648, 0xE65F, 0xBCE8, 0x0000, 0xBCEB, 0xE661, 0xBCE0, 0xE656, 0xE5FB, 0xE65C,
+	0xC0DF, 0x0000, 0xE64A, 0x0000, 0xBCE1, 0xE645, 0xBCE5, 0xE5FC, 0xBAAB, 0xE641, 0x0000, 0xE65A, 0xE642, 0xE640, 0xBCEA, 0x0000,
+	0xE658, 0x0000, 0xE5FE, 0xE651, 0xE650, 0xE65D, 0xE647, 0xBCEE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE9F3, 0x0000,
+	0xBF49, 0xBEFE, 0xEA40, 0xE9EB, 0xBF41, 0xE9F7, 0xBF48, 0xBF43, 0xE9F5, 0xED4F, 0xE9FB, 0xEA42, 0xE9FA, 0xE9E9, 0xE9F8, 0xEA44,
+	0xEA46, 0xBEFD, 0xEA45, 0xBF44, 0xBF4A, 0x0000, 0xBF47, 0x0000, 0xE9FE, 0xBF46, 0xE9F9, 0x0000, 0xE9ED, 0xE9F2, 0x0000, 0xE9FD,
+	0xBF45, 0xBF42, 0xBEFC, 0xBF40, 0xE9F1, 0x0000, 0xE5FD, 0xE9EC, 0xE9EF, 0xEA41, 0xE9F4, 0xE9EA, 0xED4E, 0xEA43, 0xE9EE, 0xE9FC,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xED51, 0xC0E3, 0x0000, 0x0000, 0xC0D7, 0x0000, 0x0000, 0xC0DB, 0xED53, 0xED59, 0xED57, 0xC0D9,
+	0xC0DA, 0xC0E1, 0xED5A, 0xED52, 0xC0DC, 0x0000, 0xED56, 0xED55, 0xED5B, 0xC0E2, 0x0000, 0xC0DD, 0xC0E0, 0xED54, 0xC0E4, 0xC0DE,
+	0xC0E5, 0xC0D8, 0xED58, 0x0000, 0xED50, 0x0000, 0x0000, 0xEFF7, 0x0000, 0x0000, 0xC271, 0xEFF4, 0xEFF6, 0x0000, 0xC26F, 0xEFF2,
+	0xEFF3, 0xEFEE, 0x0000, 0x0000, 0xE9F6, 0xEFEF, 0xC270, 0xEFEB, 0x0000, 0xC26D, 0xEFF8, 0xC26E, 0xEFEC, 0xEFED, 0xEFF1, 0xC273,
+	0x0000, 0xC272, 0x0000, 0x0000, 0xEFF0, 0xC378, 0xF25F, 0xF265, 0xC379, 0xF25C, 0xC376, 0xC373, 0xF267, 0xC377, 0x0000, 0xC374,
+	0xF25E, 0xF261, 0xF262, 0xF263, 0xF266, 0x0000, 0xEFF5, 0xF25D, 0xC375, 0xF264, 0xF268, 0xF260, 0x0000, 0x0000, 0x0000, 0xF45D,
+	0xC46A, 0xF460, 0xC46B, 0xF468, 0xF45F, 0xF45C, 0x0000, 0xF45E, 0xF462, 0xF465, 0xF464, 0xF467, 0xF45B, 0x0000, 0xC469, 0xF463,
+	0xF466, 0xF469, 0xF461, 0xF5D3, 0xF5D4, 0xF5D8, 0xF5D9, 0x0000, 0xF5D6, 0xF5D7, 0xF5D5, 0x0000, 0xC4E9, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xC578, 0xF6EB, 0x0000, 0x0000, 0xF6E8, 0xF6E9, 0xF6EA, 0xC579, 0x0000, 0xF7E5, 0xF7E4, 0x0000, 0xF8AF, 0xC5F4, 0xF8AD,
+	0xF8B0, 0xF8AE, 0xF8F5, 0xC657, 0xC665, 0xF9A3, 0xF96C, 0x0000, 0xF9A2, 0xF9D0, 0xF9D1, 0xA4F5, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA6C7, 0xCA41, 0x0000, 0x0000, 0xCB5E, 0x0000, 0xA85F, 0x0000, 0xA862, 0x0000, 0xCB5F, 0x0000, 0xA860, 0xA861, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xCD58, 0xCD5A, 0xCD55, 0xCD52, 0xCD54, 0x0000, 0x0000, 0x0000, 0xAAA4, 0x0000, 0x0000, 0x0000, 0xAAA2, 0x0000,
+	0x0000, 0xCD56, 0xAAA3, 0xCD53, 0xCD50, 0xAAA1, 0xCD57, 0x0000, 0xCD51, 0xAAA5, 0xCD59, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFAF,
+	0x0000, 0xCFB3, 0x0000, 0x0000, 0xACB7, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFB6, 0x0000, 0xACAF, 0xACB2, 0xACB4, 0xACB6, 0xACB3,
+	0xCFB2, 0xCFB1, 0x0000, 0xACB1, 0xCFB4, 0xCFB5, 0x0000, 0xCFAE, 0xACB5, 0x0000, 0xACB0, 0x0000, 0x0000, 0x0000, 0xCFB0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD277, 0xD278, 0xD279, 0xAF50, 0x0000, 0xAF4C, 0xD26E, 0x0000, 0xD276, 0xD27B, 0xAF51,
+	0x0000, 0xD26C, 0xD272, 0xD26B, 0xD275, 0x0000, 0x0000, 0xD271, 0xAF4D, 0xAF4F, 0xD27A, 0x0000, 0xD26A, 0xD26D, 0xD273, 0x0000,
+	0xD274, 0xD27C, 0xD270, 0x0000, 0xAF4E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB26D,
+	0xD64E, 0x0000, 0x0000, 0xD650, 0xD64C, 0x0000, 0xD658, 0xD64A, 0xD657, 0xB269, 0xD648, 0xDA5B, 0xD652, 0xB26C, 0x0000, 0xD653,
+	0xD656, 0x0000, 0xD65A, 0x0000, 0xD64F, 0x0000, 0xD654, 0x0000, 0x0000, 0xB26A, 0xB26B, 0xD659, 0xD64D, 0xD649, 0xD65B, 0x0000,
+	0xD651, 0x0000, 0x0000, 0xD655, 0x0000, 0x0000, 0x0000, 0xD64B, 0x0000, 0xB548, 0xB549, 0xDA65, 0xB54F, 0x0000, 0xDA59, 0xDA62,
+	0xDA58, 0xB54C, 0xDA60, 0xDA5E, 0x0000, 0xDA5F, 0xB54A, 0x0000, 0xDA63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDA5C, 0xDA5A,
+	0xB54B, 0xDA5D, 0xDA61, 0x0000, 0x0000, 0x0000, 0xB54D, 0x0000, 0x0000, 0x0000, 0xDA64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xDE70, 0xDE77, 0xDE79, 0xDEA1, 0x0000, 0xB7DA, 0xDE6B, 0x0000, 0xB7D2, 0x0000, 0xDE7A, 0xB7D7, 0xDEA2, 0xB7CE, 0x0000,
+	0xDE7D, 0x0000, 0xDE6D, 0xDE7E, 0xDE6C, 0x0000, 0xB7DC, 0x0000, 0xDE78, 0xB7CF, 0xDEA3, 0x0000, 0xB7D4, 0xDE71, 0xB7D9, 0xDE7C,
+	0xDE6F, 0xDE76, 0xDE72, 0xDE6E, 0xB7D1, 0xB7D8, 0xB7D6, 0xB7D3, 0xB7DB, 0xB7D0, 0xDE75, 0x0000, 0xB7D5, 0x0000, 0xB54E, 0x0000,
+	0xDE7B, 0x0000, 0xDE73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDE74, 0x0000, 0x0000, 0xE2C1, 0x0000, 0xBAB4, 0x0000, 0x0000,
+	0xE2BD, 0xE2C3, 0xE2BF, 0x0000, 0xBAB6, 0xE2BE, 0xE2C2, 0xE2BA, 0x0000, 0xE2BC, 0xBAB5, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2C0,
+	0xE2BB, 0x0000, 0xBAB7, 0x0000, 0xBAB2, 0x0000, 0x0000, 0xE2C4, 0x0000, 0xBAB3, 0xE667, 0xE664, 0xE670, 0xE66A, 0xE66C, 0xBCF4,
+	0xE666, 0xE66E, 0x0000, 0x0000, 0xE66D, 0xE66B, 0x0000, 0xE671, 0xBCF7, 0xE668, 0xE66F, 0x0000, 0xBCF5, 0x0000, 0x0000, 0xE663,
+	0xE665, 0xBCF6, 0xE662, 0xE672, 0x0000, 0xE669, 0x0000, 0x0000, 0xEA4A, 0xBF51, 0x0000, 0x0000, 0xEA55, 0xEA53, 0xBF4B, 0xEA49,
+	0xEA4C, 0xEA4D, 0xEA48, 0xBF55, 0xBF56, 0xEA47, 0xEA56, 0xEA51, 0xBF4F, 0xBF4C, 0xEA50, 0xEA4E, 0x0000, 0x0000, 0xBF52, 0xEA52,
+	0xBF4D, 0x0000, 0xBF4E, 0x0000, 0xEA4F, 0xBF50, 0xEA4B, 0x0000, 0xEA54, 0xBF53, 0xEA57, 0xEA58, 0xBF54, 0x0000, 0x0000, 0xC0E7,
+	0xC0EE, 0xED5C, 0xED62, 0x0000, 0xED60, 0xC0EA, 0xC0E9, 0xC0E6, 0xED5E, 0x0000, 0x0000, 0x0000, 0xC0EC, 0xC0EB, 0xC0E8, 0x0000,
+	0xED61, 0xED5D, 0xED5F, 0x0000, 0xC0ED, 0x0000, 0x0000, 0x0000, 0xC277, 0xEFFB, 0x0000, 0xC274, 0xC275, 0xEFFD, 0xC276, 0xEFFA,
+	0x0000, 0xEFF9, 0xF26C, 0xEFFC, 0x0000, 0xF26D, 0xC37A, 0xF26B, 0x0000, 0x0000, 0xF26A, 0x0000, 0xF269, 0xC37B, 0x0000, 0x0000,
+	0xC46C, 0x0000, 0x0000, 0xF46A, 0xF46B, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5DC, 0xF5DB, 0xC4EA, 0x0000, 0xF5DA, 0xF6EC, 0xF6ED,
+	0x0000, 0x0000, 0xF7E6, 0xF8B1, 0x0000, 0x0000, 0xF8F6, 0xF9BC, 0xC679, 0xF9C6, 0xA4F6, 0x0000, 0xAAA6, 0xAAA7, 0x0000, 0x0000,
+	0xACB8, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0EF, 0xA4F7, 0x0000, 0xAAA8, 0xAF52, 0xB7DD, 0xA4F8, 0x0000, 0xB26E, 0xBAB8, 0xC962,
+	0x0000, 0xCFB7, 0xD27D, 0x0000, 0xE2C5, 0x0000, 0xC0F0, 0xA4F9, 0xAAA9, 0xCFB8, 0xCFB9, 0xDA66, 0xB550, 0x0000, 0x0000, 0xDEA4,
+	0x0000, 0x0000, 0xB7DE, 0xE2C6, 0x0000, 0x0000, 0xBCF8, 0x0000, 0xC37C, 0xA4FA, 0xDA67, 0xA4FB, 0x0000, 0xA6C9, 0xCA42, 0xA6C8,
+	0xA865, 0xA864, 0xA863, 0xCB60, 0x0000, 0x0000, 0x0000, 0xAAAA, 0x0000, 0xAAAB, 0xCD5B, 0x0000, 0xCFBA, 0x0000, 0xCFBD, 0xACBA,
+	0xCFBB, 0x0000, 0xACB9, 0xCFBC, 0xACBB, 0x0000, 0xD2A2, 0xD2A1, 0xD27E, 0xAF53, 0x0000, 0xD65D, 0xD65E, 0xB26F, 0xD65C, 0xD65F,
+	0xB552, 0xB270, 0x0000, 0x0000, 0xB551, 0xDA6B, 0xDA6A, 0x0000, 0xDA68, 0xDA69, 0x0000, 0xDA6C, 0xDEA6, 0xDEA5, 0xDEA9, 0x0000,
+	0xDEA8, 0xDEA7, 0xBAB9, 0xE2C9, 0x0000, 0xE2C8, 0xBABA, 0xE2C7, 0xE673, 0x0000, 0xE674, 0xBCF9, 0x0000, 0xEA59, 0xEA5A, 0x0000,
+	0x0000, 0xF272, 0xC37D, 0xF271, 0xF270, 0xF26E, 0xF26F, 0xC4EB, 0xF46C, 0xF6EE, 0xF8F7, 0x0000, 0xA4FC, 0x0000, 0xC9A5, 0xA5C7,
+	0xC9A6, 0x0000, 0x0000, 0x0000, 0xCA43, 0xCA44, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB66, 0x0000, 0x0000, 0xCB62, 0x0000, 0xCB61,
+	0xAAAC, 0xCB65, 0xA867, 0xCB63, 0xA866, 0xCB67, 0xCB64, 0x0000, 0x0000, 0xCD5F, 0xCFBE, 0xCD5D, 0xCD64, 0x0000, 0xAAAD, 0x0000,
+	0xAAB0, 0xCD65, 0xCD61, 0x0000, 0xCD62, 0x0000, 0xCD5C, 0xAAAF, 0xCD5E, 0xAAAE, 0xCD63, 0x0000, 0xCD60, 0x0000, 0x0000, 0xCFC2,
+	0xACBD, 0xACBE, 0x0000, 0xCFC5, 0xCFBF, 0x0000, 0xCFC4, 0x0000, 0xCFC0, 0xACBC, 0xCFC3, 0xCFC1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD2A8, 0xD2A5, 0x0000, 0xD2A7, 0xAF58, 0xAF57, 0xAF55, 0xD2A4, 0xD2A9, 0xAF54, 0xAF56, 0xD2A6, 0xD667,
+	0xD2A3, 0xD2AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD662, 0xD666, 0x0000, 0xD665, 0xDA6E, 0xDA79, 0x0000, 0x0000, 0xD668,
+	0x0000, 0xD663, 0xDA6D, 0xB274, 0x0000, 0x0000, 0xB273, 0xD661, 0xD664, 0xB275, 0x0000, 0xB272, 0xB271, 0xD660, 0xD669, 0x0000,
+	0x0000, 0x0000, 0xDA70, 0xDA77, 0x0000, 0xB554, 0xDA76, 0xDA73, 0x0000, 0xB556, 0x0000, 0x0000, 0x0000, 0xDA75, 0x0000, 0x0000,
+	0xDA6F, 0xDA71, 0xDA74, 0xDA72, 0xB555, 0xDA78, 0xB553, 0xB7DF, 0x0000, 0x0000, 0xDEAD, 0xDEAC, 0xDEAA, 0x0000, 0xB7E2, 0xB7E1,
+	0xDEAE, 0x0000, 0xDEAB, 0xE2CA, 0xBABB, 0xB7E0, 0x0000, 0x0000, 0x0000, 0xDEB0, 0xDEAF, 0x0000, 0xE2CD, 0xE2CB, 0xBCFA, 0x0000,
+	0xBABC, 0xE2CC, 0xE676, 0x0000, 0x0000, 0x0000, 0x0000, 0xBCFB, 0xE675, 0xE67E, 0xE67D, 0xE67B, 0x0000, 0xE67A, 0xE677, 0xE678,
+	0xE679, 0xE67C, 0xE6A1, 0x0000, 0x0000, 0xEA5F, 0xEA5C, 0xEA5D, 0xBF57, 0xEA5B, 0xEA61, 0xEA60, 0xEA5E, 0x0000, 0xED64, 0xED65,
+	0xC0F1, 0x0000, 0xC0F2, 0xED63, 0x0000, 0xC279, 0xEFFE, 0xC278, 0xC37E, 0x0000, 0xC3A1, 0xC46D, 0xF46E, 0xF46D, 0xF5DD, 0xF6EF,
+	0xC57A, 0xF7E8, 0xF7E7, 0xF7E9, 0xA5C8, 0xCFC6, 0xAF59, 0xB276, 0xD66A, 0xA5C9, 0xC9A7, 0xA4FD, 0x0000, 0x0000, 0xCA45, 0x0000,
+	0x0000, 0x0000, 0xCB6C, 0xCB6A, 0xCB6B, 0xCB68, 0xA868, 0xCB69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCD6D, 0x0000, 0xAAB3,
+	0xCD6B, 0xCD67, 0xCD6A, 0x0000, 0xCD66, 0xAAB5, 0xCD69, 0x0000, 0xAAB2, 0xAAB1, 0x0000, 0xAAB4, 0xCD6C, 0xCD68, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xACC2, 0xACC5, 0xCFCE, 0xCFCD, 0xCFCC, 0xACBF, 0xCFD5, 0xCFCB, 0x0000, 0xACC1, 0xD2AF, 0x0000, 0xCFD2, 0xCFD0,
+	0xACC4, 0x0000, 0xCFC8, 0xCFD3, 0x0000, 0xCFCA, 0xCFD4, 0xCFD1, 0xCFC9, 0x0000, 0xACC0, 0xCFD6, 0xCFC7, 0xACC3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD2B4, 0xD2AB, 0xD2B6, 0x0000, 0xD2AE, 0xD2B9, 0xD2BA, 0xD2AC, 0xD2B8, 0xD2B5, 0xD2B3, 0xD2B7, 0xAF5F, 0x0000,
+	0xAF5D, 0x0000, 0x0000, 0xD2B1, 0x0000, 0xD2AD, 0x0000, 0xD2B0, 0xD2BB, 0xD2B2, 0xAF5E, 0xCFCF, 0x0000, 0xAF5A, 0xAF5C, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD678, 0xD66D, 0xD66B, 0x0000, 0xD66C, 0x0000, 0xD673, 0x0000, 0xD674, 0xD670, 0xB27B, 0xD675,
+	0xD672, 0xD66F, 0x0000, 0xB279, 0xD66E, 0xB277, 0xB27A, 0xD671, 0xD679, 0xAF5B, 0xB278, 0xD677, 0xD676, 0xB27C, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDA7E, 0x0000, 0x0000, 0x0000, 0xDAA1, 0xB560, 0x0000, 0xDAA7, 0x0000, 0x0000,
+	0xDAA9, 0xDAA2, 0xB55A, 0xDAA6, 0xDAA5, 0xB55B, 0xB561, 0x0000, 0xB562, 0xDAA8, 0xB558, 0xDA7D, 0xDA7B, 0xDAA3, 0xDA7A, 0xB55F,
+	0xDA7C, 0xDAA4, 0xDAAA, 0xB559, 0xB55E, 0xB55C, 0xB55D, 0x0000, 0x0000, 0x0000, 0xB557, 0x0000, 0x0000, 0x0000, 0x0000, 0xB7E9,
+	0xDEB7, 0xB7E8, 0xDEBB, 0x0000, 0xDEB1, 0x0000, 0xDEBC, 0x0000, 0x0000, 0x0000, 0xDEB2, 0xDEB3, 0x0000, 0xDEBD, 0xDEBA, 0xDEB8,
+	0xDEB9, 0xDEB5, 0xDEB4, 0x0000, 0xDEBE, 0xB7E5, 0x0000, 0xDEB6, 0x0000, 0xB7EA, 0xB7E4, 0xB7EB, 0xB7EC, 0x0000, 0xB7E7, 0xB7E6,
+	0x0000, 0x0000, 0xE2CE, 0xBABE, 0xBABD, 0x0000, 0x0000, 0xE2D3, 0x0000, 0xBCFC, 0xBABF, 0x0000, 0x0000, 0xBAC1, 0xE2D4, 0xB7E3,
+	0xBAC0, 0xE2D0, 0xE2D2, 0xE2CF, 0x0000, 0xE2D1, 0x0000, 0x0000, 0x0000, 0xE6AB, 0x0000, 0x0000, 0xE6AA, 0xE6A7, 0xBD40, 0xEA62,
+	0xBD41, 0xE6A6, 0x0000, 0xBCFE, 0x0000, 0xE6A8, 0xE6A5, 0xE6A2, 0xE6A9, 0xE6A3, 0xE6A4, 0xBCFD, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xED69, 0x0000, 0xEA66, 0x0000, 0xEA65, 0xEA67, 0x0000, 0xED66, 0xBF5A, 0x0000, 0xEA63, 0x0000, 0xBF58, 0x0000, 0xBF5C, 0xBF5B,
+	0xEA64, 0xEA68, 0x0000, 0xBF59, 0x0000, 0xED6D, 0xC0F5, 0xC27A, 0xC0F6, 0xC0F3, 0xED6A, 0xED68, 0x0000, 0xED6B, 0x0000, 0xED6E,
+	0xC0F4, 0xED6C, 0xED67, 0x0000, 0x0000, 0xF042, 0xF045, 0xF275, 0xF040, 0x0000, 0xF46F, 0xF046, 0x0000, 0xC3A2, 0xF044, 0xC27B,
+	0xF041, 0xF043, 0xF047, 0xF276, 0x0000, 0xF274, 0x0000, 0x0000, 0x0000, 0x0000, 0xC3A3, 0xF273, 0x0000, 0x0000, 0x0000, 0xC46E,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xC4ED, 0xF6F1, 0xC4EC, 0xF6F3, 0xF6F0, 0xF6F2, 0xC5D0, 0xF8B2, 0xA5CA, 0xCD6E, 0xD2BC, 0xD2BD,
+	0xB27D, 0xDEBF, 0xBF5D, 0xC3A4, 0xC57B, 0xF8B3, 0xA5CB, 0x0000, 0xCD6F, 0xA260, 0x0000, 0x0000, 0xCFD7, 0x0000, 0xCFD8, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD2BE, 0xD2BF, 0xB27E, 0xB2A1, 0x0000, 0x0000, 0x0000, 0xDAAB, 0x0000, 0xDEC2, 0xDEC1, 0xDEC0,
+	0xE2D5, 0x0000, 0xE2D6, 0xE2D7, 0xBAC2, 0x0000, 0x0000, 0xE6AD, 0xE6AC, 0x0000, 0x0000, 0xEA69, 0xBF5E, 0xBF5F, 0x0000, 0xED72,
+	0xED6F, 0xED70, 0xED71, 0xF049, 0xF048, 0xC27C, 0xF277, 0xF5DE, 0xA5CC, 0x0000, 0xACC6, 0x0000, 0xB2A2, 0xDEC3, 0x0000, 0xA5CD,
+	0x0000, 0xD2C0, 0xB2A3, 0x0000, 0x0000, 0xB563, 0xB564, 0x0000, 0xA5CE, 0xA5CF, 0xCA46, 0xA86A, 0xA869, 0xACC7, 0xCFD9, 0xDAAC,
+	0xA5D0, 0xA5D1, 0xA5D2, 0xA5D3, 0x0000, 0x0000, 0x0000, 0xA86B, 0xA86C, 0xCB6E, 0xCB6D, 0x0000, 0x0000, 0xAAB6, 0xCD72, 0xCD70,
+	0xCD71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFDA, 0xCFDB, 0x0000, 0x0000, 0xACCB, 0xACC9, 0x0000, 0xACCA, 0xACC8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xAF60, 0x0000, 0x0000, 0x0000, 0x0000, 0xAF64, 0xAF63, 0xD2C1, 0xAF62, 0xAF61, 0x0000, 0xD2C2,
+	0x0000, 0x0000, 0xB2A6, 0xD67B, 0xD67A, 0xB2A4, 0xB2A5, 0x0000, 0x0000, 0x0000, 0xB566, 0xB565, 0xDAAE, 0x0000, 0x0000, 0xDAAD,
+	0xB2A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB7ED, 0xDEC5, 0xB7EE, 0xDEC4, 0x0000, 0x0000, 0x0000, 0xE2D8, 0xE6AE, 0xBD42,
+	0xEA6A, 0x0000, 0x0000, 0x0000, 0xED73, 0x0000, 0xC3A6, 0xC3A5, 0x0000, 0x0000, 0xC57C, 0xA5D4, 0xCD73, 0x0000, 0x0000, 0xB2A8,
+	0xE2D9, 0xBAC3, 0x0000, 0x0000, 0xCB6F, 0xCB70, 0x0000, 0x0000, 0xCD74, 0xAAB8, 0xAAB9, 0x0000, 0x0000, 0xAAB7, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xACCF, 0xACD0, 0xACCD, 0xACCE, 0x0000, 0xCFDC, 0x0000, 0x0000, 0xCFDD, 0xACCC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD2C3, 0x0000, 0xAF68, 0xAF69, 0x0000, 0xB2AB, 0xD2C9, 0x0000, 0xAF6E, 0xAF6C, 0xD2CA, 0xD2C5, 0xAF6B, 0xAF6A, 0xAF65, 0xD2C8,
+	0xD2C7, 0xD2C4, 0xAF6D, 0x0000, 0xD2C6, 0xAF66, 0x0000, 0xAF67, 0x0000, 0x0000, 0xB2AC, 0xD6A1, 0xD6A2, 0xB2AD, 0xD67C, 0xD67E,
+	0xD6A4, 0xD6A3, 0xD67D, 0x0000, 0xB2A9, 0xB2AA, 0x0000, 0xDAB6, 0xB56B, 0xB56A, 0xDAB0, 0xB568, 0x0000, 0xDAB3, 0xB56C, 0xDAB4,
+	0xB56D, 0xDAB1, 0xB567, 0xB569, 0xDAB5, 0x0000, 0xDAB2, 0xDAAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDED2, 0x0000, 0xDEC7,
+	0xB7F0, 0xB7F3, 0xB7F2, 0xB7F7, 0xB7F6, 0xDED3, 0xDED1, 0xDECA, 0xDECE, 0xDECD, 0xB7F4, 0xDED0, 0xDECC, 0xDED4, 0xDECB, 0xB7F5,
+	0xB7EF, 0xB7F1, 0x0000, 0xDEC9, 0x0000, 0x0000, 0x0000, 0x0000, 0xE2DB, 0xBAC7, 0xE2DF, 0xBAC6, 0xE2DC, 0xBAC5, 0x0000, 0xDEC8,
+	0xDECF, 0xE2DE, 0x0000, 0xBAC8, 0xE2E0, 0xE2DD, 0xE2DA, 0x0000, 0x0000, 0xE6B1, 0xE6B5, 0xE6B7, 0xE6B3, 0xE6B2, 0xE6B0, 0xBD45,
+	0xBD43, 0xBD48, 0xBD49, 0xE6B4, 0xBD46, 0xE6AF, 0xBD47, 0xBAC4, 0xE6B6, 0xBD44, 0x0000, 0x0000, 0x0000, 0xEA6C, 0x0000, 0xEA6B,
+	0xEA73, 0xEA6D, 0xEA72, 0xEA6F, 0xBF60, 0xEA71, 0x0000, 0x0000, 0xBF61, 0x0000, 0xBF62, 0x0000, 0xEA70, 0xEA6E, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xC0F8, 0xED74, 0x0000, 0x0000, 0xC0F7, 0xED77, 0xED75, 0xED76, 0x0000, 0x0000, 0xC0F9, 0x0000, 0x0000, 0x0000,
+	0xF04D, 0x0000, 0xC2A1, 0xF04E, 0x0000, 0x0000, 0xC27D, 0xF04F, 0xC27E, 0xF04C, 0xF050, 0x0000, 0xF04A, 0x0000, 0x0000, 0xC3A7,
+	0xF278, 0xC3A8, 0xC46F, 0x0000, 0xF04B, 0xC470, 0x0000, 0x0000, 0x0000, 0xC4EE, 0xF5DF, 0x0000, 0xC57E, 0xF6F4, 0xC57D, 0x0000,
+	0xF7EA, 0xC5F5, 0xC5F6, 0x0000, 0x0000, 0xF9CC, 0x0000, 0x0000, 0xACD1, 0xCFDE, 0x0000, 0xB56E, 0xB56F, 0xA5D5, 0xA6CA, 0xCA47,
+	0x0000, 0xCB71, 0xA86D, 0x0000, 0xAABA, 0x0000, 0xACD2, 0xACD3, 0xACD4, 0xD6A6, 0xD2CB, 0xAF6F, 0x0000, 0x0000, 0xB2AE, 0xD6A5,
+	0x0000, 0x0000, 0xDAB8, 0xB571, 0x0000, 0xDAB7, 0xB570, 0x0000, 0x0000, 0xDED5, 0xBD4A, 0xE6BB, 0xE6B8, 0xE6B9, 0xE6BA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xED78, 0x0000, 0xF051, 0x0000, 0x0000, 0x0000, 0xF471, 0xF470, 0x0000, 0xF6F5, 0xA5D6, 0xCD75,
+	0xAF70, 0x0000, 0x0000, 0x0000, 0xB572, 0xDED6, 0x0000, 0x0000, 0xE2E1, 0x0000, 0xBD4B, 0xEA74, 0x0000, 0xF052, 0xF472, 0xA5D7,
+	0x0000, 0x0000, 0xAABB, 0xACD7, 0xCFDF, 0xACD8, 0xACD6, 0x0000, 0xACD5, 0xD2CC, 0xAF71, 0x0000, 0x0000, 0xAF72, 0xAF73, 0x0000,
+	0x0000, 0x0000, 0xB2B0, 0xD6A7, 0xB2AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAB9, 0xB2B1, 0xB573, 0xDED7, 0xB7F8, 0xB7F9,
+	0x0000, 0xBAC9, 0x0000, 0xBACA, 0xBD4C, 0xBF64, 0xEA75, 0xBF63, 0x0000, 0xED79, 0xC0FA, 0x0000, 0xF053, 0xF473, 0xA5D8, 0xA86E,
+	0xCD78, 0xCD77, 0xAABC, 0xCD76, 0xAABD, 0xCD79, 0x0000, 0xCFE5, 0xACDB, 0xACDA, 0xCFE7, 0xCFE6, 0xACDF, 0x0000, 0xACDE, 0x0000,
+	0x0000, 0xACD9, 0x0000, 0xCFE1, 0xCFE2, 0xCFE3, 0x0000, 0xACE0, 0xCFE0, 0xACDC, 0xCFE4, 0xACDD, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD2CF, 0xD2D3, 0xD2D1, 0xD2D0, 0x0000, 0xD2D4, 0x0000, 0x0000, 0x0000, 0xD2D5, 0xD2D6, 0xD2CE, 0x0000, 0xD2CD, 0x0000, 0xAF75,
+	0xAF76, 0x0000, 0xD2D7, 0xD2D2, 0x0000, 0xD6B0, 0x0000, 0xD2D8, 0xAF77, 0xAF74, 0x0000, 0x0000, 0x0000, 0xD6AA, 0x0000, 0xD6A9,
+	0x0000, 0xD6AB, 0xD6AC, 0xD6AE, 0xD6AD, 0xD6B2, 0xB2B5, 0xB2B2, 0xB2B6, 0xD6A8, 0xB2B7, 0xD6B1, 0xB2B4, 0xD6AF, 0xB2B3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xDABC, 0xDABE, 0xDABA, 0xDABB, 0x0000, 0x0000, 0xDABF, 0xDAC1, 0xDAC2, 0xDABD, 0xDAC0, 0xB574,
+	0x0000, 0x0000, 0xDEDB, 0x0000, 0xDEE0, 0xDED8, 0xDEDC, 0x0000, 0x0000, 0xDEE1, 0xDEDD, 0xB7FA, 0xB843, 0x0000, 0xB7FD, 0xDED9,
+	0xDEDA, 0xBACE, 0xB846, 0xB7FE, 0x0000, 0xB844, 0xB7FC, 0xDEDF, 0xB845, 0xDEDE, 0xB841, 0xB7FB, 0xB842, 0xDEE2, 0xE2E6, 0xE2E8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB840, 0x0000, 0x0000, 0xE2E3, 0xBACC, 0xE2E9, 0xBACD,
+	0xE2E7, 0xE2E2, 0xE2E5, 0xE2EA, 0xBACB, 0xE2E4, 0x0000, 0xBD4E, 0xE6BF, 0xE6BE, 0x0000, 0xBD51, 0xBD4F, 0xE6BC, 0xBD4D, 0xE6BD,
+	0x0000, 0xBD50, 0x0000, 0x0000, 0x0000, 0xEA7D, 0x0000, 0xEAA1, 0x0000, 0xEA7E, 0xEA76, 0xEA7A, 0xEA79, 0xEA77, 0xBF66, 0xBF67,
+	0xBF65, 0xEA78, 0xEA7B, 0xEA7C, 0x0000, 0xBF68, 0x0000, 0xC140, 0xEDA3, 0x0000, 0xC0FC, 0xED7B, 0xC0FE, 0xC141, 0x0000, 0x0000,
+	0xC0FD, 0xEDA2, 0xED7C, 0xC0FB, 0xEDA1, 0xED7A, 0xED7E, 0xED7D, 0x0000, 0x0000, 0xF055, 0xC2A4, 0xC2A5, 0xC2A2, 0x0000, 0xC2A3,
+	0x0000, 0x0000, 0xF054, 0x0000, 0xF27B, 0x0000, 0x0000, 0xC3A9, 0x0000, 0xF279, 0xF27A, 0x0000, 0xF474, 0xF477, 0xF475, 0xF476,
+	0xF5E0, 0x0000, 0x0000, 0xC4EF, 0xF7EB, 0xF8B4, 0x0000, 0xC5F7, 0xF8F8, 0xF8F9, 0xC666, 0xA5D9, 0xACE1, 0x0000, 0xDAC3, 0x0000,
+	0xDEE3, 0x0000, 0xA5DA, 0xA86F, 0x0000, 0xAABE, 0x0000, 0xCFE8, 0xCFE9, 0xAF78, 0x0000, 0x0000, 0xDAC4, 0xB575, 0xB847, 0xC142,
+	0xEDA4, 0xF27C, 0xF478, 0xA5DB, 0x0000, 0x0000, 0x0000, 0xCDA1, 0xCD7A, 0xCD7C, 0xCD7E, 0xCD7D, 0xCD7B, 0xAABF, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xACE2, 0xCFF2, 0x0000, 0xCFED, 0xCFEA, 0x0000, 0x0000, 0xCFF1, 0x0000, 0x0000, 0xACE4, 0xACE5, 0xCFF0, 0xCFEF,
+	0xCFEE, 0xCFEB, 0xCFEC, 0xCFF3, 0xACE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAF7C, 0x0000, 0xAFA4,
+	0xAFA3, 0xD2E1, 0xD2DB, 0xD2D9, 0x0000, 0xAFA1, 0xD6B9, 0xAF7A, 0xD2DE, 0xD2E2, 0xD2E4, 0xD2E0, 0xD2DA, 0xAFA2, 0xD2DF, 0xD2DD,
+	0xAF79, 0xD2E5, 0xAFA5, 0xD2E3, 0xAF7D, 0xD2DC, 0x0000, 0xAF7E, 0xAF7B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xB2B9, 0x0000, 0xD6BA, 0x0000, 0x0000, 0xD6B3, 0xD6B5, 0xD6B7, 0x0000, 0xD6B8, 0xD6B6, 0xB2BA, 0x0000,
+	0xD6BB, 0x0000, 0xD6B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAC8, 0xB576, 0xDAD0, 0x0000,
+	0xDAC5, 0x0000, 0xDAD1, 0x0000, 0xDAC6, 0xDAC7, 0x0000, 0x0000, 0xDACF, 0xDACE, 0xDACB, 0xB2B8, 0xB577, 0xDAC9, 0xDACC, 0xB578,
+	0xDACD, 0xDACA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEEE, 0x0000, 0xDEF2, 0xB84E, 0x0000, 0xE2F0, 0xB851,
+	0xDEF0, 0xF9D6, 0x0000, 0xDEED, 0xDEE8, 0xDEEA, 0xDEEB, 0xDEE4, 0x0000, 0xB84D, 0x0000, 0x0000, 0xB84C, 0x0000, 0xB848, 0xDEE7,
+	0x0000, 0xB84F, 0x0000, 0xB850, 0xDEE6, 0xDEE9, 0xDEF1, 0xB84A, 0xB84B, 0xDEEF, 0xDEE5, 0x0000, 0x0000, 0x0000, 0xE2F2, 0xBAD0,
+	0xE2F4, 0xDEEC, 0xE2F6, 0xBAD4, 0xE2F7, 0xE2F3, 0x0000, 0xBAD1, 0xE2EF, 0xBAD3, 0xE2EC, 0xE2F1, 0xE2F5, 0xE2EE, 0x0000, 0x0000,
+	0xB849, 0x0000, 0xE2EB, 0xBAD2, 0xE2ED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBD54, 0xE6C1, 0xBD58, 0x0000, 0xBD56, 0x0000,
+	0x0000, 0xBACF, 0x0000, 0xE6C8, 0xE6C9, 0xBD53, 0x0000, 0x0000, 0xE6C7, 0xE6CA, 0xBD55, 0xBD52, 0xE6C3, 0xE6C0, 0xE6C5, 0xE6C2,
+	0xBD59, 0xE6C4, 0x0000, 0x0000, 0xE6C6, 0xBD57, 0x0000, 0x0000, 0x0000, 0x0000, 0xBF6A, 0xEAA8, 0x0000, 0xEAA2, 0xEAA6, 0xEAAC,
+	0xEAAD, 0xEAA9, 0xEAAA, 0xEAA7, 0x0000, 0xEAA4, 0x0000, 0xBF6C, 0xBF69, 0xEAA3, 0xEAA5, 0x0000, 0xBF6B, 0xEAAB, 0x0000, 0xC146,
+	0x0000, 0x0000, 0xEDAA, 0xEDA5, 0xC145, 0x0000, 0x0000, 0xC143, 0x0000, 0xEDAC, 0xC144, 0xEDA8, 0xEDA9, 0xEDA6, 0xEDAD, 0xF056,
+	0x0000, 0xC147, 0xEDA7, 0x0000, 0xEDAE, 0xEDAB, 0x0000, 0x0000, 0x0000, 0xF05A, 0x0000, 0x0000, 0xF057, 0x0000, 0xC2A6, 0x0000,
+	0xF05B, 0xF05D, 0xF05C, 0xF058, 0xF059, 0x0000, 0x0000, 0xF2A3, 0x0000, 0xC3AA, 0x0000, 0xF27E, 0xF2A2, 0xF27D, 0xF2A4, 0x0000,
+	0x0000, 0xF2A1, 0x0000, 0xF47A, 0xF47D, 0xF479, 0xC471, 0xF47B, 0xF47C, 0xF47E, 0xC472, 0xC474, 0xC473, 0xF5E1, 0x0000, 0xF5E3,
+	0x0000, 0xF5E2, 0x0000, 0x0000, 0x0000, 0xF6F6, 0x0000, 0x0000, 0xF8B5, 0xF8FA, 0xA5DC, 0x0000, 0x0000, 0xCB72, 0xAAC0, 0xCDA3,
+	0xAAC1, 0xAAC2, 0xCDA2, 0x0000, 0xCFF8, 0xCFF7, 0xACE6, 0xACE9, 0xACE8, 0xACE7, 0xCFF4, 0xCFF6, 0xCFF5, 0x0000, 0x0000, 0xD2E8,
+	0xAFA7, 0xD2EC, 0xD2EB, 0xD2EA, 0xD2E6, 0xAFA6, 0xAFAA, 0xAFAD, 0x0000, 0x0000, 0xAFAE, 0xD2E7, 0xD2E9, 0xAFAC, 0xAFAB, 0xAFA9,
+	0xAFA8, 0xD6C2, 0x0000, 0xD6C0, 0xD6BC, 0xB2BB, 0x0000, 0xD6BD, 0xB2BC, 0xD6BE, 0xD6BF, 0xD6C1, 0x0000, 0xB2BD, 0x0000, 0x0000,
+	0xDAD5, 0x0000, 0xDAD4, 0xDAD3, 0xDAD2, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEF6, 0xB852, 0x0000, 0xDEF3, 0xDEF5, 0x0000, 0xB853,
+	0x0000, 0xB854, 0xDEF4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE341, 0x0000, 0xE2F9, 0xE2FA, 0x0000, 0xBAD7, 0xBAD5, 0xBAD6,
+	0xE343, 0x0000, 0xE342, 0xE2FE, 0xE2FD, 0xE2FC, 0xE2FB, 0xE340, 0xE2F8, 0x0000, 0xE6CB, 0xE6D0, 0xE6CE, 0x0000, 0x0000, 0x0000,
+	0xE6CD, 0xE6CC, 0xE6CF, 0x0000, 0xEAAE, 0x0000, 0xBF6D, 0xC148, 0xEDB0, 0x0000, 0xC149, 0xEDAF, 0xF05F, 0xF05E, 0xC2A7, 0x0000,
+	0xF2A5, 0xC3AB, 0xF4A1, 0xC5A1, 0xF6F7, 0x0000, 0xF8B7, 0xF8B6, 0xC9A8, 0xACEA, 0xACEB, 0xD6C3, 0x0000, 0xB856, 0xA5DD, 0xA872,
+	0xA871, 0xA870, 0x0000, 0x0000, 0x0000, 0xCDA4, 0x0000, 0x0000, 0xAAC4, 0xAAC3, 0x0000, 0xACEE, 0x0000, 0xCFFA, 0xCFFD, 0xCFFB,
+	0x0000, 0xACEC, 0xACED, 0x0000, 0x0000, 0xCFF9, 0xCFFC, 0x0000, 0xAFB5, 0x0000, 0x0000, 0x0000, 0xD2F3, 0xD2F5, 0xD2F4, 0xAFB2,
+	0xD2EF, 0x0000, 0x0000, 0xAFB0, 0xAFAF, 0x0000, 0xAFB3, 0xAFB1, 0x0000, 0xAFB4, 0xD2F2, 0xD2ED, 0xD2EE, 0xD2F1, 0xD2F0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6C6, 0xD6C7, 0xD6C5, 0x0000, 0xD6C4, 0xB2BE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xB57D, 0x0000, 0xDAD6, 0xDAD8, 0xDADA, 0xB57C, 0x0000, 0x0000, 0xB57A, 0x0000, 0xDAD7, 0xB57B, 0xDAD9, 0xB579, 0x0000, 0x0000,
+	0xDF41, 0xDEF7, 0xDEFA, 0xDEFE, 0xB85A, 0xDEFC, 0x0000, 0xDEFB, 0xDEF8, 0xDEF9, 0xB858, 0xDF40, 0xB857, 0x0000, 0xB85C, 0xB85B,
+	0xB859, 0x0000, 0xDEFD, 0x0000, 0x0000, 0x0000, 0xE349, 0x0000, 0xE348, 0x0000, 0x0000, 0xE344, 0x0000, 0x0000, 0xBAD8, 0xE347,
+	0xE346, 0xBAD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBD5E, 0x0000, 0xE6D2, 0x0000, 0xBD5F, 0xBD5B, 0xBD5D, 0x0000, 0xBD5A,
+	0xBD5C, 0x0000, 0x0000, 0x0000, 0xEAAF, 0x0000, 0xBF70, 0xEAB1, 0xEAB0, 0x0000, 0xE345, 0xBF72, 0xBF71, 0xBF6E, 0xBF6F, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEDB5, 0x0000, 0xEDB3, 0xC14A, 0xEDB4, 0x0000, 0xEDB6, 0xEDB2, 0xEDB1, 0x0000, 0x0000, 0xF060,
+	0xC2AA, 0xC2A8, 0xC2A9, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2A6, 0xF2A7, 0xC3AD, 0x0000, 0xC3AC, 0xF4A3, 0xF4A4, 0xF4A2, 0x0000,
+	0xF6F8, 0xF6F9, 0x0000, 0x0000, 0xA5DE, 0xCA48, 0xA873, 0x0000, 0xCDA5, 0xAAC6, 0xAAC5, 0xCDA6, 0x0000, 0x0000, 0xD040, 0xACEF,
+	0xCFFE, 0xACF0, 0x0000, 0x0000, 0xAFB6, 0xD2F8, 0xD2F6, 0xD2FC, 0xAFB7, 0xD2F7, 0xD2FB, 0xD2F9, 0xD2FA, 0x0000, 0x0000, 0xD6C8,
+	0xD6CA, 0x0000, 0xB2BF, 0x0000, 0xD6C9, 0xB2C0, 0xB5A2, 0xB5A1, 0xB57E, 0xDADB, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF44, 0xB85D,
+	0xB85E, 0x0000, 0xDF43, 0xDF42, 0x0000, 0x0000, 0x0000, 0x0000, 0xE34A, 0xBADB, 0xBADA, 0xE34B, 0xE34C, 0x0000, 0xBD61, 0xBD60,
+	0x0000, 0xEAB5, 0xE6D3, 0xE6D5, 0xE6D4, 0xEAB4, 0xEAB2, 0xEAB6, 0xEAB3, 0x0000, 0xBF73, 0x0000, 0x0000, 0x0000, 0xEDB7, 0xC14B,
+	0xEDB8, 0xEDB9, 0x0000, 0x0000, 0xC2AB, 0xC2AC, 0x0000, 0xC475, 0x0000, 0x0000, 0xC5D1, 0xA5DF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xD041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD2FD, 0xAFB8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3BA,
+	0xB3B9, 0x0000, 0x0000, 0xB5A4, 0xDADD, 0xB5A3, 0xDADC, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF45, 0x0000, 0xBADC, 0xE34D, 0xBADD,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC476, 0xF4A5, 0x0000, 0xA6CB, 0xAAC7, 0xCDA7, 0x0000, 0xACF2, 0x0000, 0xACF1,
+	0xD042, 0xD043, 0x0000, 0x0000, 0xD340, 0xD342, 0xAFB9, 0x0000, 0xD344, 0xD347, 0xD345, 0x0000, 0x0000, 0x0000, 0xD346, 0xD343,
+	0xD2FE, 0xAFBA, 0xD348, 0xD341, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6D3, 0xB2C6, 0xD6DC, 0xB2C3, 0x0000, 0xD6D5, 0xB2C7, 0x0000,
+	0xB2C1, 0x0000, 0xD6D0, 0xD6DD, 0xD6D1, 0xD6CE, 0xB2C5, 0x0000, 0xB2C2, 0x0000, 0xD6D4, 0xD6D7, 0xB2C4, 0xD6D8, 0xB2C8, 0xD6D9,
+	0xD6CF, 0xD6D6, 0xD6DA, 0xD6D2, 0xD6CD, 0xD6CB, 0x0000, 0x0000, 0xD6DB, 0x0000, 0x0000, 0xDADF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xDAE4, 0x0000, 0x0000, 0x0000, 0xDAE0, 0xDAE6, 0xB5A7, 0xD6CC, 0xDAE1, 0xB5A5, 0xDADE, 0xB5AC, 0xDAE2, 0xB5AB, 0xDAE3, 0xB5AD,
+	0xB5A8, 0xB5AE, 0xB5A9, 0x0000, 0xB5AA, 0x0000, 0xB5A6, 0x0000, 0xDAE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xB861, 0xDF50, 0x0000, 0xDF53, 0xDF47, 0xDF4C, 0xDF46, 0xB863, 0x0000, 0xDF4A, 0x0000, 0x0000, 0x0000, 0xDF48, 0xB862, 0x0000,
+	0xDF4F, 0xDF4E, 0xDF4B, 0xDF4D, 0xDF49, 0xBAE1, 0xDF52, 0xB85F, 0xDF51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xE35D, 0x0000, 0xBAE8, 0xE358, 0x0000, 0xBAE7, 0xE34E, 0x0000, 0xE350, 0xBAE0, 0xE355, 0xE354, 0xE357, 0xBAE5,
+	0xE352, 0xE351, 0x0000, 0x0000, 0xBAE4, 0xBADF, 0xE353, 0xBAE2, 0xE359, 0xE35B, 0x0000, 0xE356, 0xE34F, 0xBAE3, 0x0000, 0x0000,
+	0xBD69, 0xBADE, 0x0000, 0x0000, 0xE35C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6D9, 0xBD62, 0x0000, 0xE6DB,
+	0x0000, 0xBD63, 0x0000, 0x0000, 0xBD65, 0xE6DE, 0x0000, 0xE6D6, 0xBAE6, 0xE6DC, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6D8, 0x0000,
+	0xB860, 0xBD68, 0x0000, 0x0000, 0xBD64, 0x0000, 0xBD66, 0xBD67, 0x0000, 0xBF76, 0xE6DD, 0xE6D7, 0xBD6A, 0x0000, 0xE6DA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEAC0, 0xEABB, 0x0000, 0x0000, 0xEAC5, 0xBF74, 0xEABD, 0xBF78, 0xEAC3, 0xEABA, 0xEAB7, 0xEAC6,
+	0xC151, 0xBF79, 0xEAC2, 0xEAB8, 0xBF77, 0xEABC, 0xBF7B, 0xEAB9, 0xEABE, 0xBF7A, 0xEAC1, 0xEAC4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEDCB, 0xEDCC, 0xEDBC, 0xEDC3, 0xEDC1, 0x0000, 0x0000, 0xC14F, 0xEDC8, 0xEABF, 0x0000, 0xEDBF, 0x0000, 0xEDC9, 0xC14E, 0xEDBE,
+	0xEDBD, 0xEDC7, 0xEDC4, 0xEDC6, 0x0000, 0xEDBA, 0xEDCA, 0xC14C, 0x0000, 0xEDC5, 0xEDCE, 0xEDC2, 0xC150, 0xC14D, 0xEDC0, 0xEDBB,
+	0xEDCD, 0xBF75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF063, 0x0000, 0x0000, 0xF061, 0xF067, 0xC2B0, 0xF065,
+	0xF064, 0xC2B2, 0xF06A, 0xC2B1, 0x0000, 0xF06B, 0xF068, 0xC2AE, 0xF069, 0xF062, 0xC2AF, 0xC2AD, 0xF2AB, 0xF066, 0x0000, 0x0000,
+	0xF06C, 0x0000, 0x0000, 0xF2A8, 0x0000, 0x0000, 0x0000, 0xC3B2, 0xC3B0, 0xF2AA, 0x0000, 0xF2AC, 0xF2A9, 0xC3B1, 0xC3AE, 0xC3AF,
+	0xC3B3, 0x0000, 0x0000, 0xC478, 0x0000, 0xF4AA, 0x0000, 0xF4A9, 0xF4A7, 0xF4A6, 0xF4A8, 0x0000, 0xC477, 0xC479, 0x0000, 0x0000,
+	0xC4F0, 0x0000, 0x0000, 0xF5E5, 0xF5E4, 0x0000, 0x0000, 0xF6FA, 0x0000, 0xF6FC, 0xF6FE, 0xF6FD, 0xF6FB, 0x0000, 0x0000, 0xC5A3,
+	0xC5A2, 0x0000, 0x0000, 0xC5D3, 0xC5D2, 0xC5D4, 0xF7ED, 0xF7EC, 0x0000, 0xF8FB, 0xF8B8, 0xF8FC, 0xC658, 0x0000, 0xC659, 0xF96D,
+	0x0000, 0x0000, 0xC67E, 0xA6CC, 0x0000, 0xCDA8, 0x0000, 0x0000, 0xD045, 0xD046, 0xD044, 0x0000, 0x0000, 0xACF3, 0x0000, 0xD047,
+	0xD048, 0xD049, 0x0000, 0x0000, 0xD349, 0xD34F, 0x0000, 0x0000, 0xD34D, 0xAFBB, 0xD34B, 0x0000, 0xD34C, 0xD34E, 0x0000, 0x0000,
+	0x0000, 0xD34A, 0xB2C9, 0x0000, 0xD6DE, 0xB2CB, 0xD6E0, 0xB2CA, 0xD6DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDAE8, 0xB5AF,
+	0x0000, 0xDAEA, 0xDAE7, 0xD6E1, 0x0000, 0xB5B0, 0x0000, 0xF9DB, 0xDAE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF56,
+	0x0000, 0xB864, 0xDF54, 0xB865, 0xDF55, 0xB866, 0x0000, 0x0000, 0x0000, 0xBAE9, 0xE361, 0xE35E, 0xE360, 0xBAEA, 0xBAEB, 0xE35F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6DF, 0x0000, 0x0000, 0xE6E0, 0x0000, 0xBD6B, 0xE6E2, 0xE6E1, 0x0000, 0xA261, 0x0000,
+	0xEACA, 0xEACB, 0xEAC7, 0x0000, 0xEAC8, 0xBF7C, 0xBF7D, 0xEAC9, 0x0000, 0xC157, 0x0000, 0x0000, 0xC153, 0xC158, 0xC154, 0xC156,
+	0xC152, 0x0000, 0xC155, 0x0000, 0x0000, 0x0000, 0x0000, 0xC2B3, 0xEDCF, 0x0000, 0xF2AE, 0x0000, 0xF2AD, 0x0000, 0xF4AB, 0xC47A,
+	0xC47B, 0xF741, 0xF5E6, 0x0000, 0xF740, 0x0000, 0xF8FD, 0xF9A4, 0xA6CD, 0x0000, 0x0000, 0xA874, 0x0000, 0xCDA9, 0xAAC8, 0x0000,
+	0xACF6, 0xD04C, 0xACF4, 0xD04A, 0xACF9, 0xACF5, 0xACFA, 0xACF8, 0xD04B, 0xACF7, 0xAFBF, 0xAFBE, 0xD35A, 0xAFC7, 0xD353, 0xD359,
+	0xAFC3, 0xD352, 0xD358, 0xD356, 0xAFC2, 0xAFC4, 0xD355, 0xAFBD, 0xD354, 0xAFC8, 0xAFC5, 0xAFC9, 0xAFC6, 0xD351, 0xD350, 0xD357,
+	0xAFC0, 0xAFBC, 0xAFC1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6F0, 0xD6E9, 0x0000, 0xB5B5, 0xD6E8, 0x0000, 0xB2CF, 0xB2D6,
+	0xB2D3, 0xB2D9, 0xB2D8, 0xB2D4, 0x0000, 0xD6E2, 0xD6E5, 0x0000, 0xD6E4, 0xB2D0, 0xD6E6, 0xD6EF, 0xB2D1, 0xD6E3, 0xD6EC, 0xD6ED,
+	0xB2D2, 0xD6EA, 0xB2D7, 0xB2CD, 0xB2D5, 0xD6E7, 0xB2CC, 0xD6EB, 0x0000, 0x0000, 0xD6EE, 0x0000, 0x0000, 0x0000, 0xDAFB, 0xDAF2,
+	0xB5B2, 0xDAF9, 0xDAF6, 0xDAEE, 0xDAF7, 0xB5B4, 0xDAEF, 0x0000, 0xDAEB, 0x0000, 0x0000, 0xB86C, 0xDAF4, 0x0000, 0xB5B1, 0xDAFA,
+	0x0000, 0xB5B8, 0xB5BA, 0xDAED, 0x0000, 0x0000, 0xB5B9, 0xDAF0, 0xB5B3, 0xDAF8, 0xDAF1, 0xDAF5, 0x0000, 0xDAF3, 0xB5B6, 0xDAEC,
+	0xB5BB, 0xB2CE, 0xB5B7, 0xB5BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB868, 0xDF5D, 0xDF5F, 0xDF61, 0xDF65, 0x0000, 0xDF5B,
+	0xDF59, 0xB86A, 0x0000, 0xDF60, 0xDF64, 0xDF5C, 0xDF58, 0x0000, 0xDF57, 0x0000, 0x0000, 0x0000, 0xDF62, 0xDF5A, 0xDF5E, 0xB86B,
+	0x0000, 0xB869, 0xDF66, 0xB867, 0xDF63, 0x0000, 0xE372, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBAEE, 0xE36A, 0xBD78, 0xE374,
+	0xBAF1, 0xE378, 0xBAF7, 0xE365, 0x0000, 0x0000, 0xE375, 0xE362, 0x0000, 0xE377, 0xE366, 0x0000, 0xBAFE, 0xBAFB, 0xE376, 0xE370,
+	0xBAED, 0xBAF5, 0xBAF4, 0x0000, 0xBAF3, 0xBAF9, 0x0000, 0xE363, 0xBAFA, 0xE371, 0xBAF6, 0xBAEC, 0xE373, 0xBAEF, 0xBAF0, 0xBAF8,
+	0xE368, 0xE367, 0xE364, 0x0000, 0xE36C, 0xE369, 0xE36D, 0xBAFD, 0x0000, 0xE379, 0xBAF2, 0xE36E, 0xE36F, 0x0000, 0xE36B, 0x0000,
+	0x0000, 0x0000, 0xBAFC, 0x0000, 0x0000, 0x0000, 0x0000, 0xE6E7, 0xBD70, 0xBD79, 0xBD75, 0xE6E4, 0x0000, 0xBD72, 0xBD76, 0xE6F0,
+	0xBD6C, 0xE6E8, 0x0000, 0xBD74, 0x0000, 0x0000, 0xE6EB, 0xE6E6, 0xBD73, 0xBD77, 0xE6E5, 0x0000, 0xBD71, 0x0000, 0xE6EF, 0xBD6E,
+	0xE6EE, 0xE6ED, 0xBD7A, 0xE572, 0xBD6D, 0x0000, 0xE6EC, 0xE6E3, 0x0000, 0xBD7B, 0xE6EA, 0xBD6F, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xE6E9, 0x0000, 0x0000, 0x0000, 0x0000, 0xBFA2, 0xBFA7, 0xBF7E, 0xEAD8, 0xEACF, 0xEADB, 0xEAD3, 0xEAD9,
+	0xBFA8, 0xBFA1, 0xEACC, 0xEAD2, 0xEADC, 0xEAD5, 0xEADA, 0xEACE, 0x0000, 0x0000, 0xEAD6, 0xBFA3, 0xEAD4, 0xBFA6, 0xBFA5, 0xEAD0,
+	0xEAD1, 0xEACD, 0xEAD7, 0xBFA4, 0xEADE, 0xEADD, 0x0000, 0x0000, 0x0000, 0xEDDA, 0xEDD6, 0xC15F, 0x0000, 0xEDD0, 0xC159, 0xC169,
+	0xEDDC, 0xC161, 0xC15D, 0xEDD3, 0xC164, 0xC167, 0xEDDE, 0xC15C, 0xEDD5, 0xC165, 0xEDE0, 0xEDDD, 0xEDD1, 0xC160, 0xC15A, 0xC168,
+	0xEDD8, 0xC163, 0xEDD2, 0xC15E, 0xEDDF, 0xC162, 0xC15B, 0xEDD9, 0xC166, 0xEDD7, 0x0000, 0x0000, 0xEDDB, 0x0000, 0x0000, 0x0000,
+	0xF06E, 0xF074, 0xC2B9, 0xF077, 0xC2B4, 0xC2B5, 0xF06F, 0xF076, 0xF071, 0xC2BA, 0xC2B7, 0x0000, 0xF06D, 0x0000, 0xC2B6, 0xF073,
+	0xF075, 0xC2B8, 0xF072, 0xF070, 0x0000, 0x0000, 0x0000, 0x0000, 0xF2B8, 0xC3B7, 0xC3B8, 0xC3B4, 0x0000, 0xC3B5, 0x0000, 0xF2B4,
+	0xF2B2, 0x0000, 0xF2B6, 0xC3BA, 0xF2B7, 0xF2B0, 0xF2AF, 0xF2B3, 0xF2B1, 0xC3B6, 0xF2B5, 0xF4AC, 0xC47E, 0xC47D, 0xF4AD, 0x0000,
+	0xF4AF, 0xF4AE, 0xC4A1, 0x0000, 0x0000, 0x0000, 0xF5EB, 0xF5E8, 0xF5E9, 0x0000, 0xF5E7, 0xF5EA, 0xC4F2, 0xF5EC, 0x0000, 0xC4F1,
+	0x0000, 0xF742, 0x0000, 0xC5D5, 0xC5D7, 0xF7EE, 0xC5D6, 0xF8B9, 0xF940, 0xF942, 0xF8FE, 0xF941, 0xC66C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6CE, 0x0000, 0xACFB, 0xD26F, 0xAFCA, 0x0000, 0x0000, 0xB2DA, 0xDAFC, 0xDAFD,
+	0x0000, 0x0000, 0x0000, 0xEADF, 0xC16A, 0xEDE1, 0x0000, 0x0000, 0xC2BB, 0x0000, 0xF2BA, 0xF2B9, 0xC4A2, 0xF5ED, 0x0000, 0xF743,
+	0xC5F8, 0xCA49, 0x0000, 0x0000, 0xAAC9, 0xA875, 0x0000, 0x0000, 0xD04D, 0x0000, 0x0000, 0xD360, 0xD35B, 0xD35F, 0xD35D, 0xAFCB,
+	0xD35E, 0xD35C, 0x0000, 0xD6F1, 0x0000, 0xDAFE, 0xDB40, 0xDF69, 0xDF6A, 0xB86E, 0xB86F, 0xDF68, 0xDF6B, 0xDF67, 0xB86D, 0x0000,
+	0xBB40, 0x0000, 0xB870, 0xE37A, 0x0000, 0xBD7C, 0xE6F1, 0xBD7D, 0x0000, 0xBFA9, 0xEAE2, 0xEAE0, 0xEAE1, 0xEDE4, 0xEDE3, 0xEDE2,
+	0x0000, 0x0000, 0x0000, 0xF2BB, 0x0000, 0xC3B9, 0xF2BC, 0xF744, 0xC5F9, 0xF8BA, 0xA6CF, 0xAACB, 0xAACA, 0xD04F, 0xACFC, 0x0000,
+	0x0000, 0xD04E, 0xD362, 0x0000, 0xAFCC, 0xD6F2, 0xD361, 0x0000, 0x0000, 0x0000, 0xB2DC, 0xD6F5, 0xD6F3, 0xD6F4, 0xB2DB, 0x0000,
+	0xDB42, 0xDB43, 0xDB41, 0x0000, 0xB873, 0xDF6D, 0xDF6C, 0xDF6E, 0xB872, 0xB871, 0x0000, 0x0000, 0xE6F2, 0xE6F4, 0x0000, 0xBD7E,
+	0xE6F3, 0xEAE3, 0xBFAA, 0xF079, 0x0000, 0xF078, 0xC3BB, 0xF2BD, 0xC3BD, 0xC3BC, 0xF4B0, 0xF5EE, 0xC4F3, 0xA6D0, 0xD050, 0xACFD,
+	0xD365, 0xAFCE, 0xD364, 0xD363, 0x0000, 0xAFCD, 0x0000, 0xD6FB, 0x0000, 0xD6FD, 0xD6F6, 0xD6F7, 0xB2DD, 0xD6F8, 0xB2DE, 0xD6FC,
+	0xD6F9, 0xD6FA, 0xB2DF, 0x0000, 0xB5BE, 0xB5BF, 0x0000, 0xDB44, 0x0000, 0x0000, 0x0000, 0xDF6F, 0xDF70, 0x0000, 0xE37E, 0xBB43,
+	0xBB41, 0xBB42, 0xE37B, 0xE37C, 0x0000, 0xE37D, 0xE6F9, 0x0000, 0xE6FA, 0xBDA1, 0xE6F7, 0xE6F6, 0xE6F8, 0xE6F5, 0xBFAD, 0xEAE4,
+	0xBFAB, 0xBFAC, 0xEDE6, 0xC16B, 0xEDE5, 0xEFA8, 0x0000, 0xF07A, 0xF07B, 0xC2BC, 0x0000, 0xC2BD, 0xC16C, 0xF2BE, 0xF2BF, 0xF4B1,
+	0xC4A3, 0xA6D1, 0x0000, 0xA6D2, 0xACFE, 0xAACC, 0xAFCF, 0xD051, 0x0000, 0x0000, 0x0000, 0xB5C0, 0xA6D3, 0xAD41, 0xD052, 0xD053,
+	0xAD40, 0xAD42, 0xA6D4, 0x0000, 0xD054, 0xAFD1, 0xD366, 0xAFD3, 0xAFD0, 0xAFD2, 0x0000, 0xD741, 0xB2E0, 0x0000, 0xD740, 0xD6FE,
+	0x0000, 0xDF71, 0x0000, 0x0000, 0xE3A1, 0x0000, 0xBDA2, 0x0000, 0xBFAE, 0xEAE6, 0xEAE5, 0x0000, 0xEDE7, 0x0000, 0x0000, 0x0000,
+	0xF5EF, 0x0000, 0x0000, 0xA6D5, 0xCB73, 0xCDAA, 0xAD43, 0xD055, 0x0000, 0xD368, 0x0000, 0x0000, 0x0000, 0xAFD4, 0xD367, 0xAFD5,
+	0x0000, 0x0000, 0x0000, 0xD743, 0x0000, 0x0000, 0xB2E2, 0xD742, 0xD744, 0x0000, 0xB2E1, 0x0000, 0x0000, 0x0000, 0x0000, 0xDB46,
+	0xDB47, 0xDB45, 0xB5C1, 0x0000, 0x0000, 0x0000, 0xB874, 0x0000, 0xB875, 0x0000, 0xBB45, 0x0000, 0xE3A3, 0xE3A2, 0xBB44, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xE6FB, 0x0000, 0x0000, 0xE6FC, 0x0000, 0x0000, 0x0000, 0x0000, 0xEAE7, 0x0000, 0x0000, 0xC170,
+	0xC16F, 0xC16D, 0xC16E, 0xC171, 0x0000, 0xF07C, 0xC2BF, 0xC2BE, 0xF2C0, 0xF4B2, 0x0000, 0x0000, 0x0000, 0xC5A5, 0xC5A4, 0xA6D6,
+	0x0000, 0x0000, 0xD1FB, 0x0000, 0xB877, 0xB5C2, 0xB876, 0xBB46, 0x0000, 0xA6D7, 0xC9A9, 0xA6D8, 0xA6D9, 0x0000, 0x0000, 0xCDAB,
+	0xCB76, 0x0000, 0xCB77, 0xA877, 0x0000, 0xCB74, 0xA876, 0x0000, 0xA879, 0xCB75, 0xA87B, 0xA87A, 0xCB78, 0xA878, 0x0000, 0x0000,
+	0x0000, 0xAAD1, 0xAACF, 0xCDAD, 0x0000, 0xAACE, 0x0000, 0x0000, 0x0000, 0xAAD3, 0xAAD5, 0xAAD2, 0x0000, 0xCDB0, 0xCDAC, 0xAAD6,
+	0x0000, 0xAAD0, 0xA87C, 0x0000, 0xAAD4, 0xCDAF, 0x0000, 0x0000, 0xCDAE, 0x0000, 0xAACD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD05B, 0xAD47, 0xAD48, 0xD05D, 0x0000, 0xD057, 0xD05A, 0xD063, 0xD061, 0x0000, 0xAD49, 0xD067, 0xAD4C, 0xD064,
+	0xD05C, 0xD059, 0x0000, 0x0000, 0xDB49, 0xD062, 0xAD44, 0xD065, 0xD056, 0xD05F, 0xAD46, 0xAD4B, 0xD060, 0xAD4F, 0xAD4D, 0x0000,
+	0xD058, 0xAD4A, 0x0000, 0xD05E, 0xAD4E, 0xAD45, 0xD066, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAFDA, 0x0000, 0xAFE3,
+	0xAFD8, 0xAFD6, 0xD36A, 0xAFDE, 0xAFDB, 0xD36C, 0x0000, 0x0000, 0xAFDD, 0xD36B, 0xD369, 0xD36E, 0xAFE2, 0xAFE0, 0xDB48, 0x0000,
+	0xD36F, 0xD36D, 0xAFD7, 0x0000, 0x0000, 0xAFD9, 0xAFDC, 0x0000, 0xAFDF, 0x0000, 0xAFE1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD74E, 0xB2E4, 0x0000, 0xD745, 0xD747, 0x0000, 0xD748, 0x0000, 0xD750, 0xD74C, 0xD74A,
+	0x0000, 0xD74D, 0xD751, 0xB2E5, 0xB2E9, 0xD746, 0x0000, 0xD74F, 0x0000, 0xB2E7, 0x0000, 0xB2E6, 0xD74B, 0xD749, 0x0000, 0xB2E3,
+	0xB2E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB5C8, 0xDB51, 0x0000, 0x0000, 0xDB4F, 0xB5CA, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDB4A, 0xDFA1, 0x0000, 0xB5C9, 0xDB4E, 0x0000, 0x0000, 0xDB4B, 0xB5C5, 0xB5CB, 0xDB50, 0xB5C7, 0xDB4D,
+	0xBB47, 0xB5C6, 0xDB4C, 0xB5CC, 0xB5C4, 0xB5C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF77, 0xDF75, 0x0000, 0xDF7B, 0x0000,
+	0xDF73, 0xDFA2, 0xDF78, 0x0000, 0xDF72, 0xB87B, 0xB8A3, 0xDF7D, 0x0000, 0xDF76, 0x0000, 0xB87E, 0x0000, 0x0000, 0xB87C, 0xDF7E,
+	0xB879, 0xB878, 0xDF79, 0xB87D, 0xB5CD, 0x0000, 0xDF7C, 0xDF74, 0xB87A, 0xB8A1, 0xB8A2, 0x0000, 0x0000, 0x0000, 0x0000, 0xBB4C,
+	0xBB48, 0x0000, 0xBB4D, 0xE3A6, 0x0000, 0x0000, 0xE3A5, 0xE3A7, 0xBB4A, 0xE3A4, 0xBB4B, 0xE3AA, 0xE3A9, 0xE3A8, 0x0000, 0xBB49,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE741, 0x0000, 0xE744, 0xBDA8, 0xE743, 0xBDA7, 0xBDA3, 0xBDA4, 0xBDA5, 0xE740, 0xE6FE,
+	0xBDA6, 0x0000, 0xE742, 0xE6FD, 0x0000, 0x0000, 0xEAE9, 0xEAF3, 0xBFB1, 0xBFB0, 0x0000, 0xEAED, 0xEAEF, 0x0000, 0xEAEA, 0x0000,
+	0xEAEE, 0xEAE8, 0xEAF1, 0xBFAF, 0xEAF0, 0xEAEC, 0x0000, 0xEAF2, 0x0000, 0xEAEB, 0xC174, 0xEDE8, 0xEDEE, 0xC178, 0xC17A, 0xC177,
+	0xC176, 0x0000, 0xC175, 0xC173, 0xEDE9, 0xEDEC, 0xC172, 0xEDED, 0x0000, 0xC179, 0xEDEB, 0x0000, 0xEDEA, 0xC2C0, 0x0000, 0xC2C1,
+	0xF0A1, 0xF07D, 0xF07E, 0x0000, 0x0000, 0xF2C2, 0x0000, 0xF2C1, 0xC3BE, 0xF4B4, 0xC4A4, 0xF4B3, 0x0000, 0xF5F0, 0xF745, 0xC5A6,
+	0xF943, 0xF944, 0xC5D8, 0xA6DA, 0x0000, 0xAAD7, 0xDB52, 0xBB4E, 0xC17B, 0xEDEF, 0xA6DB, 0x0000, 0xAFE5, 0xAFE4, 0xDB53, 0x0000,
+	0x0000, 0x0000, 0xEAF4, 0xA6DC, 0xAD50, 0x0000, 0x0000, 0xDB54, 0xDB55, 0xDB56, 0xBB4F, 0xBFB2, 0xA6DD, 0x0000, 0xAAD8, 0xD068,
+	0xAFE6, 0xD370, 0xB2EA, 0x0000, 0xDB57, 0xB8A4, 0x0000, 0xBB50, 0xBFB3, 0xC17C, 0xC2C2, 0xF4B5, 0xA6DE, 0xAAD9, 0x0000, 0x0000,
+	0xAFE7, 0xD752, 0xB5CE, 0x0000, 0xBB51, 0xE3AB, 0xE745, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6DF, 0xB5CF, 0xDFA3, 0xBB52, 0xA6E0,
+	0xCDB1, 0xD069, 0xAD51, 0x0000, 0x0000, 0xD372, 0x0000, 0x0000, 0xAFEA, 0x0000, 0xAFE8, 0xAFE9, 0xAFEB, 0x0000, 0x0000, 0xD371,
+	0x0000, 0x0000, 0xD757, 0xD754, 0xD756, 0xB2EB, 0xB2ED, 0xB2EC, 0xD753, 0xB2EE, 0xD755, 0x0000, 0xDB58, 0xDB59, 0x0000, 0xDB5A,
+	0xDFA6, 0x0000, 0xDFA7, 0x0000, 0xDFA5, 0xDFA8, 0x0000, 0xB8A5, 0x0000, 0xDFA4, 0x0000, 0xBB53, 0x0000, 0x0000, 0xE74A, 0xE746,
+	0xE749, 0xE74B, 0xE748, 0xE747, 0x0000, 0xEAF5, 0xEAF6, 0xEAF7, 0xBFB4, 0xBFB5, 0xEDF1, 0xEDF0, 0xEDF2, 0x0000, 0xF0A3, 0xF0A2,
+	0x0000, 0xF2C4, 0x0000, 0xF2C5, 0xF2C3, 0x0000, 0xC4A5, 0x0000, 0xF4B6, 0xF4B7, 0x0000, 0xF746, 0xF7EF, 0xF8BB, 0xA6E1, 0xA87D,
+	0x0000, 0xC17D, 0xA6E2, 0x0000, 0xD758, 0xDB5B, 0x0000, 0xC641, 0xCA4A, 0x0000, 0x0000, 0x0000, 0xCA4B, 0xCA4D, 0xA6E3, 0xCA4E,
+	0xCA4C, 0x0000, 0x0000, 0xCBA2, 0xCBA3, 0xCB7B, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBA1, 0xA8A1, 0x0000, 0xA8A2, 0xCB7C, 0xCB7A,
+	0xCB79, 0xCB7D, 0xA87E, 0xCB7E, 0xD06A, 0x0000, 0x0000, 0x0000, 0xCDB6, 0xAADC, 0xCDB5, 0xCDB7, 0x0000, 0xAADB, 0xCDBC, 0xAADF,
+	0xCDB2, 0xCDC0, 0xCDC6, 0xAAE6, 0xCDC3, 0xAAE3, 0x0000, 0xCDB9, 0xCDBF, 0xCDC1, 0x0000, 0xCDB4, 0xAAE2, 0xAADD, 0xCDBA, 0xAAE4,
+	0xAAE7, 0xAAE1, 0x0000, 0xAADA, 0xCDBE, 0xCDB8, 0xCDC5, 0xAAE9, 0xAAE5, 0xAAE0, 0xCDBD, 0xAFEC, 0xCDBB, 0xAADE, 0xAAE8, 0x0000,
+	0xCDB3, 0x0000, 0xCDC2, 0xCDC4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xAD62, 0xAD5C, 0xAD64, 0xAD61, 0xD071, 0xD074, 0xAD5D, 0x0000, 0xD06B, 0x0000, 0xAD56, 0xAD60, 0x0000, 0xAD63, 0xAD65,
+	0xD0A2, 0xD077, 0x0000, 0xAD55, 0xD0A1, 0xAD59, 0xAD57, 0xAD52, 0xD06F, 0x0000, 0xD07E, 0xD073, 0xD076, 0xD0A5, 0x0000, 0xAD66,
+	0xD07D, 0xAD5E, 0xD078, 0xD0A4, 0xD075, 0xD079, 0xD07C, 0x0000, 0x0000, 0xD06D, 0xD0A3, 0xD07B, 0x0000, 0x0000, 0xD06C, 0x0000,
+	0xD070, 0xAD5F, 0xAD5A, 0xAD53, 0xAD58, 0xAD54, 0xAD67, 0xD06E, 0xD3A5, 0xAD5B, 0x0000, 0x0000, 0xD07A, 0xCE41, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3A8, 0xAFFA, 0x0000, 0xD376, 0x0000, 0xD3A3, 0xD37D, 0x0000, 0xD3B2, 0x0000,
+	0xD3AA, 0x0000, 0xD37E, 0x0000, 0xD3A9, 0xD378, 0xD37C, 0xD3B5, 0xAFFD, 0xD3AD, 0xD3A4, 0xAFED, 0xD3B3, 0xD374, 0x0000, 0xD3AC,
+	0x0000, 0xAFFC, 0xAFF7, 0xD373, 0xAFF5, 0xAFF4, 0xAFF9, 0xD3AB, 0xAFF1, 0xAFF8, 0xD072, 0xDB5C, 0xD3A6, 0x0000, 0x0000, 0xD37A,
+	0xAFFB, 0xD37B, 0xD3A1, 0xAFFE, 0xD375, 0xD3AF, 0x0000, 0xD3AE, 0xD3B6, 0xAFF3, 0xAFF0, 0xD3B4, 0xD3B0, 0xD3A7, 0xD3A2, 0xAFF6,
+	0xAFF2, 0xD377, 0xAFEE, 0xD3B1, 0xAFEF, 0x0000, 0xD379, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xD75E, 0xD760, 0xD765, 0xD779, 0xB2FC, 0xB2F2, 0x0000, 0xD75D, 0xB2FD, 0xB2FE, 0xD768, 0xD76F, 0xD775,
+	0x0000, 0xD762, 0x0000, 0xD769, 0x0000, 0x0000, 0xB340, 0xD777, 0xD772, 0xB2FA, 0xB2F8, 0xD76E, 0xD76A, 0xD75C, 0xB2EF, 0xD761,
+	0xD759, 0x0000, 0xB2F7, 0xB2F9, 0xD766, 0xD763, 0xB2F4, 0xD773, 0xB2F1, 0xD764, 0xD77A, 0xD76C, 0x0000, 0xD76B, 0xB2F0, 0x0000,
+	0xB2FB, 0x0000, 0xB2F3, 0xD75A, 0xD75F, 0xD770, 0xD776, 0xB341, 0xD75B, 0xD767, 0xD76D, 0xB2F6, 0x0000, 0x0000, 0xD778, 0xD771,
+	0xD774, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB2F5, 0x0000, 0xDB6C,
+	0xDB60, 0xB5D7, 0xDB7D, 0xDBA7, 0xDBAA, 0xB5D5, 0xDB68, 0xDBA3, 0xDB69, 0xDB77, 0xB5E2, 0xDB73, 0xB5DF, 0x0000, 0xDB74, 0xDB5D,
+	0x0000, 0xDBA4, 0x0000, 0x0000, 0xB5E8, 0xDBA1, 0xDB75, 0xDBAC, 0xDB70, 0xDFC8, 0x0000, 0xDBAF, 0xB5E6, 0xDB6E, 0xDB7A, 0xB5E9,
+	0xB5D4, 0xDB72, 0xDBAD, 0xDB6B, 0xDB64, 0xDB6F, 0x0000, 0xDB63, 0xDB61, 0xB5D0, 0xDBA5, 0xDB6A, 0xDBA8, 0x0000, 0xDBA9, 0xB5D8,
+	0xB5DD, 0xB5D9, 0xB5E1, 0xDB7E, 0xB5DA, 0xDB76, 0xDB66, 0x0000, 0xB5D2, 0xDB5E, 0xDBA2, 0xDBAB, 0xDB65, 0xB5E0, 0xDBB0, 0xDB71,
+	0x0000, 0xDB6D, 0x0000, 0xB5D1, 0xB5E5, 0x0000, 0xDB7C, 0xB5E7, 0x0000, 0xDB78, 0xB5DC, 0xB5D6, 0xB5DE, 0xB5D3, 0xB5E4, 0xDB79,
+	0xDB67, 0xDB7B, 0xDB62, 0xDBA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBAE, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xDB5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFC7, 0x0000, 0xDFDD, 0xB855, 0xDFCC, 0x0000, 0xDFCA,
+	0xDFB5, 0xB8A9, 0xDFC5, 0xDFD9, 0xDFC1, 0xB8B1, 0xDFD8, 0xDFBF, 0xB5E3, 0xDFCF, 0xDFC0, 0xDFD6, 0xB8B0, 0xB8A8, 0x0000, 0xDFAA,
+	0xDFB2, 0x0000, 0xDFCB, 0xDFC3, 0xDFDC, 0xDFC6, 0xB8B6, 0xDFD7, 0x0000, 0xB8AD, 0x0000, 0xDFC9, 0xDFD1, 0xDFB6, 0xDFD0, 0x0000,
+	0xDFE1, 0xDFB1, 0xDFD2, 0x0000, 0xDFDF, 0x0000, 0xDFAB, 0xB5DB, 0x0000, 0xDFB9, 0xDFB8, 0xB8AF, 0x0000, 0xDFBC, 0xDFBE, 0xDFCD,
+	0xDFDE, 0xB8B2, 0x0000, 0xB8B3, 0x0000, 0xDFB0, 0xB8AB, 0xDFB4, 0xDFDA, 0xB8B4, 0x0000, 0xB8AC, 0xB8AE, 0xB8B5, 0xDFE0, 0xDFD3,
+	0xDFCE, 0x0000, 0x0000, 0xDFBB, 0xDFBA, 0xB8AA, 0xDFAC, 0xB8A7, 0xDFC4, 0xDFAD, 0xDFC2, 0x0000, 0x0000, 0xDFB7, 0xDFDB, 0x0000,
+	0x0000, 0x0000, 0xB8A6, 0x0000, 0x0000, 0x0000, 0xDFB3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFAF, 0xDFD5, 0xDFAE,
+	0xBB60, 0xE3D3, 0x0000, 0x0000, 0xE3C2, 0x0000, 0x0000, 0xE3AC, 0xE3CA, 0xBB58, 0xE3BB, 0xE3C5, 0xBB5B, 0xE3BE, 0xBB59, 0xE3AF,
+	0xE3CD, 0xE3AE, 0xE3C1, 0x0000, 0xE3AD, 0x0000, 0x0000, 0xE3BF, 0xE3C8, 0xE3C6, 0xE3BA, 0xE3B5, 0xE3B3, 0x0000, 0xE3B4, 0xE3C7,
+	0xE3D2, 0xE3BC, 0xBB5A, 0x0000, 0xE3B7, 0x0000, 0xE3CB, 0x0000, 0xBB5D, 0xE3B6, 0xE3B0, 0xE3C0, 0xBB61, 0x0000, 0x0000, 0xBB55,
+	0xBB5E, 0xE3B8, 0xE3B2, 0x0000, 0xBB57, 0xDFD4, 0xBB56, 0xE3C3, 0x0000, 0xBB54, 0xBB63, 0xBB5C, 0xE3C4, 0xE3B9, 0xE3B1, 0xE3CC,
+	0xE3BD, 0xBB62, 0xE3D0, 0xBB5F, 0xE3CF, 0x0000, 0xE3C9, 0xE3CE, 0x0000, 0x0000, 0x0000, 0xE3D1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE773, 0xE774, 0xE767, 0xE766, 0xE762, 0xBDB4, 0x0000, 0xBDAC, 0xE776,
+	0xE775, 0xDFA9, 0xE75F, 0xE763, 0xE75D, 0x0000, 0xE770, 0xE761, 0x0000, 0xE777, 0xE75A, 0xE758, 0xE764, 0xE76E, 0xE769, 0xBDB6,
+	0xE74F, 0x0000, 0xE76D, 0x0000, 0x0000, 0x0000, 0xBDB7, 0xDFBD, 0xE75B, 0xE752, 0xE755, 0xE77B, 0xE75C, 0xE753, 0xE751, 0xE74E,
+	0x0000, 0xBDB0, 0xE765, 0xBDAF, 0xBDB3, 0xE760, 0xE768, 0xBDA9, 0xE778, 0xE77C, 0xBDAB, 0x0000, 0xE757, 0xE76B, 0xE76F, 0xE754,
+	0xE779, 0xBDB2, 0x0000, 0xBDB1, 0xE74C, 0xBDB5, 0xE772, 0xE756, 0xE76A, 0xE750, 0xE75E, 0xE759, 0xBDAD, 0xBDAE, 0xE76C, 0xE77D,
+	0xE77A, 0xE771, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE74D, 0x0000, 0xBDAA, 0xEB49, 0x0000,
+	0xEB40, 0xEB43, 0x0000, 0xBFBB, 0xEB45, 0xEAF9, 0xEB41, 0xEB47, 0xBFB8, 0xBFBC, 0xBFB6, 0x0000, 0x0000, 0xEAFB, 0xEB4C, 0x0000,
+	0x0000, 0xEB46, 0x0000, 0xEAFC, 0xEB55, 0xEB4F, 0xEAF8, 0xEE46, 0xEAFE, 0xBFB7, 0x0000, 0xEB4A, 0x0000, 0xEB54, 0xBFBF, 0x0000,
+	0xEB51, 0xEAFD, 0xEB44, 0xEB48, 0xEB42, 0xEB56, 0xEB53, 0xEB50, 0xBFB9, 0xBFBA, 0xBFBE, 0xEAFA, 0xEB57, 0xBFBD, 0xEB4D, 0x0000,
+	0x0000, 0xEB4B, 0x0000, 0x0000, 0x0000, 0xEB4E, 0xEE53, 0xEE40, 0xEE45, 0xEE52, 0xEE44, 0xEDFB, 0xEE41, 0x0000, 0xC1A2, 0x0000,
+	0xEDF4, 0xEE4D, 0xEE4F, 0xEDF3, 0xC1A1, 0xEE51, 0xEE49, 0xC1A8, 0xEE50, 0xEE42, 0xC1AA, 0xEDF9, 0xEB52, 0xEE4A, 0xEE47, 0xEDF5,
+	0xEE55, 0xC1A4, 0x0000, 0x0000, 0xC1A5, 0xEDF7, 0xEE48, 0x0000, 0xEE54, 0xEE4B, 0xEDFD, 0xC1A7, 0xC1A3, 0xEE4C, 0xEDFE, 0xEE56,
+	0xEDF8, 0xEE43, 0xEE4E, 0xEDFA, 0xEDFC, 0x0000, 0xC2CB, 0xEDF6, 0xC1A9, 0xC2C4, 0xC17E, 0x0000, 0x0000, 0x0000, 0x0000, 0xC1A6,
+	0xC2C8, 0xF0B3, 0x0000, 0xF0A9, 0xF0A4, 0xF0AA, 0xF0B4, 0xF0B8, 0xF0B7, 0xC2CA, 0xC2C9, 0x0000, 0x0000, 0xF0AB, 0xF0B9, 0xF0AE,
+	0xF0A6, 0x0000, 0xF0A8, 0xF0A7, 0xF0AD, 0xF0B2, 0xF0A5, 0xF0AC, 0xF0B1, 0xC2C7, 0x0000, 0xF0AF, 0x0000, 0xC2C5, 0xF0B0, 0xC2C3,
+	0xC2C6, 0xF2D5, 0xF0B5, 0x0000, 0x0000, 0xC3C2, 0x0000, 0xF2CD, 0xF2D1, 0xF2C9, 0xF2CC, 0x0000, 0xF2D4, 0xC3C0, 0xF2D9, 0xF2D2,
+	0x0000, 0xF2CA, 0xF2DA, 0xF2D3, 0xC3C3, 0xC3C4, 0xF2D7, 0x0000, 0xF2CB, 0xC3BF, 0xC3C1, 0xF2C6, 0xF2CE, 0xF2C8, 0x0000, 0xF2D8,
+	0xF2D6, 0xF2C7, 0xF2CF, 0x0000, 0x0000, 0x0000, 0xF4BE, 0xC3C5, 0xF2D0, 0xC4A7, 0xC4A9, 0xC4A6, 0x0000, 0xF4C3, 0xF4BB, 0xF4B9,
+	0xF4BD, 0xF4BA, 0x0000, 0x0000, 0xF4BF, 0xF4C1, 0xC4AA, 0xC4AC, 0x0000, 0xF4C0, 0xC4AD, 0xC4AB, 0xF4C2, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xC4A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC4F4, 0xF5F1, 0xF5F7, 0xC4F6, 0xF4BC, 0xF5F6, 0x0000, 0xF5FD, 0xF5F4,
+	0xF5FB, 0xF5FA, 0xF4B8, 0xF5F5, 0xF0B6, 0xF5FE, 0xF5F3, 0xF5F8, 0x0000, 0xF5FC, 0xF5F2, 0x0000, 0xF74A, 0xC4F5, 0xF5F9, 0x0000,
+	0x0000, 0xF7F4, 0xF74B, 0xF749, 0xF747, 0xF748, 0xF74C, 0x0000, 0xC5D9, 0xF7F2, 0xF7F0, 0xF7F5, 0xF7F3, 0x0000, 0xF7F6, 0xC5DA,
+	0xF7F1, 0x0000, 0x0000, 0xF8BC, 0x0000, 0x0000, 0xF945, 0xF946, 0xF947, 0x0000, 0x0000, 0xF9C7, 0xF9BD, 0xCA4F, 0xAAEA, 0x0000,
+	0xAD68, 0x0000, 0xD3B8, 0xD3B7, 0xB040, 0xB342, 0xD77C, 0x0000, 0x0000, 0xD77B, 0x0000, 0xB5EA, 0xB8B8, 0x0000, 0xB8B7, 0xB8B9,
+	0x0000, 0xE3D4, 0xE77E, 0xEB58, 0xEB5A, 0xEB59, 0x0000, 0xC1AB, 0xEE57, 0xF0BA, 0xF9A5, 0xA6E4, 0x0000, 0xCDC9, 0xCDCA, 0xCDC8,
+	0xCDC7, 0xAAEB, 0x0000, 0xD0A9, 0xD0A7, 0x0000, 0x0000, 0xD0A6, 0x0000, 0xAD69, 0xAD6B, 0xAD6A, 0xD0A8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD3C4, 0xD3C1, 0xD3BF, 0x0000, 0x0000, 0xB041, 0xD3C2, 0xB046, 0xD3BC, 0xD3CB, 0x0000,
+	0xD3CD, 0xD3BD, 0x0000, 0xB043, 0xD3CE, 0xD3C9, 0xD3BB, 0xD3C0, 0xD3CA, 0xD3C6, 0xD3C3, 0x0000, 0xB048, 0xD3CC, 0xD3BE, 0x0000,
+	0x0000, 0xD3C7, 0xD3B9, 0xB047, 0xB044, 0xD3C5, 0x0000, 0xD3C8, 0xD3BA, 0xB045, 0xB042, 0x0000, 0x0000, 0x0000, 0x0000, 0xB34C,
+	0xD7A5, 0xB34B, 0x0000, 0xD7A8, 0xD7AB, 0xB348, 0xB346, 0xD77E, 0xD7A9, 0xD7A7, 0xD7A4, 0xD7AC, 0xD7AD, 0xD7AF, 0xD7B0, 0xD77D,
+	0xB345, 0xD7A2, 0xD7A1, 0xD7AE, 0xB347, 0xD7A3, 0xB349, 0xB344, 0xD7A6, 0xB34D, 0x0000, 0xB34A, 0xD7AA, 0x0000, 0x0000, 0x0000,
+	0xB5F1, 0xDBBF, 0x0000, 0xDBB4, 0xB5EE, 0x0000, 0xDFE7, 0xDBBD, 0xDBB1, 0xB5EC, 0xDBB6, 0xB5EF, 0xDBBA, 0xDBB8, 0xB5F2, 0xB5EB,
+	0x0000, 0x0000, 0xDBB2, 0xDBB5, 0xB5F0, 0x0000, 0xDBB3, 0x0000, 0xDBBE, 0xDBBC, 0xDBB7, 0xDBB9, 0xDBBB, 0xB5ED, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFE8, 0xDFEE, 0xDFE4, 0xDFEA, 0xB8BA, 0xDFE6, 0xB8C0, 0x0000, 0x0000, 0xB8BF, 0x0000,
+	0xB8BE, 0xDFED, 0xB8C1, 0xB8C2, 0xDFE3, 0xDFF0, 0xB8C3, 0xB8BD, 0xB8BC, 0xDFEC, 0xB8C4, 0xDFE2, 0xDFE5, 0xDFEF, 0xDFEB, 0x0000,
+	0x0000, 0xE3F4, 0xE3E9, 0xB8BB, 0x0000, 0x0000, 0x0000, 0x0000, 0xBB6A, 0xE3DD, 0xE3F2, 0xE3DE, 0xBB65, 0x0000, 0xE3DB, 0x0000,
+	0xE3E4, 0xE3DC, 0xBB67, 0xE3D6, 0xE3F1, 0xBB68, 0xE3EE, 0xE3EF, 0xE3D7, 0xBB6D, 0xE3E6, 0x0000, 0xE3E0, 0xE3E7, 0xE3DA, 0x0000,
+	0xE3F3, 0xE3EB, 0xE3E5, 0xE3D5, 0xBB69, 0xE3EC, 0x0000, 0xBB6C, 0xE3F0, 0x0000, 0xE3EA, 0xBB66, 0xE3E8, 0x0000, 0xE3E2, 0xBB64,
+	0xE3D9, 0xE3E1, 0xE3ED, 0xE3DF, 0x0000, 0x0000, 0xE3E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDC1, 0xDFE9, 0xE7B2, 0xE7BB,
+	0xE7B1, 0xE7AD, 0xE7AA, 0xBDC2, 0xE7A8, 0xBB6B, 0xE7A1, 0xBDC0, 0xE7A7, 0xBDBF, 0xE7AC, 0xE7A9, 0xE7B9, 0xE7B4, 0xE7AE, 0xE7B3,
+	0xBDBB, 0xE7AB, 0xE7BE, 0xE7A2, 0xE7A3, 0xE7BA, 0xBDBC, 0xE7BF, 0xBDBE, 0xE7C0, 0xE7B0, 0xE3D8, 0xE7B6, 0xE7AF, 0xE7B8, 0xE7B5,
+	0x0000, 0x0000, 0x0000, 0xE7A6, 0xBDB9, 0xE7BD, 0xBDBA, 0xE7A4, 0xBDBD, 0xEB64, 0xE7B7, 0xE7BC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEB61, 0xBDB8, 0xBFC0, 0xEB6B, 0xEB67, 0x0000, 0xEB65, 0xEB60, 0xEB6F, 0x0000, 0x0000, 0x0000, 0xBFC4, 0x0000, 0xEB5C,
+	0xEB68, 0xEB69, 0xEB5F, 0xEB5E, 0xEB6C, 0x0000, 0xEB62, 0xEB5D, 0xEB63, 0x0000, 0xEB6E, 0xEB5B, 0xEB6D, 0xEB6A, 0xBFC2, 0xBFC1,
+	0x0000, 0x0000, 0xBFC3, 0xEB66, 0xF0CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEE59, 0xC1B1, 0xEE5D, 0xEE5A, 0xEE61, 0xEE67,
+	0xEE5C, 0x0000, 0xEE70, 0xC1AE, 0xEE6A, 0xEE5F, 0xEE6B, 0xEE66, 0xEE6D, 0xEE5E, 0xC1B3, 0xC1B2, 0xEE60, 0xEE6E, 0xEE58, 0xEE6C,
+	0xC1AC, 0x0000, 0xEE64, 0xEE63, 0xEE68, 0xEE5B, 0xC1B0, 0x0000, 0xC1B4, 0xEE62, 0xEE69, 0xC1B5, 0xEE65, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xC1AD, 0xC1AF, 0xF0C7, 0xF0C5, 0x0000, 0x0000, 0xF0CC, 0xF0C9, 0xF0CD, 0x0000, 0xF0BE, 0xF0C6, 0xF0D1, 0xEE6F, 0xF0C2,
+	0xC2CF, 0xE7A5, 0xF0BD, 0xF0CA, 0xF0C4, 0xF0C1, 0xF0BC, 0xF0BB, 0xF0D0, 0x0000, 0xF0C0, 0xF0BF, 0xC2CD, 0xF0C8, 0x0000, 0xC2CC,
+	0x0000, 0x0000, 0xC2CE, 0xF0C3, 0xF0CF, 0x0000, 0xF2DE, 0xF2DF, 0x0000, 0xC3C9, 0xF2DC, 0xC3C6, 0xF2E4, 0x0000, 0xC3CA, 0xF2E6,
+	0xF2DB, 0xF0CE, 0xF2E8, 0xF2DD, 0x0000, 0xC3C7, 0xF2E3, 0x0000, 0xF2E5, 0xF2E0, 0xF2E7, 0xF2E2, 0xF2E1, 0xC3C8, 0x0000, 0x0000,
+	0xF4C5, 0xF4C6, 0x0000, 0xF4C8, 0xC4AE, 0xC4AF, 0xF4C9, 0xF4C7, 0x0000, 0xF4C4, 0x0000, 0xF642, 0xF645, 0xF641, 0x0000, 0xC4FA,
+	0xF643, 0xC4F9, 0xC4F8, 0xC4F7, 0xF644, 0xF751, 0xF74F, 0x0000, 0xF74E, 0xF640, 0xF750, 0xF646, 0xF74D, 0x0000, 0xF7F9, 0xF7D7,
+	0xF7F7, 0xC5DB, 0xF7F8, 0xF7FA, 0x0000, 0xF8BF, 0xC5FA, 0xF8BE, 0xF8BD, 0xC5FB, 0x0000, 0xC65A, 0xF96E, 0xF9A7, 0xF9A6, 0xF9A8,
+	0xA6E5, 0xD0AA, 0x0000, 0xD3CF, 0xD3D0, 0x0000, 0x0000, 0x0000, 0xDBC0, 0x0000, 0xF647, 0xF8C0, 0xA6E6, 0xAD6C, 0xD0AB, 0x0000,
+	0x0000, 0x0000, 0xD7B1, 0xB34E, 0x0000, 0xDBC2, 0xDBC1, 0xB5F3, 0x0000, 0xB8C5, 0xE7C1, 0xBDC3, 0x0000, 0xBDC4, 0x0000, 0x0000,
+	0x0000, 0xBFC5, 0xC5FC, 0xA6E7, 0x0000, 0x0000, 0x0000, 0xD0AC, 0xAAED, 0xD0AE, 0xD0AD, 0xAD6D, 0x0000, 0xD3D1, 0x0000, 0xD3D8,
+	0xB049, 0xD3D6, 0xD3D4, 0x0000, 0xD3DB, 0xD3D2, 0xD3D3, 0xB04A, 0x0000, 0xB04E, 0x0000, 0x0000, 0xD3DC, 0xB04D, 0xD3DA, 0xD3D7,
+	0xD3D5, 0xB04B, 0xB04C, 0xD3D9, 0x0000, 0x0000, 0x0000, 0x0000, 0xB350, 0xD7B2, 0x0000, 0xB355, 0xD7C2, 0xB354, 0xD7C4, 0x0000,
+	0x0000, 0xD7B8, 0xB352, 0xD7C3, 0x0000, 0xD7B3, 0xB353, 0xD7BF, 0xD7BB, 0xD7BD, 0xD7B7, 0xD7BE, 0x0000, 0x0000, 0xB34F, 0xD7BA,
+	0x0000, 0xD7B9, 0xD7B5, 0x0000, 0xD7C0, 0x0000, 0x0000, 0xD7BC, 0xD7B4, 0x0000, 0xD7B6, 0xB351, 0xD7C1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xB5F6, 0xDBCD, 0x0000, 0x0000, 0x0000, 0xDBC9, 0xDBCB, 0xDBC6, 0xDBC5, 0xDBC3, 0x0000, 0xDBCA, 0xDBCC, 0xDBC8, 0x0000,
+	0xDBC7, 0xB5F4, 0xB5F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDBCF, 0xB8CD, 0xDFF2, 0xDFF8, 0xDFF3, 0xDFF4, 0xF9D8,
+	0xDFF9, 0x0000, 0xB8CF, 0x0000, 0xB8C7, 0xB8CE, 0xDFF1, 0xDBC4, 0xB8CA, 0xB8C8, 0xDFF7, 0xDFF6, 0xB8C9, 0xB8CB, 0xDFF5, 0xB8C6,
+	0x0000, 0xB8CC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE3F6, 0xBB74, 0x0000, 0x0000, 0xE442, 0xE441, 0x0000, 0xE3FB, 0xBB76,
+	0xE440, 0xE3F7, 0xE3F8, 0xBB6E, 0xBB70, 0x0000, 0xE3FD, 0xE3F5, 0xBB72, 0xBB71, 0xE3F9, 0xE3FE, 0xE3FC, 0xBB73, 0xE3FA, 0x0000,
+	0x0000, 0xDBCE, 0xBB6F, 0x0000, 0x0000, 0xE7C2, 0xE7C9, 0xBDC6, 0x0000, 0xE7CD, 0xBDCA, 0xE7C5, 0xE7C3, 0x0000, 0xE7CC, 0x0000,
+	0xBDC5, 0xE7CB, 0xBDC7, 0xBDC8, 0xE7C4, 0xBDC9, 0xE7CA, 0xE7C6, 0xE7C7, 0xE7C8, 0xBB75, 0x0000, 0x0000, 0x0000, 0xEB70, 0xEB7C,
+	0x0000, 0xBFCA, 0xEB77, 0xEB79, 0x0000, 0xBFC8, 0xEB71, 0xEB75, 0x0000, 0xEB78, 0xBFC6, 0xBFC9, 0xEB7B, 0xEB73, 0xEB74, 0xEB7A,
+	0xEB72, 0xEB76, 0xBFC7, 0xEE72, 0x0000, 0xEE71, 0xC1B7, 0xEE77, 0xC1B9, 0x0000, 0x0000, 0xC1B6, 0xEE73, 0xC1BA, 0xEE74, 0x0000,
+	0x0000, 0xEE75, 0xEE78, 0x0000, 0xC1B8, 0x0000, 0xF0D6, 0x0000, 0x0000, 0xF0D9, 0x0000, 0xF0D3, 0xF0D5, 0x0000, 0x0000, 0xF0D4,
+	0xF0D7, 0xF0D8, 0xEE76, 0xF0D2, 0x0000, 0x0000, 0xC3CD, 0xF2EC, 0xF2EF, 0xF2F1, 0xF2EA, 0xF2EB, 0xF2EE, 0xF2F0, 0xC3CE, 0xC3CC,
+	0xC3CB, 0xF2ED, 0xF2E9, 0xF4CA, 0xC4B0, 0x0000, 0xF4CB, 0x0000, 0x0000, 0xF649, 0xC4FB, 0xF64B, 0xC4FC, 0xF648, 0xF64A, 0xC5A8,
+	0x0000, 0xF752, 0xC5A7, 0xF7FD, 0xF7FC, 0x0000, 0xF7FB, 0x0000, 0x0000, 0xF948, 0xF949, 0xF94B, 0xF94A, 0x0000, 0xCA50, 0xA6E8,
+	0x0000, 0xAD6E, 0xD7C5, 0xB5F7, 0x0000, 0xDFFA, 0xC2D0, 0x0000, 0xF2F2, 0x0000, 0x0000, 0xA8A3, 0x0000, 0x0000, 0x0000, 0xB357,
+	0x0000, 0x0000, 0x0000, 0xB356, 0x0000, 0xDBD0, 0xB5F8, 0xDBD2, 0xDBD1, 0x0000, 0x0000, 0xDFFB, 0xB8D0, 0xE443, 0xE446, 0xE445,
+	0x0000, 0xE444, 0xE7CE, 0xE7D0, 0xE7CF, 0x0000, 0xBFCC, 0x0000, 0x0000, 0x0000, 0xBFCB, 0x0000, 0xC1BB, 0xEE79, 0xEE7B, 0xEE7A,
+	0x0000, 0x0000, 0xC2D1, 0x0000, 0x0000, 0x0000, 0xF2F4, 0xF2F3, 0x0000, 0xF4CC, 0xC4B1, 0x0000, 0x0000, 0xC4FD, 0xF754, 0xF753,
+	0xC65B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xA8A4, 0xD0AF, 0xAD6F, 0xD7C8, 0xD7C6, 0x0000, 0x0000, 0xD7C7, 0xDBD4, 0xDBD5, 0xE043, 0xDBD3, 0x0000, 0xDFFC,
+	0xE041, 0xE040, 0xE042, 0xB8D1, 0xDFFE, 0xDFFD, 0xE044, 0x0000, 0xE449, 0xE447, 0x0000, 0xE448, 0xE7D3, 0xE7D1, 0x0000, 0x0000,
+	0xE7D2, 0xEB7D, 0xEE7C, 0xEE7D, 0xC2D2, 0x0000, 0xF2F5, 0xF4CD, 0xC4B2, 0x0000, 0xF64C, 0xF755, 0xC5A9, 0x0000, 0xF7FE, 0xF94C,
+	0xA8A5, 0x0000, 0xAD71, 0xAD72, 0xD0B0, 0x0000, 0x0000, 0xD0B1, 0xAD70, 0x0000, 0xB054, 0x0000, 0xB052, 0x0000, 0xB051, 0xB058,
+	0xB050, 0xB059, 0xD3DD, 0xB056, 0x0000, 0xB053, 0xB057, 0xB055, 0xB04F, 0x0000, 0x0000, 0xB35F, 0x0000, 0xB359, 0xD7CC, 0xB35E,
+	0x0000, 0x0000, 0xB360, 0xB35A, 0x0000, 0xB35B, 0x0000, 0xD7CA, 0x0000, 0x0000, 0xB358, 0x0000, 0xD7CB, 0xB35D, 0x0000, 0x0000,
+	0xD7C9, 0xB35C, 0x0000, 0x0000, 0xB644, 0x0000, 0xB646, 0x0000, 0x0000, 0xDBD8, 0xB645, 0xB5F9, 0xB5FD, 0x0000, 0xB8E4, 0xE049,
+	0xDBDA, 0xB5FE, 0x0000, 0x0000, 0xDBDD, 0xDBDE, 0xB643, 0x0000, 0xDBE0, 0x0000, 0xDBE2, 0x0000, 0xDBE3, 0xDBD7, 0xDBD6, 0xDBE4,
+	0xB642, 0xDBE1, 0xDBDF, 0x0000, 0xB640, 0xB5FB, 0xB647, 0xDBDB, 0xDBDC, 0xDBD9, 0x0000, 0xB641, 0x0000, 0x0000, 0xB5FC, 0x0000,
+	0xB5FA, 0xE048, 0xB8DF, 0xB8DA, 0x0000, 0x0000, 0xB8D5, 0x0000, 0xB8E5, 0xB8D6, 0x0000, 0xB8D2, 0xB8E1, 0xB8DE, 0xB8E0, 0x0000,
+	0xB8D7, 0xB8DC, 0xB8D3, 0xB8D4, 0xE050, 0xE04D, 0xE045, 0xE04A, 0x0000, 0xB8E2, 0xE051, 0xB8E3, 0xB8D9, 0x0000, 0x0000, 0xE047,
+	0x0000, 0xE04F, 0xE04B, 0xE04E, 0xE04C, 0xB8DD, 0xE046, 0xB8D8, 0x0000, 0x0000, 0x0000, 0xE44C, 0xBB78, 0xBB7B, 0x0000, 0xE44E,
+	0x0000, 0xBBA5, 0xE44D, 0xBB7D, 0x0000, 0xBDCF, 0xE44F, 0x0000, 0xBBA4, 0xE44B, 0xBBA6, 0x0000, 0x0000, 0x0000, 0xBB79, 0x0000,
+	0xB8DB, 0xBB7C, 0x0000, 0xBB7A, 0xBB7E, 0xBBA2, 0xBB77, 0xBBA7, 0xBBA3, 0x0000, 0xBBA1, 0xE44A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xBDD6, 0x0000, 0xBDD2, 0x0000, 0x0000, 0x0000, 0xBDD9, 0x0000, 0xE7D6, 0xBDDA, 0xE7E2, 0xE7DB, 0xBDCB, 0xE7E3, 0xE7DD, 0xBDD5,
+	0xE7DE, 0x0000, 0xBDD4, 0xE7E1, 0xBDCE, 0xE7DF, 0xE7D5, 0xBDCD, 0xEBAA, 0xBDD3, 0x0000, 0xBDD0, 0x0000, 0xBDD8, 0x0000, 0xE7D4,
+	0x0000, 0xE7D8, 0xBDCC, 0xE7D7, 0xE7D9, 0xE7DA, 0xBDD7, 0xE7DC, 0xE7E0, 0xE7E4, 0x0000, 0xBDDB, 0xBFD2, 0xEBA5, 0xEBAB, 0xEBA8,
+	0xEB7E, 0xEBAC, 0xEBA1, 0x0000, 0xEBA7, 0x0000, 0xBFCD, 0xBFD3, 0xEBAD, 0x0000, 0x0000, 0xBFCF, 0x0000, 0xBFD9, 0xBFD4, 0xEBAF,
+	0xEBA9, 0xBFD0, 0xEBA2, 0xBFDA, 0xEBA3, 0xEBA4, 0xBFDB, 0xBFD8, 0xBDD1, 0x0000, 0xBFCE, 0xEBB0, 0xBFDC, 0x0000, 0xBFD5, 0xEBAE,
+	0xBFD1, 0xBFD6, 0xBFD7, 0x0000, 0xC1C3, 0xEEA4, 0xEEAD, 0xEEAA, 0xEEAC, 0x0000, 0xC1C0, 0xEEA5, 0x0000, 0xEEAB, 0xC1BC, 0xEEA7,
+	0xC1C4, 0xEEA3, 0xEEA8, 0xEEAF, 0xEBA6, 0xEEA9, 0xEEA2, 0xC1BD, 0xEEA1, 0xC1BE, 0xEEB0, 0xC1BF, 0xEEAE, 0xC1C2, 0xEE7E, 0x0000,
+	0xC1C1, 0x0000, 0xEEA6, 0xF0DC, 0xF0EA, 0xF0E5, 0xF0E7, 0xF0DB, 0xC2D3, 0x0000, 0xF0DA, 0xC2D6, 0xC2D5, 0x0000, 0xF0E9, 0xF0E1,
+	0xF0DE, 0xF0E4, 0x0000, 0xF0DD, 0x0000, 0xF0DF, 0xF0E8, 0xF0E6, 0x0000, 0xC2D4, 0xF0ED, 0xF0EB, 0xF0E2, 0xF0EC, 0xF0E3, 0x0000,
+	0xF2F9, 0xC3CF, 0xF341, 0x0000, 0x0000, 0xF64F, 0xC3D6, 0xF0E0, 0xF2F7, 0xC3D2, 0xF2F8, 0xF2FD, 0x0000, 0x0000, 0xC3D4, 0xC3D5,
+	0xF2F6, 0xF340, 0xF342, 0xF2FA, 0xF2FC, 0xF2FE, 0xF2FB, 0xF343, 0xC3D1, 0xC3D7, 0xC3D3, 0x0000, 0xC3D0, 0xF4D0, 0x0000, 0xC4B7,
+	0xF4CE, 0x0000, 0x0000, 0xF4D2, 0x0000, 0xF4D3, 0xC4B5, 0xF4D4, 0xF4D1, 0x0000, 0xF4CF, 0xC4B8, 0xC4B4, 0xF4D5, 0x0000, 0xC4B6,
+	0xC4B3, 0x0000, 0x0000, 0x0000, 0xC4FE, 0x0000, 0x0000, 0xC540, 0xF64E, 0xF64D, 0xF650, 0xF651, 0x0000, 0xC541, 0xF756, 0xF75B,
+	0xC5AA, 0x0000, 0xF758, 0x0000, 0xF757, 0xF75A, 0xF759, 0x0000, 0xF843, 0x0000, 0xC5DC, 0xF842, 0xF840, 0x0000, 0xF841, 0x0000,
+	0x0000, 0x0000, 0xC5FE, 0xC5FD, 0xF8C1, 0xF8C2, 0xC640, 0x0000, 0xF94D, 0xF94E, 0xC667, 0x0000, 0xC66D, 0x0000, 0xF9A9, 0xF9C8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A6, 0x0000, 0xD7CD, 0x0000, 0xD7CE, 0xE052, 0xE450, 0xE7E5, 0xC1C6,
+	0x0000, 0xC1C5, 0xF0EE, 0xF344, 0x0000, 0xF844, 0xA8A7, 0xD3DE, 0xB05A, 0xB361, 0xE054, 0xE053, 0xBDDC, 0xE7E6, 0xBDDD, 0xEEB1,
+	0xC2D7, 0x0000, 0x0000, 0x0000, 0xC676, 0xA8A8, 0xCDCB, 0xD3DF, 0x0000, 0x0000, 0xB362, 0x0000, 0xD7CF, 0xD7D0, 0x0000, 0xDBE5,
+	0x0000, 0xB648, 0xB8E6, 0x0000, 0xE056, 0xE055, 0xE057, 0x0000, 0xE451, 0xE452, 0xBBA8, 0xBFDD, 0xBDDE, 0xBFDE, 0x0000, 0xEEB5,
+	0xEEB2, 0xEEB4, 0xEEB3, 0xC1C7, 0x0000, 0xF0EF, 0xF346, 0xF345, 0xCBA4, 0xB05C, 0xB05B, 0xD3E0, 0x0000, 0xD7D1, 0x0000, 0x0000,
+	0xDBE7, 0xDBE6, 0xB649, 0x0000, 0xE059, 0xE05A, 0xE058, 0x0000, 0x0000, 0xB8E8, 0xB8E7, 0x0000, 0xBBAA, 0xBBA9, 0x0000, 0xE7E7,
+	0xEBB3, 0xEBB1, 0xEBB2, 0xBFDF, 0xEEB7, 0xEEB6, 0x0000, 0xF0F2, 0xF0F1, 0xF0F0, 0xF347, 0x0000, 0xF9AA, 0xA8A9, 0xAD73, 0x0000,
+	0xAD74, 0xB05D, 0xB05E, 0xD3E2, 0xD3E1, 0xD7D2, 0x0000, 0xB368, 0xB366, 0xB363, 0xB367, 0xB365, 0xB364, 0x0000, 0x0000, 0xB64A,
+	0xDBEA, 0x0000, 0xB8ED, 0xB64C, 0xB651, 0xDBEC, 0xB653, 0xB652, 0xB655, 0xDBEB, 0xDBE8, 0xB64F, 0xB64B, 0xB64D, 0xDBE9, 0xB654,
+	0xB650, 0xB64E, 0xB8EF, 0xB8EE, 0xB8EC, 0xB8F0, 0x0000, 0xB8EA, 0xB8EB, 0x0000, 0xB8E9, 0x0000, 0xE05B, 0x0000, 0x0000, 0xE454,
+	0x0000, 0xBBAC, 0xBBAD, 0xBBAB, 0x0000, 0xE453, 0x0000, 0xE455, 0x0000, 0xE7EA, 0xE7EC, 0x0000, 0xBDE7, 0xE7ED, 0xBDE0, 0xE7E9,
+	0xBDDF, 0xBDE9, 0xBDE5, 0xBDE6, 0xBDE2, 0xE7E8, 0xBDE1, 0xE7EE, 0xE7EB, 0x0000, 0xBDE8, 0x0000, 0xBDE3, 0xBDE4, 0xEBB5, 0x0000,
+	0xEBB7, 0xEBB6, 0x0000, 0xEBB8, 0xBFE0, 0xEBB4, 0x0000, 0x0000, 0xC1CB, 0xEEB8, 0xC1C8, 0xC1CC, 0xC1CA, 0xC1C9, 0xF0F3, 0x0000,
+	0xF0F6, 0x0000, 0xF0F5, 0x0000, 0xF0F4, 0xC2D8, 0xF348, 0xF349, 0xC3D8, 0xF34A, 0xC3D9, 0x0000, 0x0000, 0xC4BA, 0x0000, 0xC4B9,
+	0xF652, 0x0000, 0x0000, 0xC542, 0xF653, 0xF75C, 0xC5AB, 0xC5AC, 0x0000, 0xF845, 0x0000, 0xC642, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xA8AA, 0x0000, 0xB36A, 0xB369, 0xE05C, 0xE05D, 0x0000, 0xBBAE, 0xEBB9, 0xBDEA, 0xEBBA, 0xEEB9,
+	0xA8AB, 0x0000, 0xD0B2, 0xAD76, 0xAD75, 0x0000, 0xD3E3, 0xB05F, 0xD3E4, 0xD7D5, 0x0000, 0xD7D4, 0x0000, 0xD7D3, 0x0000, 0x0000,
+	0xDBEE, 0xB658, 0x0000, 0x0000, 0xDBED, 0xB657, 0x0000, 0x0000, 0x0000, 0xDBEF, 0xB656, 0x0000, 0xE05F, 0xE062, 0xE060, 0xE061,
+	0xE065, 0xE05E, 0xE066, 0xE063, 0xE064, 0xBBB0, 0xE456, 0x0000, 0x0000, 0xBBAF, 0x0000, 0xE7F2, 0xE7F0, 0x0000, 0x0000, 0xBDEB,
+	0xE7EF, 0xE7F1, 0x0000, 0xBDEC, 0x0000, 0xEBBB, 0x0000, 0xEBBC, 0xC1CD, 0x0000, 0xF34C, 0xF34E, 0xF34B, 0xF34D, 0xF4D6, 0xF654,
+	0x0000, 0x0000, 0xF96F, 0xA8AC, 0xAD77, 0xD3E5, 0xD3E7, 0xD3E6, 0x0000, 0xD7D8, 0xB36C, 0x0000, 0xD7D6, 0x0000, 0xB36B, 0xD7D9,
+	0x0000, 0xD7DA, 0xD7D7, 0x0000, 0x0000, 0xDBFB, 0xB660, 0xDBF3, 0xDBF9, 0x0000, 0x0000, 0xB65B, 0xB65E, 0xDBF2, 0xB659, 0xDBF6,
+	0xE06C, 0xB65D, 0x0000, 0xDBF1, 0x0000, 0xDBF7, 0xDBF4, 0xDBFA, 0xDBF0, 0xDBF8, 0xB65C, 0xB65F, 0xDBF5, 0xB65A, 0x0000, 0xB8F2,
+	0xE068, 0xB8F1, 0xE06F, 0xE06E, 0xB8F8, 0x0000, 0xB8F9, 0xE070, 0xB8F3, 0xE06D, 0xB8F7, 0xE072, 0xE069, 0x0000, 0xE06B, 0xB8F4,
+	0xE067, 0xE06A, 0xE071, 0xB8F5, 0xE073, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB8F6, 0x0000, 0xBBB1, 0xE45B, 0xE461, 0xE459,
+	0xE462, 0x0000, 0xE458, 0xE45D, 0xE463, 0xE460, 0xE45F, 0xE45E, 0x0000, 0xE457, 0xE45C, 0x0000, 0x0000, 0xE45A, 0x0000, 0xBDF1,
+	0xBDEE, 0xE7FB, 0xE841, 0xE843, 0xE840, 0xE7F8, 0xE7FA, 0xE845, 0xE842, 0xE7FC, 0xE846, 0xE7F9, 0xE844, 0xBDEF, 0xBDF5, 0xBDF3,
+	0xE7F3, 0xBDF4, 0xBDF0, 0xE7F4, 0xE7F6, 0xE7F5, 0xE7FD, 0xE7FE, 0x0000, 0xBDF2, 0x0000, 0xBDED, 0x0000, 0x0000, 0xE7F7, 0x0000,
+	0xEBC6, 0xBFE2, 0x0000, 0xEBBD, 0xBFE3, 0xBFE6, 0xEBC2, 0x0000, 0xEBBF, 0xBFE5, 0x0000, 0x0000, 0xEBC3, 0xEBC4, 0xEBBE, 0xEBC7,
+	0xEBC0, 0xEBC5, 0xBFE4, 0x0000, 0xBFE1, 0xEBC1, 0x0000, 0xEEBF, 0xC1D0, 0xC1CE, 0xC1D1, 0xC1CF, 0xEEBE, 0xEEBB, 0xEEBA, 0x0000,
+	0xEEBD, 0x0000, 0x0000, 0xEEBC, 0xF145, 0xC2DE, 0xF0FB, 0xF0FA, 0x0000, 0xC2D9, 0xF141, 0xF140, 0xF0F7, 0xF143, 0xF0FC, 0xC2DD,
+	0xF0F9, 0xF142, 0xF0F8, 0xC2DA, 0xC2DC, 0xF0FD, 0xC2DB, 0xF0FE, 0x0000, 0xF144, 0xF352, 0x0000, 0xC3DE, 0xF34F, 0x0000, 0xF353,
+	0x0000, 0x0000, 0xC3DB, 0xF351, 0xC3E0, 0x0000, 0xC3DD, 0x0000, 0xF350, 0x0000, 0xC3DF, 0xF354, 0xC3DA, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xC4BC, 0xC4BE, 0x0000, 0xF4D9, 0xC4BD, 0xF4D7, 0xC3DC, 0xF4D8, 0xC4BB, 0xC543, 0xC545, 0xF656, 0xC544, 0xF655, 0x0000,
+	0xF761, 0xC5AD, 0xF760, 0xC5AE, 0xF75E, 0xF75D, 0xF762, 0xF763, 0xF846, 0x0000, 0xF75F, 0x0000, 0x0000, 0xF8C6, 0xF8C3, 0xF8C4,
+	0xF8C5, 0xC65C, 0x0000, 0xF951, 0xF950, 0xF94F, 0xF970, 0x0000, 0xF9BE, 0xF9AB, 0xC66E, 0xA8AD, 0xB060, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xB8FA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDF6, 0x0000, 0x0000, 0xEBC8, 0x0000, 0x0000,
+	0xC2DF, 0x0000, 0xF355, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF9AC, 0xA8AE, 0xAAEE, 0xAD79, 0xAD78, 0x0000, 0xB063,
+	0x0000, 0xD3E8, 0xB061, 0xD3E9, 0xB062, 0x0000, 0x0000, 0xD7DF, 0xD7DB, 0x0000, 0x0000, 0xB36D, 0xD7DE, 0xD7DD, 0xD7DC, 0xB36E,
+	0xD7E0, 0xD7E1, 0x0000, 0x0000, 0x0000, 0xDC43, 0xDC41, 0xDC45, 0xDC46, 0xDC4C, 0x0000, 0xDC48, 0xDC4A, 0x0000, 0xDC42, 0xDBFC,
+	0x0000, 0xDC49, 0x0000, 0x0000, 0xDC4B, 0xDC44, 0xDC47, 0xDBFD, 0xB662, 0xDC40, 0xDBFE, 0xB661, 0xB663, 0x0000, 0xB8FD, 0xE075,
+	0xE077, 0xE076, 0xE07B, 0xB8FB, 0x0000, 0xE078, 0xE074, 0xE079, 0xE07A, 0xB8FC, 0xB8FE, 0xE07C, 0x0000, 0xE467, 0xE466, 0x0000,
+	0xE464, 0xE465, 0xBBB3, 0xBBB5, 0xBBB2, 0xBBB4, 0xE84D, 0xE84E, 0xE849, 0x0000, 0xE84A, 0xBDF8, 0xBDFD, 0xBDF7, 0xBDFE, 0xBDF9,
+	0xE84B, 0x0000, 0x0000, 0xE84C, 0xE848, 0xBE40, 0xBDFB, 0x0000, 0x0000, 0xBDFA, 0xBDFC, 0x0000, 0xE847, 0x0000, 0xEBCA, 0xBFE8,
+	0x0000, 0x0000, 0xEBCC, 0xBFEA, 0xEBCF, 0xEBCB, 0xEBC9, 0xEBCE, 0xBFE9, 0xEBCD, 0x0000, 0xBFE7, 0x0000, 0x0000, 0xC1D3, 0xC1D6,
+	0xEEC1, 0x0000, 0xC1D4, 0xEEC0, 0xC1D2, 0xC1D5, 0xF146, 0xF147, 0xF148, 0xC2E0, 0x0000, 0xF149, 0x0000, 0xC2E1, 0xC3E2, 0xF358,
+	0xF359, 0xF357, 0xF356, 0xF35A, 0xC3E1, 0xF4DD, 0xF4DB, 0xF4DC, 0xF4DE, 0xF4DA, 0xF4DF, 0xF658, 0x0000, 0xF659, 0xF657, 0xC546,
+	0xF764, 0xC5AF, 0xF765, 0xF848, 0xF847, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8AF, 0xB664, 0x0000, 0x0000, 0xB940,
+	0x0000, 0x0000, 0x0000, 0xBBB6, 0x0000, 0x0000, 0xBFEC, 0x0000, 0xBFEB, 0x0000, 0x0000, 0x0000, 0x0000, 0xC3E3, 0xC47C, 0xC547,
+	0xA8B0, 0xB064, 0xB941, 0x0000, 0xF35B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCBA6,
+	0x0000, 0x0000, 0xA8B1, 0x0000, 0xA8B4, 0xA8B3, 0xA8B2, 0x0000, 0x0000, 0xCBA5, 0x0000, 0xCDCD, 0x0000, 0xCDCF, 0xAAEF, 0x0000,
+	0x0000, 0xAAF1, 0xCDCC, 0xCDCE, 0xAAF0, 0xCDD1, 0xCDD0, 0xCDD2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xD0B6, 0xD0B4, 0xAD7C, 0xD0B3, 0xADA3, 0xAD7E, 0xAD7B, 0x0000, 0xADA4, 0x0000, 0xAD7D, 0xADA2, 0x0000, 0xADA1, 0xD0B5, 0x0000,
+	0xAD7A, 0x0000, 0x0000, 0x0000, 0xB06A, 0xD3EB, 0xD3F1, 0xB067, 0xB06E, 0x0000, 0xB069, 0xD3EE, 0xD3F0, 0xB06C, 0xD3EA, 0xD3ED,
+	0xB068, 0xB065, 0xD3EC, 0xB06B, 0xD3EF, 0xB06D, 0xB066, 0x0000, 0x0000, 0x0000, 0x0000, 0xD7E3, 0xD7E6, 0xB370, 0x0000, 0xB37A,
+	0xB376, 0xD7E4, 0x0000, 0x0000, 0xB37E, 0xB377, 0xB37C, 0xB372, 0x0000, 0xB36F, 0xB371, 0xB37D, 0xD7E5, 0xB375, 0xB378, 0xB374,
+	0xB379, 0xD7E7, 0xB37B, 0xB373, 0xD7E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDC4D, 0xB665, 0xDC4F,
+	0x0000, 0xB667, 0xB669, 0x0000, 0xDC4E, 0xB666, 0xB66A, 0x0000, 0xB668, 0x0000, 0x0000, 0x0000, 0xB947, 0xE0A3, 0xB94F, 0xE07E,
+	0x0000, 0xB950, 0xB945, 0x0000, 0xE0A1, 0x0000, 0x0000, 0xB94A, 0x0000, 0xE0A2, 0xB943, 0xB942, 0x0000, 0xB94D, 0xB94C, 0xB94B,
+	0xB949, 0xB94E, 0xE07D, 0xB944, 0xB946, 0xB948, 0x0000, 0x0000, 0xBBB8, 0xBBBB, 0x0000, 0xBBBF, 0xBBB9, 0xBBBE, 0xBBBC, 0x0000,
+	0xBBB7, 0x0000, 0xBBBD, 0xBBBA, 0x0000, 0x0000, 0x0000, 0xE852, 0xBE43, 0xBE41, 0x0000, 0xE853, 0x0000, 0xBE44, 0xBE42, 0xE851,
+	0xE850, 0x0000, 0xBFF0, 0xE84F, 0xBFEE, 0xBFED, 0xEBD0, 0xBE45, 0xBFEF, 0xEBD1, 0xBFF2, 0xEBD2, 0xBFF1, 0xC1D8, 0xEEC3, 0xC1D7,
+	0xC1DC, 0xC1DA, 0xC1DB, 0xC2E3, 0xC1D9, 0xEEC2, 0xEBD3, 0xC2E2, 0xC2E4, 0x0000, 0xC3E4, 0xC3E5, 0x0000, 0xF4E0, 0x0000, 0xC5DE,
+	0xC5DD, 0xA8B6, 0x0000, 0x0000, 0xCA55, 0xB06F, 0x0000, 0xCA52, 0xCA53, 0xCA51, 0x0000, 0xCA54, 0x0000, 0x0000, 0xCBAA, 0xCBA7,
+	0xCBAC, 0xCBA8, 0xA8B7, 0xA8BA, 0x0000, 0xCBA9, 0xA8B9, 0xCBAB, 0x0000, 0x0000, 0xA8B8, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDD5,
+	0xCDD7, 0xAAF4, 0xCDD3, 0xCDD6, 0xCDD4, 0xAAF2, 0xAAF5, 0x0000, 0xAAF3, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0B8, 0xD0BC, 0xD0B9,
+	0x0000, 0xADA7, 0x0000, 0xADA8, 0x0000, 0xD0BB, 0x0000, 0xD0BD, 0xD0BF, 0x0000, 0xADA5, 0xD0BE, 0x0000, 0x0000, 0xADA6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xD7EE, 0xD0BA, 0xD3F2, 0xD3FB, 0xD3F9, 0xD3F4, 0xD3F5, 0xD3FA, 0xD3FC, 0xB071, 0x0000, 0xD3F7,
+	0xD3F3, 0xB070, 0xB072, 0xD3F6, 0xD3FD, 0xD3F8, 0x0000, 0x0000, 0xB3A1, 0xD7F1, 0xD7E9, 0xD7EF, 0xD7F0, 0xB3A2, 0x0000, 0xD7E8,
+	0xD7EA, 0xD0B7, 0xD7EC, 0xD7ED, 0xD7EB, 0xB66C, 0x0000, 0x0000, 0x0000, 0xDC56, 0xEBD4, 0xDC57, 0xDC54, 0xB3A3, 0xB66E, 0xDC53,
+	0xDC59, 0xDC58, 0xB66B, 0xDC5C, 0xDC52, 0xDC5B, 0xDC50, 0xDC5A, 0xDC55, 0xB66D, 0x0000, 0xE0AA, 0x0000, 0xE0A5, 0xE0AB, 0xE0A6,
+	0xE0A4, 0xE0A7, 0xB951, 0x0000, 0xE0A9, 0x0000, 0xE0A8, 0xB952, 0xBBC1, 0xBBC0, 0xE46E, 0xE471, 0xE469, 0xE46D, 0xBBC2, 0xE46C,
+	0xE46A, 0xE470, 0xE46B, 0xE468, 0xE46F, 0x0000, 0xE859, 0xBE48, 0xF14A, 0xE856, 0xE857, 0xE855, 0xDC51, 0xBE47, 0xE85A, 0xE854,
+	0xBE46, 0xBE49, 0xE858, 0xEBD5, 0xBFF3, 0xEBD6, 0xEBD7, 0x0000, 0xEEC4, 0xC1DD, 0xF14B, 0xF14C, 0x0000, 0x0000, 0xF14D, 0xF35D,
+	0xF35C, 0xF4E2, 0x0000, 0xF4E1, 0xF65B, 0xF65C, 0xF65A, 0xF766, 0xC5B0, 0xA8BB, 0xADAA, 0xADA9, 0xB075, 0xB074, 0xD440, 0xD441,
+	0xD3FE, 0x0000, 0xB073, 0xD7F5, 0x0000, 0xD7F6, 0xD7F2, 0xB3A4, 0xD7F3, 0x0000, 0xD7F4, 0x0000, 0x0000, 0x0000, 0x0000, 0xDC5F,
+	0xDC61, 0xDC5D, 0xDC60, 0xB66F, 0xDC5E, 0xB670, 0x0000, 0x0000, 0xDD73, 0xB955, 0xB954, 0x0000, 0xB953, 0x0000, 0xE0AC, 0xE0AD,
+	0x0000, 0x0000, 0xE473, 0xE475, 0xBBC6, 0xBBC3, 0x0000, 0xBBC5, 0xBBC4, 0xE474, 0xE472, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xE861, 0xE85E, 0xE85F, 0xBE4D, 0xE860, 0xE85B, 0xE85C, 0xBE4A, 0x0000, 0xBE4B, 0xE85D, 0xBE4C, 0x0000, 0xEBDB, 0x0000, 0xEBDC,
+	0xEBD9, 0xEBDA, 0xBFF4, 0xEBD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEEC8, 0xEEC5, 0xEEC7, 0xC1E0, 0xEECB, 0xC1DF, 0xEEC9,
+	0xEECC, 0xEECA, 0xEEC6, 0xC1DE, 0x0000, 0xF14F, 0x0000, 0xF150, 0xF14E, 0x0000, 0xF152, 0xC2E5, 0xC2E6, 0xF35F, 0xC3E7, 0xF151,
+	0xF35E, 0xC3E6, 0xF4E5, 0xF4E6, 0xC4BF, 0xF4E4, 0x0000, 0xF4E3, 0x0000, 0xF65D, 0xC548, 0x0000, 0xF849, 0xF8C8, 0xF8C7, 0x0000,
+	0xC643, 0xC65D, 0xF8C9, 0xF971, 0x0000, 0xC66F, 0xA8BC, 0xAAF6, 0x0000, 0xB956, 0x0000, 0xC4C0, 0xA8BD, 0xADAB, 0xB3A5, 0xB671,
+	0xC2E7, 0xAAF7, 0x0000, 0xD0C1, 0xD0C0, 0xD442, 0x0000, 0xB078, 0xB076, 0xB07A, 0xD444, 0x0000, 0xB079, 0xB077, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xD443, 0xB3A8, 0xD7FC, 0x0000, 0xB3A7, 0xB3A9, 0xD842, 0xB3AB, 0xD7FE, 0xD840, 0xD7F7, 0xB3AA, 0xD843, 0x0000,
+	0x0000, 0xD7F9, 0x0000, 0xD7FA, 0xD7F8, 0xB3A6, 0x0000, 0xD841, 0xD7FB, 0xD7FD, 0x0000, 0x0000, 0x0000, 0xDC6D, 0x0000, 0xDC6C,
+	0xDC6A, 0xDC62, 0xDC71, 0xDC65, 0xDC6F, 0xDC76, 0xDC6E, 0xB679, 0x0000, 0xB675, 0xDC63, 0x0000, 0xDC69, 0xB677, 0x0000, 0xDC68,
+	0xB678, 0xB67A, 0xDC6B, 0x0000, 0xB672, 0xB673, 0xDC77, 0xDC75, 0x0000, 0xDC74, 0xDC66, 0x0000, 0xDC72, 0x0000, 0xB676, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xB674, 0xDC73, 0xDC64, 0xDC67, 0xDC70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE4BA, 0xE0B7, 0x0000,
+	0xE0B0, 0xE0C3, 0xE0CC, 0xE0B3, 0xB961, 0x0000, 0xE0C0, 0xB957, 0xB959, 0xB965, 0xE0B1, 0x0000, 0x0000, 0xB95A, 0xB95C, 0xB966,
+	0xB95B, 0x0000, 0x0000, 0x0000, 0x0000, 0xB964, 0xE0B9, 0x0000, 0xE0AE, 0xB962, 0xE0B8, 0xB95E, 0xE0CA, 0xB963, 0xE0C8, 0xE0BC,
+	0xE0C6, 0xB960, 0xE0AF, 0xE0C9, 0xE0C4, 0x0000, 0xE0CB, 0xB958, 0x0000, 0x0000, 0xB967, 0xB95D, 0x0000, 0x0000, 0xE0B5, 0x0000,
+	0xE0BD, 0xE0C1, 0x0000, 0xE0C5, 0xB95F, 0xE0B4, 0xE0B2, 0xE0BE, 0x0000, 0x0000, 0x0000, 0x0000, 0xE0BB, 0xE0BA, 0x0000, 0xE0BF,
+	0xE0C2, 0x0000, 0xE0C7, 0x0000, 0x0000, 0x0000, 0xE478, 0x0000, 0xBBC7, 0xE4A4, 0xE47A, 0xBBCC, 0xBBD0, 0xE4AD, 0xE4B5, 0xE4A6,
+	0xBBC8, 0x0000, 0xE4AA, 0xE0B6, 0x0000, 0xBBC9, 0xE4B1, 0xE4B6, 0xE4AE, 0x0000, 0xE4B0, 0xE4B9, 0xE4B2, 0xE47E, 0xE4A9, 0x0000,
+	0x0000, 0xBBD1, 0x0000, 0xBBCD, 0xE47C, 0xE4AB, 0xBBCB, 0xE4A5, 0xBBCA, 0xE4B3, 0xE4A2, 0xE479, 0xBBCE, 0xE4B8, 0x0000, 0x0000,
+	0xE47B, 0xE4AF, 0xE4AC, 0xE4A7, 0xE477, 0xE476, 0xE4A1, 0xE4B4, 0xBBCF, 0xE4B7, 0xE47D, 0xE4A3, 0xBE52, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xBE5A, 0xBE55, 0xE8A4, 0xE8A1, 0xE867, 0xBE50, 0x0000, 0xF9D7, 0x0000, 0xBE4F, 0xBE56, 0x0000, 0x0000, 0x0000,
+	0xE865, 0xBE54, 0xE871, 0xE863, 0xE864, 0xBE4E, 0xE8A3, 0xBE58, 0xE874, 0xE879, 0xE873, 0xEBEE, 0xE86F, 0xE877, 0xE875, 0xE868,
+	0xE862, 0xE87D, 0xBE57, 0xE87E, 0x0000, 0xE878, 0x0000, 0xE86D, 0xE86B, 0xE866, 0x0000, 0x0000, 0x0000, 0xE86E, 0xE87B, 0xE86A,
+	0xE87A, 0xE8A2, 0x0000, 0x0000, 0xBE53, 0x0000, 0xE876, 0xE87C, 0xE872, 0xE86C, 0xBE51, 0x0000, 0x0000, 0x0000, 0xE4A8, 0xE870,
+	0xBE59, 0xE869, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBF4, 0xBFF7, 0xEBF3, 0xEBF0, 0xEC44, 0xBFFB, 0x0000, 0xEC41, 0xEBF8,
+	0xEC43, 0xEBE9, 0xEBF6, 0x0000, 0xBFFD, 0x0000, 0xEBE1, 0x0000, 0xEBDF, 0xEC42, 0x0000, 0xEC40, 0xEBFE, 0xEBED, 0xEBEC, 0xEBE2,
+	0xC040, 0x0000, 0xEBE8, 0xEBF2, 0xEBFD, 0xC043, 0xEC45, 0x0000, 0xC1E8, 0xC045, 0xBFFE, 0xEBE6, 0x0000, 0xEBEF, 0xEBDE, 0xEBE0,
+	0xBFF5, 0xC042, 0xBFFA, 0xEBE7, 0xEBF7, 0xEBF1, 0xC041, 0xEBDD, 0xC1E3, 0xEBF9, 0xEBFC, 0xBFFC, 0x0000, 0xEBEB, 0xC044, 0xBFF9,
+	0x0000, 0x0000, 0x0000, 0xBFF8, 0xEBF5, 0xEBFB, 0xBFF6, 0x0000, 0xEBE4, 0xEBFA, 0x0000, 0x0000, 0xEBE5, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEBEA, 0xEED2, 0x0000, 0xEED7, 0xC1E5, 0xC1E7, 0xEEDD, 0xC1E1, 0xEEEC, 0xEEE3,
+	0xEED8, 0xEED9, 0xEEE2, 0x0000, 0xC1EE, 0xEEE1, 0xEED1, 0xEEE0, 0xEED4, 0xEEED, 0xC1ED, 0xC1EB, 0xEED5, 0x0000, 0xEEE8, 0x0000,
+	0xEEDA, 0xEEE7, 0x0000, 0xEEE9, 0xEED0, 0xC1E6, 0x0000, 0xEEEA, 0x0000, 0x0000, 0xEEDE, 0x0000, 0xC1EA, 0xEEDB, 0x0000, 0x0000,
+	0xC1EC, 0xEEE4, 0x0000, 0x0000, 0x0000, 0xC1E4, 0xEED6, 0xEEE5, 0x0000, 0xEEDF, 0xEBE3, 0xEEE6, 0xEED3, 0x0000, 0xC1E9, 0x0000,
+	0xEEEB, 0x0000, 0xC1E2, 0xEECE, 0x0000, 0x0000, 0x0000, 0x0000, 0xF160, 0xF159, 0xC2E9, 0x0000, 0xF154, 0xF163, 0xF15B, 0xEEDC,
+	0x0000, 0xF165, 0xF155, 0x0000, 0xC2E8, 0xF15F, 0xC2EA, 0xC2F2, 0xC2F0, 0xF161, 0xC2F1, 0xF157, 0x0000, 0xF158, 0xF15D, 0xF162,
+	0x0000, 0xEECD, 0xC2EB, 0xF16A, 0xF167, 0xF16B, 0xF15E, 0xF15A, 0xF168, 0xF36A, 0xF15C, 0x0000, 0xC2EE, 0x0000, 0xC2ED, 0xEECF,
+	0xC2EF, 0xF164, 0xF166, 0xC2EC, 0xF169, 0xF153, 0x0000, 0xF156, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF373, 0x0000, 0xF363, 0xC3EB, 0xF371, 0x0000, 0x0000, 0xF361, 0xC3EC, 0x0000, 0xF36C, 0x0000, 0xF368, 0xC3F1, 0xF372, 0xF362,
+	0xF365, 0xC3E9, 0xF374, 0x0000, 0xF36D, 0xF370, 0xC3EF, 0xC3F4, 0xC3F2, 0xF369, 0xF364, 0x0000, 0xC3ED, 0xC3EE, 0xF360, 0xC3EA,
+	0x0000, 0xC3E8, 0xC3F0, 0xF36F, 0xC3F3, 0x0000, 0xF36B, 0xF375, 0xC3F5, 0x0000, 0x0000, 0x0000, 0xF367, 0x0000, 0xF36E, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4F3, 0xF542, 0xF4F5, 0xF4FC, 0xF366, 0xF4FA, 0xF4E9, 0xF540, 0xC4C3, 0xF4ED, 0xF4FE,
+	0xF4F4, 0x0000, 0x0000, 0xC4C2, 0x0000, 0x0000, 0xF544, 0xF4F6, 0x0000, 0xF4FB, 0xF4FD, 0xF4E7, 0xF541, 0xF4F2, 0xF4F7, 0xF4EB,
+	0xF4EF, 0xF543, 0xF4F9, 0xF4E8, 0xF4EC, 0xF4EE, 0xF4F8, 0x0000, 0xC4C1, 0xF4F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xF4EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF4F0, 0xF661, 0xF666, 0xC54F, 0xF668, 0x0000, 0xC549, 0x0000,
+	0xF664, 0xF66A, 0xC54E, 0xC54A, 0x0000, 0xC54B, 0xF660, 0xF667, 0xC54D, 0xF665, 0xC54C, 0xF65F, 0xF663, 0xF662, 0x0000, 0xF65E,
+	0xF669, 0x0000, 0x0000, 0x0000, 0xC5B1, 0xF76D, 0xF770, 0xF76C, 0xF76E, 0xF76F, 0xF769, 0xF76A, 0xF767, 0x0000, 0x0000, 0xF76B,
+	0xF768, 0xC5B2, 0xC5B3, 0x0000, 0x0000, 0xF84B, 0x0000, 0xF84D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF84C, 0xF84E, 0x0000,
+	0xC5E0, 0x0000, 0xF84A, 0xC5DF, 0xC5E1, 0x0000, 0x0000, 0x0000, 0xF8CB, 0xF8CC, 0xC644, 0xF8CA, 0x0000, 0xF953, 0xF952, 0xF954,
+	0xC65F, 0xF955, 0xC65E, 0xF956, 0xF972, 0xF975, 0xF974, 0xC668, 0xF973, 0x0000, 0x0000, 0x0000, 0xC672, 0xC670, 0xC671, 0xC677,
+	0xF9C0, 0xF9C1, 0xF9BF, 0xF9C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAF8, 0x0000, 0x0000, 0xD844, 0xDC78, 0xE8A5, 0xF376, 0x0000, 0x0000,
+	0xAAF9, 0x0000, 0xADAC, 0xB07B, 0x0000, 0x0000, 0xD845, 0x0000, 0xD846, 0xB3AC, 0x0000, 0xB67D, 0xDC7A, 0xDC79, 0xB6A3, 0xB67C,
+	0xDC7B, 0xB67E, 0xB6A2, 0xB6A1, 0xB67B, 0x0000, 0x0000, 0x0000, 0xB968, 0x0000, 0x0000, 0xE0D0, 0xE0CE, 0x0000, 0xE0CF, 0xE0CD,
+	0x0000, 0xBBD2, 0x0000, 0xBBD5, 0xBBD7, 0xBBD6, 0x0000, 0x0000, 0xBBD3, 0xBBD4, 0x0000, 0xE8A7, 0xE8A6, 0xBE5B, 0xE8A8, 0x0000,
+	0xE8A9, 0xBE5C, 0x0000, 0x0000, 0x0000, 0xEC4D, 0xEC4B, 0xEEF3, 0x0000, 0xEC49, 0xEC4A, 0xC046, 0xEC46, 0xEC4E, 0xEC48, 0xEC4C,
+	0xEEEF, 0x0000, 0x0000, 0xEEF1, 0x0000, 0xEEF2, 0xC1F3, 0xEEEE, 0xC1F2, 0xEEF0, 0xC1EF, 0xC1F0, 0xC1F1, 0xEC47, 0x0000, 0x0000,
+	0xC2F5, 0xF16E, 0xF16C, 0xF16D, 0xC2F3, 0xC2F6, 0xC2F4, 0x0000, 0x0000, 0x0000, 0xF377, 0xF378, 0xC3F6, 0x0000, 0xF545, 0xF547,
+	0xF546, 0xC4C4, 0xC550, 0xF66D, 0xF66C, 0xF66B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAFA, 0x0000, 0xC9AA, 0x0000,
+	0xCA58, 0xA6E9, 0xCA56, 0xCA59, 0xCA57, 0x0000, 0x0000, 0x0000, 0xCBAE, 0x0000, 0xA8C1, 0x0000, 0xA8C2, 0xCBB0, 0xA8BF, 0xCBAF,
+	0xCBAD, 0xA8C0, 0xA8BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCDD8, 0xCDDB, 0xAAFD, 0xCDDA, 0xCDD9, 0x0000, 0xAAFC,
+	0xAAFB, 0x0000, 0xAB40, 0xCDDC, 0xAAFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD0C6, 0xADAE, 0xADAF, 0xADB0, 0xD0C7, 0xD0C3,
+	0xADAD, 0xD0C4, 0x0000, 0xD0C5, 0xD0C2, 0x0000, 0x0000, 0x0000, 0xB0A4, 0x0000, 0x0000, 0xB0A1, 0xD445, 0xB0A2, 0xB0A5, 0xD446,
+	0x0000, 0xB07E, 0xB07C, 0xB07D, 0xB0A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3AD, 0xD849, 0xB3B5, 0xD848, 0x0000, 0xD84B,
+	0xB3B1, 0xD84A, 0xB6AB, 0xB3AF, 0xB3B2, 0xB3AE, 0xB3B3, 0xB3B4, 0xB3B0, 0x0000, 0x0000, 0x0000, 0xD847, 0xB6A7, 0xDC7D, 0x0000,
+	0xDCA3, 0x0000, 0x0000, 0xDCA2, 0xB6AC, 0xB6A8, 0xB6A9, 0xDC7C, 0xDC7E, 0xDCA1, 0xB6A4, 0xB6A6, 0x0000, 0xB6AA, 0xB6A5, 0x0000,
+	0x0000, 0xE0D3, 0xE0D1, 0xE0D2, 0xB96A, 0xB96B, 0x0000, 0xE0D4, 0xB969, 0xBBD8, 0x0000, 0xBBDA, 0xBBD9, 0x0000, 0xE4BB, 0x0000,
+	0x0000, 0xE4BC, 0xE8AB, 0x0000, 0xE8AA, 0x0000, 0x0000, 0xC047, 0xC048, 0xEC4F, 0xC049, 0x0000, 0xEEF6, 0x0000, 0xEEF4, 0x0000,
+	0xEEF5, 0xC1F4, 0x0000, 0xF16F, 0xC3F7, 0x0000, 0x0000, 0x0000, 0xC1F5, 0xAB41, 0x0000, 0xB0A6, 0xD447, 0x0000, 0x0000, 0xD84C,
+	0xB3B6, 0xB6AD, 0xDCA4, 0xDCA6, 0xB6AF, 0xB6AE, 0xB6B0, 0xB6B1, 0xDCA5, 0xB96E, 0xB96F, 0xB96D, 0xBBDB, 0xB96C, 0xE0D5, 0x0000,
+	0x0000, 0x0000, 0xBBDC, 0xE8AC, 0xEC50, 0xC04A, 0xC1F6, 0xF170, 0xF174, 0xC2F9, 0xF171, 0xC2FA, 0xC2F8, 0xF175, 0xC2FB, 0xF173,
+	0x0000, 0xF379, 0xC2F7, 0xC3F8, 0x0000, 0xF8CD, 0x0000, 0x0000, 0xAB42, 0xB3B8, 0xB3B7, 0x0000, 0x0000, 0x0000, 0x0000, 0xB6B2,
+	0xDCA8, 0xDCA7, 0xB6B3, 0x0000, 0x0000, 0xE0D9, 0xB973, 0xB970, 0xE0D8, 0xB972, 0xE0D6, 0xB971, 0x0000, 0xE0D7, 0x0000, 0xE4BD,
+	0xBBDD, 0x0000, 0xE8AF, 0x0000, 0xBE5D, 0xE8AD, 0xBE5E, 0xBE5F, 0xE8AE, 0xBE60, 0x0000, 0xEC51, 0x0000, 0xC04E, 0xC04B, 0xC050,
+	0xEC53, 0xC04C, 0xEC52, 0xC04F, 0x0000, 0x0000, 0xC04D, 0x0000, 0xEEF9, 0xEEFB, 0x0000, 0x0000, 0xC1F7, 0xEEFA, 0xC1F8, 0xEEF8,
+	0xEEF7, 0x0000, 0xF177, 0xF176, 0xC2FC, 0xF178, 0xF37E, 0xC3FA, 0xF37D, 0xF37A, 0xC3F9, 0xF37B, 0xF37C, 0x0000, 0xF548, 0xF549,
+	0xC4C5, 0x0000, 0xC553, 0x0000, 0x0000, 0xF66E, 0x0000, 0x0000, 0xC551, 0xC552, 0xF66F, 0x0000, 0x0000, 0xC5B4, 0xC5B5, 0xF771,
+	0x0000, 0x0000, 0xC645, 0xF8CF, 0xC647, 0x0000, 0xF8CE, 0xF8D0, 0xC646, 0xF957, 0x0000, 0xF9AD, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xAB43, 0x0000, 0x0000, 0x0000, 0xB974, 0x0000, 0xE4BE, 0x0000, 0xE8B0, 0xC051, 0xC052, 0x0000, 0xAB44, 0x0000,
+	0xBE61, 0xC3FB, 0xADB1, 0x0000, 0x0000, 0x0000, 0xC053, 0x0000, 0xC5E2, 0xADB2, 0xD84D, 0x0000, 0xDCA9, 0x0000, 0xDCAB, 0x0000,
+	0xDCAA, 0x0000, 0xE0DD, 0xE0DA, 0xB975, 0x0000, 0xB976, 0xE0DB, 0xE0DC, 0x0000, 0xE4C0, 0xE4C5, 0xBBDE, 0xE4BF, 0xE4C1, 0xE4C8,
+	0xE4C3, 0xE4C7, 0xE4C4, 0xE4C2, 0xE4C6, 0xBBDF, 0x0000, 0x0000, 0xE8B3, 0x0000, 0xE8B1, 0xBE63, 0x0000, 0xBE62, 0xE8B2, 0xBE64,
+	0x0000, 0x0000, 0x0000, 0x0000, 0xEC56, 0x0000, 0x0000, 0xEC55, 0xC054, 0xEC54, 0xEEFC, 0x0000, 0xEEFE, 0xEF41, 0xEF40, 0x0000,
+	0xC1F9, 0xEEFD, 0xF1A1, 0xC2FD, 0xF17D, 0xF1A2, 0xC2FE, 0x0000, 0xF17B, 0x0000, 0xF17E, 0xF17C, 0xF179, 0xC340, 0xF17A, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF3A1, 0x0000, 0x0000, 0xF3A3, 0xF3A2, 0x0000, 0xF54A, 0x0000, 0xF54B, 0x0000, 0x0000, 0x0000, 0xF670,
+	0x0000, 0xC5B7, 0x0000, 0xC5B6, 0xF84F, 0xF850, 0xC648, 0xF8D1, 0x0000, 0xC669, 0x0000, 0xADB3, 0xB6B4, 0xE4CA, 0xE4C9, 0xE8B5,
+	0xE8B4, 0x0000, 0x0000, 0xC1FA, 0xEF43, 0xEF42, 0xF1A5, 0xF1A3, 0xF1A6, 0xF1A4, 0x0000, 0x0000, 0xC3FC, 0xF3A4, 0xF3A5, 0xF3A6,
+	0x0000, 0xF671, 0x0000, 0xF772, 0x0000, 0xF8D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xADB4, 0x0000, 0x0000,
+	0xEC57, 0xEF44, 0x0000, 0xADB5, 0x0000, 0x0000, 0xBBE0, 0x0000, 0xEC58, 0xC341, 0xF1A7, 0xC3FD, 0x0000, 0xF54C, 0xF54D, 0xC554,
+	0xF851, 0xADB6, 0xB3BB, 0xB3BC, 0xD84E, 0xB6B5, 0xB6B6, 0xDCAC, 0xB6B7, 0x0000, 0xB97A, 0x0000, 0xB97C, 0xE0DF, 0xE0E0, 0xE0DE,
+	0xB977, 0xB978, 0xB97B, 0xB979, 0x0000, 0x0000, 0xE4CB, 0xBBE1, 0xBBE2, 0x0000, 0x0000, 0xE8BC, 0xBE67, 0xE8B7, 0xE8B6, 0x0000,
+	0xE8BB, 0xBE65, 0x0000, 0x0000, 0xC05B, 0x0000, 0xE8B8, 0xE8BD, 0xE8BA, 0xE8B9, 0x0000, 0xBE66, 0x0000, 0xC059, 0x0000, 0xEC5A,
+	0xC055, 0x0000, 0xEC5B, 0x0000, 0x0000, 0xEC59, 0x0000, 0xC058, 0xC056, 0xC05A, 0x0000, 0xC057, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xEF45, 0x0000, 0xEF4A, 0xEF46, 0xEF49, 0xC1FB, 0x0000, 0xEDD4, 0xEF48, 0xEF47, 0x0000, 0xC344, 0xC342, 0xC345, 0xC343,
+	0xF1A8, 0xF1A9, 0xF1AA, 0xC346, 0x0000, 0x0000, 0x0000, 0xF3AA, 0xC440, 0xF3A8, 0x0000, 0xC441, 0xF3A7, 0xF3A9, 0xC3FE, 0xF551,
+	0xF54E, 0x0000, 0xF54F, 0xF550, 0xF672, 0xC556, 0x0000, 0xC555, 0x0000, 0xF774, 0xF773, 0xC5B8, 0x0000, 0x0000, 0x0000, 0xC5E3,
+	0xC649, 0xC660, 0xF958, 0xF9AE, 0xF9AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xADB7, 0xDCAD, 0x0000, 0x0000, 0xE0E1, 0xE4CC, 0xE4CD, 0xBBE3,
+	0x0000, 0xBBE4, 0xE8BE, 0xBE68, 0x0000, 0x0000, 0xC1FC, 0x0000, 0xF1AB, 0x0000, 0xC347, 0xF3AD, 0xC442, 0xF3AC, 0xF3AE, 0xF3AB,
+	0xF675, 0xF552, 0xF553, 0x0000, 0xC4C6, 0x0000, 0xF674, 0x0000, 0x0000, 0xF673, 0x0000, 0xF775, 0xF9B0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xADB8, 0x0000, 0x0000, 0x0000, 0xADB9,
+	0x0000, 0x0000, 0xB0A7, 0xD448, 0x0000, 0xD84F, 0x0000, 0xB6B8, 0x0000, 0xB6BB, 0xB6B9, 0xDCAE, 0x0000, 0xB6BD, 0x0000, 0xB6BA,
+	0x0000, 0x0000, 0xB6BC, 0x0000, 0xB97E, 0x0000, 0xE0E2, 0x0000, 0x0000, 0xE0E3, 0xE8C0, 0x0000, 0xB97D, 0xB9A1, 0xB9A2, 0x0000,
+	0xE4CF, 0x0000, 0xE4CE, 0xBBE5, 0x0000, 0xBBE6, 0x0000, 0xE4D0, 0xE8BF, 0xBBE8, 0xBE69, 0x0000, 0xBBE7, 0x0000, 0x0000, 0x0000,
+	0xC05C, 0xE8C1, 0xBE6B, 0xBE6A, 0xE8C2, 0xE8C5, 0xE8C3, 0xE8C4, 0xBE6C, 0x0000, 0xC061, 0xC05F, 0x0000, 0x0000, 0xC05E, 0xEC5D,
+	0x0000, 0xC060, 0x0000, 0x0000, 0xEC5C, 0xEF4B, 0x0000, 0xEC5E, 0xC05D, 0xEC5F, 0xEF4E, 0xEF4C, 0xEF4D, 0xEF52, 0xC34B, 0xEF51,
+	0xEF54, 0xEF53, 0xEF50, 0xEF4F, 0x0000, 0xC1FD, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1AE, 0x0000, 0xF1AD, 0xC34A, 0xC348, 0xC349,
+	0x0000, 0xF1AC, 0x0000, 0xF3B1, 0x0000, 0xC443, 0x0000, 0xF3B0, 0xF3AF, 0xC444, 0x0000, 0xF558, 0xF557, 0x0000, 0xF555, 0x0000,
+	0xF554, 0xC4C8, 0xC4C7, 0xF559, 0xF776, 0xC5B9, 0xF677, 0xC557, 0xF676, 0xF556, 0x0000, 0xF777, 0xC5E4, 0x0000, 0xC661, 0xF959,
+	0x0000, 0xF9B1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xADBA, 0xD850, 0xEF55, 0xADBB, 0x0000, 0x0000, 0xE4D2, 0xE4D1, 0xEC60, 0x0000,
+	0x0000, 0xEF57, 0x0000, 0xEF56, 0x0000, 0xC34C, 0xF3B2, 0xF3B3, 0xC4C9, 0x0000, 0x0000, 0xF9B2, 0xB0A8, 0xB6BF, 0xB6BE, 0xE0E4,
+	0xE0E6, 0xB9A4, 0xE0E5, 0xB9A3, 0xB9A5, 0xE0E7, 0x0000, 0x0000, 0x0000, 0xE4D4, 0xE4D6, 0xE4D5, 0x0000, 0xE4D8, 0x0000, 0x0000,
+	0x0000, 0xBBE9, 0xE4D7, 0xE4D3, 0x0000, 0x0000, 0x0000, 0xE4D9, 0x0000, 0xE8CC, 0x0000, 0xE8CF, 0xE8D1, 0xE8C7, 0xE8CB, 0xE8C8,
+	0xBE6E, 0xBE71, 0xBE73, 0xE8C9, 0xE8CA, 0xBE72, 0xE8CD, 0xE8D0, 0xE8CE, 0xBE74, 0x0000, 0xBE70, 0xE8C6, 0xBE6D, 0x0000, 0xBE6F,
+	0x0000, 0x0000, 0xC063, 0xEC66, 0xEC64, 0xEC63, 0x0000, 0xEC69, 0x0000, 0xEC68, 0xEC67, 0x0000, 0xEC62, 0xC062, 0xEC61, 0x0000,
+	0xEC65, 0xC064, 0x0000, 0x0000, 0xEF5A, 0x0000, 0xEF5E, 0xEF5B, 0xEF5D, 0xEF5C, 0xEF59, 0xEF5F, 0xEF62, 0xEF60, 0xEF61, 0xC240,
+	0x0000, 0xC1FE, 0xEF58, 0xEF63, 0xF1B3, 0xF1B6, 0xF1B8, 0xF1B7, 0x0000, 0xF1B1, 0xF1B5, 0xF1B0, 0x0000, 0xF1B2, 0xC34D, 0xF1AF,
+	0x0000, 0xF1B4, 0x0000, 0x0000, 0xF3C0, 0xF3B5, 0xC445, 0x0000, 0x0000, 0xC446, 0xF3B4, 0xF3B9, 0xF3BF, 0xF3B7, 0xF3BE, 0x0000,
+	0xF3BB, 0x0000, 0xF3BA, 0xF3BD, 0xF3B8, 0xF3B6, 0x0000, 0xF3BC, 0x0000, 0xF560, 0xF55E, 0xC4CA, 0xF55D, 0xF563, 0xF561, 0x0000,
+	0xC4CB, 0xF55C, 0xF55A, 0x0000, 0xF55B, 0xC4CD, 0xF55F, 0xC4CC, 0xF562, 0xF678, 0xF67E, 0x0000, 0x0000, 0xF679, 0xC55B, 0xF6A1,
+	0xC55A, 0xF67D, 0xF67C, 0xC559, 0xF67B, 0xC558, 0xF67A, 0x0000, 0xF77D, 0xF7A1, 0xF77E, 0x0000, 0xF77B, 0xC5BB, 0xF778, 0xF77C,
+	0xF7A3, 0x0000, 0xF7A2, 0xF779, 0xF77A, 0xC5BA, 0xF852, 0xC5E7, 0x0000, 0xF853, 0xC5E5, 0xC5E6, 0x0000, 0x0000, 0xF8D3, 0xC64A,
+	0xF976, 0x0000, 0xC66A, 0x0000, 0xF9B3, 0xC66B, 0xF9B4, 0xF9B5, 0xF9C3, 0xF9C2, 0xC67A, 0xF9CD, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB0A9, 0x0000, 0x0000, 0xE0E9, 0x0000, 0xE0E8, 0x0000, 0xBBEA,
+	0xBBEB, 0xE4DA, 0x0000, 0xE8D2, 0xEC6C, 0x0000, 0x0000, 0xBE75, 0xC065, 0xEC6A, 0x0000, 0xEC6D, 0xC066, 0x0000, 0xEF64, 0xEC6B,
+	0xF1B9, 0xC34E, 0xF3C1, 0x0000, 0x0000, 0x0000, 0xF566, 0xF564, 0x0000, 0x0000, 0xF565, 0x0000, 0x0000, 0xF6A2, 0x0000, 0xC55C,
+	0xF7A4, 0xC5EA, 0xC5BC, 0xC5E8, 0xC5E9, 0xF8D4, 0xC662, 0x0000, 0xB0AA, 0x0000, 0x0000, 0x0000, 0xF1BA, 0x0000, 0x0000, 0xD449,
+	0x0000, 0xB9A6, 0x0000, 0xE4DB, 0x0000, 0x0000, 0xBBEC, 0xE4DC, 0x0000, 0x0000, 0x0000, 0xE8D4, 0xE8D3, 0xC068, 0xBE76, 0xBE77,
+	0x0000, 0xE8D7, 0xE8D6, 0xE8D5, 0x0000, 0x0000, 0xEC6E, 0xEC71, 0x0000, 0xEC70, 0xEC6F, 0xC067, 0xEF68, 0xEF66, 0xEF65, 0x0000,
+	0x0000, 0xEF67, 0x0000, 0xC34F, 0xF1BC, 0xF1BD, 0xC350, 0x0000, 0xF1BB, 0x0000, 0xF3C3, 0xF3C2, 0xF3C5, 0xC447, 0xF3C4, 0x0000,
+	0xF567, 0xF569, 0xF568, 0x0000, 0x0000, 0xF6A3, 0xF6A6, 0xF6A4, 0xF6A5, 0xF7A5, 0xC5BD, 0x0000, 0x0000, 0x0000, 0xF854, 0xF855,
+	0xF856, 0x0000, 0xC64B, 0xC663, 0xF9B6, 0xB0AB, 0x0000, 0xBE78, 0xC069, 0xF1BE, 0x0000, 0xF7A6, 0x0000, 0x0000, 0xF9C4, 0xD44A,
+	0x0000, 0xC67B, 0xB0AC, 0xEC72, 0x0000, 0xF1BF, 0x0000, 0xF3C6, 0x0000, 0x0000, 0xF6A7, 0xF7A7, 0xB0AD, 0x0000, 0xE4DD, 0xE4DE,
+	0x0000, 0xBBED, 0xBBEE, 0xE8D9, 0xBE7A, 0xBE79, 0xE8D8, 0x0000, 0xEF69, 0x0000, 0xF1C0, 0xF1C2, 0xF1C1, 0xC353, 0xC352, 0xC351,
+	0x0000, 0xC55E, 0xF6A8, 0x0000, 0xC55D, 0xF7A9, 0xF7A8, 0x0000, 0xC64C, 0xF8D5, 0xB3BD, 0xE0EA, 0x0000, 0x0000, 0x0000, 0xE4E1,
+	0xE4DF, 0xE4E0, 0x0000, 0x0000, 0xE8E2, 0x0000, 0xE8DD, 0xE8DA, 0xE8E1, 0x0000, 0x0000, 0x0000, 0xE8E3, 0x0000, 0x0000, 0xBE7C,
+	0xE8E0, 0xE8DC, 0x0000, 0x0000, 0xE8DB, 0xE8DF, 0xE8DE, 0xBE7B, 0x0000, 0x0000, 0xEC7D, 0xEC78, 0xEC76, 0xECA1, 0xEC77, 0x0000,
+	0xEC73, 0x0000, 0xEC79, 0x0000, 0x0000, 0xEC74, 0xEF72, 0xEC75, 0xECA2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xEC7C, 0xC06A, 0xEC7B, 0xEC7A, 0x0000, 0xEC7E, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF6A, 0xEF6D, 0x0000, 0x0000, 0xEF6C, 0x0000,
+	0xEF74, 0xEF6F, 0xEF73, 0x0000, 0xEF71, 0xEF70, 0xEF6E, 0x0000, 0xEF6B, 0x0000, 0xC243, 0xC242, 0x0000, 0xC244, 0xC241, 0xEF75,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1C8, 0xF1CB, 0x0000, 0xF1C9, 0xF1CD, 0x0000, 0x0000, 0x0000, 0xF1CE, 0x0000, 0xF1C6,
+	0xC358, 0xF1C7, 0x0000, 0xF1C5, 0xF1CC, 0x0000, 0xF1C4, 0xF1C3, 0xC357, 0xC355, 0xC354, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xF1CA, 0xF3CF, 0xF3D5, 0xC44A, 0xF3D0, 0x0000, 0xF3D3, 0xF3D7, 0xC44B, 0xF3D2, 0x0000, 0xF3CA, 0x0000,
+	0xF3C9, 0xF3D6, 0xF3CD, 0x0000, 0xF3CB, 0xF3D4, 0xF3CC, 0xC449, 0xC448, 0x0000, 0xF3C7, 0xF3C8, 0xF3D1, 0x0000, 0x0000, 0x0000,
+	0xF3CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF56C, 0xF56F, 0x0000, 0x0000, 0x0000, 0x0000, 0xC356, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF56D, 0xF573, 0xF571, 0xF56B, 0xF576, 0x0000, 0xF56A, 0x0000, 0xC4CF, 0xF572, 0x0000,
+	0x0000, 0x0000, 0xF56E, 0xC4CE, 0xF575, 0x0000, 0x0000, 0xF574, 0x0000, 0x0000, 0x0000, 0x0000, 0xF6AB, 0xF6AA, 0x0000, 0x0000,
+	0x0000, 0xF6B1, 0x0000, 0xF6AD, 0xF6B0, 0xC560, 0x0000, 0x0000, 0xF6AE, 0xF6AF, 0x0000, 0xF6A9, 0xF6AC, 0xC55F, 0x0000, 0x0000,
+	0x0000, 0xC5BF, 0xF7B4, 0xF7AF, 0xF7B3, 0x0000, 0xF7B6, 0xF7B2, 0x0000, 0xF7AE, 0x0000, 0xC5C1, 0xF7B1, 0xF7B5, 0xC5C0, 0xF7AC,
+	0xF570, 0xF7B0, 0x0000, 0x0000, 0xF7AD, 0x0000, 0xF7AA, 0x0000, 0xF7AB, 0xC5BE, 0xF85A, 0xF85C, 0xF85F, 0xF85B, 0xF860, 0x0000,
+	0xF859, 0x0000, 0xF857, 0x0000, 0xC5EB, 0xF85D, 0xC5ED, 0xC5EC, 0xF858, 0xF85E, 0x0000, 0x0000, 0x0000, 0x0000, 0xF8DA, 0xC64D,
+	0xF8DB, 0x0000, 0xF8D9, 0xF8D6, 0x0000, 0x0000, 0xF8D8, 0xF8D7, 0xF95A, 0x0000, 0x0000, 0x0000, 0x0000, 0xF95C, 0xF95B, 0x0000,
+	0x0000, 0xF979, 0x0000, 0xF978, 0xF977, 0xF97A, 0x0000, 0xC673, 0xC674, 0xF9CA, 0xF9CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3BE, 0xDCAF, 0xE0ED, 0x0000, 0xB9A7, 0xE0EB, 0x0000, 0x0000, 0xE0EC, 0x0000, 0x0000,
+	0x0000, 0xE4E2, 0xE4E3, 0xBBF1, 0xBBEF, 0xE4E4, 0xBBF0, 0xE8E8, 0x0000, 0xE8EB, 0xE8E5, 0xE8EC, 0xE8E4, 0xE8E6, 0x0000, 0xE8E7,
+	0xE8EA, 0x0000, 0x0000, 0xBEA1, 0xE8EF, 0xE8EE, 0xBE7D, 0xE8E9, 0xE8ED, 0xBE7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xECAC, 0x0000, 0xC06F, 0x0000, 0xECA7, 0xC06B, 0x0000, 0xECA4, 0xECAA, 0xECAD, 0x0000, 0xC070, 0x0000, 0xECA9, 0xECA6, 0xECAE,
+	0xECA5, 0x0000, 0xECAB, 0xC06C, 0x0000, 0xECA3, 0xC06D, 0x0000, 0xC06E, 0xECA8, 0x0000, 0x0000, 0x0000, 0xEFA9, 0xEF7A, 0xEF7B,
+	0xEF7E, 0xEF7C, 0x0000, 0xEF76, 0x0000, 0x0000, 0xEF79, 0xEFA5, 0xEF7D, 0x0000, 0x0000, 0xC245, 0x0000, 0xEFA7, 0xEFA4, 0xC246,
+	0xEFA6, 0xEF77, 0xEFA2, 0xEFA3, 0x0000, 0xEFA1, 0x0000, 0x0000, 0x0000, 0x0000, 0xF1D2, 0xF1D4, 0xF1D7, 0x0000, 0x0000, 0xF1D1,
+	0x0000, 0xC359, 0xF1D9, 0xF1D0, 0xF1DA, 0x0000, 0xF1D6, 0xF1D8, 0xF1DC, 0xF1D5, 0xF1DD, 0xF1D3, 0xF1CF, 0xC35A, 0x0000, 0xF1DB,
+	0xC35B, 0xC44D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF78, 0xF3F1, 0xF3E8, 0xC44F, 0xF3E4, 0xC450, 0x0000, 0x0000, 0xF3ED,
+	0xF3E7, 0xF3DD, 0xC44E, 0xF3EA, 0xF3E5, 0xF3E6, 0x0000, 0xF3D8, 0xF3DF, 0xF3EE, 0x0000, 0xF3EB, 0x0000, 0xF3E3, 0x0000, 0xF3EF,
+	0xF3DE, 0xF3D9, 0xF3EC, 0x0000, 0xF3DB, 0xF3E9, 0xF3E0, 0xF3F0, 0xF3DC, 0xC44C, 0xF3DA, 0xF3E1, 0xF3E2, 0x0000, 0x0000, 0x0000,
+	0xF57D, 0x0000, 0xF57B, 0x0000, 0xF5A2, 0x0000, 0xF5AE, 0xF5A5, 0xF57C, 0xF578, 0xF5A7, 0xF57E, 0xF5A3, 0xF57A, 0xF5AA, 0xF577,
+	0xF5A1, 0xF5A6, 0xF5A8, 0xF5AB, 0xF579, 0x0000, 0xF5AF, 0xF5B0, 0xF5A9, 0xF5AD, 0xF5A4, 0x0000, 0xF6C1, 0xF6C4, 0x0000, 0xC561,
+	0x0000, 0xF6C3, 0xF6C8, 0xF6C6, 0xC562, 0xF6BD, 0xF6B3, 0xF6B2, 0xC564, 0xF6BF, 0xF6C0, 0xF6BC, 0xF6B4, 0x0000, 0xF6B9, 0xF5AC,
+	0x0000, 0xF6B5, 0xC563, 0xF6BB, 0x0000, 0xF6BA, 0x0000, 0xF6B6, 0xF6C2, 0x0000, 0xF6B7, 0xF7BB, 0xF6C5, 0xF6C7, 0xF6BE, 0xF6B8,
+	0xF7BC, 0xF7BE, 0xF7B8, 0xC5C2, 0x0000, 0xF7C5, 0xF7C3, 0xC5C3, 0xF7C2, 0xF7C1, 0xF7BA, 0xF7B7, 0xF7BD, 0xF7C6, 0xF7B9, 0xF7BF,
+	0x0000, 0xF869, 0xF86E, 0xF864, 0xF867, 0xC5EE, 0xF86B, 0x0000, 0xF872, 0xF7C0, 0x0000, 0xF865, 0xF86F, 0xF873, 0xF86A, 0xF863,
+	0xF86D, 0x0000, 0xF86C, 0xF871, 0xF870, 0xF7C4, 0xF868, 0xF862, 0xF866, 0xC64E, 0xC64F, 0xF861, 0x0000, 0xF8E6, 0xF8DD, 0xF8E5,
+	0xF8E2, 0xF8E3, 0xF8DC, 0xF8DF, 0xF8E7, 0xF8E1, 0xF8E0, 0xF8DE, 0x0000, 0xF8E4, 0x0000, 0xF95D, 0x0000, 0xF95E, 0x0000, 0xF960,
+	0xF95F, 0xF962, 0xF961, 0xF97C, 0xF97B, 0xF9B7, 0x0000, 0xF9B8, 0x0000, 0xF9C5, 0xC678, 0xC67C, 0x0000, 0xF9CF, 0xC67D, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3BF, 0x0000, 0x0000, 0x0000, 0xC4D0, 0xF6C9, 0x0000, 0xC650, 0xC651, 0x0000, 0xB3C0,
+	0xE0EE, 0x0000, 0xB9A8, 0xE8F0, 0x0000, 0x0000, 0xECB0, 0xECB1, 0xECAF, 0xEFAB, 0xEFAA, 0xC247, 0xF1DF, 0xEFAC, 0xF1DE, 0x0000,
+	0x0000, 0xF3F3, 0xC451, 0xC453, 0xF3F2, 0x0000, 0x0000, 0xC452, 0x0000, 0xF5B1, 0xF5B3, 0xF5B2, 0xF6CA, 0xC565, 0x0000, 0xC5EF,
+	0xF8E8, 0xF963, 0x0000, 0x0000, 0xF9D2, 0xB3C1, 0x0000, 0xE4E5, 0x0000, 0xBEA2, 0x0000, 0x0000, 0x0000, 0xECB3, 0xECB2, 0x0000,
+	0xEFAD, 0x0000, 0x0000, 0x0000, 0xC454, 0xC4D1, 0xF7C7, 0xF9CB, 0x0000, 0x0000, 0x0000, 0xB3C2, 0xBBF2, 0x0000, 0xBEA3, 0x0000,
+	0xF3F4, 0x0000, 0xF874, 0xB6C0, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFAE, 0x0000, 0x0000, 0x0000, 0xC664, 0xB6C1, 0xBEA4, 0xC248,
+	0xF875, 0xB6C2, 0x0000, 0xE8F1, 0xC072, 0xECB4, 0xECB5, 0x0000, 0xC071, 0x0000, 0xEFAF, 0xC24C, 0xC24A, 0xC24B, 0xC249, 0xF1E0,
+	0xC35C, 0x0000, 0x0000, 0x0000, 0xF5B5, 0xF5B4, 0xF5B7, 0xF5B6, 0xC4D2, 0x0000, 0x0000, 0xF6CB, 0x0000, 0xF6CD, 0xF6CC, 0xC566,
+	0xF7C8, 0x0000, 0xF876, 0xF877, 0xC5F0, 0xF964, 0xF97D, 0xC675, 0x0000, 0xDCB0, 0xECB6, 0xEFB0, 0xF3F5, 0xE0EF, 0x0000, 0xEFB1,
+	0xF1E2, 0xF1E1, 0x0000, 0x0000, 0x0000, 0x0000, 0xF878, 0xC652, 0x0000, 0xF965, 0xF97E, 0x0000, 0x0000, 0x0000, 0xB9A9, 0xE8F2,
+	0xE8F3, 0x0000, 0xECB7, 0xB9AA, 0x0000, 0xC35D, 0xF1E3, 0x0000, 0xF6CF, 0xC567, 0xF6D0, 0xF6CE, 0xF879, 0x0000, 0xF8E9, 0x0000,
+	0xB9AB, 0x0000, 0xEFB4, 0xEFB3, 0xEFB2, 0xF1E4, 0x0000, 0x0000, 0xF1E8, 0xF1E7, 0xF1E6, 0xF1E5, 0xC35E, 0xF3F6, 0xF5B9, 0xC4D3,
+	0xF5B8, 0xF6D1, 0xF7CB, 0xF7CA, 0xC5C4, 0xF7C9, 0xF87C, 0xF87B, 0xF87A, 0x0000, 0x0000, 0xBBF3, 0x0000, 0xECB8, 0xC24D, 0x0000,
+	0xF3F7, 0xF3F8, 0xF7CC, 0xF87D, 0x0000, 0x0000, 0xF8EA, 0xF966, 0xF9B9, 0xF9D4, 0xBBF4, 0xC24E, 0xF1E9, 0xF3F9, 0xF6D2, 0xF87E,
+	0x0000, 0x0000, 0xBEA6, 0x0000, 0xEFB5, 0xF1EA, 0xF3FA, 0xF3FB, 0xF3FC, 0xF5BE, 0x0000, 0xF5BA, 0xC568, 0xF5BD, 0xF5BC, 0xC4D4,
+	0xF5BB, 0xC4D6, 0x0000, 0xC4D5, 0xF6D4, 0xF6D3, 0xC569, 0xC56A, 0x0000, 0x0000, 0xC5C6, 0xF7CD, 0xC5C5, 0x0000, 0xF8A3, 0xF8A4,
+	0xF8A2, 0xF8A1, 0xC654, 0x0000, 0xF8EB, 0xF8EC, 0xF8ED, 0xC653, 0xF967, 0xF96A, 0xF969, 0xF968, 0x0000, 0x0000, 0xF9D3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC073, 0x0000, 0x0000,
+	0xC365, 0xF5BF, 0xF6D5, 0x0000, 0xC5C7, 0xF7CE, 0x0000, 0x0000, 0xF9D5, 0x0000, 0x0000, 0x0000, 0xC074, 0x0000, 0x0000, 0x0000,
+	0xEFB6, 0x0000, 0xF7CF, 0x0000, 0xF9A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC94A, 0xDDFC, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA14A, 0xA157, 0x0000, 0xA159, 0xA15B, 0xA15F, 0xA160, 0xA163, 0xA164, 0xA167, 0xA168, 0xA16B, 0xA16C, 0xA16F, 0xA170, 0xA173,
+	0xA174, 0xA177, 0xA178, 0xA17B, 0xA17C, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1C6, 0xA1C7, 0xA1CA, 0xA1CB, 0xA1C8, 0xA1C9, 0xA15C,
+	0xA14D, 0xA14E, 0xA14F, 0x0000, 0xA151, 0xA152, 0xA153, 0xA154, 0x0000, 0xA17D, 0xA17E, 0xA1A1, 0xA1A2, 0xA1A3, 0xA1A4, 0xA1CC,
+	0xA1CD, 0xA1CE, 0xA1DE, 0xA1DF, 0xA1E0, 0xA1E1, 0xA1E2, 0x0000, 0xA242, 0xA24C, 0xA24D, 0xA24E, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0xA149, 0x0000, 0xA1AD, 0xA243, 0xA248, 0xA1AE, 0x0000, 0xA15D, 0xA15E, 0xA1AF, 0xA1CF, 0xA141, 0xA1D0, 0xA144, 0xA1FE,
+	0xA2AF, 0xA2B0, 0xA2B1, 0xA2B2, 0xA2B3, 0xA2B4, 0xA2B5, 0xA2B6, 0xA2B7, 0xA2B8, 0xA147, 0xA146, 0xA1D5, 0xA1D7, 0xA1D6, 0xA148,
+	0xA249, 0xA2CF, 0xA2D0, 0xA2D1, 0xA2D2, 0xA2D3, 0xA2D4, 0xA2D5, 0xA2D6, 0xA2D7, 0xA2D8, 0xA2D9, 0xA2DA, 0xA2DB, 0xA2DC, 0xA2DD,
+	0xA2DE, 0xA2DF, 0xA2E0, 0xA2E1, 0xA2E2, 0xA2E3, 0xA2E4, 0xA2E5, 0xA2E6, 0xA2E7, 0xA2E8, 0x0000, 0xA240, 0x0000, 0x0000, 0xA1C4,
+	0x0000, 0xA2E9, 0xA2EA, 0xA2EB, 0xA2EC, 0xA2ED, 0xA2EE, 0xA2EF, 0xA2F0, 0xA2F1, 0xA2F2, 0xA2F3, 0xA2F4, 0xA2F5, 0xA2F6, 0xA2F7,
+	0xA2F8, 0xA2F9, 0xA2FA, 0xA2FB, 0xA2FC, 0xA2FD, 0xA2FE, 0xA340, 0xA341, 0xA342, 0xA343, 0xA161, 0xA155, 0xA162, 0xA1E3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0xA246, 0xA247, 0x0000, 0xA1C3, 0x0000, 0xA244, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+#endif
 
 static const WCHAR oem2uni950[] = {	/* Big5 --> Unicode pairs */
 	0xA140, 0x3000, 0xA141, 0xFF0C, 0xA142, 0x3001, 0xA143, 0x3002,	0xA144, 0xFF0E, 0xA145, 0x2027, 0xA146, 0xFF1B, 0xA147, 0xFF1A,
@@ -15016,6 +21941,26 @@ static const WCHAR uc437[] = {	/*  CP437(U.S.) to Unicode conversion table */
 	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
 	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o437[] = {	/*  Unicode to CP437 conversion pairs (sorted uc437[]) */
+	0x00A0, 0x00FF, 0x00A1, 0x00AD, 0x00A2, 0x009B, 0x00A3, 0x009C, 0x00A5, 0x009D, 0x00AA, 0x00A6, 0x00AB, 0x00AE, 0x00AC, 0x00AA,
+	0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B5, 0x00E6, 0x00B7, 0x00FA, 0x00BA, 0x00A7, 0x00BB, 0x00AF, 0x00BC, 0x00AC,
+	0x00BD, 0x00AB, 0x00BF, 0x00A8, 0x00C4, 0x008E, 0x00C5, 0x008F, 0x00C6, 0x0092, 0x00C7, 0x0080, 0x00C9, 0x0090, 0x00D1, 0x00A5,
+	0x00D6, 0x0099, 0x00DC, 0x009A, 0x00DF, 0x00E1, 0x00E0, 0x0085, 0x00E1, 0x00A0, 0x00E2, 0x0083, 0x00E4, 0x0084, 0x00E5, 0x0086,
+	0x00E6, 0x0091, 0x00E7, 0x0087, 0x00E8, 0x008A, 0x00E9, 0x0082, 0x00EA, 0x0088, 0x00EB, 0x0089, 0x00EC, 0x008D, 0x00ED, 0x00A1,
+	0x00EE, 0x008C, 0x00EF, 0x008B, 0x00F1, 0x00A4, 0x00F2, 0x0095, 0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F6, 0x0094, 0x00F7, 0x00F6,
+	0x00F9, 0x0097, 0x00FA, 0x00A3, 0x00FB, 0x0096, 0x00FC, 0x0081, 0x00FF, 0x0098, 0x0192, 0x009F, 0x0393, 0x00E2, 0x0398, 0x00E9,
+	0x03A3, 0x00E4, 0x03A6, 0x00E8, 0x03A9, 0x00EA, 0x03B1, 0x00E0, 0x03B4, 0x00EB, 0x03B5, 0x00EE, 0x03C0, 0x00E3, 0x03C3, 0x00E5,
+	0x03C4, 0x00E7, 0x03C6, 0x00ED, 0x207F, 0x00FC, 0x20A7, 0x009E, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x221E, 0x00EC, 0x2229, 0x00EF,
+	0x2248, 0x00F7, 0x2261, 0x00F0, 0x2264, 0x00F3, 0x2265, 0x00F2, 0x2310, 0x00A9, 0x2320, 0x00F4, 0x2321, 0x00F5, 0x2500, 0x00C4,
+	0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2,
+	0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8,
+	0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00D4, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255B, 0x00BE, 0x255C, 0x00BD, 0x255D, 0x00BC,
+	0x255E, 0x00C6, 0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2,
+	0x2566, 0x00CB, 0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF,
+	0x2584, 0x00DC, 0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 720 || FF_CODE_PAGE == 0
 static const WCHAR uc720[] = {	/*  CP720(Arabic) to Unicode conversion table */
@@ -15028,6 +21973,26 @@ static const WCHAR uc720[] = {	/*  CP720(Arabic) to Unicode conversion table */
 	0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x0641, 0x00B5, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064A,
 	0x2261, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F, 0x0650, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o720[] = {	/*  Unicode to CP720 conversion pairs (sorted uc720[]) */
+	0x0000, 0x0080, 0x00A0, 0x00FF, 0x00A3, 0x009C, 0x00A4, 0x0094, 0x00AB, 0x00AE, 0x00B0, 0x00F8, 0x00B2, 0x00FD, 0x00B5, 0x00E6,
+	0x00B7, 0x00FA, 0x00BB, 0x00AF, 0x00E0, 0x0085, 0x00E2, 0x0083, 0x00E7, 0x0087, 0x00E8, 0x008A, 0x00E9, 0x0082, 0x00EA, 0x0088,
+	0x00EB, 0x0089, 0x00EE, 0x008C, 0x00EF, 0x008B, 0x00F4, 0x0093, 0x00F9, 0x0097, 0x00FB, 0x0096, 0x0621, 0x0098, 0x0622, 0x0099,
+	0x0623, 0x009A, 0x0624, 0x009B, 0x0625, 0x009D, 0x0626, 0x009E, 0x0627, 0x009F, 0x0628, 0x00A0, 0x0629, 0x00A1, 0x062A, 0x00A2,
+	0x062B, 0x00A3, 0x062C, 0x00A4, 0x062D, 0x00A5, 0x062E, 0x00A6, 0x062F, 0x00A7, 0x0630, 0x00A8, 0x0631, 0x00A9, 0x0632, 0x00AA,
+	0x0633, 0x00AB, 0x0634, 0x00AC, 0x0635, 0x00AD, 0x0636, 0x00E0, 0x0637, 0x00E1, 0x0638, 0x00E2, 0x0639, 0x00E3, 0x063A, 0x00E4,
+	0x0640, 0x0095, 0x0641, 0x00E5, 0x0642, 0x00E7, 0x0643, 0x00E8, 0x0644, 0x00E9, 0x0645, 0x00EA, 0x0646, 0x00EB, 0x0647, 0x00EC,
+	0x0648, 0x00ED, 0x0649, 0x00EE, 0x064A, 0x00EF, 0x064B, 0x00F1, 0x064C, 0x00F2, 0x064D, 0x00F3, 0x064E, 0x00F4, 0x064F, 0x00F5,
+	0x0650, 0x00F6, 0x0651, 0x0091, 0x0652, 0x0092, 0x207F, 0x00FC, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x2248, 0x00F7, 0x2261, 0x00F0,
+	0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4,
+	0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9,
+	0x2555, 0x00B8, 0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00D4, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255B, 0x00BE, 0x255C, 0x00BD,
+	0x255D, 0x00BC, 0x255E, 0x00C6, 0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1,
+	0x2565, 0x00D2, 0x2566, 0x00CB, 0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE,
+	0x2580, 0x00DF, 0x2584, 0x00DC, 0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2,
+	0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 737 || FF_CODE_PAGE == 0
 static const WCHAR uc737[] = {	/*  CP737(Greek) to Unicode conversion table */
@@ -15040,6 +22005,26 @@ static const WCHAR uc737[] = {	/*  CP737(Greek) to Unicode conversion table */
 	0x03C9, 0x03AC, 0x03AD, 0x03AE, 0x03CA, 0x03AF, 0x03CC, 0x03CD, 0x03CB, 0x03CE, 0x0386, 0x0388, 0x0389, 0x038A, 0x038C, 0x038E,
 	0x038F, 0x00B1, 0x2265, 0x2264, 0x03AA, 0x03AB, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o737[] = {	/*  Unicode to CP737 conversion pairs (sorted uc737[]) */
+	0x00A0, 0x00FF, 0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B7, 0x00FA, 0x00F7, 0x00F6, 0x0386, 0x00EA, 0x0388, 0x00EB,
+	0x0389, 0x00EC, 0x038A, 0x00ED, 0x038C, 0x00EE, 0x038E, 0x00EF, 0x038F, 0x00F0, 0x0391, 0x0080, 0x0392, 0x0081, 0x0393, 0x0082,
+	0x0394, 0x0083, 0x0395, 0x0084, 0x0396, 0x0085, 0x0397, 0x0086, 0x0398, 0x0087, 0x0399, 0x0088, 0x039A, 0x0089, 0x039B, 0x008A,
+	0x039C, 0x008B, 0x039D, 0x008C, 0x039E, 0x008D, 0x039F, 0x008E, 0x03A0, 0x008F, 0x03A1, 0x0090, 0x03A3, 0x0091, 0x03A4, 0x0092,
+	0x03A5, 0x0093, 0x03A6, 0x0094, 0x03A7, 0x0095, 0x03A8, 0x0096, 0x03A9, 0x0097, 0x03AA, 0x00F4, 0x03AB, 0x00F5, 0x03AC, 0x00E1,
+	0x03AD, 0x00E2, 0x03AE, 0x00E3, 0x03AF, 0x00E5, 0x03B1, 0x0098, 0x03B2, 0x0099, 0x03B3, 0x009A, 0x03B4, 0x009B, 0x03B5, 0x009C,
+	0x03B6, 0x009D, 0x03B7, 0x009E, 0x03B8, 0x009F, 0x03B9, 0x00A0, 0x03BA, 0x00A1, 0x03BB, 0x00A2, 0x03BC, 0x00A3, 0x03BD, 0x00A4,
+	0x03BE, 0x00A5, 0x03BF, 0x00A6, 0x03C0, 0x00A7, 0x03C1, 0x00A8, 0x03C2, 0x00AA, 0x03C3, 0x00A9, 0x03C4, 0x00AB, 0x03C5, 0x00AC,
+	0x03C6, 0x00AD, 0x03C7, 0x00AE, 0x03C8, 0x00AF, 0x03C9, 0x00E0, 0x03CA, 0x00E4, 0x03CB, 0x00E8, 0x03CC, 0x00E6, 0x03CD, 0x00E7,
+	0x03CE, 0x00E9, 0x207F, 0x00FC, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x2248, 0x00F7, 0x2264, 0x00F3, 0x2265, 0x00F2, 0x2500, 0x00C4,
+	0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2,
+	0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8,
+	0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00D4, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255B, 0x00BE, 0x255C, 0x00BD, 0x255D, 0x00BC,
+	0x255E, 0x00C6, 0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2,
+	0x2566, 0x00CB, 0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF,
+	0x2584, 0x00DC, 0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 771 || FF_CODE_PAGE == 0
 static const WCHAR uc771[] = {	/*  CP771(KBL) to Unicode conversion table */
@@ -15052,6 +22037,26 @@ static const WCHAR uc771[] = {	/*  CP771(KBL) to Unicode conversion table */
 	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
 	0x0118, 0x0119, 0x0116, 0x0117, 0x012E, 0x012F, 0x0160, 0x0161, 0x0172, 0x0173, 0x016A, 0x016B, 0x017D, 0x017E, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o771[] = {	/*  Unicode to CP771 conversion pairs (sorted uc771[]) */
+	0x00A0, 0x00FF, 0x0104, 0x00DC, 0x0105, 0x00DD, 0x010C, 0x00DE, 0x010D, 0x00DF, 0x0116, 0x00F2, 0x0117, 0x00F3, 0x0118, 0x00F0,
+	0x0119, 0x00F1, 0x012E, 0x00F4, 0x012F, 0x00F5, 0x0160, 0x00F6, 0x0161, 0x00F7, 0x016A, 0x00FA, 0x016B, 0x00FB, 0x0172, 0x00F8,
+	0x0173, 0x00F9, 0x017D, 0x00FC, 0x017E, 0x00FD, 0x0410, 0x0080, 0x0411, 0x0081, 0x0412, 0x0082, 0x0413, 0x0083, 0x0414, 0x0084,
+	0x0415, 0x0085, 0x0416, 0x0086, 0x0417, 0x0087, 0x0418, 0x0088, 0x0419, 0x0089, 0x041A, 0x008A, 0x041B, 0x008B, 0x041C, 0x008C,
+	0x041D, 0x008D, 0x041E, 0x008E, 0x041F, 0x008F, 0x0420, 0x0090, 0x0421, 0x0091, 0x0422, 0x0092, 0x0423, 0x0093, 0x0424, 0x0094,
+	0x0425, 0x0095, 0x0426, 0x0096, 0x0427, 0x0097, 0x0428, 0x0098, 0x0429, 0x0099, 0x042A, 0x009A, 0x042B, 0x009B, 0x042C, 0x009C,
+	0x042D, 0x009D, 0x042E, 0x009E, 0x042F, 0x009F, 0x0430, 0x00A0, 0x0431, 0x00A1, 0x0432, 0x00A2, 0x0433, 0x00A3, 0x0434, 0x00A4,
+	0x0435, 0x00A5, 0x0436, 0x00A6, 0x0437, 0x00A7, 0x0438, 0x00A8, 0x0439, 0x00A9, 0x043A, 0x00AA, 0x043B, 0x00AB, 0x043C, 0x00AC,
+	0x043D, 0x00AD, 0x043E, 0x00AE, 0x043F, 0x00AF, 0x0440, 0x00E0, 0x0441, 0x00E1, 0x0442, 0x00E2, 0x0443, 0x00E3, 0x0444, 0x00E4,
+	0x0445, 0x00E5, 0x0446, 0x00E6, 0x0447, 0x00E7, 0x0448, 0x00E8, 0x0449, 0x00E9, 0x044A, 0x00EA, 0x044B, 0x00EB, 0x044C, 0x00EC,
+	0x044D, 0x00ED, 0x044E, 0x00EE, 0x044F, 0x00EF, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0,
+	0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA,
+	0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8, 0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00BE, 0x2559, 0x00D3,
+	0x255A, 0x00C8, 0x255C, 0x00BD, 0x255D, 0x00BC, 0x255E, 0x00C6, 0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6,
+	0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2, 0x2566, 0x00CB, 0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8,
+	0x256B, 0x00D7, 0x256C, 0x00CE, 0x2588, 0x00DB, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 775 || FF_CODE_PAGE == 0
 static const WCHAR uc775[] = {	/*  CP775(Baltic) to Unicode conversion table */
@@ -15064,6 +22069,26 @@ static const WCHAR uc775[] = {	/*  CP775(Baltic) to Unicode conversion table */
 	0x00D3, 0x00DF, 0x014C, 0x0143, 0x00F5, 0x00D5, 0x00B5, 0x0144, 0x0136, 0x0137, 0x013B, 0x013C, 0x0146, 0x0112, 0x0145, 0x2019,
 	0x00AD, 0x00B1, 0x201C, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x201E, 0x00B0, 0x2219, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o775[] = {	/*  Unicode to CP775 conversion pairs (sorted uc775[]) */
+	0x00A0, 0x00FF, 0x00A2, 0x0096, 0x00A3, 0x009C, 0x00A4, 0x009F, 0x00A6, 0x00A7, 0x00A7, 0x00F5, 0x00A9, 0x00A8, 0x00AB, 0x00AE,
+	0x00AC, 0x00AA, 0x00AD, 0x00F0, 0x00AE, 0x00A9, 0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B3, 0x00FC, 0x00B5, 0x00E6,
+	0x00B6, 0x00F4, 0x00B7, 0x00FA, 0x00B9, 0x00FB, 0x00BB, 0x00AF, 0x00BC, 0x00AC, 0x00BD, 0x00AB, 0x00BE, 0x00F3, 0x00C4, 0x008E,
+	0x00C5, 0x008F, 0x00C6, 0x0092, 0x00C9, 0x0090, 0x00D3, 0x00E0, 0x00D5, 0x00E5, 0x00D6, 0x0099, 0x00D7, 0x009E, 0x00D8, 0x009D,
+	0x00DC, 0x009A, 0x00DF, 0x00E1, 0x00E4, 0x0084, 0x00E5, 0x0086, 0x00E6, 0x0091, 0x00E9, 0x0082, 0x00F3, 0x00A2, 0x00F5, 0x00E4,
+	0x00F6, 0x0094, 0x00F7, 0x00F6, 0x00F8, 0x009B, 0x00FC, 0x0081, 0x0100, 0x00A0, 0x0101, 0x0083, 0x0104, 0x00B5, 0x0105, 0x00D0,
+	0x0106, 0x0080, 0x0107, 0x0087, 0x010C, 0x00B6, 0x010D, 0x00D1, 0x0112, 0x00ED, 0x0113, 0x0089, 0x0116, 0x00B8, 0x0117, 0x00D3,
+	0x0118, 0x00B7, 0x0119, 0x00D2, 0x0122, 0x0095, 0x0123, 0x0085, 0x012A, 0x00A1, 0x012B, 0x008C, 0x012E, 0x00BD, 0x012F, 0x00D4,
+	0x0136, 0x00E8, 0x0137, 0x00E9, 0x013B, 0x00EA, 0x013C, 0x00EB, 0x0141, 0x00AD, 0x0142, 0x0088, 0x0143, 0x00E3, 0x0144, 0x00E7,
+	0x0145, 0x00EE, 0x0146, 0x00EC, 0x014C, 0x00E2, 0x014D, 0x0093, 0x0156, 0x008A, 0x0157, 0x008B, 0x015A, 0x0097, 0x015B, 0x0098,
+	0x0160, 0x00BE, 0x0161, 0x00D5, 0x016A, 0x00C7, 0x016B, 0x00D7, 0x0172, 0x00C6, 0x0173, 0x00D6, 0x0179, 0x008D, 0x017A, 0x00A5,
+	0x017B, 0x00A3, 0x017C, 0x00A4, 0x017D, 0x00CF, 0x017E, 0x00D8, 0x2019, 0x00EF, 0x201C, 0x00F2, 0x201D, 0x00A6, 0x201E, 0x00F7,
+	0x2219, 0x00F9, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3,
+	0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2554, 0x00C9, 0x2557, 0x00BB,
+	0x255A, 0x00C8, 0x255D, 0x00BC, 0x2560, 0x00CC, 0x2563, 0x00B9, 0x2566, 0x00CB, 0x2569, 0x00CA, 0x256C, 0x00CE, 0x2580, 0x00DF,
+	0x2584, 0x00DC, 0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 850 || FF_CODE_PAGE == 0
 static const WCHAR uc850[] = {	/*  CP850(Latin 1) to Unicode conversion table */
@@ -15076,6 +22101,26 @@ static const WCHAR uc850[] = {	/*  CP850(Latin 1) to Unicode conversion table */
 	0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE, 0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4,
 	0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o850[] = {	/*  Unicode to CP850 conversion pairs (sorted uc850[]) */
+	0x00A0, 0x00FF, 0x00A1, 0x00AD, 0x00A2, 0x00BD, 0x00A3, 0x009C, 0x00A4, 0x00CF, 0x00A5, 0x00BE, 0x00A6, 0x00DD, 0x00A7, 0x00F5,
+	0x00A8, 0x00F9, 0x00A9, 0x00B8, 0x00AA, 0x00A6, 0x00AB, 0x00AE, 0x00AC, 0x00AA, 0x00AD, 0x00F0, 0x00AE, 0x00A9, 0x00AF, 0x00EE,
+	0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B3, 0x00FC, 0x00B4, 0x00EF, 0x00B5, 0x00E6, 0x00B6, 0x00F4, 0x00B7, 0x00FA,
+	0x00B8, 0x00F7, 0x00B9, 0x00FB, 0x00BA, 0x00A7, 0x00BB, 0x00AF, 0x00BC, 0x00AC, 0x00BD, 0x00AB, 0x00BE, 0x00F3, 0x00BF, 0x00A8,
+	0x00C0, 0x00B7, 0x00C1, 0x00B5, 0x00C2, 0x00B6, 0x00C3, 0x00C7, 0x00C4, 0x008E, 0x00C5, 0x008F, 0x00C6, 0x0092, 0x00C7, 0x0080,
+	0x00C8, 0x00D4, 0x00C9, 0x0090, 0x00CA, 0x00D2, 0x00CB, 0x00D3, 0x00CC, 0x00DE, 0x00CD, 0x00D6, 0x00CE, 0x00D7, 0x00CF, 0x00D8,
+	0x00D0, 0x00D1, 0x00D1, 0x00A5, 0x00D2, 0x00E3, 0x00D3, 0x00E0, 0x00D4, 0x00E2, 0x00D5, 0x00E5, 0x00D6, 0x0099, 0x00D7, 0x009E,
+	0x00D8, 0x009D, 0x00D9, 0x00EB, 0x00DA, 0x00E9, 0x00DB, 0x00EA, 0x00DC, 0x009A, 0x00DD, 0x00ED, 0x00DE, 0x00E8, 0x00DF, 0x00E1,
+	0x00E0, 0x0085, 0x00E1, 0x00A0, 0x00E2, 0x0083, 0x00E3, 0x00C6, 0x00E4, 0x0084, 0x00E5, 0x0086, 0x00E6, 0x0091, 0x00E7, 0x0087,
+	0x00E8, 0x008A, 0x00E9, 0x0082, 0x00EA, 0x0088, 0x00EB, 0x0089, 0x00EC, 0x008D, 0x00ED, 0x00A1, 0x00EE, 0x008C, 0x00EF, 0x008B,
+	0x00F0, 0x00D0, 0x00F1, 0x00A4, 0x00F2, 0x0095, 0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F5, 0x00E4, 0x00F6, 0x0094, 0x00F7, 0x00F6,
+	0x00F8, 0x009B, 0x00F9, 0x0097, 0x00FA, 0x00A3, 0x00FB, 0x0096, 0x00FC, 0x0081, 0x00FD, 0x00EC, 0x00FE, 0x00E7, 0x00FF, 0x0098,
+	0x0131, 0x00D5, 0x0192, 0x009F, 0x2017, 0x00F2, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0,
+	0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA,
+	0x2554, 0x00C9, 0x2557, 0x00BB, 0x255A, 0x00C8, 0x255D, 0x00BC, 0x2560, 0x00CC, 0x2563, 0x00B9, 0x2566, 0x00CB, 0x2569, 0x00CA,
+	0x256C, 0x00CE, 0x2580, 0x00DF, 0x2584, 0x00DC, 0x2588, 0x00DB, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 852 || FF_CODE_PAGE == 0
 static const WCHAR uc852[] = {	/*  CP852(Latin 2) to Unicode conversion table */
@@ -15088,6 +22133,26 @@ static const WCHAR uc852[] = {	/*  CP852(Latin 2) to Unicode conversion table */
 	0x00D3, 0x00DF, 0x00D4, 0x0143, 0x0144, 0x0148, 0x0160, 0x0161, 0x0154, 0x00DA, 0x0155, 0x0170, 0x00FD, 0x00DD, 0x0163, 0x00B4,
 	0x00AD, 0x02DD, 0x02DB, 0x02C7, 0x02D8, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x02D9, 0x0171, 0x0158, 0x0159, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o852[] = {	/*  Unicode to CP852 conversion pairs (sorted uc852[]) */
+	0x00A0, 0x00FF, 0x00A4, 0x00CF, 0x00A7, 0x00F5, 0x00A8, 0x00F9, 0x00AB, 0x00AE, 0x00AC, 0x00AA, 0x00AD, 0x00F0, 0x00B0, 0x00F8,
+	0x00B4, 0x00EF, 0x00B8, 0x00F7, 0x00BB, 0x00AF, 0x00C1, 0x00B5, 0x00C2, 0x00B6, 0x00C4, 0x008E, 0x00C7, 0x0080, 0x00C9, 0x0090,
+	0x00CB, 0x00D3, 0x00CD, 0x00D6, 0x00CE, 0x00D7, 0x00D3, 0x00E0, 0x00D4, 0x00E2, 0x00D6, 0x0099, 0x00D7, 0x009E, 0x00DA, 0x00E9,
+	0x00DC, 0x009A, 0x00DD, 0x00ED, 0x00DF, 0x00E1, 0x00E1, 0x00A0, 0x00E2, 0x0083, 0x00E4, 0x0084, 0x00E7, 0x0087, 0x00E9, 0x0082,
+	0x00EB, 0x0089, 0x00ED, 0x00A1, 0x00EE, 0x008C, 0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F6, 0x0094, 0x00F7, 0x00F6, 0x00FA, 0x00A3,
+	0x00FC, 0x0081, 0x00FD, 0x00EC, 0x0102, 0x00C6, 0x0103, 0x00C7, 0x0104, 0x00A4, 0x0105, 0x00A5, 0x0106, 0x008F, 0x0107, 0x0086,
+	0x010C, 0x00AC, 0x010D, 0x009F, 0x010E, 0x00D2, 0x010F, 0x00D4, 0x0110, 0x00D1, 0x0111, 0x00D0, 0x0118, 0x00A8, 0x0119, 0x00A9,
+	0x011A, 0x00B7, 0x011B, 0x00D8, 0x0139, 0x0091, 0x013A, 0x0092, 0x013D, 0x0095, 0x013E, 0x0096, 0x0141, 0x009D, 0x0142, 0x0088,
+	0x0143, 0x00E3, 0x0144, 0x00E4, 0x0147, 0x00D5, 0x0148, 0x00E5, 0x0150, 0x008A, 0x0151, 0x008B, 0x0154, 0x00E8, 0x0155, 0x00EA,
+	0x0158, 0x00FC, 0x0159, 0x00FD, 0x015A, 0x0097, 0x015B, 0x0098, 0x015E, 0x00B8, 0x015F, 0x00AD, 0x0160, 0x00E6, 0x0161, 0x00E7,
+	0x0162, 0x00DD, 0x0163, 0x00EE, 0x0164, 0x009B, 0x0165, 0x009C, 0x016E, 0x00DE, 0x016F, 0x0085, 0x0170, 0x00EB, 0x0171, 0x00FB,
+	0x0179, 0x008D, 0x017A, 0x00AB, 0x017B, 0x00BD, 0x017C, 0x00BE, 0x017D, 0x00A6, 0x017E, 0x00A7, 0x02C7, 0x00F3, 0x02D8, 0x00F4,
+	0x02D9, 0x00FA, 0x02DB, 0x00F2, 0x02DD, 0x00F1, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0,
+	0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA,
+	0x2554, 0x00C9, 0x2557, 0x00BB, 0x255A, 0x00C8, 0x255D, 0x00BC, 0x2560, 0x00CC, 0x2563, 0x00B9, 0x2566, 0x00CB, 0x2569, 0x00CA,
+	0x256C, 0x00CE, 0x2580, 0x00DF, 0x2584, 0x00DC, 0x2588, 0x00DB, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 855 || FF_CODE_PAGE == 0
 static const WCHAR uc855[] = {	/*  CP855(Cyrillic) to Unicode conversion table */
@@ -15100,6 +22165,26 @@ static const WCHAR uc855[] = {	/*  CP855(Cyrillic) to Unicode conversion table *
 	0x042F, 0x0440, 0x0420, 0x0441, 0x0421, 0x0442, 0x0422, 0x0443, 0x0423, 0x0436, 0x0416, 0x0432, 0x0412, 0x044C, 0x042C, 0x2116,
 	0x00AD, 0x044B, 0x042B, 0x0437, 0x0417, 0x0448, 0x0428, 0x044D, 0x042D, 0x0449, 0x0429, 0x0447, 0x0427, 0x00A7, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o855[] = {	/*  Unicode to CP855 conversion pairs (sorted uc855[]) */
+	0x00A0, 0x00FF, 0x00A4, 0x00CF, 0x00A7, 0x00FD, 0x00AB, 0x00AE, 0x00AD, 0x00F0, 0x00BB, 0x00AF, 0x0401, 0x0085, 0x0402, 0x0081,
+	0x0403, 0x0083, 0x0404, 0x0087, 0x0405, 0x0089, 0x0406, 0x008B, 0x0407, 0x008D, 0x0408, 0x008F, 0x0409, 0x0091, 0x040A, 0x0093,
+	0x040B, 0x0095, 0x040C, 0x0097, 0x040E, 0x0099, 0x040F, 0x009B, 0x0410, 0x00A1, 0x0411, 0x00A3, 0x0412, 0x00EC, 0x0413, 0x00AD,
+	0x0414, 0x00A7, 0x0415, 0x00A9, 0x0416, 0x00EA, 0x0417, 0x00F4, 0x0418, 0x00B8, 0x0419, 0x00BE, 0x041A, 0x00C7, 0x041B, 0x00D1,
+	0x041C, 0x00D3, 0x041D, 0x00D5, 0x041E, 0x00D7, 0x041F, 0x00DD, 0x0420, 0x00E2, 0x0421, 0x00E4, 0x0422, 0x00E6, 0x0423, 0x00E8,
+	0x0424, 0x00AB, 0x0425, 0x00B6, 0x0426, 0x00A5, 0x0427, 0x00FC, 0x0428, 0x00F6, 0x0429, 0x00FA, 0x042A, 0x009F, 0x042B, 0x00F2,
+	0x042C, 0x00EE, 0x042D, 0x00F8, 0x042E, 0x009D, 0x042F, 0x00E0, 0x0430, 0x00A0, 0x0431, 0x00A2, 0x0432, 0x00EB, 0x0433, 0x00AC,
+	0x0434, 0x00A6, 0x0435, 0x00A8, 0x0436, 0x00E9, 0x0437, 0x00F3, 0x0438, 0x00B7, 0x0439, 0x00BD, 0x043A, 0x00C6, 0x043B, 0x00D0,
+	0x043C, 0x00D2, 0x043D, 0x00D4, 0x043E, 0x00D6, 0x043F, 0x00D8, 0x0440, 0x00E1, 0x0441, 0x00E3, 0x0442, 0x00E5, 0x0443, 0x00E7,
+	0x0444, 0x00AA, 0x0445, 0x00B5, 0x0446, 0x00A4, 0x0447, 0x00FB, 0x0448, 0x00F5, 0x0449, 0x00F9, 0x044A, 0x009E, 0x044B, 0x00F1,
+	0x044C, 0x00ED, 0x044D, 0x00F7, 0x044E, 0x009C, 0x044F, 0x00DE, 0x0451, 0x0084, 0x0452, 0x0080, 0x0453, 0x0082, 0x0454, 0x0086,
+	0x0455, 0x0088, 0x0456, 0x008A, 0x0457, 0x008C, 0x0458, 0x008E, 0x0459, 0x0090, 0x045A, 0x0092, 0x045B, 0x0094, 0x045C, 0x0096,
+	0x045E, 0x0098, 0x045F, 0x009A, 0x2116, 0x00EF, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0,
+	0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA,
+	0x2554, 0x00C9, 0x2557, 0x00BB, 0x255A, 0x00C8, 0x255D, 0x00BC, 0x2560, 0x00CC, 0x2563, 0x00B9, 0x2566, 0x00CB, 0x2569, 0x00CA,
+	0x256C, 0x00CE, 0x2580, 0x00DF, 0x2584, 0x00DC, 0x2588, 0x00DB, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 857 || FF_CODE_PAGE == 0
 static const WCHAR uc857[] = {	/*  CP857(Turkish) to Unicode conversion table */
@@ -15112,6 +22197,26 @@ static const WCHAR uc857[] = {	/*  CP857(Turkish) to Unicode conversion table */
 	0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x0000, 0x00D7, 0x00DA, 0x00DB, 0x00D9, 0x00EC, 0x00FF, 0x00AF, 0x00B4,
 	0x00AD, 0x00B1, 0x0000, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o857[] = {	/*  Unicode to CP857 conversion pairs (sorted uc857[]) */
+	0x0000, 0x00D5, 0x00A0, 0x00FF, 0x00A1, 0x00AD, 0x00A2, 0x00BD, 0x00A3, 0x009C, 0x00A4, 0x00CF, 0x00A5, 0x00BE, 0x00A6, 0x00DD,
+	0x00A7, 0x00F5, 0x00A8, 0x00F9, 0x00A9, 0x00B8, 0x00AA, 0x00D1, 0x00AB, 0x00AE, 0x00AC, 0x00AA, 0x00AD, 0x00F0, 0x00AE, 0x00A9,
+	0x00AF, 0x00EE, 0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B3, 0x00FC, 0x00B4, 0x00EF, 0x00B5, 0x00E6, 0x00B6, 0x00F4,
+	0x00B7, 0x00FA, 0x00B8, 0x00F7, 0x00B9, 0x00FB, 0x00BA, 0x00D0, 0x00BB, 0x00AF, 0x00BC, 0x00AC, 0x00BD, 0x00AB, 0x00BE, 0x00F3,
+	0x00BF, 0x00A8, 0x00C0, 0x00B7, 0x00C1, 0x00B5, 0x00C2, 0x00B6, 0x00C3, 0x00C7, 0x00C4, 0x008E, 0x00C5, 0x008F, 0x00C6, 0x0092,
+	0x00C7, 0x0080, 0x00C8, 0x00D4, 0x00C9, 0x0090, 0x00CA, 0x00D2, 0x00CB, 0x00D3, 0x00CC, 0x00DE, 0x00CD, 0x00D6, 0x00CE, 0x00D7,
+	0x00CF, 0x00D8, 0x00D1, 0x00A5, 0x00D2, 0x00E3, 0x00D3, 0x00E0, 0x00D4, 0x00E2, 0x00D5, 0x00E5, 0x00D6, 0x0099, 0x00D7, 0x00E8,
+	0x00D8, 0x009D, 0x00D9, 0x00EB, 0x00DA, 0x00E9, 0x00DB, 0x00EA, 0x00DC, 0x009A, 0x00DF, 0x00E1, 0x00E0, 0x0085, 0x00E1, 0x00A0,
+	0x00E2, 0x0083, 0x00E3, 0x00C6, 0x00E4, 0x0084, 0x00E5, 0x0086, 0x00E6, 0x0091, 0x00E7, 0x0087, 0x00E8, 0x008A, 0x00E9, 0x0082,
+	0x00EA, 0x0088, 0x00EB, 0x0089, 0x00EC, 0x00EC, 0x00ED, 0x00A1, 0x00EE, 0x008C, 0x00EF, 0x008B, 0x00F1, 0x00A4, 0x00F2, 0x0095,
+	0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F5, 0x00E4, 0x00F6, 0x0094, 0x00F7, 0x00F6, 0x00F8, 0x009B, 0x00F9, 0x0097, 0x00FA, 0x00A3,
+	0x00FB, 0x0096, 0x00FC, 0x0081, 0x00FF, 0x00ED, 0x011E, 0x00A6, 0x011F, 0x00A7, 0x0130, 0x0098, 0x0131, 0x008D, 0x015E, 0x009E,
+	0x015F, 0x009F, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3,
+	0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2554, 0x00C9, 0x2557, 0x00BB,
+	0x255A, 0x00C8, 0x255D, 0x00BC, 0x2560, 0x00CC, 0x2563, 0x00B9, 0x2566, 0x00CB, 0x2569, 0x00CA, 0x256C, 0x00CE, 0x2580, 0x00DF,
+	0x2584, 0x00DC, 0x2588, 0x00DB, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 860 || FF_CODE_PAGE == 0
 static const WCHAR uc860[] = {	/*  CP860(Portuguese) to Unicode conversion table */
@@ -15124,6 +22229,26 @@ static const WCHAR uc860[] = {	/*  CP860(Portuguese) to Unicode conversion table
 	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
 	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o860[] = {	/*  Unicode to CP860 conversion pairs (sorted uc860[]) */
+	0x00A0, 0x00FF, 0x00A1, 0x00AD, 0x00A2, 0x009B, 0x00A3, 0x009C, 0x00AA, 0x00A6, 0x00AB, 0x00AE, 0x00AC, 0x00AA, 0x00B0, 0x00F8,
+	0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B5, 0x00E6, 0x00B7, 0x00FA, 0x00BA, 0x00A7, 0x00BB, 0x00AF, 0x00BC, 0x00AC, 0x00BD, 0x00AB,
+	0x00BF, 0x00A8, 0x00C0, 0x0091, 0x00C1, 0x0086, 0x00C2, 0x008F, 0x00C3, 0x008E, 0x00C7, 0x0080, 0x00C8, 0x0092, 0x00C9, 0x0090,
+	0x00CA, 0x0089, 0x00CC, 0x0098, 0x00CD, 0x008B, 0x00D1, 0x00A5, 0x00D2, 0x00A9, 0x00D3, 0x009F, 0x00D4, 0x008C, 0x00D5, 0x0099,
+	0x00D9, 0x009D, 0x00DA, 0x0096, 0x00DC, 0x009A, 0x00DF, 0x00E1, 0x00E0, 0x0085, 0x00E1, 0x00A0, 0x00E2, 0x0083, 0x00E3, 0x0084,
+	0x00E7, 0x0087, 0x00E8, 0x008A, 0x00E9, 0x0082, 0x00EA, 0x0088, 0x00EC, 0x008D, 0x00ED, 0x00A1, 0x00F1, 0x00A4, 0x00F2, 0x0095,
+	0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F5, 0x0094, 0x00F7, 0x00F6, 0x00F9, 0x0097, 0x00FA, 0x00A3, 0x00FC, 0x0081, 0x0393, 0x00E2,
+	0x0398, 0x00E9, 0x03A3, 0x00E4, 0x03A6, 0x00E8, 0x03A9, 0x00EA, 0x03B1, 0x00E0, 0x03B4, 0x00EB, 0x03B5, 0x00EE, 0x03C0, 0x00E3,
+	0x03C3, 0x00E5, 0x03C4, 0x00E7, 0x03C6, 0x00ED, 0x207F, 0x00FC, 0x20A7, 0x009E, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x221E, 0x00EC,
+	0x2229, 0x00EF, 0x2248, 0x00F7, 0x2261, 0x00F0, 0x2264, 0x00F3, 0x2265, 0x00F2, 0x2320, 0x00F4, 0x2321, 0x00F5, 0x2500, 0x00C4,
+	0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2,
+	0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8,
+	0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00BE, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255C, 0x00BD, 0x255D, 0x00BC, 0x255E, 0x00C6,
+	0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2, 0x2566, 0x00CB,
+	0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF, 0x2584, 0x00DC,
+	0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 861 || FF_CODE_PAGE == 0
 static const WCHAR uc861[] = {	/*  CP861(Icelandic) to Unicode conversion table */
@@ -15136,6 +22261,26 @@ static const WCHAR uc861[] = {	/*  CP861(Icelandic) to Unicode conversion table
 	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
 	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o861[] = {	/*  Unicode to CP861 conversion pairs (sorted uc861[]) */
+	0x00A0, 0x00FF, 0x00A1, 0x00AD, 0x00A3, 0x009C, 0x00AB, 0x00AE, 0x00AC, 0x00AA, 0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD,
+	0x00B5, 0x00E6, 0x00B7, 0x00FA, 0x00BB, 0x00AF, 0x00BC, 0x00AC, 0x00BD, 0x00AB, 0x00BF, 0x00A8, 0x00C1, 0x00A4, 0x00C4, 0x008E,
+	0x00C5, 0x008F, 0x00C6, 0x0092, 0x00C7, 0x0080, 0x00C9, 0x0090, 0x00CD, 0x00A5, 0x00D0, 0x008B, 0x00D3, 0x00A6, 0x00D6, 0x0099,
+	0x00D8, 0x009D, 0x00DA, 0x00A7, 0x00DC, 0x009A, 0x00DD, 0x0097, 0x00DE, 0x008D, 0x00DF, 0x00E1, 0x00E0, 0x0085, 0x00E1, 0x00A0,
+	0x00E2, 0x0083, 0x00E4, 0x0084, 0x00E6, 0x0086, 0x00E7, 0x0087, 0x00E8, 0x008A, 0x00E9, 0x0082, 0x00EA, 0x0088, 0x00EB, 0x0089,
+	0x00ED, 0x00A1, 0x00F0, 0x008C, 0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F6, 0x0094, 0x00F7, 0x00F6, 0x00F8, 0x009B, 0x00FA, 0x00A3,
+	0x00FB, 0x0096, 0x00FC, 0x0081, 0x00FD, 0x0098, 0x00FE, 0x0095, 0x0192, 0x009F, 0x0393, 0x00E2, 0x0398, 0x00E9, 0x03A3, 0x00E4,
+	0x03A6, 0x00E8, 0x03A9, 0x00EA, 0x03B1, 0x00E0, 0x03B4, 0x00EB, 0x03B5, 0x00EE, 0x03C0, 0x00E3, 0x03C3, 0x00E5, 0x03C4, 0x00E7,
+	0x03C6, 0x00ED, 0x207F, 0x00FC, 0x20A7, 0x009E, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x221E, 0x00EC, 0x2229, 0x00EF, 0x2248, 0x00F7,
+	0x2261, 0x00F0, 0x2264, 0x00F3, 0x2265, 0x00F2, 0x2310, 0x00A9, 0x2320, 0x00F4, 0x2321, 0x00F5, 0x2500, 0x00C4, 0x2502, 0x00B3,
+	0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1,
+	0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8, 0x2556, 0x00B7,
+	0x2557, 0x00BB, 0x2558, 0x00D4, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255B, 0x00BE, 0x255C, 0x00BD, 0x255D, 0x00BC, 0x255E, 0x00C6,
+	0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2, 0x2566, 0x00CB,
+	0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF, 0x2584, 0x00DC,
+	0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 862 || FF_CODE_PAGE == 0
 static const WCHAR uc862[] = {	/*  CP862(Hebrew) to Unicode conversion table */
@@ -15148,6 +22293,26 @@ static const WCHAR uc862[] = {	/*  CP862(Hebrew) to Unicode conversion table */
 	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
 	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o862[] = {	/*  Unicode to CP862 conversion pairs (sorted uc862[]) */
+	0x00A0, 0x00FF, 0x00A1, 0x00AD, 0x00A2, 0x009B, 0x00A3, 0x009C, 0x00A5, 0x009D, 0x00AA, 0x00A6, 0x00AB, 0x00AE, 0x00AC, 0x00AA,
+	0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B5, 0x00E6, 0x00B7, 0x00FA, 0x00BA, 0x00A7, 0x00BB, 0x00AF, 0x00BC, 0x00AC,
+	0x00BD, 0x00AB, 0x00BF, 0x00A8, 0x00D1, 0x00A5, 0x00DF, 0x00E1, 0x00E1, 0x00A0, 0x00ED, 0x00A1, 0x00F1, 0x00A4, 0x00F3, 0x00A2,
+	0x00F7, 0x00F6, 0x00FA, 0x00A3, 0x0192, 0x009F, 0x0393, 0x00E2, 0x0398, 0x00E9, 0x03A3, 0x00E4, 0x03A6, 0x00E8, 0x03A9, 0x00EA,
+	0x03B1, 0x00E0, 0x03B4, 0x00EB, 0x03B5, 0x00EE, 0x03C0, 0x00E3, 0x03C3, 0x00E5, 0x03C4, 0x00E7, 0x03C6, 0x00ED, 0x05D0, 0x0080,
+	0x05D1, 0x0081, 0x05D2, 0x0082, 0x05D3, 0x0083, 0x05D4, 0x0084, 0x05D5, 0x0085, 0x05D6, 0x0086, 0x05D7, 0x0087, 0x05D8, 0x0088,
+	0x05D9, 0x0089, 0x05DA, 0x008A, 0x05DB, 0x008B, 0x05DC, 0x008C, 0x05DD, 0x008D, 0x05DE, 0x008E, 0x05DF, 0x008F, 0x05E0, 0x0090,
+	0x05E1, 0x0091, 0x05E2, 0x0092, 0x05E3, 0x0093, 0x05E4, 0x0094, 0x05E5, 0x0095, 0x05E6, 0x0096, 0x05E7, 0x0097, 0x05E8, 0x0098,
+	0x05E9, 0x0099, 0x05EA, 0x009A, 0x207F, 0x00FC, 0x20A7, 0x009E, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x221E, 0x00EC, 0x2229, 0x00EF,
+	0x2248, 0x00F7, 0x2261, 0x00F0, 0x2264, 0x00F3, 0x2265, 0x00F2, 0x2310, 0x00A9, 0x2320, 0x00F4, 0x2321, 0x00F5, 0x2500, 0x00C4,
+	0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2,
+	0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8,
+	0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00D4, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255B, 0x00BE, 0x255C, 0x00BD, 0x255D, 0x00BC,
+	0x255E, 0x00C6, 0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2,
+	0x2566, 0x00CB, 0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF,
+	0x2584, 0x00DC, 0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 863 || FF_CODE_PAGE == 0
 static const WCHAR uc863[] = {	/*  CP863(Canadian French) to Unicode conversion table */
@@ -15160,6 +22325,26 @@ static const WCHAR uc863[] = {	/*  CP863(Canadian French) to Unicode conversion
 	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2219,
 	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o863[] = {	/*  Unicode to CP863 conversion pairs (sorted uc863[]) */
+	0x00A0, 0x00FF, 0x00A2, 0x009B, 0x00A3, 0x009C, 0x00A4, 0x0098, 0x00A6, 0x00A0, 0x00A8, 0x00A4, 0x00AB, 0x00AE, 0x00AC, 0x00AA,
+	0x00AF, 0x00A7, 0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B3, 0x00A6, 0x00B4, 0x00A1, 0x00B5, 0x00E6, 0x00B6, 0x0086,
+	0x00B7, 0x00FA, 0x00BB, 0x00A5, 0x00BC, 0x00AC, 0x00BD, 0x00AB, 0x00BE, 0x00AD, 0x00C0, 0x008F, 0x00C2, 0x0084, 0x00C7, 0x0080,
+	0x00C8, 0x0091, 0x00C9, 0x0090, 0x00CA, 0x0092, 0x00CB, 0x0094, 0x00CE, 0x00A8, 0x00CF, 0x0095, 0x00D4, 0x0099, 0x00D9, 0x009D,
+	0x00DB, 0x009E, 0x00DC, 0x009A, 0x00DF, 0x00E1, 0x00E0, 0x0085, 0x00E2, 0x0083, 0x00E7, 0x0087, 0x00E8, 0x008A, 0x00E9, 0x0082,
+	0x00EA, 0x0088, 0x00EB, 0x0089, 0x00EC, 0x008D, 0x00EE, 0x008C, 0x00EF, 0x008B, 0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F7, 0x00F6,
+	0x00F9, 0x0097, 0x00FA, 0x00A3, 0x00FB, 0x0096, 0x00FC, 0x0081, 0x0192, 0x009F, 0x0393, 0x00E2, 0x0398, 0x00E9, 0x03A3, 0x00E4,
+	0x03A6, 0x00E8, 0x03A9, 0x00EA, 0x03B1, 0x00E0, 0x03B4, 0x00EB, 0x03B5, 0x00EE, 0x03C0, 0x00E3, 0x03C3, 0x00E5, 0x03C4, 0x00E7,
+	0x03C6, 0x00ED, 0x2017, 0x008E, 0x207F, 0x00FC, 0x2219, 0x00EF, 0x221A, 0x00FB, 0x221E, 0x00EC, 0x2248, 0x00F7, 0x2261, 0x00F0,
+	0x2264, 0x00F3, 0x2265, 0x00F2, 0x2320, 0x00F4, 0x2321, 0x00F5, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF,
+	0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD,
+	0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8, 0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00D4,
+	0x2559, 0x00D3, 0x255A, 0x00C8, 0x255B, 0x00BE, 0x255C, 0x00BD, 0x255D, 0x00BC, 0x255E, 0x00C6, 0x255F, 0x00C7, 0x2560, 0x00CC,
+	0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2, 0x2566, 0x00CB, 0x2567, 0x00CF, 0x2568, 0x00D0,
+	0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF, 0x2584, 0x00DC, 0x2588, 0x00DB, 0x258C, 0x00DD,
+	0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE, 0x3210, 0x00A9
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 864 || FF_CODE_PAGE == 0
 static const WCHAR uc864[] = {	/*  CP864(Arabic) to Unicode conversion table */
@@ -15172,6 +22357,26 @@ static const WCHAR uc864[] = {	/*  CP864(Arabic) to Unicode conversion table */
 	0x0640, 0xFED3, 0xFED7, 0xFEDB, 0xFEDF, 0xFEE3, 0xFEE7, 0xFEEB, 0xFEED, 0xFEEF, 0xFEF3, 0xFEBD, 0xFECC, 0xFECE, 0xFECD, 0xFEE1,
 	0xFE7D, 0x0651, 0xFEE5, 0xFEE9, 0xFEEC, 0xFEF0, 0xFEF2, 0xFED0, 0xFED5, 0xFEF5, 0xFEF6, 0xFEDD, 0xFED9, 0xFEF1, 0x25A0, 0x0000
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o864[] = {	/*  Unicode to CP864 conversion pairs (sorted uc864[]) */
+	0x0000, 0x009B, 0x00A0, 0x00A0, 0x00A2, 0x00C0, 0x00A3, 0x00A3, 0x00A4, 0x00A4, 0x00A6, 0x00DB, 0x00AB, 0x0097, 0x00AC, 0x00DC,
+	0x00AD, 0x00A1, 0x00B0, 0x0080, 0x00B1, 0x0093, 0x00B7, 0x0081, 0x00BB, 0x0098, 0x00BC, 0x0095, 0x00BD, 0x0094, 0x00D7, 0x00DE,
+	0x00F7, 0x00DD, 0x03B2, 0x0090, 0x03C6, 0x0092, 0x060C, 0x00AC, 0x061B, 0x00BB, 0x061F, 0x00BF, 0x0640, 0x00E0, 0x0651, 0x00F1,
+	0x0660, 0x00B0, 0x0661, 0x00B1, 0x0662, 0x00B2, 0x0663, 0x00B3, 0x0664, 0x00B4, 0x0665, 0x00B5, 0x0666, 0x00B6, 0x0667, 0x00B7,
+	0x0668, 0x00B8, 0x0669, 0x00B9, 0x20AC, 0x00A7, 0x2219, 0x0082, 0x221A, 0x0083, 0x221E, 0x0091, 0x2248, 0x0096, 0x2500, 0x0085,
+	0x2502, 0x0086, 0x250C, 0x008D, 0x2510, 0x008C, 0x2514, 0x008E, 0x2518, 0x008F, 0x251C, 0x008A, 0x2524, 0x0088, 0x252C, 0x0089,
+	0x2534, 0x008B, 0x253C, 0x0087, 0x2592, 0x0084, 0x25A0, 0x00FE, 0xFE7D, 0x00F0, 0xFE80, 0x00C1, 0xFE81, 0x00C2, 0xFE82, 0x00A2,
+	0xFE83, 0x00C3, 0xFE84, 0x00A5, 0xFE85, 0x00C4, 0xFE8B, 0x00C6, 0xFE8D, 0x00C7, 0xFE8E, 0x00A8, 0xFE8F, 0x00A9, 0xFE91, 0x00C8,
+	0xFE93, 0x00C9, 0xFE95, 0x00AA, 0xFE97, 0x00CA, 0xFE99, 0x00AB, 0xFE9B, 0x00CB, 0xFE9D, 0x00AD, 0xFE9F, 0x00CC, 0xFEA1, 0x00AE,
+	0xFEA3, 0x00CD, 0xFEA5, 0x00AF, 0xFEA7, 0x00CE, 0xFEA9, 0x00CF, 0xFEAB, 0x00D0, 0xFEAD, 0x00D1, 0xFEAF, 0x00D2, 0xFEB1, 0x00BC,
+	0xFEB3, 0x00D3, 0xFEB5, 0x00BD, 0xFEB7, 0x00D4, 0xFEB9, 0x00BE, 0xFEBB, 0x00D5, 0xFEBD, 0x00EB, 0xFEBF, 0x00D6, 0xFEC1, 0x00D7,
+	0xFEC5, 0x00D8, 0xFEC9, 0x00DF, 0xFECA, 0x00C5, 0xFECB, 0x00D9, 0xFECC, 0x00EC, 0xFECD, 0x00EE, 0xFECE, 0x00ED, 0xFECF, 0x00DA,
+	0xFED0, 0x00F7, 0xFED1, 0x00BA, 0xFED3, 0x00E1, 0xFED5, 0x00F8, 0xFED7, 0x00E2, 0xFED9, 0x00FC, 0xFEDB, 0x00E3, 0xFEDD, 0x00FB,
+	0xFEDF, 0x00E4, 0xFEE1, 0x00EF, 0xFEE3, 0x00E5, 0xFEE5, 0x00F2, 0xFEE7, 0x00E6, 0xFEE9, 0x00F3, 0xFEEB, 0x00E7, 0xFEEC, 0x00F4,
+	0xFEED, 0x00E8, 0xFEEF, 0x00E9, 0xFEF0, 0x00F5, 0xFEF1, 0x00FD, 0xFEF2, 0x00F6, 0xFEF3, 0x00EA, 0xFEF5, 0x00F9, 0xFEF6, 0x00FA,
+	0xFEF7, 0x0099, 0xFEF8, 0x009A, 0xFEFB, 0x009D, 0xFEFC, 0x009E
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 865 || FF_CODE_PAGE == 0
 static const WCHAR uc865[] = {	/*  CP865(Nordic) to Unicode conversion table */
@@ -15184,6 +22389,26 @@ static const WCHAR uc865[] = {	/*  CP865(Nordic) to Unicode conversion table */
 	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
 	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o865[] = {	/*  Unicode to CP865 conversion pairs (sorted uc865[]) */
+	0x00A0, 0x00FF, 0x00A1, 0x00AD, 0x00A3, 0x009C, 0x00A4, 0x00AF, 0x00AA, 0x00A6, 0x00AB, 0x00AE, 0x00AC, 0x00AA, 0x00B0, 0x00F8,
+	0x00B1, 0x00F1, 0x00B2, 0x00FD, 0x00B5, 0x00E6, 0x00B7, 0x00FA, 0x00BA, 0x00A7, 0x00BC, 0x00AC, 0x00BD, 0x00AB, 0x00BF, 0x00A8,
+	0x00C4, 0x008E, 0x00C5, 0x008F, 0x00C6, 0x0092, 0x00C7, 0x0080, 0x00D1, 0x00A5, 0x00D6, 0x0099, 0x00D8, 0x009D, 0x00DC, 0x009A,
+	0x00DF, 0x00E1, 0x00E0, 0x0085, 0x00E1, 0x00A0, 0x00E2, 0x0083, 0x00E4, 0x0084, 0x00E5, 0x0086, 0x00E6, 0x0091, 0x00E7, 0x0087,
+	0x00E8, 0x008A, 0x00E9, 0x0082, 0x00EA, 0x0088, 0x00EB, 0x0089, 0x00EC, 0x008D, 0x00ED, 0x00A1, 0x00EE, 0x008C, 0x00EF, 0x008B,
+	0x00F1, 0x00A4, 0x00F2, 0x0095, 0x00F3, 0x00A2, 0x00F4, 0x0093, 0x00F6, 0x0094, 0x00F7, 0x00F6, 0x00F8, 0x009B, 0x00F9, 0x0097,
+	0x00FA, 0x00A3, 0x00FB, 0x0096, 0x00FC, 0x0081, 0x00FF, 0x0098, 0x0192, 0x009F, 0x0393, 0x00E2, 0x0398, 0x00E9, 0x03A3, 0x00E4,
+	0x03A6, 0x00E8, 0x03A9, 0x00EA, 0x03B1, 0x00E0, 0x03B4, 0x00EB, 0x03B5, 0x00EE, 0x03C0, 0x00E3, 0x03C3, 0x00E5, 0x03C4, 0x00E7,
+	0x03C6, 0x00ED, 0x207F, 0x00FC, 0x20A7, 0x009E, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x221E, 0x00EC, 0x2229, 0x00EF, 0x2248, 0x00F7,
+	0x2261, 0x00F0, 0x2264, 0x00F3, 0x2265, 0x00F2, 0x2310, 0x00A9, 0x2320, 0x00F4, 0x2321, 0x00F5, 0x2500, 0x00C4, 0x2502, 0x00B3,
+	0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1,
+	0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8, 0x2556, 0x00B7,
+	0x2557, 0x00BB, 0x2558, 0x00BE, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255C, 0x00BD, 0x255D, 0x00BC, 0x255E, 0x00C6, 0x255F, 0x00C7,
+	0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2, 0x2566, 0x00CB, 0x2567, 0x00CF,
+	0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF, 0x2584, 0x00DC, 0x2588, 0x00DB,
+	0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 866 || FF_CODE_PAGE == 0
 static const WCHAR uc866[] = {	/*  CP866(Russian) to Unicode conversion table */
@@ -15196,6 +22421,26 @@ static const WCHAR uc866[] = {	/*  CP866(Russian) to Unicode conversion table */
 	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
 	0x0401, 0x0451, 0x0404, 0x0454, 0x0407, 0x0457, 0x040E, 0x045E, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x2116, 0x00A4, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o866[] = {	/*  Unicode to CP866 conversion pairs (sorted uc866[]) */
+	0x00A0, 0x00FF, 0x00A4, 0x00FD, 0x00B0, 0x00F8, 0x00B7, 0x00FA, 0x0401, 0x00F0, 0x0404, 0x00F2, 0x0407, 0x00F4, 0x040E, 0x00F6,
+	0x0410, 0x0080, 0x0411, 0x0081, 0x0412, 0x0082, 0x0413, 0x0083, 0x0414, 0x0084, 0x0415, 0x0085, 0x0416, 0x0086, 0x0417, 0x0087,
+	0x0418, 0x0088, 0x0419, 0x0089, 0x041A, 0x008A, 0x041B, 0x008B, 0x041C, 0x008C, 0x041D, 0x008D, 0x041E, 0x008E, 0x041F, 0x008F,
+	0x0420, 0x0090, 0x0421, 0x0091, 0x0422, 0x0092, 0x0423, 0x0093, 0x0424, 0x0094, 0x0425, 0x0095, 0x0426, 0x0096, 0x0427, 0x0097,
+	0x0428, 0x0098, 0x0429, 0x0099, 0x042A, 0x009A, 0x042B, 0x009B, 0x042C, 0x009C, 0x042D, 0x009D, 0x042E, 0x009E, 0x042F, 0x009F,
+	0x0430, 0x00A0, 0x0431, 0x00A1, 0x0432, 0x00A2, 0x0433, 0x00A3, 0x0434, 0x00A4, 0x0435, 0x00A5, 0x0436, 0x00A6, 0x0437, 0x00A7,
+	0x0438, 0x00A8, 0x0439, 0x00A9, 0x043A, 0x00AA, 0x043B, 0x00AB, 0x043C, 0x00AC, 0x043D, 0x00AD, 0x043E, 0x00AE, 0x043F, 0x00AF,
+	0x0440, 0x00E0, 0x0441, 0x00E1, 0x0442, 0x00E2, 0x0443, 0x00E3, 0x0444, 0x00E4, 0x0445, 0x00E5, 0x0446, 0x00E6, 0x0447, 0x00E7,
+	0x0448, 0x00E8, 0x0449, 0x00E9, 0x044A, 0x00EA, 0x044B, 0x00EB, 0x044C, 0x00EC, 0x044D, 0x00ED, 0x044E, 0x00EE, 0x044F, 0x00EF,
+	0x0451, 0x00F1, 0x0454, 0x00F3, 0x0457, 0x00F5, 0x045E, 0x00F7, 0x2116, 0x00FC, 0x2219, 0x00F9, 0x221A, 0x00FB, 0x2500, 0x00C4,
+	0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9, 0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2,
+	0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2552, 0x00D5, 0x2553, 0x00D6, 0x2554, 0x00C9, 0x2555, 0x00B8,
+	0x2556, 0x00B7, 0x2557, 0x00BB, 0x2558, 0x00D4, 0x2559, 0x00D3, 0x255A, 0x00C8, 0x255B, 0x00BE, 0x255C, 0x00BD, 0x255D, 0x00BC,
+	0x255E, 0x00C6, 0x255F, 0x00C7, 0x2560, 0x00CC, 0x2561, 0x00B5, 0x2562, 0x00B6, 0x2563, 0x00B9, 0x2564, 0x00D1, 0x2565, 0x00D2,
+	0x2566, 0x00CB, 0x2567, 0x00CF, 0x2568, 0x00D0, 0x2569, 0x00CA, 0x256A, 0x00D8, 0x256B, 0x00D7, 0x256C, 0x00CE, 0x2580, 0x00DF,
+	0x2584, 0x00DC, 0x2588, 0x00DB, 0x258C, 0x00DD, 0x2590, 0x00DE, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
+#endif
 #endif
 #if FF_CODE_PAGE == 869 || FF_CODE_PAGE == 0
 static const WCHAR uc869[] = {	/*  CP869(Greek 2) to Unicode conversion table */
@@ -15208,8 +22453,52 @@ static const WCHAR uc869[] = {	/*  CP869(Greek 2) to Unicode conversion table */
 	0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x0384,
 	0x00AD, 0x00B1, 0x03C5, 0x03C6, 0x03C7, 0x00A7, 0x03C8, 0x0385, 0x00B0, 0x00A8, 0x03C9, 0x03CB, 0x03B0, 0x03CE, 0x25A0, 0x00A0
 };
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR u2o869[] = {	/*  Unicode to CP869 conversion pairs (sorted uc869[]) */
+	0x00A0, 0x00FF, 0x00A3, 0x009C, 0x00A6, 0x008A, 0x00A7, 0x00F5, 0x00A8, 0x00F9, 0x00A9, 0x0097, 0x00AB, 0x00AE, 0x00AC, 0x0089,
+	0x00AD, 0x00F0, 0x00B0, 0x00F8, 0x00B1, 0x00F1, 0x00B2, 0x0099, 0x00B3, 0x009A, 0x00B7, 0x0080, 0x00BB, 0x00AF, 0x00BD, 0x00AB,
+	0x0384, 0x00EF, 0x0385, 0x00F7, 0x0386, 0x0086, 0x0388, 0x008D, 0x0389, 0x008F, 0x038A, 0x0090, 0x038C, 0x0092, 0x038E, 0x0095,
+	0x038F, 0x0098, 0x0390, 0x00A1, 0x0391, 0x00A4, 0x0392, 0x00A5, 0x0393, 0x00A6, 0x0394, 0x00A7, 0x0395, 0x00A8, 0x0396, 0x00A9,
+	0x0397, 0x00AA, 0x0398, 0x00AC, 0x0399, 0x00AD, 0x039A, 0x00B5, 0x039B, 0x00B6, 0x039C, 0x00B7, 0x039D, 0x00B8, 0x039E, 0x00BD,
+	0x039F, 0x00BE, 0x03A1, 0x00C7, 0x03A3, 0x00CF, 0x03A4, 0x00D0, 0x03A5, 0x00D1, 0x03A6, 0x00D2, 0x03A7, 0x00D3, 0x03A8, 0x00D4,
+	0x03A9, 0x00D5, 0x03AA, 0x0091, 0x03AB, 0x0096, 0x03AC, 0x009B, 0x03AD, 0x009D, 0x03AE, 0x009E, 0x03AF, 0x009F, 0x03B0, 0x00FC,
+	0x03B1, 0x00D6, 0x03B2, 0x00D7, 0x03B3, 0x00D8, 0x03B4, 0x00DD, 0x03B5, 0x00DE, 0x03B6, 0x00E0, 0x03B7, 0x00E1, 0x03B8, 0x00E2,
+	0x03B9, 0x00E3, 0x03BA, 0x00E4, 0x03BB, 0x00E5, 0x03BC, 0x00E6, 0x03BD, 0x00E7, 0x03BE, 0x00E8, 0x03BF, 0x00E9, 0x03C0, 0x00EA,
+	0x03C1, 0x00EB, 0x03C2, 0x00ED, 0x03C3, 0x00EC, 0x03C4, 0x00EE, 0x03C5, 0x00F2, 0x03C6, 0x00F3, 0x03C7, 0x00F4, 0x03C8, 0x00F6,
+	0x03C9, 0x00FA, 0x03CA, 0x00A0, 0x03CB, 0x00FB, 0x03CC, 0x00A2, 0x03CD, 0x00A3, 0x03CE, 0x00FD, 0x0A30, 0x00C6, 0x2015, 0x008E,
+	0x2018, 0x008B, 0x2019, 0x008C, 0x2500, 0x00C4, 0x2502, 0x00B3, 0x250C, 0x00DA, 0x2510, 0x00BF, 0x2514, 0x00C0, 0x2518, 0x00D9,
+	0x251C, 0x00C3, 0x2524, 0x00B4, 0x252C, 0x00C2, 0x2534, 0x00C1, 0x253C, 0x00C5, 0x2550, 0x00CD, 0x2551, 0x00BA, 0x2554, 0x00C9,
+	0x2557, 0x00BB, 0x255A, 0x00C8, 0x255D, 0x00BC, 0x2560, 0x00CC, 0x2563, 0x00B9, 0x2566, 0x00CB, 0x2569, 0x00CA, 0x256C, 0x00CE,
+	0x2580, 0x00DF, 0x2584, 0x00DC, 0x2588, 0x00DB, 0x2591, 0x00B0, 0x2592, 0x00B1, 0x2593, 0x00B2, 0x25A0, 0x00FE
+};
 #endif
+#endif
+
+
+
 
+#if FF_UNI2OEM_MAP >= 1 && (FF_CODE_PAGE < 900 || FF_CODE_PAGE == 0)
+static WCHAR find_pair (	/* Returns the paired code, zero if not found */
+	const WCHAR* p,		/* Pointer to the code pair table sorted by the first code */
+	UINT n,				/* Number of pairs in the table */
+	WCHAR code			/* Code to find */
+)
+{
+	UINT i, li = 0, hi = n;
+
+
+	while (li < hi) {	/* Binary search */
+		i = (li + hi) / 2;
+		if (code == p[i * 2]) return p[i * 2 + 1];
+		if (code > p[i * 2]) {
+			li = i + 1;
+		} else {
+			hi = i;
+		}
+	}
+	return 0;
+}
+#endif
 
 
 
@@ -15225,7 +22514,9 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 )
 {
 	WCHAR c = 0;
+#if FF_UNI2OEM_MAP < 1
 	const WCHAR *p = CVTBL(uc, FF_CODE_PAGE);
+#endif
 
 
 	if (uni < 0x80) {	/* ASCII? */
@@ -15233,8 +22524,12 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 
 	} else {			/* Non-ASCII */
 		if (uni < 0x10000 && cp == FF_CODE_PAGE) {	/* Is it in BMP and valid code page? */
+#if FF_UNI2OEM_MAP >= 1
+			c = find_pair(CVTBL(u2o, FF_CODE_PAGE), sizeof CVTBL(u2o, FF_CODE_PAGE) / 4, (WCHAR)uni);	/* Search the reverse table */
+#else
 			for (c = 0; c < 0x80 && uni != p[c]; c++) ;
 			c = (c + 0x80) & 0xFF;
+#endif
 		}
 	}
 
@@ -15277,9 +22572,12 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 	WORD	cp		/* Code page for the conversion */
 )
 {
+#if FF_UNI2OEM_MAP < 2
 	const WCHAR *p;
+	UINT n, li, hi;
+#endif
 	WCHAR c = 0, uc;
-	UINT i = 0, n, li, hi;
+	UINT i = 0;
 
 
 	if (uni < 0x80) {	/* ASCII? */
@@ -15288,6 +22586,10 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 	} else {			/* Non-ASCII */
 		if (uni < 0x10000 && cp == FF_CODE_PAGE) {	/* Is it in BMP and valid code page? */
 			uc = (WCHAR)uni;
+#if FF_UNI2OEM_MAP >= 2
+			i = CVTBL(u2oidx, FF_CODE_PAGE)[uc / 64];	/* Get the map block */
+			if (i != 0) c = CVTBL(u2oblk, FF_CODE_PAGE)[(i - 1) * 64 + uc % 64];
+#else
 			p = CVTBL(uni2oem, FF_CODE_PAGE);
 			hi = sizeof CVTBL(uni2oem, FF_CODE_PAGE) / 4 - 1;
 			li = 0;
@@ -15301,6 +22603,7 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 				}
 			}
 			if (n != 0) c = p[i * 2 + 1];
+#endif
 		}
 	}
 
@@ -15353,6 +22656,11 @@ WCHAR ff_oem2uni (	/* Returns Unicode character in UTF-16, zero on error */
 
 static const WORD cp_code[]          = {  437,   720,   737,   771,   775,   850,   852,   855,   857,   860,   861,   862,   863,   864,   865,   866,   869, 0};
 static const WCHAR* const cp_table[] = {uc437, uc720, uc737, uc771, uc775, uc850, uc852, uc855, uc857, uc860, uc861, uc862, uc863, uc864, uc865, uc866, uc869, 0};
+#if FF_UNI2OEM_MAP >= 1
+static const WCHAR* const cp_u2o[]   = {u2o437, u2o720, u2o737, u2o771, u2o775, u2o850, u2o852, u2o855, u2o857, u2o860, u2o861, u2o862, u2o863, u2o864, u2o865, u2o866, u2o869};
+static const BYTE cp_u2on[]          = {sizeof u2o437 / 4, sizeof u2o720 / 4, sizeof u2o737 / 4, sizeof u2o771 / 4, sizeof u2o775 / 4, sizeof u2o850 / 4, sizeof u2o852 / 4, sizeof u2o855 / 4, sizeof u2o857 / 4,
+                                        sizeof u2o860 / 4, sizeof u2o861 / 4, sizeof u2o862 / 4, sizeof u2o863 / 4, sizeof u2o864 / 4, sizeof u2o865 / 4, sizeof u2o866 / 4, sizeof u2o869 / 4};
+#endif
 
 
 WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
@@ -15362,7 +22670,10 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 {
 	const WCHAR *p;
 	WCHAR c = 0, uc;
-	UINT i, n, li, hi;
+	UINT i;
+#if FF_UNI2OEM_MAP < 2
+	UINT n, li, hi;
+#endif
 
 
 	if (uni < 0x80) {	/* ASCII? */
@@ -15376,10 +22687,28 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 				for (i = 0; cp_code[i] != 0 && cp_code[i] != cp; i++) ;		/* Get conversion table */
 				p = cp_table[i];
 				if (p) {	/* Is it valid code page ? */
+#if FF_UNI2OEM_MAP >= 1
+					c = find_pair(cp_u2o[i], cp_u2on[i], uc);	/* Search the reverse table */
+#else
 					for (c = 0; c < 0x80 && uc != p[c]; c++) ;	/* Find OEM code in the table */
 					c = (c + 0x80) & 0xFF;
+#endif
 				}
 			} else {	/* DBCS */
+#if FF_UNI2OEM_MAP >= 2
+				const WORD *idx = 0;
+
+				switch (cp) {	/* Get conversion map */
+				case 932 : idx = u2oidx932; p = u2oblk932; break;
+				case 936 : idx = u2oidx936; p = u2oblk936; break;
+				case 949 : idx = u2oidx949; p = u2oblk949; break;
+				case 950 : idx = u2oidx950; p = u2oblk950; break;
+				}
+				if (idx) {	/* Is it valid code page? */
+					i = idx[uc / 64];	/* Get the map block */
+					if (i != 0) c = p[(i - 1) * 64 + uc % 64];
+				}
+#else
 				switch (cp) {	/* Get conversion table */
 				case 932 : p = uni2oem932; hi = sizeof uni2oem932 / 4 - 1; break;
 				case 936 : p = uni2oem936; hi = sizeof uni2oem936 / 4 - 1; break;
@@ -15399,6 +22728,7 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 					}
 					if (n != 0) c = p[i * 2 + 1];
 				}
+#endif
 			}
 		}
 	}
@@ -15455,6 +22785,8 @@ WCHAR ff_oem2uni (	/* Returns Unicode character in UTF-16, zero on error */
 }
 #endif
 
+#endif	/* FF_USE_CPTBL */
+
 
 
 /*------------------------------------------------------------------------*/
@@ -15558,8 +22890,107 @@ DWORD ff_wtoupper (	/* Returns up-converted code point */
 
 		0x0000	/* EOT */
 	};
+#if FF_WTOUPPER_TBL
+	static const WORD cvt0[] = {	/* Direct up conversion table for U+0080 - U+05FF (expanded cvt1[]) */
+	0x0080,0x0081,0x0082,0x0083,0x0084,0x0085,0x0086,0x0087,0x0088,0x0089,0x008A,0x008B,0x008C,0x008D,0x008E,0x008F,
+	0x0090,0x0091,0x0092,0x0093,0x0094,0x0095,0x0096,0x0097,0x0098,0x0099,0x009A,0x009B,0x009C,0x009D,0x009E,0x009F,
+	0x00A0,0x00A1,0x00A2,0x00A3,0x00A4,0x00A5,0x00A6,0x00A7,0x00A8,0x00A9,0x00AA,0x00AB,0x00AC,0x00AD,0x00AE,0x00AF,
+	0x00B0,0x00B1,0x00B2,0x00B3,0x00B4,0x00B5,0x00B6,0x00B7,0x00B8,0x00B9,0x00BA,0x00BB,0x00BC,0x00BD,0x00BE,0x00BF,
+	0x00C0,0x00C1,0x00C2,0x00C3,0x00C4,0x00C5,0x00C6,0x00C7,0x00C8,0x00C9,0x00CA,0x00CB,0x00CC,0x00CD,0x00CE,0x00CF,
+	0x00D0,0x00D1,0x00D2,0x00D3,0x00D4,0x00D5,0x00D6,0x00D7,0x00D8,0x00D9,0x00DA,0x00DB,0x00DC,0x00DD,0x00DE,0x00DF,
+	0x00C0,0x00C1,0x00C2,0x00C3,0x00C4,0x00C5,0x00C6,0x00C7,0x00C8,0x00C9,0x00CA,0x00CB,0x00CC,0x00CD,0x00CE,0x00CF,
+	0x00D0,0x00D1,0x00D2,0x00D3,0x00D4,0x00D5,0x00D6,0x00F7,0x00D8,0x00D9,0x00DA,0x00DB,0x00DC,0x00DD,0x00DE,0x0178,
+	0x0100,0x0100,0x0102,0x0102,0x0104,0x0104,0x0106,0x0106,0x0108,0x0108,0x010A,0x010A,0x010C,0x010C,0x010E,0x010E,
+	0x0110,0x0110,0x0112,0x0112,0x0114,0x0114,0x0116,0x0116,0x0118,0x0118,0x011A,0x011A,0x011C,0x011C,0x011E,0x011E,
+	0x0120,0x0120,0x0122,0x0122,0x0124,0x0124,0x0126,0x0126,0x0128,0x0128,0x012A,0x012A,0x012C,0x012C,0x012E,0x012E,
+	0x0130,0x0131,0x0132,0x0132,0x0134,0x0134,0x0136,0x0136,0x0138,0x0139,0x0139,0x013B,0x013B,0x013D,0x013D,0x013F,
+	0x013F,0x0141,0x0141,0x0143,0x0143,0x0145,0x0145,0x0147,0x0147,0x0149,0x014A,0x014A,0x014C,0x014C,0x014E,0x014E,
+	0x0150,0x0150,0x0152,0x0152,0x0154,0x0154,0x0156,0x0156,0x0158,0x0158,0x015A,0x015A,0x015C,0x015C,0x015E,0x015E,
+	0x0160,0x0160,0x0162,0x0162,0x0164,0x0164,0x0166,0x0166,0x0168,0x0168,0x016A,0x016A,0x016C,0x016C,0x016E,0x016E,
+	0x0170,0x0170,0x0172,0x0172,0x0174,0x0174,0x0176,0x0176,0x0178,0x0179,0x0179,0x017B,0x017B,0x017D,0x017D,0x017F,
+	0x0243,0x0181,0x0182,0x0182,0x0184,0x0184,0x0186,0x0187,0x0187,0x0189,0x018A,0x018B,0x018B,0x018D,0x018E,0x018F,
+	0x0190,0x0191,0x0191,0x0193,0x0194,0x01F6,0x0196,0x0197,0x0198,0x0198,0x023D,0x019B,0x019C,0x019D,0x0220,0x019F,
+	0x01A0,0x01A0,0x01A2,0x01A2,0x01A4,0x01A4,0x01A6,0x01A7,0x01A7,0x01A9,0x01AA,0x01AB,0x01AC,0x01AC,0x01AE,0x01AF,
+	0x01AF,0x01B1,0x01B2,0x01B3,0x01B3,0x01B5,0x01B5,0x01B7,0x01B8,0x01B8,0x01BA,0x01BB,0x01BC,0x01BC,0x01BE,0x01F7,
+	0x01C0,0x01C1,0x01C2,0x01C3,0x01C4,0x01C5,0x01C4,0x01C7,0x01C8,0x01C7,0x01CA,0x01CB,0x01CA,0x01CD,0x01CD,0x01CF,
+	0x01CF,0x01D1,0x01D1,0x01D3,0x01D3,0x01D5,0x01D5,0x01D7,0x01D7,0x01D9,0x01D9,0x01DB,0x01DB,0x018E,0x01DE,0x01DE,
+	0x01E0,0x01E0,0x01E2,0x01E2,0x01E4,0x01E4,0x01E6,0x01E6,0x01E8,0x01E8,0x01EA,0x01EA,0x01EC,0x01EC,0x01EE,0x01EE,
+	0x01F0,0x01F1,0x01F2,0x01F1,0x01F4,0x01F4,0x01F6,0x01F7,0x01F8,0x01F8,0x01FA,0x01FA,0x01FC,0x01FC,0x01FE,0x01FE,
+	0x0200,0x0200,0x0202,0x0202,0x0204,0x0204,0x0206,0x0206,0x0208,0x0208,0x020A,0x020A,0x020C,0x020C,0x020E,0x020E,
+	0x0210,0x0210,0x0212,0x0212,0x0214,0x0214,0x0216,0x0216,0x0218,0x0218,0x021A,0x021A,0x021C,0x021C,0x021E,0x021E,
+	0x0220,0x0221,0x0222,0x0222,0x0224,0x0224,0x0226,0x0226,0x0228,0x0228,0x022A,0x022A,0x022C,0x022C,0x022E,0x022E,
+	0x0230,0x0230,0x0232,0x0232,0x0234,0x0235,0x0236,0x0237,0x0238,0x0239,0x2C65,0x023B,0x023B,0x023D,0x2C66,0x023F,
+	0x0240,0x0241,0x0241,0x0243,0x0244,0x0245,0x0246,0x0246,0x0248,0x0248,0x024A,0x024A,0x024C,0x024C,0x024E,0x024E,
+	0x0250,0x0251,0x0252,0x0181,0x0186,0x0255,0x0189,0x018A,0x0258,0x018F,0x025A,0x0190,0x025C,0x025D,0x025E,0x025F,
+	0x0193,0x0261,0x0262,0x0194,0x0264,0x0265,0x0266,0x0267,0x0197,0x0196,0x026A,0x2C62,0x026C,0x026D,0x026E,0x019C,
+	0x0270,0x0271,0x019D,0x0273,0x0274,0x019F,0x0276,0x0277,0x0278,0x0279,0x027A,0x027B,0x027C,0x2C64,0x027E,0x027F,
+	0x01A6,0x0281,0x0282,0x01A9,0x0284,0x0285,0x0286,0x0287,0x01AE,0x0244,0x01B1,0x01B2,0x0245,0x028D,0x028E,0x028F,
+	0x0290,0x0291,0x01B7,0x0293,0x0294,0x0295,0x0296,0x0297,0x0298,0x0299,0x029A,0x029B,0x029C,0x029D,0x029E,0x029F,
+	0x02A0,0x02A1,0x02A2,0x02A3,0x02A4,0x02A5,0x02A6,0x02A7,0x02A8,0x02A9,0x02AA,0x02AB,0x02AC,0x02AD,0x02AE,0x02AF,
+	0x02B0,0x02B1,0x02B2,0x02B3,0x02B4,0x02B5,0x02B6,0x02B7,0x02B8,0x02B9,0x02BA,0x02BB,0x02BC,0x02BD,0x02BE,0x02BF,
+	0x02C0,0x02C1,0x02C2,0x02C3,0x02C4,0x02C5,0x02C6,0x02C7,0x02C8,0x02C9,0x02CA,0x02CB,0x02CC,0x02CD,0x02CE,0x02CF,
+	0x02D0,0x02D1,0x02D2,0x02D3,0x02D4,0x02D5,0x02D6,0x02D7,0x02D8,0x02D9,0x02DA,0x02DB,0x02DC,0x02DD,0x02DE,0x02DF,
+	0x02E0,0x02E1,0x02E2,0x02E3,0x02E4,0x02E5,0x02E6,0x02E7,0x02E8,0x02E9,0x02EA,0x02EB,0x02EC,0x02ED,0x02EE,0x02EF,
+	0x02F0,0x02F1,0x02F2,0x02F3,0x02F4,0x02F5,0x02F6,0x02F7,0x02F8,0x02F9,0x02FA,0x02FB,0x02FC,0x02FD,0x02FE,0x02FF,
+	0x0300,0x0301,0x0302,0x0303,0x0304,0x0305,0x0306,0x0307,0x0308,0x0309,0x030A,0x030B,0x030C,0x030D,0x030E,0x030F,
+	0x0310,0x0311,0x0312,0x0313,0x0314,0x0315,0x0316,0x0317,0x0318,0x0319,0x031A,0x031B,0x031C,0x031D,0x031E,0x031F,
+	0x0320,0x0321,0x0322,0x0323,0x0324,0x0325,0x0326,0x0327,0x0328,0x0329,0x032A,0x032B,0x032C,0x032D,0x032E,0x032F,
+	0x0330,0x0331,0x0332,0x0333,0x0334,0x0335,0x0336,0x0337,0x0338,0x0339,0x033A,0x033B,0x033C,0x033D,0x033E,0x033F,
+	0x0340,0x0341,0x0342,0x0343,0x0344,0x0345,0x0346,0x0347,0x0348,0x0349,0x034A,0x034B,0x034C,0x034D,0x034E,0x034F,
+	0x0350,0x0351,0x0352,0x0353,0x0354,0x0355,0x0356,0x0357,0x0358,0x0359,0x035A,0x035B,0x035C,0x035D,0x035E,0x035F,
+	0x0360,0x0361,0x0362,0x0363,0x0364,0x0365,0x0366,0x0367,0x0368,0x0369,0x036A,0x036B,0x036C,0x036D,0x036E,0x036F,
+	0x0370,0x0371,0x0372,0x0373,0x0374,0x0375,0x0376,0x0377,0x0378,0x0379,0x037A,0x03FD,0x03FE,0x03FF,0x037E,0x037F,
+	0x0380,0x0381,0x0382,0x0383,0x0384,0x0385,0x0386,0x0387,0x0388,0x0389,0x038A,0x038B,0x038C,0x038D,0x038E,0x038F,
+	0x0390,0x0391,0x0392,0x0393,0x0394,0x0395,0x0396,0x0397,0x0398,0x0399,0x039A,0x039B,0x039C,0x039D,0x039E,0x039F,
+	0x03A0,0x03A1,0x03A2,0x03A3,0x03A4,0x03A5,0x03A6,0x03A7,0x03A8,0x03A9,0x03AA,0x03AB,0x0386,0x0388,0x0389,0x038A,
+	0x03B0,0x0391,0x0392,0x0393,0x0394,0x0395,0x0396,0x0397,0x0398,0x0399,0x039A,0x039B,0x039C,0x039D,0x039E,0x039F,
+	0x03A0,0x03A1,0x03A3,0x03A3,0x03A4,0x03A5,0x03A6,0x03A7,0x03A8,0x03A9,0x03AA,0x03AB,0x038C,0x038E,0x038F,0x03CF,
+	0x03D0,0x03D1,0x03D2,0x03D3,0x03D4,0x03D5,0x03D6,0x03D7,0x03D8,0x03D8,0x03DA,0x03DA,0x03DC,0x03DC,0x03DE,0x03DE,
+	0x03E0,0x03E0,0x03E2,0x03E2,0x03E4,0x03E4,0x03E6,0x03E6,0x03E8,0x03E8,0x03EA,0x03EA,0x03EC,0x03EC,0x03EE,0x03EE,
+	0x03F0,0x03F1,0x03F9,0x03F3,0x03F4,0x03F5,0x03F6,0x03F7,0x03F7,0x03F9,0x03FA,0x03FA,0x03FC,0x03FD,0x03FE,0x03FF,
+	0x0400,0x0401,0x0402,0x0403,0x0404,0x0405,0x0406,0x0407,0x0408,0x0409,0x040A,0x040B,0x040C,0x040D,0x040E,0x040F,
+	0x0410,0x0411,0x0412,0x0413,0x0414,0x0415,0x0416,0x0417,0x0418,0x0419,0x041A,0x041B,0x041C,0x041D,0x041E,0x041F,
+	0x0420,0x0421,0x0422,0x0423,0x0424,0x0425,0x0426,0x0427,0x0428,0x0429,0x042A,0x042B,0x042C,0x042D,0x042E,0x042F,
+	0x0410,0x0411,0x0412,0x0413,0x0414,0x0415,0x0416,0x0417,0x0418,0x0419,0x041A,0x041B,0x041C,0x041D,0x041E,0x041F,
+	0x0420,0x0421,0x0422,0x0423,0x0424,0x0425,0x0426,0x0427,0x0428,0x0429,0x042A,0x042B,0x042C,0x042D,0x042E,0x042F,
+	0x0400,0x0401,0x0402,0x0403,0x0404,0x0405,0x0406,0x0407,0x0408,0x0409,0x040A,0x040B,0x040C,0x040D,0x040E,0x040F,
+	0x0460,0x0460,0x0462,0x0462,0x0464,0x0464,0x0466,0x0466,0x0468,0x0468,0x046A,0x046A,0x046C,0x046C,0x046E,0x046E,
+	0x0470,0x0470,0x0472,0x0472,0x0474,0x0474,0x0476,0x0476,0x0478,0x0478,0x047A,0x047A,0x047C,0x047C,0x047E,0x047E,
+	0x0480,0x0480,0x0482,0x0483,0x0484,0x0485,0x0486,0x0487,0x0488,0x0489,0x048A,0x048A,0x048C,0x048C,0x048E,0x048E,
+	0x0490,0x0490,0x0492,0x0492,0x0494,0x0494,0x0496,0x0496,0x0498,0x0498,0x049A,0x049A,0x049C,0x049C,0x049E,0x049E,
+	0x04A0,0x04A0,0x04A2,0x04A2,0x04A4,0x04A4,0x04A6,0x04A6,0x04A8,0x04A8,0x04AA,0x04AA,0x04AC,0x04AC,0x04AE,0x04AE,
+	0x04B0,0x04B0,0x04B2,0x04B2,0x04B4,0x04B4,0x04B6,0x04B6,0x04B8,0x04B8,0x04BA,0x04BA,0x04BC,0x04BC,0x04BE,0x04BE,
+	0x04C0,0x04C1,0x04C1,0x04C3,0x04C3,0x04C5,0x04C5,0x04C7,0x04C7,0x04C9,0x04C9,0x04CB,0x04CB,0x04CD,0x04CD,0x04C0,
+	0x04D0,0x04D0,0x04D2,0x04D2,0x04D4,0x04D4,0x04D6,0x04D6,0x04D8,0x04D8,0x04DA,0x04DA,0x04DC,0x04DC,0x04DE,0x04DE,
+	0x04E0,0x04E0,0x04E2,0x04E2,0x04E4,0x04E4,0x04E6,0x04E6,0x04E8,0x04E8,0x04EA,0x04EA,0x04EC,0x04EC,0x04EE,0x04EE,
+	0x04F0,0x04F0,0x04F2,0x04F2,0x04F4,0x04F4,0x04F6,0x04F6,0x04F8,0x04F8,0x04FA,0x04FA,0x04FC,0x04FC,0x04FE,0x04FE,
+	0x0500,0x0500,0x0502,0x0502,0x0504,0x0504,0x0506,0x0506,0x0508,0x0508,0x050A,0x050A,0x050C,0x050C,0x050E,0x050E,
+	0x0510,0x0510,0x0512,0x0512,0x0514,0x0515,0x0516,0x0517,0x0518,0x0519,0x051A,0x051B,0x051C,0x051D,0x051E,0x051F,
+	0x0520,0x0521,0x0522,0x0523,0x0524,0x0525,0x0526,0x0527,0x0528,0x0529,0x052A,0x052B,0x052C,0x052D,0x052E,0x052F,
+	0x0530,0x0531,0x0532,0x0533,0x0534,0x0535,0x0536,0x0537,0x0538,0x0539,0x053A,0x053B,0x053C,0x053D,0x053E,0x053F,
+	0x0540,0x0541,0x0542,0x0543,0x0544,0x0545,0x0546,0x0547,0x0548,0x0549,0x054A,0x054B,0x054C,0x054D,0x054E,0x054F,
+	0x0550,0x0551,0x0552,0x0553,0x0554,0x0555,0x0556,0x0557,0x0558,0x0559,0x055A,0x055B,0x055C,0x055D,0x055E,0x055F,
+	0x0560,0x0531,0x0532,0x0533,0x0534,0x0535,0x0536,0x0537,0x0538,0x0539,0x053A,0x053B,0x053C,0x053D,0x053E,0x053F,
+	0x0540,0x0541,0x0542,0x0543,0x0544,0x0545,0x0546,0x0547,0x0548,0x0549,0x054A,0x054B,0x054C,0x054D,0x054E,0x054F,
+	0x0550,0x0551,0x0552,0x0553,0x0554,0x0555,0x0556,0x0587,0x0588,0x0589,0x058A,0x058B,0x058C,0x058D,0x058E,0x058F,
+	0x0590,0x0591,0x0592,0x0593,0x0594,0x0595,0x0596,0x0597,0x0598,0x0599,0x059A,0x059B,0x059C,0x059D,0x059E,0x059F,
+	0x05A0,0x05A1,0x05A2,0x05A3,0x05A4,0x05A5,0x05A6,0x05A7,0x05A8,0x05A9,0x05AA,0x05AB,0x05AC,0x05AD,0x05AE,0x05AF,
+	0x05B0,0x05B1,0x05B2,0x05B3,0x05B4,0x05B5,0x05B6,0x05B7,0x05B8,0x05B9,0x05BA,0x05BB,0x05BC,0x05BD,0x05BE,0x05BF,
+	0x05C0,0x05C1,0x05C2,0x05C3,0x05C4,0x05C5,0x05C6,0x05C7,0x05C8,0x05C9,0x05CA,0x05CB,0x05CC,0x05CD,0x05CE,0x05CF,
+	0x05D0,0x05D1,0x05D2,0x05D3,0x05D4,0x05D5,0x05D6,0x05D7,0x05D8,0x05D9,0x05DA,0x05DB,0x05DC,0x05DD,0x05DE,0x05DF,
+	0x05E0,0x05E1,0x05E2,0x05E3,0x05E4,0x05E5,0x05E6,0x05E7,0x05E8,0x05E9,0x05EA,0x05EB,0x05EC,0x05ED,0x05EE,0x05EF,
+	0x05F0,0x05F1,0x05F2,0x05F3,0x05F4,0x05F5,0x05F6,0x05F7,0x05F8,0x05F9,0x05FA,0x05FB,0x05FC,0x05FD,0x05FE,0x05FF
+	};
+#endif
 
 
+	if (uni < 0x80) {		/* Is it ASCII? */
+		if (uni >= 'a' && uni <= 'z') uni -= 0x20;
+		return uni;
+	}
+#if FF_WTOUPPER_TBL
+	if (uni < 0x600) return cvt0[uni - 0x80];	/* Is it in the direct table? */
+#endif
 	if (uni < 0x10000) {	/* Is it in BMP? */
 		uc = (WORD)uni;
 		p = uc < 0x1000 ? cvt1 : cvt2;
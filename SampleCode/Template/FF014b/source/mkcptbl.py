@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+#---------------------------------------------------------------------------/
+#  Code conversion table generator for FatFs (FF_USE_CPTBL)
+#---------------------------------------------------------------------------/
+#
+#  Usage: python3 mkcptbl.py [-o ffcptbl.h] <code page> [<code page> ...]
+#
+#  This script reads the conversion tables in ffunicode.c and the up-case
+#  and DBC range tables in ff.c, and writes ffcptbl.h that contains only the
+#  given code pages. Each Unicode <-> OEM conversion table is re-encoded into
+#  a two-level map of 2^n code blocks that can be looked up in constant time:
+#
+#  idx[]  Block index, one WORD per block of the key range.
+#           0      : No character in the block.
+#           1..    : Full block number + 1 (2^n WCHARs in blk[]).
+#           0x8000 | (delta block number + 1) (2^n + 2 bytes in dlt[]: base
+#           code in little endian and 2^n offsets from it, 0xFF: no char).
+#
+#  Identical blocks are stored only once, and the block size is chosen per
+#  table to minimize the size. The flash and lookup cost of each code page
+#  is reported to stdout and also recorded in the header of the output file.
+#
+
+import os
+import re
+import sys
+
+SBCS = (437, 720, 737, 771, 775, 850, 852, 855, 857, 860, 861, 862, 863, 864, 865, 866, 869)
+DBCS = (932, 936, 949, 950)
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def c_array(src, name):
+	"""Returns the numbers in the initializer of 'static const WCHAR name[]'."""
+	m = re.search(r'static const WCHAR %s\[\] = \{[^\n]*\n(.*?)\n\};' % name, src, re.S)
+	if not m:
+		sys.exit('mkcptbl: %s[] is not found in ffunicode.c' % name)
+	return [int(v, 0) for v in re.findall(r'\b(?:0x[0-9A-Fa-f]+|\d+)\b', m.group(1))]
+
+
+def c_macro(src, name):
+	"""Returns the numbers in the initializer given by '#define name {...}'."""
+	m = re.search(r'#define %s\s*\{(.*?)\}' % name, src, re.S)
+	if not m:
+		sys.exit('mkcptbl: %s is not found in ff.c' % name)
+	return [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+', m.group(1))]
+
+
+def pair_map(tbl):
+	"""Code map of a sorted pair table as ff_uni2oem()/ff_oem2uni() find it."""
+	res = {}
+	for key in set(tbl[0::2]):
+		if key == 0:
+			continue
+		li, hi = 0, len(tbl) // 2 - 1
+		for n in range(16, 0, -1):	# Same search as ffunicode.c so that duplicated keys resolve the same
+			i = li + (hi - li) // 2
+			if key == tbl[i * 2]:
+				res[key] = tbl[i * 2 + 1]
+				break
+			if key > tbl[i * 2]:
+				li = i
+			else:
+				hi = i
+	return res
+
+
+def build_map(cmap, shift):
+	"""Encodes a code map into the two-level map with 2^shift code blocks."""
+	kmin, kmax = min(cmap), max(cmap)
+	bs = 1 << shift
+	idx, blk, dlt, seen = [], [], [], {}
+	for b in range(((kmax - kmin) >> shift) + 1):
+		vals = tuple(cmap.get(kmin + (b << shift) + i, 0) for i in range(bs))
+		if not any(vals):
+			idx.append(0)
+			continue
+		if vals not in seen:
+			base = min(v for v in vals if v)
+			if max(vals) - base < 0xFF:	# Delta block
+				seen[vals] = 0x8000 | (len(dlt) // (bs + 2) + 1)
+				dlt += [base & 0xFF, base >> 8] + [v - base if v else 0xFF for v in vals]
+			else:						# Full block
+				seen[vals] = len(blk) // bs + 1
+				blk += list(vals)
+		idx.append(seen[vals])
+	return {'kmin': kmin, 'kmax': kmax, 'shift': shift, 'idx': idx, 'blk': blk, 'dlt': dlt,
+			'size': len(idx) * 2 + len(blk) * 2 + len(dlt)}
+
+
+def best_map(cmap):
+	return min((build_map(cmap, s) for s in range(3, 9)), key=lambda m: m['size'])
+
+
+def rows(vals, fmt, per=16):
+	return ',\n'.join('\t' + ', '.join(fmt % v for v in vals[i:i + per]) for i in range(0, len(vals), per))
+
+
+def emit_map(out, name, m):
+	out.append('static const WORD %sidx[] = {\n%s\n};' % (name, rows(m['idx'], '0x%04X')))
+	if m['blk']:
+		out.append('static const WCHAR %sblk[] = {\n%s\n};' % (name, rows(m['blk'], '0x%04X')))
+	if m['dlt']:
+		out.append('static const BYTE %sdlt[] = {\n%s\n};' % (name, rows(m['dlt'], '0x%02X')))
+	return '{0x%04X, 0x%04X, %d, %sidx, %s, %s}' % (m['kmin'], m['kmax'], m['shift'], name,
+		name + 'blk' if m['blk'] else '0', name + 'dlt' if m['dlt'] else '0')
+
+
+def main(argv):
+	outfile = os.path.join(HERE, 'ffcptbl.h')
+	if len(argv) > 2 and argv[1] == '-o':
+		outfile, argv = argv[2], argv[2:]
+	try:
+		cps = sorted(set(int(a) for a in argv[1:]))
+	except ValueError:
+		cps = []
+	if not cps or any(cp not in SBCS + DBCS for cp in cps):
+		sys.exit('Usage: mkcptbl.py [-o <file>] <code page> ...\n  Code pages: %s' % ' '.join(str(cp) for cp in SBCS + DBCS))
+
+	uni = open(os.path.join(HERE, 'ffunicode.c')).read()
+	ffc = open(os.path.join(HERE, 'ff.c')).read()
+
+	report, tbls, ext, body = [], [], [], []
+	report.append('  CP     Built-in(mode 0)  Lookup u2o/o2u      Generated  Lookup u2o/o2u')
+	tot_old = tot_new = 0
+	for cp in cps:
+		if cp < 900:	# SBCS: OEM to Unicode stays a direct table, Unicode to OEM gets a map
+			sbc = c_array(uni, 'uc%d' % cp)
+			rev = {}
+			for i, u in enumerate(sbc):
+				rev.setdefault(u, 0x80 + i)		# Lowest OEM code wins as the linear search does
+			body.append('static const WCHAR cpt_sbc%d[] = {\n%s\n};' % (cp, rows(sbc, '0x%04X', 8)))
+			u2o = best_map(rev)
+			m = emit_map(body, 'cpt_u2o%d' % cp, u2o)
+			tbls.append('\t{%d, cpt_sbc%d, %s, {0}}' % (cp, cp, m))
+			ext.append(('Ct%d' % cp, c_macro(ffc, 'TBL_CT%d' % cp)))
+			old, new = len(sbc) * 2, len(sbc) * 2 + u2o['size']
+			cost = '%-9s %-9s' % ('<=128', '1')
+		else:			# DBCS: both directions get a map
+			u2o = best_map(pair_map(c_array(uni, 'uni2oem%d' % cp)))
+			o2u = best_map(pair_map(c_array(uni, 'oem2uni%d' % cp)))
+			m1 = emit_map(body, 'cpt_u2o%d' % cp, u2o)
+			m2 = emit_map(body, 'cpt_o2u%d' % cp, o2u)
+			tbls.append('\t{%d, 0, %s, %s}' % (cp, m1, m2))
+			ext.append(('Dc%d' % cp, c_macro(ffc, 'TBL_DC%d' % cp)))
+			old = (len(c_array(uni, 'uni2oem%d' % cp)) + len(c_array(uni, 'oem2uni%d' % cp))) * 2
+			new = u2o['size'] + o2u['size']
+			cost = '%-9s %-9s' % ('16', '16')
+		tot_old += old
+		tot_new += new
+		report.append('  %-6d %8.1fK          %s  %8.1fK  1         1' % (cp, old / 1024, cost, new / 1024))
+	report.append('  Total  %8.1fK                              %8.1fK' % (tot_old / 1024, tot_new / 1024))
+	all_old = sum(len(c_array(uni, 'uc%d' % cp)) * 2 + 128 for cp in SBCS)
+	all_old += sum((len(c_array(uni, 'uni2oem%d' % cp)) + len(c_array(uni, 'oem2uni%d' % cp))) * 2 + 10 for cp in DBCS)
+	report.append('  (FF_CODE_PAGE == 0 with built-in tables: %.1fK for all code pages)' % (all_old / 1024))
+	report.append('  (Lookup: number of table probes per character, 1: one map read)')
+
+	out = ['/*---------------------------------------------------------------------------/',
+		'/  Code conversion tables for FatFs - generated by mkcptbl.py, do not edit',
+		'/---------------------------------------------------------------------------/',
+		'/  Command: mkcptbl.py %s' % ' '.join(str(cp) for cp in cps), '/']
+	out += ['/' + r for r in report]
+	out += ['/---------------------------------------------------------------------------*/', '', '']
+	out.append('#ifdef FF_CPTBL_FFC\t/* Part for ff.c (FF_CODE_PAGE == 0) */')
+	for name, vals in ext:
+		out.append('static const BYTE %s[] = {\n%s\n};' % (name, rows(vals, '0x%02X')))
+	out.append('static const WORD CpCode[] = {%s, 0};' % ', '.join(str(cp) for cp in cps))
+	out.append('static const BYTE* const CpExt[] = {%s, 0};' % ', '.join(n for n, v in ext))
+	out.append('')
+	out.append('#else\t\t\t\t\t/* Part for ffunicode.c */')
+	out += ['#define FF_CPTBL_%d\t1' % cp for cp in cps]
+	out += body
+	out.append('static const CPTBL CpTbl[] = {\n%s,\n\t{0}\n};' % ',\n'.join(tbls))
+	out.append('')
+	out.append('#endif')
+	open(outfile, 'w').write('\n'.join(out) + '\n')
+
+	print('\n'.join(report))
+	print('Written %s' % outfile)
+
+
+if __name__ == '__main__':
+	main(sys.argv)
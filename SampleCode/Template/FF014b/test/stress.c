@@ -0,0 +1,299 @@
+/*----------------------------------------------------------------------------/
+/  Stress test of the re-entrant configuration with POSIX threads (host)
+/-----------------------------------------------------------------------------/
+/  Each thread writes a file, reads it back and checks the data repeatedly for
+/  a period, and the total throughput is reported for 1, 2, 4 and 8 threads.
+/  The threads first share a volume and then work on their own volumes, so that
+/  the serialization by the volume grant and the scaling across the volumes can
+/  be compared. A probe thread looks up a file on volume 0 meanwhile, and the
+/  longest time it waited for the grant is reported as well (see FF_SYNC_SLICE).
+/  The RAM disks take DISK_CMD_US + DISK_SECT_US per sector for each command to
+/  emulate the device transfer.
+/
+/  Usage: make run [SLICE=n]   or   obj/stress [period_ms]
+/----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "ff.h"
+#include "diskio.h"
+
+#define DISK_SECT		32768	/* Size of each RAM disk [sector] */
+#define DISK_CMD_US		50		/* Latency of a disk command [us] */
+#define DISK_SECT_US	20		/* Transfer time of a sector [us] */
+#define FILE_SIZE		(512UL * 1024)	/* Size of the file of each thread */
+#define XFER_SIZE		32768	/* Size of a read/write call */
+#define MAX_THREAD		8
+
+#if !FF_FS_REENTRANT || FF_VOLUMES < 2
+#error Build with the re-entrant configuration and two or more volumes (see Makefile)
+#endif
+
+
+static BYTE *Disk[FF_VOLUMES];		/* RAM disks */
+static FATFS Fatfs[FF_VOLUMES];
+static int Stop;					/* Request to stop the threads (accessed with __atomic) */
+static int Fails;
+static unsigned long Bytes[MAX_THREAD];
+static double MaxWait;
+static pthread_mutex_t LogLock = PTHREAD_MUTEX_INITIALIZER;
+
+
+
+/*-----------------------------------------------------------------------*/
+/* RAM disk with the device latency                                      */
+/*-----------------------------------------------------------------------*/
+
+static double now_ms (void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+
+static void disk_wait (UINT count)
+{
+	struct timespec ts;
+	long us = DISK_CMD_US + DISK_SECT_US * (long)count;
+
+	ts.tv_sec = us / 1000000; ts.tv_nsec = us % 1000000 * 1000;
+	nanosleep(&ts, 0);
+}
+
+
+DSTATUS disk_initialize (BYTE pdrv)
+{
+	if (pdrv >= FF_VOLUMES) return STA_NOINIT;
+	if (!Disk[pdrv]) Disk[pdrv] = calloc(DISK_SECT, FF_MAX_SS);
+	return Disk[pdrv] ? 0 : STA_NOINIT;
+}
+
+
+DSTATUS disk_status (BYTE pdrv)
+{
+	return (pdrv < FF_VOLUMES && Disk[pdrv]) ? 0 : STA_NOINIT;
+}
+
+
+DRESULT disk_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count)
+{
+	if (disk_status(pdrv) || sector + count > DISK_SECT) return RES_PARERR;
+	disk_wait(count);
+	memcpy(buff, Disk[pdrv] + sector * FF_MAX_SS, count * FF_MAX_SS);
+	return RES_OK;
+}
+
+
+DRESULT disk_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count)
+{
+	if (disk_status(pdrv) || sector + count > DISK_SECT) return RES_PARERR;
+	disk_wait(count);
+	memcpy(Disk[pdrv] + sector * FF_MAX_SS, buff, count * FF_MAX_SS);
+	return RES_OK;
+}
+
+
+DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff)
+{
+	if (disk_status(pdrv)) return RES_NOTRDY;
+	switch (cmd) {
+	case CTRL_SYNC :
+		return RES_OK;
+	case GET_SECTOR_COUNT :
+		*(LBA_t*)buff = DISK_SECT;
+		return RES_OK;
+	case GET_SECTOR_SIZE :
+		*(WORD*)buff = FF_MAX_SS;
+		return RES_OK;
+	case GET_BLOCK_SIZE :
+		*(DWORD*)buff = 128;
+		return RES_OK;
+	}
+	return RES_PARERR;
+}
+
+
+DWORD get_fattime (void)
+{
+	return (DWORD)(2024 - 1980) << 25 | (DWORD)1 << 21 | (DWORD)1 << 16;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Test threads                                                          */
+/*-----------------------------------------------------------------------*/
+
+#define STOPPED()	__atomic_load_n(&Stop, __ATOMIC_RELAXED)
+#define SET_STOP(v)	__atomic_store_n(&Stop, (v), __ATOMIC_RELAXED)
+
+static void fail (const char* what, int id, FRESULT res)
+{
+	pthread_mutex_lock(&LogLock);
+	if (Fails++ < 10) printf("FAIL: %s (thread %d, res %d)\n", what, id, (int)res);
+	pthread_mutex_unlock(&LogLock);
+	SET_STOP(1);
+}
+
+
+static BYTE pattern (int id, unsigned long ofs)
+{
+	return (BYTE)(id * 53 + ofs * 11 + (ofs >> 9));
+}
+
+
+typedef struct {
+	int id;			/* Thread number */
+	int vol;		/* Volume to work on */
+} WORKER;
+
+
+static void* worker (void* arg)
+{
+	const WORKER *wk = arg;
+	static __thread BYTE buf[XFER_SIZE];
+	char path[16];
+	FIL fil;
+	FRESULT res;
+	UINT n, i;
+	unsigned long ofs;
+
+
+	sprintf(path, "%d:t%d.bin", wk->vol, wk->id);
+	while (!STOPPED()) {
+		res = f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS);
+		if (res != FR_OK) { fail("open to write", wk->id, res); break; }
+		for (ofs = 0; ofs < FILE_SIZE && res == FR_OK; ofs += n) {
+			for (i = 0; i < XFER_SIZE; i++) buf[i] = pattern(wk->id, ofs + i);
+			res = f_write(&fil, buf, XFER_SIZE, &n);
+			if (res == FR_OK && n != XFER_SIZE) res = FR_DENIED;
+		}
+		if (res == FR_OK) res = f_close(&fil);
+		if (res != FR_OK) { fail("write", wk->id, res); break; }
+		Bytes[wk->id] += FILE_SIZE;
+
+		res = f_open(&fil, path, FA_READ);
+		if (res != FR_OK) { fail("open to read", wk->id, res); break; }
+		for (ofs = 0; ofs < FILE_SIZE && res == FR_OK; ofs += n) {
+			res = f_read(&fil, buf, XFER_SIZE, &n);
+			if (res == FR_OK && n != XFER_SIZE) res = FR_DENIED;
+			for (i = 0; res == FR_OK && i < n; i++) {
+				if (buf[i] != pattern(wk->id, ofs + i)) res = FR_INT_ERR;
+			}
+		}
+		f_close(&fil);
+		if (res != FR_OK) { fail("read back", wk->id, res); break; }
+		Bytes[wk->id] += FILE_SIZE;
+	}
+	return 0;
+}
+
+
+static void* probe (void* arg)
+{
+	FILINFO fno;
+	FRESULT res;
+	double t;
+	struct timespec ts = {0, 1000000};
+
+
+	(void)arg;
+	while (!STOPPED()) {
+		t = now_ms();
+		res = f_stat("0:t0.bin", &fno);
+		t = now_ms() - t;
+		if (res != FR_OK && res != FR_NO_FILE) fail("stat", -1, res);
+		if (t > MaxWait) MaxWait = t;
+		nanosleep(&ts, 0);
+	}
+	return 0;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Main                                                                  */
+/*-----------------------------------------------------------------------*/
+
+static double run (int nthread, int nvol, int period)
+{
+	pthread_t th[MAX_THREAD], pt;
+	WORKER wk[MAX_THREAD];
+	unsigned long total = 0;
+	double t;
+	int i;
+
+
+	SET_STOP(0); MaxWait = 0;
+	for (i = 0; i < nthread; i++) {
+		wk[i].id = i; wk[i].vol = i % nvol;
+		Bytes[i] = 0;
+	}
+	t = now_ms();
+	for (i = 0; i < nthread; i++) pthread_create(&th[i], 0, worker, &wk[i]);
+	pthread_create(&pt, 0, probe, 0);
+	while (!STOPPED() && now_ms() - t < period) {
+		struct timespec ts = {0, 10000000};
+		nanosleep(&ts, 0);
+	}
+	SET_STOP(1);
+	for (i = 0; i < nthread; i++) pthread_join(th[i], 0);
+	pthread_join(pt, 0);
+	t = now_ms() - t;
+	for (i = 0; i < nthread; i++) total += Bytes[i];
+	return total / 1024.0 / 1024.0 / (t / 1000.0);
+}
+
+
+int main (int argc, char* argv[])
+{
+	static BYTE work[FF_MAX_SS * 8];
+	static const int nthread[] = {1, 2, 4, 8};
+	MKFS_PARM opt = {FM_ANY | FM_SFD, 0, 0, 0, 0};
+	int period = (argc > 1) ? atoi(argv[1]) : 1000;
+	int vol, mode, i, nvol;
+	double mbs, base = 0;
+	char path[4];
+	FRESULT res;
+
+
+	for (vol = 0; vol < FF_VOLUMES; vol++) {
+		sprintf(path, "%d:", vol);
+		res = f_mkfs(path, &opt, work, sizeof work);
+		if (res == FR_OK) res = f_mount(&Fatfs[vol], path, 1);
+		if (res != FR_OK) {
+			printf("Failed to create volume %d (res %d)\n", vol, (int)res);
+			return 1;
+		}
+	}
+
+	printf("FF_SYNC_SLICE %d, %d volumes, %d ms per run\n", FF_SYNC_SLICE, FF_VOLUMES, period);
+	printf("threads  volumes     MB/s  scaling  max stat wait [ms]\n");
+	for (mode = 0; mode < 2 && !Fails; mode++) {
+		for (i = 0; i < (int)(sizeof nthread / sizeof nthread[0]) && !Fails; i++) {
+			nvol = mode ? (nthread[i] < FF_VOLUMES ? nthread[i] : FF_VOLUMES) : 1;
+			mbs = run(nthread[i], nvol, period);
+			if (i == 0) base = mbs;
+			printf("%7d  %7d  %7.2f  %6.2fx  %18.2f\n", nthread[i], nvol, mbs, mbs / base, MaxWait);
+		}
+	}
+
+	for (vol = 0; vol < FF_VOLUMES; vol++) {	/* Check the volumes after the test */
+		DWORD nclst;
+		FATFS *fs;
+
+		sprintf(path, "%d:", vol);
+		f_mount(0, path, 0);
+		res = f_mount(&Fatfs[vol], path, 1);
+		if (res == FR_OK) res = f_getfree(path, &nclst, &fs);
+		if (res != FR_OK) fail("remount", vol, res);
+		f_mount(0, path, 0);
+	}
+	printf("%s (%d failures)\n", Fails ? "FAILED" : "PASSED", Fails);
+	return Fails ? 1 : 0;
+}
@@ -0,0 +1,199 @@
+/****************************************************************************//**
+ * @file    fsnap.c
+ * @brief
+ *          FatFs mount snapshot store in the on-chip data flash (FF_FS_SNAPSHOT)
+ *
+ *          The snapshot is kept in the last flash page, which needs the data
+ *          flash to be enabled (CONFIG0 DFEN = 0) with DFBA at or below it.
+ *          The page is a log of fixed size records. A new record is written
+ *          in the next erased slot with its tag programmed last, so a record
+ *          torn by a reset is never taken. A record is discarded by programming
+ *          its drop word, so the page is erased only when the log is full.
+ *          The page is read with ISP commands so the flash cache is bypassed.
+ * @note
+ * Copyright (C) 2013 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "NuMicro.h"
+#include "ff.h"
+
+#if FF_FS_SNAPSHOT
+
+/****************************************************************************/
+/* Define                                                                   */
+/****************************************************************************/
+
+#define SNAP_PAGE       (FMC_APROM_END - FMC_FLASH_PAGE_SIZE)
+#define SNAP_TAG        0x50414E53UL                        // "SNAP"
+#define SNAP_HDR        3                                   // Words of tag, drop and checksum
+#define SNAP_DATA       ((sizeof(FFSNAP) + 3) / 4)          // Words of the snapshot
+#define SNAP_SLOT       ((SNAP_HDR + SNAP_DATA + 1) & ~1UL) // Words of a record, 8-byte aligned
+#define SNAP_NSLOT      (FMC_FLASH_PAGE_SIZE / 4 / SNAP_SLOT)
+
+#define SNAP_ADDR(i)    (SNAP_PAGE + (i) * SNAP_SLOT * 4)   // Address of a record slot
+#define SNAP_ERASED     0xFFFFFFFFUL
+
+/****************************************************************************/
+/* Functions                                                                */
+/****************************************************************************/
+
+static uint32_t Snap_Sum(const uint32_t *pu32Data)
+{
+    uint32_t i, u32Sum = 0;
+
+    for (i = 0; i < SNAP_DATA; i++)
+        u32Sum = ((u32Sum << 1) | (u32Sum >> 31)) + pu32Data[i];
+
+    return ~u32Sum;
+}
+
+static int Snap_IsErased(uint32_t u32Slot)
+{
+    uint32_t i;
+
+    for (i = 0; i < SNAP_SLOT; i++)
+    {
+        if (FMC_Read(SNAP_ADDR(u32Slot) + i * 4) != SNAP_ERASED)
+            return 0;
+    }
+
+    return 1;
+}
+
+// Returns the slot of the live record or SNAP_NSLOT, *pu32Free gets the first erased slot
+static uint32_t Snap_Find(uint32_t *pu32Free)
+{
+    uint32_t i, u32Live = SNAP_NSLOT;
+
+    for (i = 0; i < SNAP_NSLOT && !Snap_IsErased(i); i++)
+    {
+        if (FMC_Read(SNAP_ADDR(i)) == SNAP_TAG)         // Records before the first erased slot, the last one wins
+            u32Live = i;
+    }
+
+    *pu32Free = i;
+
+    if (u32Live < SNAP_NSLOT && FMC_Read(SNAP_ADDR(u32Live) + 4) != SNAP_ERASED)
+        u32Live = SNAP_NSLOT;                       // Discarded
+
+    return u32Live;
+}
+
+static int Snap_Open(uint32_t *pu32Locked)
+{
+    uint32_t au32Config[2];
+
+    *pu32Locked = SYS_IsRegLocked();
+
+    if (*pu32Locked)
+        SYS_UnlockReg();
+
+    FMC_Open();
+
+    if (FMC_ReadConfig(au32Config, 2) == 0 && !(au32Config[0] & 0x1) && FMC->DFBA <= SNAP_PAGE)
+        return 1;                                   // Data flash is enabled and covers the snapshot page
+
+    FMC_Close();
+
+    if (*pu32Locked)
+        SYS_LockReg();
+
+    return 0;
+}
+
+static void Snap_Close(uint32_t u32Locked)
+{
+    FMC_Close();
+
+    if (u32Locked)
+        SYS_LockReg();
+}
+
+/*-----------------------------------------------------------------------*/
+/* Load the mount snapshot of the drive (1:Loaded, 0:Not available)      */
+/*-----------------------------------------------------------------------*/
+
+int ff_snap_load(BYTE pdrv, FFSNAP *snap)
+{
+    uint32_t au32Data[SNAP_DATA];
+    uint32_t i, u32Slot, u32Free, u32Locked;
+    int ret = 0;
+
+    if (pdrv != 0 || !Snap_Open(&u32Locked))
+        return 0;
+
+    u32Slot = Snap_Find(&u32Free);
+
+    if (u32Slot < SNAP_NSLOT)
+    {
+        for (i = 0; i < SNAP_DATA; i++)
+            au32Data[i] = FMC_Read(SNAP_ADDR(u32Slot) + (SNAP_HDR + i) * 4);
+
+        if (FMC_Read(SNAP_ADDR(u32Slot) + 8) == Snap_Sum(au32Data))
+        {
+            memcpy(snap, au32Data, sizeof(FFSNAP));
+            ret = 1;
+        }
+    }
+
+    Snap_Close(u32Locked);
+
+    return ret;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Save the mount snapshot of the drive, or discard it if snap is NULL   */
+/*-----------------------------------------------------------------------*/
+
+int ff_snap_save(BYTE pdrv, const FFSNAP *snap)
+{
+    uint32_t au32Data[SNAP_DATA];
+    uint32_t i, u32Slot, u32Free, u32Addr, u32Locked;
+    int ret = 0;
+
+    if (pdrv != 0 || !Snap_Open(&u32Locked))
+        return 0;
+
+    u32Slot = Snap_Find(&u32Free);
+
+    if (u32Slot < SNAP_NSLOT)                       // Discard the live record
+        FMC_Write(SNAP_ADDR(u32Slot) + 4, 0);
+
+    if (snap)
+    {
+        memset(au32Data, 0, sizeof(au32Data));
+        memcpy(au32Data, snap, sizeof(FFSNAP));
+
+        if (u32Free >= SNAP_NSLOT)                  // Log is full
+        {
+            FMC_Erase(SNAP_PAGE);
+            u32Free = 0;
+        }
+
+        if (Snap_IsErased(u32Free))
+        {
+            u32Addr = SNAP_ADDR(u32Free);
+            ret = 1;
+
+            for (i = 0; i < SNAP_DATA && ret; i++)
+                ret = FMC_Write(u32Addr + (SNAP_HDR + i) * 4, au32Data[i]) == 0;
+
+            if (ret)
+                ret = FMC_Write(u32Addr + 8, Snap_Sum(au32Data)) == 0;
+
+            if (ret)
+                ret = FMC_Write(u32Addr, SNAP_TAG) == 0;   // Tag last, the record is valid from here
+        }
+    }
+    else
+    {
+        ret = 1;
+    }
+
+    Snap_Close(u32Locked);
+
+    return ret;
+}
+
+#endif
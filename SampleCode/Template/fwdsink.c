@@ -0,0 +1,114 @@
+/****************************************************************************//**
+ * @file    fwdsink.c
+ * @brief
+ *          f_forwards() data sinks for UART, EMAC and USB CDC
+ *
+ *          The file data is never copied into an application buffer.
+ *          UART and USB CDC take it in place from the FatFs cache window,
+ *          EMAC lends its TX buffer and the sectors are read right into it.
+ * @note
+ * Copyright (C) 2013 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "NuMicro.h"
+#include "project_config.h"
+#include "fwdsink.h"
+
+/****************************************************************************/
+/* UART sink                                                                */
+/****************************************************************************/
+
+static UINT FwdUart_Put(const FFSINK *sk, const BYTE *buf, UINT len)
+{
+    UINT n;
+
+    (void)sk;
+
+    if (len == 0)                                   // Sense call: ready when the TX FIFO has room
+        return !UART_IS_TX_FULL(FWD_UART);
+
+    for (n = 0; n < len && !UART_IS_TX_FULL(FWD_UART); n++)
+        FWD_UART->DAT = buf[n];                     // Only what fits in the FIFO, the rest on the next call
+
+    return n;
+}
+
+const FFSINK FwdSinkUart = {FwdUart_Put, 0, 0, 0};
+
+/****************************************************************************/
+/* EMAC sink                                                                */
+/****************************************************************************/
+
+#if (_fwd_sink_EMAC_ == 1)
+
+FWD_ETH_T FwdEthAddr;
+
+static BYTE *FwdEmac_Claim(const FFSINK *sk, UINT *len)
+{
+    const FWD_ETH_T *addr = (const FWD_ETH_T *)sk->ctx;
+    uint8_t *frame;
+
+    frame = EMAC_ClaimFreeTXBuf();
+    if (frame == NULL)                              // All TX descriptors are owned by EMAC
+        return NULL;
+
+    memcpy(frame, addr->au8Dst, 6);
+    memcpy(frame + 6, addr->au8Src, 6);
+    frame[12] = HIBYTE(FWD_ETH_TYPE);
+    frame[13] = LOBYTE(FWD_ETH_TYPE);
+
+    if (*len > FWD_ETH_DATA)
+        *len = FWD_ETH_DATA;
+
+    return frame + FWD_ETH_HDR;                     // f_read() fills the payload
+}
+
+static int FwdEmac_Commit(const FFSINK *sk, BYTE *buf, UINT len)
+{
+    UINT size = FWD_ETH_HDR + len;
+
+    (void)sk;
+
+    if (size < 60)                                  // Pad the last short frame
+    {
+        memset(buf + len, 0, 60 - size);
+        size = 60;
+    }
+
+    return EMAC_SendPktWoCopy(size) != 0;
+}
+
+const FFSINK FwdSinkEmac = {0, FwdEmac_Claim, FwdEmac_Commit, &FwdEthAddr};
+
+#endif
+
+/****************************************************************************/
+/* USB CDC sink                                                             */
+/****************************************************************************/
+
+#if (_fwd_sink_USBD_ == 1)
+
+volatile uint8_t g_u8FwdCdcReady = 1;
+
+static UINT FwdCdc_Put(const FFSINK *sk, const BYTE *buf, UINT len)
+{
+    (void)sk;
+
+    if (len == 0)                                   // Sense call: ready when the last packet is gone
+        return g_u8FwdCdcReady;
+
+    if (len > FWD_CDC_MAXPKT)
+        len = FWD_CDC_MAXPKT;
+
+    g_u8FwdCdcReady = 0;
+    /* The endpoint SRAM is the only buffer the USB device can send from */
+    USBD_MemCopy((uint8_t *)(USBD_BUF_BASE + USBD_GET_EP_BUF_ADDR(FWD_CDC_EP)), (uint8_t *)buf, len);
+    USBD_SET_PAYLOAD_LEN(FWD_CDC_EP, len);
+
+    return len;
+}
+
+const FFSINK FwdSinkCdc = {FwdCdc_Put, 0, 0, 0};
+
+#endif
@@ -0,0 +1,48 @@
+/****************************************************************************//**
+ * @file    fwdsink.h
+ * @brief
+ *          f_forwards() data sinks for UART, EMAC and USB CDC
+ * @note
+ * Copyright (C) 2013 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#ifndef __FWDSINK_H__
+#define __FWDSINK_H__
+
+#include "ff.h"
+
+/****************************************************************************/
+/* Define                                                                   */
+/****************************************************************************/
+
+#define FWD_UART            UART0       // Same port as DEBUG_PORT in retarget.c
+
+#define FWD_ETH_TYPE        0x88B5      // EtherType of file data frames (local experimental)
+#define FWD_ETH_HDR         14
+#define FWD_ETH_DATA        1024        // File data per frame, whole sectors keep f_read() off the cache
+
+#define FWD_CDC_EP          EP2         // Bulk IN endpoint of the CDC data interface
+#define FWD_CDC_MAXPKT      64
+
+/****************************************************************************/
+/* Type                                                                     */
+/****************************************************************************/
+
+typedef struct
+{
+    uint8_t au8Dst[6];                  // Destination MAC address
+    uint8_t au8Src[6];                  // Source MAC address
+} FWD_ETH_T;
+
+/****************************************************************************/
+/* Global variables                                                         */
+/****************************************************************************/
+
+extern const FFSINK FwdSinkUart;
+
+extern FWD_ETH_T FwdEthAddr;                // EMAC sink, _fwd_sink_EMAC_ in project_config.h
+extern const FFSINK FwdSinkEmac;
+
+extern volatile uint8_t g_u8FwdCdcReady;    // USB CDC sink, _fwd_sink_USBD_ in project_config.h
+extern const FFSINK FwdSinkCdc;             // g_u8FwdCdcReady is set to 1 by the bulk IN handler
+
+#endif
@@ -7,6 +7,7 @@
 
 #include "diskio.h"
 #include "ff.h"
+#include "fwdsink.h"
 
 /*_____ D E C L A R A T I O N S ____________________________________________*/
 
@@ -296,6 +297,13 @@ void SD_FATFS_Demo(void)
 		 /* Read something from file pointer */
 		 f_read(&file, g_buff, f_size(&file), &count);
 		 printf("Read data from file test.txt : \n[%s]\n", g_buff);
+		 /* Send the file to UART straight from the file buffer */
+		 f_lseek(&file, 0);
+		 printf("Forward file test.txt to UART : \n[");
+		 do {
+			 res = f_forwards(&file, &FwdSinkUart, (UINT)(f_size(&file) - f_tell(&file)), &count);
+		 } while (res == FR_OK && !f_eof(&file));
+		 printf("]\n");
 		 /* Close file */
 		 f_close(&file);
 	 }
@@ -303,6 +311,17 @@ void SD_FATFS_Demo(void)
 		 printf("Open file fail. Return %d\n", res);    
 
 
+	#if FF_USE_LFN == 3 && FF_MEMPOOL
+	{
+		FFMEMSTAT st;
+		UINT cls;
+
+		/* Memory pool usage of FatFs working buffers */
+		for (cls = 0; ff_memstat(cls, &st); cls++)
+			printf("Pool %u : %u x %u bytes, peak %u, fail %u\n", cls, st.nblk, st.bsize, st.peak, st.fail);
+	}
+	#endif
+
 	printf("%s finish\r\n",__FUNCTION__);
 
 }
@@ -16,6 +16,8 @@ typedef enum{
 
 /*_____ D E F I N I T I O N S ______________________________________________*/
 #define _debug_log_UART_					(1)
+#define _fwd_sink_EMAC_						(0)		// 1: build EMAC f_forwards() sink (add emac.c to project)
+#define _fwd_sink_USBD_						(0)		// 1: build USB CDC f_forwards() sink (add usbd.c to project)
 
 
 /*_____ M A C R O S ________________________________________________________*/
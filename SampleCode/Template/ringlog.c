@@ -0,0 +1,398 @@
+/****************************************************************************//**
+ * @file    ringlog.c
+ * @brief
+ *          Ring log over a preallocated contiguous FatFs file
+ *
+ *          The file is created once with f_expand() as one contiguous block.
+ *          From then on the records are written straight to its sectors
+ *          with multi-block disk_write() and FatFs never updates the FAT or
+ *          the directory for it. The first sector of the file is the ring
+ *          header. Each of the other sectors starts with a header that holds
+ *          the sequence number of the sector, the record length, the index
+ *          of the sector in the record and a checksum seeded by the ring
+ *          epoch, so sectors left from an older ring or torn by a reset are
+ *          never taken. The sequence number of a sector modulo the ring size
+ *          is its position, so the write head is found by a binary search
+ *          over the ring when it is opened. It is 64-bit and never wraps.
+ *
+ *          A record is written from a buffer of RLOG_BUFSIZE(len) bytes that
+ *          has the first RLOG_HDR bytes of each sector free for the header,
+ *          RLOG_PTR() points to the record data in it. No data is copied.
+ * @note
+ * Copyright (C) 2013 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <string.h>
+#include "NuMicro.h"
+#include "diskio.h"
+#include "ringlog.h"
+
+#if !FF_USE_EXPAND || FF_FS_READONLY
+#error ringlog.c needs f_expand() (FF_USE_EXPAND = 1)
+#endif
+#if FF_MAX_SS != FF_MIN_SS
+#error ringlog.c needs a fixed sector size
+#endif
+
+/****************************************************************************/
+/* Define                                                                   */
+/****************************************************************************/
+
+#define RLOG_TAG            0x474F4C52UL                // "RLOG"
+
+/****************************************************************************/
+/* Functions                                                                */
+/****************************************************************************/
+
+static DWORD RLog_Get32(const BYTE *p)
+{
+    return (DWORD)p[0] | (DWORD)p[1] << 8 | (DWORD)p[2] << 16 | (DWORD)p[3] << 24;
+}
+
+static void RLog_Put32(BYTE *p, DWORD u32Val)
+{
+    p[0] = (BYTE)u32Val;
+    p[1] = (BYTE)(u32Val >> 8);
+    p[2] = (BYTE)(u32Val >> 16);
+    p[3] = (BYTE)(u32Val >> 24);
+}
+
+// Checksum of a sector but its checksum word at offset 12 (the high word of the sequence number follows it)
+static DWORD RLog_Sum(const BYTE *pu8Sect, DWORD u32Seed)
+{
+    DWORD i, u32Sum = u32Seed;
+
+    for (i = 0; i < RLOG_SS; i += 4)
+    {
+        if (i != 12)
+            u32Sum = ((u32Sum << 1) | (u32Sum >> 31)) + RLog_Get32(pu8Sect + i);
+    }
+
+    return ~u32Sum;
+}
+
+static uint64_t RLog_GetSeq(const BYTE *pu8Sect)
+{
+    return (uint64_t)RLog_Get32(pu8Sect + 16) << 32 | RLog_Get32(pu8Sect);
+}
+
+// Checks the sector read for sequence number u64Seq, returns its index in the record or -1
+static int32_t RLog_Check(const RLOG_T *psLog, const BYTE *pu8Sect, uint64_t u64Seq)
+{
+    if (RLog_GetSeq(pu8Sect) != u64Seq || RLog_Get32(pu8Sect + 12) != RLog_Sum(pu8Sect, psLog->u32Epoch))
+        return -1;
+
+    return (int32_t)(pu8Sect[8] | pu8Sect[9] << 8);
+}
+
+// Reads or writes u32Cnt ring sectors from sequence number u64Seq, split at the end of the ring
+static FRESULT RLog_Xfer(RLOG_T *psLog, BYTE *pu8Buf, uint64_t u64Seq, DWORD u32Cnt, int i32Write)
+{
+    DWORD u32Pos = (DWORD)(u64Seq % psLog->u32Num), n;
+    DRESULT dr = RES_OK;
+
+    while (u32Cnt > 0 && dr == RES_OK)
+    {
+        n = psLog->u32Num - u32Pos;
+
+        if (n > u32Cnt)
+            n = u32Cnt;
+
+        if (i32Write)
+            dr = disk_write(psLog->u8Drv, pu8Buf, psLog->u32Base + 1 + u32Pos, (UINT)n);
+        else
+            dr = disk_read(psLog->u8Drv, pu8Buf, psLog->u32Base + 1 + u32Pos, (UINT)n);
+
+        pu8Buf += n * RLOG_SS;
+        u32Cnt -= n;
+        u32Pos = 0;
+    }
+
+    return (dr == RES_OK) ? FR_OK : FR_DISK_ERR;
+}
+
+// Reads the ring sector at u32Pos, *pu64Lap gets its lap + 1 or 0 if it is not valid
+static FRESULT RLog_Probe(RLOG_T *psLog, DWORD u32Pos, uint64_t *pu64Lap)
+{
+    FRESULT res;
+    uint64_t u64Seq;
+
+    res = RLog_Xfer(psLog, psLog->au8Sect, u32Pos, 1, 0);
+    u64Seq = RLog_GetSeq(psLog->au8Sect);
+    *pu64Lap = 0;
+
+    if (res == FR_OK && u64Seq % psLog->u32Num == u32Pos && RLog_Check(psLog, psLog->au8Sect, u64Seq) >= 0)
+        *pu64Lap = u64Seq / psLog->u32Num + 1;
+
+    return res;
+}
+
+// Finds the write head: the laps of the ring sectors never increase from the start of the ring
+static FRESULT RLog_Recover(RLOG_T *psLog)
+{
+    FRESULT res;
+    uint64_t u64Lap0, u64Lap;
+    DWORD lo, hi, mid;
+
+    res = RLog_Probe(psLog, 0, &u64Lap0);
+
+    if (res == FR_OK && u64Lap0 == 0)               // Empty, or the head has just wrapped and the write was torn
+    {
+        res = RLog_Probe(psLog, psLog->u32Num - 1, &u64Lap);
+        psLog->u64Seq = u64Lap * psLog->u32Num;
+        return res;
+    }
+
+    lo = 0;
+    hi = psLog->u32Num;
+
+    while (res == FR_OK && hi - lo > 1)
+    {
+        mid = lo + (hi - lo) / 2;
+        res = RLog_Probe(psLog, mid, &u64Lap);
+
+        if (u64Lap == u64Lap0)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    psLog->u64Seq = (u64Lap0 - 1) * psLog->u32Num + lo + 1;
+
+    return res;
+}
+
+// Gets the location of the file on the drive, and checks that it is contiguous if i32Check
+static FRESULT RLog_Map(RLOG_T *psLog, FIL *fp, int i32Check)
+{
+    FATFS *fs = fp->obj.fs;
+    DWORD cb = (DWORD)fs->csize * RLOG_SS;
+    DWORD i, ncl = (DWORD)((f_size(fp) + cb - 1) / cb);
+    FRESULT res = FR_OK;
+
+    if (fp->obj.sclust < 2)
+        return FR_INVALID_OBJECT;
+
+#if FF_FS_EXFAT
+    if (fp->obj.stat == 2)                          // Contiguous chain without FAT
+        i32Check = 0;
+
+#endif
+    for (i = 1; i32Check && i < ncl && res == FR_OK; i++)
+    {
+        res = f_lseek(fp, (FSIZE_t)i * cb + 1);     // Gets the cluster holding offset i * cb
+
+        if (res == FR_OK && fp->clust != fp->obj.sclust + i)
+            res = FR_DENIED;
+    }
+
+    psLog->u8Drv = fs->pdrv;
+    psLog->u32Base = fs->database + (LBA_t)fs->csize * (fp->obj.sclust - 2);
+
+    return res;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Create a ring log file of u32Size bytes                               */
+/*-----------------------------------------------------------------------*/
+
+FRESULT RLog_Create(RLOG_T *psLog, const TCHAR *path, DWORD u32Size)
+{
+    FRESULT res, res2;
+    FIL fil;
+    DWORD n = u32Size / RLOG_SS;
+
+    if (n < 3)
+        return FR_INVALID_PARAMETER;
+
+    res = f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS);
+
+    if (res != FR_OK)
+        return res;
+
+    res = f_expand(&fil, (FSIZE_t)n * RLOG_SS, 1);  // Contiguous block, FR_DENIED if the volume has none
+
+    if (res == FR_OK)
+        res = RLog_Map(psLog, &fil, 0);
+
+    if (res == FR_OK && disk_read(psLog->u8Drv, psLog->au8Sect, psLog->u32Base, 1) != RES_OK)
+        res = FR_DISK_ERR;
+
+    if (res == FR_OK)
+    {
+        // A ring recreated on the same block gets the next epoch, its old sectors do not pass the checksum
+        if (RLog_Get32(psLog->au8Sect) == RLOG_TAG && RLog_Get32(psLog->au8Sect + 12) == RLog_Sum(psLog->au8Sect, 0))
+            psLog->u32Epoch = RLog_Get32(psLog->au8Sect + 4) + 1;
+        else
+            psLog->u32Epoch = get_fattime() ^ (DWORD)psLog->u32Base;
+
+        psLog->u32Num = n - 1;
+        memset(psLog->au8Sect, 0, RLOG_SS);
+        RLog_Put32(psLog->au8Sect, RLOG_TAG);
+        RLog_Put32(psLog->au8Sect + 4, psLog->u32Epoch);
+        RLog_Put32(psLog->au8Sect + 8, psLog->u32Num);
+        RLog_Put32(psLog->au8Sect + 12, RLog_Sum(psLog->au8Sect, 0));
+
+        if (disk_write(psLog->u8Drv, psLog->au8Sect, psLog->u32Base, 1) != RES_OK)
+            res = FR_DISK_ERR;
+    }
+
+    res2 = f_close(&fil);                           // The last FAT and directory update of the file
+
+    if (res == FR_OK)
+        res = res2;
+
+    psLog->u64Seq = psLog->u64Rd = 0;
+
+    return res;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Open a ring log file and find its write head                          */
+/*-----------------------------------------------------------------------*/
+
+FRESULT RLog_Open(RLOG_T *psLog, const TCHAR *path)
+{
+    FRESULT res;
+    FIL fil;
+
+    res = f_open(&fil, path, FA_READ);
+
+    if (res != FR_OK)
+        return res;
+
+    res = RLog_Map(psLog, &fil, 1);
+
+    if (res == FR_OK && disk_read(psLog->u8Drv, psLog->au8Sect, psLog->u32Base, 1) != RES_OK)
+        res = FR_DISK_ERR;
+
+    if (res == FR_OK)
+    {
+        psLog->u32Epoch = RLog_Get32(psLog->au8Sect + 4);
+        psLog->u32Num = RLog_Get32(psLog->au8Sect + 8);
+
+        if (RLog_Get32(psLog->au8Sect) != RLOG_TAG || RLog_Get32(psLog->au8Sect + 12) != RLog_Sum(psLog->au8Sect, 0) ||
+                psLog->u32Num < 2 || (FSIZE_t)(psLog->u32Num + 1) * RLOG_SS > f_size(&fil))
+            res = FR_NO_FILESYSTEM;                 // Not a ring log file
+    }
+
+    f_close(&fil);
+
+    if (res == FR_OK)
+        res = RLog_Recover(psLog);
+
+    RLog_Rewind(psLog);
+
+    return res;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Write a record of u32Len bytes laid out in the buffer by RLOG_PTR()   */
+/*-----------------------------------------------------------------------*/
+
+FRESULT RLog_Write(RLOG_T *psLog, BYTE *pu8Buf, UINT u32Len)
+{
+    FRESULT res;
+    DWORD i, n = RLOG_NSECT(u32Len);
+    BYTE *p;
+
+    if (n >= psLog->u32Num || n > 0xFFFF)
+        return FR_INVALID_PARAMETER;
+
+    for (i = 0, p = pu8Buf; i < n; i++, p += RLOG_SS)
+    {
+        RLog_Put32(p, (DWORD)(psLog->u64Seq + i));
+        RLog_Put32(p + 4, u32Len);
+        p[8] = (BYTE)i;
+        p[9] = (BYTE)(i >> 8);
+        p[10] = p[11] = 0;
+        RLog_Put32(p + 16, (DWORD)((psLog->u64Seq + i) >> 32));
+
+        if (i == n - 1)                             // Pad the last sector
+            memset(p + RLOG_HDR + (u32Len - i * RLOG_DATA), 0, RLOG_DATA - (u32Len - i * RLOG_DATA));
+
+        RLog_Put32(p + 12, RLog_Sum(p, psLog->u32Epoch));
+    }
+
+    res = RLog_Xfer(psLog, pu8Buf, psLog->u64Seq, n, 1);
+
+    if (res == FR_OK)                               // A failed record is written again on the same sectors
+        psLog->u64Seq += n;
+
+    return res;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Move the read pointer to the oldest record in the ring                */
+/*-----------------------------------------------------------------------*/
+
+void RLog_Rewind(RLOG_T *psLog)
+{
+    psLog->u64Rd = (psLog->u64Seq > psLog->u32Num) ? psLog->u64Seq - psLog->u32Num : 0;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Read the next record, *pu32Len gets 0 at the write head               */
+/*-----------------------------------------------------------------------*/
+
+FRESULT RLog_Read(RLOG_T *psLog, BYTE *pu8Buf, UINT u32Size, UINT *pu32Len, uint64_t *pu64Seq)
+{
+    FRESULT res;
+    DWORD i, n, u32Len;
+
+    *pu32Len = 0;
+
+    if (u32Size < RLOG_SS)
+        return FR_NOT_ENOUGH_CORE;
+
+    while (psLog->u64Rd < psLog->u64Seq)
+    {
+        if (psLog->u64Seq - psLog->u64Rd > psLog->u32Num)   // Overwritten by the writer
+            psLog->u64Rd = psLog->u64Seq - psLog->u32Num;
+
+        res = RLog_Xfer(psLog, pu8Buf, psLog->u64Rd, 1, 0);
+
+        if (res != FR_OK)
+            return res;
+
+        if (RLog_Check(psLog, pu8Buf, psLog->u64Rd) != 0)   // Not the first sector of a record
+        {
+            psLog->u64Rd++;
+            continue;
+        }
+
+        u32Len = RLog_Get32(pu8Buf + 4);
+        n = RLOG_NSECT(u32Len);
+
+        if (n * RLOG_SS > u32Size)
+            return FR_NOT_ENOUGH_CORE;
+
+        if (n > psLog->u64Seq - psLog->u64Rd)       // Torn at the write head
+        {
+            psLog->u64Rd = psLog->u64Seq;
+            break;
+        }
+
+        res = RLog_Xfer(psLog, pu8Buf + RLOG_SS, psLog->u64Rd + 1, n - 1, 0);
+
+        if (res != FR_OK)
+            return res;
+
+        for (i = 1; i < n && RLog_Check(psLog, pu8Buf + i * RLOG_SS, psLog->u64Rd + i) == (int32_t)i; i++);
+
+        if (i < n)                                  // A torn record, the next one starts after it
+        {
+            psLog->u64Rd++;
+            continue;
+        }
+
+        *pu32Len = u32Len;
+
+        if (pu64Seq)
+            *pu64Seq = psLog->u64Rd;
+
+        psLog->u64Rd += n;
+        break;
+    }
+
+    return FR_OK;
+}
@@ -0,0 +1,54 @@
+/****************************************************************************//**
+ * @file    ringlog.h
+ * @brief
+ *          Ring log over a preallocated contiguous FatFs file
+ * @note
+ * Copyright (C) 2013 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#ifndef __RINGLOG_H__
+#define __RINGLOG_H__
+
+#include <stdint.h>
+#include "ff.h"
+
+/****************************************************************************/
+/* Define                                                                   */
+/****************************************************************************/
+
+#define RLOG_SS             FF_MAX_SS                   // Sector size
+#define RLOG_HDR            20                          // Sector header: sequence, record length, index and checksum
+#define RLOG_DATA           (RLOG_SS - RLOG_HDR)        // Record data per sector
+
+// Sectors and buffer size for a record of u32Len bytes
+#define RLOG_NSECT(u32Len)  ((u32Len) > RLOG_DATA ? ((u32Len) + RLOG_DATA - 1) / RLOG_DATA : 1)
+#define RLOG_BUFSIZE(u32Len) (RLOG_NSECT(u32Len) * RLOG_SS)
+
+// Pointer to byte u32Ofs of the record data in a record buffer
+#define RLOG_PTR(pu8Buf, u32Ofs) ((pu8Buf) + (u32Ofs) / RLOG_DATA * RLOG_SS + RLOG_HDR + (u32Ofs) % RLOG_DATA)
+
+/****************************************************************************/
+/* Type                                                                     */
+/****************************************************************************/
+
+typedef struct
+{
+    BYTE     u8Drv;                     // Physical drive of the volume
+    LBA_t    u32Base;                   // First sector of the file (ring header), ring sectors follow it
+    DWORD    u32Num;                    // Number of ring sectors
+    DWORD    u32Epoch;                  // Ring instance, seeds the sector checksum
+    uint64_t u64Seq;                    // Sequence number of the next sector to be written
+    uint64_t u64Rd;                     // Sequence number of the next sector to be read
+    BYTE     au8Sect[RLOG_SS];          // Sector buffer for the ring header and recovery
+} RLOG_T;
+
+/****************************************************************************/
+/* Functions                                                                */
+/****************************************************************************/
+
+FRESULT RLog_Create(RLOG_T *psLog, const TCHAR *path, DWORD u32Size);
+FRESULT RLog_Open(RLOG_T *psLog, const TCHAR *path);
+FRESULT RLog_Write(RLOG_T *psLog, BYTE *pu8Buf, UINT u32Len);
+void    RLog_Rewind(RLOG_T *psLog);
+FRESULT RLog_Read(RLOG_T *psLog, BYTE *pu8Buf, UINT u32Size, UINT *pu32Len, uint64_t *pu64Seq);
+
+#endif
@@ -26,6 +26,8 @@
 /****************************************************************************/
 
 unsigned char  SD_Type = 0;
+static unsigned char SD_EraseData = 0;     // Data read from erased blocks, 0:Not checked, 1:Zeros, 2:Ones or unknown
+static unsigned int  SD_EraseUnit = 1;     // Erase unit in sectors, larger than 1 on SDSC cards without ERASE_BLK_EN
 
 /****************************************************************************/
 /* Functions                                                                */
@@ -115,6 +117,17 @@ unsigned char SD_WaitReady(void)
     return 1;   // Fail
 }
 
+unsigned char SD_IsBusy(void)
+{
+    unsigned char r;
+
+    Clr_SD_CS;
+    r = SD_SPI_ReadWriteByte(0xFF);     // Card holds DO low while it is busy
+    SD_DisSelect();
+
+    return (r != 0xFF);
+}
+
 unsigned char SD_GetResponse(unsigned char Response)
 {
     unsigned int Count = 0xFFFF;
@@ -156,7 +169,7 @@ unsigned char SD_SendBlock(unsigned char *buf, unsigned char cmd)
     if (cmd != 0xFD)
     {
         for (t = 0; t < 512; t++)
-            SD_SPI_ReadWriteByte(buf[t]);
+            SD_SPI_ReadWriteByte(buf ? buf[t] : 0);     // No buffer: zero block
 
         SD_SPI_ReadWriteByte(0xFF);
         SD_SPI_ReadWriteByte(0xFF);
@@ -236,6 +249,76 @@ unsigned char SD_GetCSD(unsigned char *csd_data)
         return 0;
 }
 
+unsigned char SD_GetSDStatus(unsigned char *sds_data)
+{
+    unsigned char r1;
+
+    SD_SendCmd(CMD55, 0, 0x01);
+    r1 = SD_SendCmd(CMD13, 0, 0x01);    // ACMD13, R2 response
+
+    if (r1 == 0)
+    {
+        SD_SPI_ReadWriteByte(0xFF);     // Skip 2nd byte of R2
+        r1 = SD_RecvData(sds_data, 64);
+    }
+
+    SD_DisSelect();
+
+    if (r1)
+        return 1;
+    else
+        return 0;
+}
+
+unsigned char SD_GetSCR(unsigned char *scr_data)
+{
+    unsigned char r1;
+
+    SD_SendCmd(CMD55, 0, 0x01);
+    r1 = SD_SendCmd(CMD51, 0, 0x01);    // ACMD51
+
+    if (r1 == 0)
+    {
+        r1 = SD_RecvData(scr_data, 8);
+    }
+
+    SD_DisSelect();
+
+    if (r1)
+        return 1;
+    else
+        return 0;
+}
+
+unsigned int SD_GetBlockSize(void)
+{
+    static const unsigned int au_sect[6] = {16384, 24576, 32768, 49152, 65536, 131072};  // AU_SIZE 0xA-0xF (8MB-64MB)
+    unsigned char buf[64];
+    unsigned int n;
+
+    if (SD_Type & SD_TYPE_V2)   // SD V2.0 or later: AU size in SD status
+    {
+        if (SD_GetSDStatus(buf) != 0)
+            return 1;
+
+        n = buf[10] >> 4;
+
+        if (n == 0)
+            return 1;           // AU size is not defined
+
+        return (n < 10) ? 16U << n : au_sect[n - 10];
+    }
+
+    if (SD_GetCSD(buf) != 0)
+        return 1;
+
+    if (SD_Type == SD_TYPE_V1)  // SD V1.x: erase sector size in CSD
+        return (((buf[10] & 63) << 1) + ((buf[11] & 128) >> 7) + 1) << ((buf[13] >> 6) - 1);
+
+    // MMC: erase group size in CSD
+    return (((buf[10] & 124) >> 2) + 1) * (((buf[11] & 3) << 3) + ((buf[11] & 224) >> 5) + 1);
+}
+
 unsigned int SD_GetSectorCount(void)
 {
     unsigned char csd[16];
@@ -282,6 +365,7 @@ unsigned char SD_Initialize(void)
     } while ((r1 != 0x01) && retry--);
 
     SD_Type = 0;
+    SD_EraseData = 0;
 
     if (r1 == 0x01)
     {
@@ -375,13 +459,16 @@ unsigned char SD_ReadDisk(unsigned char *buf, unsigned int sector, unsigned char
     {
         r1 = SD_SendCmd(CMD18, sector, 0x01);
 
-        do
+        if (r1 == 0)
         {
-            r1 = SD_RecvData(buf, 512);
-            buf += 512;
-        } while (--cnt && r1 == 0);
+            do
+            {
+                r1 = SD_RecvData(buf, 512);
+                buf += 512;
+            } while (--cnt && r1 == 0);
 
-        SD_SendCmd(CMD12, 0, 0x01);
+            SD_SendCmd(CMD12, 0, 0x01);
+        }
     }
 
     SD_DisSelect();
@@ -422,7 +509,8 @@ unsigned char SD_WriteDisk(unsigned char *buf, unsigned int  sector, unsigned ch
                 buf += 512;
             } while (--cnt && r1 == 0);
 
-            r1 = SD_SendBlock(0, 0xFD);
+            if (SD_SendBlock(0, 0xFD) != 0 && r1 == 0)
+                r1 = 1;
         }
     }
 
@@ -430,6 +518,101 @@ unsigned char SD_WriteDisk(unsigned char *buf, unsigned int  sector, unsigned ch
     return r1;
 }
 
+static unsigned char SD_WriteZeros(unsigned int sector, unsigned int cnt)
+{
+    unsigned char r1;
+
+    if (SD_Type != SD_TYPE_MMC)
+    {
+        SD_SendCmd(CMD55, 0, 0x01);
+        SD_SendCmd(CMD23, cnt, 0x01);   // Pre-erase count of the multiple block write
+    }
+
+    if (SD_Type != SD_TYPE_V2HC)
+        sector *= 512;
+
+    r1 = SD_SendCmd(CMD25, sector, 0x01);
+
+    if (r1 == 0)
+    {
+        do
+        {
+            r1 = SD_SendBlock(0, 0xFC);
+        } while (--cnt && r1 == 0);
+
+        if (SD_SendBlock(0, 0xFD) != 0 && r1 == 0)
+            r1 = 1;
+    }
+
+    SD_DisSelect();
+    return r1;
+}
+
+unsigned char SD_ZeroDisk(unsigned int sector, unsigned int cnt)
+{
+    unsigned char r1;
+    unsigned char buf[16];
+    unsigned int first, end, a0, a1;
+
+    if (cnt == 0)
+        return 1;
+
+    if (SD_EraseData == 0)
+    {
+        SD_EraseData = 2;
+        SD_EraseUnit = 1;
+
+        if (SD_Type != SD_TYPE_MMC && SD_GetSCR(buf) == 0 && !(buf[1] & 0x80))
+            SD_EraseData = 1;           // DATA_STAT_AFTER_ERASE in SCR is 0
+
+        if (SD_EraseData == 1)
+        {
+            if (SD_GetCSD(buf) != 0)
+                SD_EraseData = 2;
+            else if ((buf[0] & 0xC0) == 0 && !(buf[10] & 0x40))    // CSD v1 with ERASE_BLK_EN 0: erased in units of SECTOR_SIZE
+                SD_EraseUnit = (((buf[10] & 63) << 1) + ((buf[11] & 128) >> 7) + 1) << ((buf[13] >> 6) - 1);
+        }
+    }
+
+    if (SD_EraseData == 1)              // Erase the whole erase units in the range to zeros
+    {
+        first = (sector + SD_EraseUnit - 1) / SD_EraseUnit * SD_EraseUnit;
+        end = (sector + cnt) / SD_EraseUnit * SD_EraseUnit;
+
+        if (first < end)
+        {
+            a0 = first;
+            a1 = end - 1;
+
+            if (SD_Type != SD_TYPE_V2HC)
+            {
+                a0 *= 512;
+                a1 *= 512;
+            }
+
+            if (SD_SendCmd(CMD32, a0, 0x01) == 0 &&
+                    SD_SendCmd(CMD33, a1, 0x01) == 0 &&
+                    SD_SendCmd(CMD38, 0, 0x01) == 0)
+            {
+                r1 = SD_WaitReady();    // Card holds DO low until the erase is done
+                SD_DisSelect();
+
+                if (r1 == 0 && first > sector)  // Write zeros to the partial units at both ends
+                    r1 = SD_WriteZeros(sector, first - sector);
+
+                if (r1 == 0 && end < sector + cnt)
+                    r1 = SD_WriteZeros(end, sector + cnt - end);
+
+                return r1;
+            }
+
+            SD_DisSelect();             // Erase is refused: write zeros instead
+        }
+    }
+
+    return SD_WriteZeros(sector, cnt);
+}
+
 unsigned char SD_CRC_OFF(void)
 {
     unsigned char r1;
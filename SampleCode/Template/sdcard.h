@@ -24,13 +24,18 @@
 #define CMD9    9
 #define CMD10   10
 #define CMD12   12
+#define CMD13   13
 #define CMD16   16
 #define CMD17   17
 #define CMD18   18
 #define CMD23   23
 #define CMD24   24
 #define CMD25   25
+#define CMD32   32
+#define CMD33   33
+#define CMD38   38
 #define CMD41   41
+#define CMD51   51
 #define CMD55   55
 #define CMD58   58
 #define CMD59   59
@@ -62,6 +67,7 @@ extern unsigned char  SD_Type;
 
 unsigned char SD_SPI_ReadWriteByte(unsigned char data);
 unsigned char SD_WaitReady(void);
+unsigned char SD_IsBusy(void);
 unsigned char SD_GetResponse(unsigned char Response);
 unsigned char SD_Initialize(void);
 unsigned char SD_ReadDisk(unsigned char *buf, unsigned int sector, unsigned char cnt);
@@ -69,6 +75,10 @@ unsigned char SD_WriteDisk(unsigned char *buf, unsigned int sector, unsigned cha
 unsigned int  SD_GetSectorCount(void);
 unsigned char SD_GetCID(unsigned char *cid_data);
 unsigned char SD_GetCSD(unsigned char *csd_data);
+unsigned char SD_GetSDStatus(unsigned char *sds_data);
+unsigned int  SD_GetBlockSize(void);
+unsigned char SD_GetSCR(unsigned char *scr_data);
+unsigned char SD_ZeroDisk(unsigned int sector, unsigned int cnt);
 unsigned char SD_CRC_OFF(void);
 
 #endif  /* __SDCARD_H__ */
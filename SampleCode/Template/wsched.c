@@ -0,0 +1,343 @@
+/****************************************************************************//**
+ * @file    wsched.c
+ * @brief
+ *          Write scheduler for many concurrently open log files over FatFs
+ *
+ *          Each stream stages its data in its own RAM buffer, so appending
+ *          to the streams in turn does not touch the card. The scheduler
+ *          writes a stream when it has staged up to the next cluster boundary
+ *          of its file, so that each f_write() is a multi-sector transfer
+ *          straight from the staging buffer that allocates at most one
+ *          cluster. The streams due in a pass are written in order of the
+ *          FAT (or exFAT bitmap) sector their allocation updates, so the
+ *          FatFs window stays on one sector for the streams sharing it.
+ *
+ *          A stream can have a latency limit, the longest time data may
+ *          stay staged, and a throughput limit that keeps it from taking
+ *          the card from the other streams. A latency deadline overrides the
+ *          throughput limit and the overrun is paid back from later credit.
+ *          Time is given by the caller in ms (get_tick() of main.c).
+ * @note
+ * Copyright (C) 2013 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#include <string.h>
+#include "NuMicro.h"
+#include "wsched.h"
+
+/****************************************************************************/
+/* Functions                                                                */
+/****************************************************************************/
+
+static UINT WSched_SectSize(FATFS *fs)
+{
+#if FF_MAX_SS != FF_MIN_SS
+    return fs->ssize;
+#else
+    (void)fs;
+    return FF_MAX_SS;
+#endif
+}
+
+// FAT or allocation bitmap sector updated by the next cluster allocation of the file
+static LBA_t WSched_MetaSect(const FIL *fp)
+{
+    FATFS *fs = fp->obj.fs;
+    DWORD clst = (fp->fptr != 0) ? fp->clust : fs->last_clst;
+    UINT ss = WSched_SectSize(fs);
+
+    switch (fs->fs_type)
+    {
+        case FS_FAT12:
+            return fs->fatbase + clst * 3 / 2 / ss;
+
+        case FS_FAT16:
+            return fs->fatbase + clst / (ss / 2);
+
+#if FF_FS_EXFAT
+        case FS_EXFAT:
+            return fs->bitbase + clst / (ss * 8);
+#endif
+
+        default:
+            return fs->fatbase + clst / (ss / 4);
+    }
+}
+
+// Sector holding the directory entry of the file
+static LBA_t WSched_DirSect(const FIL *fp)
+{
+#if FF_FS_EXFAT
+    if (fp->obj.fs->fs_type == FS_EXFAT)
+        return fp->obj.c_scl;                       // Containing directory, entries are not tracked by sector
+
+#endif
+    return fp->dir_sect;
+}
+
+// Bytes to be staged for a regular write: up to the next cluster boundary, or what the buffer holds
+static UINT WSched_Chunk(const WSTREAM_T *psStream)
+{
+    FATFS *fs = psStream->fp->obj.fs;
+    UINT ss = WSched_SectSize(fs);
+    UINT cb = fs->csize * ss;
+    UINT u32Ofs = (UINT)(psStream->fp->fptr % ss);
+    UINT n;
+
+    if (u32Ofs != 0)                                // A deadline wrote a partial sector, fill it up to get back on the sector boundary
+        return ss - u32Ofs;
+
+    n = cb - (UINT)(psStream->fp->fptr % cb);
+
+    if (n > psStream->u32Size)
+        n = psStream->u32Size / ss * ss;
+
+    return n;
+}
+
+static void WSched_Credit(WSTREAM_T *psStream, uint32_t u32Now)
+{
+    uint32_t u32Elapsed = u32Now - psStream->u32Last;
+    uint32_t u32Gain;
+
+    if (psStream->u32Rate == 0)
+        return;
+
+    if (u32Elapsed > 1000)                          // Credit is capped at the buffer size anyway
+        u32Elapsed = 1000;
+
+    u32Gain = u32Elapsed * (psStream->u32Rate / 1000) + u32Elapsed * (psStream->u32Rate % 1000) / 1000;
+
+    if (u32Gain == 0)                               // Keep the time until it makes a byte
+        return;
+
+    psStream->u32Last = u32Now;
+
+    if (psStream->i32Credit + (int32_t)u32Gain > (int32_t)psStream->u32Size || u32Gain > psStream->u32Size)
+        psStream->i32Credit = (int32_t)psStream->u32Size;
+    else
+        psStream->i32Credit += (int32_t)u32Gain;
+}
+
+// Writes the staged data by chunks, or all of it if i32All, and keeps the rest staged
+static FRESULT WSched_Write(WSTREAM_T *psStream, int i32All)
+{
+    FRESULT res = FR_OK;
+    UINT n, bw, u32Done = 0;
+
+    while (u32Done < psStream->u32Len)
+    {
+        n = WSched_Chunk(psStream);
+
+        if (n == 0 || n > psStream->u32Len - u32Done)
+        {
+            if (!i32All)
+                break;
+
+            n = psStream->u32Len - u32Done;
+        }
+
+        if (!i32All && psStream->u32Rate != 0 && psStream->i32Credit <= 0)
+            break;
+
+        res = f_write(psStream->fp, psStream->pu8Buf + u32Done, n, &bw);
+        u32Done += bw;
+
+        if (psStream->u32Rate != 0)
+            psStream->i32Credit -= (int32_t)bw;
+
+        if (res == FR_OK && bw < n)                 // Volume is full, the data stays staged
+            res = FR_DENIED;
+
+        if (res != FR_OK)
+            break;
+    }
+
+    if (u32Done > 0)
+    {
+        psStream->u32Len -= u32Done;
+        memmove(psStream->pu8Buf, psStream->pu8Buf + u32Done, psStream->u32Len);
+    }
+
+    return res;
+}
+
+// Inserts the stream into the list sorted by the key, returns its position
+static UINT WSched_Insert(WSTREAM_T **apStream, LBA_t *aKey, UINT u32Num, WSTREAM_T *psStream, LBA_t key)
+{
+    UINT i;
+
+    for (i = u32Num; i > 0 && aKey[i - 1] > key; i--)
+    {
+        apStream[i] = apStream[i - 1];
+        aKey[i] = aKey[i - 1];
+    }
+
+    apStream[i] = psStream;
+    aKey[i] = key;
+
+    return i;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Initialize the scheduler                                              */
+/*-----------------------------------------------------------------------*/
+
+void WSched_Init(WSCHED_T *psSched)
+{
+    memset(psSched, 0, sizeof(WSCHED_T));
+}
+
+/*-----------------------------------------------------------------------*/
+/* Register an open file as a stream                                     */
+/*-----------------------------------------------------------------------*/
+
+FRESULT WSched_Add(WSCHED_T *psSched, WSTREAM_T *psStream, FIL *fp, void *pvBuf, UINT u32Size, uint32_t u32Latency, uint32_t u32Rate, uint32_t u32Now)
+{
+    if (fp == NULL || fp->obj.fs == NULL || pvBuf == NULL)
+        return FR_INVALID_OBJECT;
+
+    if (u32Size < WSched_SectSize(fp->obj.fs))     // A chunk takes a sector at least
+        return FR_INVALID_PARAMETER;
+
+    if (psSched->u32Num >= WSCHED_MAX)
+        return FR_TOO_MANY_OPEN_FILES;
+
+    memset(psStream, 0, sizeof(WSTREAM_T));
+    psStream->fp = fp;
+    psStream->pu8Buf = (BYTE *)pvBuf;
+    psStream->u32Size = u32Size;
+    psStream->u32Latency = u32Latency;
+    psStream->u32Rate = u32Rate;
+    psStream->i32Credit = (int32_t)u32Size;
+    psStream->u32Last = u32Now;
+    psSched->apStream[psSched->u32Num++] = psStream;
+
+    return FR_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Write out the staged data of a stream and unregister it               */
+/*-----------------------------------------------------------------------*/
+
+FRESULT WSched_Remove(WSCHED_T *psSched, WSTREAM_T *psStream)
+{
+    FRESULT res;
+    UINT i;
+
+    res = WSched_Write(psStream, 1);
+
+    if (res != FR_OK)
+        return res;
+
+    for (i = 0; i < psSched->u32Num && psSched->apStream[i] != psStream; i++);
+
+    if (i == psSched->u32Num)
+        return FR_INVALID_OBJECT;
+
+    for (psSched->u32Num--; i < psSched->u32Num; i++)
+        psSched->apStream[i] = psSched->apStream[i + 1];
+
+    return FR_OK;   // The file is left open for the caller to close
+}
+
+/*-----------------------------------------------------------------------*/
+/* Stage data to a stream, returns the bytes taken                       */
+/*-----------------------------------------------------------------------*/
+
+UINT WSched_Put(WSTREAM_T *psStream, const void *pvData, UINT u32Len, uint32_t u32Now)
+{
+    if (u32Len > psStream->u32Size - psStream->u32Len)  // Short when the stream is held by its throughput limit
+        u32Len = psStream->u32Size - psStream->u32Len;
+
+    if (u32Len == 0)
+        return 0;
+
+    if (psStream->u32Len == 0)
+        psStream->u32Since = u32Now;
+
+    memcpy(psStream->pu8Buf + psStream->u32Len, pvData, u32Len);
+    psStream->u32Len += u32Len;
+
+    return u32Len;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Write the streams that are due, call it from the main loop            */
+/*-----------------------------------------------------------------------*/
+
+FRESULT WSched_Run(WSCHED_T *psSched, uint32_t u32Now)
+{
+    WSTREAM_T *apStream[WSCHED_MAX], *psStream;
+    LBA_t aKey[WSCHED_MAX];
+    uint8_t au8Due[WSCHED_MAX], u8Due;
+    FRESULT res;
+    UINT i, j, n = 0;
+
+    for (i = 0; i < psSched->u32Num; i++)
+    {
+        psStream = psSched->apStream[i];
+        WSched_Credit(psStream, u32Now);
+
+        if (psStream->u32Len == 0)
+            continue;
+
+        u8Due = psStream->u32Latency != 0 && u32Now - psStream->u32Since >= psStream->u32Latency;
+
+        if (!u8Due && (psStream->u32Len < WSched_Chunk(psStream) || WSched_Chunk(psStream) == 0 ||
+                       (psStream->u32Rate != 0 && psStream->i32Credit <= 0)))
+            continue;                               // Nothing to write yet
+
+        j = WSched_Insert(apStream, aKey, n, psStream, WSched_MetaSect(psStream->fp));
+        memmove(&au8Due[j + 1], &au8Due[j], n++ - j);
+        au8Due[j] = u8Due;                          // A stream past its deadline writes all it has
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        res = WSched_Write(apStream[i], au8Due[i]);
+
+        if (res != FR_OK)
+            return res;
+    }
+
+    return FR_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Write all staged data, and the directory entries if i32Sync           */
+/*-----------------------------------------------------------------------*/
+
+FRESULT WSched_Flush(WSCHED_T *psSched, int i32Sync)
+{
+    WSTREAM_T *apStream[WSCHED_MAX];
+    LBA_t aKey[WSCHED_MAX];
+    FRESULT res;
+    UINT i;
+
+    for (i = 0; i < psSched->u32Num; i++)
+        WSched_Insert(apStream, aKey, i, psSched->apStream[i], WSched_MetaSect(psSched->apStream[i]->fp));
+
+    for (i = 0; i < psSched->u32Num; i++)
+    {
+        res = WSched_Write(apStream[i], 1);
+
+        if (res != FR_OK)
+            return res;
+    }
+
+    if (!i32Sync)
+        return FR_OK;
+
+    for (i = 0; i < psSched->u32Num; i++)           // Entries sharing a directory sector are updated in a row
+        WSched_Insert(apStream, aKey, i, psSched->apStream[i], WSched_DirSect(psSched->apStream[i]->fp));
+
+    for (i = 0; i < psSched->u32Num; i++)
+    {
+        res = f_sync(apStream[i]->fp);
+
+        if (res != FR_OK)
+            return res;
+    }
+
+    return FR_OK;
+}
@@ -0,0 +1,54 @@
+/****************************************************************************//**
+ * @file    wsched.h
+ * @brief
+ *          Write scheduler for many concurrently open log files over FatFs
+ * @note
+ * Copyright (C) 2013 Nuvoton Technology Corp. All rights reserved.
+*****************************************************************************/
+#ifndef __WSCHED_H__
+#define __WSCHED_H__
+
+#include <stdint.h>
+#include "ff.h"
+
+/****************************************************************************/
+/* Define                                                                   */
+/****************************************************************************/
+
+#define WSCHED_MAX          16          // Streams per scheduler
+
+/****************************************************************************/
+/* Type                                                                     */
+/****************************************************************************/
+
+typedef struct
+{
+    FIL      *fp;                       // Open file the stream appends to
+    BYTE     *pu8Buf;                   // Staging buffer
+    UINT     u32Size;                   // Size of the staging buffer [byte]
+    UINT     u32Len;                    // Staged data [byte]
+    uint32_t u32Since;                  // Time the oldest staged data was put [ms]
+    uint32_t u32Latency;                // Maximum time data is staged [ms] (0: no limit)
+    uint32_t u32Rate;                   // Maximum write throughput [byte/s] (0: no limit)
+    int32_t  i32Credit;                 // Bytes the stream may write now, negative after a deadline overran it
+    uint32_t u32Last;                   // Time the credit was last updated [ms]
+} WSTREAM_T;
+
+typedef struct
+{
+    WSTREAM_T *apStream[WSCHED_MAX];    // Registered streams
+    UINT      u32Num;                   // Number of registered streams
+} WSCHED_T;
+
+/****************************************************************************/
+/* Functions                                                                */
+/****************************************************************************/
+
+void    WSched_Init(WSCHED_T *psSched);
+FRESULT WSched_Add(WSCHED_T *psSched, WSTREAM_T *psStream, FIL *fp, void *pvBuf, UINT u32Size, uint32_t u32Latency, uint32_t u32Rate, uint32_t u32Now);
+FRESULT WSched_Remove(WSCHED_T *psSched, WSTREAM_T *psStream);
+UINT    WSched_Put(WSTREAM_T *psStream, const void *pvData, UINT u32Len, uint32_t u32Now);
+FRESULT WSched_Run(WSCHED_T *psSched, uint32_t u32Now);
+FRESULT WSched_Flush(WSCHED_T *psSched, int i32Sync);
+
+#endif